@@ -0,0 +1,87 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#pragma once
+
+#include <string.h>
+#include <vector>
+#include "NvPerfInit.h"
+#include "NvPerfLz4.h"
+#include "NvPerfReportDefinition.h"
+
+namespace nv { namespace perf {
+
+    // A ReportDefinition whose names and HTML are embedded LZ4-compressed, as generated by tools/ReportDefinitionCompressor. The contents
+    // are the required counters, ratios and throughputs followed by the HTML, each null-terminated. The generated GetReportDefinition()s
+    // construct it as a function-local static, so that a chip's contents are decompressed once, on first use, and only for chips in use.
+    class CompressedReportDefinition
+    {
+    private:
+        std::vector<char> m_contents;
+        std::vector<const char*> m_names;
+        ReportDefinition m_definition;
+
+    public:
+        CompressedReportDefinition(const unsigned char* pCompressedContents, size_t compressedSize, size_t contentsSize, size_t numCounters, size_t numRatios, size_t numThroughputs)
+            : m_contents(contentsSize)
+            , m_names()
+            , m_definition()
+        {
+            if (!Lz4DecompressBlock(pCompressedContents, compressedSize, reinterpret_cast<uint8_t*>(m_contents.data()), m_contents.size()) || m_contents.empty() || m_contents.back())
+            {
+                NV_PERF_LOG_ERR(10, "Failed to decompress the report definition\n");
+                m_contents.clear();
+                return;
+            }
+
+            const size_t numNames = numCounters + numRatios + numThroughputs;
+            m_names.reserve(numNames);
+            const char* pContents = m_contents.data();
+            const char* pContentsEnd = pContents + m_contents.size();
+            for (size_t nameIndex = 0; nameIndex < numNames && pContents != pContentsEnd; ++nameIndex)
+            {
+                m_names.push_back(pContents);
+                pContents += strlen(pContents) + 1;
+            }
+            if (m_names.size() != numNames || pContents == pContentsEnd)
+            {
+                NV_PERF_LOG_ERR(10, "The report definition has fewer strings than expected\n");
+                m_names.clear();
+                m_contents.clear();
+                return;
+            }
+
+            const char* const* ppNames = m_names.data();
+            m_definition.ppCounterNames = numCounters ? ppNames : nullptr;
+            m_definition.numCounters = numCounters;
+            m_definition.ppRatioNames = numRatios ? ppNames + numCounters : nullptr;
+            m_definition.numRatios = numRatios;
+            m_definition.ppThroughputNames = numThroughputs ? ppNames + numCounters + numRatios : nullptr;
+            m_definition.numThroughputs = numThroughputs;
+            m_definition.pReportHtml = pContents;
+        }
+        CompressedReportDefinition(const CompressedReportDefinition&) = delete;
+        CompressedReportDefinition& operator=(const CompressedReportDefinition&) = delete;
+
+        // All members are null if the contents failed to decompress.
+        const ReportDefinition& GetReportDefinition() const
+        {
+            return m_definition;
+        }
+    };
+
+} }
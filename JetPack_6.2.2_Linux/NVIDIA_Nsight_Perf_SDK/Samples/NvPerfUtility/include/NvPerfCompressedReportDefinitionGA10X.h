@@ -0,0 +1,2374 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+// Generated by tools/ReportDefinitionCompressor from NvPerfReportDefinitionGA10X.h, do not edit.
+
+#pragma once
+
+#include "NvPerfCompressedReportDefinition.h"
+
+namespace nv { namespace perf { namespace compressed { namespace ga10x {
+
+    namespace PerRangeReport {
+
+        inline ReportDefinition GetReportDefinition()
+        {
+            static const unsigned char CompressedContents[] = {
+                0xf1, 0x14, 0x64, 0x72, 0x61, 0x6d, 0x5f, 0x5f, 0x63, 0x79, 0x63, 0x6c, 0x65, 0x73, 0x5f, 0x65, 0x6c, 0x61, 0x70, 0x73,
+                0x65, 0x64, 0x00, 0x66, 0x65, 0x5f, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x0f, 0x00, 0xf1,
+                0x13, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5f, 0x6f, 0x70, 0x73, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x5f, 0x62, 0x75, 0x6e,
+                0x64, 0x6c, 0x65, 0x5f, 0x63, 0x6d, 0x64, 0x5f, 0x67, 0x6f, 0x5f, 0x69, 0x64, 0x6c, 0x65, 0x27, 0x00, 0xfd, 0x0a, 0x70,
+                0x69, 0x78, 0x65, 0x6c, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x73,
+                0x00, 0x67, 0x70, 0x63, 0x64, 0x00, 0xf5, 0x06, 0x67, 0x70, 0x75, 0x5f, 0x5f, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x64, 0x75,
+                0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x67, 0x72, 0x26, 0x00, 0x61, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x12, 0x00,
+                0x83, 0x64, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x8d, 0x00, 0xda, 0x69, 0x64, 0x63, 0x5f, 0x5f, 0x72, 0x65, 0x71,
+                0x75, 0x65, 0x73, 0x74, 0x73, 0x0e, 0x00, 0xab, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x5f, 0x68, 0x69, 0x27, 0x00,
+                0x04, 0x19, 0x00, 0xff, 0x14, 0x6d, 0x69, 0x73, 0x73, 0x00, 0x6c, 0x31, 0x74, 0x65, 0x78, 0x5f, 0x5f, 0x64, 0x61, 0x74,
+                0x61, 0x5f, 0x70, 0x69, 0x70, 0x65, 0x5f, 0x6c, 0x73, 0x75, 0x5f, 0x77, 0x61, 0x76, 0x65, 0x66, 0x72, 0x6f, 0x6e, 0x74,
+                0x20, 0x00, 0x0e, 0x7f, 0x5f, 0x6d, 0x65, 0x6d, 0x5f, 0x6c, 0x67, 0x27, 0x00, 0x12, 0x6f, 0x73, 0x68, 0x61, 0x72, 0x65,
+                0x64, 0x2b, 0x00, 0x13, 0x6e, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x2c, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x9e, 0x00, 0x09,
+                0x0a, 0x20, 0x00, 0x0f, 0x4c, 0x00, 0x19, 0x01, 0x2c, 0x00, 0x65, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x2c, 0x00, 0x01,
+                0x9a, 0x00, 0x84, 0x72, 0x69, 0x74, 0x65, 0x62, 0x61, 0x63, 0x6b, 0x86, 0x01, 0x06, 0x1c, 0x00, 0x26, 0x69, 0x6e, 0x7b,
+                0x01, 0x03, 0x16, 0x00, 0x01, 0x54, 0x00, 0x0f, 0x32, 0x00, 0x04, 0x54, 0x74, 0x65, 0x78, 0x69, 0x6e, 0xd3, 0x01, 0xf9,
+                0x00, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x65, 0x64, 0x5f, 0x6f, 0x6e, 0x5f, 0x74, 0x73, 0x6c, 0x31, 0x8d, 0x01, 0x02, 0x29,
+                0x00, 0x0f, 0x5b, 0x00, 0x00, 0x60, 0x69, 0x6e, 0x5f, 0x73, 0x6d, 0x32, 0x0e, 0x00, 0x3b, 0x72, 0x65, 0x71, 0x1d, 0x02,
+                0x3d, 0x6c, 0x74, 0x73, 0x56, 0x02, 0x40, 0x70, 0x63, 0x69, 0x65, 0xf8, 0x01, 0x83, 0x61, 0x64, 0x5f, 0x62, 0x79, 0x74,
+                0x65, 0x73, 0x11, 0x00, 0x01, 0xa1, 0x00, 0x04, 0x12, 0x00, 0x60, 0x64, 0x61, 0x5f, 0x5f, 0x69, 0x6e, 0xce, 0x02, 0x49,
+                0x70, 0x72, 0x69, 0x6d, 0x11, 0x00, 0xf4, 0x02, 0x76, 0x65, 0x72, 0x74, 0x73, 0x00, 0x70, 0x65, 0x73, 0x5f, 0x5f, 0x73,
+                0x74, 0x72, 0x65, 0x61, 0x6d, 0xf8, 0x02, 0x4f, 0x61, 0x74, 0x74, 0x72, 0x19, 0x00, 0x02, 0x03, 0x43, 0x00, 0x0e, 0x19,
+                0x00, 0x03, 0x4b, 0x00, 0xb3, 0x72, 0x6f, 0x70, 0x5f, 0x5f, 0x65, 0x61, 0x72, 0x6c, 0x79, 0x7a, 0x64, 0x00, 0x50, 0x73,
+                0x61, 0x6d, 0x70, 0x6c, 0x88, 0x00, 0x08, 0x1b, 0x00, 0x21, 0x6b, 0x69, 0x1c, 0x01, 0x01, 0x3f, 0x03, 0x10, 0x73, 0xc0,
+                0x00, 0x10, 0x6c, 0x1b, 0x03, 0x0f, 0x24, 0x00, 0x02, 0x0f, 0x40, 0x00, 0x02, 0x03, 0x75, 0x00, 0x0a, 0x1c, 0x00, 0x03,
+                0xe5, 0x00, 0x02, 0x54, 0x00, 0x01, 0xb6, 0x03, 0x2c, 0x33, 0x64, 0x5c, 0x00, 0x4f, 0x6c, 0x61, 0x74, 0x65, 0x5b, 0x00,
+                0x04, 0x02, 0x1b, 0x00, 0x0f, 0x5a, 0x00, 0x02, 0x00, 0x06, 0x00, 0x20, 0x32, 0x63, 0x0b, 0x00, 0x0f, 0xb2, 0x00, 0x03,
+                0x01, 0x20, 0x00, 0x1f, 0x7a, 0x20, 0x00, 0x01, 0xdb, 0x72, 0x61, 0x73, 0x74, 0x65, 0x72, 0x5f, 0x5f, 0x7a, 0x63, 0x75,
+                0x6c, 0x6c, 0x12, 0x01, 0x0f, 0x1c, 0x00, 0x08, 0xcf, 0x5f, 0x6f, 0x70, 0x5f, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x65,
+                0x64, 0x28, 0x00, 0x0d, 0x51, 0x72, 0x65, 0x6a, 0x65, 0x63, 0x28, 0x00, 0x56, 0x74, 0x63, 0x6f, 0x72, 0x65, 0x24, 0x02,
+                0x48, 0x78, 0x65, 0x63, 0x75, 0x18, 0x00, 0x49, 0x72, 0x61, 0x79, 0x73, 0x0d, 0x00, 0x9f, 0x5f, 0x63, 0x61, 0x73, 0x74,
+                0x5f, 0x61, 0x70, 0x69, 0x16, 0x00, 0x00, 0x90, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x65, 0x64, 0x00, 0x73, 0x2f, 0x05, 0x25,
+                0x74, 0x61, 0x86, 0x02, 0x01, 0x10, 0x00, 0x09, 0x98, 0x02, 0x0d, 0x12, 0x00, 0x04, 0x10, 0x05, 0x28, 0x63, 0x73, 0x1c,
+                0x00, 0x04, 0xb3, 0x02, 0x00, 0x13, 0x00, 0x46, 0x69, 0x6e, 0x73, 0x74, 0xa0, 0x00, 0x0d, 0x12, 0x00, 0x02, 0xbe, 0x03,
+                0x3f, 0x61, 0x64, 0x75, 0x1b, 0x00, 0x06, 0x1f, 0x6c, 0x1b, 0x00, 0x06, 0x2f, 0x63, 0x62, 0x1b, 0x00, 0x06, 0x3f, 0x66,
+                0x6d, 0x61, 0x1b, 0x00, 0x08, 0x5f, 0x68, 0x65, 0x61, 0x76, 0x79, 0x20, 0x00, 0x06, 0x3f, 0x70, 0x36, 0x34, 0x1c, 0x00,
+                0x05, 0x2f, 0x69, 0x70, 0x57, 0x00, 0x06, 0x2f, 0x6c, 0x73, 0x8d, 0x00, 0x06, 0x6f, 0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72,
+                0x1e, 0x00, 0x07, 0x1f, 0x78, 0x1b, 0x00, 0x05, 0x7f, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x1f, 0x00, 0x05, 0x13,
+                0x78, 0x72, 0x00, 0x48, 0x73, 0x73, 0x75, 0x65, 0xa2, 0x01, 0x6e, 0x6d, 0x69, 0x6f, 0x32, 0x72, 0x66, 0xbb, 0x04, 0x03,
+                0x1c, 0x00, 0x32, 0x5f, 0x70, 0x71, 0x47, 0x04, 0x0e, 0xdc, 0x01, 0x0f, 0x1e, 0x00, 0x06, 0x0a, 0xe4, 0x00, 0x0f, 0x27,
+                0x00, 0x0c, 0x04, 0xd2, 0x00, 0x03, 0x27, 0x00, 0x02, 0xa2, 0x04, 0x0e, 0x6d, 0x00, 0xf3, 0x00, 0x70, 0x73, 0x5f, 0x71,
+                0x75, 0x61, 0x64, 0x73, 0x5f, 0x6c, 0x61, 0x75, 0x6e, 0x63, 0x68, 0x1e, 0x02, 0x21, 0x74, 0x68, 0x57, 0x00, 0x0f, 0x0a,
+                0x02, 0x03, 0x31, 0x5f, 0x70, 0x72, 0x67, 0x05, 0x0f, 0x2a, 0x00, 0x0c, 0x3f, 0x66, 0x6d, 0x61, 0x2a, 0x00, 0x17, 0x01,
+                0x0d, 0x02, 0x0f, 0x2f, 0x00, 0x15, 0x3f, 0x70, 0x36, 0x34, 0x2b, 0x00, 0x14, 0x2f, 0x69, 0x70, 0x84, 0x00, 0x15, 0x00,
+                0x99, 0x06, 0x0f, 0x2a, 0x00, 0x13, 0x1f, 0x78, 0x29, 0x00, 0x01, 0x0f, 0x40, 0x01, 0x02, 0x06, 0x15, 0x00, 0x0b, 0xa2,
+                0x03, 0x0f, 0x1f, 0x00, 0x05, 0x1f, 0x67, 0x1f, 0x00, 0x0b, 0x1f, 0x70, 0x1f, 0x00, 0x0d, 0x01, 0x68, 0x05, 0x8f, 0x6d,
+                0x61, 0x73, 0x6b, 0x5f, 0x6f, 0x66, 0x66, 0x2c, 0x00, 0x0a, 0x1f, 0x74, 0x8a, 0x00, 0x0c, 0x00, 0xc9, 0x06, 0x0f, 0x20,
+                0x00, 0x09, 0x12, 0x76, 0x1f, 0x00, 0x49, 0x77, 0x61, 0x72, 0x70, 0x4f, 0x02, 0x02, 0x11, 0x00, 0x09, 0x0c, 0x01, 0x0a,
+                0x13, 0x00, 0x0b, 0x0a, 0x01, 0x0f, 0x1d, 0x00, 0x03, 0x03, 0x08, 0x01, 0x0f, 0x1d, 0x00, 0x03, 0x03, 0x06, 0x01, 0x0f,
+                0x1d, 0x00, 0x03, 0x04, 0xd8, 0x00, 0x0f, 0x1e, 0x00, 0x04, 0x03, 0xd6, 0x00, 0x0f, 0x1e, 0x00, 0x03, 0x01, 0xd4, 0x00,
+                0x11, 0x73, 0xd8, 0x06, 0x0a, 0x2e, 0x05, 0x0d, 0x14, 0x00, 0x09, 0xc5, 0x00, 0x0f, 0x1e, 0x00, 0x06, 0x01, 0xc6, 0x00,
+                0x0f, 0x1e, 0x00, 0x06, 0x01, 0xc7, 0x00, 0x0f, 0x1e, 0x00, 0x06, 0x02, 0xc8, 0x00, 0x0f, 0x1f, 0x00, 0x07, 0x01, 0xc9,
+                0x00, 0x0f, 0x1f, 0x00, 0x06, 0x05, 0xca, 0x00, 0x0f, 0xc6, 0x02, 0x01, 0x0f, 0x1b, 0x00, 0x08, 0x03, 0xd9, 0x02, 0x01,
+                0x3c, 0x02, 0x0f, 0x24, 0x00, 0x0c, 0x00, 0xfd, 0x02, 0x00, 0x23, 0x00, 0x0b, 0x02, 0x02, 0x06, 0x13, 0x00, 0x7a, 0x65,
+                0x6c, 0x69, 0x67, 0x69, 0x62, 0x6c, 0x15, 0x00, 0x02, 0x26, 0x05, 0x04, 0xaa, 0x09, 0x03, 0xc0, 0x0b, 0x0f, 0x22, 0x00,
+                0x09, 0xff, 0x00, 0x72, 0x61, 0x6e, 0x63, 0x68, 0x5f, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x76, 0x69, 0x6e, 0x67, 0x2b, 0x00,
+                0x08, 0x05, 0xc7, 0x0b, 0x01, 0x11, 0x00, 0x0f, 0x29, 0x00, 0x09, 0x3a, 0x72, 0x61, 0x69, 0xbe, 0x00, 0x0a, 0x20, 0x00,
+                0x32, 0x69, 0x6d, 0x63, 0x3c, 0x0a, 0x0f, 0x23, 0x00, 0x07, 0x20, 0x6c, 0x67, 0x1b, 0x01, 0x3f, 0x6f, 0x74, 0x74, 0xdf,
+                0x00, 0x0a, 0x60, 0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x73, 0xe8, 0x07, 0x44, 0x62, 0x6f, 0x61, 0x72, 0x78, 0x01, 0x0f, 0x2a,
+                0x00, 0x01, 0x43, 0x6d, 0x61, 0x74, 0x68, 0xb6, 0x05, 0x0f, 0x57, 0x00, 0x0f, 0x5f, 0x6d, 0x65, 0x6d, 0x62, 0x61, 0x35,
+                0x01, 0x09, 0x00, 0xf2, 0x05, 0x0f, 0x48, 0x00, 0x11, 0x3f, 0x69, 0x73, 0x63, 0x1f, 0x00, 0x08, 0x21, 0x6e, 0x6f, 0xf8,
+                0x01, 0x31, 0x72, 0x75, 0x63, 0x3c, 0x0d, 0x0f, 0x29, 0x00, 0x09, 0x52, 0x74, 0x5f, 0x73, 0x65, 0x6c, 0x13, 0x09, 0x0f,
+                0x27, 0x00, 0x07, 0x0f, 0x23, 0x00, 0x11, 0x4f, 0x68, 0x6f, 0x72, 0x74, 0x32, 0x01, 0x13, 0x5f, 0x73, 0x6c, 0x65, 0x65,
+                0x70, 0x11, 0x02, 0x0b, 0x00, 0xd5, 0x0b, 0x0f, 0x07, 0x01, 0x10, 0x49, 0x77, 0x61, 0x69, 0x74, 0x1f, 0x00, 0x06, 0xbd,
+                0x04, 0x1e, 0x79, 0x00, 0x0c, 0x17, 0x74, 0x6a, 0x0e, 0x0a, 0x7d, 0x09, 0x13, 0x33, 0x1d, 0x00, 0x02, 0x5c, 0x0c, 0x06,
+                0x9e, 0x0d, 0x02, 0x1f, 0x0d, 0x54, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x23, 0x0c, 0x70, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63,
+                0x61, 0x0d, 0x01, 0x0f, 0x33, 0x00, 0x08, 0x3f, 0x69, 0x73, 0x62, 0x30, 0x00, 0x1a, 0x10, 0x74, 0x6a, 0x0f, 0x0f, 0x30,
+                0x00, 0x02, 0x50, 0x70, 0x65, 0x32, 0x73, 0x6d, 0x1f, 0x06, 0x01, 0x23, 0x00, 0x03, 0x1d, 0x00, 0x2c, 0x69, 0x6f, 0x3a,
+                0x0d, 0x08, 0x2d, 0x00, 0x32, 0x76, 0x74, 0x67, 0x81, 0x00, 0x0f, 0x2e, 0x00, 0x0c, 0xa0, 0x73, 0x6d, 0x5f, 0x72, 0x66,
+                0x5f, 0x72, 0x65, 0x67, 0x69, 0x33, 0x0b, 0x0d, 0x7a, 0x00, 0x0f, 0x1f, 0x00, 0x06, 0x07, 0x42, 0x05, 0x0f, 0x29, 0x00,
+                0x13, 0x1f, 0x70, 0x29, 0x00, 0x15, 0x32, 0x76, 0x74, 0x67, 0x2a, 0x00, 0x00, 0xce, 0x01, 0x03, 0xcd, 0x01, 0x0c, 0x23,
+                0x0e, 0x05, 0x7d, 0x00, 0x00, 0x3e, 0x09, 0x10, 0x73, 0xdb, 0x00, 0x27, 0x74, 0x61, 0xea, 0x00, 0x0f, 0x40, 0x00, 0x1f,
+                0x04, 0x90, 0x00, 0x0f, 0x45, 0x00, 0x2a, 0x20, 0x73, 0x68, 0xd3, 0x01, 0x0f, 0x42, 0x00, 0x29, 0x01, 0x2c, 0x00, 0x0f,
+                0x41, 0x00, 0x1f, 0x13, 0x67, 0x5c, 0x01, 0x0f, 0x2a, 0x00, 0x0f, 0x04, 0x86, 0x01, 0x0f, 0x2a, 0x00, 0x11, 0x04, 0x95,
+                0x00, 0x32, 0x6f, 0x6f, 0x6f, 0x30, 0x00, 0x00, 0x04, 0x03, 0x2f, 0x6c, 0x65, 0x99, 0x00, 0x19, 0x06, 0x45, 0x00, 0x0f,
+                0x61, 0x01, 0x28, 0x06, 0x45, 0x00, 0x0f, 0x1f, 0x01, 0x24, 0x00, 0x8c, 0x07, 0x0f, 0x2b, 0x00, 0x15, 0x1f, 0x65, 0x2b,
+                0x00, 0x16, 0x1f, 0x76, 0x2a, 0x00, 0x17, 0x08, 0xd2, 0x02, 0x0f, 0xf4, 0x0d, 0x00, 0x0f, 0x1c, 0x00, 0x06, 0x08, 0xae,
+                0x01, 0x0c, 0x1c, 0x00, 0x00, 0x55, 0x00, 0x11, 0x76, 0xcd, 0x04, 0x39, 0x6c, 0x69, 0x70, 0xaf, 0x10, 0x0f, 0x16, 0x00,
+                0x02, 0x00, 0xf8, 0x0e, 0x00, 0x14, 0x00, 0x37, 0x70, 0x65, 0x64, 0x21, 0x00, 0x09, 0xa4, 0x10, 0x02, 0x17, 0x00, 0x06,
+                0x32, 0x0f, 0x0f, 0x16, 0x00, 0x08, 0x01, 0x4e, 0x00, 0x11, 0x75, 0x46, 0x04, 0x0f, 0x20, 0x00, 0x06, 0x30, 0x70, 0x61,
+                0x73, 0x71, 0x05, 0x01, 0x20, 0x00, 0x0d, 0x51, 0x00, 0x09, 0x36, 0x11, 0x08, 0x12, 0x00, 0x02, 0x24, 0x00, 0x08, 0x9d,
+                0x13, 0x00, 0xae, 0x13, 0x45, 0x5f, 0x72, 0x61, 0x74, 0x35, 0x12, 0x80, 0x61, 0x76, 0x65, 0x72, 0x61, 0x67, 0x65, 0x5f,
+                0xb6, 0x06, 0x46, 0x63, 0x74, 0x6f, 0x72, 0x56, 0x0d, 0x0f, 0x21, 0x00, 0x0d, 0x08, 0x00, 0x14, 0x0f, 0x2c, 0x00, 0x0e,
+                0x00, 0xcc, 0x03, 0x61, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5c, 0x10, 0x3f, 0x74, 0x6f, 0x6d, 0x34, 0x00, 0x21, 0x0f,
+                0x73, 0x00, 0x28, 0x15, 0x6c, 0x19, 0x14, 0x0f, 0x32, 0x00, 0x17, 0x0f, 0x6f, 0x00, 0x28, 0x07, 0x89, 0x14, 0x0f, 0x33,
+                0x00, 0x18, 0x0f, 0x71, 0x00, 0x28, 0x1f, 0x73, 0x32, 0x00, 0x20, 0x0f, 0x6f, 0x00, 0x1e, 0x00, 0x2c, 0x04, 0x0f, 0x4e,
+                0x01, 0x1a, 0x07, 0x31, 0x00, 0x0f, 0x6d, 0x00, 0x27, 0x0f, 0xdb, 0x00, 0x15, 0x07, 0x31, 0x00, 0x0f, 0x6d, 0x00, 0x16,
+                0x00, 0x18, 0x10, 0x0f, 0x21, 0x00, 0x0d, 0x10, 0x5f, 0xf1, 0x10, 0x7f, 0x61, 0x74, 0x5f, 0x31, 0x64, 0x5f, 0x32, 0xf8,
+                0x00, 0x0c, 0x0c, 0x2e, 0x00, 0x0f, 0x88, 0x00, 0x19, 0x07, 0x39, 0x00, 0x6f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x32,
+                0x00, 0x1f, 0x0f, 0x6f, 0x00, 0x21, 0x10, 0x32, 0xb4, 0x0a, 0x6f, 0x6d, 0x69, 0x70, 0x6d, 0x61, 0x70, 0x34, 0x00, 0x21,
+                0x0f, 0x73, 0x00, 0x21, 0x1f, 0x33, 0x46, 0x01, 0x17, 0x1f, 0x33, 0x43, 0x01, 0x22, 0x4f, 0x63, 0x75, 0x62, 0x65, 0xd0,
+                0x00, 0x19, 0x03, 0x30, 0x00, 0x0f, 0x6b, 0x00, 0x1a, 0x0f, 0x2c, 0x00, 0x19, 0x0f, 0x27, 0x18, 0x00, 0x0f, 0x2d, 0x00,
+                0x12, 0x0f, 0x65, 0x00, 0x25, 0x0f, 0x64, 0x05, 0x13, 0x0f, 0x35, 0x00, 0x04, 0x0f, 0x75, 0x00, 0x29, 0x0f, 0x18, 0x04,
+                0x0d, 0x0f, 0x33, 0x00, 0x02, 0x0f, 0x71, 0x00, 0x29, 0x0f, 0x68, 0x05, 0x0e, 0x0f, 0x34, 0x00, 0x03, 0x0f, 0x73, 0x00,
+                0x29, 0x0f, 0x8f, 0x04, 0x0d, 0x0f, 0x33, 0x00, 0x02, 0x0f, 0x71, 0x00, 0x1e, 0x0b, 0x2a, 0x1a, 0x0f, 0x2d, 0x00, 0x12,
+                0x0f, 0x65, 0x00, 0x25, 0x0f, 0xba, 0x01, 0x19, 0x09, 0x33, 0x00, 0x0f, 0x71, 0x00, 0x29, 0x0f, 0x7a, 0x05, 0x12, 0x0e,
+                0x34, 0x00, 0x0f, 0x73, 0x00, 0x00, 0x05, 0x37, 0x00, 0x06, 0xdc, 0x08, 0x00, 0xac, 0x1a, 0x0d, 0x56, 0x00, 0x41, 0x61,
+                0x70, 0x65, 0x72, 0x4a, 0x00, 0x40, 0x64, 0x65, 0x76, 0x69, 0x8a, 0x03, 0x0f, 0x26, 0x00, 0x11, 0x09, 0x70, 0x00, 0x0f,
+                0x31, 0x00, 0x12, 0x05, 0x7c, 0x03, 0x0f, 0x2e, 0x00, 0x19, 0x0f, 0x67, 0x00, 0x22, 0x00, 0x8f, 0x12, 0x0f, 0x2e, 0x00,
+                0x1b, 0x0f, 0x67, 0x00, 0x24, 0x0f, 0x66, 0x00, 0x1a, 0x0f, 0x65, 0x00, 0x23, 0x01, 0x92, 0x17, 0x0f, 0x2f, 0x00, 0x1c,
+                0x0f, 0x69, 0x00, 0x18, 0x20, 0x70, 0x65, 0x50, 0x07, 0x0f, 0x24, 0x00, 0x0f, 0x0f, 0x53, 0x00, 0x1c, 0x0f, 0xed, 0x01,
+                0x15, 0x08, 0x2c, 0x00, 0x0f, 0x63, 0x00, 0x20, 0x0f, 0xe9, 0x01, 0x11, 0x08, 0x2c, 0x00, 0x0f, 0x63, 0x00, 0x22, 0x0f,
+                0x62, 0x00, 0x18, 0x0f, 0x61, 0x00, 0x21, 0x0f, 0xe1, 0x01, 0x12, 0x09, 0x2d, 0x00, 0x0f, 0x65, 0x00, 0x18, 0x5f, 0x73,
+                0x79, 0x73, 0x6d, 0x65, 0x86, 0x01, 0x0e, 0x02, 0x26, 0x00, 0x0f, 0x57, 0x00, 0x1e, 0x0f, 0xe5, 0x01, 0x15, 0x0a, 0x2e,
+                0x00, 0x0f, 0x67, 0x00, 0x22, 0x0f, 0xe9, 0x01, 0x11, 0x0a, 0x2e, 0x00, 0x0f, 0x67, 0x00, 0x24, 0x0f, 0x66, 0x00, 0x1a,
+                0x0f, 0x65, 0x00, 0x23, 0x0f, 0xf1, 0x01, 0x12, 0x0b, 0x2f, 0x00, 0x0f, 0x69, 0x00, 0x0f, 0x0f, 0x8c, 0x01, 0x0b, 0x0f,
+                0x7c, 0x01, 0x16, 0x0f, 0x6c, 0x01, 0x0b, 0x0f, 0x5c, 0x01, 0x16, 0x0f, 0x4c, 0x01, 0x0a, 0x0f, 0x3c, 0x01, 0x15, 0x0f,
+                0x2c, 0x01, 0x0c, 0x0f, 0x1c, 0x01, 0x17, 0xbf, 0x73, 0x72, 0x63, 0x6e, 0x6f, 0x64, 0x65, 0x5f, 0x66, 0x62, 0x70, 0x22,
+                0x00, 0x0f, 0x0f, 0x0f, 0x07, 0x14, 0x0f, 0x32, 0x00, 0x08, 0x0f, 0x91, 0x00, 0x1a, 0x0f, 0xc0, 0x06, 0x1c, 0x0f, 0x3a,
+                0x00, 0x10, 0x0f, 0x7f, 0x00, 0x2e, 0x0f, 0x75, 0x01, 0x09, 0x0f, 0x3b, 0x00, 0x11, 0x0f, 0x81, 0x00, 0x24, 0x0f, 0x8b,
+                0x06, 0x08, 0x0f, 0x30, 0x00, 0x06, 0x0f, 0x6b, 0x00, 0x28, 0x0f, 0x69, 0x01, 0x21, 0x0f, 0x4c, 0x06, 0x1b, 0x0f, 0x43,
+                0x00, 0x0a, 0x0f, 0x65, 0x01, 0x1e, 0x0f, 0x03, 0x06, 0x1c, 0x0f, 0x44, 0x00, 0x02, 0x0f, 0x0f, 0x06, 0x0a, 0x0f, 0x32,
+                0x00, 0x08, 0x0f, 0x6f, 0x00, 0x2a, 0x0f, 0x69, 0x01, 0x21, 0x0f, 0xcc, 0x05, 0x1d, 0x0f, 0x45, 0x00, 0x0c, 0x0f, 0x6d,
+                0x01, 0x1e, 0x0f, 0x7f, 0x05, 0x1e, 0x08, 0x46, 0x00, 0x0f, 0x2d, 0x00, 0x16, 0x3f, 0x67, 0x70, 0x63, 0x22, 0x00, 0x0f,
+                0x0f, 0x90, 0x04, 0x1c, 0x0f, 0x32, 0x00, 0x00, 0x0f, 0x91, 0x00, 0x1a, 0x0f, 0xb7, 0x0b, 0x1c, 0x0f, 0x3a, 0x00, 0x10,
+                0x0f, 0x7f, 0x00, 0x2e, 0x0f, 0x3d, 0x02, 0x10, 0x0f, 0x3a, 0x00, 0x08, 0x0f, 0x7f, 0x00, 0x30, 0x0f, 0x7e, 0x00, 0x26,
+                0x0f, 0x7d, 0x00, 0x2f, 0x0f, 0xba, 0x02, 0x11, 0x0f, 0x3b, 0x00, 0x09, 0x0f, 0x81, 0x00, 0x24, 0x0f, 0x8c, 0x05, 0x10,
+                0x0d, 0x30, 0x00, 0x0f, 0x6b, 0x00, 0x28, 0x0f, 0x65, 0x02, 0x21, 0x0f, 0x3b, 0x0c, 0x1b, 0x0f, 0x43, 0x00, 0x0a, 0x0f,
+                0x61, 0x02, 0x1d, 0x0f, 0x07, 0x06, 0x23, 0x0f, 0x43, 0x00, 0x04, 0x0f, 0x7a, 0x00, 0x24, 0x0f, 0x79, 0x00, 0x2d, 0x0f,
+                0x59, 0x02, 0x1e, 0x0f, 0x80, 0x06, 0x24, 0x09, 0x44, 0x00, 0x0f, 0x80, 0x06, 0x12, 0x0f, 0x32, 0x00, 0x00, 0x0f, 0x6f,
+                0x00, 0x2a, 0x0f, 0x5d, 0x02, 0x21, 0x0f, 0xb3, 0x0c, 0x1d, 0x0f, 0x45, 0x00, 0x0c, 0x0f, 0x61, 0x02, 0x1d, 0x0f, 0xff,
+                0x06, 0x25, 0x0f, 0x45, 0x00, 0x06, 0x0f, 0x7e, 0x00, 0x26, 0x0f, 0x7d, 0x00, 0x2f, 0x0f, 0x69, 0x02, 0x1e, 0x0f, 0x7c,
+                0x07, 0x26, 0x00, 0x46, 0x00, 0x0f, 0x2d, 0x00, 0x16, 0x3f, 0x68, 0x75, 0x62, 0x5a, 0x07, 0x1c, 0x0f, 0x32, 0x00, 0x00,
+                0x0f, 0x6f, 0x00, 0x2a, 0x0f, 0x19, 0x02, 0x14, 0x0f, 0x3a, 0x00, 0x08, 0x0f, 0x7f, 0x00, 0x2e, 0x0f, 0x9c, 0x01, 0x11,
+                0x0f, 0x3b, 0x00, 0x09, 0x0f, 0x81, 0x00, 0x24, 0x0f, 0x5e, 0x06, 0x10, 0x0d, 0x30, 0x00, 0x0f, 0x6b, 0x00, 0x28, 0x0f,
+                0x69, 0x01, 0x21, 0x0f, 0xe3, 0x05, 0x23, 0x0f, 0x43, 0x00, 0x02, 0x0f, 0x65, 0x01, 0x1e, 0x0f, 0x6a, 0x05, 0x24, 0x09,
+                0x44, 0x00, 0x0f, 0x6a, 0x05, 0x12, 0x0f, 0x32, 0x00, 0x00, 0x0f, 0x6f, 0x00, 0x2a, 0x0f, 0x69, 0x01, 0x21, 0x0f, 0xeb,
+                0x04, 0x25, 0x0f, 0x45, 0x00, 0x04, 0x0f, 0x6d, 0x01, 0x1e, 0x0f, 0x6e, 0x04, 0x21, 0x50, 0x75, 0x6e, 0x69, 0x74, 0x5f,
+                0x78, 0x30, 0x0f, 0x23, 0x00, 0x10, 0x0f, 0x65, 0x04, 0x17, 0x0f, 0x33, 0x00, 0x06, 0x0f, 0x94, 0x00, 0x1b, 0x0f, 0x67,
+                0x04, 0x1f, 0x0f, 0x3b, 0x00, 0x0e, 0x0f, 0x81, 0x00, 0x2f, 0x0f, 0x97, 0x01, 0x0c, 0x0f, 0x3c, 0x00, 0x0f, 0x0f, 0x83,
+                0x00, 0x25, 0x0f, 0x6b, 0x04, 0x0b, 0x0f, 0x31, 0x00, 0x04, 0x0f, 0x6d, 0x00, 0x29, 0x0f, 0x6f, 0x01, 0x22, 0x0f, 0x6e,
+                0x04, 0x1e, 0x0f, 0x44, 0x00, 0x08, 0x0f, 0x6b, 0x01, 0x1f, 0x0f, 0x70, 0x04, 0x1f, 0x0f, 0x45, 0x00, 0x00, 0x0f, 0x71,
+                0x04, 0x0d, 0x0f, 0x33, 0x00, 0x06, 0x0f, 0x71, 0x00, 0x2b, 0x0f, 0x6f, 0x01, 0x22, 0x0f, 0x74, 0x04, 0x20, 0x0f, 0x46,
+                0x00, 0x0a, 0x0f, 0x73, 0x01, 0x1f, 0x0f, 0x76, 0x04, 0x2a, 0x0f, 0x2e, 0x00, 0x17, 0x2f, 0x67, 0x63, 0x61, 0x10, 0x08,
+                0x04, 0x22, 0x00, 0x0f, 0xa2, 0x04, 0x1c, 0x0f, 0x32, 0x00, 0x00, 0x0f, 0x91, 0x00, 0x1a, 0x0f, 0x9c, 0x03, 0x1a, 0x0d,
+                0x30, 0x00, 0x0f, 0x6b, 0x00, 0x24, 0x0f, 0x9e, 0x02, 0x12, 0x0f, 0x32, 0x00, 0x00, 0x0f, 0x6f, 0x00, 0x1b, 0x0f, 0x2d,
+                0x00, 0x16, 0x1f, 0x70, 0x65, 0x01, 0x0d, 0x00, 0x43, 0x33, 0x0f, 0x96, 0x01, 0x1a, 0x0e, 0x31, 0x00, 0x0f, 0x8e, 0x00,
+                0x19, 0x0f, 0x34, 0x06, 0x24, 0x0f, 0x39, 0x00, 0x07, 0x0f, 0x7d, 0x00, 0x2d, 0x0f, 0x52, 0x03, 0x11, 0x0f, 0x3a, 0x00,
+                0x08, 0x0f, 0x7f, 0x00, 0x23, 0x0f, 0x90, 0x02, 0x10, 0x0c, 0x2f, 0x00, 0x0f, 0x69, 0x00, 0x27, 0x0f, 0x63, 0x01, 0x20,
+                0x0f, 0x26, 0x06, 0x23, 0x0f, 0x42, 0x00, 0x01, 0x0f, 0x5f, 0x01, 0x1d, 0x0f, 0x22, 0x06, 0x24, 0x08, 0x43, 0x00, 0x0f,
+                0x82, 0x03, 0x12, 0x0e, 0x31, 0x00, 0x0f, 0x6d, 0x00, 0x29, 0x0f, 0x63, 0x01, 0x20, 0x0f, 0x1a, 0x06, 0x25, 0x0f, 0x44,
+                0x00, 0x03, 0x0f, 0x67, 0x01, 0x1d, 0x0f, 0x16, 0x06, 0x26, 0x00, 0xed, 0x27, 0x0f, 0x2c, 0x00, 0x15, 0x02, 0xb7, 0x3a,
+                0x0f, 0x25, 0x00, 0x12, 0x0f, 0x84, 0x04, 0x1c, 0x0f, 0x35, 0x00, 0x03, 0x0f, 0x9a, 0x00, 0x1d, 0x0f, 0x8c, 0x04, 0x24,
+                0x0f, 0x3d, 0x00, 0x0b, 0x0f, 0x85, 0x00, 0x31, 0x0f, 0xce, 0x01, 0x11, 0x0f, 0x3e, 0x00, 0x0c, 0x0f, 0x87, 0x00, 0x27,
+                0x0f, 0x9c, 0x04, 0x10, 0x0f, 0x33, 0x00, 0x01, 0x0f, 0x71, 0x00, 0x2b, 0x0f, 0x7b, 0x01, 0x24, 0x0f, 0xa8, 0x04, 0x23,
+                0x0f, 0x46, 0x00, 0x05, 0x0f, 0x77, 0x01, 0x21, 0x0f, 0xb0, 0x04, 0x24, 0x0c, 0x47, 0x00, 0x0f, 0xb4, 0x04, 0x12, 0x0f,
+                0x35, 0x00, 0x03, 0x0f, 0x75, 0x00, 0x2d, 0x0f, 0x7b, 0x01, 0x24, 0x0f, 0xc0, 0x04, 0x25, 0x0f, 0x48, 0x00, 0x07, 0x0f,
+                0x7f, 0x01, 0x21, 0x0f, 0xc8, 0x04, 0x26, 0x03, 0x49, 0x00, 0x0f, 0x30, 0x00, 0x16, 0x01, 0x2c, 0x27, 0x0f, 0x22, 0x00,
+                0x0d, 0x0f, 0xc6, 0x04, 0x1c, 0x0f, 0x32, 0x00, 0x00, 0x0f, 0x91, 0x00, 0x1a, 0x0f, 0x41, 0x1b, 0x1f, 0x0f, 0x3a, 0x00,
+                0x0d, 0x0f, 0x7f, 0x00, 0x2e, 0x0f, 0x49, 0x02, 0x10, 0x0f, 0x3a, 0x00, 0x08, 0x0f, 0x7f, 0x00, 0x30, 0x0f, 0x7e, 0x00,
+                0x26, 0x0f, 0x7d, 0x00, 0x2f, 0x0f, 0xc0, 0x02, 0x11, 0x0f, 0x3b, 0x00, 0x09, 0x0f, 0x81, 0x00, 0x24, 0x0f, 0xb0, 0x05,
+                0x10, 0x0d, 0x30, 0x00, 0x0f, 0x6b, 0x00, 0x28, 0x0f, 0x65, 0x02, 0x21, 0x0f, 0x41, 0x1b, 0x1e, 0x0f, 0x43, 0x00, 0x07,
+                0x0f, 0x61, 0x02, 0x1d, 0x0f, 0x22, 0x06, 0x23, 0x0f, 0x43, 0x00, 0x04, 0x0f, 0x7a, 0x00, 0x24, 0x0f, 0x79, 0x00, 0x2d,
+                0x0f, 0x59, 0x02, 0x1e, 0x0f, 0x95, 0x06, 0x24, 0x09, 0x44, 0x00, 0x0f, 0x92, 0x06, 0x12, 0x0f, 0x32, 0x00, 0x00, 0x0f,
+                0x6f, 0x00, 0x2a, 0x0f, 0x5d, 0x02, 0x21, 0x0f, 0x41, 0x1b, 0x20, 0x0f, 0x45, 0x00, 0x09, 0x0f, 0x61, 0x02, 0x1d, 0x0f,
+                0x08, 0x07, 0x25, 0x0f, 0x45, 0x00, 0x06, 0x0f, 0x7e, 0x00, 0x26, 0x0f, 0x7d, 0x00, 0x2f, 0x0f, 0x69, 0x02, 0x1e, 0x0f,
+                0x7f, 0x07, 0x26, 0x0c, 0x47, 0x2e, 0x0f, 0x2d, 0x00, 0x0a, 0x00, 0x58, 0x47, 0x0f, 0x23, 0x00, 0x10, 0x0f, 0x7e, 0x07,
+                0x1c, 0x0f, 0x33, 0x00, 0x01, 0x0f, 0x94, 0x00, 0x1b, 0x0f, 0x01, 0x07, 0x24, 0x0f, 0x3b, 0x00, 0x09, 0x0f, 0x81, 0x00,
+                0x2f, 0x0f, 0xc4, 0x01, 0x11, 0x0f, 0x3c, 0x00, 0x0a, 0x0f, 0x83, 0x00, 0x25, 0x0f, 0x88, 0x06, 0x10, 0x0e, 0x31, 0x00,
+                0x0f, 0x6d, 0x00, 0x29, 0x0f, 0x6f, 0x01, 0x22, 0x0f, 0x10, 0x06, 0x23, 0x0f, 0x44, 0x00, 0x03, 0x0f, 0x6b, 0x01, 0x1f,
+                0x0f, 0x99, 0x05, 0x24, 0x0a, 0x45, 0x00, 0x0f, 0x9a, 0x05, 0x12, 0x0f, 0x33, 0x00, 0x01, 0x0f, 0x71, 0x00, 0x2b, 0x0f,
+                0x6f, 0x01, 0x22, 0x0f, 0x1e, 0x05, 0x25, 0x0f, 0x46, 0x00, 0x05, 0x0f, 0x73, 0x01, 0x1f, 0x0f, 0xa3, 0x04, 0x26, 0x01,
+                0x47, 0x00, 0x0c, 0x2e, 0x00, 0x0e, 0xe9, 0x32, 0x02, 0xaa, 0x41, 0x71, 0x61, 0x6d, 0x6f, 0x72, 0x74, 0x69, 0x7a, 0xbf,
+                0x41, 0x01, 0x3f, 0x3d, 0x61, 0x74, 0x65, 0x6e, 0x63, 0x79, 0x00, 0x44, 0x17, 0x01, 0xf5, 0x41, 0x72, 0x75, 0x67, 0x68,
+                0x70, 0x75, 0x74, 0x00, 0x7e, 0x50, 0x01, 0x0c, 0x01, 0x0d, 0x16, 0x00, 0x0d, 0x11, 0x00, 0x02, 0xb1, 0x00, 0x07, 0x17,
+                0x00, 0x03, 0x6e, 0x33, 0x12, 0x6d, 0x71, 0x41, 0x5f, 0x32, 0x78, 0x62, 0x61, 0x72, 0x1f, 0x00, 0x17, 0x0d, 0x57, 0x3c,
+                0x0f, 0x28, 0x00, 0x0a, 0x07, 0x1c, 0x34, 0x20, 0x6d, 0x5f, 0x22, 0x00, 0x12, 0x32, 0x0e, 0x00, 0x0f, 0x6f, 0x00, 0x01,
+                0x0f, 0x1f, 0x00, 0x02, 0x0f, 0x6f, 0x00, 0x00, 0x0f, 0x28, 0x00, 0x08, 0x07, 0x6f, 0x00, 0x08, 0x62, 0x00, 0x01, 0x73,
+                0x01, 0x06, 0x10, 0x00, 0x02, 0xdc, 0x4e, 0x08, 0x11, 0x00, 0x00, 0xca, 0x4e, 0x08, 0x10, 0x00, 0x00, 0x97, 0x4e, 0x08,
+                0x10, 0x00, 0x0c, 0x80, 0x01, 0x04, 0x4a, 0x4d, 0x08, 0x13, 0x00, 0x03, 0xfa, 0x4c, 0x07, 0x13, 0x00, 0x03, 0x69, 0x48,
+                0x04, 0x0f, 0x00, 0x39, 0x76, 0x61, 0x66, 0x10, 0x00, 0x01, 0x1a, 0x02, 0x08, 0x11, 0x00, 0xf6, 0x11, 0x0a, 0x3c, 0x68,
+                0x74, 0x6d, 0x6c, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74,
+                0x3d, 0x22, 0x75, 0x74, 0x66, 0x2d, 0x38, 0x22, 0x2f, 0x1a, 0x00, 0xf2, 0x10, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x76,
+                0x69, 0x65, 0x77, 0x70, 0x6f, 0x72, 0x74, 0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x77, 0x69,
+                0x64, 0x74, 0x68, 0x3d, 0x8b, 0x05, 0x11, 0x2d, 0x0d, 0x00, 0xf0, 0x02, 0x2c, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61,
+                0x6c, 0x2d, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x3d, 0x31, 0x48, 0x00, 0x00, 0x49, 0x00, 0x40, 0x68, 0x65, 0x61, 0x64, 0x52,
+                0x00, 0xf2, 0x07, 0x20, 0x20, 0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x4d, 0x79, 0x52, 0x61, 0x6e, 0x67, 0x65, 0x4e,
+                0x61, 0x6d, 0x65, 0x3c, 0x2f, 0x13, 0x00, 0x00, 0x29, 0x00, 0xf0, 0x00, 0x20, 0x20, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65,
+                0x20, 0x69, 0x64, 0x3d, 0x22, 0x52, 0x65, 0x71, 0x00, 0x10, 0x53, 0x10, 0x00, 0x13, 0x22, 0x1e, 0x00, 0x93, 0x20, 0x20,
+                0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x7b, 0x0e, 0x00, 0xf5, 0x03, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69,
+                0x7a, 0x65, 0x3a, 0x20, 0x31, 0x34, 0x70, 0x78, 0x3b, 0x19, 0x00, 0xe6, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20,
+                0x32, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x18, 0x00, 0xa1, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x63, 0x6f, 0x6c, 0x8f,
+                0x44, 0x24, 0x3a, 0x20, 0x0a, 0x00, 0x0c, 0x23, 0x00, 0xc4, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69,
+                0x64, 0x20, 0x1c, 0x00, 0x1a, 0x7d, 0x87, 0x00, 0x27, 0x74, 0x68, 0x8a, 0x00, 0x04, 0x71, 0x00, 0x1f, 0x30, 0x71, 0x00,
+                0x39, 0x20, 0x20, 0x20, 0xf8, 0x4c, 0xb0, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x23, 0x46, 0x38, 0x02, 0x00,
+                0x0f, 0x8e, 0x00, 0x05, 0x1f, 0x64, 0x8e, 0x00, 0x4d, 0x0c, 0x71, 0x00, 0x7f, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x74, 0x72,
+                0x7a, 0x00, 0x59, 0x11, 0x2e, 0x7b, 0x00, 0x00, 0x94, 0x02, 0x07, 0x73, 0x00, 0xff, 0x01, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+                0x3a, 0x20, 0x44, 0x61, 0x72, 0x6b, 0x47, 0x72, 0x65, 0x65, 0x6e, 0x75, 0x00, 0x01, 0x00, 0x21, 0x00, 0x5f, 0x42, 0x6c,
+                0x61, 0x63, 0x6b, 0x5b, 0x01, 0x12, 0x03, 0x59, 0x02, 0xce, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x62, 0x6f,
+                0x6c, 0x64, 0x8b, 0x00, 0x67, 0x73, 0x75, 0x62, 0x68, 0x64, 0x72, 0x88, 0x00, 0x0f, 0xac, 0x01, 0x11, 0x37, 0x2e, 0x63,
+                0x61, 0x32, 0x00, 0x00, 0xa7, 0x38, 0xee, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65,
+                0x72, 0x31, 0x00, 0x1f, 0x6c, 0x31, 0x00, 0x05, 0x4e, 0x6c, 0x65, 0x66, 0x74, 0x2f, 0x00, 0x1f, 0x72, 0x2f, 0x00, 0x05,
+                0x10, 0x72, 0xcc, 0x00, 0x0e, 0x30, 0x00, 0x27, 0x77, 0x77, 0x30, 0x00, 0xf0, 0x02, 0x77, 0x6f, 0x72, 0x64, 0x2d, 0x77,
+                0x72, 0x61, 0x70, 0x3a, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x2d, 0x11, 0x00, 0x0e, 0x34, 0x00, 0x10, 0x66, 0x6d, 0x42,
+                0x0b, 0x85, 0x01, 0x32, 0x6d, 0x69, 0x6e, 0x06, 0x04, 0x58, 0x3a, 0x20, 0x31, 0x35, 0x30, 0x8b, 0x03, 0x03, 0x16, 0x00,
+                0x48, 0x33, 0x33, 0x76, 0x77, 0xa0, 0x03, 0x14, 0x78, 0x2f, 0x00, 0xfe, 0x03, 0x63, 0x61, 0x6c, 0x63, 0x28, 0x39, 0x32,
+                0x76, 0x77, 0x20, 0x2d, 0x20, 0x39, 0x32, 0x30, 0x70, 0x78, 0x29, 0x72, 0x00, 0x3f, 0x62, 0x61, 0x73, 0xf7, 0x03, 0x04,
+                0x18, 0x38, 0x6b, 0x00, 0x03, 0xe9, 0x01, 0x30, 0x23, 0x36, 0x30, 0x02, 0x00, 0x0f, 0x08, 0x02, 0x12, 0x07, 0x9a, 0x01,
+                0x3f, 0x6f, 0x6d, 0x70, 0x64, 0x00, 0x17, 0x8d, 0x73, 0x74, 0x65, 0x65, 0x6c, 0x62, 0x6c, 0x75, 0xc0, 0x02, 0x0f, 0x66,
+                0x00, 0x0c, 0x00, 0xec, 0x49, 0x6b, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0xcb, 0x04, 0x04, 0xbc, 0x00, 0x11, 0x43, 0x01,
+                0x00, 0x0f, 0x39, 0x00, 0x04, 0x4f, 0x76, 0x61, 0x69, 0x6c, 0x38, 0x00, 0x04, 0x11, 0x38, 0x01, 0x00, 0x0f, 0x32, 0x03,
+                0x00, 0x00, 0x5f, 0x05, 0x38, 0x61, 0x72, 0x65, 0x18, 0x02, 0x00, 0xea, 0x4b, 0x87, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x66,
+                0x6c, 0x65, 0xdb, 0x00, 0x01, 0x2a, 0x02, 0x6c, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x90, 0x02, 0x05, 0x68, 0x00, 0x47,
+                0x77, 0x68, 0x69, 0x74, 0xf4, 0x00, 0x01, 0x26, 0x01, 0xff, 0x00, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x20, 0x76,
+                0x65, 0x72, 0x64, 0x61, 0x6e, 0x61, 0x84, 0x00, 0x04, 0x28, 0x62, 0x61, 0x2d, 0x03, 0x02, 0x28, 0x04, 0x10, 0x2d, 0xc5,
+                0x02, 0x27, 0x3a, 0x20, 0xab, 0x01, 0x03, 0x18, 0x00, 0x01, 0xae, 0x02, 0x19, 0x3a, 0x44, 0x04, 0x06, 0x4f, 0x00, 0x03,
+                0x90, 0x42, 0x8f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x56, 0x00, 0x05, 0x0a, 0x81, 0x04, 0x0a, 0x59, 0x00,
+                0x05, 0x72, 0x00, 0x0b, 0xa5, 0x00, 0x0f, 0x01, 0x02, 0x03, 0x19, 0x32, 0x02, 0x02, 0x09, 0x65, 0x00, 0x17, 0x31, 0xec,
+                0x02, 0x07, 0x1c, 0x04, 0x11, 0x65, 0xf4, 0x4b, 0x08, 0x1d, 0x04, 0x02, 0x1d, 0x02, 0x60, 0x72, 0x61, 0x64, 0x69, 0x75,
+                0x73, 0x24, 0x03, 0x08, 0x52, 0x00, 0x7a, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x4e, 0x00, 0x0c, 0x51, 0x04, 0x01,
+                0x01, 0x00, 0x0e, 0xe2, 0x06, 0x0a, 0x33, 0x00, 0x07, 0x87, 0x03, 0x01, 0x58, 0x03, 0x88, 0x31, 0x30, 0x30, 0x25, 0x20,
+                0x2d, 0x20, 0x34, 0x57, 0x03, 0x05, 0x93, 0x03, 0x00, 0x85, 0x03, 0x03, 0xd0, 0x07, 0x0f, 0xc3, 0x00, 0x06, 0x1f, 0x5f,
+                0x17, 0x01, 0x02, 0x0f, 0xf2, 0x01, 0x04, 0x0f, 0x38, 0x05, 0x08, 0x05, 0x41, 0x02, 0x1f, 0x62, 0x18, 0x03, 0x03, 0x79,
+                0x77, 0x6f, 0x72, 0x6b, 0x66, 0x6c, 0x6f, 0x8e, 0x04, 0x02, 0xa6, 0x00, 0x2a, 0x39, 0x36, 0xe2, 0x00, 0x06, 0x3a, 0x04,
+                0x26, 0x39, 0x30, 0x53, 0x04, 0x06, 0x4a, 0x00, 0x51, 0x64, 0x65, 0x62, 0x75, 0x67, 0xf6, 0x0a, 0x0f, 0x82, 0x01, 0x3c,
+                0x11, 0x44, 0x01, 0x00, 0x0f, 0x82, 0x01, 0x56, 0x68, 0x23, 0x66, 0x6f, 0x6f, 0x74, 0x65, 0x34, 0x03, 0x40, 0x70, 0x6f,
+                0x73, 0x69, 0xd5, 0x00, 0x67, 0x3a, 0x20, 0x66, 0x69, 0x78, 0x65, 0x5b, 0x01, 0x0d, 0x46, 0x03, 0x69, 0x62, 0x6f, 0x74,
+                0x74, 0x6f, 0x6d, 0x13, 0x00, 0x04, 0x9d, 0x05, 0x3f, 0x30, 0x30, 0x25, 0xe0, 0x00, 0x03, 0xa6, 0x72, 0x67, 0x62, 0x61,
+                0x28, 0x32, 0x32, 0x35, 0x2c, 0x20, 0x05, 0x00, 0x37, 0x30, 0x2e, 0x35, 0xb5, 0x00, 0x03, 0xc2, 0x01, 0x58, 0x64, 0x61,
+                0x72, 0x6b, 0x72, 0x7f, 0x00, 0x0f, 0xc7, 0x06, 0x07, 0x33, 0x20, 0x20, 0x68, 0x0c, 0x02, 0x00, 0xd9, 0x05, 0x07, 0xb1,
+                0x00, 0x4f, 0x69, 0x6e, 0x65, 0x2d, 0x1b, 0x00, 0x03, 0x09, 0x42, 0x02, 0x2c, 0x37, 0x30, 0xa9, 0x03, 0x21, 0x3c, 0x2f,
+                0x23, 0x0a, 0x24, 0x3e, 0x0a, 0x31, 0x0a, 0x60, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x3c, 0x59, 0x20, 0x3d, 0x22, 0x89,
+                0x00, 0x61, 0x2f, 0x4a, 0x61, 0x76, 0x61, 0x53, 0x16, 0x00, 0x06, 0x38, 0x0a, 0xaf, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x20,
+                0x4e, 0x6f, 0x74, 0x41, 0x7b, 0x05, 0x01, 0x97, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x4f, 0x66, 0x28, 0x29, 0x14, 0x00, 0xf8,
+                0x01, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0xf0, 0x00, 0x16,
+                0x7d, 0xfa, 0x00, 0x7f, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3b, 0x00, 0x03, 0x19, 0x27, 0x71, 0x00, 0x1e, 0x27,
+                0x41, 0x00, 0x04, 0x08, 0x00, 0x06, 0x9f, 0x00, 0x0f, 0xe1, 0x05, 0x00, 0x0f, 0x9e, 0x00, 0x4a, 0x04, 0x70, 0x00, 0x0f,
+                0x9d, 0x00, 0x02, 0x03, 0x09, 0x00, 0x32, 0x66, 0x75, 0x6e, 0x4c, 0x03, 0x00, 0x1f, 0x5a, 0x10, 0x54, 0x54, 0x00, 0xf8,
+                0x03, 0x28, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x73, 0x53, 0x69, 0x6e, 0x63, 0x65, 0x45, 0x70, 0x6f, 0x63, 0x68, 0x62,
+                0x00, 0xfe, 0x04, 0x76, 0x61, 0x72, 0x20, 0x64, 0x61, 0x74, 0x65, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x44, 0x61,
+                0x74, 0x65, 0x31, 0x00, 0x20, 0x20, 0x2a, 0x8b, 0x02, 0x60, 0x30, 0x29, 0x3b, 0x20, 0x2f, 0x2f, 0x55, 0x0c, 0x00, 0x8d,
+                0x5b, 0x93, 0x20, 0x74, 0x6f, 0x20, 0x6d, 0x69, 0x6c, 0x6c, 0x69, 0x2e, 0x00, 0x09, 0x52, 0x00, 0x61, 0x79, 0x65, 0x61,
+                0x72, 0x20, 0x3d, 0x59, 0x00, 0xd7, 0x2e, 0x67, 0x65, 0x74, 0x46, 0x75, 0x6c, 0x6c, 0x59, 0x65, 0x61, 0x72, 0x28, 0xa0,
+                0x02, 0x00, 0x27, 0x00, 0xf0, 0x06, 0x4d, 0x6f, 0x6e, 0x74, 0x68, 0x73, 0x20, 0x3d, 0x20, 0x5b, 0x27, 0x4a, 0x61, 0x6e,
+                0x27, 0x2c, 0x20, 0x27, 0x46, 0x65, 0x62, 0x07, 0x00, 0x30, 0x4d, 0x61, 0x72, 0x07, 0x00, 0x21, 0x41, 0x70, 0x07, 0x00,
+                0x30, 0x4d, 0x61, 0x79, 0x07, 0x00, 0x21, 0x4a, 0x75, 0x23, 0x00, 0x31, 0x4a, 0x75, 0x6c, 0x1c, 0x00, 0x20, 0x75, 0x67,
+                0x07, 0x00, 0x30, 0x53, 0x65, 0x70, 0x07, 0x00, 0x30, 0x4f, 0x63, 0x74, 0x07, 0x00, 0x30, 0x4e, 0x6f, 0x76, 0x07, 0x00,
+                0x5a, 0x44, 0x65, 0x63, 0x27, 0x5d, 0x6b, 0x00, 0x10, 0x6d, 0x6b, 0x00, 0x23, 0x20, 0x3d, 0x73, 0x00, 0x14, 0x5b, 0x9a,
+                0x00, 0x01, 0x0f, 0x00, 0x2b, 0x28, 0x29, 0x2d, 0x00, 0x37, 0x64, 0x61, 0x79, 0xbe, 0x00, 0x01, 0x14, 0x01, 0x0b, 0xba,
+                0x00, 0x40, 0x68, 0x6f, 0x75, 0x72, 0xb9, 0x00, 0x04, 0x24, 0x00, 0x10, 0x48, 0x10, 0x00, 0x0c, 0x25, 0x00, 0x60, 0x6d,
+                0x69, 0x6e, 0x75, 0x74, 0x65, 0x27, 0x00, 0x55, 0x22, 0x30, 0x22, 0x20, 0x2b, 0x2d, 0x00, 0x12, 0x4d, 0x18, 0x00, 0x0c,
+                0x2f, 0x00, 0x03, 0x49, 0x01, 0x0d, 0x2f, 0x00, 0x12, 0x53, 0x18, 0x00, 0x0c, 0x2f, 0x00, 0x02, 0xdb, 0x46, 0x60, 0x74,
+                0x65, 0x64, 0x54, 0x69, 0x6d, 0xbf, 0x01, 0x02, 0xe2, 0x00, 0x51, 0x2b, 0x20, 0x27, 0x20, 0x27, 0x3d, 0x00, 0x10, 0x79,
+                0x0c, 0x00, 0x11, 0x2c, 0x0d, 0x00, 0x01, 0x8f, 0x01, 0x04, 0x1a, 0x00, 0x02, 0xbb, 0x00, 0x40, 0x2b, 0x20, 0x27, 0x3a,
+                0x0e, 0x00, 0x03, 0xa4, 0x00, 0x00, 0x21, 0x0b, 0x75, 0x73, 0x74, 0x72, 0x28, 0x2d, 0x32, 0x29, 0x1b, 0x00, 0x03, 0x90,
+                0x00, 0x07, 0x1b, 0x00, 0x06, 0x81, 0x00, 0x03, 0x97, 0x02, 0x09, 0x84, 0x00, 0x0d, 0x15, 0x05, 0x05, 0x8c, 0x02, 0xb1,
+                0x65, 0x73, 0x63, 0x61, 0x70, 0x65, 0x48, 0x74, 0x6d, 0x6c, 0x28, 0xdc, 0x4c, 0x08, 0x81, 0x02, 0x40, 0x69, 0x66, 0x20,
+                0x28, 0x11, 0x04, 0x31, 0x6f, 0x66, 0x20, 0x1c, 0x00, 0x61, 0x20, 0x3d, 0x3d, 0x20, 0x27, 0x73, 0x0b, 0x03, 0x43, 0x27,
+                0x20, 0x7c, 0x7c, 0x15, 0x00, 0x00, 0x9c, 0x53, 0x30, 0x61, 0x6e, 0x63, 0x26, 0x00, 0x02, 0x27, 0x03, 0x0f, 0x26, 0x03,
+                0x02, 0x01, 0x2c, 0x00, 0x07, 0x17, 0x00, 0x00, 0x63, 0x0b, 0xf0, 0x06, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x28, 0x2f,
+                0x26, 0x2f, 0x67, 0x2c, 0x20, 0x22, 0x26, 0x61, 0x6d, 0x70, 0x3b, 0x22, 0x29, 0xc8, 0x02, 0xcf, 0x6d, 0x61, 0x6b, 0x65,
+                0x20, 0x69, 0x74, 0x20, 0x66, 0x69, 0x72, 0x73, 0x35, 0x00, 0x05, 0x12, 0x20, 0x35, 0x00, 0x30, 0x6e, 0x62, 0x73, 0x36,
+                0x00, 0x0f, 0x25, 0x00, 0x04, 0x12, 0x3c, 0x25, 0x00, 0x2f, 0x6c, 0x74, 0x23, 0x00, 0x07, 0x12, 0x3e, 0x23, 0x00, 0x1f,
+                0x67, 0x23, 0x00, 0x08, 0x12, 0x22, 0x23, 0x00, 0x3f, 0x71, 0x75, 0x6f, 0x25, 0x00, 0x08, 0x13, 0x27, 0xc5, 0x00, 0x57,
+                0x70, 0x6f, 0x73, 0x3b, 0x22, 0x8f, 0x01, 0x06, 0x47, 0x04, 0x08, 0x0a, 0x01, 0x0f, 0x91, 0x01, 0x07, 0xf0, 0x03, 0x73,
+                0x61, 0x66, 0x65, 0x44, 0x69, 0x76, 0x28, 0x64, 0x69, 0x76, 0x69, 0x64, 0x65, 0x6e, 0x64, 0x2c, 0x20, 0x0a, 0x00, 0x3c,
+                0x73, 0x6f, 0x72, 0x9a, 0x01, 0x04, 0x21, 0x00, 0x00, 0x96, 0x01, 0x44, 0x30, 0x20, 0x26, 0x26, 0x28, 0x00, 0x01, 0x10,
+                0x00, 0x0f, 0x84, 0x01, 0x02, 0x07, 0xc6, 0x06, 0x0d, 0x96, 0x00, 0x05, 0x4e, 0x00, 0x14, 0x2f, 0x48, 0x00, 0x0d, 0xa3,
+                0x00, 0xd0, 0x2f, 0x2f, 0x20, 0x4e, 0x61, 0x4e, 0x20, 0x3c, 0x20, 0x2d, 0x49, 0x6e, 0x66, 0xa3, 0x10, 0x47, 0x79, 0x20,
+                0x3c, 0x20, 0x0b, 0x00, 0x01, 0x09, 0x00, 0x84, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x75, 0x04, 0x05, 0xd8,
+                0x00, 0x00, 0x17, 0x0c, 0x42, 0x61, 0x72, 0x65, 0x4e, 0x1e, 0x00, 0x9c, 0x28, 0x6c, 0x68, 0x73, 0x2c, 0x20, 0x72, 0x68,
+                0x73, 0xd6, 0x00, 0x31, 0x69, 0x73, 0x46, 0x47, 0x00, 0x00, 0x21, 0x00, 0x10, 0x29, 0xd6, 0x00, 0x05, 0x11, 0x00, 0x00,
+                0x2d, 0x00, 0x0f, 0xd7, 0x00, 0x02, 0x50, 0x6c, 0x68, 0x73, 0x20, 0x2d, 0x4c, 0x00, 0x07, 0xdf, 0x00, 0x5e, 0x20, 0x65,
+                0x6c, 0x73, 0x65, 0x51, 0x00, 0x0f, 0x40, 0x00, 0x02, 0x1f, 0x31, 0x38, 0x00, 0x0b, 0x0f, 0x78, 0x00, 0x06, 0x1e, 0x2d,
+                0x39, 0x00, 0x08, 0x26, 0x00, 0x02, 0x45, 0x00, 0x37, 0x4e, 0x61, 0x4e, 0xcb, 0x00, 0x00, 0x0e, 0x00, 0x0e, 0x50, 0x00,
+                0x0f, 0xa1, 0x01, 0x01, 0x0b, 0x8c, 0x00, 0x04, 0x47, 0x00, 0x0f, 0x39, 0x00, 0x04, 0x08, 0x8b, 0x00, 0x0f, 0x3a, 0x00,
+                0x00, 0x0f, 0x73, 0x00, 0x08, 0x0f, 0x39, 0x00, 0x01, 0x0f, 0x29, 0x00, 0x02, 0x00, 0x7f, 0x00, 0x00, 0x5b, 0x02, 0x01,
+                0xb4, 0x01, 0x71, 0x3f, 0x20, 0x30, 0x20, 0x3a, 0x20, 0x28, 0x14, 0x00, 0x14, 0x3e, 0x13, 0x00, 0x67, 0x31, 0x20, 0x3a,
+                0x20, 0x2d, 0x31, 0xfb, 0x02, 0x08, 0x67, 0x02, 0x0f, 0x0e, 0x07, 0x07, 0x40, 0x67, 0x65, 0x74, 0x43, 0xf0, 0x64, 0x30,
+                0x65, 0x72, 0x56, 0xa2, 0x07, 0x10, 0x28, 0xa4, 0x0e, 0xbc, 0x2c, 0x20, 0x73, 0x75, 0x62, 0x6d, 0x65, 0x74, 0x72, 0x69,
+                0x63, 0x21, 0x02, 0x01, 0xc3, 0x0e, 0x07, 0x74, 0x04, 0x0a, 0x8d, 0x08, 0x3f, 0x7c, 0x7c, 0x20, 0x21, 0x00, 0x01, 0x04,
+                0x9f, 0x07, 0x0f, 0xc8, 0x01, 0x02, 0x00, 0x31, 0x00, 0x0f, 0x1a, 0x03, 0x01, 0x80, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c,
+                0x65, 0x2e, 0xff, 0x51, 0x24, 0x72, 0x74, 0x0a, 0x05, 0x01, 0x5f, 0x00, 0x0b, 0x09, 0x05, 0x0c, 0x73, 0x00, 0x03, 0x08,
+                0x05, 0x08, 0xf2, 0x09, 0x0f, 0x4b, 0x00, 0x01, 0x05, 0xe4, 0x00, 0x0c, 0x50, 0x00, 0x06, 0x19, 0x00, 0x0f, 0x55, 0x00,
+                0x01, 0x09, 0x0f, 0x01, 0x21, 0x67, 0x5f, 0xa8, 0x0b, 0x0a, 0xd9, 0x00, 0x12, 0x67, 0x42, 0x66, 0x00, 0x96, 0x56, 0xe1,
+                0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x64, 0x2e, 0x61, 0x64, 0x64, 0x3e, 0x01, 0x09, 0x9d, 0x04, 0x07,
+                0xa3, 0x00, 0x01, 0x32, 0x00, 0x27, 0x20, 0x3d, 0x3e, 0x00, 0x10, 0x5b, 0x2f, 0x00, 0x07, 0x81, 0x07, 0x00, 0x71, 0x00,
+                0x05, 0x28, 0x00, 0x26, 0x3d, 0x3d, 0x36, 0x09, 0x0a, 0x7f, 0x00, 0x06, 0x4b, 0x00, 0x28, 0x7b, 0x7d, 0x0e, 0x02, 0x0c,
+                0x59, 0x00, 0x24, 0x20, 0x3d, 0x2b, 0x00, 0x0f, 0x7f, 0x01, 0x01, 0x01, 0xb0, 0x09, 0x06, 0x23, 0x00, 0x15, 0x5b, 0x15,
+                0x01, 0x0b, 0x91, 0x00, 0x03, 0x28, 0x00, 0x0f, 0x8f, 0x00, 0x07, 0x02, 0x27, 0x01, 0x40, 0x70, 0x6f, 0x70, 0x75, 0x9e,
+                0x17, 0x51, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x6a, 0x02, 0x09, 0x7c, 0x04, 0x08, 0x72, 0x00, 0xd2, 0x4d, 0x61, 0x74, 0x68,
+                0x2e, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x28, 0x29, 0x61, 0x09, 0x0f, 0x26, 0x03, 0x0e, 0x04, 0x3c, 0x00, 0x3f, 0x4e,
+                0x61, 0x4e, 0x01, 0x03, 0x03, 0x05, 0x17, 0x01, 0x07, 0xc9, 0x00, 0x22, 0x20, 0x3d, 0x38, 0x00, 0x0f, 0x98, 0x05, 0x08,
+                0x09, 0x20, 0x00, 0x0f, 0x3d, 0x03, 0x09, 0x32, 0x50, 0x63, 0x74, 0xde, 0x01, 0x0f, 0x30, 0x03, 0x66, 0x03, 0x1f, 0x00,
+                0x0f, 0xd0, 0x03, 0x03, 0xf0, 0x07, 0x27, 0x61, 0x76, 0x67, 0x2e, 0x70, 0x63, 0x74, 0x5f, 0x6f, 0x66, 0x5f, 0x70, 0x65,
+                0x61, 0x6b, 0x5f, 0x73, 0x75, 0x73, 0x74, 0x61, 0xad, 0x01, 0x04, 0xd2, 0x5a, 0x1e, 0x27, 0xb0, 0x12, 0x0f, 0xe7, 0x00,
+                0x03, 0x00, 0x39, 0x0b, 0x0f, 0xea, 0x00, 0x3e, 0x00, 0x20, 0x00, 0x1c, 0x21, 0x56, 0x00, 0x06, 0xe4, 0x0b, 0x0f, 0xd8,
+                0x0b, 0x00, 0x09, 0x10, 0x01, 0x00, 0x9a, 0x09, 0x1f, 0x2e, 0xe3, 0x00, 0x0f, 0x0f, 0xe2, 0x00, 0x11, 0x8f, 0x44, 0x69,
+                0x6d, 0x55, 0x6e, 0x69, 0x74, 0x73, 0xce, 0x01, 0x6c, 0x0f, 0xfe, 0x04, 0x30, 0x0f, 0xa9, 0x04, 0xd4, 0x30, 0x64, 0x69,
+                0x6d, 0x9b, 0x65, 0x10, 0x74, 0x1f, 0x0c, 0x04, 0xe4, 0x03, 0x15, 0x27, 0x15, 0x00, 0x08, 0xee, 0x0c, 0x02, 0xb7, 0x09,
+                0x05, 0x2e, 0x00, 0x0f, 0x99, 0x00, 0x07, 0x08, 0x53, 0x00, 0x08, 0x7c, 0x02, 0x06, 0x45, 0x04, 0x08, 0x61, 0x00, 0x00,
+                0xed, 0x0c, 0x04, 0x0e, 0x00, 0x0f, 0xe3, 0x09, 0x0a, 0x0b, 0x24, 0x00, 0x0f, 0x86, 0x02, 0x02, 0x10, 0x52, 0x92, 0x5a,
+                0x0f, 0x8a, 0x07, 0x7c, 0x00, 0x6e, 0x00, 0x0f, 0x9d, 0x03, 0x07, 0x09, 0x73, 0x05, 0x0f, 0xbf, 0x07, 0xb3, 0x01, 0x27,
+                0x6e, 0x0f, 0x14, 0x03, 0x18, 0x01, 0x30, 0x00, 0x01, 0x12, 0x03, 0x02, 0x3a, 0x00, 0x0f, 0x10, 0x03, 0x01, 0x03, 0x24,
+                0x00, 0x0f, 0x75, 0x02, 0x07, 0x04, 0x45, 0x00, 0x0c, 0x0c, 0x03, 0x08, 0x53, 0x00, 0x22, 0x20, 0x3d, 0x27, 0x00, 0x0f,
+                0xb1, 0x07, 0x09, 0x01, 0x21, 0x00, 0x0f, 0xaf, 0x07, 0xaf, 0x0c, 0xc7, 0x00, 0x0f, 0xad, 0x07, 0x32, 0x01, 0x5e, 0x03,
+                0x0f, 0xab, 0x07, 0x79, 0x0d, 0xef, 0x03, 0x4f, 0x27, 0x70, 0x63, 0x74, 0x8b, 0x07, 0x00, 0x0f, 0xc6, 0x00, 0x02, 0x0f,
+                0x8a, 0x07, 0x86, 0x00, 0xc4, 0x00, 0x0f, 0x88, 0x01, 0x0a, 0x15, 0x54, 0xc4, 0x1f, 0x0f, 0xeb, 0x04, 0xff, 0x6e, 0x06,
+                0x4e, 0x21, 0x0f, 0xf0, 0x04, 0x18, 0x06, 0x35, 0x00, 0x01, 0xf5, 0x04, 0x07, 0x44, 0x00, 0x0f, 0xfa, 0x04, 0x01, 0x08,
+                0x2e, 0x00, 0x0f, 0x78, 0x04, 0x07, 0x09, 0x54, 0x00, 0x0c, 0x04, 0x05, 0x0d, 0x62, 0x00, 0x27, 0x20, 0x3d, 0x31, 0x00,
+                0x0f, 0x0e, 0x05, 0x09, 0x06, 0x26, 0x00, 0x0f, 0x13, 0x05, 0xaf, 0x0f, 0xcc, 0x00, 0x02, 0x0f, 0x18, 0x05, 0x32, 0x06,
+                0x90, 0x03, 0x0f, 0x1d, 0x05, 0x79, 0x0f, 0x26, 0x04, 0x03, 0x0f, 0xcb, 0x0c, 0x2e, 0x09, 0xed, 0x00, 0x0f, 0xce, 0x0c,
+                0xc2, 0xfa, 0x01, 0x74, 0x6f, 0x42, 0x61, 0x72, 0x43, 0x68, 0x61, 0x72, 0x74, 0x28, 0x70, 0x63, 0x74, 0x2c, 0x20, 0xd9,
+                0x18, 0x00, 0xdf, 0x00, 0x29, 0x70, 0x63, 0x3a, 0x16, 0x0d, 0xde, 0x00, 0x0f, 0x20, 0x00, 0x00, 0x0f, 0xcd, 0x01, 0x0a,
+                0x0f, 0xd4, 0x00, 0x03, 0x00, 0xce, 0x04, 0x10, 0x74, 0x17, 0x1a, 0x60, 0x6d, 0x70, 0x65, 0x64, 0x50, 0x63, 0xda, 0x03,
+                0x01, 0x1b, 0x03, 0x42, 0x6d, 0x69, 0x6e, 0x28, 0x09, 0x00, 0x22, 0x61, 0x78, 0xa2, 0x00, 0x30, 0x30, 0x29, 0x2c, 0x26,
+                0x03, 0x03, 0x48, 0x19, 0x00, 0x31, 0x00, 0x00, 0x46, 0x19, 0x10, 0x72, 0x5f, 0x25, 0x0b, 0x4e, 0x00, 0x01, 0x01, 0x1c,
+                0x47, 0x20, 0x3d, 0x20, 0x32, 0x53, 0x03, 0x02, 0x1a, 0x00, 0x34, 0x62, 0x61, 0x72, 0x1d, 0x00, 0x01, 0x5d, 0x00, 0x67,
+                0x63, 0x65, 0x69, 0x6c, 0x28, 0x28, 0x7e, 0x00, 0x11, 0x2f, 0x63, 0x00, 0x22, 0x20, 0x2a, 0x44, 0x00, 0x07, 0xdb, 0x04,
+                0x00, 0xd4, 0x1f, 0x0a, 0xea, 0x0b, 0xf0, 0x01, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x6c, 0x65, 0x74, 0x20, 0x69, 0x69, 0x20,
+                0x3d, 0x20, 0x31, 0x3b, 0x08, 0x00, 0x25, 0x3c, 0x3d, 0x63, 0x00, 0x00, 0x10, 0x00, 0x2a, 0x2b, 0x2b, 0x0a, 0x01, 0x00,
+                0x45, 0x00, 0x5f, 0x2b, 0x3d, 0x20, 0x63, 0x68, 0xde, 0x01, 0x0a, 0x0e, 0xd8, 0x15, 0x05, 0xb6, 0x01, 0x01, 0xc1, 0x1c,
+                0xf8, 0x02, 0x55, 0x70, 0x28, 0x6e, 0x75, 0x6d, 0x2c, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x65,
+                0x00, 0x05, 0x15, 0x00, 0x04, 0xe3, 0x00, 0x68, 0x70, 0x6f, 0x77, 0x28, 0x31, 0x30, 0x2e, 0x00, 0x0d, 0x89, 0x18, 0x06,
+                0x0b, 0x01, 0x58, 0x6e, 0x75, 0x6d, 0x20, 0x2a, 0x59, 0x00, 0x16, 0x2f, 0x0d, 0x00, 0x0f, 0x96, 0x00, 0x07, 0x03, 0x28,
+                0x60, 0x23, 0x70, 0x63, 0x4c, 0x02, 0x05, 0x33, 0x00, 0x2f, 0x3d, 0x31, 0x55, 0x02, 0x4d, 0x2f, 0x70, 0x63, 0xdb, 0x05,
+                0x02, 0x06, 0x59, 0x15, 0x3f, 0x70, 0x63, 0x74, 0x1c, 0x16, 0x03, 0x4f, 0x27, 0xe2, 0x9a, 0xa0, 0x92, 0x02, 0x02, 0x01,
+                0xe0, 0x07, 0x05, 0x5c, 0x16, 0x0f, 0x40, 0x00, 0x06, 0x02, 0x9e, 0x02, 0x41, 0x73, 0x69, 0x67, 0x6e, 0x24, 0x00, 0x00,
+                0x77, 0x07, 0x10, 0x31, 0x64, 0x15, 0xa0, 0x27, 0xe2, 0x88, 0x9e, 0x27, 0x20, 0x3a, 0x20, 0x27, 0x2d, 0x09, 0x00, 0x0f,
+                0xe9, 0x01, 0x08, 0x04, 0xcc, 0x01, 0x0a, 0x33, 0x01, 0x50, 0x29, 0x2e, 0x74, 0x6f, 0x4c, 0xab, 0x63, 0x13, 0x65, 0xd2,
+                0x1c, 0x05, 0x71, 0x06, 0x30, 0x2c, 0x20, 0x7b, 0x71, 0x1a, 0x60, 0x69, 0x6d, 0x75, 0x6d, 0x46, 0x72, 0xa1, 0x67, 0x96,
+                0x6f, 0x6e, 0x44, 0x69, 0x67, 0x69, 0x74, 0x73, 0x3a, 0x3e, 0x00, 0x10, 0x2c, 0x68, 0x1f, 0x0f, 0x22, 0x00, 0x0a, 0x2f,
+                0x20, 0x7d, 0xfa, 0x04, 0x08, 0x03, 0xc9, 0x01, 0x7f, 0x61, 0x76, 0x67, 0x28, 0x61, 0x76, 0x67, 0xc9, 0x01, 0x0a, 0x3f,
+                0x61, 0x76, 0x67, 0xc9, 0x01, 0x0a, 0x0f, 0x20, 0x00, 0x00, 0x0f, 0xc9, 0x01, 0x0a, 0x3f, 0x61, 0x76, 0x67, 0xc9, 0x01,
+                0x0b, 0x3f, 0x61, 0x76, 0x67, 0xc9, 0x01, 0x2a, 0x0f, 0x40, 0x00, 0x06, 0x07, 0xc9, 0x01, 0x00, 0x24, 0x00, 0x0f, 0xc9,
+                0x01, 0x1f, 0x00, 0x87, 0x05, 0x0f, 0xb5, 0x01, 0x6f, 0x59, 0x73, 0x75, 0x6d, 0x28, 0x73, 0x17, 0x04, 0x0e, 0xb5, 0x01,
+                0x3f, 0x73, 0x75, 0x6d, 0xb5, 0x01, 0x0a, 0x0f, 0x20, 0x00, 0x00, 0x0f, 0xb5, 0x01, 0x0a, 0x3f, 0x73, 0x75, 0x6d, 0xb5,
+                0x01, 0x0b, 0x3f, 0x73, 0x75, 0x6d, 0xb5, 0x01, 0x2a, 0x0f, 0x40, 0x00, 0x06, 0x07, 0xb5, 0x01, 0x00, 0x24, 0x00, 0x0f,
+                0xb5, 0x01, 0x1f, 0x3f, 0x73, 0x75, 0x6d, 0xb5, 0x01, 0x69, 0xf0, 0x03, 0x61, 0x64, 0x64, 0x43, 0x65, 0x6c, 0x6c, 0x41,
+                0x74, 0x74, 0x72, 0x28, 0x74, 0x72, 0x6f, 0x77, 0x2c, 0x20, 0xa0, 0x6a, 0x20, 0x69, 0x62, 0x4f, 0x1e, 0x11, 0x2c, 0x67,
+                0x22, 0x20, 0x2c, 0x20, 0xd6, 0x6a, 0x03, 0x89, 0x08, 0x6a, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x2d, 0x08, 0x00, 0x7b,
+                0x06, 0x20, 0x74, 0x64, 0x5a, 0x12, 0xf0, 0x02, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61,
+                0x74, 0x65, 0x45, 0x6c, 0x65, 0x0e, 0x00, 0x37, 0x28, 0x27, 0x74, 0xe6, 0x08, 0x03, 0xaf, 0x06, 0x02, 0x06, 0x07, 0x00,
+                0x6b, 0x00, 0x37, 0x20, 0x69, 0x6e, 0x73, 0x00, 0x0b, 0x68, 0x0b, 0x50, 0x64, 0x2e, 0x73, 0x65, 0x74, 0x9c, 0x00, 0x01,
+                0x1e, 0x00, 0x10, 0x28, 0x28, 0x00, 0x08, 0xa1, 0x00, 0x10, 0x5b, 0x0b, 0x00, 0x1f, 0x5d, 0x42, 0x1d, 0x02, 0x01, 0xcd,
+                0x0b, 0x2f, 0x65, 0x78, 0xe5, 0x05, 0x07, 0x0a, 0x6a, 0x00, 0x00, 0xc4, 0x00, 0x30, 0x73, 0x70, 0x61, 0xad, 0x06, 0x0f,
+                0xc6, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x08, 0xc8, 0x00, 0x11, 0x20, 0x31, 0x00, 0x0a, 0xa1, 0x00, 0x11, 0x22, 0x57, 0x22,
+                0x4a, 0x22, 0x2c, 0x20, 0x22, 0x75, 0x28, 0x08, 0xe6, 0x1d, 0x03, 0x38, 0x00, 0x90, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x48,
+                0x54, 0x4d, 0x4c, 0xce, 0x07, 0x19, 0x2d, 0xb9, 0x13, 0xf0, 0x00, 0x74, 0x64, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64,
+                0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x2f, 0x00, 0x08, 0xe4, 0x00, 0x06, 0xb3, 0x1b, 0x0f, 0xe1, 0x00, 0x01, 0x0f, 0x28,
+                0x03, 0x03, 0x0f, 0xe0, 0x00, 0x43, 0x04, 0x6c, 0x00, 0x0f, 0xdf, 0x00, 0x40, 0x0c, 0xd4, 0x0c, 0x07, 0x84, 0x02, 0x0c,
+                0xca, 0x0c, 0x29, 0x74, 0x64, 0x6e, 0x00, 0x00, 0x15, 0x01, 0x0f, 0xc2, 0x0c, 0x0e, 0x0b, 0x34, 0x00, 0x07, 0xdb, 0x20,
+                0x00, 0x3f, 0x00, 0x0f, 0x99, 0x1c, 0x0c, 0x20, 0x20, 0x20, 0x2a, 0x03, 0x09, 0xc5, 0x00, 0x2f, 0x74, 0x64, 0x64, 0x03,
+                0x0f, 0x20, 0x53, 0x69, 0x4b, 0x70, 0x03, 0x66, 0x03, 0x01, 0x49, 0x01, 0x0f, 0x63, 0x03, 0x0a, 0x90, 0x2c, 0x20, 0x74,
+                0x6f, 0x6f, 0x6c, 0x74, 0x69, 0x70, 0x4b, 0x22, 0x18, 0x22, 0xf5, 0x00, 0x0e, 0xb4, 0x03, 0x23, 0x7b, 0x20, 0x9a, 0x01,
+                0x16, 0x3a, 0x59, 0x00, 0x11, 0x22, 0x47, 0x28, 0x25, 0x22, 0x3a, 0x47, 0x00, 0x1f, 0x7d, 0x6d, 0x00, 0x00, 0x0e, 0xb6,
+                0x00, 0x21, 0x2f, 0x2f, 0xa2, 0x03, 0x01, 0x81, 0x0f, 0xcd, 0x67, 0x69, 0x6e, 0x67, 0x20, 0x75, 0x74, 0x69, 0x6c, 0x69,
+                0x74, 0x79, 0xa5, 0x1f, 0x00, 0xe3, 0x2a, 0x15, 0x52, 0x86, 0x0f, 0x11, 0x4d, 0xe2, 0x0d, 0x19, 0x73, 0xf8, 0x24, 0x0f,
+                0xb3, 0x17, 0x03, 0x01, 0x39, 0x00, 0x08, 0x07, 0x23, 0x0f, 0xc4, 0x14, 0x01, 0x0f, 0x25, 0x00, 0x00, 0x0f, 0xfe, 0x0f,
+                0x04, 0x0b, 0x2a, 0x00, 0x0f, 0x61, 0x0c, 0x00, 0x00, 0x35, 0x2f, 0x93, 0x5f, 0x52, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65,
+                0x64, 0x3a, 0x19, 0x21, 0x73, 0x28, 0x17, 0x00, 0x0c, 0xc7, 0x04, 0x02, 0xa8, 0x0e, 0x00, 0x25, 0x31, 0x01, 0xd0, 0x24,
+                0x07, 0x7d, 0x0f, 0x33, 0x66, 0x6f, 0x72, 0xb5, 0x04, 0x04, 0x0a, 0x18, 0x2f, 0x6f, 0x66, 0xe1, 0x00, 0x03, 0x0a, 0x9f,
+                0x02, 0x07, 0x52, 0x00, 0x54, 0x2e, 0x70, 0x75, 0x73, 0x68, 0x6c, 0x18, 0x0f, 0xb5, 0x04, 0x02, 0x08, 0x2d, 0x00, 0x40,
+                0x73, 0x6f, 0x72, 0x74, 0xd7, 0x00, 0x0f, 0x38, 0x05, 0x01, 0x06, 0x28, 0x00, 0x00, 0x86, 0x00, 0x07, 0x36, 0x00, 0x0a,
+                0x7c, 0x00, 0x00, 0x60, 0x24, 0x00, 0x20, 0x02, 0x0f, 0x9b, 0x05, 0x09, 0x1a, 0x72, 0xf3, 0x03, 0x0f, 0xab, 0x02, 0x01,
+                0x30, 0x22, 0x6c, 0x61, 0xf2, 0x03, 0x10, 0x27, 0xce, 0x24, 0x07, 0x7a, 0x00, 0x5a, 0x2b, 0x20, 0x22, 0x27, 0x2c, 0xfa,
+                0x03, 0x01, 0x54, 0x01, 0x0a, 0x18, 0x03, 0x3f, 0x72, 0x6f, 0x77, 0xe2, 0x22, 0x09, 0x07, 0xbc, 0x00, 0x0f, 0xc2, 0x01,
+                0x15, 0x01, 0x52, 0x14, 0x0f, 0xc0, 0x01, 0x28, 0x02, 0xbc, 0x16, 0x01, 0xbe, 0x01, 0x0d, 0x78, 0x02, 0x0f, 0xbc, 0x01,
+                0x0c, 0x01, 0x30, 0x00, 0x0f, 0xba, 0x01, 0xff, 0x28, 0x06, 0xcd, 0x10, 0x0f, 0xbf, 0x01, 0x28, 0x07, 0x7c, 0x13, 0x01,
+                0xc4, 0x01, 0x0f, 0x17, 0x04, 0x03, 0x0f, 0xc9, 0x01, 0x0c, 0x06, 0x35, 0x00, 0x0f, 0xce, 0x01, 0xff, 0x11, 0x00, 0xe6,
+                0x10, 0x31, 0x61, 0x6c, 0x63, 0x51, 0x14, 0x50, 0x20, 0x74, 0x68, 0x65, 0x20, 0xcb, 0x00, 0x01, 0x4d, 0x08, 0x00, 0x01,
+                0x12, 0x20, 0x64, 0x20, 0xaa, 0x12, 0x30, 0x72, 0x6f, 0x75, 0xda, 0x7a, 0x00, 0x1b, 0x00, 0xa2, 0x73, 0x20, 0x74, 0x68,
+                0x61, 0x74, 0x20, 0x68, 0x61, 0x76, 0x2e, 0x00, 0x10, 0x73, 0xa5, 0x00, 0x05, 0xb4, 0x09, 0x00, 0x71, 0x00, 0xa1, 0x72,
+                0x69, 0x65, 0x76, 0x65, 0x64, 0x20, 0x76, 0x69, 0x61, 0x22, 0x18, 0x26, 0x6f, 0x77, 0x61, 0x08, 0x26, 0x29, 0x2c, 0x75,
+                0x00, 0x04, 0xea, 0x24, 0x00, 0x00, 0x08, 0x00, 0x49, 0x00, 0x71, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x7f, 0x00,
+                0x20, 0x68, 0x61, 0x67, 0x00, 0x0d, 0x5d, 0x00, 0x30, 0x61, 0x73, 0x20, 0x0a, 0x1d, 0x80, 0x70, 0x72, 0x65, 0x76, 0x69,
+                0x6f, 0x75, 0x73, 0x2b, 0x00, 0x0d, 0xb8, 0x06, 0xb0, 0x61, 0x6c, 0x63, 0x52, 0x6f, 0x77, 0x53, 0x70, 0x61, 0x6e, 0x28,
+                0xae, 0x00, 0x10, 0x2c, 0x25, 0x00, 0x4c, 0x49, 0x64, 0x78, 0x2c, 0x8c, 0x00, 0x0c, 0x9d, 0x02, 0x00, 0x2d, 0x00, 0x02,
+                0x42, 0x09, 0x07, 0xce, 0x11, 0x01, 0x26, 0x0c, 0x02, 0x41, 0x00, 0x00, 0xb8, 0x0c, 0x0c, 0xcf, 0x00, 0x00, 0x34, 0x00,
+                0x12, 0x5b, 0x1f, 0x00, 0x5f, 0x5d, 0x29, 0x20, 0x21, 0x3d, 0x21, 0x00, 0x09, 0x5b, 0x20, 0x2d, 0x20, 0x31, 0x5d, 0x65,
+                0x0c, 0x0a, 0xdb, 0x11, 0x02, 0x28, 0x00, 0x02, 0xe0, 0x11, 0x01, 0x8f, 0x00, 0x50, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0xe2,
+                0x11, 0x4c, 0x2b, 0x2b, 0x69, 0x69, 0x17, 0x09, 0x01, 0x0a, 0x16, 0x0f, 0x90, 0x00, 0x22, 0x2c, 0x69, 0x69, 0x88, 0x00,
+                0x01, 0x34, 0x12, 0x00, 0x9f, 0x34, 0x08, 0x66, 0x02, 0x0a, 0xf1, 0x15, 0x43, 0x20, 0x20, 0x2b, 0x2b, 0x23, 0x01, 0x0f,
+                0x3e, 0x09, 0x0d, 0x05, 0x78, 0x10, 0x09, 0x2e, 0x00, 0x0f, 0x51, 0x0e, 0x05, 0x02, 0x5a, 0x08, 0x80, 0x46, 0x6f, 0x72,
+                0x6d, 0x75, 0x6c, 0x61, 0x28, 0x14, 0x00, 0x3c, 0x75, 0x6c, 0x61, 0x51, 0x0e, 0x1f, 0x21, 0x18, 0x00, 0x00, 0x0f, 0xc5,
+                0x14, 0x13, 0x30, 0x27, 0x4e, 0x73, 0xf9, 0x2e, 0x93, 0x20, 0x50, 0x65, 0x72, 0x66, 0x20, 0x53, 0x44, 0x4b, 0x0b, 0x03,
+                0x41, 0x28, 0x73, 0x29, 0x3a, 0x69, 0x2b, 0x03, 0x59, 0x00, 0x07, 0xa6, 0x00, 0x0c, 0xa7, 0x00, 0xd3, 0x6f, 0x6e, 0x43,
+                0x6c, 0x69, 0x63, 0x6b, 0x5f, 0x53, 0x68, 0x6f, 0x77, 0x57, 0x54, 0x31, 0x09, 0x08, 0x09, 0x01, 0x7d, 0x0b, 0x07, 0x1d,
+                0x00, 0x83, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0xfe, 0x03, 0x08, 0x17, 0x04, 0x33, 0x67, 0x65, 0x74, 0x16,
+                0x00, 0x60, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x37, 0x00, 0x00, 0x13, 0x36, 0x01, 0x38, 0x00, 0x08, 0x23, 0x04, 0x00,
+                0x54, 0x00, 0x13, 0x63, 0x48, 0x00, 0x01, 0x72, 0x16, 0x2f, 0x20, 0x3d, 0x64, 0x00, 0x09, 0x11, 0x2e, 0x2c, 0x00, 0x0a,
+                0xc1, 0x30, 0x02, 0x3b, 0x0c, 0x03, 0x2c, 0x7f, 0x03, 0x28, 0x00, 0x01, 0x0e, 0x2d, 0x0e, 0x8d, 0x00, 0x40, 0x73, 0x42,
+                0x79, 0x43, 0x58, 0x0a, 0x00, 0x21, 0x04, 0x24, 0x28, 0x22, 0x90, 0x00, 0x08, 0x75, 0x04, 0x05, 0xaa, 0x02, 0x40, 0x65,
+                0x6c, 0x65, 0x6d, 0x0e, 0x05, 0x0f, 0x5c, 0x00, 0x00, 0x0a, 0x9d, 0x01, 0x00, 0x29, 0x00, 0x60, 0x2e, 0x68, 0x69, 0x64,
+                0x64, 0x65, 0x54, 0x03, 0x19, 0x21, 0xcd, 0x00, 0x0f, 0x1b, 0x2f, 0x11, 0x04, 0x77, 0x01, 0xcd, 0x4d, 0x6f, 0x62, 0x69,
+                0x6c, 0x65, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x77, 0x01, 0x17, 0x6d, 0x1d, 0x00, 0x0f, 0x77, 0x01, 0x18, 0x02, 0x37,
+                0x00, 0x21, 0x2d, 0x6c, 0x38, 0x00, 0x0f, 0x77, 0x01, 0x0d, 0x0f, 0x64, 0x00, 0x08, 0x0f, 0x77, 0x01, 0x03, 0x01, 0x52,
+                0x39, 0x7f, 0x53, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x78, 0x01, 0x0e, 0x02, 0x73, 0x01, 0x01, 0x33, 0x00, 0x22, 0x5f,
+                0x73, 0x34, 0x00, 0x0f, 0x78, 0x01, 0x0a, 0x0f, 0x5d, 0x00, 0x01, 0x0f, 0x79, 0x01, 0x3b, 0x02, 0xd5, 0x07, 0x11, 0x44,
+                0x87, 0x3c, 0x2f, 0x49, 0x64, 0xcb, 0x07, 0x00, 0x02, 0x5c, 0x31, 0x19, 0x52, 0x5a, 0x34, 0x03, 0xf9, 0x16, 0x00, 0x12,
+                0x02, 0x30, 0x6f, 0x72, 0x28, 0xca, 0x38, 0x12, 0x2c, 0xec, 0x19, 0x01, 0x2d, 0x00, 0x03, 0x0c, 0x00, 0x05, 0xf3, 0x0c,
+                0x0d, 0xe3, 0x0d, 0x41, 0x68, 0x69, 0x73, 0x2e, 0xff, 0x38, 0x11, 0x3d, 0x1f, 0x3d, 0x0a, 0x87, 0x04, 0x01, 0x1e, 0x00,
+                0x06, 0x4d, 0x00, 0x04, 0x66, 0x1a, 0x01, 0x0d, 0x00, 0x0f, 0x2a, 0x00, 0x05, 0x0e, 0x8b, 0x1a, 0x05, 0x20, 0x00, 0x06,
+                0x77, 0x0d, 0x03, 0x0a, 0x00, 0x0f, 0xd0, 0x04, 0x05, 0x08, 0x69, 0x24, 0x00, 0x0f, 0x08, 0x21, 0x73, 0x6d, 0x5e, 0x0c,
+                0x05, 0x55, 0x1b, 0x00, 0x58, 0x15, 0x14, 0x28, 0xa5, 0x2d, 0x0c, 0xec, 0x26, 0x1e, 0x27, 0xf6, 0x8a, 0x00, 0xe8, 0x2f,
+                0x51, 0x73, 0x75, 0x6d, 0x27, 0x29, 0x8c, 0x06, 0x0f, 0x2e, 0x00, 0x11, 0x6b, 0x61, 0x76, 0x67, 0x27, 0x29, 0x29, 0x94,
+                0x1d, 0x05, 0x89, 0x00, 0x21, 0x53, 0x74, 0x2b, 0x18, 0x0e, 0x3b, 0x00, 0x10, 0x2e, 0x60, 0x13, 0x2f, 0x2f, 0x20, 0x19,
+                0x00, 0x00, 0x00, 0x51, 0x00, 0x0c, 0x4e, 0x00, 0x3f, 0x6c, 0x74, 0x73, 0xd8, 0x00, 0x19, 0x0f, 0x82, 0x8e, 0x00, 0x0f,
+                0xd9, 0x00, 0x09, 0x0f, 0x2f, 0x00, 0x04, 0x0f, 0xda, 0x00, 0x04, 0xf6, 0x01, 0x6c, 0x32, 0x63, 0x61, 0x63, 0x68, 0x65,
+                0x53, 0x69, 0x7a, 0x65, 0x4b, 0x69, 0x42, 0x20, 0x3d, 0x9d, 0x00, 0x47, 0x2a, 0x20, 0x31, 0x32, 0x4e, 0x3c, 0x0f, 0x2f,
+                0x00, 0x01, 0x03, 0x10, 0x01, 0x0f, 0x72, 0x00, 0x00, 0x03, 0x11, 0x01, 0x0f, 0x1a, 0x00, 0x01, 0x00, 0x40, 0x16, 0x01,
+                0x5c, 0x00, 0x17, 0x27, 0x04, 0x0a, 0x04, 0x10, 0x08, 0x00, 0xa6, 0x0a, 0x07, 0x1d, 0x02, 0x00, 0x7c, 0x33, 0x50, 0x52,
+                0x6f, 0x77, 0x28, 0x27, 0x6d, 0x32, 0x30, 0x20, 0x26, 0x20, 0x50, 0x31, 0x1a, 0x27, 0x46, 0x07, 0x09, 0x01, 0x00, 0x64,
+                0x2c, 0x20, 0x22, 0x72, 0x61, 0x22, 0x0c, 0x00, 0x06, 0xec, 0x33, 0x11, 0x67, 0x04, 0x92, 0x1c, 0x29, 0x2c, 0x00, 0x03,
+                0x2a, 0x00, 0x0f, 0x01, 0x00, 0x03, 0x05, 0x3a, 0x09, 0x09, 0x89, 0x00, 0x40, 0x47, 0x50, 0x55, 0x20, 0x42, 0x04, 0x0f,
+                0x86, 0x00, 0x09, 0x0d, 0x89, 0x00, 0x00, 0x7f, 0x1f, 0x00, 0xdd, 0x03, 0x41, 0x2e, 0x67, 0x70, 0x75, 0x63, 0x0a, 0x0f,
+                0x89, 0x00, 0x30, 0x4f, 0x43, 0x68, 0x69, 0x70, 0x8a, 0x00, 0x10, 0x0f, 0x89, 0x00, 0x04, 0x4d, 0x63, 0x68, 0x69, 0x70,
+                0x8a, 0x00, 0x0f, 0x89, 0x00, 0x24, 0x90, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x4c, 0x6f, 0x63, 0x6b, 0xb0, 0x0a, 0x6f, 0x53,
+                0x74, 0x61, 0x74, 0x75, 0x73, 0x94, 0x00, 0x00, 0x0f, 0x89, 0x00, 0x05, 0x00, 0x3e, 0x00, 0x03, 0x3d, 0x00, 0x02, 0x3c,
+                0x00, 0x0f, 0x89, 0x00, 0x26, 0x4f, 0x23, 0x20, 0x53, 0x4d, 0x7a, 0x00, 0x01, 0x0f, 0x89, 0x00, 0x0a, 0x04, 0x63, 0x04,
+                0x0f, 0x2c, 0x00, 0x05, 0x07, 0xfa, 0x03, 0x0f, 0x89, 0x00, 0x16, 0x40, 0x4c, 0x32, 0x20, 0x43, 0x26, 0x03, 0x10, 0x20,
+                0x27, 0x03, 0x6f, 0x20, 0x28, 0x4b, 0x69, 0x42, 0x29, 0x97, 0x00, 0x01, 0x0a, 0x89, 0x00, 0x0b, 0x89, 0x03, 0x0d, 0x2c,
+                0x00, 0x0e, 0x7a, 0x03, 0x0b, 0x89, 0x00, 0x05, 0x8a, 0x00, 0x1f, 0x5d, 0x5c, 0x0d, 0x03, 0x00, 0xe6, 0x0b, 0x21, 0x6f,
+                0x66, 0x66, 0x03, 0x0f, 0x4e, 0x0d, 0x45, 0x00, 0x93, 0x22, 0x41, 0x68, 0x64, 0x72, 0x22, 0x03, 0x0c, 0x01, 0x5f, 0x06,
+                0x0f, 0x89, 0x13, 0x04, 0x0f, 0x89, 0x0a, 0x01, 0x00, 0x33, 0x00, 0x04, 0xae, 0x06, 0x0f, 0x6d, 0x00, 0x0e, 0x00, 0x2d,
+                0x00, 0x08, 0xee, 0x06, 0x05, 0x10, 0x00, 0x0f, 0x71, 0x00, 0x31, 0x0f, 0xee, 0x0d, 0x16, 0x0f, 0xcb, 0x07, 0x0b, 0x01,
+                0x19, 0x03, 0x0f, 0xce, 0x07, 0x28, 0x00, 0xb3, 0x04, 0x02, 0x06, 0x00, 0x01, 0x94, 0x2c, 0x04, 0xd0, 0x04, 0x01, 0xb1,
+                0x00, 0x62, 0x2c, 0x20, 0x66, 0x72, 0x65, 0x71, 0x06, 0x00, 0x03, 0x1e, 0x00, 0x00, 0x0b, 0x00, 0x03, 0x1e, 0x00, 0x0f,
+                0xee, 0x07, 0x20, 0x00, 0x5c, 0x00, 0x00, 0xa1, 0x07, 0x07, 0xb1, 0x36, 0x0b, 0x1e, 0x00, 0x01, 0x67, 0x00, 0x03, 0x23,
+                0x00, 0x01, 0x0c, 0x00, 0x0f, 0x28, 0x00, 0x04, 0x03, 0x84, 0x00, 0x03, 0x2a, 0x00, 0x03, 0x0e, 0x00, 0x0f, 0x2c, 0x00,
+                0x00, 0x00, 0xb0, 0x00, 0x00, 0xa1, 0x01, 0x3f, 0x72, 0x65, 0x71, 0x1e, 0x00, 0x04, 0x04, 0x72, 0x00, 0x05, 0x0c, 0x00,
+                0x0f, 0x28, 0x00, 0x04, 0x06, 0x72, 0x00, 0x07, 0x0e, 0x00, 0x0f, 0x64, 0x08, 0x0f, 0x0f, 0x74, 0x06, 0x0d, 0x01, 0x41,
+                0x38, 0x13, 0x44, 0x37, 0x98, 0x02, 0xc1, 0x03, 0x0f, 0x6f, 0x07, 0x00, 0x0e, 0x62, 0x98, 0x05, 0x9d, 0x07, 0x0f, 0x84,
+                0x04, 0x09, 0x27, 0x27, 0x6e, 0xab, 0x04, 0x2f, 0x2c, 0x20, 0x47, 0x00, 0x00, 0x00, 0x43, 0x07, 0x03, 0x23, 0x00, 0x11,
+                0x2c, 0x95, 0x00, 0x0a, 0xd5, 0x1b, 0x0f, 0x01, 0x00, 0x21, 0x38, 0x2c, 0x20, 0x27, 0x89, 0x04, 0x0b, 0x0f, 0x00, 0x0f,
+                0xde, 0x04, 0x14, 0x41, 0x53, 0x59, 0x53, 0x20, 0xdb, 0x02, 0x08, 0xc0, 0x00, 0x0e, 0x5f, 0x09, 0x0e, 0x37, 0x8b, 0x05,
+                0x86, 0x08, 0x0f, 0xa0, 0x00, 0x09, 0x00, 0x38, 0x00, 0x31, 0x63, 0x6c, 0x6b, 0x1d, 0x01, 0x03, 0x0f, 0x00, 0x0f, 0x53,
+                0x09, 0x01, 0x0f, 0x77, 0x00, 0x1f, 0x40, 0x2e, 0x70, 0x65, 0x72, 0x52, 0x3f, 0x41, 0x6f, 0x6e, 0x64, 0x27, 0x97, 0x25,
+                0x36, 0x65, 0x2d, 0x36, 0x77, 0x00, 0x35, 0x4d, 0x48, 0x7a, 0xcf, 0x00, 0x0f, 0x77, 0x00, 0x07, 0x07, 0x44, 0x00, 0x02,
+                0x50, 0x22, 0x00, 0x01, 0x00, 0x1f, 0x27, 0x29, 0x08, 0x05, 0x1f, 0x43, 0x27, 0x01, 0x10, 0x0f, 0xb4, 0x9a, 0x00, 0x0f,
+                0x27, 0x01, 0x12, 0x00, 0x38, 0x00, 0x07, 0x27, 0x01, 0x0f, 0x47, 0x00, 0x00, 0x0f, 0x27, 0x01, 0x0a, 0x0f, 0x77, 0x00,
+                0x07, 0x0f, 0x27, 0x01, 0x1a, 0x0f, 0x77, 0x00, 0x04, 0x0f, 0x27, 0x01, 0x19, 0x00, 0x2c, 0x07, 0x0a, 0x26, 0x01, 0x0f,
+                0xb0, 0x00, 0x01, 0x0f, 0xd4, 0x0a, 0x09, 0x0f, 0x27, 0x01, 0x09, 0x00, 0x38, 0x00, 0x07, 0x27, 0x01, 0x0f, 0x8f, 0x0a,
+                0x04, 0x0f, 0x27, 0x01, 0x06, 0x0f, 0x77, 0x00, 0x07, 0x0f, 0x27, 0x01, 0x1a, 0x0f, 0x77, 0x00, 0x04, 0x0f, 0x27, 0x01,
+                0x19, 0x69, 0x4d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x2b, 0x01, 0x0f, 0xb0, 0x00, 0x00, 0x0f, 0x67, 0x9d, 0x01, 0x0f, 0x28,
+                0x01, 0x0e, 0x22, 0x2c, 0x20, 0x38, 0x00, 0x03, 0x28, 0x01, 0x04, 0x0f, 0x00, 0x0f, 0x28, 0x01, 0x05, 0x0f, 0x77, 0x00,
+                0x1b, 0x0c, 0x28, 0x01, 0x15, 0x32, 0x2c, 0x01, 0x00, 0x27, 0x01, 0x25, 0x54, 0x2f, 0x05, 0x05, 0x0f, 0x77, 0x00, 0x08,
+                0x08, 0x28, 0x01, 0x00, 0x42, 0x00, 0x09, 0x2c, 0x01, 0x0f, 0xf6, 0x08, 0x82, 0x0f, 0x36, 0x00, 0x0f, 0x10, 0x72, 0x7a,
+                0x16, 0x07, 0xe0, 0x21, 0x01, 0x8c, 0x08, 0x00, 0xa3, 0x0c, 0x0f, 0xc0, 0x08, 0x1d, 0x06, 0x63, 0x07, 0x0f, 0x35, 0x09,
+                0x0f, 0x02, 0x76, 0x00, 0x04, 0x37, 0x00, 0x01, 0x52, 0x07, 0x0f, 0xaa, 0x00, 0x23, 0x00, 0x67, 0x07, 0x0f, 0xaa, 0x00,
+                0x1d, 0x08, 0x9f, 0x08, 0x0f, 0xaa, 0x00, 0x18, 0x05, 0xfc, 0x07, 0x0f, 0xa2, 0x09, 0x3b, 0x80, 0x54, 0x6f, 0x70, 0x4c,
+                0x65, 0x76, 0x65, 0x6c, 0x73, 0x0c, 0x0f, 0xa3, 0x09, 0x22, 0x00, 0x6e, 0x90, 0x51, 0x67, 0x6f, 0x72, 0x79, 0x2c, 0x51,
+                0x09, 0x05, 0x6f, 0x11, 0x01, 0x07, 0x00, 0x05, 0xa4, 0x09, 0x02, 0x01, 0x26, 0x25, 0x63, 0x74, 0x11, 0x00, 0x22, 0x64,
+                0x65, 0xec, 0x43, 0x0b, 0xdb, 0x27, 0x05, 0xce, 0x08, 0x04, 0x56, 0x00, 0x00, 0xce, 0x34, 0x03, 0x0b, 0x00, 0x0f, 0xf4,
+                0x08, 0x00, 0x0f, 0xb8, 0x11, 0x10, 0x0f, 0x8e, 0x11, 0x08, 0x08, 0xa3, 0x00, 0x04, 0x27, 0x00, 0x0f, 0xa6, 0x09, 0x07,
+                0x00, 0xb7, 0x27, 0x1a, 0x3d, 0x8d, 0x27, 0x08, 0x1c, 0x00, 0x06, 0x48, 0x00, 0x06, 0x0d, 0x00, 0x0f, 0x2a, 0x00, 0x00,
+                0x07, 0xf8, 0x00, 0x00, 0x70, 0x03, 0x06, 0x0e, 0x00, 0x0f, 0xa6, 0x09, 0x06, 0x0f, 0xa5, 0x09, 0x15, 0x42, 0x33, 0x44,
+                0x2b, 0x43, 0x56, 0x93, 0x08, 0x72, 0x05, 0xb1, 0x47, 0x52, 0x20, 0x45, 0x6e, 0x67, 0x69, 0x6e, 0x65, 0x20, 0x41, 0xf0,
+                0x8e, 0x0f, 0xe7, 0x08, 0x04, 0x0f, 0x1a, 0x07, 0x01, 0x0c, 0x1e, 0xa2, 0x0f, 0x68, 0x06, 0x0f, 0x0c, 0x9b, 0x07, 0x0c,
+                0x42, 0x00, 0x06, 0x63, 0x06, 0x0f, 0xb4, 0x09, 0x23, 0x0a, 0x68, 0x3a, 0x0f, 0xa2, 0x00, 0x00, 0x0f, 0x9b, 0x00, 0x13,
+                0x0f, 0x52, 0x00, 0x05, 0x00, 0x20, 0x11, 0x0f, 0x55, 0x00, 0x18, 0x76, 0x2c, 0x20, 0x22, 0x54, 0x68, 0x65, 0x20, 0x62,
+                0x01, 0x03, 0x13, 0x98, 0xd3, 0x73, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x33, 0x44, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x93, 0x01,
+                0x00, 0x8d, 0x4d, 0x8f, 0x6b, 0x6c, 0x6f, 0x61, 0x64, 0x73, 0x2e, 0x22, 0xd8, 0x06, 0x03, 0x2d, 0x33, 0x44, 0x1a, 0x01,
+                0xff, 0x06, 0x2c, 0x20, 0x27, 0x48, 0x61, 0x72, 0x64, 0x77, 0x61, 0x72, 0x65, 0x20, 0x44, 0x72, 0x61, 0x77, 0x20, 0x43,
+                0x61, 0x6c, 0x6c, 0xd8, 0x0f, 0x02, 0x0f, 0xbf, 0x01, 0x00, 0x0a, 0x54, 0xa4, 0x0f, 0x8a, 0x0b, 0x10, 0x0d, 0x7c, 0x00,
+                0x0a, 0x42, 0x00, 0x07, 0x85, 0x0b, 0x0f, 0xbf, 0x01, 0x25, 0x0f, 0xbb, 0x0b, 0x33, 0x0f, 0xb6, 0x0b, 0x17, 0x0f, 0x3e,
+                0x00, 0x0d, 0x40, 0x22, 0x48, 0x57, 0x20, 0xe1, 0x00, 0x02, 0x78, 0x21, 0x70, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x65, 0x78,
+                0x75, 0xa0, 0x43, 0x20, 0x41, 0x50, 0x49, 0x1a, 0x00, 0x00, 0x72, 0x01, 0x11, 0x2c, 0xca, 0x01, 0x00, 0x1f, 0x00, 0x72,
+                0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0xa2, 0x22, 0x0f, 0xcb, 0x01, 0x06, 0x0c, 0x87, 0x03, 0x0b, 0xcb, 0x01, 0x04,
+                0x13, 0x02, 0x13, 0x44, 0xa2, 0x99, 0x19, 0x65, 0xd3, 0x01, 0x0f, 0x8a, 0x03, 0x04, 0x0a, 0x96, 0xa5, 0x0f, 0xcf, 0x01,
+                0x1a, 0x03, 0x8a, 0x03, 0x0a, 0x42, 0x00, 0x0f, 0xcf, 0x01, 0x2a, 0x0f, 0xcb, 0x01, 0x84, 0x03, 0xe1, 0x00, 0x0f, 0xcf,
+                0x01, 0x04, 0x05, 0x6e, 0x01, 0x0f, 0xb7, 0x01, 0x05, 0x10, 0x53, 0x67, 0x94, 0x0a, 0x5f, 0x03, 0xf1, 0x00, 0x2c, 0x20,
+                0x27, 0x57, 0x61, 0x69, 0x74, 0x20, 0x46, 0x6f, 0x72, 0x20, 0x49, 0x64, 0x6c, 0xbc, 0x01, 0x4e, 0x6d, 0x61, 0x6e, 0x64,
+                0x85, 0x03, 0x0f, 0x82, 0x03, 0x04, 0x0f, 0xc7, 0xa7, 0x0f, 0x0f, 0xcb, 0x01, 0x06, 0x03, 0x82, 0x03, 0x0f, 0x42, 0x00,
+                0x0f, 0x0f, 0xcb, 0x01, 0x16, 0x0f, 0xb7, 0x01, 0x80, 0x00, 0x5e, 0x01, 0x50, 0x2d, 0x66, 0x6f, 0x72, 0x2d, 0xc9, 0x00,
+                0x00, 0x9e, 0x45, 0x01, 0x5e, 0x01, 0x11, 0x20, 0xf2, 0x95, 0x01, 0x86, 0x1f, 0x00, 0x66, 0x16, 0x10, 0x46, 0x3f, 0xa7,
+                0xb1, 0x20, 0x45, 0x6e, 0x64, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0xc7, 0x45, 0x01, 0x29, 0x00, 0x0f, 0xcb, 0x01,
+                0x1b, 0x10, 0x50, 0x1c, 0xa5, 0x21, 0x20, 0x53, 0xf1, 0x95, 0x23, 0x20, 0x42, 0x2d, 0xa9, 0x0e, 0xc0, 0x00, 0x0f, 0xcb,
+                0x01, 0x04, 0x0f, 0x6b, 0xa9, 0x02, 0x0f, 0x89, 0x03, 0x13, 0x03, 0xcb, 0x01, 0x0f, 0x42, 0x00, 0x02, 0x0f, 0x89, 0x03,
+                0x23, 0x0f, 0xcb, 0x01, 0x80, 0x02, 0x5e, 0x01, 0x02, 0xde, 0x00, 0x00, 0xe2, 0x31, 0x01, 0xde, 0x00, 0x07, 0xca, 0x01,
+                0x50, 0x50, 0x52, 0x4f, 0x50, 0x20, 0xfa, 0x3d, 0x05, 0xc6, 0x01, 0x06, 0x62, 0x05, 0x0f, 0xc8, 0x01, 0x06, 0x01, 0x4e,
+                0x00, 0x0c, 0xc8, 0x01, 0x23, 0x53, 0x4d, 0xcd, 0x08, 0x21, 0x20, 0x43, 0xa9, 0x07, 0x0f, 0xd4, 0x08, 0x17, 0x0d, 0x2b,
+                0xa6, 0x0f, 0xd4, 0x08, 0x1e, 0x0d, 0x42, 0x00, 0x0f, 0xd4, 0x08, 0x3c, 0x0e, 0xa2, 0x00, 0x0f, 0xd4, 0x08, 0x30, 0x0f,
+                0x55, 0x00, 0x17, 0x70, 0x2c, 0x20, 0x22, 0x49, 0x6e, 0x64, 0x69, 0x73, 0x0b, 0x63, 0x73, 0x20, 0x77, 0x68, 0x65, 0x6e,
+                0xd1, 0x01, 0xef, 0x73, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x72, 0x75, 0x6e, 0x6e, 0x69, 0x6e, 0x67, 0xaf, 0x01, 0x2b,
+                0x3f, 0x20, 0x2d, 0x20, 0xed, 0x08, 0x00, 0x0f, 0xaf, 0x01, 0x01, 0x0f, 0x5e, 0x9e, 0x09, 0x0f, 0xba, 0x01, 0x10, 0x2f,
+                0x2c, 0x20, 0x42, 0x00, 0x0a, 0x0f, 0xba, 0x01, 0x20, 0x0d, 0xaf, 0x01, 0x0f, 0xa2, 0x00, 0x0a, 0x0f, 0xba, 0x01, 0x11,
+                0x0f, 0xaf, 0x01, 0x01, 0x0f, 0x55, 0x00, 0x17, 0x0e, 0xaf, 0x01, 0x2f, 0x33, 0x44, 0xb2, 0x01, 0x03, 0xf0, 0x02, 0x20,
+                0x20, 0x4d, 0x61, 0x79, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x6c, 0x61, 0x70, 0x20, 0x77, 0x69, 0x74, 0x27, 0x07, 0x01, 0x88,
+                0x08, 0x0f, 0xcd, 0x01, 0x2e, 0x0f, 0xef, 0x08, 0x00, 0x0f, 0x7c, 0x03, 0x12, 0x06, 0xb3, 0x9b, 0x0f, 0x86, 0x03, 0x11,
+                0x0f, 0x7c, 0x03, 0x01, 0x06, 0x42, 0x00, 0x0f, 0x86, 0x03, 0x21, 0x0f, 0x7c, 0x03, 0x0f, 0x07, 0xa2, 0x00, 0x0f, 0x6a,
+                0x09, 0x14, 0x0f, 0x7c, 0x03, 0x10, 0x0f, 0x55, 0x00, 0x06, 0x0e, 0xcd, 0x01, 0x03, 0xa2, 0x01, 0x0f, 0xd2, 0x01, 0x16,
+                0x2f, 0x33, 0x44, 0xcd, 0x01, 0x1e, 0x16, 0x49, 0x4c, 0x23, 0x20, 0x20, 0x49, 0x09, 0xa2, 0x0f, 0x54, 0x05, 0x00, 0x0f,
+                0xcd, 0x01, 0x04, 0x08, 0xe3, 0xa9, 0x0f, 0x48, 0x05, 0x1b, 0x04, 0xcd, 0x01, 0x08, 0x42, 0x00, 0x0f, 0x48, 0x05, 0x2b,
+                0x0f, 0xcd, 0x01, 0x03, 0x09, 0xa2, 0x00, 0x0f, 0x48, 0x05, 0x1c, 0x0f, 0xcd, 0x01, 0x06, 0x0f, 0x55, 0x00, 0x13, 0x09,
+                0xcd, 0x01, 0x11, 0x68, 0x7b, 0x13, 0xa1, 0x74, 0x65, 0x6e, 0x20, 0x61, 0x6e, 0x20, 0x53, 0x4d, 0x20, 0x43, 0x00, 0x18,
+                0x64, 0xc8, 0x24, 0x20, 0x73, 0x2c, 0xec, 0x28, 0x03, 0x0d, 0x62, 0x0f, 0xc5, 0x01, 0x1b, 0xfd, 0x07, 0x57, 0x61, 0x72,
+                0x70, 0x20, 0x4f, 0x63, 0x63, 0x75, 0x70, 0x61, 0x6e, 0x63, 0x79, 0x20, 0x28, 0x70, 0x65, 0x72, 0x20, 0x53, 0x4d, 0x68,
+                0x1d, 0x0f, 0xc5, 0x01, 0x04, 0x08, 0x0c, 0x9f, 0x08, 0xaa, 0x14, 0x01, 0xb3, 0x02, 0x06, 0x4a, 0x3c, 0x0f, 0xc5, 0x01,
+                0x08, 0x08, 0x42, 0x00, 0x05, 0xa5, 0x14, 0x0a, 0x3f, 0x00, 0x0f, 0xc5, 0x01, 0x2a, 0x09, 0xa2, 0x00, 0x0f, 0xc5, 0x01,
+                0x35, 0x0f, 0x55, 0x00, 0x13, 0x60, 0x2c, 0x20, 0x22, 0x52, 0x65, 0x73, 0x92, 0x50, 0x21, 0x74, 0x20, 0x32, 0x00, 0x12,
+                0x20, 0x5d, 0x01, 0x09, 0xad, 0x01, 0x30, 0x20, 0x20, 0x4c, 0xdf, 0x01, 0x05, 0x81, 0x01, 0xe0, 0x69, 0x73, 0x20, 0x6f,
+                0x6e, 0x6c, 0x79, 0x20, 0x61, 0x20, 0x70, 0x72, 0x6f, 0x62, 0x3b, 0x25, 0x01, 0xcc, 0x03, 0x02, 0x5d, 0x03, 0x02, 0x3c,
+                0x05, 0x10, 0x25, 0x25, 0x00, 0x31, 0x6c, 0x6f, 0x77, 0xe9, 0x01, 0x0f, 0xb8, 0x15, 0x07, 0x03, 0xf2, 0x11, 0x00, 0xc1,
+                0x29, 0x00, 0x1a, 0x2a, 0x04, 0x0c, 0x00, 0x0d, 0xa1, 0x29, 0x02, 0x18, 0x00, 0x0c, 0x55, 0x48, 0x04, 0xf4, 0x15, 0x01,
+                0xdd, 0x29, 0x05, 0x9b, 0x29, 0x08, 0x67, 0x12, 0x0f, 0xf9, 0x15, 0x20, 0x05, 0x57, 0x00, 0x03, 0xb0, 0x2a, 0x0f, 0xf3,
+                0x2a, 0x07, 0x00, 0x0f, 0x00, 0x41, 0x29, 0x20, 0x3d, 0x3e, 0xbc, 0x14, 0x04, 0xc3, 0x13, 0x09, 0x4c, 0x00, 0x01, 0x0f,
+                0x46, 0x02, 0x4a, 0x00, 0x0c, 0x03, 0x14, 0x0f, 0x87, 0x32, 0x00, 0x13, 0x27, 0x2b, 0x00, 0x23, 0x27, 0x3a, 0x09, 0x00,
+                0x31, 0x2c, 0x20, 0x27, 0x9d, 0x14, 0x27, 0x27, 0x3a, 0x7a, 0x16, 0x12, 0x7d, 0x2c, 0x15, 0x0f, 0x70, 0x00, 0x02, 0x08,
+                0x53, 0x2a, 0x0f, 0xc1, 0x16, 0x44, 0x00, 0x56, 0x3a, 0x05, 0x81, 0x1f, 0x0f, 0x18, 0x16, 0x1d, 0x08, 0x80, 0x14, 0x0f,
+                0x19, 0x16, 0x15, 0x07, 0x97, 0x3c, 0x00, 0x43, 0x00, 0x00, 0xa6, 0x3b, 0x0f, 0x76, 0x00, 0x1c, 0x06, 0xae, 0x14, 0x0f,
+                0x74, 0x00, 0x10, 0x21, 0x6c, 0x61, 0x94, 0x06, 0x10, 0x22, 0x4e, 0x27, 0x05, 0x5c, 0x3f, 0x03, 0x46, 0x00, 0x60, 0x2c,
+                0x20, 0x27, 0xe2, 0x96, 0x88, 0x89, 0x25, 0x0f, 0x80, 0x00, 0x4a, 0x09, 0xa2, 0x01, 0x07, 0x40, 0x15, 0x09, 0x77, 0x00,
+                0x4a, 0x3d, 0x74, 0x72, 0x75, 0xbb, 0x01, 0x0f, 0x28, 0x17, 0x31, 0x0f, 0x65, 0x30, 0x0a, 0x0f, 0x29, 0x17, 0x26, 0x0f,
+                0x98, 0x28, 0x09, 0x0f, 0x06, 0x17, 0x51, 0x0f, 0x94, 0x28, 0x17, 0x04, 0x0b, 0x00, 0x01, 0x69, 0x2a, 0x06, 0x0c, 0x01,
+                0x0f, 0x91, 0x16, 0x05, 0x0f, 0xaf, 0x06, 0x03, 0xd7, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x23, 0x53,
+                0x4d, 0x2d, 0x7e, 0x08, 0x16, 0x2d, 0x5e, 0x01, 0x63, 0x22, 0x3e, 0x53, 0x4d, 0x20, 0x28, 0xa8, 0x0f, 0xaf, 0x43, 0x6f,
+                0x72, 0x65, 0x73, 0x29, 0x3c, 0x2f, 0x61, 0x3e, 0x47, 0x06, 0x02, 0x01, 0xe1, 0x05, 0x0a, 0xb8, 0x43, 0x01, 0xe1, 0x05,
+                0x06, 0xa0, 0x00, 0x0f, 0x5a, 0x11, 0x01, 0x0f, 0xff, 0x42, 0x01, 0x0f, 0x37, 0x00, 0x0b, 0x0f, 0x8d, 0x1c, 0x09, 0x0f,
+                0xe3, 0x00, 0x07, 0x59, 0x4c, 0x31, 0x54, 0x45, 0x58, 0xda, 0x00, 0x01, 0x12, 0x00, 0x02, 0x15, 0x25, 0x0f, 0xd4, 0x00,
+                0x06, 0x0f, 0xe3, 0x00, 0x10, 0x0d, 0xad, 0x68, 0x0d, 0x4c, 0x0a, 0x0f, 0xe3, 0x00, 0x02, 0x0f, 0x37, 0x00, 0x0a, 0x0f,
+                0xe3, 0x00, 0x24, 0x31, 0x32, 0x2d, 0x53, 0x94, 0x6a, 0xc2, 0x2d, 0x54, 0x72, 0x61, 0x66, 0x66, 0x69, 0x63, 0x2d, 0x42,
+                0x79, 0x2d, 0x35, 0x00, 0x23, 0x2d, 0x41, 0x06, 0x6b, 0x20, 0x2d, 0x53, 0xca, 0xac, 0x24, 0x22, 0x3e, 0x0f, 0x26, 0x0d,
+                0xfa, 0x00, 0x0f, 0xe3, 0x00, 0x02, 0x0a, 0x7e, 0x69, 0x0d, 0xc7, 0x01, 0x0f, 0xe3, 0x00, 0x05, 0x0f, 0x37, 0x00, 0x09,
+                0x0f, 0xe3, 0x00, 0x23, 0x44, 0x4d, 0x61, 0x69, 0x6e, 0xd3, 0x00, 0x08, 0xcc, 0x01, 0x4f, 0x44, 0x52, 0x41, 0x4d, 0xc5,
+                0x01, 0x15, 0x0f, 0xe3, 0x00, 0x02, 0x0c, 0x79, 0x6b, 0x0c, 0xe4, 0x00, 0x0f, 0xe3, 0x00, 0x04, 0x0f, 0x37, 0x00, 0x0a,
+                0x0f, 0xe3, 0x00, 0x3b, 0x3f, 0x50, 0x43, 0x49, 0xa8, 0x02, 0x16, 0x0f, 0xe3, 0x00, 0x02, 0x0c, 0x34, 0x6b, 0x0f, 0xe3,
+                0x00, 0x14, 0x0f, 0x37, 0x00, 0x0a, 0x0f, 0xe3, 0x00, 0x03, 0x99, 0x57, 0x6f, 0x72, 0x6c, 0x64, 0x20, 0x50, 0x69, 0x70,
+                0x00, 0x1b, 0x06, 0xe3, 0x00, 0x50, 0x50, 0x72, 0x69, 0x6d, 0x69, 0x7e, 0x09, 0x70, 0x2d, 0x44, 0x61, 0x74, 0x61, 0x2d,
+                0x46, 0x66, 0x30, 0xff, 0x01, 0x3e, 0x50, 0x44, 0x41, 0x20, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x46, 0x65, 0x74, 0x63,
+                0x68, 0xeb, 0x00, 0x0e, 0x0f, 0xe3, 0x00, 0x02, 0x0a, 0x06, 0x6c, 0x0f, 0xa9, 0x02, 0x15, 0x0f, 0x37, 0x00, 0x0a, 0x0f,
+                0xe3, 0x00, 0x38, 0x70, 0x56, 0x65, 0x72, 0x74, 0x65, 0x78, 0x20, 0x4c, 0x09, 0x1f, 0x2e, 0xe6, 0x00, 0x11, 0x0f, 0xe3,
+                0x00, 0x01, 0x0b, 0x83, 0x6c, 0x0f, 0xe3, 0x00, 0x15, 0x0f, 0x37, 0x00, 0x0a, 0x0f, 0xc6, 0x01, 0x39, 0x04, 0x15, 0x00,
+                0x03, 0x8a, 0x1b, 0x0f, 0xc7, 0x01, 0x0d, 0x0f, 0xc6, 0x01, 0x02, 0x0a, 0xbc, 0x6d, 0x0f, 0xc6, 0x01, 0x16, 0x0f, 0x37,
+                0x00, 0x09, 0x0f, 0xc7, 0x0d, 0x04, 0x10, 0x63, 0xd8, 0x6a, 0x09, 0xe4, 0x00, 0x09, 0xe3, 0x00, 0x11, 0x52, 0x25, 0x6e,
+                0x08, 0xe0, 0x00, 0x6f, 0x52, 0x41, 0x53, 0x54, 0x45, 0x52, 0x88, 0x03, 0x16, 0x0f, 0xe3, 0x00, 0x05, 0x0e, 0x7e, 0x6e,
+                0x0c, 0x4e, 0x12, 0x0f, 0xe3, 0x00, 0x02, 0x0f, 0x37, 0x00, 0x0a, 0x0f, 0xe3, 0x00, 0x35, 0x01, 0x1e, 0x16, 0x8f, 0x28,
+                0x50, 0x72, 0x65, 0x2d, 0x52, 0x4f, 0x50, 0xef, 0x07, 0x07, 0x0f, 0xc6, 0x01, 0x0e, 0x0b, 0x1c, 0x6f, 0x0f, 0x6f, 0x04,
+                0x15, 0x0f, 0x37, 0x00, 0x09, 0x0f, 0xe3, 0x00, 0x35, 0x11, 0x5a, 0xe3, 0x00, 0xaf, 0x44, 0x65, 0x70, 0x74, 0x68, 0x2d,
+                0x54, 0x65, 0x73, 0x74, 0xe6, 0x00, 0x10, 0x0f, 0xe3, 0x00, 0x01, 0x0c, 0xff, 0x6f, 0x0f, 0xe3, 0x00, 0x14, 0x0f, 0x37,
+                0x00, 0x0a, 0x0f, 0xe3, 0x00, 0x35, 0x11, 0x43, 0xe3, 0x00, 0x10, 0x43, 0x5a, 0x66, 0x6f, 0x20, 0x42, 0x6c, 0x65, 0x6e,
+                0x64, 0xe4, 0x00, 0x0f, 0x0f, 0xe3, 0x00, 0x01, 0x0c, 0xb8, 0x72, 0x0f, 0xe3, 0x00, 0x14, 0x0f, 0x37, 0x00, 0x0a, 0x0f,
+                0x53, 0x11, 0x19, 0x08, 0xe3, 0x00, 0x31, 0x79, 0x74, 0x72, 0xf1, 0x34, 0x20, 0x2d, 0x42, 0xa5, 0x38, 0x80, 0x64, 0x6f,
+                0x77, 0x6e, 0x22, 0x3e, 0x52, 0x54, 0x96, 0x0a, 0x0f, 0x18, 0x07, 0x2a, 0x0e, 0xf7, 0x71, 0x0f, 0x8c, 0x03, 0x13, 0x0f,
+                0x37, 0x00, 0x09, 0x0b, 0x4d, 0x10, 0x06, 0xe6, 0x0b, 0x05, 0xab, 0x0b, 0x02, 0x73, 0x3c, 0x00, 0x31, 0x5f, 0x02, 0x3c,
+                0x2e, 0x01, 0x08, 0x00, 0x01, 0xa6, 0x0f, 0x0b, 0x19, 0x61, 0x02, 0x1a, 0x00, 0x04, 0x49, 0x2e, 0x02, 0x30, 0x00, 0x03,
+                0xd6, 0x0e, 0x02, 0x9d, 0x4c, 0x00, 0x49, 0x00, 0x00, 0x60, 0x45, 0x00, 0x82, 0x0d, 0x20, 0x65, 0x6e, 0x6e, 0x69, 0x11,
+                0x20, 0x92, 0x69, 0x0f, 0x7b, 0x26, 0x09, 0x07, 0x89, 0x00, 0x0f, 0x82, 0x26, 0x53, 0x0f, 0x07, 0x10, 0x02, 0x0f, 0xb2,
+                0x2f, 0x23, 0x01, 0x52, 0x0e, 0x0f, 0xaf, 0x2f, 0x30, 0x0f, 0xb7, 0x0f, 0x02, 0x0f, 0x2f, 0x10, 0x00, 0x1f, 0x3d, 0x20,
+                0x30, 0x35, 0x0f, 0xb4, 0x0f, 0x07, 0x03, 0xdd, 0x01, 0x0f, 0xb6, 0x0f, 0x00, 0x0f, 0x7d, 0x00, 0x22, 0x0f, 0x62, 0x0f,
+                0x2e, 0x01, 0x1b, 0x0c, 0x20, 0x48, 0x69, 0xd8, 0x55, 0x1f, 0x65, 0x61, 0x0f, 0x32, 0x12, 0x68, 0x4c, 0x00, 0x5f, 0x54,
+                0x6f, 0x74, 0x61, 0x6c, 0x68, 0x0f, 0x4f, 0x08, 0x6e, 0x00, 0x29, 0x20, 0x3d, 0x7d, 0x00, 0x0f, 0x76, 0x0f, 0x36, 0x0f,
+                0x00, 0x26, 0x09, 0x01, 0xc7, 0x0a, 0x10, 0x65, 0x72, 0x24, 0x01, 0xb6, 0x47, 0x1f, 0x74, 0x17, 0x1d, 0x04, 0x63, 0x2c,
+                0x20, 0x27, 0x49, 0x44, 0x43, 0x97, 0x33, 0x40, 0x48, 0x69, 0x74, 0x2d, 0xa6, 0x00, 0x2f, 0x20, 0x25, 0xa8, 0x34, 0x02,
+                0x08, 0x2b, 0x58, 0x1f, 0x27, 0x45, 0xb4, 0x02, 0x0f, 0x9a, 0x05, 0x02, 0x08, 0x99, 0x57, 0x0f, 0x37, 0x00, 0x05, 0x0f,
+                0x04, 0x2d, 0x04, 0x00, 0xac, 0x4a, 0x31, 0x2c, 0x20, 0x47, 0x13, 0x70, 0x32, 0x2c, 0x20, 0x54, 0xf9, 0xab, 0x32, 0x2c,
+                0x20, 0x53, 0x4a, 0xad, 0x07, 0x86, 0x06, 0x07, 0x48, 0x0f, 0x0f, 0xc6, 0x00, 0x09, 0x0b, 0xc4, 0x00, 0x0f, 0x30, 0xac,
+                0x05, 0x09, 0xc7, 0x00, 0x0e, 0xc4, 0x00, 0x0f, 0x37, 0x00, 0x07, 0x0f, 0xc7, 0x00, 0x03, 0x32, 0x41, 0x6c, 0x6c, 0x9b,
+                0x00, 0x2f, 0x64, 0x20, 0x79, 0x0d, 0x00, 0x08, 0x8b, 0x01, 0x05, 0x21, 0x35, 0x0f, 0x8a, 0x01, 0x0a, 0x0d, 0xc7, 0x00,
+                0x0f, 0x0c, 0x7a, 0x02, 0x0f, 0x03, 0x10, 0x01, 0x0a, 0xc7, 0x00, 0x0f, 0x37, 0x00, 0x04, 0x0f, 0x3d, 0x2c, 0x81, 0x0f,
+                0xbb, 0x05, 0x39, 0x0f, 0x4b, 0x05, 0x36, 0x0f, 0xbc, 0x05, 0x01, 0x08, 0xe8, 0x03, 0x0f, 0xc3, 0x05, 0x5e, 0x0a, 0xe2,
+                0x04, 0x0f, 0xca, 0x05, 0x76, 0x00, 0x4e, 0x10, 0x02, 0xf9, 0x02, 0x0f, 0xf4, 0x35, 0x27, 0x03, 0xcd, 0x48, 0x00, 0x9b,
+                0x39, 0x0d, 0x3f, 0x2c, 0x0f, 0xd6, 0x35, 0x1b, 0x07, 0x87, 0x61, 0x01, 0xe9, 0x39, 0x00, 0x3d, 0x5a, 0x09, 0x2e, 0x6f,
+                0x0e, 0x91, 0x42, 0x01, 0x51, 0x00, 0x01, 0x3c, 0xbe, 0x03, 0xf7, 0x6e, 0x08, 0x30, 0x00, 0x0a, 0x5e, 0x00, 0x08, 0x2d,
+                0x00, 0x06, 0x04, 0x2c, 0x0a, 0x2f, 0x61, 0x05, 0x26, 0x00, 0x21, 0x6d, 0x69, 0x28, 0x00, 0x6f, 0x50, 0x65, 0x72, 0x53,
+                0x65, 0x63, 0x5b, 0x00, 0x15, 0x09, 0x35, 0x00, 0x0f, 0x63, 0x00, 0x07, 0x0f, 0x8d, 0x4c, 0x02, 0x0b, 0xcb, 0x00, 0x0c,
+                0x03, 0x1c, 0x09, 0x65, 0x01, 0x02, 0xc9, 0x24, 0x0f, 0xde, 0x00, 0x11, 0x08, 0x4e, 0x01, 0x00, 0xa5, 0x57, 0x00, 0x39,
+                0x00, 0x0f, 0xf0, 0x00, 0x12, 0x0f, 0x80, 0x00, 0x0e, 0x0a, 0x26, 0x31, 0x00, 0xe0, 0x30, 0x23, 0x32, 0x34, 0x07, 0x00,
+                0x0f, 0x1c, 0x01, 0x19, 0x0f, 0xa1, 0x00, 0x00, 0x0c, 0x64, 0x32, 0x05, 0x58, 0x00, 0x0c, 0x47, 0x01, 0x0f, 0xfa, 0x2d,
+                0x3e, 0x0f, 0xa8, 0x44, 0x01, 0x08, 0xcd, 0x07, 0x07, 0xab, 0x0b, 0x01, 0xd9, 0x1b, 0x01, 0x47, 0x48, 0x06, 0xf0, 0x3d,
+                0x41, 0x52, 0x41, 0x4d, 0x20, 0xe1, 0x03, 0x0f, 0xa3, 0x07, 0x02, 0x0a, 0xca, 0x02, 0x0f, 0x7a, 0x0c, 0x11, 0x0f, 0x75,
+                0x14, 0x41, 0x0f, 0x01, 0x00, 0x01, 0x08, 0x54, 0x04, 0x0f, 0xd8, 0x00, 0x05, 0x10, 0x52, 0x4d, 0xc7, 0x0f, 0xd8, 0x00,
+                0x3a, 0x0b, 0xdc, 0x80, 0x07, 0xa6, 0x00, 0x0f, 0xd8, 0x00, 0x0a, 0x0f, 0x37, 0x00, 0x07, 0x0f, 0xd8, 0x00, 0x22, 0x10,
+                0x57, 0x3b, 0x81, 0x0f, 0x5b, 0x28, 0x02, 0x0f, 0xd8, 0x00, 0x25, 0x0c, 0x8d, 0x81, 0x06, 0xa2, 0x00, 0x0f, 0xd8, 0x00,
+                0x0a, 0x0f, 0x37, 0x00, 0x07, 0x0f, 0xd8, 0x00, 0x1d, 0x00, 0x0a, 0x16, 0x0f, 0xb0, 0x01, 0x09, 0x0c, 0x0a, 0xd0, 0x0f,
+                0x0f, 0x24, 0x06, 0x07, 0x17, 0x16, 0x07, 0x2e, 0x00, 0x0e, 0x98, 0x00, 0x0f, 0xbb, 0x1f, 0x01, 0x0f, 0x37, 0x00, 0x10,
+                0x0f, 0xd8, 0x00, 0x22, 0x0f, 0xb0, 0x01, 0x08, 0x0d, 0xd1, 0xd0, 0x0f, 0x1a, 0x23, 0x05, 0x07, 0xd8, 0x00, 0x08, 0x2e,
+                0x00, 0x0f, 0x7e, 0x1a, 0x03, 0x0f, 0xd8, 0x00, 0x02, 0x0f, 0x37, 0x00, 0x0a, 0x0f, 0xd8, 0x00, 0x02, 0x0f, 0xe8, 0x35,
+                0xac, 0x01, 0xeb, 0x00, 0x0f, 0xb1, 0x08, 0x1b, 0x08, 0x8a, 0x06, 0x0f, 0xb2, 0x09, 0x1c, 0x04, 0x9d, 0x1f, 0x09, 0x34,
+                0x06, 0x0f, 0x7e, 0x00, 0x1b, 0x0f, 0x6f, 0x06, 0x01, 0x0f, 0xab, 0x1f, 0x35, 0x0f, 0x7c, 0x00, 0x0d, 0x0f, 0xa9, 0x1f,
+                0x4b, 0x0f, 0x7e, 0x00, 0x25, 0x0f, 0x2c, 0x0a, 0x2e, 0x22, 0x4c, 0x32, 0x3f, 0x1c, 0x03, 0x3e, 0x1c, 0x05, 0x66, 0x13,
+                0x22, 0x42, 0x79, 0x42, 0x0a, 0x04, 0x44, 0x1c, 0x01, 0x43, 0x1c, 0x0f, 0x4f, 0x0a, 0x05, 0x3a, 0x4e, 0x6f, 0x64, 0xfa,
+                0x08, 0x08, 0x50, 0x0a, 0x62, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2c, 0x9d, 0x51, 0x10, 0x41, 0x9b, 0x48, 0x20, 0x64, 0x73,
+                0x0c, 0x60, 0x5f, 0x69, 0x6c, 0x64, 0x72, 0x65, 0x7d, 0x36, 0x03, 0x01, 0x32, 0x00, 0x00, 0x02, 0x46, 0x00, 0x08, 0x00,
+                0x0f, 0xf5, 0x07, 0x00, 0x08, 0x4b, 0x00, 0x04, 0x6b, 0x68, 0x03, 0x0f, 0x00, 0x0f, 0x2e, 0x00, 0x00, 0x04, 0x6b, 0x00,
+                0x00, 0x98, 0x08, 0x03, 0x0b, 0x00, 0x0f, 0x26, 0x00, 0x00, 0x02, 0x96, 0x0d, 0x00, 0xa0, 0x5f, 0x07, 0x01, 0x00, 0x00,
+                0xb9, 0x63, 0x0b, 0x70, 0x00, 0xc9, 0x2e, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x28, 0x28, 0x61, 0x63, 0x63, 0xd5, 0x00,
+                0x01, 0xc7, 0x13, 0x59, 0x61, 0x63, 0x63, 0x20, 0x2b, 0x2d, 0x0e, 0x08, 0x22, 0x00, 0x00, 0x61, 0x60, 0x0f, 0x7b, 0x00,
+                0x09, 0x04, 0xca, 0x08, 0x0f, 0x7b, 0x00, 0x05, 0x38, 0x6d, 0x61, 0x70, 0x50, 0x00, 0x01, 0xde, 0x23, 0x07, 0x0f, 0x00,
+                0x04, 0xf4, 0x66, 0x70, 0x29, 0x2e, 0x6a, 0x6f, 0x69, 0x6e, 0x28, 0xe3, 0x4c, 0x0c, 0x50, 0x0a, 0x07, 0x70, 0x00, 0x20,
+                0x48, 0x69, 0xac, 0x06, 0x0f, 0xeb, 0x00, 0x44, 0x00, 0x7b, 0x00, 0x07, 0x3e, 0x89, 0x00, 0xed, 0x02, 0x0f, 0xfb, 0x00,
+                0x08, 0x02, 0x8b, 0x00, 0x05, 0xfe, 0x00, 0x0f, 0xfb, 0x00, 0x23, 0x07, 0x6f, 0x00, 0x0f, 0x06, 0x01, 0x0d, 0x02, 0x0f,
+                0x66, 0x0c, 0x63, 0x00, 0x02, 0xd1, 0x25, 0x20, 0x20, 0x3e, 0xe6, 0x5b, 0x0f, 0xc6, 0x0b, 0x02, 0x0d, 0xa8, 0x01, 0x31,
+                0x3d, 0x20, 0x27, 0x60, 0x00, 0x0f, 0x1e, 0x00, 0x03, 0x00, 0x78, 0x00, 0x0f, 0x97, 0x0b, 0x03, 0x0f, 0xf6, 0x00, 0x01,
+                0x0f, 0x4c, 0x00, 0x00, 0x0a, 0x21, 0x00, 0x0f, 0x4f, 0x00, 0x00, 0x0f, 0x2c, 0x0b, 0x00, 0x06, 0x1b, 0x26, 0x05, 0xda,
+                0x62, 0x23, 0x31, 0x2c, 0xee, 0x00, 0x06, 0xe3, 0x02, 0x00, 0x1d, 0x78, 0x23, 0x2e, 0x30, 0xae, 0x75, 0x04, 0x15, 0x03,
+                0x0a, 0xef, 0x01, 0x01, 0x16, 0x00, 0x07, 0xe9, 0x01, 0x01, 0x10, 0x00, 0x04, 0x5f, 0x00, 0x00, 0xce, 0x01, 0x0a, 0x88,
+                0x04, 0x05, 0x5f, 0x39, 0x11, 0x70, 0xfa, 0x62, 0x0f, 0x54, 0x00, 0x0d, 0x05, 0x9d, 0x00, 0x06, 0x18, 0x00, 0x02, 0x3c,
+                0x00, 0x01, 0x29, 0x02, 0x2b, 0x20, 0x2b, 0x92, 0x76, 0x0f, 0xc2, 0x0b, 0x04, 0x13, 0x74, 0x3c, 0x3b, 0x00, 0x7f, 0x04,
+                0x0f, 0x98, 0x13, 0x01, 0x00, 0x18, 0x00, 0x02, 0x12, 0x0a, 0x42, 0x27, 0x2c, 0x20, 0x5b, 0x80, 0x11, 0x0f, 0xdc, 0xbc,
+                0x0d, 0x59, 0x27, 0x2c, 0x20, 0x5d, 0x2c, 0x4a, 0x00, 0x08, 0x4c, 0x00, 0x02, 0x81, 0x09, 0x0f, 0x4d, 0x00, 0x16, 0x04,
+                0xfa, 0x8c, 0x03, 0x55, 0x00, 0x19, 0x5d, 0xaf, 0x12, 0x08, 0x58, 0x00, 0x03, 0x01, 0x09, 0x0f, 0x59, 0x00, 0x1a, 0x01,
+                0xaf, 0x08, 0x0f, 0x5a, 0x00, 0x0e, 0x51, 0x41, 0x74, 0x6f, 0x6d, 0x69, 0xe3, 0x2d, 0x0f, 0x5b, 0x00, 0x18, 0x00, 0x4b,
+                0x93, 0x0f, 0x5a, 0x00, 0x0e, 0x10, 0x52, 0xdb, 0x01, 0x01, 0x3d, 0x2b, 0x0f, 0x11, 0x01, 0x1d, 0x0f, 0x10, 0x01, 0x03,
+                0x0a, 0x0e, 0x00, 0x06, 0x68, 0x00, 0x64, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0xca, 0x13, 0x0f, 0x6b, 0x00, 0x10, 0x02,
+                0xf4, 0x8d, 0x0f, 0xc9, 0x01, 0x34, 0x0a, 0xc3, 0x8e, 0x0f, 0xc9, 0x01, 0x38, 0x0b, 0x9a, 0x8e, 0x0f, 0xc9, 0x01, 0x39,
+                0x0a, 0x14, 0x95, 0x0f, 0xc9, 0x01, 0x3c, 0x09, 0x74, 0x94, 0x0f, 0xc9, 0x01, 0x1a, 0x4f, 0x50, 0x65, 0x65, 0x72, 0xc7,
+                0x01, 0x18, 0x00, 0x2e, 0x91, 0x0f, 0xc5, 0x01, 0x34, 0x08, 0xf7, 0x91, 0x0f, 0xc3, 0x01, 0x38, 0x09, 0xd0, 0x91, 0x0f,
+                0xc1, 0x01, 0x39, 0x08, 0x32, 0x99, 0x0f, 0xbf, 0x01, 0x3c, 0x07, 0x98, 0x98, 0x0f, 0xbd, 0x01, 0x06, 0x0f, 0xc6, 0x1c,
+                0x01, 0x07, 0xbb, 0x6a, 0x20, 0x6e, 0x65, 0xb8, 0x16, 0x10, 0x54, 0x42, 0x0f, 0x82, 0x52, 0x65, 0x63, 0x75, 0x72, 0x73,
+                0x69, 0x76, 0xf9, 0x0a, 0x10, 0x5f, 0x52, 0x63, 0x20, 0x2c, 0x20, 0xfc, 0xac, 0x0b, 0xfc, 0x0c, 0x01, 0xae, 0x05, 0x02,
+                0xfc, 0x0c, 0x05, 0x29, 0x00, 0x08, 0xe2, 0x05, 0x0a, 0x0e, 0x57, 0x13, 0x30, 0x09, 0x57, 0x01, 0x49, 0x00, 0x0f, 0x0a,
+                0x57, 0x0e, 0x4c, 0x69, 0x69, 0x20, 0x3e, 0xec, 0x7e, 0x01, 0x91, 0x06, 0x0f, 0x6c, 0x0d, 0x1b, 0x0f, 0x4e, 0x0b, 0x12,
+                0x0e, 0x76, 0x07, 0x00, 0xb5, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x4e, 0x14, 0x00, 0xaf, 0x00, 0x00, 0x63, 0x57, 0x0a, 0x30,
+                0x00, 0x00, 0x22, 0x00, 0x03, 0x29, 0x16, 0x00, 0xca, 0x55, 0x03, 0x5d, 0x51, 0x00, 0x2d, 0x00, 0x09, 0xe8, 0x07, 0x02,
+                0x38, 0x01, 0x06, 0xa5, 0x07, 0x0f, 0xb2, 0x6d, 0x00, 0x09, 0x4c, 0x00, 0x06, 0x39, 0x08, 0x0d, 0x4b, 0x00, 0x06, 0x33,
+                0x08, 0x40, 0x22, 0x20, 0x2f, 0x20, 0x55, 0x5a, 0x0a, 0x5b, 0x00, 0x08, 0x20, 0x00, 0x01, 0x65, 0x00, 0x10, 0x22, 0x66,
+                0x00, 0x0f, 0x02, 0x2e, 0x17, 0x01, 0x4e, 0x00, 0x0f, 0x07, 0x2e, 0x0c, 0x01, 0x24, 0x00, 0x03, 0xfb, 0x0b, 0x0f, 0x1a,
+                0x2c, 0x0a, 0x0f, 0x6c, 0x00, 0x23, 0x01, 0xd3, 0x0d, 0x11, 0x27, 0x08, 0x61, 0x2f, 0x27, 0x3a, 0x35, 0x0d, 0x01, 0x0a,
+                0x26, 0x01, 0x29, 0x29, 0x7d, 0x01, 0x0e, 0x03, 0x1d, 0x00, 0x0c, 0xc3, 0x08, 0x0f, 0x89, 0x00, 0x42, 0x0f, 0x7b, 0x01,
+                0x02, 0x0b, 0x90, 0x00, 0x0b, 0xfa, 0x01, 0x0f, 0x97, 0x00, 0x30, 0x06, 0x81, 0x0e, 0x0f, 0x9c, 0x00, 0x22, 0x07, 0xb6,
+                0x0e, 0x0a, 0x24, 0x00, 0x04, 0xbd, 0x0e, 0x08, 0xfd, 0x10, 0x04, 0x89, 0x03, 0x0a, 0x2a, 0x00, 0x00, 0x95, 0x03, 0x1f,
+                0x2e, 0x97, 0x03, 0x00, 0x0f, 0x40, 0x04, 0x08, 0x03, 0x36, 0x02, 0x05, 0x1c, 0x0e, 0x0f, 0x78, 0x03, 0x09, 0x0f, 0x6d,
+                0x17, 0x02, 0x05, 0x47, 0x04, 0x22, 0x6a, 0x6a, 0x30, 0x6d, 0x23, 0x6a, 0x6a, 0x47, 0x04, 0x02, 0x5e, 0x0a, 0x00, 0x45,
+                0x04, 0x2e, 0x6a, 0x6a, 0x94, 0x00, 0x0f, 0x64, 0x01, 0x03, 0x0f, 0xd8, 0x02, 0x02, 0x1e, 0x27, 0x36, 0x04, 0x0f, 0x3e,
+                0x00, 0x0b, 0x2f, 0x72, 0x61, 0x37, 0x00, 0x59, 0x04, 0xf8, 0x01, 0x0f, 0x3c, 0x00, 0x03, 0x0a, 0x43, 0x01, 0x08, 0x0e,
+                0x00, 0x0f, 0x63, 0x0b, 0x06, 0x40, 0x72, 0x6f, 0x77, 0x46, 0x81, 0x85, 0x0f, 0x4a, 0x05, 0x16, 0x0f, 0x44, 0x05, 0x03,
+                0x01, 0x44, 0x00, 0x08, 0xf5, 0x63, 0x0f, 0x06, 0x02, 0x07, 0x01, 0x2b, 0x00, 0x00, 0x83, 0x02, 0x07, 0xdd, 0x0b, 0x0f,
+                0x05, 0x64, 0x0e, 0x0f, 0xc7, 0x10, 0x07, 0x6f, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0xba, 0x10, 0xff, 0xff, 0xff, 0xff,
+                0xa6, 0x00, 0xba, 0x51, 0x01, 0x73, 0x4c, 0x0f, 0xd9, 0x0b, 0x08, 0x07, 0x94, 0xbc, 0x0f, 0x2d, 0x0d, 0x0b, 0x0c, 0x16,
+                0x33, 0x0a, 0x36, 0x32, 0x0e, 0x1a, 0x33, 0x0f, 0x73, 0x00, 0x0a, 0x04, 0xc6, 0xa1, 0x0f, 0x73, 0x00, 0x01, 0x0f, 0x7c,
+                0x11, 0x18, 0x0f, 0x18, 0xa7, 0x08, 0x0f, 0x5a, 0x00, 0x03, 0x0f, 0xfe, 0x0d, 0x19, 0x0f, 0x72, 0xa8, 0x10, 0x0f, 0x5c,
+                0x0d, 0x04, 0x0f, 0x10, 0x0e, 0x1c, 0x0f, 0xde, 0xa7, 0x11, 0x0f, 0x6a, 0x00, 0x12, 0x0f, 0x22, 0x0e, 0x0f, 0x0f, 0xc5,
+                0xa9, 0x10, 0x0f, 0x6a, 0x00, 0x12, 0x0f, 0x34, 0x0e, 0x12, 0x0f, 0x35, 0xa9, 0x0f, 0x0f, 0x6c, 0x00, 0x06, 0x0e, 0x12,
+                0x00, 0x0f, 0x07, 0x10, 0x1d, 0x0f, 0xda, 0xa6, 0x06, 0x0f, 0x19, 0x02, 0x44, 0x0f, 0x23, 0x10, 0x10, 0x0f, 0x17, 0x02,
+                0x31, 0x0f, 0x33, 0x10, 0x11, 0x0f, 0x15, 0x02, 0x32, 0x0f, 0x43, 0x10, 0x10, 0x0f, 0x13, 0x02, 0x35, 0x0f, 0x53, 0x10,
+                0x0d, 0x0f, 0x11, 0x02, 0x0d, 0x0f, 0xe1, 0x13, 0x15, 0x0f, 0x84, 0xa6, 0x08, 0x0f, 0x15, 0x02, 0x44, 0x0f, 0xfd, 0x13,
+                0x12, 0x0f, 0x17, 0x02, 0x31, 0x0f, 0x0d, 0x14, 0x13, 0x0f, 0x19, 0x02, 0x32, 0x0f, 0x1d, 0x14, 0x12, 0x0f, 0x1b, 0x02,
+                0x35, 0x0f, 0x2d, 0x14, 0x0f, 0x0f, 0x1d, 0x02, 0x01, 0x0f, 0xec, 0x12, 0x07, 0x45, 0x4c, 0x31, 0x2e, 0x35, 0x62, 0x2b,
+                0x02, 0xad, 0x06, 0x0f, 0x93, 0x00, 0x10, 0x2f, 0x67, 0x63, 0x1c, 0x07, 0x02, 0x0f, 0xa9, 0x06, 0x20, 0x0f, 0x94, 0xba,
+                0x00, 0x0f, 0x7b, 0x02, 0x37, 0x0f, 0x5d, 0x00, 0x07, 0x0f, 0x61, 0x05, 0x49, 0x0d, 0xfa, 0xba, 0x0f, 0xd1, 0x00, 0x44,
+                0x07, 0x5b, 0x00, 0x0f, 0x1f, 0x04, 0x4b, 0x0f, 0x5e, 0xbb, 0x00, 0x0f, 0xd3, 0x00, 0x44, 0x09, 0x5d, 0x00, 0x0f, 0xd7,
+                0x02, 0x29, 0x0c, 0x41, 0x37, 0x0f, 0x89, 0x00, 0x10, 0x1f, 0x70, 0x79, 0x02, 0x04, 0x0f, 0xd3, 0x02, 0x1e, 0x0e, 0xde,
+                0xba, 0x0f, 0x2e, 0x01, 0x37, 0x0f, 0xb8, 0xbb, 0x07, 0x0f, 0x4c, 0x05, 0x3b, 0x0f, 0xa2, 0xbb, 0x08, 0x0f, 0x42, 0x03,
+                0x50, 0x0c, 0xc1, 0xba, 0x0f, 0x40, 0x01, 0x43, 0x0f, 0xa1, 0x08, 0x47, 0x0f, 0x81, 0xbb, 0x06, 0x0f, 0xaf, 0x03, 0x52,
+                0x0e, 0x98, 0xba, 0x0f, 0x40, 0x01, 0x43, 0x0f, 0xcc, 0x07, 0x49, 0x0f, 0x5c, 0xbb, 0x08, 0x0f, 0x1e, 0x04, 0x30, 0x02,
+                0xe8, 0x37, 0x0f, 0x87, 0x00, 0x10, 0x02, 0x2a, 0x3a, 0x0f, 0x18, 0x04, 0x34, 0x0f, 0x62, 0xba, 0x03, 0x0f, 0x9c, 0x01,
+                0x37, 0x0f, 0x48, 0xbb, 0x0b, 0x0f, 0xa0, 0x01, 0x3b, 0x0f, 0x2e, 0xbb, 0x0c, 0x0f, 0x24, 0x04, 0x50, 0x0f, 0x39, 0xba,
+                0x01, 0x0f, 0x4c, 0x01, 0x47, 0x0f, 0x2c, 0x04, 0x47, 0x0f, 0x01, 0xbb, 0x0a, 0x0f, 0x30, 0x04, 0x52, 0x0f, 0x04, 0xba,
+                0x03, 0x0f, 0x4c, 0x01, 0x47, 0x0f, 0x38, 0x04, 0x49, 0x0f, 0xd0, 0xba, 0x0c, 0x0f, 0x3c, 0x04, 0x30, 0x00, 0xf5, 0x3c,
+                0x0f, 0x89, 0x00, 0x10, 0x00, 0x9e, 0x3c, 0x0f, 0x38, 0x04, 0x34, 0x0f, 0x5e, 0xb2, 0x01, 0x0f, 0x9e, 0x01, 0x37, 0x0f,
+                0x3e, 0xb3, 0x09, 0x0f, 0x9c, 0x01, 0x3b, 0x0f, 0x26, 0xb3, 0x0a, 0x0f, 0x32, 0x04, 0x50, 0x0e, 0x3b, 0xb2, 0x0f, 0x46,
+                0x01, 0x45, 0x0f, 0x2e, 0x04, 0x47, 0x0f, 0xff, 0xb2, 0x08, 0x0f, 0x2c, 0x04, 0x52, 0x0f, 0x0c, 0xb2, 0x01, 0x0f, 0x46,
+                0x01, 0x45, 0x0f, 0x28, 0x04, 0x49, 0x0f, 0xd4, 0xb2, 0x0a, 0x0f, 0x26, 0x04, 0x30, 0x00, 0x38, 0x40, 0x0f, 0x87, 0x00,
+                0x10, 0x00, 0xe1, 0x3f, 0x0f, 0x26, 0x04, 0x34, 0x0f, 0x84, 0xcd, 0x01, 0x0f, 0x9a, 0x01, 0x37, 0x0f, 0x64, 0xce, 0x09,
+                0x0f, 0x9a, 0x01, 0x3b, 0x0f, 0x4c, 0xce, 0x0a, 0x0f, 0x26, 0x04, 0x50, 0x0e, 0x61, 0xcd, 0x0f, 0x46, 0x01, 0x45, 0x0f,
+                0x26, 0x04, 0x47, 0x0f, 0x25, 0xce, 0x08, 0x0f, 0x26, 0x04, 0x52, 0x0f, 0x32, 0xcd, 0x01, 0x0f, 0x46, 0x01, 0x45, 0x0f,
+                0x26, 0x04, 0x49, 0x0f, 0xfa, 0xcd, 0x0a, 0x0f, 0x26, 0x04, 0x24, 0x0f, 0xcc, 0x27, 0x05, 0x3f, 0x46, 0x42, 0x50, 0x9b,
+                0x1a, 0x16, 0x2f, 0x66, 0x62, 0x36, 0x04, 0x02, 0x06, 0x4d, 0x00, 0x00, 0xa3, 0x5c, 0x0f, 0x51, 0x00, 0x30, 0x0f, 0x87,
+                0x04, 0x1b, 0x0f, 0x5e, 0xe2, 0x05, 0x0f, 0xfa, 0x01, 0x32, 0x0f, 0x3b, 0xe3, 0x0d, 0x0f, 0xf9, 0x01, 0x36, 0x0f, 0x24,
+                0xe3, 0x0e, 0x0f, 0x84, 0x04, 0x4b, 0x0f, 0x3e, 0xe2, 0x03, 0x0f, 0x43, 0x01, 0x44, 0x0f, 0x82, 0x04, 0x42, 0x0f, 0x00,
+                0xe3, 0x0c, 0x0f, 0x81, 0x04, 0x4d, 0x0f, 0x12, 0xe2, 0x05, 0x0f, 0x43, 0x01, 0x44, 0x0f, 0x7f, 0x04, 0x44, 0x0f, 0xd8,
+                0xe2, 0x0e, 0x0f, 0x7e, 0x04, 0x3c, 0x3f, 0x48, 0x55, 0x42, 0x2d, 0x04, 0x16, 0x0f, 0x57, 0xda, 0x00, 0x00, 0x69, 0x59,
+                0x0f, 0x27, 0xd9, 0x1c, 0x0f, 0x33, 0x00, 0x1c, 0x0f, 0x83, 0x2e, 0x11, 0x00, 0xf6, 0x04, 0x0f, 0xc9, 0x00, 0xa8, 0x0f,
+                0x6e, 0x05, 0x20, 0x0f, 0xc2, 0x00, 0x03, 0x0f, 0xe8, 0x02, 0x34, 0x0f, 0xbf, 0xdc, 0x08, 0x0f, 0xe8, 0x02, 0x3b, 0x0f,
+                0xa8, 0xdc, 0x09, 0x0f, 0x6e, 0x05, 0x50, 0x0f, 0xd2, 0x01, 0x01, 0x0f, 0x43, 0x01, 0x41, 0x0f, 0x6e, 0x05, 0x47, 0x0f,
+                0x84, 0xdc, 0x07, 0x0f, 0x6e, 0x05, 0x52, 0x0f, 0xe0, 0x02, 0x16, 0x0f, 0x43, 0x01, 0x2e, 0x0f, 0x6e, 0x05, 0x49, 0x0f,
+                0x5c, 0xdc, 0x09, 0x0f, 0x6e, 0x05, 0x28, 0x0f, 0xfb, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x46, 0x31, 0x54,
+                0x65, 0x78, 0x81, 0x45, 0x0f, 0xf3, 0x4a, 0x27, 0x31, 0x6c, 0x73, 0x75, 0xf8, 0x02, 0x10, 0x41, 0x7d, 0xbb, 0x01, 0x0f,
+                0x00, 0x01, 0xf6, 0x02, 0x02, 0x08, 0x00, 0x05, 0x3a, 0x77, 0x31, 0x74, 0x65, 0x78, 0x17, 0x00, 0x02, 0x08, 0x00, 0x0f,
+                0xe8, 0x80, 0x27, 0x09, 0x6e, 0x00, 0x00, 0x33, 0x30, 0x08, 0x10, 0x00, 0x0f, 0x30, 0x00, 0x03, 0x02, 0xbc, 0xa0, 0x02,
+                0x09, 0x00, 0x0f, 0x22, 0x00, 0x06, 0x06, 0x1d, 0x06, 0x09, 0x10, 0x00, 0x0f, 0x04, 0x51, 0x01, 0x29, 0x65, 0x78, 0x82,
+                0x00, 0x00, 0x86, 0x90, 0x0f, 0x27, 0x00, 0x03, 0x02, 0x79, 0x00, 0x02, 0x09, 0x00, 0x0f, 0x22, 0x00, 0x06, 0x07, 0x6f,
+                0x81, 0x08, 0x10, 0x00, 0x0f, 0x8b, 0x49, 0x37, 0x0a, 0x2f, 0x69, 0x0b, 0x2f, 0x46, 0x00, 0xd7, 0x0c, 0x1f, 0x61, 0x91,
+                0x7c, 0x00, 0x06, 0x8d, 0x68, 0x43, 0x6e, 0x73, 0x74, 0x5f, 0x23, 0x76, 0x15, 0x64, 0x9f, 0xc8, 0x0f, 0xf9, 0x46, 0x14,
+                0x0f, 0x41, 0x00, 0x1a, 0x0f, 0x52, 0x00, 0x0d, 0x0f, 0x4f, 0x00, 0x06, 0x00, 0x51, 0x2d, 0x0f, 0x90, 0x00, 0x2a, 0x0f,
+                0x41, 0x00, 0x00, 0x0f, 0x7f, 0x47, 0x0c, 0xa0, 0x4d, 0x49, 0x4f, 0x20, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0xf9, 0x96,
+                0x47, 0x51, 0x75, 0x65, 0x75, 0x16, 0x49, 0x4f, 0x2c, 0x20, 0x27, 0x72, 0x54, 0x01, 0x0a, 0x62, 0x6d, 0x69, 0x6f, 0x5f,
+                0x70, 0x71, 0x11, 0x48, 0x0a, 0x65, 0x6b, 0x0b, 0x1f, 0x01, 0x0f, 0xc4, 0x00, 0x05, 0x0f, 0x41, 0x00, 0x16, 0x0f, 0x54,
+                0x01, 0x13, 0x0f, 0x4f, 0x00, 0x0c, 0x06, 0x1f, 0x01, 0x0f, 0x90, 0x00, 0x24, 0x03, 0x41, 0x00, 0x0f, 0x54, 0x01, 0x0c,
+                0x11, 0x49, 0x12, 0xbb, 0x0f, 0x1c, 0x71, 0x04, 0x0f, 0xa8, 0x02, 0x0a, 0x03, 0xe9, 0x52, 0x54, 0x6c, 0x73, 0x75, 0x69,
+                0x6e, 0xb5, 0x53, 0x0f, 0x8c, 0x48, 0x06, 0x0f, 0xc4, 0x00, 0x01, 0x0f, 0x41, 0x00, 0x1a, 0x0f, 0x54, 0x01, 0x0f, 0x04,
+                0x79, 0x53, 0x80, 0x65, 0x78, 0x69, 0x6e, 0x5f, 0x73, 0x6d, 0x32, 0x0e, 0x00, 0x3f, 0x72, 0x65, 0x71, 0xcd, 0x70, 0x03,
+                0x0f, 0x90, 0x00, 0x08, 0x0f, 0x41, 0x00, 0x10, 0x0f, 0xa8, 0x02, 0x0d, 0x60, 0x2d, 0x53, 0x74, 0x61, 0x67, 0x65, 0x8f,
+                0xa5, 0x4d, 0x58, 0x42, 0x41, 0x52, 0xfc, 0x03, 0x0a, 0xa8, 0x02, 0x0f, 0xae, 0x63, 0x03, 0x0f, 0x1a, 0xcd, 0x0d, 0x2f,
+                0x27, 0x29, 0xb8, 0x63, 0x0c, 0x0f, 0x41, 0x00, 0x10, 0x0f, 0x54, 0x01, 0x03, 0x0f, 0x90, 0x00, 0x20, 0x02, 0x6b, 0x02,
+                0x0f, 0x90, 0x00, 0x28, 0x01, 0x41, 0x00, 0x0f, 0x56, 0x01, 0x0c, 0x00, 0x4b, 0x01, 0x00, 0x53, 0x01, 0x03, 0x5e, 0x01,
+                0x0f, 0x56, 0x01, 0x24, 0x0f, 0x01, 0xce, 0x0b, 0x0f, 0xc6, 0x00, 0x10, 0x0f, 0x41, 0x00, 0x0e, 0x0f, 0x56, 0x01, 0x1b,
+                0x0f, 0x69, 0xce, 0x0b, 0x0f, 0x90, 0x00, 0x2b, 0x0f, 0x56, 0x01, 0x11, 0x00, 0x91, 0x5d, 0x0f, 0x1b, 0x75, 0x06, 0x0f,
+                0x00, 0x04, 0x11, 0x45, 0x64, 0x61, 0x74, 0x61, 0xff, 0x00, 0x60, 0x5f, 0x77, 0x61, 0x76, 0x65, 0x66, 0x83, 0x77, 0x0b,
+                0xc9, 0x03, 0x0f, 0x70, 0x03, 0x08, 0x0f, 0x41, 0x00, 0x13, 0x0f, 0x00, 0x04, 0x16, 0x06, 0x4f, 0x00, 0x00, 0x0f, 0x00,
+                0x0f, 0x90, 0x00, 0x2a, 0x0f, 0x41, 0x00, 0x06, 0x0f, 0x54, 0x01, 0x0c, 0x00, 0x9c, 0x34, 0x30, 0x46, 0x69, 0x6c, 0xa5,
+                0x06, 0x0f, 0x21, 0x71, 0x01, 0x08, 0x54, 0x01, 0x0f, 0x9a, 0x77, 0x29, 0x0f, 0x86, 0x77, 0x2b, 0x0f, 0x54, 0x01, 0x9c,
+                0x01, 0x6c, 0x12, 0x00, 0xb5, 0xc6, 0x0f, 0xad, 0x02, 0x01, 0x0f, 0xa8, 0x06, 0x14, 0x02, 0x71, 0x12, 0x00, 0x45, 0x00,
+                0x0f, 0xce, 0x6f, 0x06, 0x0f, 0xa8, 0x06, 0x0b, 0x0f, 0x41, 0x00, 0x10, 0x0f, 0xa8, 0x06, 0x19, 0x0f, 0x90, 0x00, 0x2b,
+                0x0f, 0x41, 0x00, 0x10, 0x0f, 0xf7, 0x4f, 0xa8, 0x04, 0xfb, 0x4e, 0x02, 0x18, 0x0c, 0x0f, 0x80, 0x4e, 0x1b, 0x09, 0x4c,
+                0x0c, 0x0f, 0x16, 0x8f, 0x13, 0x0a, 0xe1, 0x0c, 0x00, 0x71, 0x12, 0x0f, 0x13, 0x4f, 0x03, 0x04, 0x68, 0x0d, 0x0f, 0x16,
+                0x4f, 0x20, 0x0f, 0x96, 0x00, 0x20, 0x0a, 0xf5, 0x0c, 0x0f, 0x96, 0x00, 0x07, 0x04, 0xe7, 0x0d, 0x0f, 0xd5, 0x59, 0x21,
+                0x09, 0x1a, 0x0e, 0x0f, 0xa4, 0x01, 0x23, 0x02, 0x44, 0x00, 0x0f, 0x78, 0x00, 0x36, 0x0f, 0x27, 0x50, 0x2f, 0x01, 0x65,
+                0x0f, 0x0b, 0x5d, 0x3f, 0x0f, 0x55, 0x3f, 0xc8, 0x0f, 0x8e, 0x3c, 0x03, 0x0f, 0x71, 0x3c, 0x25, 0x0f, 0x13, 0x3c, 0x37,
+                0x60, 0x4c, 0x53, 0x55, 0x20, 0x62, 0x79, 0xed, 0x18, 0x02, 0x24, 0x18, 0x02, 0xb8, 0x04, 0x0d, 0x26, 0x18, 0x05, 0x3c,
+                0x09, 0x0f, 0x82, 0x1c, 0x0a, 0x02, 0xe8, 0x5f, 0x0f, 0x49, 0x00, 0x12, 0x10, 0x5f, 0x60, 0x18, 0x03, 0x2b, 0xd0, 0x00,
+                0x19, 0xd9, 0x01, 0x00, 0x7c, 0x0f, 0x35, 0x00, 0x1c, 0x11, 0x73, 0x38, 0x83, 0x0f, 0x35, 0x00, 0x1c, 0x03, 0xa5, 0x36,
+                0x0f, 0x37, 0x00, 0x1d, 0x06, 0x6f, 0x36, 0x0f, 0x38, 0x1a, 0x06, 0x02, 0xfe, 0x00, 0x31, 0x20, 0x4c, 0x6f, 0x9b, 0x19,
+                0x0f, 0x03, 0x01, 0x23, 0x0f, 0x67, 0x19, 0x03, 0x0d, 0x64, 0x00, 0x43, 0x53, 0x74, 0x6f, 0x72, 0xd5, 0x33, 0x0f, 0x33,
+                0x01, 0x20, 0x0f, 0x65, 0x00, 0x14, 0x00, 0x10, 0x38, 0x0f, 0x64, 0x00, 0x21, 0x0f, 0x07, 0x38, 0x0a, 0x0d, 0x66, 0x00,
+                0x11, 0x52, 0x59, 0x01, 0x0f, 0x65, 0x00, 0x1e, 0x0f, 0xff, 0x37, 0x07, 0x0f, 0xed, 0x37, 0x08, 0x00, 0x8e, 0x62, 0x0f,
+                0x6d, 0x00, 0x17, 0x10, 0x6c, 0x2f, 0x00, 0x0f, 0x9d, 0x02, 0x1c, 0x05, 0x34, 0x00, 0x05, 0x69, 0x01, 0x0f, 0x00, 0x01,
+                0x06, 0x01, 0x8e, 0x00, 0x0f, 0x2e, 0x02, 0x1c, 0x0a, 0x93, 0x00, 0x0f, 0x62, 0x01, 0x0d, 0x02, 0x62, 0x00, 0x0f, 0x2c,
+                0x02, 0x1c, 0x0e, 0xc2, 0x00, 0x0f, 0x53, 0x21, 0x23, 0x00, 0x61, 0x0b, 0x0f, 0x59, 0x04, 0x15, 0x0f, 0xf9, 0x3f, 0x04,
+                0x07, 0x4d, 0x00, 0x02, 0x39, 0x64, 0x0f, 0x4a, 0x00, 0x12, 0x01, 0xc6, 0x00, 0x00, 0xbe, 0xaa, 0x02, 0x31, 0x00, 0x0f,
+                0x84, 0x01, 0x0a, 0x03, 0x58, 0x00, 0x02, 0x47, 0x6f, 0x0f, 0x5e, 0x00, 0x1e, 0x00, 0x26, 0x01, 0x06, 0xbb, 0x00, 0x0f,
+                0x8a, 0x01, 0x09, 0x04, 0x68, 0x00, 0x0f, 0xee, 0x01, 0x13, 0x0f, 0x67, 0x00, 0x00, 0x0f, 0xf0, 0x01, 0x06, 0x0f, 0xee,
+                0x02, 0x07, 0x04, 0x64, 0x65, 0x0f, 0x6f, 0x00, 0x16, 0x15, 0x73, 0x31, 0x00, 0x0f, 0x34, 0x01, 0x0a, 0x03, 0x58, 0x00,
+                0x0f, 0xcc, 0x00, 0x1c, 0x03, 0x5d, 0x00, 0x0f, 0xbc, 0x02, 0x16, 0x04, 0x66, 0x00, 0x0f, 0xbe, 0x02, 0x14, 0x0f, 0x67,
+                0x00, 0x00, 0x0f, 0xeb, 0x04, 0x12, 0x04, 0x67, 0x00, 0x0f, 0xec, 0x04, 0x13, 0x0f, 0x66, 0x00, 0x00, 0x0f, 0xed, 0x04,
+                0x14, 0x04, 0x68, 0x00, 0x0f, 0xee, 0x04, 0x12, 0x0f, 0x67, 0x00, 0x00, 0x0f, 0xef, 0x04, 0x15, 0x0f, 0x8e, 0x03, 0x0c,
+                0x00, 0xde, 0x09, 0x10, 0x61, 0x18, 0x01, 0x0f, 0x91, 0x03, 0x2d, 0x74, 0x31, 0x44, 0x20, 0x42, 0x75, 0x66, 0x66, 0x46,
+                0x36, 0x0f, 0xce, 0x00, 0x0d, 0x03, 0x8d, 0x0a, 0x44, 0x31, 0x64, 0x5f, 0x62, 0x36, 0x00, 0x0f, 0x84, 0x50, 0x0b, 0x80,
+                0x31, 0x44, 0x20, 0x6f, 0x72, 0x20, 0x32, 0x44, 0x33, 0x68, 0x10, 0x2f, 0x3d, 0x01, 0x0f, 0x68, 0x00, 0x1d, 0x1f, 0x32,
+                0x98, 0x51, 0x0f, 0x07, 0x5e, 0x00, 0x00, 0x2e, 0x1c, 0x73, 0x20, 0x4d, 0x69, 0x70, 0x6d, 0x61, 0x70, 0x2c, 0x21, 0x0f,
+                0x6a, 0x00, 0x14, 0x61, 0x32, 0x64, 0x5f, 0x6e, 0x6f, 0x6d, 0x39, 0x00, 0x0f, 0x70, 0x00, 0x0e, 0x1f, 0x33, 0xce, 0x00,
+                0x24, 0x01, 0x1c, 0x85, 0x0f, 0x5b, 0x00, 0x0b, 0x42, 0x43, 0x75, 0x62, 0x65, 0x83, 0x00, 0x0f, 0x57, 0x00, 0x17, 0x15,
+                0x63, 0x34, 0x00, 0x0f, 0xb5, 0x51, 0xff, 0x56, 0x0f, 0x59, 0x4b, 0x04, 0x02, 0x77, 0x1f, 0x0f, 0x59, 0x4b, 0x46, 0x09,
+                0x7a, 0x00, 0x0a, 0x58, 0x4b, 0x0e, 0x7a, 0x00, 0x0f, 0x58, 0x4b, 0x2f, 0x06, 0x6f, 0x00, 0x0d, 0x57, 0x4b, 0x0f, 0xe9,
+                0x00, 0x39, 0x0f, 0x57, 0x4b, 0x10, 0x0c, 0x8a, 0x00, 0x07, 0x56, 0x4b, 0x0f, 0xf9, 0x00, 0x21, 0x0f, 0x56, 0x4b, 0x1c,
+                0x0e, 0x63, 0x00, 0x09, 0x56, 0x4b, 0x0c, 0xa8, 0x02, 0x0f, 0x52, 0x4b, 0x06, 0x0f, 0x4d, 0x4b, 0x13, 0x0f, 0x48, 0x4b,
+                0x09, 0x0f, 0x43, 0x4b, 0x15, 0x07, 0x9c, 0x6e, 0x04, 0x3f, 0x01, 0x0e, 0x6c, 0x24, 0x0a, 0x67, 0x24, 0x0f, 0x62, 0x24,
+                0x20, 0x0f, 0x5d, 0x24, 0x0b, 0x0f, 0x58, 0x24, 0x0a, 0x0f, 0x56, 0x24, 0xff, 0x45, 0x0f, 0x51, 0x24, 0x0c, 0x0f, 0x4c,
+                0x24, 0x60, 0x0f, 0x47, 0x24, 0x0c, 0x0f, 0x42, 0x24, 0x0e, 0x0f, 0x18, 0x24, 0x24, 0x0f, 0xb9, 0x22, 0xad, 0x2f, 0x53,
+                0x6d, 0xb6, 0x22, 0x31, 0x00, 0x07, 0x20, 0x13, 0x45, 0x06, 0x20, 0x21, 0x2c, 0x20, 0xb4, 0x16, 0x3f, 0x69, 0x74, 0x79,
+                0xe2, 0x99, 0x0f, 0x0f, 0x9e, 0x22, 0x0b, 0x08, 0x56, 0x00, 0x29, 0x20, 0x3d, 0x65, 0x00, 0x0f, 0x2e, 0x00, 0x00, 0x04,
+                0x76, 0x00, 0x25, 0x20, 0x3d, 0x81, 0x00, 0x0f, 0x7c, 0x99, 0x3e, 0x00, 0x10, 0x09, 0x0f, 0x7d, 0x73, 0x06, 0x3e, 0x61,
+                0x64, 0x75, 0x71, 0x89, 0x0f, 0x26, 0x21, 0x05, 0x02, 0x2d, 0x00, 0x0f, 0xeb, 0x19, 0x0d, 0x24, 0x2c, 0x20, 0x49, 0x96,
+                0x60, 0x64, 0x20, 0x62, 0x72, 0x61, 0x6e, 0xbb, 0x94, 0x01, 0x89, 0x96, 0x13, 0x69, 0xe9, 0x73, 0x01, 0x8b, 0x01, 0x0f,
+                0xe9, 0x73, 0x05, 0x0f, 0x99, 0x72, 0x03, 0x2f, 0x61, 0x6c, 0xa7, 0x00, 0x19, 0x01, 0x2d, 0x00, 0x0f, 0xa7, 0x00, 0x10,
+                0x51, 0x49, 0x4e, 0x54, 0x33, 0x32, 0x6c, 0x95, 0x50, 0x70, 0x74, 0x20, 0x6d, 0x75, 0x82, 0x03, 0x83, 0x6c, 0x79, 0x3b,
+                0x20, 0x46, 0x50, 0x33, 0x32, 0x58, 0x78, 0x24, 0x69, 0x73, 0x38, 0xa4, 0x0f, 0xa7, 0x00, 0x12, 0x2f, 0x63, 0x62, 0xa7,
+                0x00, 0x18, 0x02, 0x2d, 0x00, 0x0f, 0xa7, 0x00, 0x10, 0x60, 0x44, 0x69, 0x76, 0x65, 0x72, 0x67, 0xcc, 0x89, 0x09, 0x4f,
+                0x01, 0x00, 0xb2, 0xe1, 0x41, 0x72, 0x6f, 0x6c, 0x20, 0x07, 0xb1, 0x0f, 0x3e, 0x00, 0x04, 0x0f, 0xa7, 0x00, 0x03, 0x24,
+                0x66, 0x6d, 0xa1, 0x1a, 0x0f, 0xa7, 0x00, 0x10, 0x02, 0x2d, 0x00, 0x0f, 0xa7, 0x00, 0x10, 0x01, 0x37, 0x01, 0xd4, 0x6d,
+                0x75, 0x6c, 0x2f, 0x61, 0x64, 0x64, 0x2c, 0x20, 0x46, 0x50, 0x31, 0x36, 0x0e, 0x00, 0x0f, 0x1a, 0x1c, 0x0e, 0x0f, 0xa7,
+                0x00, 0x06, 0x48, 0x68, 0x65, 0x61, 0x76, 0x85, 0x74, 0x0f, 0xa7, 0x00, 0x0a, 0x02, 0x2d, 0x00, 0x0f, 0xaa, 0x00, 0x1c,
+                0x01, 0x4b, 0x01, 0x02, 0x09, 0x02, 0x04, 0x02, 0x02, 0x0f, 0x3f, 0x00, 0x09, 0x0f, 0xaa, 0x00, 0x04, 0x3b, 0x70, 0x36,
+                0x34, 0x36, 0x00, 0x0f, 0xaa, 0x00, 0x08, 0x01, 0x2d, 0x00, 0x0f, 0xa7, 0x00, 0x12, 0x2f, 0x36, 0x34, 0x43, 0x01, 0x16,
+                0x0f, 0xa7, 0x00, 0x11, 0x2f, 0x69, 0x70, 0xf8, 0x01, 0x18, 0x02, 0x2d, 0x00, 0x0f, 0xa7, 0x00, 0x10, 0x09, 0x40, 0x95,
+                0x06, 0x78, 0xb6, 0x10, 0x69, 0x27, 0x1c, 0x37, 0x70, 0x6f, 0x6c, 0x7c, 0xa7, 0x0f, 0xa7, 0x00, 0x14, 0x00, 0x7f, 0x17,
+                0x0f, 0xa7, 0x00, 0x16, 0x02, 0x2d, 0x00, 0x0f, 0xa7, 0x00, 0x10, 0x04, 0x9c, 0x77, 0x01, 0xf8, 0x13, 0x10, 0x2c, 0xb0,
+                0x00, 0x51, 0x72, 0x65, 0x64, 0x20, 0x6d, 0xfd, 0x30, 0x03, 0x29, 0x9b, 0x3f, 0x69, 0x73, 0x63, 0xed, 0x03, 0x18, 0x5d,
+                0x74, 0x65, 0x6e, 0x73, 0x6f, 0x83, 0x7d, 0x0f, 0x61, 0x26, 0x06, 0x01, 0x2d, 0x00, 0x0f, 0xa8, 0x00, 0x10, 0x11, 0x54,
+                0x2a, 0x00, 0x75, 0x20, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x94, 0x02, 0x20, 0x20, 0x28, 0x51, 0x03, 0x10, 0x2c, 0xaa,
+                0x02, 0x5f, 0x38, 0x2f, 0x34, 0x2f, 0x31, 0x8f, 0xac, 0x02, 0x0f, 0xa8, 0x00, 0x05, 0x1f, 0x78, 0x4f, 0x01, 0x17, 0x02,
+                0x2d, 0x00, 0x0f, 0xa7, 0x00, 0x12, 0x02, 0xea, 0x13, 0x00, 0x39, 0x01, 0x03, 0xc0, 0x11, 0x03, 0x4d, 0x01, 0x0f, 0xee,
+                0x03, 0x24, 0x30, 0x75, 0x6e, 0x69, 0x23, 0x09, 0x0b, 0x9f, 0x20, 0x0f, 0xa7, 0x00, 0x04, 0x04, 0x2d, 0x00, 0x0f, 0xa9,
+                0x00, 0x10, 0x00, 0x67, 0x90, 0x20, 0x2d, 0x6c, 0x5d, 0x08, 0x10, 0x20, 0x11, 0xf0, 0x50, 0x61, 0x72, 0x20, 0x6f, 0x70,
+                0x8e, 0x08, 0x0e, 0x0a, 0x29, 0x0f, 0xa9, 0x00, 0x14, 0x1d, 0x78, 0x9e, 0x02, 0x0f, 0xa9, 0x00, 0x08, 0x02, 0x2d, 0x00,
+                0x0f, 0x50, 0x01, 0x11, 0x31, 0x72, 0x61, 0x6e, 0x92, 0x7e, 0x52, 0x65, 0x6e, 0x74, 0x61, 0x6c, 0xe2, 0x05, 0x80, 0x66,
+                0x6c, 0x6f, 0x61, 0x74, 0x2f, 0x69, 0x6e, 0x61, 0xbf, 0x00, 0x9b, 0xe4, 0x00, 0xba, 0xc4, 0x0f, 0x48, 0x00, 0x00, 0x0f,
+                0x07, 0x79, 0x10, 0x00, 0x8c, 0x00, 0x00, 0x66, 0x1f, 0x01, 0x0c, 0x08, 0x0f, 0x71, 0x8f, 0x01, 0x09, 0xb7, 0x08, 0x00,
+                0x12, 0x74, 0x39, 0x69, 0x70, 0x65, 0xcc, 0x08, 0x0e, 0x4d, 0x8f, 0x00, 0x20, 0xb2, 0x02, 0xf0, 0x0e, 0x09, 0x3d, 0x00,
+                0x1d, 0x3f, 0x2d, 0x75, 0x0a, 0x69, 0x09, 0x03, 0x77, 0x9a, 0x1f, 0x3a, 0x44, 0x76, 0x0a, 0x05, 0x62, 0x00, 0x01, 0x26,
+                0xaf, 0x0d, 0x62, 0x00, 0x09, 0x0f, 0x00, 0x04, 0xc9, 0x75, 0x00, 0x5a, 0xc6, 0x0b, 0xed, 0xd7, 0x01, 0xda, 0x00, 0x2f,
+                0x70, 0x63, 0xa7, 0x00, 0x22, 0x0f, 0x51, 0x92, 0x05, 0x0f, 0xb9, 0x00, 0x11, 0x3f, 0x69, 0x70, 0x63, 0xb9, 0x00, 0x14,
+                0x0f, 0x78, 0x92, 0x04, 0x0f, 0xcb, 0x00, 0x03, 0x1f, 0x70, 0xcb, 0x00, 0x2a, 0x08, 0x85, 0xce, 0x0f, 0xc8, 0x00, 0x14,
+                0x1f, 0x70, 0xc8, 0x00, 0x1c, 0x09, 0x63, 0x00, 0x0f, 0xc5, 0x00, 0x05, 0x03, 0x2b, 0x11, 0x03, 0x64, 0x02, 0x05, 0x02,
+                0x0b, 0x08, 0xc6, 0x00, 0x00, 0x04, 0x11, 0x09, 0x1e, 0x00, 0x00, 0xaf, 0x00, 0x0a, 0x1f, 0x00, 0x08, 0x82, 0x00, 0x0f,
+                0xea, 0x91, 0x00, 0x11, 0x70, 0xa0, 0x22, 0x0f, 0x66, 0x00, 0x0e, 0x00, 0xc4, 0x22, 0x0f, 0x69, 0x00, 0x0b, 0x00, 0x22,
+                0x00, 0x0b, 0x6c, 0x00, 0x0f, 0xa4, 0x22, 0x4c, 0x01, 0x90, 0x00, 0x08, 0x85, 0x0c, 0x0f, 0x3e, 0x00, 0x1f, 0x0f, 0xda,
+                0x72, 0x23, 0x00, 0xad, 0xc9, 0x0f, 0x38, 0x21, 0x16, 0x02, 0x9c, 0x03, 0x0f, 0xca, 0x72, 0x20, 0x6f, 0x69, 0x70, 0x63,
+                0x2c, 0x20, 0x32, 0x69, 0x00, 0x17, 0x02, 0x4c, 0x03, 0x0f, 0x69, 0x00, 0x20, 0x1f, 0x70, 0x69, 0x00, 0x1c, 0x02, 0xed,
+                0x02, 0x0f, 0x77, 0x22, 0x20, 0x0f, 0x12, 0x73, 0x1a, 0x02, 0x99, 0x02, 0x0f, 0x0a, 0x73, 0x25, 0x0f, 0x06, 0x73, 0x21,
+                0x0f, 0x72, 0x00, 0x01, 0x0f, 0xd7, 0x22, 0x2e, 0x20, 0x53, 0x6d, 0x52, 0x30, 0x04, 0x15, 0x03, 0x0f, 0x85, 0x0f, 0x05,
+                0x00, 0x82, 0x87, 0x0f, 0x86, 0x0f, 0x0c, 0x09, 0x0a, 0x93, 0x0a, 0xb8, 0x04, 0x20, 0x74, 0x68, 0x4f, 0x2e, 0x08, 0x68,
+                0x00, 0x0f, 0x90, 0x0f, 0x20, 0x0f, 0x3c, 0x0f, 0x12, 0x0f, 0xbc, 0x0f, 0x0f, 0x0f, 0xbc, 0x31, 0x00, 0x0d, 0x9e, 0x00,
+                0x02, 0xaf, 0xd6, 0x0b, 0x15, 0x00, 0x0f, 0xa2, 0x0f, 0x29, 0x00, 0x3f, 0x01, 0x3e, 0x28, 0x27, 0x74, 0x44, 0x7b, 0x00,
+                0x26, 0xec, 0x29, 0x6c, 0x6c, 0x88, 0x99, 0x0f, 0x21, 0x0c, 0x18, 0x0f, 0xae, 0x08, 0x01, 0x0f, 0xe9, 0x81, 0x06, 0x02,
+                0xa8, 0xfb, 0x02, 0xd8, 0x00, 0x0c, 0xe1, 0x08, 0x4d, 0x72, 0x65, 0x64, 0x5f, 0x92, 0x08, 0x0d, 0x35, 0x09, 0x02, 0xc6,
+                0x00, 0x0f, 0x69, 0x10, 0x03, 0x0f, 0x29, 0x10, 0x28, 0x0f, 0xa7, 0x10, 0x0d, 0x09, 0x2a, 0x00, 0x0f, 0x9c, 0x2a, 0x1e,
+                0x0f, 0xc6, 0x00, 0x05, 0x0f, 0x88, 0x10, 0x02, 0x0f, 0x48, 0x10, 0x28, 0x0f, 0xc6, 0x10, 0x0d, 0x0d, 0x2a, 0x00, 0x0f,
+                0x8a, 0x01, 0x03, 0x03, 0x31, 0x00, 0x0c, 0x93, 0x01, 0x0f, 0xc6, 0x00, 0x04, 0x0f, 0xa7, 0x10, 0x03, 0x0f, 0x67, 0x10,
+                0x28, 0x0f, 0xe5, 0x10, 0x0d, 0x0f, 0x8c, 0x01, 0x42, 0x0f, 0xc6, 0x10, 0x03, 0x0f, 0x86, 0x10, 0x28, 0x0f, 0x04, 0x11,
+                0x0d, 0x0f, 0x8c, 0x01, 0x18, 0x3f, 0x66, 0x6d, 0x61, 0x8c, 0x01, 0x14, 0x0f, 0xe5, 0x10, 0x03, 0x0f, 0xa2, 0x10, 0x28,
+                0x0f, 0x23, 0x11, 0x10, 0x0f, 0xc6, 0x00, 0x18, 0x01, 0x31, 0x00, 0x07, 0xcb, 0x00, 0x0f, 0xc6, 0x00, 0x05, 0x0f, 0x01,
+                0x11, 0x02, 0x0f, 0xc1, 0x10, 0x28, 0x0f, 0x3f, 0x11, 0x0d, 0x0f, 0x8c, 0x01, 0x19, 0x3b, 0x70, 0x36, 0x34, 0x8d, 0x01,
+                0x0f, 0xc6, 0x00, 0x04, 0x0f, 0x20, 0x11, 0x03, 0x0f, 0xe0, 0x10, 0x28, 0x0f, 0x5e, 0x11, 0x0d, 0x0f, 0xc6, 0x00, 0x18,
+                0x2f, 0x69, 0x70, 0x52, 0x02, 0x15, 0x0f, 0x3f, 0x11, 0x03, 0x0f, 0xff, 0x10, 0x28, 0x0f, 0x7d, 0x11, 0x0d, 0x0f, 0xc6,
+                0x00, 0x18, 0x00, 0x7d, 0x25, 0x0f, 0xc6, 0x00, 0x13, 0x0f, 0x5e, 0x11, 0x03, 0x0f, 0x1d, 0x11, 0x28, 0x0f, 0x9c, 0x11,
+                0x0e, 0x0f, 0xa4, 0x04, 0x41, 0x0f, 0x7c, 0x11, 0x03, 0x0f, 0x3c, 0x11, 0x28, 0x0f, 0xba, 0x11, 0x0d, 0x0f, 0x6a, 0x05,
+                0x42, 0x0f, 0x9b, 0x11, 0x03, 0x0f, 0x59, 0x11, 0x28, 0x0f, 0xd9, 0x11, 0x0f, 0x0f, 0xc6, 0x00, 0x40, 0x0f, 0xb8, 0x11,
+                0x03, 0x0f, 0x78, 0x11, 0x28, 0x0f, 0xf6, 0x11, 0x0d, 0x0f, 0x18, 0x03, 0x18, 0x1d, 0x78, 0x17, 0x03, 0x0f, 0xd6, 0x11,
+                0x06, 0x03, 0x47, 0xdd, 0x00, 0xd6, 0xa1, 0x30, 0x4c, 0x61, 0x75, 0xa8, 0x07, 0x00, 0x79, 0x0a, 0x0f, 0x24, 0xa3, 0x08,
+                0x13, 0x6c, 0x26, 0x00, 0x05, 0xf3, 0xab, 0x0c, 0x12, 0xc4, 0x09, 0x4c, 0x00, 0x07, 0x21, 0xc5, 0x0a, 0x3f, 0x00, 0x03,
+                0x2d, 0x87, 0x0f, 0x5e, 0x12, 0x22, 0x00, 0x4a, 0x00, 0x03, 0x9f, 0x00, 0x06, 0xfa, 0x0f, 0x0f, 0x5e, 0x12, 0x0b, 0x02,
+                0x2c, 0x01, 0x04, 0x35, 0x00, 0x03, 0x33, 0x00, 0x0e, 0x5f, 0x0b, 0x09, 0x8e, 0x0f, 0x06, 0x6d, 0x00, 0x00, 0x23, 0x00,
+                0x0f, 0x16, 0x01, 0x00, 0x07, 0x88, 0x00, 0x0f, 0x37, 0x88, 0x01, 0x0a, 0x40, 0x00, 0x02, 0x0a, 0x01, 0x08, 0xbb, 0x00,
+                0x0f, 0x33, 0x88, 0x01, 0x0a, 0x34, 0x00, 0x30, 0x50, 0x65, 0x72, 0x17, 0x03, 0x07, 0x99, 0x01, 0x04, 0x50, 0x20, 0x04,
+                0x22, 0x00, 0x1a, 0x2c, 0x6f, 0x01, 0x0f, 0x80, 0x00, 0x08, 0x0b, 0x4c, 0x00, 0x06, 0x8f, 0x00, 0x04, 0x9d, 0x00, 0x00,
+                0xf8, 0xf6, 0x11, 0x2f, 0x91, 0xcb, 0x0c, 0xc2, 0x01, 0x09, 0xeb, 0x0d, 0x05, 0x34, 0x01, 0x0f, 0xb8, 0x89, 0x0c, 0x06,
+                0x29, 0x00, 0x03, 0x04, 0x02, 0x0a, 0xa2, 0xd6, 0x01, 0x1e, 0x00, 0x00, 0x42, 0x82, 0x01, 0xb8, 0xa5, 0x0f, 0x4b, 0x00,
+                0x11, 0x04, 0x2d, 0x00, 0x0f, 0x4f, 0x00, 0x0f, 0x02, 0x27, 0x3f, 0x0f, 0x52, 0x00, 0x17, 0x02, 0x98, 0x11, 0x0f, 0x55,
+                0x00, 0x04, 0x0f, 0x88, 0x01, 0x03, 0x0f, 0xfa, 0x00, 0x13, 0x0f, 0x74, 0x01, 0x02, 0x0a, 0x65, 0x00, 0x03, 0x13, 0xe5,
+                0x07, 0x9d, 0x02, 0x10, 0x21, 0x23, 0x00, 0x0e, 0x9b, 0x0e, 0x07, 0x77, 0x01, 0x0c, 0x88, 0x02, 0x09, 0x40, 0x00, 0x0f,
+                0xc1, 0x8a, 0x03, 0x0c, 0x8e, 0x01, 0x0a, 0x73, 0x00, 0x0f, 0xbd, 0x8a, 0x03, 0x0d, 0xa4, 0x01, 0x04, 0x7d, 0x02, 0x06,
+                0x4d, 0x00, 0x02, 0x7f, 0x02, 0x00, 0x0a, 0x00, 0x0f, 0x70, 0x00, 0x02, 0x0a, 0xb3, 0x01, 0x0a, 0x84, 0x00, 0x0a, 0x6f,
+                0x02, 0x03, 0x16, 0x00, 0x0f, 0x45, 0x00, 0x09, 0x02, 0xd6, 0x01, 0x5c, 0x31, 0x30, 0x30, 0x20, 0x2a, 0x9b, 0x00, 0x4f,
+                0x2f, 0x20, 0x33, 0x32, 0x3b, 0x00, 0x0c, 0x08, 0x83, 0x00, 0x08, 0x97, 0x00, 0x30, 0x2b, 0x20, 0x27, 0x3e, 0x00, 0x02,
+                0x2d, 0x23, 0x1f, 0x27, 0x34, 0x01, 0x04, 0x0f, 0x88, 0x03, 0x07, 0x0c, 0x0b, 0x01, 0x0f, 0x8a, 0x03, 0x03, 0x0f, 0x14,
+                0x02, 0x0e, 0x0f, 0x1b, 0x01, 0x09, 0x0f, 0x8a, 0x03, 0x05, 0x09, 0x78, 0x24, 0x0f, 0x3a, 0x14, 0xba, 0x05, 0x54, 0x02,
+                0x09, 0x95, 0x12, 0x02, 0x0c, 0xe8, 0x0f, 0x9a, 0x12, 0x08, 0x07, 0x48, 0x02, 0x0f, 0x77, 0x13, 0x1c, 0x00, 0x75, 0x00,
+                0x06, 0x83, 0x01, 0x0f, 0x77, 0x00, 0x1c, 0x09, 0xbc, 0x01, 0x0f, 0x59, 0x14, 0x20, 0x0a, 0x94, 0x02, 0x0f, 0x7d, 0x00,
+                0x22, 0x07, 0xd1, 0x02, 0x0f, 0x71, 0x14, 0x20, 0x0d, 0x2c, 0x03, 0x0f, 0x84, 0x00, 0x2a, 0x02, 0x6c, 0x03, 0x0f, 0x08,
+                0x01, 0x20, 0x0f, 0xa9, 0x06, 0x04, 0x0f, 0x05, 0x02, 0x24, 0x0e, 0x67, 0x03, 0x0f, 0x9b, 0x01, 0x26, 0x0f, 0x95, 0x00,
+                0x2f, 0x0f, 0xfe, 0x03, 0x09, 0x0f, 0x4a, 0x15, 0x3e, 0x02, 0xcc, 0x9b, 0x02, 0xd2, 0x08, 0x2f, 0x69, 0x6f, 0x1d, 0x38,
+                0x01, 0x0f, 0xf3, 0x09, 0x42, 0x0b, 0xbb, 0x14, 0x0f, 0x2b, 0xaf, 0x03, 0x09, 0x24, 0x14, 0x0f, 0x4e, 0x00, 0x15, 0x07,
+                0x44, 0x0a, 0x09, 0x41, 0x00, 0x0c, 0x43, 0x0a, 0x0f, 0xaa, 0x25, 0x0f, 0x10, 0x73, 0x5e, 0x41, 0x02, 0x66, 0x91, 0x03,
+                0x1b, 0x91, 0x5b, 0x53, 0x75, 0x66, 0x66, 0x69, 0x34, 0xac, 0x04, 0x64, 0x75, 0x04, 0x2d, 0x00, 0x00, 0xef, 0x05, 0x04,
+                0x0c, 0x00, 0x0f, 0xef, 0x47, 0x01, 0x03, 0x1e, 0x01, 0x00, 0xd8, 0x01, 0x0f, 0x5d, 0x92, 0x01, 0x0f, 0x49, 0x01, 0x01,
+                0x00, 0x9e, 0x38, 0x08, 0x81, 0x00, 0x0f, 0xb5, 0x07, 0x05, 0x0c, 0x5f, 0x00, 0x0f, 0x4f, 0x0b, 0x06, 0x0d, 0x52, 0x00,
+                0x0f, 0xd4, 0x07, 0x06, 0x07, 0x53, 0x00, 0x12, 0x54, 0xb9, 0x03, 0x0f, 0xb4, 0x00, 0x05, 0x03, 0xd8, 0x03, 0x0f, 0xb6,
+                0x00, 0x2a, 0x03, 0x63, 0x00, 0x07, 0xb8, 0x00, 0x0f, 0x56, 0x00, 0x0e, 0x0f, 0xba, 0x00, 0x18, 0x0f, 0x9b, 0x08, 0x01,
+                0x0e, 0x26, 0x00, 0x00, 0xfb, 0x17, 0x0c, 0x49, 0x01, 0x0f, 0xb4, 0x00, 0x10, 0x0b, 0xbc, 0x08, 0x0f, 0xd5, 0x00, 0x03,
+                0x06, 0xab, 0x07, 0x0f, 0xad, 0x01, 0x02, 0x0f, 0x16, 0x18, 0x04, 0x03, 0xb5, 0x00, 0x0f, 0x76, 0x01, 0x00, 0x00, 0x1e,
+                0x17, 0x0b, 0x4a, 0x17, 0x0f, 0x75, 0x01, 0x17, 0x04, 0x5b, 0x00, 0x05, 0x6e, 0x01, 0x0f, 0x4e, 0x00, 0x0f, 0x0f, 0x6d,
+                0x01, 0x09, 0x00, 0x3a, 0x00, 0x0f, 0x62, 0x01, 0x04, 0x04, 0x6a, 0x00, 0x0f, 0x5b, 0x01, 0x15, 0x07, 0x4b, 0x00, 0x07,
+                0x50, 0x01, 0x08, 0xb0, 0x00, 0x0f, 0x49, 0x01, 0x1f, 0x02, 0x8f, 0x94, 0x0f, 0x97, 0x00, 0x04, 0x0c, 0x44, 0x04, 0x0f,
+                0x69, 0x2d, 0x02, 0x04, 0x47, 0x00, 0x0f, 0x93, 0x00, 0x0e, 0x0f, 0x92, 0x04, 0x01, 0x00, 0x1e, 0x00, 0x02, 0x35, 0x0a,
+                0x0f, 0xb3, 0x9c, 0x1a, 0x0f, 0x5b, 0x4b, 0x0b, 0x0f, 0xe1, 0x94, 0x05, 0x0f, 0xbd, 0x10, 0x08, 0x0f, 0x5d, 0x42, 0x0c,
+                0x03, 0xf7, 0xa6, 0x0f, 0xe1, 0xa1, 0x00, 0x02, 0x52, 0x00, 0x04, 0x87, 0xb5, 0x16, 0x76, 0x65, 0x11, 0x0f, 0x03, 0x44,
+                0x0d, 0x30, 0x65, 0x73, 0x73, 0xfc, 0x71, 0x01, 0xc7, 0x17, 0x0c, 0x58, 0x00, 0x07, 0x52, 0x00, 0x25, 0x74, 0x63, 0x53,
+                0x00, 0x0f, 0x52, 0x00, 0x11, 0x20, 0x45, 0x76, 0x75, 0x39, 0x0f, 0x88, 0xa2, 0x02, 0x05, 0x52, 0x00, 0x06, 0x1c, 0x43,
+                0x0f, 0x52, 0x00, 0x0c, 0x30, 0x47, 0x65, 0x6f, 0x65, 0xda, 0x1f, 0x79, 0xf8, 0x00, 0x02, 0x07, 0x52, 0x00, 0x1f, 0x67,
+                0xf6, 0x00, 0x16, 0x08, 0x35, 0xbd, 0x0f, 0xf9, 0x11, 0x01, 0x04, 0x52, 0x00, 0x1f, 0x70, 0x52, 0x00, 0x16, 0x04, 0x00,
+                0xc1, 0x0f, 0x54, 0x00, 0x02, 0x07, 0x52, 0x00, 0x06, 0x47, 0x01, 0x0f, 0xf5, 0x42, 0x77, 0x05, 0x10, 0x07, 0x0f, 0xf1,
+                0x92, 0x23, 0x0a, 0x30, 0x04, 0x0f, 0x4c, 0x09, 0x1b, 0x0d, 0x40, 0x00, 0x0f, 0xef, 0x0b, 0x23, 0x08, 0x47, 0x00, 0x03,
+                0xd0, 0x05, 0x0f, 0x89, 0x00, 0x28, 0x06, 0x12, 0x06, 0x0f, 0x8d, 0x93, 0x24, 0x0f, 0x7c, 0x06, 0x03, 0x0f, 0x92, 0x00,
+                0x2f, 0x0f, 0x19, 0x0c, 0x26, 0x04, 0x24, 0x01, 0x04, 0x11, 0x05, 0x0f, 0x8b, 0x00, 0x20, 0x07, 0x4c, 0x05, 0x0f, 0x16,
+                0x01, 0x24, 0x07, 0x37, 0x06, 0x0f, 0x80, 0x00, 0x24, 0x0f, 0x19, 0x0d, 0x2a, 0x0f, 0xa0, 0x94, 0x02, 0x0f, 0x7b, 0x00,
+                0x12, 0x0f, 0x97, 0x21, 0x2b, 0x0f, 0xa1, 0x94, 0x09, 0x0f, 0x7f, 0x00, 0x26, 0x0f, 0x5a, 0x0c, 0x30, 0x31, 0x52, 0x65,
+                0x73, 0xc5, 0x83, 0x4f, 0x55, 0x73, 0x61, 0x67, 0xca, 0x83, 0x00, 0x01, 0x83, 0x38, 0x50, 0x73, 0x56, 0x61, 0x6c, 0x69,
+                0x01, 0x0c, 0x04, 0x3e, 0x00, 0x01, 0x53, 0xec, 0x0f, 0x35, 0xe0, 0x02, 0x11, 0x21, 0x1b, 0x00, 0x0f, 0x5b, 0xf0, 0x0b,
+                0x0f, 0x21, 0x00, 0x00, 0x05, 0x7f, 0xeb, 0x07, 0xbb, 0x00, 0x07, 0x43, 0x0c, 0x0f, 0x05, 0x0c, 0x0e, 0x13, 0x72, 0xc6,
+                0x00, 0x00, 0x73, 0x01, 0xa0, 0x74, 0x2c, 0x20, 0x67, 0x66, 0x78, 0x2c, 0x20, 0x76, 0x74, 0x03, 0xf1, 0x00, 0x01, 0x45,
+                0x0d, 0xc6, 0xf7, 0x02, 0x87, 0x44, 0x03, 0x34, 0x00, 0x00, 0xd7, 0x44, 0x03, 0x0b, 0x00, 0x0f, 0xcd, 0xa4, 0x02, 0x01,
+                0x9f, 0x53, 0x1f, 0x6f, 0x9c, 0x53, 0x01, 0x20, 0x67, 0x66, 0xbe, 0xb8, 0x3f, 0x67, 0x66, 0x78, 0x9b, 0xb4, 0x01, 0x20,
+                0x74, 0x67, 0x99, 0xb4, 0x17, 0x74, 0x17, 0xf1, 0x06, 0x9f, 0x08, 0x00, 0x36, 0x08, 0x1f, 0x70, 0x41, 0x45, 0x02, 0x00,
+                0x1a, 0x00, 0x2f, 0x63, 0x73, 0x06, 0x58, 0x00, 0x03, 0x85, 0x01, 0x3c, 0x28, 0x74, 0x6f, 0xd1, 0xf2, 0x07, 0x11, 0x17,
+                0x60, 0x6f, 0x74, 0x53, 0x6d, 0x46, 0x61, 0x12, 0x01, 0x02, 0xb4, 0x00, 0x13, 0x2e, 0xd5, 0xc7, 0x13, 0x73, 0x79, 0xbf,
+                0x10, 0x27, 0x64, 0xef, 0x5a, 0x30, 0x2e, 0x35, 0x20, 0x3a, 0x4b, 0x81, 0x08, 0xee, 0x00, 0x04, 0xa0, 0xdf, 0x0d, 0x91,
+                0x14, 0x00, 0x59, 0x01, 0x0f, 0xf3, 0x28, 0x06, 0x18, 0x2a, 0x7d, 0x00, 0x0f, 0x5b, 0x00, 0x0a, 0x03, 0x99, 0x09, 0x2f,
+                0x6f, 0x74, 0xdd, 0x28, 0x07, 0x22, 0x20, 0x2a, 0x35, 0x0a, 0x06, 0x52, 0x00, 0x20, 0x2e, 0x74, 0xe2, 0xdb, 0x00, 0xe6,
+                0xef, 0x0f, 0xc5, 0x9f, 0x03, 0x21, 0x74, 0x6f, 0x60, 0x39, 0x08, 0xb6, 0x00, 0x00, 0x02, 0x28, 0x00, 0x2d, 0x01, 0x0f,
+                0x30, 0x00, 0x08, 0x02, 0x8b, 0x00, 0x0d, 0xcc, 0x27, 0x0e, 0x36, 0x00, 0x0b, 0x0f, 0x38, 0x08, 0x90, 0x01, 0x3f, 0x67,
+                0x66, 0x78, 0x90, 0x01, 0x06, 0x37, 0x67, 0x66, 0x78, 0x90, 0x01, 0x3f, 0x67, 0x66, 0x78, 0x90, 0x01, 0x1e, 0x25, 0x67,
+                0x66, 0x30, 0xe1, 0x0c, 0x90, 0x01, 0x01, 0xe4, 0x02, 0x0f, 0x90, 0x01, 0x08, 0x07, 0x7d, 0x00, 0x0f, 0x5b, 0x00, 0x0a,
+                0x03, 0x05, 0x01, 0x12, 0x66, 0x37, 0x0c, 0x0f, 0x90, 0x01, 0x09, 0x07, 0x52, 0x00, 0x0f, 0x90, 0x01, 0x0d, 0x23, 0x67,
+                0x66, 0xd8, 0x56, 0x0a, 0x90, 0x01, 0x00, 0x2d, 0x01, 0x0f, 0x30, 0x00, 0x08, 0x0f, 0x90, 0x01, 0x04, 0x0e, 0x36, 0x00,
+                0x07, 0xcd, 0xef, 0x04, 0x88, 0x01, 0x74, 0x76, 0x74, 0x67, 0x29, 0x20, 0x26, 0x26, 0xad, 0x04, 0x3f, 0x28, 0x70, 0x73,
+                0x97, 0x01, 0x06, 0x37, 0x76, 0x74, 0x67, 0x97, 0x01, 0x3f, 0x76, 0x74, 0x67, 0x97, 0x01, 0x1e, 0x3f, 0x76, 0x74, 0x67,
+                0x97, 0x01, 0x05, 0x01, 0x76, 0x04, 0x0f, 0x97, 0x01, 0x08, 0x07, 0x7d, 0x00, 0x0f, 0x5b, 0x00, 0x0a, 0x02, 0x0c, 0x01,
+                0x00, 0x46, 0x04, 0x0f, 0x97, 0x01, 0x0d, 0x07, 0x52, 0x00, 0x0f, 0x97, 0x01, 0x0d, 0x3f, 0x76, 0x74, 0x67, 0x97, 0x01,
+                0x01, 0x00, 0x3c, 0x01, 0x0f, 0x30, 0x00, 0x08, 0x0f, 0x97, 0x01, 0x04, 0x0f, 0x36, 0x00, 0x01, 0x03, 0xed, 0x1b, 0x1f,
+                0x73, 0x60, 0x01, 0x2c, 0x10, 0x70, 0xc5, 0x01, 0x0f, 0x5f, 0x01, 0x02, 0x00, 0xd0, 0x05, 0x0f, 0x5e, 0x01, 0x08, 0x06,
+                0x7a, 0x00, 0x0f, 0x58, 0x00, 0x09, 0x02, 0xd1, 0x00, 0x2f, 0x70, 0x73, 0x5b, 0x01, 0x0e, 0x06, 0x4f, 0x00, 0x0f, 0x5a,
+                0x01, 0x0d, 0x2f, 0x70, 0x73, 0x59, 0x01, 0x01, 0x0d, 0x39, 0x0f, 0x08, 0x2e, 0x00, 0x0f, 0x57, 0x01, 0x04, 0x0d, 0x34,
+                0x00, 0x0f, 0x7d, 0x04, 0x08, 0x1f, 0x63, 0xe5, 0x02, 0x07, 0x18, 0x63, 0x84, 0x01, 0x10, 0x63, 0x05, 0x0f, 0x0f, 0x83,
+                0x01, 0x1b, 0x1f, 0x63, 0x83, 0x01, 0x06, 0x1f, 0x63, 0x83, 0x01, 0x0b, 0x06, 0x79, 0x00, 0x0f, 0x58, 0x00, 0x09, 0x07,
+                0xd0, 0xa4, 0x0f, 0x87, 0x01, 0x0f, 0x06, 0x53, 0x00, 0x0f, 0x87, 0x01, 0x0d, 0x1f, 0x63, 0x87, 0x01, 0x02, 0x1f, 0x63,
+                0x87, 0x01, 0x04, 0x01, 0x2e, 0x00, 0x0f, 0x8a, 0x00, 0x03, 0x0f, 0x97, 0xfd, 0x12, 0x0c, 0x1f, 0x10, 0x0f, 0xde, 0xac,
+                0x19, 0x06, 0x2a, 0x52, 0x00, 0xf0, 0x0c, 0x0f, 0x0c, 0x20, 0x02, 0x09, 0xc9, 0xc1, 0x0f, 0x40, 0x10, 0x04, 0x0f, 0x53,
+                0x10, 0x02, 0x0f, 0xa6, 0x53, 0x2c, 0x01, 0x21, 0x02, 0x08, 0x7d, 0x00, 0x05, 0x50, 0x10, 0x1f, 0x74, 0xc7, 0xc4, 0x0d,
+                0x0f, 0x3e, 0x00, 0x09, 0x0c, 0xe6, 0x00, 0x0f, 0x3e, 0x00, 0x1b, 0x07, 0x32, 0x0f, 0x0f, 0x01, 0x00, 0x04, 0x07, 0xd4,
+                0x21, 0x05, 0x5d, 0x01, 0x40, 0x52, 0x65, 0x67, 0x69, 0x07, 0x78, 0x0a, 0x87, 0xdd, 0x01, 0x65, 0x00, 0x74, 0x73, 0x6d,
+                0x5f, 0x72, 0x66, 0x5f, 0x72, 0x21, 0x00, 0x30, 0x5f, 0x61, 0x6c, 0xf8, 0x24, 0x0f, 0xe8, 0x2a, 0x06, 0x0f, 0x5d, 0x01,
+                0x3a, 0x0f, 0x7c, 0x00, 0x06, 0x0f, 0x6a, 0x01, 0x0a, 0x0f, 0x3e, 0x00, 0x16, 0x0f, 0x6a, 0x01, 0x02, 0x0f, 0x3e, 0x00,
+                0x16, 0x0f, 0x6a, 0x01, 0x02, 0x0f, 0x5d, 0x01, 0x01, 0x00, 0xee, 0x3e, 0x30, 0x2f, 0x53, 0x68, 0xd7, 0x4a, 0x0f, 0x1f,
+                0x01, 0x35, 0x0f, 0x5d, 0x01, 0x31, 0x02, 0xf5, 0x45, 0x01, 0x35, 0x48, 0x01, 0xc2, 0x26, 0x02, 0xce, 0x55, 0x33, 0x69,
+                0x73, 0x62, 0x80, 0xa4, 0x0f, 0xea, 0x01, 0x03, 0x0f, 0x3e, 0x00, 0x0b, 0x10, 0x74, 0x72, 0xa6, 0x0f, 0x3e, 0x00, 0x26,
+                0x03, 0xec, 0xc8, 0x0f, 0x41, 0x00, 0x06, 0x0f, 0x5d, 0x01, 0x01, 0x3c, 0x43, 0x54, 0x41, 0x88, 0x01, 0x0f, 0x5d, 0x01,
+                0x6b, 0x0f, 0xd9, 0x01, 0x6a, 0x01, 0x6a, 0xca, 0x2f, 0x74, 0x61, 0x0e, 0x05, 0x20, 0x0f, 0x35, 0xe5, 0x71, 0x00, 0xee,
+                0x57, 0x02, 0x64, 0x13, 0x04, 0x69, 0x0e, 0x0a, 0x23, 0x34, 0x08, 0xd3, 0x07, 0x02, 0xba, 0xae, 0x0e, 0xe4, 0x0d, 0x0f,
+                0x60, 0x11, 0x16, 0x04, 0x68, 0x0d, 0x0f, 0x63, 0x10, 0x20, 0x07, 0xa3, 0x0d, 0x0f, 0xe1, 0x42, 0x04, 0x0f, 0x5d, 0x55,
+                0x10, 0x01, 0x5a, 0x0d, 0x0f, 0x7d, 0x00, 0x23, 0x0f, 0x67, 0x1e, 0x01, 0x0f, 0x64, 0x11, 0x1d, 0x02, 0x47, 0x00, 0x0f,
+                0x67, 0x11, 0x27, 0x0f, 0x87, 0x00, 0x04, 0x0f, 0x82, 0xae, 0x02, 0x0f, 0x32, 0x66, 0x02, 0x22, 0x6f, 0x6c, 0xf6, 0x43,
+                0x1a, 0x33, 0x78, 0x44, 0x03, 0xbe, 0xc7, 0x0c, 0x5c, 0x0e, 0x09, 0xdd, 0x09, 0x0c, 0x08, 0x02, 0x0f, 0x5c, 0x0e, 0x01,
+                0x0f, 0xc6, 0xfa, 0x01, 0x03, 0x74, 0x00, 0x00, 0x73, 0x00, 0x01, 0x72, 0x00, 0x05, 0xe7, 0x66, 0xa0, 0x3c, 0x65, 0x6d,
+                0x3e, 0x56, 0x54, 0x47, 0x2b, 0x50, 0x53, 0xca, 0xce, 0x10, 0x62, 0xc5, 0x08, 0xcf, 0x3c, 0x2f, 0x65, 0x6d, 0x3e, 0x20,
+                0xe2, 0xae, 0x95, 0x27, 0x2c, 0x20, 0xdf, 0x45, 0x07, 0x0f, 0x67, 0x02, 0x0f, 0x04, 0x3f, 0x0e, 0x0f, 0x63, 0x01, 0x20,
+                0x07, 0x7a, 0x0e, 0x0f, 0x67, 0x02, 0x26, 0x02, 0x31, 0x0e, 0x0f, 0x7d, 0x00, 0x23, 0x0f, 0x67, 0x02, 0x31, 0x02, 0x47,
+                0x00, 0x0f, 0x67, 0x02, 0x27, 0x0f, 0x87, 0x00, 0x04, 0x0f, 0xd9, 0x0e, 0x00, 0x01, 0xcf, 0xb8, 0x0b, 0xdd, 0x0e, 0x01,
+                0x10, 0x14, 0x0e, 0xfc, 0x0b, 0x0f, 0xc4, 0xc9, 0x17, 0x03, 0x65, 0x0e, 0x0f, 0xb9, 0x00, 0x20, 0x07, 0xa0, 0x0e, 0x0f,
+                0xbd, 0x01, 0x26, 0x02, 0x57, 0x0e, 0x0f, 0x7d, 0x00, 0x23, 0x0f, 0xbd, 0x01, 0x31, 0x02, 0x47, 0x00, 0x0f, 0xbd, 0x01,
+                0x27, 0x0f, 0x87, 0x00, 0x1b, 0x0f, 0x81, 0x01, 0x01, 0x03, 0x89, 0x0e, 0x0f, 0x07, 0x16, 0x21, 0x05, 0xc3, 0x0e, 0x0f,
+                0x7f, 0x01, 0x26, 0x01, 0x7e, 0x0e, 0x0f, 0x7b, 0x00, 0x22, 0x0f, 0x7d, 0x01, 0x31, 0x01, 0x46, 0x00, 0x0f, 0x07, 0x17,
+                0x28, 0x0f, 0x85, 0x00, 0x02, 0x0f, 0x9f, 0x05, 0x02, 0x03, 0x85, 0xcd, 0x01, 0xa7, 0x15, 0x0f, 0x70, 0x16, 0x05, 0x0d,
+                0x3e, 0x0f, 0x0f, 0xd4, 0x05, 0x0a, 0x1f, 0x36, 0xd4, 0x05, 0x02, 0x0f, 0xa0, 0x12, 0x0a, 0x03, 0x30, 0x02, 0x0f, 0x81,
+                0x00, 0x05, 0x00, 0xd6, 0x03, 0x02, 0xd7, 0x00, 0x0f, 0xa3, 0x00, 0x34, 0x0f, 0x77, 0x06, 0x03, 0x0f, 0xac, 0x11, 0x01,
+                0x0f, 0x47, 0x00, 0x20, 0x0e, 0x9c, 0x10, 0x0f, 0x31, 0x6e, 0x03, 0x0f, 0x45, 0x01, 0x1c, 0x0d, 0x1d, 0x0a, 0x0f, 0x61,
+                0x50, 0x08, 0x0f, 0x31, 0x07, 0x0a, 0x0f, 0x10, 0x11, 0x00, 0x0f, 0x93, 0x03, 0x16, 0x03, 0x99, 0x10, 0x0f, 0x93, 0x02,
+                0x20, 0x0a, 0xd3, 0x10, 0x0f, 0x97, 0x03, 0x26, 0x01, 0x8e, 0x10, 0x0f, 0x7f, 0x00, 0x22, 0x0f, 0x9a, 0x5e, 0x05, 0x0f,
+                0x9b, 0x03, 0x1d, 0x01, 0x4a, 0x00, 0x0f, 0x9b, 0x03, 0x27, 0x0f, 0x89, 0x00, 0x07, 0x0f, 0x3e, 0x09, 0x35, 0x0b, 0xc9,
+                0x11, 0x08, 0x18, 0x02, 0x0f, 0x0b, 0x1b, 0x30, 0x06, 0xc5, 0x27, 0x02, 0x64, 0xdd, 0x0f, 0x38, 0x4c, 0x21, 0x07, 0x8e,
+                0x26, 0x32, 0x61, 0x6e, 0x79, 0xb4, 0x22, 0x50, 0x2c, 0x20, 0x72, 0x65, 0x67, 0x50, 0x35, 0x64, 0x6d, 0x2c, 0x20, 0x6f,
+                0x74, 0x68, 0x14, 0xb8, 0x01, 0x0b, 0x00, 0x02, 0x46, 0x01, 0x0f, 0xac, 0x26, 0x2a, 0x00, 0x63, 0x00, 0x0f, 0xf6, 0x12,
+                0x01, 0x00, 0x18, 0x00, 0x0f, 0xb8, 0x23, 0x01, 0x03, 0x30, 0x00, 0x0f, 0x7f, 0x14, 0x04, 0x0f, 0x36, 0x00, 0x05, 0x2f,
+                0x72, 0x65, 0x3b, 0x16, 0x02, 0x2c, 0x72, 0x65, 0x59, 0x04, 0x07, 0x2e, 0x00, 0x0f, 0x63, 0x00, 0x04, 0x0f, 0x34, 0x00,
+                0x04, 0x3f, 0x73, 0x68, 0x6d, 0x62, 0x00, 0x01, 0x3f, 0x73, 0x68, 0x6d, 0x2e, 0x00, 0x07, 0x0f, 0x62, 0x00, 0x04, 0x0f,
+                0x34, 0x00, 0x04, 0x05, 0x7d, 0x01, 0x26, 0x20, 0x3d, 0x89, 0x01, 0x0f, 0x28, 0x00, 0x05, 0x0f, 0x8c, 0x00, 0x01, 0x08,
+                0xb3, 0x01, 0x0f, 0x38, 0x00, 0x08, 0x0f, 0x96, 0x00, 0x04, 0x0f, 0x3e, 0x00, 0x0c, 0x32, 0x61, 0x6e, 0x79, 0x74, 0x00,
+                0x2e, 0x61, 0x6e, 0xeb, 0x42, 0x21, 0x61, 0x6e, 0x78, 0x42, 0x05, 0x31, 0x61, 0x08, 0xca, 0x01, 0x03, 0xb1, 0x25, 0x02,
+                0x74, 0x01, 0x03, 0x0d, 0x00, 0x02, 0x1f, 0x01, 0x03, 0x0d, 0x00, 0x04, 0x98, 0x00, 0x0f, 0x76, 0x00, 0x07, 0x02, 0xb2,
+                0x00, 0x0f, 0x79, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x03, 0x7c, 0x00, 0x10, 0x27, 0x78, 0x00, 0x05, 0xcd, 0x25, 0x07, 0x46,
+                0x02, 0x20, 0x2b, 0x20, 0xf7, 0x29, 0x04, 0x19, 0x00, 0x06, 0xfb, 0x01, 0x0a, 0x18, 0x00, 0x06, 0xb1, 0x01, 0x0a, 0x18,
+                0x00, 0x08, 0x35, 0x01, 0x0d, 0x8b, 0x53, 0x0f, 0x7b, 0x25, 0x2c, 0x0f, 0x29, 0x25, 0x0d, 0x05, 0x6e, 0x14, 0x03, 0xba,
+                0x28, 0x04, 0x3c, 0x6d, 0x01, 0xda, 0xdf, 0x07, 0x8e, 0x13, 0x0f, 0x6c, 0x6a, 0x02, 0x0f, 0xa6, 0xe0, 0x3f, 0x0f, 0x52,
+                0x00, 0xff, 0x34, 0x0f, 0xeb, 0x26, 0x2c, 0x0f, 0x14, 0x02, 0x14, 0x07, 0x0a, 0x27, 0x0f, 0x14, 0x02, 0xff, 0xb5, 0x0f,
+                0xad, 0x28, 0x08, 0x0f, 0x14, 0x02, 0x15, 0x0f, 0x94, 0x72, 0x02, 0x0f, 0x14, 0x02, 0xff, 0xa5, 0x0f, 0x6f, 0x2a, 0x0d,
+                0x0f, 0x14, 0x02, 0x14, 0x07, 0x8e, 0x2a, 0x0f, 0x14, 0x02, 0xff, 0xb0, 0x3f, 0x56, 0x54, 0x47, 0x2f, 0x2c, 0x05, 0x0f,
+                0x50, 0x08, 0x1a, 0x0f, 0xde, 0x1b, 0x00, 0x0f, 0x70, 0x01, 0x93, 0x02, 0xe2, 0x00, 0x50, 0x70, 0x65, 0x32, 0x73, 0x6d,
+                0xc6, 0x00, 0x02, 0x56, 0x1b, 0x03, 0xd1, 0x1a, 0x3b, 0x69, 0x6f, 0x6e, 0xf0, 0x00, 0x0f, 0xa7, 0xff, 0x11, 0x0f, 0x14,
+                0x02, 0xae, 0x0f, 0x45, 0x2e, 0x0d, 0x0f, 0x14, 0x02, 0x14, 0x0f, 0xb4, 0x1d, 0x01, 0x0f, 0x3e, 0x00, 0x19, 0x00, 0x58,
+                0x79, 0x32, 0x73, 0x6f, 0x6e, 0x2c, 0x00, 0x06, 0x92, 0x01, 0x0e, 0x83, 0x2e, 0x0f, 0x52, 0x00, 0x1e, 0x04, 0x2b, 0x1e,
+                0x0f, 0x56, 0x00, 0x03, 0x0a, 0x14, 0x02, 0x00, 0xca, 0xed, 0x00, 0x2b, 0x1d, 0x0f, 0x13, 0x02, 0x28, 0x00, 0x52, 0x00,
+                0x80, 0x4f, 0x75, 0x74, 0x2d, 0x6f, 0x66, 0x2d, 0x4f, 0x76, 0xd1, 0x5f, 0x20, 0x45, 0x78, 0x69, 0x74, 0x39, 0x74, 0x2b,
+                0x0f, 0xf6, 0x00, 0x21, 0x32, 0x6f, 0x6f, 0x6f, 0x30, 0x00, 0x00, 0x2b, 0x11, 0x2b, 0x6c, 0x65, 0xf6, 0x00, 0x0f, 0x07,
+                0x30, 0x2b, 0x0f, 0xa0, 0x21, 0x35, 0x0f, 0xcc, 0x00, 0x0b, 0x1f, 0x63, 0x14, 0x02, 0x3e, 0x06, 0x52, 0x00, 0x0f, 0x14,
+                0x02, 0x13, 0x0f, 0x52, 0x00, 0x19, 0x20, 0x73, 0x68, 0x36, 0x1f, 0x0f, 0xa5, 0x00, 0x05, 0x00, 0x08, 0x4c, 0x40, 0x54,
+                0x41, 0x20, 0x41, 0x1f, 0x00, 0x0f, 0x45, 0x76, 0x33, 0x0f, 0xa4, 0x00, 0x21, 0x3f, 0x63, 0x74, 0x61, 0x47, 0x01, 0x07,
+                0x0f, 0xc9, 0x31, 0xae, 0x04, 0x88, 0x14, 0x02, 0x12, 0x10, 0x0f, 0x00, 0x14, 0x20, 0x05, 0x4b, 0x10, 0x0f, 0x24, 0x2f,
+                0x29, 0x02, 0x45, 0x00, 0x0f, 0x85, 0x14, 0x27, 0x0f, 0x85, 0x00, 0x19, 0x0f, 0xfe, 0x00, 0x01, 0x03, 0xd8, 0x10, 0x0f,
+                0x7a, 0x00, 0x20, 0x06, 0x12, 0x11, 0x0f, 0x00, 0x01, 0x29, 0x05, 0xd4, 0x11, 0x0f, 0x01, 0x01, 0x25, 0x0f, 0x87, 0x00,
+                0x1a, 0x0f, 0x02, 0x01, 0x01, 0x02, 0xc1, 0x11, 0x0f, 0x7a, 0x00, 0x20, 0x05, 0xfa, 0x11, 0x0f, 0x00, 0x01, 0x29, 0x04,
+                0xc6, 0x12, 0x0f, 0xff, 0x00, 0x25, 0x0f, 0x85, 0x00, 0x19, 0x0f, 0xfe, 0x00, 0x01, 0x02, 0xa7, 0x12, 0x0f, 0x79, 0x00,
+                0x20, 0x05, 0xe0, 0x12, 0x0f, 0xfe, 0x00, 0x29, 0x04, 0xb7, 0x13, 0x0f, 0xfe, 0x00, 0x25, 0x0f, 0x85, 0x00, 0x1b, 0x03,
+                0x30, 0x04, 0x05, 0x0b, 0x15, 0x0f, 0x32, 0x01, 0x23, 0x05, 0x5e, 0x14, 0x0f, 0xaf, 0x00, 0x1f, 0x07, 0xfc, 0x13, 0x0f,
+                0x36, 0x01, 0x29, 0x04, 0x47, 0x00, 0x0f, 0x38, 0x01, 0x27, 0x0f, 0x89, 0x00, 0x06, 0x0f, 0x57, 0x18, 0x2e, 0x00, 0x55,
+                0x18, 0x01, 0x20, 0xeb, 0x0f, 0x54, 0x18, 0x06, 0x01, 0x25, 0x06, 0x02, 0xd8, 0x24, 0x0f, 0x6f, 0x3e, 0x08, 0x00, 0xf7,
+                0x3b, 0x0f, 0xd1, 0xec, 0x00, 0x0e, 0x6a, 0x3f, 0x07, 0x4a, 0x00, 0x09, 0x34, 0x3c, 0x0c, 0xcc, 0xec, 0x07, 0x68, 0x15,
+                0x0f, 0x3d, 0x40, 0x16, 0x06, 0x48, 0x00, 0x08, 0x3f, 0x40, 0x0f, 0x87, 0x00, 0x02, 0x0f, 0x32, 0x4a, 0x03, 0x0e, 0x41,
+                0x00, 0x0f, 0x8b, 0x00, 0x02, 0x0b, 0x66, 0x55, 0x0f, 0x54, 0x3d, 0x12, 0x0f, 0x89, 0x00, 0x05, 0x08, 0x4c, 0x00, 0x0f,
+                0x45, 0x3d, 0x07, 0x03, 0x87, 0x00, 0x0f, 0xea, 0x19, 0x18, 0x00, 0x45, 0x45, 0x04, 0x8e, 0xd9, 0x07, 0x94, 0xd1, 0x0c,
+                0xcb, 0x19, 0x03, 0x8e, 0x2d, 0x07, 0xbf, 0x00, 0x0f, 0x2c, 0xd2, 0x0e, 0x0b, 0xc7, 0x00, 0x0d, 0x46, 0x00, 0x02, 0xc6,
+                0x00, 0x0c, 0x08, 0xd2, 0x0a, 0x48, 0x01, 0x01, 0xbc, 0x02, 0x04, 0xdd, 0x56, 0x03, 0xd6, 0x56, 0x0f, 0xf7, 0xd9, 0x1e,
+                0x02, 0x8e, 0x3d, 0x02, 0x9e, 0x47, 0x04, 0x94, 0x3d, 0x08, 0xca, 0x00, 0x03, 0x13, 0x67, 0x02, 0x6d, 0x02, 0x0f, 0x5d,
+                0x18, 0x01, 0x05, 0x88, 0x3d, 0x07, 0xba, 0x00, 0x06, 0x82, 0x3d, 0x0b, 0xaa, 0x02, 0x0f, 0x7d, 0x3d, 0x03, 0x07, 0xb5,
+                0x1a, 0x40, 0x4c, 0x61, 0x74, 0x65, 0x86, 0xee, 0x06, 0x21, 0x3e, 0x0a, 0x8d, 0x00, 0x0f, 0xac, 0x47, 0x0b, 0x0a, 0x45,
+                0x00, 0x0f, 0x97, 0x00, 0x08, 0x0f, 0xa0, 0x47, 0x09, 0x07, 0xfb, 0x3e, 0x0f, 0x8e, 0x00, 0x0d, 0x0f, 0x7e, 0x5c, 0x06,
+                0x0e, 0x44, 0x00, 0x0f, 0x8d, 0x00, 0x08, 0x0b, 0xbe, 0x02, 0x0f, 0x1c, 0x19, 0x38, 0x41, 0x41, 0x6c, 0x6c, 0x3b, 0xa1,
+                0x5f, 0x21, 0x6f, 0x66, 0xd5, 0xff, 0x01, 0x03, 0x05, 0x12, 0x20, 0xea, 0x0a, 0x70, 0x73, 0x20, 0x28, 0x77, 0x61, 0x69,
+                0x74, 0xfa, 0xde, 0x11, 0x2b, 0xd2, 0xf1, 0x3f, 0x69, 0x6e, 0x67, 0x32, 0x51, 0x02, 0x09, 0x50, 0x0b, 0x0f, 0xe9, 0x3e,
+                0x0d, 0x0f, 0xc5, 0x04, 0x00, 0x0f, 0x7a, 0x0f, 0x2a, 0x00, 0x61, 0xfb, 0x00, 0xa3, 0x00, 0x00, 0x6c, 0x0b, 0xc1, 0x61,
+                0x20, 0x73, 0x79, 0x6e, 0x63, 0x68, 0x72, 0x6f, 0x6e, 0x69, 0x7a, 0x9e, 0x0b, 0x04, 0xa7, 0xf9, 0x0f, 0x2e, 0x0c, 0x17,
+                0x33, 0x2c, 0x20, 0x27, 0x39, 0xfb, 0x0f, 0xea, 0x58, 0x0c, 0x02, 0xc2, 0x00, 0x02, 0x2c, 0xf3, 0x04, 0x2c, 0x0c, 0x0f,
+                0x6e, 0x00, 0x04, 0x0f, 0xc2, 0x00, 0x18, 0x73, 0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69, 0x63, 0x5a, 0x57, 0x60, 0x20, 0x74,
+                0x61, 0x72, 0x67, 0x65, 0xf3, 0x03, 0x00, 0x4a, 0x0e, 0x02, 0xd2, 0x00, 0x00, 0x78, 0x50, 0x00, 0x7c, 0x00, 0x70, 0x20,
+                0x50, 0x43, 0x20, 0x75, 0x70, 0x64, 0xe0, 0xda, 0x0e, 0xc2, 0x00, 0x02, 0x3e, 0x00, 0x00, 0xd6, 0x39, 0x4a, 0x6c, 0x76,
+                0x69, 0x6e, 0x68, 0x12, 0x0f, 0xc2, 0x00, 0x0b, 0x01, 0x3a, 0x00, 0x10, 0x5f, 0xa2, 0x2a, 0x08, 0x3a, 0x00, 0x0f, 0x84,
+                0x01, 0x1a, 0x41, 0x62, 0x75, 0x73, 0x79, 0x25, 0x4a, 0x60, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x61, 0xa3, 0x4f, 0x16, 0x65,
+                0xbc, 0xfe, 0x01, 0x98, 0x0c, 0x30, 0x3b, 0x20, 0x77, 0x99, 0xa7, 0x30, 0x64, 0x20, 0x73, 0x5f, 0x03, 0x51, 0x75, 0x6c,
+                0x65, 0x72, 0x20, 0x77, 0x0d, 0x02, 0x6f, 0x00, 0x01, 0x64, 0x58, 0x03, 0x2f, 0x00, 0x01, 0x31, 0x07, 0x0f, 0x33, 0x67,
+                0x01, 0x0f, 0xc2, 0x00, 0x05, 0x04, 0x69, 0x00, 0x02, 0x11, 0x00, 0x0f, 0xb3, 0x3f, 0x15, 0x08, 0xc2, 0x00, 0x02, 0x62,
+                0x53, 0x09, 0x35, 0x5b, 0x00, 0x7c, 0x75, 0x50, 0x70, 0x69, 0x78, 0x6f, 0x75, 0x5f, 0x39, 0x01, 0x8f, 0x01, 0x70, 0x6c,
+                0x65, 0x74, 0x65, 0x20, 0x61, 0x66, 0x64, 0x4d, 0x01, 0x8e, 0x01, 0x49, 0x45, 0x58, 0x49, 0x54, 0x42, 0x1a, 0x53, 0x44,
+                0x72, 0x61, 0x69, 0x6e, 0x22, 0x00, 0x0d, 0xbd, 0x10, 0x0f, 0xc2, 0x00, 0x0b, 0x00, 0x3a, 0x00, 0x0e, 0x7e, 0x02, 0x0f,
+                0xc2, 0x00, 0x18, 0xb0, 0x49, 0x4d, 0x43, 0x20, 0x28, 0x69, 0x6d, 0x6d, 0x65, 0x64, 0x69, 0xad, 0x70, 0x04, 0x1f, 0x5b,
+                0x20, 0x20, 0x63, 0xcf, 0xb3, 0x31, 0x29, 0x20, 0x2d, 0x25, 0x00, 0x10, 0x73, 0x51, 0x02, 0x16, 0x63, 0x1d, 0x00, 0x73,
+                0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0xbe, 0x18, 0x00, 0xae, 0x5a, 0x6f, 0x4d, 0x43, 0x20, 0x4d, 0x69, 0x73, 0x73,
+                0x31, 0x03, 0x0f, 0xc2, 0x00, 0x0a, 0x5e, 0x69, 0x6d, 0x63, 0x5f, 0x6d, 0x3a, 0x00, 0x0f, 0xc2, 0x00, 0x18, 0x70, 0x66,
+                0x72, 0x65, 0x65, 0x20, 0x73, 0x70, 0xf1, 0x54, 0x21, 0x69, 0x6e, 0x41, 0x02, 0x32, 0x4c, 0x47, 0x20, 0xf7, 0x8b, 0x52,
+                0x46, 0x49, 0x46, 0x4f, 0x3a, 0x9f, 0x56, 0x12, 0x2f, 0xff, 0x7c, 0x08, 0xab, 0x01, 0x02, 0x7b, 0xf6, 0x00, 0xa6, 0x01,
+                0x30, 0x4c, 0x53, 0x55, 0x0f, 0x08, 0x30, 0x4c, 0x47, 0x20, 0x04, 0x0a, 0x10, 0x74, 0x5c, 0x6f, 0x0f, 0xc6, 0x00, 0x1b,
+                0x21, 0x6c, 0x67, 0x9d, 0x88, 0x0c, 0x3a, 0x00, 0x0f, 0xc6, 0x00, 0x14, 0x20, 0x6f, 0x6e, 0xdb, 0x0f, 0x11, 0x69, 0xd9,
+                0x11, 0x13, 0x6c, 0x26, 0x06, 0x20, 0x64, 0x65, 0x42, 0x0a, 0x00, 0x0b, 0x00, 0x10, 0x3a, 0x9f, 0x00, 0x28, 0x20, 0x28,
+                0xc6, 0x00, 0x30, 0x29, 0x2c, 0x20, 0x95, 0x78, 0x13, 0x28, 0xe5, 0x7a, 0x14, 0x2c, 0xf2, 0x55, 0x11, 0x29, 0xc6, 0x00,
+                0x50, 0x6f, 0x6e, 0x67, 0x20, 0x53, 0x1b, 0xe5, 0x4b, 0x62, 0x6f, 0x61, 0x72, 0x41, 0x13, 0x0f, 0xc6, 0x00, 0x0b, 0x5d,
+                0x6f, 0x6e, 0x67, 0x5f, 0x73, 0x3a, 0x00, 0x0f, 0xd2, 0x03, 0x1a, 0x42, 0x6d, 0x61, 0x74, 0x68, 0xbd, 0x53, 0xbf, 0x74,
+                0x6f, 0x20, 0x62, 0x65, 0x63, 0x6f, 0x6d, 0x65, 0x20, 0x61, 0xe4, 0xd7, 0x06, 0x0f, 0x2e, 0x02, 0x03, 0x00, 0xb5, 0x20,
+                0x02, 0xe8, 0x5f, 0x0f, 0x8f, 0x01, 0x00, 0x0f, 0xc2, 0x00, 0x0a, 0x00, 0x7e, 0x00, 0x03, 0xbb, 0x56, 0x08, 0x3a, 0x00,
+                0x0f, 0xc2, 0x00, 0x1b, 0x02, 0xd4, 0x03, 0x0f, 0x0f, 0x06, 0x1e, 0x09, 0xc2, 0x00, 0x02, 0x44, 0x00, 0x0f, 0x1f, 0x06,
+                0x03, 0x0f, 0xc2, 0x00, 0x0b, 0x4e, 0x65, 0x6d, 0x62, 0x61, 0x76, 0x00, 0x0f, 0x10, 0x03, 0x2a, 0x00, 0x58, 0x90, 0x08,
+                0x11, 0x03, 0x80, 0x41, 0x44, 0x55, 0x2c, 0x20, 0x43, 0x42, 0x55, 0xcc, 0x5c, 0x32, 0x36, 0x34, 0x2c, 0x60, 0x02, 0x39,
+                0x6e, 0x6f, 0x74, 0x2a, 0x03, 0x60, 0x29, 0x2c, 0x20, 0x49, 0x50, 0x41, 0x51, 0x02, 0x00, 0x3f, 0x00, 0x0f, 0x18, 0x03,
+                0x06, 0x0f, 0xcd, 0x00, 0x0b, 0x2f, 0x69, 0x6f, 0x18, 0x03, 0x01, 0x0f, 0x8f, 0x01, 0x1b, 0xc3, 0x69, 0x73, 0x63, 0x65,
+                0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x6f, 0x08, 0xff, 0x01, 0x20, 0x28, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64,
+                0x20, 0x62, 0x65, 0x20, 0x72, 0x61, 0x72, 0x65, 0x6b, 0x08, 0x0a, 0x00, 0xc2, 0x00, 0x0f, 0x87, 0x5a, 0x05, 0x0f, 0xc2,
+                0x00, 0x10, 0x0f, 0x3a, 0x00, 0x02, 0x0f, 0xc2, 0x00, 0x18, 0x08, 0x71, 0x04, 0x10, 0x66, 0x2b, 0x7f, 0x10, 0x2c, 0x22,
+                0x06, 0x08, 0x16, 0x00, 0x01, 0x6b, 0x05, 0x00, 0xe8, 0x00, 0x0f, 0xb2, 0x36, 0x05, 0x01, 0x2a, 0xdb, 0x08, 0x6f, 0x93,
+                0x0f, 0x51, 0x02, 0x19, 0x21, 0x6e, 0x6f, 0xb9, 0x0c, 0x0c, 0x3a, 0x00, 0x0f, 0x2b, 0x09, 0x1b, 0x0a, 0x7b, 0x07, 0x60,
+                0x2c, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0xc0, 0xfb, 0x01, 0x04, 0x0a, 0x40, 0x77, 0x69, 0x73, 0x65, 0x99, 0x01, 0x62, 0x64,
+                0x79, 0x2d, 0x74, 0x6f, 0x2d, 0x55, 0x05, 0x00, 0x8a, 0x00, 0x0a, 0xb5, 0x03, 0x9f, 0x4e, 0x6f, 0x74, 0x20, 0x53, 0x65,
+                0x6c, 0x65, 0x63, 0x32, 0x37, 0x01, 0x0f, 0xc2, 0x00, 0x0c, 0x00, 0x88, 0x7b, 0x0d, 0x3a, 0x00, 0x0f, 0xf9, 0x91, 0x0d,
+                0x02, 0x86, 0x0a, 0x00, 0xa6, 0x00, 0x0f, 0x00, 0x01, 0x01, 0x0f, 0xd5, 0x03, 0x20, 0x0f, 0xbe, 0x00, 0x06, 0x0f, 0xc2,
+                0x00, 0x0e, 0x0f, 0xbe, 0x00, 0x00, 0x0f, 0x1f, 0x06, 0x38, 0x1f, 0x58, 0xc9, 0x03, 0x0e, 0x06, 0xf1, 0x03, 0x70, 0x4c,
+                0x44, 0x43, 0x2f, 0x49, 0x44, 0x43, 0xd7, 0x03, 0x01, 0x45, 0xd8, 0x0f, 0x29, 0x06, 0x05, 0x0f, 0xcf, 0x00, 0x0b, 0x00,
+                0x3a, 0x00, 0x0e, 0x29, 0x06, 0x0f, 0x53, 0x02, 0x1a, 0xf0, 0x00, 0x6e, 0x61, 0x6e, 0x6f, 0x73, 0x6c, 0x65, 0x65, 0x70,
+                0x20, 0x74, 0x69, 0x6d, 0x65, 0x72, 0x2e, 0x06, 0x5f, 0x65, 0x78, 0x70, 0x69, 0x72, 0xab, 0x35, 0x16, 0x00, 0xc2, 0x00,
+                0x00, 0x40, 0x00, 0x0c, 0xb4, 0x0a, 0x0f, 0xc2, 0x00, 0x13, 0x0f, 0x3a, 0x00, 0x03, 0x0f, 0x66, 0x05, 0x2a, 0x00, 0x92,
+                0x07, 0x08, 0x66, 0x05, 0x00, 0x10, 0x00, 0x02, 0x09, 0x07, 0x03, 0x9b, 0x5d, 0x00, 0x49, 0x09, 0x03, 0x9a, 0x5d, 0x09,
+                0x66, 0x65, 0x00, 0x0a, 0x0d, 0x2f, 0x45, 0x58, 0x63, 0x05, 0x24, 0x04, 0x18, 0x91, 0x0f, 0x63, 0x05, 0x23, 0x00, 0x25,
+                0x0c, 0x30, 0x20, 0x66, 0x69, 0x19, 0x65, 0x0e, 0x5a, 0x02, 0x0f, 0x0a, 0x0d, 0x1a, 0x00, 0xba, 0x1a, 0x12, 0x6f, 0x17,
+                0x5d, 0x0e, 0xca, 0x00, 0x0f, 0xc2, 0x00, 0x0a, 0x00, 0x39, 0x0e, 0x0f, 0x63, 0x05, 0x04, 0x0a, 0xc3, 0x00, 0x0f, 0xb0,
+                0xed, 0x1c, 0x01, 0x3d, 0x47, 0x03, 0xae, 0xed, 0x00, 0xc1, 0x47, 0x0f, 0xac, 0xed, 0x27, 0x0f, 0x8a, 0x19, 0x57, 0x02,
+                0x24, 0x12, 0x0f, 0x52, 0x7b, 0x0a, 0x0f, 0xb3, 0xed, 0x28, 0x0f, 0x9d, 0xdd, 0x57, 0x0f, 0xf8, 0x48, 0x44, 0x0f, 0x7a,
+                0x00, 0x36, 0x0f, 0xd0, 0x2f, 0x01, 0x07, 0xed, 0x11, 0x0f, 0x76, 0x00, 0x1b, 0x0a, 0x26, 0x12, 0x0f, 0xe6, 0x4a, 0x28,
+                0x0f, 0x7e, 0x00, 0x22, 0x0a, 0x17, 0x12, 0x0f, 0x8d, 0x16, 0x3c, 0x05, 0x0c, 0xbf, 0x00, 0x47, 0x95, 0x00, 0xae, 0x67,
+                0x0f, 0xe3, 0x2e, 0x26, 0x00, 0xe0, 0x12, 0x00, 0xdf, 0x95, 0x43, 0x72, 0x69, 0x6d, 0x73, 0x0c, 0x00, 0x00, 0x6d, 0x2b,
+                0x04, 0x0c, 0x00, 0x00, 0xd5, 0x2f, 0x00, 0x7a, 0x49, 0x10, 0x75, 0x13, 0x04, 0x03, 0x25, 0x00, 0x36, 0x6f, 0x75, 0x74,
+                0x32, 0x00, 0x02, 0x0d, 0x00, 0x03, 0x33, 0x00, 0x02, 0x0d, 0x00, 0x01, 0x34, 0x00, 0x0c, 0x3f, 0x15, 0x00, 0xd0, 0x12,
+                0x0b, 0x2e, 0x15, 0x50, 0x49, 0x66, 0x44, 0x65, 0x66, 0xcb, 0x38, 0x08, 0x91, 0x4a, 0x08, 0x82, 0x15, 0x0c, 0x8e, 0x32,
+                0x0f, 0x25, 0xe9, 0x05, 0x05, 0x7f, 0x1f, 0x0f, 0x26, 0xe9, 0x00, 0x05, 0xd1, 0x4a, 0x0d, 0xac, 0x1f, 0x0d, 0xfd, 0x9f,
+                0x06, 0xec, 0x33, 0x0f, 0x8a, 0xe9, 0x1c, 0x0d, 0x64, 0x00, 0x0f, 0x2b, 0xe9, 0x05, 0x0f, 0x66, 0x33, 0x04, 0x05, 0x40,
+                0x00, 0x0f, 0xfb, 0xe8, 0x20, 0x0b, 0xb3, 0xa0, 0x0e, 0xad, 0x80, 0x06, 0x54, 0x00, 0x02, 0x71, 0x43, 0x0f, 0x76, 0x01,
+                0x40, 0x00, 0x0d, 0x4c, 0x0f, 0x33, 0x01, 0x25, 0x0e, 0x85, 0xea, 0x0a, 0xd2, 0x00, 0x05, 0x29, 0x00, 0x0f, 0xd0, 0xe9,
+                0x0f, 0x0b, 0xfd, 0x00, 0x06, 0x7c, 0x31, 0x04, 0x78, 0x31, 0x0f, 0xbd, 0x15, 0x02, 0x04, 0xcb, 0x02, 0x05, 0x18, 0x00,
+                0x0d, 0xd6, 0x17, 0x05, 0x32, 0x01, 0x16, 0x28, 0x2e, 0x00, 0x0f, 0x09, 0x16, 0x03, 0x04, 0x1e, 0x00, 0x07, 0x96, 0x83,
+                0x0f, 0x7f, 0x01, 0x06, 0x0f, 0x4d, 0x00, 0x11, 0x01, 0x57, 0x03, 0x0f, 0x99, 0x00, 0x16, 0x01, 0x2e, 0x00, 0x0f, 0x4c,
+                0x00, 0x0b, 0x0f, 0x99, 0x00, 0x17, 0x0f, 0x4d, 0x00, 0x0b, 0x01, 0xe3, 0x03, 0x0f, 0x99, 0x00, 0x16, 0x02, 0x11, 0x04,
+                0x0f, 0x4c, 0x00, 0x0a, 0x0f, 0x99, 0x00, 0x17, 0x0f, 0x4d, 0x00, 0x06, 0x07, 0xa4, 0x04, 0x0f, 0x99, 0x00, 0x10, 0x07,
+                0x2e, 0x00, 0x0f, 0x4d, 0x00, 0x0c, 0x06, 0x58, 0x46, 0x0f, 0x9a, 0x00, 0x07, 0x0f, 0x4e, 0x00, 0x0c, 0x07, 0x32, 0x05,
+                0x0f, 0x9b, 0x00, 0x10, 0x07, 0x2e, 0x00, 0x0f, 0x4d, 0x00, 0x0c, 0x0f, 0x9b, 0x00, 0x11, 0x0f, 0x4e, 0x00, 0x12, 0x09,
+                0x69, 0x02, 0x0f, 0x9b, 0x00, 0x0e, 0x0f, 0x1c, 0x02, 0x06, 0x07, 0x1f, 0x00, 0x0f, 0x9b, 0x00, 0x17, 0x0f, 0x4e, 0x00,
+                0x0c, 0x09, 0x6b, 0x02, 0x0f, 0x9b, 0x00, 0x0e, 0x0f, 0x1e, 0x02, 0x06, 0x07, 0x1f, 0x00, 0x0f, 0x9b, 0x00, 0x17, 0x0e,
+                0x4e, 0x00, 0x0f, 0x9d, 0xa3, 0x0d, 0x0f, 0x45, 0x7a, 0x01, 0x06, 0xb9, 0xc6, 0x32, 0x44, 0x69, 0x73, 0x53, 0x6c, 0x0b,
+                0xee, 0x6a, 0x04, 0x8d, 0x0b, 0x01, 0x6f, 0xff, 0x01, 0xe6, 0x02, 0x20, 0x5f, 0x70, 0xb1, 0x01, 0x0c, 0xfb, 0x0d, 0x07,
+                0x20, 0x00, 0x10, 0x76, 0x36, 0x01, 0x0f, 0x98, 0x10, 0x09, 0x09, 0xa1, 0x05, 0x0f, 0x20, 0x00, 0x1b, 0x0f, 0x94, 0x00,
+                0x17, 0x0d, 0x54, 0x00, 0x0f, 0x36, 0xec, 0x08, 0x0f, 0x74, 0x00, 0x0b, 0x0f, 0x80, 0x7b, 0x03, 0x0f, 0xf8, 0x33, 0x0a,
+                0x0f, 0x3b, 0x01, 0x1a, 0x0f, 0xde, 0x5c, 0x01, 0x0f, 0x17, 0x34, 0x00, 0x0f, 0xc7, 0x00, 0x2d, 0x0f, 0x3b, 0x01, 0x24,
+                0x0f, 0x9e, 0x00, 0x0c, 0x0f, 0x96, 0x00, 0x0d, 0x0f, 0x3d, 0x01, 0x03, 0x00, 0x0d, 0x31, 0x1f, 0x2e, 0x22, 0x33, 0x06,
+                0x0f, 0x2e, 0x02, 0x19, 0x0f, 0x9f, 0x00, 0x09, 0x07, 0x40, 0x33, 0x0f, 0x3d, 0x01, 0x3a, 0x0f, 0x4a, 0x00, 0x0a, 0x0f,
+                0x78, 0x02, 0x1e, 0x0f, 0x3b, 0x01, 0x22, 0x0f, 0x49, 0x32, 0x05, 0x0f, 0x7d, 0x00, 0x19, 0x0f, 0x3b, 0x01, 0x0a, 0x06,
+                0x67, 0x32, 0x0f, 0x3b, 0x01, 0xb7, 0x0f, 0x6f, 0x31, 0x0a, 0x0f, 0x3b, 0x01, 0x36, 0x07, 0x8e, 0x31, 0x0f, 0x3b, 0x01,
+                0xb7, 0x81, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x20, 0x28, 0xa8, 0x6e, 0x00, 0x58, 0x0e, 0x50, 0x20, 0x46, 0x65, 0x65,
+                0x64, 0x67, 0x9f, 0x09, 0x49, 0x17, 0x0f, 0xdf, 0x05, 0x3a, 0x0f, 0x29, 0x06, 0x38, 0x51, 0x65, 0x73, 0x5f, 0x5f, 0x73,
+                0xc3, 0x00, 0x12, 0x5f, 0x3f, 0x07, 0x0f, 0xf6, 0x04, 0x02, 0x0f, 0x2a, 0x00, 0x03, 0x06, 0xcf, 0x06, 0x0f, 0x20, 0x00,
+                0x03, 0x00, 0x6c, 0x58, 0x02, 0x20, 0x00, 0x0f, 0x3b, 0x01, 0x03, 0x06, 0x64, 0x07, 0xc8, 0x41, 0x73, 0x73, 0x65, 0x6d,
+                0x62, 0x6c, 0x79, 0x20, 0x43, 0x6c, 0x69, 0xeb, 0x16, 0x04, 0x7d, 0x00, 0x10, 0x76, 0x2d, 0x2c, 0x4f, 0x63, 0x6c, 0x69,
+                0x70, 0x9a, 0x05, 0x01, 0x0f, 0x02, 0x02, 0x3a, 0x0f, 0x6a, 0x00, 0x02, 0x00, 0xf9, 0x94, 0x00, 0x14, 0x00, 0x15, 0x70,
+                0x76, 0x16, 0x09, 0x2a, 0x00, 0x0f, 0x39, 0x01, 0x08, 0x0f, 0xaf, 0x01, 0x2f, 0x0f, 0x3b, 0x01, 0x17, 0x1d, 0x75, 0xb1,
+                0x1f, 0x06, 0xa7, 0x00, 0x3f, 0x75, 0x6c, 0x6c, 0x3b, 0x01, 0x54, 0x0b, 0x6a, 0x00, 0x01, 0x3b, 0x01, 0x01, 0x69, 0x0b,
+                0x07, 0x74, 0x00, 0x0f, 0x2a, 0x00, 0x06, 0x00, 0xab, 0x11, 0x09, 0x2a, 0x00, 0x0f, 0x3b, 0x01, 0x53, 0x10, 0x28, 0xad,
+                0x7b, 0x01, 0x29, 0xa8, 0x15, 0x73, 0xb5, 0x03, 0x04, 0xa7, 0x00, 0x0f, 0x9f, 0x08, 0x08, 0x0f, 0xb1, 0x03, 0x61, 0x01,
+                0x94, 0x00, 0x0f, 0x71, 0x02, 0x0a, 0x0f, 0x74, 0x00, 0x15, 0x08, 0x4a, 0x00, 0x06, 0xaa, 0x03, 0x06, 0x3b, 0x01, 0x0f,
+                0xba, 0xfd, 0x7e, 0x01, 0x0f, 0x10, 0x0f, 0x74, 0x5f, 0x25, 0x05, 0x4f, 0x0d, 0x09, 0x10, 0x14, 0x0f, 0xf3, 0x5e, 0x11,
+                0x0b, 0xb8, 0x0d, 0x0f, 0xf6, 0x5f, 0x26, 0x05, 0x36, 0x0d, 0x0f, 0x82, 0x00, 0x21, 0x08, 0x9f, 0x0d, 0x0f, 0x82, 0x00,
+                0x29, 0x02, 0x1d, 0x0d, 0x0f, 0x82, 0x00, 0x21, 0x08, 0x86, 0x0d, 0x0f, 0x82, 0x00, 0x24, 0x08, 0x71, 0x0f, 0x0f, 0x83,
+                0x00, 0x1c, 0x0e, 0xdb, 0x0f, 0x0f, 0x84, 0x00, 0x24, 0x08, 0x5a, 0x0f, 0x0f, 0x84, 0x00, 0x1c, 0x0e, 0xc4, 0x0f, 0x0f,
+                0x84, 0x00, 0x2a, 0x0f, 0x0d, 0x02, 0x22, 0x0e, 0xad, 0x0f, 0x0f, 0x84, 0x00, 0x2a, 0x0f, 0x0f, 0x02, 0x22, 0x0e, 0x96,
+                0x0f, 0x0f, 0x29, 0x17, 0x3c, 0x02, 0x17, 0xd2, 0x0f, 0x26, 0x17, 0x30, 0x10, 0x70, 0x1e, 0x38, 0x11, 0x73, 0x48, 0x1c,
+                0x04, 0x0d, 0x00, 0x20, 0x4b, 0x69, 0x49, 0x02, 0x04, 0x0e, 0x00, 0x11, 0x4f, 0xcb, 0x00, 0x40, 0x2c, 0x20, 0x73, 0x61,
+                0x30, 0x01, 0x04, 0x2a, 0x00, 0x03, 0x0e, 0x00, 0x04, 0x2b, 0x00, 0x03, 0x0f, 0x00, 0x02, 0x2c, 0x00, 0x0f, 0x23, 0x17,
+                0xff, 0xff, 0x96, 0x07, 0xfa, 0x02, 0x06, 0x1a, 0x00, 0x0f, 0x89, 0x13, 0x08, 0x07, 0x30, 0x00, 0x0f, 0x4b, 0x2e, 0x02,
+                0x06, 0x1f, 0x00, 0x06, 0xb9, 0x9b, 0x0f, 0x8b, 0x13, 0x09, 0x0f, 0x50, 0x00, 0x12, 0x02, 0x61, 0x03, 0x0f, 0x9f, 0x00,
+                0x17, 0x02, 0x30, 0x00, 0x0f, 0x50, 0x00, 0x0d, 0x0f, 0x96, 0x16, 0x12, 0x0f, 0x51, 0x00, 0x13, 0x02, 0xf3, 0x03, 0x0f,
+                0xa1, 0x00, 0x17, 0x03, 0x23, 0x04, 0x0f, 0x50, 0x00, 0x0c, 0x0f, 0xa1, 0x00, 0x18, 0x0f, 0x51, 0x00, 0x07, 0x08, 0xb2,
+                0x04, 0x0f, 0xa1, 0x00, 0x11, 0x08, 0x30, 0x00, 0x0f, 0x50, 0x00, 0x0d, 0x0f, 0xa1, 0x00, 0x12, 0x0f, 0x51, 0x00, 0x14,
+                0x0a, 0xe4, 0x01, 0x0f, 0xa1, 0x00, 0x0f, 0x0f, 0x93, 0x01, 0x07, 0x09, 0x21, 0x00, 0x0f, 0x0f, 0x16, 0x11, 0x0f, 0x52,
+                0x00, 0x15, 0x0a, 0xe6, 0x01, 0x0f, 0xa3, 0x00, 0x0f, 0x0f, 0x95, 0x01, 0x0e, 0x0a, 0xe7, 0x01, 0x0f, 0xa3, 0x00, 0x10,
+                0x0f, 0x52, 0x00, 0x00, 0x0f, 0xcc, 0x5e, 0x17, 0x07, 0xdb, 0x0c, 0x5f, 0x5a, 0x43, 0x55, 0x4c, 0x4c, 0xbd, 0x11, 0x08,
+                0x03, 0x96, 0xd5, 0x27, 0x5f, 0x7a, 0x7c, 0x0d, 0x03, 0x83, 0x00, 0x0f, 0x47, 0x0c, 0x06, 0x0f, 0x34, 0x00, 0x08, 0x02,
+                0x10, 0xa4, 0x1b, 0x6a, 0x8e, 0x25, 0x0f, 0x34, 0x00, 0x0f, 0x20, 0x61, 0x63, 0x89, 0x87, 0x0b, 0x34, 0x00, 0x0f, 0x03,
+                0x0d, 0x14, 0x0f, 0x37, 0x0d, 0x21, 0x0f, 0x34, 0x00, 0x2c, 0x0f, 0x47, 0x0e, 0x04, 0x32, 0x52, 0x4f, 0x50, 0xa3, 0x24,
+                0x0f, 0x9f, 0x15, 0x03, 0x10, 0x70, 0xb4, 0xce, 0x04, 0x3e, 0x0e, 0x01, 0xcd, 0x03, 0x80, 0x5f, 0x74, 0x79, 0x70, 0x65,
+                0x5f, 0x33, 0x64, 0xd1, 0x3c, 0x10, 0x6c, 0xa9, 0x25, 0x0d, 0x4e, 0x2c, 0x0f, 0x04, 0x01, 0x59, 0x0f, 0x47, 0x2c, 0x19,
+                0x0f, 0x6c, 0x01, 0x72, 0x6f, 0x45, 0x61, 0x72, 0x6c, 0x79, 0x5a, 0x83, 0x19, 0x02, 0x0f, 0xd0, 0x00, 0x21, 0x02, 0xa0,
+                0x01, 0x10, 0x65, 0x55, 0x00, 0x31, 0x7a, 0x5f, 0x6b, 0x24, 0x04, 0x04, 0xa8, 0x01, 0x0f, 0xa0, 0x01, 0x0a, 0x0f, 0x68,
+                0x00, 0x2a, 0x0f, 0x73, 0x03, 0x10, 0x0f, 0x9c, 0x00, 0x05, 0x0f, 0xa8, 0x03, 0x0d, 0x09, 0x34, 0x00, 0x03, 0xd7, 0x0f,
+                0x0f, 0x34, 0x00, 0x0b, 0x0f, 0x6c, 0x01, 0x04, 0x07, 0x52, 0x43, 0x12, 0x28, 0x74, 0x01, 0x30, 0x20, 0x2b, 0x20, 0x15,
+                0x23, 0x11, 0x5a, 0x12, 0x2f, 0x0f, 0xe1, 0x15, 0x09, 0x21, 0x70, 0x73, 0xae, 0x00, 0x85, 0x6d, 0x61, 0x73, 0x6b, 0x5f,
+                0x6f, 0x66, 0x66, 0x56, 0x32, 0x0f, 0x70, 0x02, 0x25, 0x0f, 0xa4, 0x02, 0x83, 0x0f, 0xd8, 0x02, 0x3c, 0x01, 0x5b, 0x01,
+                0x0f, 0xe3, 0x19, 0x07, 0x0f, 0x38, 0x01, 0x55, 0x0f, 0x34, 0x00, 0x51, 0x02, 0xa4, 0x02, 0x00, 0x1d, 0x29, 0x0f, 0xd7,
+                0x02, 0x13, 0x0c, 0x34, 0x00, 0x0f, 0xd7, 0x02, 0x11, 0x0f, 0x6c, 0x01, 0x05, 0x01, 0x30, 0xdc, 0x0f, 0x9c, 0x00, 0x0e,
+                0x00, 0x06, 0x00, 0x11, 0x32, 0x95, 0xd8, 0x0f, 0x0c, 0x04, 0x0a, 0x0f, 0xb0, 0x05, 0x94, 0x0f, 0x34, 0x00, 0x4f, 0x0f,
+                0xd8, 0x02, 0x08, 0x3f, 0x43, 0x6f, 0x6c, 0x32, 0x1f, 0x01, 0x0f, 0xd8, 0x02, 0xc1, 0x0f, 0x6c, 0x01, 0x69, 0x01, 0xe2,
+                0xda, 0x0f, 0xd8, 0x02, 0x13, 0x01, 0x47, 0xd7, 0x0f, 0xd8, 0x02, 0x15, 0x0f, 0x6c, 0x01, 0xee, 0x0f, 0x00, 0x17, 0xb9,
+                0x08, 0x8f, 0x0f, 0x0f, 0xee, 0x13, 0x1c, 0x0e, 0xfb, 0x0f, 0x0f, 0x72, 0x14, 0x24, 0x09, 0x73, 0x0f, 0x0f, 0x85, 0x00,
+                0x22, 0x09, 0xfb, 0x0d, 0x0f, 0x86, 0x00, 0x2a, 0x03, 0x71, 0x0d, 0x0f, 0x86, 0x00, 0x22, 0x09, 0xde, 0x0d, 0x0f, 0x86,
+                0x00, 0x24, 0x09, 0x3d, 0x0f, 0x0f, 0x86, 0x00, 0x1c, 0x0f, 0xaa, 0x0f, 0x00, 0x0f, 0x86, 0x00, 0x2b, 0x0f, 0x93, 0x01,
+                0x23, 0x0f, 0x8f, 0x0f, 0x01, 0x0f, 0x88, 0x00, 0x2b, 0x0f, 0x95, 0x01, 0x23, 0x0f, 0x74, 0x0f, 0x01, 0x0f, 0x90, 0x16,
+                0x3e, 0x9f, 0x79, 0x74, 0x72, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x5f, 0x22, 0xbc, 0x08, 0x00, 0x9d, 0x0f, 0x07, 0xdc, 0x87,
+                0x0c, 0xa5, 0x0f, 0x35, 0x20, 0x20, 0x27, 0x55, 0x43, 0x03, 0x96, 0xc0, 0x0a, 0x45, 0xb1, 0x02, 0xc2, 0x3f, 0x4d, 0x20,
+                0x52, 0x61, 0x79, 0x1a, 0x00, 0x5f, 0x49, 0x6e, 0x69, 0x74, 0x69, 0x1c, 0x00, 0x04, 0x6c, 0x52, 0x65, 0x63, 0x61, 0x73,
+                0x74, 0x1b, 0x00, 0x08, 0xb4, 0x04, 0x00, 0x99, 0x00, 0x07, 0x66, 0x14, 0x0f, 0x99, 0x00, 0x00, 0x20, 0x72, 0x74, 0x7f,
+                0x34, 0x14, 0x5f, 0x83, 0x4b, 0x06, 0xd6, 0x43, 0x0f, 0x27, 0x00, 0x03, 0x1f, 0x72, 0x87, 0x00, 0x00, 0x08, 0x1c, 0x00,
+                0x10, 0x5f, 0x92, 0x00, 0x4f, 0x5f, 0x61, 0x70, 0x69, 0x25, 0x00, 0x0f, 0x59, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x6a, 0x00,
+                0x0d, 0x6e, 0x05, 0x01, 0x05, 0x79, 0x03, 0x87, 0xb1, 0x29, 0x20, 0x3c, 0x63, 0x01, 0x05, 0x8d, 0xb1, 0x3e, 0x69, 0x2b,
+                0x2b, 0xe2, 0xb1, 0x03, 0xf4, 0x00, 0x0a, 0xae, 0x43, 0x2a, 0x73, 0x5b, 0x11, 0xb1, 0x06, 0x2b, 0xa1, 0x0f, 0x19, 0x44,
+                0x06, 0x0f, 0x8a, 0x8e, 0x07, 0x03, 0x00, 0xa1, 0x05, 0x61, 0x00, 0x0f, 0x81, 0x8e, 0x08, 0x1f, 0x73, 0x5b, 0x46, 0x02,
+                0x09, 0x62, 0x00, 0x01, 0x82, 0x71, 0x6f, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x6d, 0x00, 0x02, 0x04, 0x53, 0x46, 0x0b,
+                0x6d, 0x00, 0x08, 0x37, 0x00, 0x0e, 0x36, 0x00, 0x20, 0x61, 0x76, 0x0a, 0x79, 0x0f, 0x78, 0x00, 0x07, 0x0d, 0xef, 0x44,
+                0x05, 0x37, 0x00, 0x0e, 0x6d, 0x00, 0x0c, 0xe5, 0x44, 0x06, 0x30, 0xa0, 0x0f, 0x62, 0x00, 0x0c, 0x0f, 0xd2, 0x71, 0x0c,
+                0x0f, 0x1f, 0xa0, 0x07, 0x0d, 0x80, 0x00, 0x0f, 0x1c, 0x72, 0x18, 0x03, 0xc9, 0x00, 0x10, 0x70, 0x81, 0x45, 0x0f, 0x9e,
+                0x00, 0x0c, 0x0e, 0x4b, 0x73, 0x0f, 0x49, 0x00, 0x02, 0x0f, 0x92, 0x00, 0x04, 0x0d, 0x3e, 0x00, 0x0f, 0x3d, 0x00, 0x01,
+                0x0f, 0xfe, 0x01, 0x0b, 0x0f, 0x01, 0xa2, 0x01, 0x0f, 0x46, 0x00, 0x02, 0x0f, 0x83, 0x00, 0x05, 0x09, 0x3b, 0x00, 0x0f,
+                0x02, 0xa1, 0x4e, 0x08, 0x84, 0x03, 0x3f, 0x5b, 0x69, 0x5d, 0xa5, 0x33, 0x1f, 0x3f, 0x61, 0x76, 0x67, 0xe8, 0x05, 0x19,
+                0x02, 0x8e, 0x02, 0x0f, 0x0d, 0x34, 0x20, 0x1f, 0x61, 0x63, 0xa0, 0x00, 0x0f, 0x6b, 0x00, 0x0c, 0x0f, 0xce, 0xa0, 0x25,
+                0x10, 0x61, 0x1d, 0x77, 0x0f, 0x6b, 0x00, 0x1c, 0x0f, 0x6a, 0x81, 0x24, 0x0d, 0x08, 0xa2, 0x0f, 0x68, 0x00, 0x0b, 0x0f,
+                0x0a, 0xa2, 0x22, 0x01, 0x68, 0x00, 0x0c, 0x4b, 0x82, 0x0f, 0x68, 0x00, 0x0c, 0x0f, 0xd0, 0x00, 0x21, 0x0f, 0xa0, 0xa1,
+                0x02, 0x0f, 0x68, 0x00, 0x0b, 0x0f, 0xa2, 0xa1, 0x43, 0x0f, 0x74, 0x00, 0x1f, 0x0f, 0x7b, 0xc4, 0x2f, 0x12, 0x32, 0xab,
+                0xfe, 0x0c, 0x7e, 0xc4, 0x22, 0x42, 0x79, 0xf3, 0x40, 0x13, 0x41, 0x06, 0xdb, 0x0f, 0x8e, 0xc4, 0xc8, 0x0f, 0x8a, 0xb8,
+                0x04, 0x0d, 0x70, 0x00, 0x0f, 0x8a, 0xb8, 0x3b, 0x0a, 0x7b, 0x00, 0x0a, 0x8b, 0xb8, 0x0e, 0x7b, 0x00, 0x0f, 0x8b, 0xb8,
+                0x2f, 0x07, 0x70, 0x00, 0x0d, 0x8c, 0xb8, 0x0f, 0xeb, 0x00, 0x39, 0x0f, 0x8c, 0xb8, 0x10, 0x0d, 0x8b, 0x00, 0x07, 0xed,
+                0x1b, 0x0f, 0xfb, 0x00, 0x21, 0x0f, 0x8d, 0xb8, 0x1c, 0x0e, 0x63, 0x00, 0x09, 0x8d, 0xb8, 0x0f, 0x28, 0x7a, 0x01, 0x0f,
+                0x91, 0xb8, 0x06, 0x0f, 0x1e, 0x00, 0x03, 0x0f, 0x96, 0xb8, 0x02, 0x0f, 0xf6, 0x00, 0x06, 0x0f, 0x4c, 0x00, 0x00, 0x0f,
+                0xa0, 0xb8, 0x0f, 0x0f, 0x55, 0xc7, 0x15, 0x02, 0xee, 0x00, 0x06, 0xe3, 0x02, 0x20, 0x3d, 0x3d, 0x3e, 0xda, 0x6f, 0x20,
+                0x3f, 0x20, 0x31, 0x20, 0x3a, 0x72, 0xc7, 0x26, 0x0f, 0xd0, 0x01, 0x01, 0x01, 0x08, 0xda, 0x07, 0x69, 0x03, 0x0f, 0x54,
+                0x00, 0x05, 0x05, 0x9d, 0x00, 0x06, 0x18, 0x00, 0x02, 0x3c, 0x00, 0x01, 0x29, 0x02, 0x2a, 0x20, 0x2b, 0x8e, 0x7c, 0x0f,
+                0xd0, 0xc7, 0x2b, 0x0f, 0x3a, 0xe3, 0x0c, 0x0f, 0x2e, 0xe3, 0x10, 0x07, 0xa2, 0xc5, 0x2f, 0x50, 0x43, 0x4d, 0xe4, 0x16,
+                0x2f, 0x67, 0x70, 0xc9, 0xfc, 0x14, 0x06, 0x5f, 0x00, 0xf2, 0x01, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22,
+                0x23, 0x4c, 0x31, 0x54, 0x45, 0x58, 0x2d, 0x96, 0x05, 0x13, 0x2d, 0x97, 0x05, 0x21, 0x22, 0x3e, 0x16, 0x00, 0x02, 0x94,
+                0xfd, 0x4f, 0x3c, 0x2f, 0x61, 0x3e, 0x2b, 0xfe, 0x1d, 0x0f, 0x04, 0xee, 0x3d, 0x0f, 0x5d, 0x00, 0x00, 0x0f, 0xc9, 0xff,
+                0x50, 0x0f, 0x10, 0xe4, 0x15, 0x0f, 0xc9, 0xff, 0x30, 0x06, 0x6b, 0x00, 0x0f, 0xc9, 0xff, 0x50, 0x08, 0x41, 0x01, 0x0f,
+                0xc9, 0xff, 0x17, 0x0f, 0xbb, 0xff, 0x48, 0x0f, 0xbd, 0xfd, 0x24, 0x0f, 0xa1, 0xe5, 0x23, 0x0f, 0x9f, 0xfd, 0x21, 0x0f,
+                0x56, 0xfd, 0xff, 0x00, 0x0f, 0xc8, 0xfa, 0x32, 0x0f, 0x6b, 0xfa, 0xe1, 0x0f, 0xc5, 0xf7, 0x18, 0x0f, 0x7a, 0xf7, 0xff,
+                0x04, 0x0f, 0xe0, 0xf4, 0x18, 0x0f, 0x95, 0xf4, 0xf7, 0x0f, 0xbf, 0xc6, 0x07, 0x0f, 0xac, 0xf1, 0x1c, 0x0f, 0x69, 0x08,
+                0x1d, 0x0f, 0x0f, 0xf2, 0x20, 0x0f, 0xc5, 0xf1, 0xf5, 0x0f, 0xb4, 0x01, 0x07, 0x0f, 0x6a, 0xee, 0x2f, 0x0f, 0xb4, 0x01,
+                0x0e, 0x0f, 0x63, 0x00, 0x42, 0x0f, 0x0b, 0xee, 0xcf, 0x0f, 0x12, 0xcc, 0x13, 0x0f, 0x25, 0xee, 0x13, 0x0f, 0x19, 0xee,
+                0x0e, 0x0f, 0x2e, 0x0c, 0x30, 0x0f, 0x74, 0xee, 0x07, 0x0f, 0x2c, 0x0c, 0x56, 0x0f, 0xe8, 0xf8, 0x3b, 0x0d, 0x5b, 0x00,
+                0x0f, 0x28, 0x0c, 0x50, 0x0f, 0xf7, 0xee, 0x13, 0x0f, 0x26, 0x0c, 0x30, 0x04, 0x69, 0x00, 0x0f, 0x24, 0x0c, 0x50, 0x06,
+                0x3b, 0x01, 0x0f, 0x22, 0x0c, 0xff, 0x1e, 0x0f, 0xd0, 0x02, 0x3b, 0x0c, 0x5a, 0x00, 0x0f, 0x1e, 0x0c, 0x4f, 0x0f, 0xc5,
+                0xf1, 0x2f, 0x0f, 0x1c, 0x0c, 0x76, 0x0f, 0x31, 0x01, 0x47, 0x0f, 0x6a, 0x00, 0x05, 0x0f, 0x18, 0x0c, 0x5c, 0x0f, 0x6c,
+                0x02, 0x3b, 0x0e, 0x5c, 0x00, 0x0f, 0x14, 0x0c, 0x51, 0x0f, 0x3b, 0x01, 0x2f, 0x0f, 0x12, 0x0c, 0x22, 0x0f, 0x5f, 0xff,
+                0xe7, 0x0f, 0x0c, 0x0c, 0x40, 0x0f, 0x47, 0x08, 0x11, 0x0f, 0x0a, 0x0c, 0x2a, 0x0f, 0x8a, 0xfc, 0xe5, 0x0f, 0x04, 0x0c,
+                0x40, 0x0f, 0xac, 0x01, 0x15, 0x0f, 0x61, 0x00, 0x40, 0x0f, 0xc8, 0xf8, 0xcb, 0x0f, 0xfc, 0x0b, 0x13, 0x0f, 0xe2, 0xf8,
+                0x15, 0x0f, 0x7f, 0xfc, 0x1a, 0x0f, 0x00, 0x0c, 0x26, 0x0f, 0x13, 0xfc, 0x13, 0x0f, 0x02, 0x0c, 0x4c, 0x0f, 0xb8, 0xf9,
+                0x38, 0x0f, 0x5d, 0x00, 0x05, 0x0f, 0x06, 0x0c, 0x50, 0x0f, 0xb8, 0xf9, 0x15, 0x0f, 0x08, 0x0c, 0x30, 0x06, 0x6b, 0x00,
+                0x0f, 0x0a, 0x0c, 0x50, 0x08, 0x41, 0x01, 0x0f, 0x0c, 0x0c, 0xff, 0x1e, 0x0f, 0xda, 0x02, 0x3d, 0x0e, 0x5c, 0x00, 0x0f,
+                0x10, 0x0c, 0x4f, 0x0f, 0x90, 0xfc, 0x25, 0x0f, 0x12, 0x0c, 0x82, 0x0f, 0x35, 0x01, 0x49, 0x0f, 0x6c, 0x00, 0x07, 0x0f,
+                0x16, 0x0c, 0x5c, 0x0f, 0x76, 0x02, 0x3d, 0x0f, 0x5e, 0x00, 0x01, 0x0f, 0x1a, 0x0c, 0x51, 0x0f, 0x41, 0x01, 0x31, 0x0f,
+                0x1c, 0x0c, 0x22, 0x0f, 0x41, 0x01, 0x3d, 0x0f, 0x5e, 0x00, 0x01, 0x0f, 0x20, 0x0c, 0x51, 0x0f, 0x41, 0x01, 0x25, 0x0f,
+                0x22, 0x0c, 0x40, 0x0f, 0x69, 0x08, 0x13, 0x0f, 0x24, 0x0c, 0x2a, 0x0f, 0xb6, 0x01, 0x38, 0x0f, 0x5d, 0x00, 0x05, 0x0f,
+                0x28, 0x0c, 0x50, 0x0f, 0xb4, 0x01, 0x3f, 0x0f, 0xc9, 0x0b, 0x26, 0x0f, 0xb4, 0x01, 0x17, 0x0f, 0x63, 0x00, 0x42, 0x0f,
+                0x2e, 0x0c, 0x2e, 0x0f, 0xb4, 0x01, 0x49, 0x0f, 0x69, 0x00, 0x04, 0x0f, 0x32, 0x0c, 0x2d, 0x0f, 0xf9, 0xe1, 0xff, 0x40,
+                0x0e, 0x47, 0xdf, 0x01, 0x85, 0xdc, 0x0a, 0x4c, 0xdf, 0x07, 0x13, 0x00, 0x0f, 0x51, 0xdf, 0x1a, 0x0d, 0x4b, 0x00, 0x0e,
+                0x56, 0xdf, 0x0a, 0x5b, 0x00, 0x0f, 0x5b, 0xdf, 0x01, 0x2f, 0x20, 0x20, 0x5d, 0xdf, 0xff, 0x45, 0x0f, 0x7b, 0x01, 0x02,
+                0x0b, 0x90, 0x00, 0x0b, 0xfa, 0x01, 0x0f, 0x67, 0xdf, 0x56, 0x0f, 0x9c, 0x00, 0x06, 0x07, 0xb8, 0x2d, 0x0a, 0x24, 0x00,
+                0x0f, 0x71, 0xdf, 0x05, 0x05, 0xf1, 0xe2, 0x06, 0x76, 0x29, 0x10, 0x3e, 0x75, 0x29, 0x0e, 0x97, 0x03, 0x0f, 0x9b, 0xdf,
+                0x24, 0x0c, 0x78, 0x03, 0x0f, 0xf9, 0x4a, 0x02, 0x05, 0x47, 0x04, 0x20, 0x6a, 0x6a, 0xc3, 0x77, 0x10, 0x3b, 0x08, 0x00,
+                0x02, 0x47, 0x04, 0x02, 0x6f, 0x29, 0x00, 0x45, 0x04, 0x2f, 0x6a, 0x6a, 0x3e, 0x4a, 0x01, 0x0f, 0x97, 0x93, 0x02, 0x0f,
+                0xd8, 0x02, 0x01, 0x1e, 0x27, 0x36, 0x04, 0x0f, 0x3e, 0x00, 0x0b, 0x03, 0x95, 0x9c, 0x0f, 0x37, 0x00, 0x54, 0x04, 0xf8,
+                0x01, 0x0f, 0x3c, 0x00, 0x03, 0x0b, 0xdd, 0x4b, 0x0f, 0xfa, 0xe0, 0xb8, 0x0f, 0xd3, 0x2f, 0x07, 0x14, 0x4f, 0x7c, 0xc7,
+                0x0f, 0xce, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xa6, 0x0f, 0x73, 0x0c, 0x0d, 0x0a, 0x57, 0x0c, 0x0f, 0x7c, 0x0d, 0x04, 0x0f,
+                0x13, 0x30, 0x1b, 0x0f, 0x54, 0x00, 0x09, 0x0f, 0x1d, 0x30, 0x38, 0x0f, 0x67, 0x00, 0x0b, 0x0f, 0x27, 0x30, 0x5e, 0x0f,
+                0xa1, 0x0d, 0x1a, 0x0f, 0x4c, 0x16, 0x26, 0x0f, 0xa2, 0x26, 0x04, 0x0f, 0x6e, 0x00, 0x0b, 0x0f, 0x2d, 0x2e, 0x32, 0x0f,
+                0xe0, 0x00, 0x1a, 0x0f, 0x2a, 0x15, 0x1c, 0x0f, 0x6c, 0x00, 0x2a, 0x0f, 0x8b, 0x2c, 0x28, 0x0f, 0x68, 0x00, 0x1a, 0x0f,
+                0xb2, 0x2b, 0x28, 0x0f, 0x68, 0x00, 0x0e, 0x0f, 0xfc, 0x13, 0x09, 0x0f, 0x78, 0x2a, 0x2c, 0x0f, 0x27, 0x03, 0x17, 0x0f,
+                0xe5, 0x2a, 0x30, 0x0f, 0xe9, 0x00, 0x2a, 0x0f, 0xad, 0x29, 0x2c, 0x0f, 0xe9, 0x00, 0x1b, 0x0f, 0x6d, 0x00, 0x3b, 0x0f,
+                0xd9, 0x12, 0x29, 0x0f, 0x47, 0x29, 0x20, 0x0f, 0x62, 0x05, 0x4e, 0x0f, 0x65, 0x00, 0x0f, 0x0f, 0x5b, 0x29, 0x5c, 0x0f,
+                0x5e, 0x05, 0x5d, 0x07, 0xfe, 0x1f, 0x0f, 0x5c, 0x05, 0x4a, 0x0f, 0xdc, 0x00, 0x1e, 0x0f, 0x5a, 0x05, 0x26, 0x0f, 0x6a,
+                0x00, 0x1e, 0x0f, 0xcb, 0x25, 0x26, 0x0f, 0x56, 0x05, 0x4f, 0x0f, 0x66, 0x00, 0x12, 0x0f, 0x54, 0x05, 0x42, 0x0f, 0x19,
+                0x03, 0x1b, 0x0f, 0x2d, 0x24, 0x2e, 0x0f, 0x50, 0x05, 0x63, 0x0f, 0xe5, 0x00, 0x1f, 0x0f, 0x6b, 0x00, 0x39, 0x0f, 0x4c,
+                0x05, 0x29, 0x0f, 0x97, 0x22, 0x24, 0x0f, 0x50, 0x05, 0x4e, 0x0f, 0x67, 0x00, 0x11, 0x0f, 0xab, 0x22, 0x5e, 0x0f, 0x54,
+                0x05, 0x5d, 0x09, 0x26, 0x19, 0x0f, 0x56, 0x05, 0x4a, 0x0f, 0xe0, 0x00, 0x20, 0x0f, 0x58, 0x05, 0x26, 0x0f, 0x6c, 0x00,
+                0x20, 0x0f, 0x0f, 0x1f, 0x28, 0x0f, 0x5c, 0x05, 0x4f, 0x0f, 0x68, 0x00, 0x14, 0x0f, 0x5e, 0x05, 0x42, 0x0f, 0x27, 0x03,
+                0x1d, 0x0f, 0x69, 0x1d, 0x30, 0x0f, 0x62, 0x05, 0x63, 0x0f, 0xe9, 0x00, 0x21, 0x0f, 0x6d, 0x00, 0x3b, 0x0f, 0x09, 0x28,
+                0x35, 0x0f, 0x6b, 0x1c, 0x0e, 0x0b, 0x4f, 0x1c, 0x0f, 0x62, 0x10, 0x36, 0x0f, 0x55, 0x00, 0x06, 0x0f, 0x63, 0x10, 0x3c,
+                0x0f, 0x68, 0x00, 0x08, 0x0f, 0x64, 0x10, 0x62, 0x0f, 0x97, 0x27, 0x17, 0x0f, 0xf7, 0x0f, 0x36, 0x0f, 0x73, 0x00, 0x17,
+                0x0f, 0xf8, 0x0f, 0x30, 0x0f, 0x6d, 0x00, 0x17, 0x0f, 0xf9, 0x0f, 0x2c, 0x0f, 0x69, 0x00, 0x17, 0x0f, 0xfa, 0x0f, 0x2c,
+                0x0f, 0xf7, 0x23, 0x27, 0x0f, 0x8e, 0x0f, 0x30, 0x0f, 0xbf, 0x02, 0x14, 0x0f, 0xfc, 0x0f, 0x34, 0x0f, 0xeb, 0x00, 0x27,
+                0x0f, 0x90, 0x0f, 0x30, 0x0f, 0xeb, 0x00, 0x18, 0x0f, 0x6e, 0x00, 0x3c, 0x0f, 0xff, 0x0f, 0x60, 0x0f, 0xff, 0x04, 0x4b,
+                0x0f, 0x66, 0x00, 0x10, 0x0f, 0x01, 0x10, 0x60, 0x0f, 0xfb, 0x04, 0x56, 0x0f, 0x71, 0x00, 0x1f, 0x0f, 0x97, 0x0f, 0x2e,
+                0x0f, 0xf7, 0x04, 0x4c, 0x0f, 0x67, 0x00, 0x1f, 0x0f, 0x99, 0x0f, 0x2a, 0x0f, 0xf3, 0x04, 0x60, 0x0f, 0xb3, 0x02, 0x1c,
+                0x0f, 0x9b, 0x0f, 0x32, 0x0f, 0xef, 0x04, 0x60, 0x0f, 0xe7, 0x00, 0x20, 0x0f, 0x6c, 0x00, 0x3a, 0x0f, 0x9e, 0x0f, 0x64,
+                0x0f, 0xef, 0x04, 0x4b, 0x0f, 0x68, 0x00, 0x12, 0x0f, 0xa0, 0x0f, 0x62, 0x0f, 0xf3, 0x04, 0x56, 0x0f, 0x73, 0x00, 0x21,
+                0x0f, 0x34, 0x0f, 0x30, 0x0f, 0xf7, 0x04, 0x4c, 0x0f, 0x69, 0x00, 0x21, 0x0f, 0x36, 0x0f, 0x2c, 0x0f, 0xfb, 0x04, 0x60,
+                0x0f, 0xbf, 0x02, 0x1e, 0x0f, 0x38, 0x0f, 0x34, 0x0f, 0xff, 0x04, 0x60, 0x0f, 0xeb, 0x00, 0x22, 0x0f, 0x6e, 0x00, 0x3c,
+                0x0f, 0x3b, 0x0f, 0x35, 0x0f, 0x37, 0x35, 0x0f, 0x0a, 0x1b, 0x35, 0x0f, 0x3b, 0x0f, 0x36, 0x0f, 0x54, 0x00, 0x05, 0x0f,
+                0x3a, 0x0f, 0x3c, 0x0f, 0x67, 0x00, 0x07, 0x0f, 0x39, 0x0f, 0x62, 0x0f, 0x65, 0x36, 0x0a, 0x0f, 0xb0, 0x0b, 0x4e, 0x0f,
+                0x74, 0x01, 0x4a, 0x0f, 0x65, 0x00, 0x0f, 0x0f, 0xae, 0x0b, 0x60, 0x0f, 0x70, 0x01, 0x34, 0x0f, 0x35, 0x08, 0x28, 0x0f,
+                0x74, 0x01, 0x4a, 0x0f, 0x67, 0x00, 0x11, 0x0f, 0x33, 0x08, 0x62, 0x0f, 0x78, 0x01, 0x28, 0x0f, 0xaa, 0x04, 0x05, 0x0f,
+                0x77, 0x39, 0x12, 0x09, 0x5b, 0x39, 0x0f, 0x49, 0x24, 0x38, 0x0f, 0x48, 0x24, 0x53, 0x0f, 0x47, 0x24, 0x7b, 0x0f, 0x58,
+                0x20, 0x6a, 0x0f, 0x57, 0x20, 0x51, 0x0f, 0x56, 0x20, 0x79, 0x0f, 0x79, 0x1c, 0x6e, 0x0f, 0x78, 0x1c, 0x53, 0x0f, 0x77,
+                0x1c, 0x7b, 0x0f, 0x88, 0x18, 0x29, 0x0f, 0x5f, 0x34, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x40, 0x41, 0x64, 0x64,
+                0x69, 0x09, 0x00, 0x22, 0x61, 0x6c, 0xdc, 0x02, 0x28, 0x73, 0x28, 0xe0, 0x01, 0x0a, 0xaf, 0xc6, 0xf9, 0x00, 0x22, 0x69,
+                0x64, 0x63, 0x5f, 0x5f, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x73, 0x22, 0x90, 0x00, 0x0f, 0x28, 0x00, 0x07, 0x07,
+                0xfc, 0x31, 0x0f, 0x33, 0x00, 0x1d, 0x00, 0x6f, 0xa3, 0x0f, 0x34, 0x00, 0x08, 0x02, 0x98, 0xd7, 0x02, 0x8e, 0xd7, 0x05,
+                0x66, 0xfe, 0xa1, 0x77, 0x61, 0x76, 0x65, 0x66, 0x72, 0x6f, 0x6e, 0x74, 0x73, 0xb2, 0xd7, 0x2f, 0x6c, 0x67, 0x41, 0x00,
+                0x2c, 0x02, 0xf3, 0xd7, 0x0f, 0x45, 0x00, 0x2d, 0x02, 0x53, 0xa0, 0x0f, 0x46, 0x00, 0x19, 0x00, 0x0f, 0x00, 0x0f, 0x46,
+                0x00, 0x42, 0x03, 0xea, 0xa0, 0x0f, 0x46, 0x00, 0x0f, 0x01, 0xc8, 0x00, 0x00, 0x59, 0x12, 0x00, 0x75, 0x8e, 0x03, 0xdc,
+                0xad, 0x0f, 0x36, 0x00, 0x12, 0x10, 0x69, 0x4b, 0xba, 0x0f, 0x25, 0x02, 0x0e, 0x03, 0x30, 0x00, 0x01, 0xa2, 0x00, 0x0f,
+                0x66, 0x00, 0x1e, 0x4c, 0x74, 0x65, 0x78, 0x69, 0x86, 0xbc, 0x8f, 0x5f, 0x6f, 0x6e, 0x5f, 0x74, 0x73, 0x6c, 0x31, 0x37,
+                0x02, 0x14, 0x02, 0x43, 0x00, 0x0f, 0xa9, 0x00, 0x1a, 0x60, 0x69, 0x6e, 0x5f, 0x73, 0x6d, 0x32, 0x0e, 0x00, 0x34, 0x72,
+                0x65, 0x71, 0x7e, 0x00, 0x0f, 0xb3, 0x00, 0x0e, 0x00, 0xda, 0x7a, 0x00, 0x65, 0xa7, 0x21, 0x70, 0x71, 0xe2, 0x22, 0x0f,
+                0x38, 0x00, 0x21, 0x01, 0x21, 0x01, 0x0f, 0x39, 0x00, 0x1d, 0x3f, 0x32, 0x72, 0x66, 0x5a, 0x01, 0x19, 0x00, 0x36, 0x00,
+                0x58, 0x70, 0x73, 0x5f, 0x71, 0x75, 0x82, 0x7b, 0x0f, 0x30, 0x00, 0x0a, 0x00, 0x2d, 0xa2, 0x0f, 0xdb, 0xfe, 0x01, 0x0f,
+                0x35, 0x00, 0x22, 0x03, 0x08, 0xff, 0x2f, 0x66, 0x66, 0x3e, 0x00, 0x29, 0x1f, 0x6e, 0x3d, 0x00, 0x0e, 0x02, 0xdd, 0xa2,
+                0x7c, 0x65, 0x6c, 0x69, 0x67, 0x69, 0x62, 0x6c, 0x0f, 0x01, 0x05, 0x2e, 0x37, 0x03, 0x2d, 0x00, 0x71, 0x61, 0x6d, 0x6f,
+                0x72, 0x74, 0x69, 0x7a, 0x00, 0xa3, 0x01, 0x51, 0xbc, 0x01, 0xc2, 0x9f, 0x0b, 0x35, 0x00, 0x06, 0x92, 0xb6, 0x08, 0x2e,
+                0x02, 0x12, 0x6d, 0x36, 0xdc, 0x51, 0x32, 0x78, 0x62, 0x61, 0x72, 0xfc, 0xa3, 0x02, 0x23, 0x00, 0x0f, 0x3c, 0x00, 0x14,
+                0x00, 0x36, 0x00, 0x12, 0x32, 0x0e, 0x00, 0x0a, 0x3c, 0x00, 0x0f, 0x27, 0x3a, 0x0c, 0x33, 0x41, 0x6c, 0x6c, 0xf3, 0x00,
+                0x0f, 0x94, 0xb6, 0x00, 0x0f, 0xb0, 0x71, 0x01, 0x08, 0xa3, 0x0c, 0x06, 0x83, 0x76, 0x04, 0x08, 0x6e, 0x53, 0x69, 0x6e,
+                0x20, 0x67, 0x5f, 0x0d, 0x00, 0x0d, 0xe0, 0xff, 0x06, 0x49, 0x00, 0x02, 0xb8, 0xa4, 0x03, 0x12, 0x00, 0x0f, 0xa8, 0x6a,
+                0x00, 0x0b, 0x2e, 0x00, 0x01, 0x23, 0xa4, 0x0f, 0x57, 0xbd, 0x04, 0x04, 0x7a, 0x00, 0x29, 0x6f, 0x66, 0x34, 0x00, 0x0c,
+                0x7c, 0x00, 0x0f, 0x5c, 0x71, 0xff, 0xff, 0xc3, 0x0c, 0x3a, 0x00, 0x40, 0x64, 0x69, 0x6d, 0x5f, 0xa5, 0x10, 0x0a, 0x86,
+                0x00, 0x31, 0x44, 0x69, 0x6d, 0x6b, 0x11, 0x07, 0x6f, 0x03, 0x0f, 0xe3, 0x02, 0x00, 0x10, 0x62, 0x76, 0x97, 0x11, 0x69,
+                0x78, 0xec, 0x06, 0xc1, 0x03, 0x13, 0x5b, 0x09, 0x00, 0x09, 0x61, 0x0f, 0x0f, 0xc7, 0x71, 0x41, 0x0e, 0x0a, 0x04, 0x0f,
+                0xb1, 0x6f, 0x25, 0x0f, 0xe7, 0xbb, 0x0e, 0x0f, 0xb4, 0x6f, 0x43, 0x0f, 0x77, 0x00, 0x37, 0x0f, 0xa1, 0x72, 0x0e, 0x0f,
+                0x6b, 0x00, 0x0e, 0x0f, 0xa4, 0x72, 0x3a, 0x0f, 0x6e, 0x00, 0x0f, 0x0f, 0xa7, 0x72, 0x39, 0x0f, 0x6e, 0x00, 0x10, 0x0f,
+                0xaa, 0x72, 0x35, 0x0f, 0x6b, 0x00, 0x0e, 0x0f, 0xad, 0x72, 0x37, 0x0f, 0x6b, 0x00, 0x0f, 0x0f, 0xd6, 0x00, 0x1a, 0x05,
+                0xe7, 0x03, 0x0f, 0x04, 0x72, 0x3b, 0x31, 0x41, 0x6c, 0x6c, 0xce, 0x08, 0x0f, 0x08, 0x08, 0x04, 0x01, 0x5d, 0x3f, 0x0f,
+                0x06, 0x08, 0x0c, 0x01, 0x24, 0x00, 0x02, 0x04, 0x08, 0x01, 0x0b, 0x00, 0x0b, 0x86, 0x07, 0x06, 0x43, 0x00, 0x02, 0x00,
+                0x08, 0x01, 0x10, 0x00, 0x0f, 0xfe, 0x07, 0x02, 0x07, 0x2a, 0x00, 0x0f, 0xfc, 0x07, 0x09, 0x02, 0x70, 0x00, 0x00, 0xfb,
+                0x7e, 0x05, 0x30, 0x00, 0x0f, 0xf8, 0x07, 0x01, 0x05, 0xbc, 0x06, 0x01, 0xe0, 0x00, 0x02, 0x96, 0x05, 0x01, 0x32, 0x00,
+                0x00, 0x95, 0x80, 0x00, 0x5c, 0x40, 0x0f, 0x9a, 0x06, 0x08, 0x02, 0x63, 0x00, 0x04, 0x8c, 0x41, 0x0e, 0x29, 0x00, 0x3f,
+                0x72, 0x69, 0x6f, 0x5c, 0x00, 0x06, 0x01, 0x08, 0x00, 0x0f, 0x5e, 0x00, 0x01, 0x20, 0x72, 0x69, 0xbf, 0xea, 0x09, 0x5e,
+                0x00, 0x02, 0x2c, 0x00, 0x0e, 0x2b, 0x00, 0x33, 0x6d, 0x61, 0x78, 0xc9, 0x14, 0x0f, 0x64, 0x00, 0x03, 0x30, 0x6d, 0x61,
+                0x78, 0x6c, 0x01, 0x1f, 0x65, 0x67, 0x00, 0x01, 0x03, 0x3c, 0x00, 0x0c, 0x6b, 0x00, 0x05, 0x33, 0x00, 0x0f, 0x9e, 0x77,
+                0x4e, 0x0c, 0xe1, 0x01, 0x0f, 0xd5, 0x05, 0x17, 0x0f, 0x1a, 0x04, 0x1f, 0x0f, 0xd8, 0x05, 0x9d, 0x3f, 0x72, 0x69, 0x6f,
+                0xa1, 0xc2, 0x1d, 0x01, 0x36, 0x02, 0x0f, 0x6b, 0x00, 0x20, 0x03, 0x08, 0x02, 0x3f, 0x2c, 0x20, 0x34, 0x72, 0x00, 0x1c,
+                0x06, 0x41, 0x02, 0x0f, 0x70, 0x76, 0x3c, 0x36, 0x41, 0x6c, 0x6c, 0x84, 0x00, 0x0f, 0x71, 0x04, 0x04, 0x06, 0xc7, 0x0c,
+                0x0f, 0x76, 0x04, 0x0c, 0x06, 0x29, 0x00, 0x02, 0x7b, 0x04, 0x06, 0x10, 0x00, 0x0b, 0x0e, 0x04, 0x0b, 0x52, 0x00, 0x02,
+                0x85, 0x04, 0x06, 0x15, 0x00, 0x0f, 0x8a, 0x04, 0x02, 0x0c, 0x34, 0x00, 0x0f, 0x8f, 0x04, 0x09, 0x07, 0x89, 0x00, 0x2c,
+                0x6f, 0x66, 0x3a, 0x00, 0x0f, 0x99, 0x04, 0x0a, 0x0a, 0xd6, 0x0d, 0x0f, 0x93, 0x00, 0x02, 0x0d, 0x9a, 0x04, 0x0c, 0x37,
+                0x00, 0x01, 0xb3, 0xf4, 0x08, 0x3a, 0x00, 0x0f, 0xe6, 0x09, 0x0d, 0x07, 0x28, 0x01, 0x16, 0x5b, 0x0c, 0x00, 0x0f, 0xec,
+                0x09, 0x4e, 0x0f, 0xde, 0x00, 0x04, 0x0f, 0xef, 0x09, 0xcf, 0x0f, 0x36, 0x03, 0x28, 0xc9, 0x6f, 0x6e, 0x42, 0x6f, 0x64,
+                0x79, 0x4c, 0x6f, 0x61, 0x64, 0x65, 0x64, 0x6f, 0x15, 0x05, 0x96, 0x01, 0x01, 0x75, 0x18, 0x01, 0xd7, 0x01, 0x3c, 0x72,
+                0x61, 0x6e, 0x24, 0xde, 0x05, 0x26, 0x00, 0x33, 0x67, 0x65, 0x74, 0xb9, 0x01, 0x52, 0x42, 0x79, 0x49, 0x64, 0x28, 0xab,
+                0x18, 0x01, 0x70, 0x10, 0x20, 0x65, 0x78, 0x64, 0x47, 0x9c, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x48, 0x54, 0x4d, 0x4c, 0x4a,
+                0x00, 0x05, 0x4b, 0x00, 0x40, 0x2f, 0x2f, 0x20, 0x43, 0x83, 0x26, 0x00, 0x1b, 0xb5, 0xf0, 0x01, 0x6f, 0x6e, 0x43, 0x6c,
+                0x69, 0x63, 0x6b, 0x20, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x73, 0xee, 0xb5, 0x41, 0x72, 0x65, 0x61, 0x63, 0x23,
+                0xbf, 0x00, 0x21, 0x00, 0x00, 0x76, 0x1c, 0x00, 0x2e, 0x82, 0x50, 0x63, 0x68, 0x65, 0x63, 0x6b, 0xec, 0xbf, 0xb0, 0x74,
+                0x61, 0x74, 0x65, 0x2e, 0x20, 0x20, 0x54, 0x68, 0x69, 0x73, 0x6d, 0xc2, 0x00, 0x41, 0x92, 0x12, 0x63, 0x61, 0xa6, 0x11,
+                0x6c, 0xb3, 0xb3, 0x00, 0x36, 0x03, 0x00, 0x37, 0x00, 0x00, 0x60, 0x01, 0x12, 0x65, 0xa9, 0x00, 0xc3, 0x73, 0x27, 0x20,
+                0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x22, 0x48, 0x00, 0x12, 0x22, 0x49, 0x00, 0x04, 0xa2, 0xb5, 0x00, 0xb0,
+                0x00, 0x15, 0x2e, 0xa1, 0x00, 0x03, 0x95, 0x00, 0x91, 0x5f, 0x53, 0x68, 0x6f, 0x77, 0x57, 0x6f, 0x72, 0x6b, 0xb9, 0x99,
+                0x07, 0x65, 0x01, 0x04, 0x20, 0x00, 0xb2, 0x4d, 0x6f, 0x62, 0x69, 0x6c, 0x65, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0xd1, 0x03,
+                0x05, 0x22, 0x00, 0x00, 0x5b, 0x19, 0x7b, 0x67, 0x5f, 0x64, 0x65, 0x62, 0x75, 0x67, 0xb5, 0x03, 0xe5, 0x6c, 0x65, 0x61,
+                0x72, 0x52, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x64, 0xff, 0x16, 0x0f, 0x38, 0x04, 0x02, 0x01, 0xe8, 0x04,
+                0x11, 0x44, 0x03, 0x21, 0x4f, 0x49, 0x64, 0x73, 0x28, 0x83, 0x01, 0x07, 0x01, 0x29, 0x00, 0x03, 0x2c, 0x21, 0x00, 0x1d,
+                0x89, 0x6a, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0xf2, 0x19, 0x0f, 0x93, 0x00, 0x07, 0x03, 0xaa, 0x0d, 0x00, 0xe8, 0x1d,
+                0x02, 0x22, 0x84, 0x75, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0xd5, 0x11, 0x0f, 0x79, 0x00, 0x0c, 0x00, 0xce, 0x14,
+                0x00, 0x30, 0x00, 0x05, 0xf4, 0x0d, 0x03, 0xb4, 0x00, 0x1a, 0x50, 0x8a, 0x00, 0x0a, 0x79, 0x1a, 0x50, 0x4a, 0x53, 0x4f,
+                0x4e, 0x2e, 0x8c, 0xaa, 0x54, 0x6e, 0x67, 0x69, 0x66, 0x79, 0x59, 0x0e, 0x6b, 0x73, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x1c,
+                0x00, 0x03, 0x50, 0x1f, 0x04, 0xd0, 0x83, 0x03, 0x3c, 0x0f, 0x04, 0xcb, 0xed, 0x0a, 0x16, 0x00, 0x1e, 0x5d, 0xb6, 0xe3,
+                0x6d, 0x6c, 0x65, 0x72, 0x74, 0x28, 0x22, 0x93, 0x00, 0x00, 0x32, 0xbc, 0x02, 0xb8, 0x00, 0x06, 0x02, 0x01, 0x40, 0x6d,
+                0x69, 0x73, 0x6d, 0xf7, 0xc1, 0x80, 0x21, 0x20, 0x50, 0x6c, 0x65, 0x61, 0x73, 0x65, 0xb0, 0x03, 0x21, 0x74, 0x65, 0x22,
+                0x02, 0x00, 0x87, 0x13, 0x51, 0x73, 0x74, 0x20, 0x6c, 0x69, 0x1d, 0xfb, 0x01, 0x13, 0x00, 0x03, 0x10, 0x19, 0x38, 0x6f,
+                0x72, 0x2e, 0x61, 0x13, 0x04, 0x2c, 0x05, 0x7f, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x7a, 0x00, 0x1d, 0x0f, 0x4b,
+                0x00, 0x0a, 0x86, 0x41, 0x63, 0x74, 0x75, 0x61, 0x6c, 0x3a, 0x20, 0xef, 0x0e, 0x0c, 0x6a, 0xac, 0x09, 0x2f, 0x00, 0x14,
+                0x47, 0xa1, 0x00, 0x14, 0x3a, 0x94, 0x20, 0x0f, 0x44, 0x01, 0x13, 0x0a, 0x84, 0x00, 0x08, 0x73, 0x1a, 0x02, 0x93, 0x0b,
+                0x0d, 0x2a, 0x02, 0x03, 0xf5, 0x0b, 0x0f, 0x28, 0x02, 0x15, 0x02, 0x46, 0x00, 0x0f, 0x26, 0x02, 0x20, 0x04, 0x12, 0x0c,
+                0x0f, 0x24, 0x02, 0x00, 0x0f, 0xf9, 0x01, 0x22, 0x03, 0xcf, 0x00, 0x40, 0x64, 0x6f, 0x6e, 0x27, 0xeb, 0x0a, 0x00, 0x2b,
+                0xc4, 0x00, 0xd9, 0x01, 0x52, 0x65, 0x78, 0x70, 0x65, 0x63, 0x2a, 0xc5, 0x0f, 0x0a, 0x02, 0x56, 0x03, 0x8b, 0x00, 0x0f,
+                0x08, 0x02, 0x1e, 0x03, 0x13, 0x01, 0x0f, 0x06, 0x02, 0x14, 0x0f, 0xdb, 0x01, 0x08, 0x07, 0xcb, 0x07, 0x0d, 0xe0, 0x01,
+                0x08, 0x69, 0x09, 0x0f, 0xe5, 0x01, 0x15, 0x07, 0x50, 0x00, 0x0f, 0xea, 0x01, 0x20, 0x09, 0x81, 0x09, 0x0f, 0xef, 0x01,
+                0x35, 0x08, 0xe3, 0x00, 0x0f, 0xf4, 0x01, 0x71, 0x08, 0x90, 0x00, 0x0f, 0xf9, 0x01, 0x1e, 0x08, 0x22, 0x01, 0x0f, 0xfe,
+                0x01, 0x2d, 0x07, 0x96, 0x99, 0x0f, 0xba, 0x06, 0x3e, 0x5f, 0x43, 0x6c, 0x6f, 0x63, 0x6b, 0xbd, 0x06, 0x15, 0x11, 0x63,
+                0x2d, 0x00, 0x0f, 0xb9, 0x06, 0x67, 0x02, 0xad, 0x00, 0x0f, 0xaf, 0x06, 0x2d, 0x10, 0x64, 0xb8, 0xd8, 0x0f, 0x6c, 0x05,
+                0x00, 0x00, 0x87, 0x26, 0x0f, 0x17, 0x00, 0x02, 0x30, 0x75, 0x5f, 0x5f, 0xbf, 0x90, 0x32, 0x5f, 0x64, 0x75, 0x56, 0x53,
+                0x00, 0x16, 0x00, 0x0f, 0xb0, 0x05, 0x05, 0x1e, 0x79, 0x17, 0x00, 0x0f, 0x0d, 0x03, 0x06, 0x03, 0xcf, 0x00, 0x0f, 0xeb,
+                0x06, 0x56, 0x0f, 0x70, 0x00, 0x11, 0x0f, 0xe1, 0x06, 0x46, 0x0f, 0x76, 0x01, 0x5e, 0x0f, 0x27, 0x07, 0x54, 0x0f, 0x94,
+                0x02, 0x15, 0x0f, 0x1d, 0x07, 0x21, 0x0e, 0xb1, 0x01, 0x0f, 0x13, 0x07, 0x5c, 0x0f, 0x81, 0x00, 0x06, 0x0f, 0x09, 0x07,
+                0xc3, 0x0f, 0xcc, 0x01, 0x15, 0x0f, 0xff, 0x06, 0x26, 0x0e, 0x50, 0x01, 0x0f, 0xf5, 0x06, 0x61, 0x0f, 0x86, 0x00, 0x0b,
+                0x0f, 0xeb, 0x06, 0xc0, 0x13, 0x54, 0xf9, 0x24, 0x3f, 0x53, 0x74, 0x61, 0x1a, 0x02, 0x0f, 0x50, 0x74, 0x6f, 0x70, 0x5f,
+                0x6c, 0x2e, 0x00, 0x00, 0x44, 0x22, 0x1f, 0x74, 0xee, 0x06, 0x68, 0x09, 0xb6, 0x00, 0x0f, 0xf5, 0x06, 0x2d, 0x30, 0x66,
+                0x65, 0x5f, 0x75, 0xce, 0x12, 0x77, 0x5f, 0x00, 0x00, 0x35, 0x05, 0x00, 0x12, 0x00, 0x03, 0xe5, 0x9a, 0x10, 0x6f, 0xce,
+                0xdf, 0x00, 0x31, 0xa0, 0x20, 0x62, 0x75, 0xe8, 0x0f, 0xb1, 0x5f, 0x63, 0x6d, 0x64, 0x5f, 0x67, 0x6f, 0x5f, 0x69, 0x64,
+                0x6c, 0x7e, 0xd6, 0x00, 0x2a, 0x00, 0x01, 0x90, 0x94, 0x04, 0x7c, 0x9d, 0x03, 0x63, 0xcb, 0x01, 0x78, 0xb6, 0x25, 0x67,
+                0x72, 0x7b, 0x05, 0x06, 0xb0, 0xd6, 0x00, 0x15, 0x00, 0x05, 0xa5, 0xcf, 0x05, 0x72, 0x00, 0x07, 0xcd, 0x0c, 0x06, 0x2b,
+                0x00, 0x0d, 0x15, 0x00, 0x07, 0x9e, 0xfe, 0x03, 0x1f, 0x00, 0x02, 0x77, 0xc4, 0x0a, 0x33, 0x00, 0x0c, 0x22, 0xd7, 0x01,
+                0xe3, 0xdd, 0x0f, 0x48, 0x00, 0x02, 0x1f, 0x33, 0x82, 0x07, 0x08, 0x0a, 0x63, 0x01, 0x0f, 0x89, 0x07, 0x56, 0x0f, 0x77,
+                0x00, 0x18, 0x0f, 0x90, 0x07, 0x46, 0x0f, 0x11, 0x02, 0xeb, 0x0f, 0x1d, 0x08, 0x54, 0x0f, 0xc3, 0x03, 0x1c, 0x0f, 0x24,
+                0x08, 0x21, 0x0f, 0x4c, 0x02, 0x06, 0x0f, 0x2b, 0x08, 0x5c, 0x0f, 0x88, 0x00, 0x0d, 0x0f, 0x32, 0x08, 0xc3, 0x0f, 0xe1,
+                0x01, 0x1c, 0x0f, 0x39, 0x08, 0x26, 0x0f, 0x5e, 0x01, 0x06, 0x0f, 0x40, 0x08, 0x61, 0x0f, 0x8d, 0x00, 0x12, 0x0f, 0x47,
+                0x08, 0xc3, 0x0f, 0x30, 0x02, 0x18, 0x00, 0x48, 0x08, 0x07, 0xd4, 0x00, 0x0f, 0x48, 0x08, 0x6a, 0x07, 0xb7, 0x00, 0x0f,
+                0x49, 0x08, 0x2c, 0x0f, 0xa2, 0x02, 0x09, 0x08, 0x66, 0x00, 0x0f, 0x4c, 0x07, 0x59, 0x0f, 0x78, 0x00, 0x16, 0x0f, 0x4d,
+                0x07, 0x45, 0x0f, 0x4f, 0x06, 0x58, 0x0f, 0xca, 0x01, 0x1a, 0x0f, 0x50, 0x06, 0x24, 0x0f, 0x50, 0x01, 0x04, 0x0f, 0x51,
+                0x06, 0x5f, 0x0f, 0x89, 0x00, 0x0b, 0x0f, 0x52, 0x06, 0xc6, 0x0f, 0xe4, 0x01, 0x1a, 0x0f, 0x53, 0x06, 0x0d, 0x11, 0x27,
+                0xf6, 0x43, 0x07, 0x63, 0x00, 0x00, 0x1d, 0x09, 0x02, 0x8d, 0x11, 0x0a, 0x14, 0x00, 0x04, 0xd3, 0x2e, 0x0a, 0x15, 0x00,
+                0x00, 0x71, 0x11, 0x0a, 0x13, 0x00, 0x4d, 0x70, 0x63, 0x69, 0x65, 0x14, 0x00, 0x00, 0xc9, 0xc2, 0x0b, 0x13, 0x00, 0x00,
+                0xa4, 0xbd, 0x0b, 0x13, 0x00, 0x0f, 0x8a, 0x00, 0x00, 0x04, 0xbf, 0xad, 0x0b, 0x16, 0x00, 0x03, 0xbd, 0x9d, 0x0a, 0x16,
+                0x00, 0x03, 0x0f, 0xaa, 0x07, 0x12, 0x00, 0x3c, 0x76, 0x61, 0x66, 0x13, 0x00, 0x01, 0x4e, 0x45, 0x08, 0x14, 0x00, 0x0f,
+                0xea, 0x02, 0x20, 0x0f, 0x55, 0x07, 0x64, 0x0f, 0x8e, 0x00, 0x10, 0x0f, 0x56, 0x07, 0x51, 0x0f, 0x32, 0x02, 0xef, 0x0f,
+                0x57, 0x08, 0x5b, 0x01, 0x9d, 0x3c, 0x12, 0x48, 0x40, 0x39, 0x0f, 0x34, 0x04, 0x0e, 0x01, 0x74, 0xd8, 0x00, 0x38, 0x35,
+                0x01, 0xe1, 0x25, 0x0f, 0x8c, 0x17, 0x69, 0x08, 0xb6, 0x00, 0x0f, 0x55, 0x08, 0x45, 0x0a, 0x65, 0x00, 0x0f, 0x29, 0x17,
+                0x57, 0x0f, 0x77, 0x00, 0x17, 0x0f, 0x53, 0x08, 0xad, 0x0f, 0xc7, 0x01, 0x1c, 0x0f, 0x52, 0x08, 0x08, 0x18, 0x27, 0xaf,
+                0x37, 0x05, 0xa2, 0x02, 0x08, 0x28, 0x04, 0x04, 0x6a, 0x3f, 0x09, 0x1c, 0x00, 0x01, 0x2f, 0x04, 0x0d, 0x1a, 0x00, 0x0f,
+                0x12, 0x02, 0x1f, 0x0f, 0x1a, 0x17, 0x5d, 0x0f, 0x88, 0x00, 0x0c, 0x0f, 0x9d, 0x08, 0x4c, 0x0f, 0x6d, 0x01, 0x3b, 0x0f,
+                0x6e, 0x17, 0x64, 0x0f, 0x7b, 0x02, 0x1b, 0x0f, 0x75, 0x17, 0x27, 0x0f, 0xab, 0x01, 0x05, 0x0f, 0x7c, 0x17, 0x62, 0x0f,
+                0x8d, 0x00, 0x11, 0x0f, 0x3c, 0x0f, 0xc0, 0x42, 0x4d, 0x61, 0x69, 0x6e, 0x6b, 0x44, 0x0f, 0x2c, 0x02, 0x0d, 0x40, 0x6d,
+                0x61, 0x69, 0x6e, 0x95, 0x3a, 0x00, 0x96, 0x44, 0x0f, 0xde, 0x06, 0x66, 0x06, 0xaf, 0x00, 0x0f, 0x79, 0x17, 0x2d, 0x02,
+                0xfd, 0x08, 0x01, 0x9e, 0x38, 0x22, 0x62, 0x79, 0x78, 0x5c, 0x03, 0x14, 0x00, 0x02, 0xc1, 0x39, 0x02, 0x15, 0x00, 0x0f,
+                0xbd, 0x02, 0x06, 0x07, 0x89, 0x00, 0x0f, 0xff, 0x06, 0x56, 0x0f, 0x74, 0x00, 0x15, 0x0f, 0x9c, 0x16, 0x46, 0x0f, 0x34,
+                0x01, 0x14, 0x0f, 0x23, 0x07, 0x54, 0x0f, 0x0c, 0x02, 0x19, 0x0f, 0x72, 0x0f, 0x21, 0x0f, 0x6f, 0x01, 0x03, 0x0f, 0xd0,
+                0x06, 0x5c, 0x0f, 0x85, 0x00, 0x0a, 0x0f, 0x6a, 0x0f, 0xc3, 0x0f, 0xd8, 0x01, 0x19, 0x0f, 0x66, 0x0f, 0x0e, 0x02, 0x20,
+                0x0d, 0x01, 0xb3, 0x02, 0x0f, 0x39, 0x0d, 0x0f, 0x02, 0x14, 0x00, 0x02, 0xcc, 0x02, 0x0f, 0xaa, 0x0e, 0x11, 0x0f, 0x9d,
+                0x01, 0x03, 0x0f, 0xbf, 0x06, 0x61, 0x0f, 0x8a, 0x00, 0x0f, 0x0f, 0xa2, 0x0e, 0x52, 0x0f, 0x6e, 0x01, 0x32, 0x0f, 0x01,
+                0x07, 0x5b, 0x0f, 0x81, 0xa7, 0x15, 0x01, 0xde, 0xe3, 0x0f, 0xd0, 0x02, 0x0d, 0x24, 0x6c, 0x32, 0xc5, 0x09, 0x12, 0x74,
+                0x4f, 0x00, 0x33, 0x5f, 0x62, 0x79, 0x34, 0x07, 0x07, 0xbc, 0x4a, 0x00, 0x4a, 0x00, 0x0f, 0x43, 0x07, 0x67, 0x0f, 0xf1,
+                0x00, 0x1a, 0x0f, 0x41, 0x0e, 0x45, 0x0f, 0x85, 0x00, 0x1b, 0x0f, 0x62, 0x07, 0x56, 0x0f, 0x97, 0x00, 0x38, 0x0f, 0x81,
+                0x0e, 0xad, 0x0f, 0x27, 0x02, 0x3c, 0x0f, 0xa1, 0x0e, 0x09, 0x0f, 0x1e, 0xa6, 0x15, 0x0f, 0xeb, 0x51, 0x14, 0x07, 0x2f,
+                0x79, 0x0f, 0x34, 0x00, 0x16, 0x06, 0xed, 0x52, 0x0f, 0x31, 0x00, 0x1b, 0x0f, 0x6d, 0x00, 0x25, 0x03, 0x3f, 0x67, 0x0f,
+                0x31, 0x00, 0x1b, 0x0f, 0x6d, 0x00, 0x27, 0x0f, 0x6c, 0x00, 0x1d, 0x0f, 0x6b, 0x00, 0x26, 0x04, 0xdd, 0x58, 0x0f, 0x32,
+                0x00, 0x1c, 0x0f, 0x6f, 0x00, 0x1b, 0x03, 0x52, 0x71, 0x0f, 0x87, 0x52, 0x12, 0x0f, 0x59, 0x00, 0x1e, 0x0f, 0x0b, 0x02,
+                0x18, 0x08, 0x2f, 0x00, 0x0f, 0x69, 0x00, 0x23, 0x0f, 0x07, 0x02, 0x14, 0x08, 0x2f, 0x00, 0x0f, 0x69, 0x00, 0x25, 0x0f,
+                0x68, 0x00, 0x1b, 0x0f, 0x67, 0x00, 0x24, 0x0f, 0xff, 0x01, 0x15, 0x09, 0x30, 0x00, 0x0f, 0x6b, 0x00, 0x1b, 0x05, 0xfb,
+                0x6d, 0x0f, 0x17, 0x53, 0x14, 0x0f, 0x5d, 0x00, 0x20, 0x0f, 0x03, 0x02, 0x18, 0x0a, 0x31, 0x00, 0x0f, 0x6d, 0x00, 0x25,
+                0x0f, 0x07, 0x02, 0x14, 0x0a, 0x31, 0x00, 0x0f, 0x6d, 0x00, 0x27, 0x0f, 0x6c, 0x00, 0x1d, 0x0f, 0x6b, 0x00, 0x26, 0x0f,
+                0x0f, 0x02, 0x15, 0x0b, 0x32, 0x00, 0x08, 0x6f, 0x00, 0x0f, 0x42, 0x08, 0x3f, 0x0f, 0xc1, 0x0d, 0x5c, 0x0f, 0xa8, 0x00,
+                0x2d, 0x0f, 0xb1, 0x14, 0x4d, 0x0f, 0x7d, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0f, 0x01, 0x14, 0x63, 0x0f,
+                0x7b, 0x0e, 0x3c, 0x0f, 0xa1, 0x1a, 0x26, 0x0f, 0xbb, 0x07, 0x26, 0x0f, 0x02, 0x14, 0x61, 0x0f, 0xad, 0x00, 0x32, 0x0f,
+                0xe1, 0x1a, 0xc0, 0x0f, 0x18, 0x01, 0x07, 0x6f, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0xd3, 0x13, 0x22, 0x11, 0x73, 0x3b,
+                0x00, 0x0f, 0xc4, 0x13, 0x81, 0x02, 0xd5, 0x00, 0x0f, 0xb7, 0x13, 0x5f, 0x03, 0x78, 0x00, 0x0f, 0xaa, 0x13, 0x70, 0x0f,
+                0x8a, 0x00, 0x11, 0x0f, 0x9d, 0x13, 0xc7, 0x0f, 0x00, 0x02, 0x15, 0x0f, 0x90, 0x13, 0x1f, 0x07, 0xc2, 0x6b, 0x0f, 0x56,
+                0x06, 0x07, 0x0f, 0xb6, 0xb0, 0x0b, 0x0f, 0x0a, 0x76, 0x20, 0x0f, 0xfd, 0x06, 0x11, 0x0f, 0x46, 0x86, 0x13, 0x0f, 0x3d,
+                0x00, 0x27, 0x0f, 0x85, 0x00, 0x31, 0x0f, 0x8e, 0x07, 0x0c, 0x0f, 0x3e, 0x00, 0x11, 0x0f, 0x87, 0x00, 0x27, 0x0f, 0xb4,
+                0x0b, 0x0b, 0x0f, 0x98, 0x72, 0x07, 0x0f, 0x71, 0x00, 0x2a, 0x0f, 0x7b, 0x01, 0x24, 0x0f, 0x6f, 0x0b, 0x1e, 0x0f, 0x57,
+                0x73, 0x12, 0x0f, 0x3c, 0x00, 0x26, 0x0f, 0x83, 0x00, 0x27, 0x0f, 0x2c, 0x0b, 0x0d, 0x0f, 0x12, 0x6f, 0x09, 0x0f, 0x75,
+                0x00, 0x2c, 0x0f, 0x7b, 0x01, 0x24, 0x0f, 0xe3, 0x0a, 0x20, 0x0f, 0xd7, 0x6f, 0x14, 0x0f, 0x3e, 0x00, 0x28, 0x0f, 0x87,
+                0x00, 0x1e, 0x0f, 0x30, 0x00, 0x19, 0x20, 0x67, 0x70, 0x06, 0xa3, 0x0f, 0x07, 0x67, 0x10, 0x0f, 0x55, 0x00, 0x19, 0x0f,
+                0xfe, 0xb3, 0x03, 0x0f, 0x1b, 0x7a, 0x20, 0x0f, 0x75, 0x00, 0x2c, 0x0f, 0x06, 0x02, 0x17, 0x0f, 0x3d, 0x00, 0x08, 0x0f,
+                0x85, 0x00, 0x31, 0x0f, 0x06, 0x02, 0x14, 0x0f, 0x3e, 0x00, 0x09, 0x0f, 0x87, 0x00, 0x27, 0x0f, 0xfc, 0x04, 0x13, 0x0e,
+                0xad, 0x76, 0x0f, 0x71, 0x00, 0x2a, 0x0f, 0x7b, 0x01, 0x24, 0x0f, 0xfc, 0x04, 0x26, 0x0f, 0x6c, 0x77, 0x0a, 0x0f, 0x3c,
+                0x00, 0x26, 0x0f, 0x83, 0x00, 0x27, 0x0f, 0xfc, 0x04, 0x15, 0x0f, 0x23, 0x73, 0x01, 0x0f, 0x75, 0x00, 0x2c, 0x0f, 0x7b,
+                0x01, 0x24, 0x0f, 0xfc, 0x04, 0x28, 0x0f, 0xe8, 0x73, 0x0c, 0x0f, 0x3e, 0x00, 0x28, 0x0f, 0x87, 0x00, 0x15, 0x05, 0x46,
+                0x76, 0x0f, 0x26, 0x00, 0x13, 0x0f, 0x9e, 0x04, 0x1a, 0x0f, 0x90, 0x80, 0x07, 0x0f, 0x9d, 0x00, 0x1d, 0x0f, 0xa0, 0x04,
+                0x22, 0x0f, 0x3e, 0x00, 0x0e, 0x0f, 0x87, 0x00, 0x32, 0x0f, 0xac, 0x01, 0x0f, 0x0f, 0x3f, 0x00, 0x0f, 0x0f, 0x89, 0x00,
+                0x28, 0x0f, 0xa4, 0x04, 0x0e, 0x0f, 0x20, 0x7d, 0x05, 0x0f, 0x73, 0x00, 0x2b, 0x0f, 0x81, 0x01, 0x25, 0x0f, 0xa7, 0x04,
+                0x21, 0x0f, 0xe2, 0x7d, 0x10, 0x0f, 0x3d, 0x00, 0x27, 0x0f, 0x85, 0x00, 0x28, 0x0f, 0xaa, 0x04, 0x10, 0x0f, 0xa4, 0x79,
+                0x07, 0x0f, 0x77, 0x00, 0x2d, 0x0f, 0x81, 0x01, 0x25, 0x0f, 0xad, 0x04, 0x23, 0x0f, 0x6c, 0x7a, 0x12, 0x0f, 0x3f, 0x00,
+                0x29, 0x0f, 0x89, 0x00, 0x1f, 0x0f, 0x31, 0x00, 0x19, 0x02, 0xb2, 0xac, 0x0f, 0xd8, 0x96, 0x22, 0x0f, 0x35, 0x00, 0x1f,
+                0x0f, 0x9a, 0x00, 0x1d, 0x0f, 0xcc, 0x03, 0x1d, 0x0d, 0x33, 0x00, 0x0f, 0x71, 0x00, 0x27, 0x0f, 0xc2, 0x02, 0x15, 0x0f,
+                0x35, 0x00, 0x00, 0x0f, 0x75, 0x00, 0x1e, 0x0f, 0x30, 0x00, 0x19, 0x1f, 0x70, 0x7a, 0x01, 0x10, 0x0f, 0x49, 0xc6, 0x02,
+                0x0f, 0x59, 0x88, 0x1f, 0x0f, 0x97, 0x00, 0x1b, 0x0f, 0x88, 0x06, 0x27, 0x0f, 0x3c, 0x00, 0x07, 0x0f, 0x83, 0x00, 0x30,
+                0x0f, 0x82, 0x03, 0x14, 0x0f, 0x3d, 0x00, 0x08, 0x0f, 0x85, 0x00, 0x26, 0x0f, 0xb4, 0x02, 0x13, 0x0d, 0xd7, 0x84, 0x0f,
+                0x6f, 0x00, 0x29, 0x0f, 0x75, 0x01, 0x23, 0x0f, 0x7a, 0x06, 0x26, 0x0f, 0x93, 0x85, 0x09, 0x0f, 0x3b, 0x00, 0x25, 0x0f,
+                0x81, 0x00, 0x26, 0x0f, 0xb2, 0x03, 0x15, 0x0f, 0x55, 0x81, 0x00, 0x0f, 0x73, 0x00, 0x2b, 0x0f, 0x75, 0x01, 0x23, 0x0f,
+                0x6e, 0x06, 0x28, 0x0f, 0x17, 0x82, 0x0b, 0x0f, 0x3d, 0x00, 0x27, 0x0f, 0x85, 0x00, 0x1d, 0x0f, 0x2f, 0x00, 0x19, 0x05,
+                0x72, 0xb1, 0x0f, 0x78, 0x8c, 0x22, 0x0f, 0x38, 0x00, 0x25, 0x0f, 0xa3, 0x00, 0x20, 0x0f, 0xc8, 0x04, 0x27, 0x0f, 0x40,
+                0x00, 0x0b, 0x0f, 0x8b, 0x00, 0x34, 0x0f, 0xe6, 0x01, 0x14, 0x0f, 0x41, 0x00, 0x0c, 0x0f, 0x8d, 0x00, 0x2a, 0x0f, 0xd8,
+                0x04, 0x13, 0x0f, 0x48, 0x89, 0x02, 0x0f, 0x77, 0x00, 0x2d, 0x0f, 0x8d, 0x01, 0x27, 0x0f, 0xe4, 0x04, 0x26, 0x0f, 0x10,
+                0x8a, 0x0d, 0x0f, 0x3f, 0x00, 0x29, 0x0f, 0x89, 0x00, 0x2a, 0x0f, 0xf0, 0x04, 0x15, 0x0f, 0xdc, 0x85, 0x04, 0x0f, 0x7b,
+                0x00, 0x2f, 0x0f, 0x8d, 0x01, 0x27, 0x0f, 0xfc, 0x04, 0x28, 0x0f, 0xaa, 0x86, 0x0f, 0x0f, 0x41, 0x00, 0x2b, 0x0f, 0x8d,
+                0x00, 0x21, 0x0f, 0x33, 0x00, 0x19, 0x3f, 0x74, 0x65, 0x78, 0x25, 0x00, 0x12, 0x0f, 0x02, 0x05, 0x1f, 0x0f, 0xac, 0x7e,
+                0x01, 0x0f, 0x9a, 0x00, 0x1c, 0x0f, 0x44, 0x26, 0x1f, 0x0f, 0x3d, 0x00, 0x10, 0x0f, 0x85, 0x00, 0x31, 0x0f, 0x67, 0x02,
+                0x13, 0x0f, 0x3d, 0x00, 0x08, 0x0f, 0x85, 0x00, 0x33, 0x0f, 0x84, 0x00, 0x29, 0x0f, 0x83, 0x00, 0x32, 0x0f, 0xe4, 0x02,
+                0x14, 0x0f, 0x3e, 0x00, 0x09, 0x0f, 0x87, 0x00, 0x27, 0x0f, 0xf8, 0x05, 0x13, 0x0e, 0xc4, 0x7f, 0x0f, 0x71, 0x00, 0x2a,
+                0x0f, 0x83, 0x02, 0x24, 0x0f, 0xc8, 0x26, 0x1e, 0x0f, 0xd9, 0xa0, 0x11, 0x0f, 0x3b, 0x00, 0x25, 0x0f, 0x81, 0x00, 0x31,
+                0x0f, 0x80, 0x00, 0x27, 0x0f, 0x7f, 0x00, 0x30, 0x0f, 0x77, 0x02, 0x21, 0x0f, 0xe9, 0x06, 0x27, 0x0f, 0xb5, 0xbf, 0x03,
+                0x0f, 0xc8, 0x80, 0x20, 0x0f, 0x75, 0x00, 0x2c, 0x0f, 0x7b, 0x02, 0x24, 0x0f, 0x40, 0x27, 0x20, 0x0f, 0x04, 0x9e, 0x13,
+                0x0f, 0x3d, 0x00, 0x27, 0x0f, 0x85, 0x00, 0x33, 0x0f, 0x84, 0x00, 0x29, 0x0f, 0x83, 0x00, 0x32, 0x0f, 0x87, 0x02, 0x21,
+                0x0f, 0xdf, 0x07, 0x29, 0x00, 0x49, 0x00, 0x0f, 0x30, 0x00, 0x19, 0x00, 0x5b, 0x47, 0x0f, 0x26, 0x00, 0x13, 0x0f, 0xde,
+                0x07, 0x1f, 0x0f, 0x25, 0x99, 0x02, 0x0f, 0x9d, 0x00, 0x1d, 0x0f, 0x5b, 0x07, 0x27, 0x0f, 0x3e, 0x00, 0x09, 0x0f, 0x87,
+                0x00, 0x32, 0x0f, 0xdc, 0x01, 0x14, 0x0f, 0x3f, 0x00, 0x0a, 0x0f, 0x89, 0x00, 0x28, 0x0f, 0xdc, 0x06, 0x13, 0x0f, 0xb3,
+                0x95, 0x00, 0x0f, 0x73, 0x00, 0x2b, 0x0f, 0x81, 0x01, 0x25, 0x0f, 0x5e, 0x06, 0x26, 0x0f, 0x75, 0x96, 0x0b, 0x0f, 0x3d,
+                0x00, 0x27, 0x0f, 0x85, 0x00, 0x28, 0x0f, 0xe2, 0x05, 0x15, 0x0f, 0x39, 0x92, 0x02, 0x0f, 0x77, 0x00, 0x2d, 0x0f, 0x81,
+                0x01, 0x25, 0x0f, 0x60, 0x05, 0x28, 0x0f, 0x01, 0x93, 0x0d, 0x0f, 0x3f, 0x00, 0x29, 0x0f, 0x89, 0x00, 0x1f, 0x0f, 0x15,
+                0x34, 0x2b, 0x0e, 0x16, 0x28, 0x0f, 0x08, 0x34, 0x76, 0x0f, 0x9b, 0x00, 0x06, 0x0f, 0xfb, 0x33, 0x63, 0x0f, 0xe8, 0x27,
+                0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x0f,
+                0x80, 0x54, 0x7d, 0x0f, 0x5e, 0x4f, 0x15, 0x0f, 0x73, 0x54, 0x40, 0x0e, 0x26, 0x28, 0x0f, 0x66, 0x54, 0x7b, 0x0f, 0xa0,
+                0x00, 0x0b, 0x0f, 0x59, 0x54, 0xc1, 0x46, 0x31, 0x54, 0x65, 0x78, 0x6b, 0x02, 0x0f, 0x48, 0x54, 0x0e, 0x0b, 0x22, 0xa6,
+                0x0f, 0x3d, 0x54, 0x68, 0x0a, 0xb9, 0x00, 0x0f, 0x67, 0x94, 0x2f, 0x0f, 0x55, 0xab, 0x0b, 0x07, 0xfd, 0x72, 0x0f, 0xec,
+                0xaa, 0x05, 0x07, 0x23, 0x00, 0x0f, 0xc9, 0xaa, 0x01, 0x0a, 0x1f, 0x00, 0x07, 0x09, 0xaa, 0x08, 0x58, 0x73, 0x0f, 0x9b,
+                0xaa, 0x00, 0x0a, 0x1f, 0x00, 0x0f, 0x11, 0xaa, 0x08, 0x05, 0xc0, 0x84, 0x0a, 0xa7, 0xa8, 0x03, 0xcc, 0x00, 0x0f, 0x1e,
+                0x00, 0x08, 0x03, 0x3c, 0x11, 0x0f, 0x36, 0xaa, 0x0a, 0x0d, 0x48, 0x00, 0x0f, 0x2a, 0x00, 0x0c, 0x00, 0x54, 0x00, 0x0f,
+                0x20, 0x04, 0x07, 0x0c, 0xbc, 0x01, 0x0f, 0x71, 0x55, 0x57, 0x0f, 0x7a, 0x00, 0x1a, 0x0f, 0x90, 0x95, 0x47, 0x0f, 0x6d,
+                0x02, 0xff, 0x41, 0x0f, 0xb5, 0x56, 0x55, 0x0f, 0x78, 0x04, 0x1e, 0x0f, 0xb6, 0x71, 0x21, 0x0f, 0xa8, 0x02, 0x09, 0x0f,
+                0xf3, 0x2f, 0x5d, 0x0f, 0x8b, 0x00, 0x0f, 0x0f, 0xc2, 0x71, 0xc3, 0x0f, 0xea, 0x01, 0x1f, 0x0f, 0xc8, 0x71, 0x0e, 0x0f,
+                0xab, 0xad, 0x0b, 0x09, 0xf7, 0x02, 0x0f, 0x2b, 0x00, 0x11, 0x04, 0xf5, 0x16, 0x0f, 0xc5, 0xad, 0x0a, 0x0f, 0x56, 0x00,
+                0x03, 0x0f, 0x2b, 0x00, 0x08, 0x0f, 0xbb, 0x05, 0x26, 0x0f, 0xcb, 0x09, 0x62, 0x0f, 0x90, 0x00, 0x14, 0x0f, 0x39, 0x72,
+                0x52, 0x0f, 0xdf, 0x01, 0x97, 0x0f, 0x65, 0x0a, 0x61, 0x0b, 0x6d, 0x0b, 0x0f, 0x6b, 0x0a, 0x14, 0x02, 0x36, 0x00, 0x0f,
+                0x68, 0x0a, 0x6d, 0x0b, 0xbc, 0x00, 0x0f, 0x9a, 0x5e, 0x46, 0x0f, 0x6d, 0x00, 0x02, 0x0f, 0x1e, 0x09, 0x5c, 0x0f, 0x7f,
+                0x00, 0x1a, 0x0f, 0x84, 0x5e, 0xae, 0x0f, 0xdf, 0x01, 0x23, 0x0f, 0x79, 0x5e, 0x0a, 0x02, 0x85, 0x03, 0x0d, 0x20, 0x10,
+                0x0f, 0xa9, 0x03, 0x00, 0x0f, 0x24, 0x00, 0x06, 0x0c, 0x71, 0x10, 0x0f, 0x2f, 0x00, 0x0d, 0x00, 0xad, 0x10, 0x69, 0x67,
+                0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5e, 0x17, 0x0f, 0x37, 0x00, 0x1f, 0x0f, 0x79, 0x00, 0x2b, 0x12, 0x6c, 0xf1, 0x11, 0x0f,
+                0x35, 0x00, 0x1d, 0x0f, 0x75, 0x00, 0x2b, 0x04, 0x42, 0x17, 0x0f, 0x36, 0x00, 0x1e, 0x0f, 0x77, 0x00, 0x2b, 0x1f, 0x73,
+                0x35, 0x00, 0x23, 0x0f, 0x75, 0x00, 0x21, 0x3f, 0x6c, 0x6f, 0x63, 0x60, 0x01, 0x1e, 0x07, 0x34, 0x00, 0x0f, 0x73, 0x00,
+                0x2a, 0x0f, 0xe7, 0x00, 0x18, 0x07, 0x34, 0x00, 0x0f, 0x73, 0x00, 0x19, 0x0a, 0xe7, 0x06, 0x0f, 0x24, 0x00, 0x06, 0x13,
+                0x5f, 0xc8, 0xa7, 0x4f, 0x31, 0x64, 0x5f, 0x32, 0x07, 0x01, 0x0f, 0x0c, 0x31, 0x00, 0x0f, 0x91, 0x00, 0x1c, 0x07, 0x3c,
+                0x00, 0x43, 0x62, 0x75, 0x66, 0x66, 0xc5, 0x16, 0x0f, 0x35, 0x00, 0x1d, 0x0f, 0x75, 0x00, 0x24, 0xa2, 0x32, 0x64, 0x5f,
+                0x6e, 0x6f, 0x6d, 0x69, 0x70, 0x6d, 0x61, 0xf7, 0x18, 0x0f, 0x37, 0x00, 0x1f, 0x0f, 0x79, 0x00, 0x24, 0x1f, 0x33, 0x58,
+                0x01, 0x1a, 0x1f, 0x33, 0x55, 0x01, 0x25, 0x4f, 0x63, 0x75, 0x62, 0x65, 0xdc, 0x00, 0x1c, 0x03, 0x33, 0x00, 0x0f, 0x71,
+                0x00, 0x1d, 0x0f, 0x2f, 0x00, 0x1c, 0x07, 0xf3, 0xbc, 0x0f, 0x30, 0x00, 0x1d, 0x0f, 0x6b, 0x00, 0x28, 0x0f, 0xb2, 0x05,
+                0x16, 0x0f, 0x38, 0x00, 0x04, 0x0f, 0x7b, 0x00, 0x2c, 0x0f, 0x54, 0x04, 0x10, 0x0f, 0x36, 0x00, 0x02, 0x0f, 0x77, 0x00,
+                0x2c, 0x0f, 0xb6, 0x05, 0x11, 0x0f, 0x37, 0x00, 0x03, 0x0f, 0x79, 0x00, 0x2c, 0x0f, 0xd1, 0x04, 0x10, 0x0f, 0x36, 0x00,
+                0x02, 0x0f, 0x77, 0x00, 0x21, 0x03, 0xfa, 0xbe, 0x0f, 0x30, 0x00, 0x1d, 0x0f, 0x6b, 0x00, 0x28, 0x0f, 0xd2, 0x01, 0x1c,
+                0x09, 0x36, 0x00, 0x0f, 0x77, 0x00, 0x2c, 0x0f, 0xc8, 0x05, 0x15, 0x0e, 0x37, 0x00, 0x0f, 0x16, 0x41, 0x13, 0x0f, 0x9d,
+                0x0a, 0x0d, 0x0f, 0x18, 0x11, 0x62, 0x0f, 0x90, 0x00, 0x0f, 0x0f, 0x00, 0x41, 0x4e, 0x0f, 0x6f, 0x0a, 0xff, 0xff, 0xff,
+                0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0x0f, 0x5c, 0x1a, 0x69, 0x0f, 0x77, 0x14, 0x1e, 0x0f, 0x92, 0x23, 0x27, 0x0f,
+                0xad, 0x0a, 0x0d, 0x0f, 0xbc, 0x19, 0x67, 0x0f, 0x95, 0x00, 0x14, 0x0f, 0x7c, 0x23, 0xc0, 0x2f, 0x53, 0x6d, 0x79, 0x23,
+                0x17, 0x2f, 0x73, 0x6d, 0x76, 0x23, 0x72, 0x08, 0xb3, 0x00, 0x0f, 0x73, 0x23, 0x2e, 0x0f, 0x22, 0x20, 0x04, 0x2f, 0x61,
+                0x64, 0x40, 0x20, 0x09, 0x2f, 0x61, 0x6c, 0x1e, 0x00, 0x09, 0x2f, 0x63, 0x62, 0x1e, 0x00, 0x09, 0x3f, 0x66, 0x6d, 0x61,
+                0x1e, 0x00, 0x0b, 0x40, 0x68, 0x65, 0x61, 0x76, 0xae, 0xd8, 0x0f, 0x23, 0x00, 0x06, 0x3f, 0x70, 0x36, 0x34, 0x1f, 0x00,
+                0x08, 0x2f, 0x69, 0x70, 0x60, 0x00, 0x09, 0x0f, 0x18, 0x21, 0x0d, 0x31, 0x6e, 0x73, 0x6f, 0xf8, 0x09, 0x0f, 0x39, 0x21,
+                0x0f, 0x0f, 0x1e, 0x00, 0x00, 0x30, 0x75, 0x6e, 0x69, 0xbc, 0x08, 0x0f, 0x22, 0x00, 0x08, 0x2f, 0x78, 0x75, 0x5c, 0x0f,
+                0x07, 0x0a, 0xd7, 0x01, 0x0f, 0x70, 0x1a, 0x56, 0x0f, 0x77, 0x00, 0x18, 0x0f, 0x8b, 0x23, 0x46, 0x0f, 0x85, 0x02, 0xff,
+                0x60, 0x0f, 0xda, 0x1b, 0x54, 0x0f, 0xab, 0x04, 0x1c, 0x0f, 0xa6, 0x23, 0x21, 0x0f, 0xc0, 0x02, 0x06, 0x0f, 0x8b, 0x12,
+                0x5c, 0x0f, 0x88, 0x00, 0x0d, 0x0f, 0xa0, 0x23, 0xc3, 0x0f, 0xe1, 0x01, 0x1c, 0x0f, 0x3c, 0x09, 0x26, 0x0f, 0x5e, 0x01,
+                0x06, 0x0f, 0x34, 0x09, 0x61, 0x0f, 0x8d, 0x00, 0x12, 0x0f, 0x2c, 0x09, 0xc2, 0x53, 0x49, 0x6e, 0x73, 0x74, 0x45, 0x4d,
+                0x04, 0x0f, 0x2e, 0x09, 0x10, 0x09, 0x7d, 0x04, 0x0f, 0x31, 0x09, 0x69, 0x08, 0xb8, 0x00, 0x0f, 0x32, 0x09, 0x3e, 0x0f,
+                0xa4, 0x06, 0x09, 0x0f, 0xc2, 0x06, 0xff, 0x47, 0x06, 0xfb, 0xa5, 0x0f, 0x16, 0xd6, 0x00, 0x03, 0x5d, 0x01, 0x04, 0x1f,
+                0xd6, 0x0f, 0x2d, 0x00, 0x0f, 0x3f, 0x66, 0x6d, 0x61, 0x2d, 0x00, 0x1a, 0x01, 0x5d, 0x01, 0x0f, 0x32, 0x00, 0x18, 0x3f,
+                0x70, 0x36, 0x34, 0x2e, 0x00, 0x17, 0x2f, 0x69, 0x70, 0x8d, 0x00, 0x18, 0x00, 0x89, 0x15, 0x0f, 0x2d, 0x00, 0x16, 0x1d,
+                0x78, 0x2c, 0x00, 0x02, 0x54, 0xb3, 0x04, 0xf8, 0xd7, 0x02, 0x16, 0x00, 0x0f, 0x6e, 0xd7, 0x0d, 0x0f, 0xc3, 0x0a, 0x09,
+                0x09, 0x69, 0x03, 0x0f, 0xc4, 0x0a, 0x58, 0x0f, 0x78, 0x00, 0x17, 0x0f, 0xc5, 0x0a, 0x57, 0x0f, 0x18, 0x04, 0xff, 0xff,
+                0xe1, 0x0f, 0x56, 0x0c, 0x56, 0x0f, 0xd0, 0x07, 0x1b, 0x0f, 0x57, 0x0c, 0x23, 0x0f, 0x53, 0x04, 0x05, 0x0f, 0x58, 0x0c,
+                0x5e, 0x0f, 0x89, 0x00, 0x0c, 0x0f, 0x59, 0x0c, 0xc5, 0x0f, 0xe4, 0x01, 0x1b, 0x0f, 0x5a, 0x0c, 0x28, 0x0f, 0x60, 0x01,
+                0x05, 0x0f, 0x5b, 0x0c, 0x63, 0x0f, 0x8e, 0x00, 0x11, 0x0f, 0x5c, 0x0c, 0xc2, 0x11, 0x53, 0xbc, 0xbb, 0x02, 0xfb, 0x00,
+                0x2f, 0x69, 0x6f, 0x9b, 0x2e, 0x0e, 0x11, 0x73, 0xa5, 0xe3, 0x00, 0xee, 0xbb, 0x02, 0x88, 0x04, 0x00, 0x40, 0xc4, 0x0f,
+                0x62, 0x0c, 0x68, 0x0b, 0xbe, 0x00, 0x0f, 0x65, 0x0c, 0x46, 0x02, 0x81, 0x05, 0x0c, 0x9b, 0x05, 0x0e, 0x18, 0x00, 0x0e,
+                0x53, 0xbd, 0x0f, 0x22, 0x00, 0x05, 0x1f, 0x67, 0x22, 0x00, 0x0e, 0x1f, 0x70, 0x22, 0x00, 0x0e, 0x1f, 0x74, 0x67, 0x00,
+                0x0f, 0x03, 0xe5, 0xa7, 0x0f, 0x23, 0x00, 0x09, 0x15, 0x76, 0x22, 0x00, 0x0f, 0x7f, 0x06, 0x01, 0x0c, 0x16, 0x00, 0x0e,
+                0xe2, 0x00, 0x0f, 0x20, 0x00, 0x03, 0x06, 0xe0, 0x00, 0x0f, 0x20, 0x00, 0x03, 0x06, 0xde, 0x00, 0x0f, 0x20, 0x00, 0x03,
+                0x07, 0xdc, 0x00, 0x0f, 0x21, 0x00, 0x04, 0x06, 0xda, 0x00, 0x0f, 0x21, 0x00, 0x03, 0x04, 0xd8, 0x00, 0x00, 0x41, 0x07,
+                0x0f, 0xd5, 0x01, 0x00, 0x0d, 0x17, 0x00, 0x0c, 0xda, 0x00, 0x0f, 0x21, 0x00, 0x06, 0x04, 0xdb, 0x00, 0x0f, 0x21, 0x00,
+                0x06, 0x04, 0xdc, 0x00, 0x0f, 0x21, 0x00, 0x06, 0x05, 0xdd, 0x00, 0x0f, 0x22, 0x00, 0x07, 0x04, 0xde, 0x00, 0x0f, 0x22,
+                0x00, 0x06, 0x1f, 0x76, 0xdd, 0xaa, 0x08, 0x0e, 0x19, 0x03, 0x0f, 0x15, 0x0c, 0x58, 0x0f, 0x7b, 0x00, 0x1a, 0x0f, 0x18,
+                0x0c, 0x5f, 0x0f, 0xcb, 0x03, 0xff, 0xff, 0x86, 0x0f, 0xc5, 0x0b, 0x56, 0x0f, 0x33, 0x07, 0x1e, 0x0f, 0xc8, 0x0b, 0x23,
+                0x0f, 0x06, 0x04, 0x08, 0x0f, 0xcb, 0x0b, 0x5e, 0x0f, 0x8c, 0x00, 0x0f, 0x0f, 0xce, 0x0b, 0xc5, 0x0f, 0xed, 0x01, 0x1e,
+                0x0f, 0xd1, 0x0b, 0x28, 0x0f, 0x66, 0x01, 0x08, 0x0f, 0xd4, 0x0b, 0x63, 0x0f, 0x91, 0x00, 0x14, 0x0f, 0xd7, 0x0b, 0xc2,
+                0x22, 0x52, 0x65, 0xe3, 0x98, 0x4f, 0x55, 0x73, 0x61, 0x67, 0x23, 0x99, 0x0e, 0x43, 0x73, 0x6d, 0x5f, 0x72, 0x30, 0x00,
+                0x20, 0x5f, 0x75, 0x31, 0x00, 0x0f, 0xd3, 0x0b, 0x69, 0x09, 0xba, 0x00, 0x0f, 0xd1, 0x0b, 0x31, 0x3c, 0x63, 0x74, 0x61,
+                0xbb, 0x41, 0x0f, 0xd4, 0xc8, 0x02, 0x02, 0x4f, 0x25, 0x06, 0x87, 0xf0, 0x02, 0x81, 0x42, 0x00, 0xda, 0xdc, 0x14, 0x75,
+                0x1b, 0xb3, 0x10, 0x5f, 0x7a, 0xdb, 0x23, 0x63, 0x61, 0x79, 0x06, 0x0f, 0x36, 0x00, 0x08, 0x3f, 0x69, 0x73, 0x62, 0x33,
+                0x00, 0x1d, 0x10, 0x74, 0x4e, 0xaf, 0x0f, 0x33, 0x00, 0x05, 0x00, 0xa2, 0x01, 0x60, 0x66, 0x5f, 0x72, 0x65, 0x67, 0x69,
+                0x1f, 0x56, 0x0f, 0x22, 0x00, 0x1a, 0x0a, 0x0c, 0x07, 0x0f, 0x2c, 0x00, 0x13, 0x02, 0xf6, 0x06, 0x0f, 0x2c, 0x00, 0x13,
+                0x35, 0x76, 0x74, 0x67, 0x2d, 0x00, 0x08, 0x58, 0x01, 0x0f, 0x78, 0x00, 0x00, 0x0f, 0x1f, 0x00, 0x01, 0x07, 0x6b, 0x00,
+                0x0f, 0x1f, 0x00, 0x01, 0x00, 0x5e, 0x00, 0x0f, 0x74, 0x04, 0x08, 0x0a, 0x2d, 0x02, 0x0f, 0xe5, 0x0a, 0x58, 0x0f, 0x79,
+                0x00, 0x18, 0x0f, 0xe3, 0x0a, 0x4a, 0x0f, 0xdd, 0x02, 0xff, 0xb0, 0x0f, 0xf9, 0x09, 0x56, 0x0f, 0x59, 0x05, 0x1c, 0x0f,
+                0xf7, 0x09, 0x23, 0x0f, 0x18, 0x03, 0x06, 0x0f, 0xf5, 0x09, 0x5e, 0x0f, 0x8a, 0x00, 0x0d, 0x0f, 0xf3, 0x09, 0xc5, 0x0f,
+                0xe7, 0x01, 0x1c, 0x0f, 0xf1, 0x09, 0x28, 0x0f, 0x62, 0x01, 0x06, 0x0f, 0xef, 0x09, 0x63, 0x0f, 0x8f, 0x00, 0x12, 0x0f,
+                0xed, 0x09, 0xc2, 0x51, 0x57, 0x61, 0x72, 0x70, 0x4c, 0x33, 0x0f, 0x10, 0x53, 0x9e, 0xf7, 0x0f, 0x3a, 0x02, 0x0e, 0x03,
+                0x61, 0xf5, 0x00, 0x31, 0x00, 0x02, 0xd0, 0xf7, 0x0f, 0xef, 0xc4, 0x68, 0x0e, 0xbe, 0x00, 0x0f, 0xf4, 0x09, 0x2d, 0x01,
+                0x6f, 0x05, 0x50, 0x70, 0x65, 0x32, 0x73, 0x6d, 0x63, 0xf7, 0x01, 0x7a, 0x06, 0x03, 0xd8, 0x05, 0x2c, 0x69, 0x6f, 0xc7,
+                0xf8, 0x05, 0x9f, 0x05, 0x02, 0x30, 0x00, 0x32, 0x76, 0x74, 0x67, 0xde, 0x06, 0x0f, 0x31, 0x00, 0x0f, 0x08, 0x44, 0x01,
+                0x0b, 0x1b, 0xf9, 0x05, 0x1c, 0x06, 0x00, 0xb6, 0x4b, 0x10, 0x73, 0x43, 0x00, 0x27, 0x74, 0x61, 0x52, 0x00, 0x0f, 0x43,
+                0x00, 0x22, 0x04, 0xa4, 0x06, 0x0f, 0x48, 0x00, 0x2d, 0x20, 0x73, 0x68, 0x9b, 0x07, 0x0f, 0x45, 0x00, 0x2c, 0x01, 0x2c,
+                0x00, 0x0f, 0x44, 0x00, 0x22, 0x02, 0x70, 0x11, 0x0f, 0x2d, 0x00, 0x14, 0x0b, 0x3e, 0x07, 0x0f, 0x2d, 0x00, 0x0d, 0x04,
+                0x9e, 0x00, 0x32, 0x6f, 0x6f, 0x6f, 0x30, 0x00, 0x00, 0xde, 0x08, 0x2f, 0x6c, 0x65, 0xa2, 0x00, 0x1c, 0x06, 0x48, 0x00,
+                0x0f, 0x73, 0x01, 0x2b, 0x06, 0x48, 0x00, 0x0f, 0x2e, 0x01, 0x27, 0x03, 0x5c, 0x12, 0x0f, 0x2e, 0x00, 0x15, 0x02, 0x68,
+                0x12, 0x0f, 0x2e, 0x00, 0x14, 0x02, 0x53, 0x13, 0x0f, 0x2d, 0x00, 0x15, 0x0f, 0x86, 0x0b, 0x0b, 0x0d, 0xc2, 0x03, 0x0f,
+                0x89, 0x0b, 0x58, 0x0f, 0x7c, 0x00, 0x1b, 0x0f, 0x8c, 0x0b, 0x46, 0x0f, 0x75, 0x04, 0xff, 0xff, 0xff, 0x48, 0x0f, 0x1e,
+                0x0d, 0x56, 0x0f, 0x86, 0x08, 0x1f, 0x0f, 0x21, 0x0d, 0x23, 0x0f, 0xb0, 0x04, 0x09, 0x0f, 0x24, 0x0d, 0x5e, 0x0f, 0x8d,
+                0x00, 0x10, 0x0f, 0x27, 0x0d, 0xc5, 0x0f, 0xf0, 0x01, 0x1f, 0x0f, 0x2a, 0x0d, 0x28, 0x0f, 0x68, 0x01, 0x09, 0x0f, 0x2d,
+                0x0d, 0x63, 0x0f, 0x92, 0x00, 0x15, 0x0f, 0x30, 0x0d, 0xc0, 0x00, 0xfb, 0x00, 0x10, 0x49, 0xe9, 0xde, 0x0f, 0x2d, 0x0d,
+                0x18, 0x02, 0x19, 0xdf, 0x0f, 0x2c, 0x0d, 0x6d, 0x0b, 0xba, 0x00, 0x0f, 0x1d, 0x17, 0x2f, 0x0f, 0x50, 0x1d, 0x08, 0x0c,
+                0x46, 0x14, 0x08, 0x16, 0x00, 0x07, 0x0e, 0x01, 0x24, 0x65, 0x64, 0xa4, 0xe0, 0x0f, 0x25, 0x00, 0x0c, 0x20, 0x72, 0x61,
+                0xea, 0x05, 0x00, 0x67, 0x18, 0x41, 0x6c, 0x76, 0x69, 0x6e, 0x56, 0x13, 0x0f, 0x2e, 0x00, 0x07, 0x05, 0xd2, 0xe0, 0x01,
+                0x11, 0x00, 0x0f, 0x2c, 0x00, 0x0c, 0x33, 0x72, 0x61, 0x69, 0x41, 0x29, 0x0f, 0x23, 0x00, 0x05, 0x77, 0x69, 0x6d, 0x63,
+                0x5f, 0x6d, 0x69, 0x73, 0x87, 0x1d, 0x0f, 0x26, 0x00, 0x01, 0x12, 0x6c, 0xd8, 0xf5, 0x22, 0x74, 0x74, 0x8c, 0xe1, 0x0f,
+                0x29, 0x00, 0x08, 0x50, 0x6f, 0x6e, 0x67, 0x5f, 0x73, 0x17, 0xd5, 0x4d, 0x62, 0x6f, 0x61, 0x72, 0x34, 0x01, 0x0a, 0x2d,
+                0x00, 0x43, 0x6d, 0x61, 0x74, 0x68, 0x67, 0x2b, 0x0f, 0x5d, 0x00, 0x12, 0x5f, 0x6d, 0x65, 0x6d, 0x62, 0x61, 0x4d, 0x01,
+                0x0c, 0x00, 0x14, 0x5a, 0x0f, 0x4e, 0x00, 0x14, 0x21, 0x69, 0x73, 0x8d, 0x79, 0x0f, 0x22, 0x00, 0x07, 0x21, 0x6e, 0x6f,
+                0x02, 0x02, 0x21, 0x72, 0x75, 0x2f, 0xf5, 0x0f, 0x2c, 0x00, 0x0d, 0x00, 0x64, 0x3e, 0x3f, 0x6c, 0x65, 0x63, 0x2a, 0x02,
+                0x00, 0x0a, 0x2a, 0x00, 0x0f, 0x26, 0x00, 0x14, 0x00, 0xcb, 0xb4, 0x0f, 0x4a, 0x01, 0x16, 0x5f, 0x73, 0x6c, 0x65, 0x65,
+                0x70, 0x3b, 0x02, 0x0e, 0x04, 0xf8, 0x55, 0x0f, 0x1c, 0x01, 0x0f, 0x22, 0x77, 0x61, 0x7e, 0x3f, 0x08, 0x22, 0x00, 0x05,
+                0x31, 0x21, 0x0f, 0xcd, 0x05, 0x06, 0x0c, 0x84, 0x03, 0x0f, 0xeb, 0x0c, 0x56, 0x0f, 0x79, 0x00, 0x1a, 0x0f, 0x74, 0x18,
+                0x48, 0x0f, 0x34, 0x04, 0xff, 0xff, 0xff, 0x0b, 0x0f, 0xad, 0x0c, 0x54, 0x0f, 0x07, 0x08, 0x1e, 0x0f, 0xaa, 0x0c, 0x21,
+                0x0f, 0x6f, 0x04, 0x08, 0x0f, 0xa7, 0x0c, 0x5c, 0x0f, 0x8a, 0x00, 0x0f, 0x0f, 0xa4, 0x0c, 0xc3, 0x0f, 0xe7, 0x01, 0x1e,
+                0x0f, 0xa1, 0x0c, 0x26, 0x0f, 0x62, 0x01, 0x08, 0x0f, 0x9e, 0x0c, 0x61, 0x0f, 0x8f, 0x00, 0x14, 0x0f, 0x9b, 0x0c, 0xc0,
+                0x50, 0x50, 0x72, 0x69, 0x6d, 0x69, 0x3e, 0x07, 0x41, 0x44, 0x61, 0x74, 0x61, 0x7f, 0xfd, 0x0f, 0x39, 0x02, 0x0c, 0x14,
+                0x70, 0x31, 0x00, 0x02, 0x67, 0x1f, 0x00, 0x33, 0x00, 0x0f, 0x9f, 0x0c, 0x67, 0x0d, 0xbe, 0x00, 0x0f, 0xe3, 0xd7, 0x2e,
+                0x00, 0xcc, 0xe0, 0x01, 0xd3, 0xfe, 0x01, 0xe9, 0x00, 0x02, 0xaf, 0xd6, 0x06, 0x14, 0x00, 0x32, 0x76, 0x65, 0x72, 0xd6,
+                0x65, 0x01, 0xe1, 0xe0, 0x64, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x69, 0xed, 0x32, 0x61, 0x74, 0x74, 0x36, 0xed, 0x0f,
+                0x1c, 0x00, 0x00, 0x06, 0x4c, 0x00, 0x0e, 0x1c, 0x00, 0x05, 0x54, 0x00, 0x0f, 0xf1, 0x2b, 0x2b, 0x0f, 0xcf, 0x2b, 0x39,
+                0x11, 0x76, 0x71, 0xed, 0x3c, 0x6c, 0x69, 0x70, 0x0b, 0x01, 0x0f, 0x19, 0x00, 0x02, 0x00, 0xe9, 0x49, 0x00, 0x14, 0x00,
+                0x12, 0x70, 0x49, 0x07, 0x06, 0x24, 0x00, 0x0c, 0xfd, 0x00, 0x02, 0x1a, 0x00, 0x3f, 0x75, 0x6c, 0x6c, 0x57, 0x00, 0x03,
+                0x0b, 0x19, 0x00, 0x01, 0x57, 0x00, 0x14, 0x75, 0x8d, 0x16, 0x0f, 0x23, 0x00, 0x06, 0x33, 0x70, 0x61, 0x73, 0x3b, 0xf6,
+                0x01, 0x23, 0x00, 0x0f, 0x5a, 0x00, 0x01, 0x0c, 0xa1, 0x01, 0x08, 0x15, 0x00, 0x02, 0x2a, 0x00, 0x0f, 0xa8, 0x04, 0x06,
+                0x0e, 0x61, 0x02, 0x0f, 0x7e, 0x0b, 0x56, 0x0f, 0x7b, 0x00, 0x1c, 0x0f, 0xc2, 0xd9, 0x47, 0x0f, 0x13, 0x03, 0xff, 0xe5,
+                0x0f, 0x5b, 0x0a, 0x54, 0x0f, 0xc3, 0x05, 0x20, 0x0f, 0x5d, 0x0a, 0x21, 0x0f, 0x4e, 0x03, 0x0a, 0x0f, 0x5f, 0x0a, 0x5c,
+                0x0f, 0x8c, 0x00, 0x11, 0x0f, 0x61, 0x0a, 0xc3, 0x0f, 0xed, 0x01, 0x20, 0x0f, 0x63, 0x0a, 0x26, 0x0f, 0x66, 0x01, 0x0a,
+                0x0f, 0x65, 0x0a, 0x61, 0x0f, 0x91, 0x00, 0x16, 0x0f, 0x67, 0x0a, 0xc0, 0x11, 0x52, 0x65, 0x82, 0x0f, 0x64, 0x0a, 0x15,
+                0x03, 0x93, 0x82, 0x0f, 0x61, 0x0a, 0x70, 0x0a, 0xb8, 0x00, 0x0f, 0x5e, 0x0a, 0x2e, 0x01, 0x9f, 0xea, 0x63, 0x65, 0x61,
+                0x72, 0x6c, 0x79, 0x7a, 0x97, 0x05, 0x20, 0x73, 0x61, 0xbd, 0x1d, 0x02, 0x09, 0x07, 0x08, 0x1e, 0x00, 0x21, 0x6b, 0x69,
+                0xfe, 0x0f, 0x01, 0x9b, 0xf7, 0x01, 0x63, 0x1d, 0x10, 0x6c, 0x42, 0xff, 0x0f, 0x27, 0x00, 0x05, 0x0f, 0x46, 0x00, 0x05,
+                0x03, 0xd2, 0x05, 0x0d, 0x1f, 0x00, 0x03, 0x13, 0x06, 0x02, 0x5d, 0x00, 0x01, 0x1e, 0xf8, 0x2f, 0x33, 0x64, 0x65, 0x00,
+                0x00, 0x00, 0xec, 0x02, 0x0f, 0x64, 0x00, 0x07, 0x02, 0x1e, 0x00, 0x0f, 0x63, 0x00, 0x05, 0x00, 0x06, 0x00, 0x11, 0x32,
+                0xca, 0x8f, 0x0f, 0xc4, 0x00, 0x06, 0x01, 0x23, 0x00, 0x01, 0xc1, 0x77, 0x0f, 0x23, 0x00, 0x00, 0x04, 0x1c, 0xec, 0x17,
+                0x7a, 0xe2, 0x06, 0x07, 0x65, 0x00, 0x0f, 0x1f, 0x00, 0x08, 0x01, 0x3c, 0x57, 0x43, 0x63, 0x63, 0x65, 0x70, 0xda, 0x11,
+                0x0f, 0x2b, 0x00, 0x0c, 0x37, 0x72, 0x65, 0x6a, 0x05, 0x12, 0x0f, 0x52, 0x37, 0x09, 0x01, 0x0a, 0x01, 0x8f, 0x6d, 0x61,
+                0x73, 0x6b, 0x5f, 0x6f, 0x66, 0x66, 0x34, 0x0a, 0x07, 0x0b, 0x34, 0x02, 0x0f, 0x31, 0x0a, 0x56, 0x0f, 0x78, 0x00, 0x19,
+                0x0f, 0x2e, 0x0a, 0x47, 0x0f, 0xe3, 0x02, 0xff, 0xbb, 0x0f, 0x04, 0x0a, 0x54, 0x0f, 0x66, 0x05, 0x1d, 0x0f, 0x01, 0x0a,
+                0x21, 0x0f, 0x1e, 0x03, 0x07, 0x0f, 0xfe, 0x09, 0x5c, 0x0f, 0x89, 0x00, 0x0e, 0x0f, 0xfb, 0x09, 0xc3, 0x0f, 0xe4, 0x01,
+                0x1d, 0x0f, 0xf8, 0x09, 0x26, 0x0f, 0x60, 0x01, 0x07, 0x0f, 0xf5, 0x09, 0x61, 0x0f, 0x8e, 0x00, 0x13, 0x0f, 0xf2, 0x09,
+                0xc2, 0x9f, 0x79, 0x74, 0x72, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x5f, 0x86, 0x72, 0x16, 0x16, 0x72, 0x34, 0x00, 0x19, 0x62,
+                0xa8, 0x5b, 0x0f, 0xfc, 0x09, 0x64, 0x04, 0x8e, 0x00, 0x0f, 0x8b, 0x72, 0x35, 0x05, 0xdb, 0xf4, 0x03, 0x7f, 0x26, 0x08,
+                0xd0, 0x1c, 0x04, 0x1b, 0x00, 0x32, 0x72, 0x61, 0x79, 0xfe, 0x05, 0x07, 0x10, 0x00, 0x9f, 0x5f, 0x63, 0x61, 0x73, 0x74,
+                0x5f, 0x61, 0x70, 0x69, 0x19, 0x00, 0x03, 0x5f, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x42, 0x1e, 0x09, 0x0f, 0xca, 0x00, 0x01,
+                0x0f, 0x97, 0x08, 0x58, 0x0f, 0x7d, 0x00, 0x1c, 0x0f, 0x9c, 0x08, 0x46, 0x0f, 0x7e, 0x01, 0x4c, 0x0f, 0x2d, 0x07, 0x56,
+                0x0f, 0x97, 0x02, 0x20, 0x0f, 0x32, 0x07, 0x23, 0x0f, 0xb9, 0x01, 0x0a, 0x0f, 0x37, 0x07, 0x5e, 0x0f, 0x8e, 0x00, 0x11,
+                0x0f, 0x3c, 0x07, 0xc5, 0x0f, 0xf3, 0x01, 0x20, 0x0f, 0x41, 0x07, 0x28, 0x0f, 0x6a, 0x01, 0x0a, 0x0f, 0x46, 0x07, 0x63,
+                0x0f, 0x93, 0x00, 0x16, 0x0f, 0x90, 0xd8, 0xda, 0x0a, 0xa8, 0xd9, 0x0f, 0x6b, 0xec, 0x31, 0x0f, 0x65, 0xec, 0x8f, 0x0f,
+                0x60, 0xec, 0x6d, 0x0f, 0x5b, 0xec, 0x7f, 0x0f, 0x56, 0xec, 0xf3, 0x0f, 0x51, 0xec, 0xa7, 0x0f, 0x20, 0xe3, 0x46, 0x0f,
+                0x7c, 0xe1, 0x41, 0x0f, 0xc7, 0xb1, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x72, 0xb1, 0x0f, 0x77, 0x04, 0x1e, 0x0f, 0x35,
+                0x00, 0x00, 0x0f, 0x75, 0x00, 0x27, 0x0f, 0x6b, 0x03, 0x13, 0x0d, 0x33, 0x00, 0x0f, 0x71, 0x00, 0x27, 0x0f, 0x67, 0x02,
+                0x15, 0x0f, 0x35, 0x00, 0x00, 0x0f, 0x9d, 0xb2, 0xff, 0xff, 0xff, 0xff, 0x99, 0x0f, 0x77, 0xb2, 0xff, 0xff, 0xff, 0xff,
+                0x76, 0x0f, 0x46, 0xb2, 0x16, 0x0f, 0xd1, 0xaf, 0x2b, 0x0f, 0xc7, 0xb0, 0xff, 0xff, 0xff, 0xff, 0x44, 0x0f, 0x98, 0xb0,
+                0x2b, 0x0f, 0x1d, 0xb0, 0xff, 0x04, 0x0f, 0xa6, 0xaf, 0xff, 0x00, 0x0f, 0x2b, 0xaf, 0xff, 0x26, 0x0f, 0x06, 0xaf, 0xff,
+                0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 0x0f, 0xb0, 0xae, 0xff, 0xff, 0xff, 0xff, 0x59, 0x0f, 0x5e, 0x26, 0x3a, 0x0f,
+                0x6f, 0xd6, 0x76, 0x0f, 0xa3, 0x00, 0x0e, 0x0f, 0x77, 0xd6, 0x63, 0x0f, 0x9e, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x43, 0x0f, 0x1d, 0xd4, 0x7d, 0x0f, 0xc2, 0x4a, 0x1d, 0x0f,
+                0x25, 0xd4, 0x40, 0x0f, 0xdc, 0x25, 0x07, 0x0f, 0x2d, 0xd4, 0x7b, 0x0f, 0xa8, 0x00, 0x13, 0x0f, 0xfe, 0x4f, 0xda, 0x20,
+                0x4f, 0x70, 0x94, 0x00, 0x0f, 0x43, 0x9b, 0x10, 0x0f, 0xf9, 0x4f, 0x02, 0x14, 0x6f, 0x3e, 0x00, 0x0f, 0xf3, 0x4f, 0x81,
+                0x05, 0xdb, 0x00, 0x0f, 0xee, 0x4f, 0x5f, 0x06, 0x7b, 0x00, 0x0f, 0xe9, 0x4f, 0x70, 0x0f, 0x8d, 0x00, 0x14, 0x0f, 0xe4,
+                0x4f, 0xc7, 0x0f, 0x09, 0x02, 0x18, 0x0f, 0xdf, 0x4f, 0x2e, 0x0f, 0x88, 0x0c, 0x0f, 0x0f, 0x7a, 0x11, 0x29, 0x0f, 0x69,
+                0x0a, 0x1e, 0x0f, 0x5c, 0x0a, 0x29, 0x0f, 0x56, 0x11, 0x1d, 0x0f, 0x4a, 0x11, 0x28, 0x0f, 0xba, 0x0a, 0x1f, 0x0f, 0xad,
+                0x0a, 0x2a, 0x0f, 0xb5, 0x10, 0x1c, 0x0f, 0xa9, 0x10, 0x27, 0x0f, 0x96, 0x0a, 0x1c, 0x0f, 0x89, 0x0a, 0x27, 0x0f, 0x85,
+                0x10, 0x1b, 0x0f, 0x79, 0x10, 0x26, 0x0f, 0xe3, 0x0a, 0x1d, 0x0f, 0xd6, 0x0a, 0x28, 0x0f, 0xe0, 0x0f, 0x1e, 0x0f, 0xd4,
+                0x0f, 0x29, 0x0f, 0xbf, 0x0a, 0x1e, 0x0f, 0xb2, 0x0a, 0x29, 0x0f, 0xb0, 0x0f, 0x1d, 0x0f, 0xa4, 0x0f, 0x28, 0x0f, 0x10,
+                0x0b, 0x1f, 0x0f, 0x8c, 0x0f, 0x2a, 0x0f, 0xa4, 0x01, 0x0e, 0x0f, 0x94, 0x01, 0x19, 0x0f, 0x84, 0x01, 0x0e, 0x0f, 0x74,
+                0x01, 0x19, 0x0f, 0x64, 0x01, 0x0d, 0x0f, 0x54, 0x01, 0x18, 0x0f, 0x44, 0x01, 0x0f, 0x0f, 0x78, 0x2c, 0x2f, 0x0f, 0xf9,
+                0x2e, 0xfd, 0x0f, 0x88, 0x2e, 0xf3, 0x0f, 0x13, 0x2e, 0xf9, 0x0f, 0xf0, 0x15, 0x12, 0x0f, 0x3d, 0x00, 0x0d, 0x0f, 0x85,
+                0x00, 0x31, 0x0f, 0x91, 0x01, 0x13, 0x0f, 0x3d, 0x00, 0x08, 0x0f, 0x85, 0x00, 0x33, 0x0f, 0x84, 0x00, 0x29, 0x0f, 0x83,
+                0x00, 0x32, 0x0f, 0x14, 0x02, 0x14, 0x0f, 0x3e, 0x00, 0x09, 0x0f, 0xb2, 0x2f, 0x2b, 0x0f, 0x12, 0x02, 0x24, 0x0f, 0x7d,
+                0x1a, 0x21, 0x0f, 0x46, 0x00, 0x07, 0x0f, 0x0e, 0x02, 0x20, 0x0f, 0xa5, 0x04, 0x26, 0x0f, 0x46, 0x00, 0x04, 0x0f, 0x80,
+                0x00, 0x27, 0x0f, 0x7f, 0x00, 0x30, 0x0f, 0x06, 0x02, 0x21, 0x0f, 0x24, 0x05, 0x27, 0x0f, 0x10, 0x31, 0x01, 0x0f, 0x06,
+                0x02, 0x23, 0x0f, 0x08, 0x1a, 0x23, 0x0f, 0x48, 0x00, 0x09, 0x0f, 0x0a, 0x02, 0x20, 0x0f, 0xa9, 0x05, 0x28, 0x0f, 0x48,
+                0x00, 0x06, 0x0f, 0x84, 0x00, 0x29, 0x0f, 0x83, 0x00, 0x32, 0x0f, 0x12, 0x02, 0x21, 0x0f, 0x2c, 0x06, 0x29, 0x0f, 0x6f,
+                0x32, 0xff, 0x0b, 0x0f, 0xfe, 0x31, 0xf3, 0x0f, 0x89, 0x31, 0xfa, 0x0f, 0x12, 0x31, 0xfb, 0x0f, 0x9f, 0x30, 0xf7, 0x0f,
+                0x28, 0x30, 0xec, 0x0f, 0x4b, 0x20, 0x1f, 0x0f, 0x35, 0x00, 0x00, 0x0f, 0x75, 0x00, 0x27, 0x0f, 0x39, 0x1f, 0x13, 0x0d,
+                0x33, 0x00, 0x0f, 0x71, 0x00, 0x27, 0x0f, 0x2f, 0x1e, 0x15, 0x0f, 0x35, 0x00, 0x00, 0x0f, 0xbb, 0x30, 0xff, 0x33, 0x0f,
+                0x4c, 0x30, 0xef, 0x0f, 0xd9, 0x2f, 0xe9, 0x0f, 0xb1, 0x2f, 0xff, 0xff, 0xff, 0x2a, 0x0f, 0x09, 0x2f, 0xff, 0xff, 0x14,
+                0x0f, 0x98, 0x2e, 0xff, 0xf4, 0x0f, 0x23, 0x2e, 0xff, 0xff, 0x04, 0x0f, 0xac, 0x2d, 0xfb, 0x0f, 0x39, 0x2d, 0xf7, 0x0f,
+                0x60, 0x52, 0xfb, 0x0f, 0x43, 0x28, 0x02, 0x0f, 0x5b, 0x52, 0x76, 0x0f, 0x9e, 0x00, 0x09, 0x0f, 0x56, 0x52, 0x72, 0x0f,
+                0x15, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                0xb7, 0x0f, 0xd7, 0x54, 0x7d, 0x0f, 0xb5, 0x4f, 0x18, 0x0f, 0xd2, 0x54, 0x40, 0x0f, 0x53, 0x28, 0x02, 0x0f, 0xcd, 0x54,
+                0x7b, 0x0f, 0xa3, 0x00, 0x0e, 0x0f, 0xc8, 0x54, 0xba, 0x40, 0x41, 0x64, 0x64, 0x69, 0xed, 0x00, 0x27, 0x61, 0x6c, 0x27,
+                0x00, 0x0f, 0x71, 0x54, 0x62, 0x0d, 0x8a, 0x00, 0x0f, 0xd1, 0xab, 0x2d, 0x41, 0x69, 0x64, 0x63, 0x5f, 0x68, 0x00, 0x22,
+                0x65, 0x73, 0xb2, 0xbc, 0x09, 0x11, 0x00, 0x0b, 0x2e, 0x04, 0x0f, 0x1c, 0x00, 0x02, 0x04, 0xf2, 0xc7, 0x02, 0xc6, 0xe0,
+                0x02, 0xf4, 0xb6, 0x05, 0xd9, 0xf5, 0xa1, 0x77, 0x61, 0x76, 0x65, 0x66, 0x72, 0x6f, 0x6e, 0x74, 0x73, 0xe0, 0xe0, 0x11,
+                0x6c, 0x56, 0xc6, 0x0f, 0x2a, 0x00, 0x11, 0x02, 0x0a, 0xe1, 0x0f, 0x2e, 0x00, 0x16, 0x43, 0x75, 0x72, 0x66, 0x61, 0x13,
+                0x15, 0x0c, 0x2f, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x2f, 0x00, 0x2b, 0x31, 0x74, 0x65, 0x78, 0xb3, 0x57, 0x06, 0x2f, 0x00,
+                0x01, 0x83, 0x00, 0x00, 0xc6, 0x04, 0x47, 0x62, 0x61, 0x63, 0x6b, 0xbe, 0xc9, 0x06, 0x1f, 0x00, 0x10, 0x69, 0x98, 0xd4,
+                0x06, 0x56, 0x01, 0x03, 0x19, 0x00, 0x01, 0x5d, 0x00, 0x0f, 0x38, 0x00, 0x07, 0x4c, 0x74, 0x65, 0x78, 0x69, 0xc9, 0xd6,
+                0x8c, 0x5f, 0x6f, 0x6e, 0x5f, 0x74, 0x73, 0x6c, 0x31, 0x68, 0x01, 0x02, 0x2c, 0x00, 0x0f, 0x64, 0x00, 0x03, 0x60, 0x69,
+                0x6e, 0x5f, 0x73, 0x6d, 0x32, 0x0e, 0x00, 0x34, 0x72, 0x65, 0x71, 0x50, 0x00, 0x0a, 0xf2, 0xe2, 0x6f, 0x6d, 0x69, 0x6f,
+                0x32, 0x72, 0x66, 0x8d, 0x00, 0x02, 0x03, 0x1f, 0x00, 0x32, 0x5f, 0x70, 0x71, 0x32, 0x06, 0x0f, 0x40, 0x00, 0x05, 0x00,
+                0x21, 0x00, 0x02, 0xcb, 0x05, 0x0f, 0x22, 0x00, 0x02, 0x5e, 0x70, 0x73, 0x5f, 0x71, 0x75, 0x36, 0xee, 0x0f, 0x9c, 0xf7,
+                0x05, 0x0f, 0xba, 0xf7, 0x12, 0x2f, 0x66, 0x66, 0xe1, 0xf7, 0x14, 0x0b, 0x70, 0xc8, 0x8f, 0x65, 0x6c, 0x69, 0x67, 0x69,
+                0x62, 0x6c, 0x65, 0x7f, 0x2e, 0x07, 0x0e, 0x59, 0x03, 0x0f, 0x3d, 0x57, 0x56, 0x0f, 0x7b, 0x00, 0x1c, 0x0f, 0x5e, 0xae,
+                0x46, 0x0f, 0x0b, 0x04, 0xff, 0xff, 0xdf, 0x0f, 0x1b, 0x5a, 0x54, 0x0f, 0xb3, 0x07, 0x20, 0x0f, 0x09, 0x5a, 0x09, 0x02,
+                0xcc, 0x00, 0x71, 0x61, 0x6d, 0x6f, 0x72, 0x74, 0x69, 0x7a, 0x5f, 0xcd, 0x01, 0x15, 0xda, 0x5f, 0x74, 0x65, 0x6e, 0x63,
+                0x79, 0xdf, 0x04, 0x24, 0x0f, 0x4c, 0x33, 0x5c, 0x0f, 0x8c, 0x00, 0x11, 0x0f, 0x3a, 0x33, 0x4d, 0x0f, 0x46, 0x01, 0x0b,
+                0x0f, 0x8f, 0x0c, 0x63, 0x0f, 0x29, 0x02, 0x20, 0x0f, 0x7d, 0x0c, 0x0d, 0x04, 0x09, 0x04, 0x12, 0x6d, 0x64, 0xea, 0x57,
+                0x32, 0x78, 0x62, 0x61, 0x72, 0x74, 0x00, 0x07, 0x2b, 0x04, 0x20, 0x6d, 0x5f, 0x1c, 0x00, 0x12, 0x32, 0x0e, 0x00, 0x07,
+                0x22, 0x00, 0x0f, 0x52, 0x02, 0x23, 0x0f, 0xad, 0x0c, 0x61, 0x0f, 0x91, 0x00, 0x16, 0x0f, 0x9b, 0x0c, 0x51, 0x0f, 0x79,
+                0x01, 0x30, 0x0f, 0xa5, 0x61, 0x5b, 0x3f, 0x41, 0x6c, 0x6c, 0x96, 0x0c, 0x15, 0x35, 0x61, 0x6c, 0x6c, 0x91, 0x0c, 0x0f,
+                0x7b, 0x61, 0x15, 0x0f, 0x90, 0x00, 0x21, 0x0f, 0x6f, 0x05, 0x13, 0x00, 0x8e, 0x00, 0x02, 0xfd, 0x03, 0x0f, 0x8c, 0x00,
+                0x49, 0x0f, 0xdc, 0x03, 0x18, 0x00, 0x91, 0x00, 0x07, 0x32, 0x02, 0x0e, 0x96, 0x00, 0x1f, 0x21, 0x97, 0x00, 0x02, 0x41,
+                0x76, 0x61, 0x72, 0x20, 0x17, 0x00, 0x00, 0x73, 0x0f, 0x30, 0x69, 0x6f, 0x6e, 0x60, 0x04, 0x0f, 0x6a, 0x00, 0x00, 0xe1,
+                0x73, 0x42, 0x79, 0x43, 0x6c, 0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x28, 0x27, 0x31, 0x00, 0x01, 0x77, 0x11, 0x01,
+                0xac, 0x10, 0x08, 0x31, 0x02, 0x48, 0x66, 0x6f, 0x72, 0x28, 0x50, 0x00, 0x3a, 0x20, 0x6f, 0x66, 0x60, 0x00, 0x0c, 0xd8,
+                0x03, 0x08, 0x1d, 0x00, 0x70, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x20, 0xd6, 0xcf, 0x6c, 0x61, 0x79, 0x20, 0x3d,
+                0x20, 0x22, 0x6e, 0x6f, 0x6e, 0x65, 0x22, 0x91, 0x02, 0x0c, 0x02, 0x13, 0x00, 0x90, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69,
+                0x70, 0x74, 0x3e, 0x17, 0x00, 0x62, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x0b, 0x00, 0x00, 0x1e, 0x01, 0xf1, 0x0a, 0x20,
+                0x6f, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x3d, 0x22, 0x6f, 0x6e, 0x42, 0x6f, 0x64, 0x79, 0x4c, 0x6f, 0x61, 0x64, 0x65, 0x64,
+                0x28, 0x29, 0x22, 0x20, 0x71, 0x00, 0x20, 0x3d, 0x22, 0x80, 0x08, 0xf0, 0x01, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d,
+                0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x32, 0x30, 0x02, 0x00, 0x32, 0x3b, 0x22, 0x3e, 0x5d, 0x00, 0x24, 0x6e, 0x6f,
+                0x5e, 0x00, 0x02, 0x74, 0x00, 0xe2, 0x3c, 0x70, 0x3e, 0x45, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6a, 0x61, 0x76, 0x61,
+                0x1c, 0x00, 0x00, 0x39, 0x04, 0xa0, 0x73, 0x65, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x72, 0x74, 0xa5, 0x03, 0x10, 0x74,
+                0x3a, 0x01, 0x63, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x48, 0x00, 0x16, 0x2f, 0x49, 0x00, 0x02, 0x11, 0x00, 0x35, 0x64,
+                0x69, 0x76, 0x54, 0x00, 0x50, 0x64, 0x69, 0x76, 0x20, 0x63, 0x66, 0x01, 0x50, 0x3d, 0x22, 0x74, 0x69, 0x74, 0x30, 0x02,
+                0x23, 0x65, 0x61, 0x81, 0x00, 0x0f, 0x20, 0x00, 0x02, 0x37, 0x62, 0x61, 0x72, 0x1f, 0x00, 0xf0, 0x0a, 0x20, 0x20, 0x3c,
+                0x69, 0x6d, 0x67, 0x20, 0x73, 0x72, 0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x64, 0x65, 0x76,
+                0x65, 0x6c, 0xb1, 0x64, 0xf0, 0x0d, 0x2e, 0x6e, 0x76, 0x69, 0x64, 0x69, 0x61, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x73, 0x69,
+                0x74, 0x65, 0x73, 0x2f, 0x61, 0x6c, 0x6c, 0x2f, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x73, 0x26, 0x00, 0x92, 0x7a, 0x6f, 0x6e,
+                0x65, 0x5f, 0x6e, 0x65, 0x77, 0x2f, 0x28, 0x00, 0xb9, 0x5f, 0x6c, 0x6f, 0x67, 0x6f, 0x2e, 0x70, 0x6e, 0x67, 0x22, 0x2f,
+                0x61, 0x00, 0x00, 0xca, 0x00, 0x09, 0x83, 0x00, 0x46, 0x22, 0x20, 0x69, 0x64, 0x8e, 0x00, 0x01, 0xa8, 0x0a, 0xf1, 0x0d,
+                0x22, 0x3e, 0x4e, 0x73, 0x69, 0x67, 0x68, 0x74, 0x20, 0x50, 0x65, 0x72, 0x66, 0x20, 0x53, 0x44, 0x4b, 0x20, 0x50, 0x72,
+                0x6f, 0x66, 0x69, 0x6c, 0x65, 0x72, 0x20, 0x52, 0x1a, 0x01, 0x08, 0x11, 0x01, 0x02, 0x15, 0x01, 0x07, 0x05, 0x01, 0x0a,
+                0xe7, 0x00, 0xfa, 0x00, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0xee,
+                0x00, 0x01, 0x8d, 0x00, 0x0f, 0xc1, 0x01, 0x05, 0x31, 0x20, 0x23, 0x35, 0x01, 0x00, 0x04, 0xc2, 0x01, 0x05, 0x36, 0x00,
+                0x50, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0xa7, 0x02, 0xb0, 0x3d, 0x22, 0x73, 0x68, 0x6f, 0x77, 0x2d, 0x77, 0x6f, 0x72, 0x6b,
+                0x63, 0xbe, 0x83, 0x22, 0x3e, 0x53, 0x68, 0x6f, 0x77, 0x20, 0x57, 0x0f, 0x00, 0x31, 0x3a, 0x3c, 0x2f, 0x2a, 0x00, 0x0b,
+                0x3e, 0x00, 0x01, 0x23, 0xc2, 0x01, 0xf4, 0x00, 0x0a, 0x3d, 0x00, 0x10, 0x20, 0x2a, 0xc3, 0xc1, 0x3d, 0x22, 0x63, 0x68,
+                0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 0x20, 0x0a, 0x00, 0xa0, 0x65, 0x64, 0x20, 0x6f, 0x6e, 0x63, 0x6c, 0x69, 0x63,
+                0x6b, 0x7a, 0x02, 0x10, 0x43, 0x09, 0x00, 0x10, 0x5f, 0x66, 0x00, 0x04, 0x65, 0x00, 0x2b, 0x28, 0x29, 0x60, 0x01, 0x0b,
+                0x1a, 0x01, 0x0f, 0xe5, 0x00, 0x0f, 0x11, 0x33, 0x01, 0x00, 0x0f, 0xe5, 0x00, 0x09, 0xf1, 0x01, 0x6d, 0x6f, 0x62, 0x69,
+                0x6c, 0x65, 0x2d, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x22, 0x3e, 0x4d, 0x0f, 0x00, 0x21, 0x20, 0x4c, 0x0f, 0x00, 0x0f,
+                0xe5, 0x00, 0x0e, 0x0a, 0x3d, 0x00, 0x0f, 0xe5, 0x00, 0x17, 0x02, 0x66, 0x00, 0x02, 0x65, 0x00, 0x0f, 0xe5, 0x00, 0x0d,
+                0x09, 0xff, 0x01, 0x03, 0x0d, 0x00, 0x0f, 0x12, 0x03, 0x00, 0x03, 0x6e, 0x04, 0x15, 0x22, 0x1d, 0x00, 0x41, 0x20, 0x20,
+                0x3c, 0x74, 0x82, 0x03, 0x03, 0x1e, 0x01, 0x03, 0x36, 0x04, 0xf2, 0x13, 0x3a, 0x20, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65,
+                0x2d, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20,
+                0x73, 0x6f, 0x6c, 0x69, 0x64, 0x3b, 0xb4, 0x02, 0x11, 0x44, 0x30, 0x18, 0x30, 0x2d, 0x50, 0x72, 0x1f, 0x03, 0x3b, 0x74,
+                0x69, 0x65, 0x5d, 0x02, 0x12, 0x74, 0x41, 0x04, 0x09, 0x18, 0x01, 0x2a, 0x74, 0x72, 0x11, 0x00, 0x01, 0x27, 0x00, 0x40,
+                0x20, 0x63, 0x6f, 0x6c, 0xd1, 0x00, 0x44, 0x3d, 0x22, 0x32, 0x22, 0xac, 0x00, 0x31, 0x63, 0x61, 0x20, 0x9b, 0x00, 0x62,
+                0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x6a, 0x00, 0x00, 0x06, 0x03, 0x03, 0x6a, 0x00, 0x4b, 0x3c, 0x2f, 0x74, 0x68, 0x5b,
+                0x00, 0x1c, 0x2f, 0x5c, 0x00, 0x0f, 0x6d, 0x00, 0x05, 0x02, 0x61, 0x00, 0x40, 0x6c, 0x61, 0x22, 0x3e, 0x8b, 0x05, 0x0e,
+                0x4a, 0x00, 0x0d, 0x27, 0x00, 0x4f, 0x56, 0x61, 0x6c, 0x75, 0x28, 0x00, 0x00, 0x0c, 0x72, 0x00, 0x00, 0x22, 0x00, 0x0b,
+                0xf2, 0x00, 0x11, 0x3c, 0x59, 0x06, 0x02, 0xe1, 0x03, 0x01, 0x63, 0x06, 0x03, 0x63, 0x19, 0x00, 0x9c, 0xc5, 0x0f, 0x33,
+                0x01, 0x01, 0x11, 0x2f, 0x26, 0x00, 0x08, 0xd9, 0x01, 0x01, 0x05, 0x01, 0x0f, 0xb1, 0x01, 0x3c, 0x10, 0x43, 0x26, 0x00,
+                0x0f, 0xad, 0x01, 0x2f, 0x1f, 0x35, 0xad, 0x01, 0x0b, 0x02, 0x66, 0x00, 0x9f, 0x20, 0x4d, 0x65, 0x61, 0x73, 0x75, 0x72,
+                0x65, 0x64, 0xb2, 0x01, 0x56, 0xef, 0x72, 0x61, 0x22, 0x3e, 0x45, 0x6c, 0x61, 0x70, 0x73, 0x65, 0x64, 0x20, 0x54, 0x69,
+                0x2f, 0x00, 0x12, 0x00, 0x27, 0x00, 0x40, 0x20, 0x55, 0x6e, 0x69, 0x6a, 0x06, 0x0f, 0x2d, 0x00, 0x0e, 0x61, 0x41, 0x76,
+                0x67, 0x2e, 0x20, 0x46, 0xb4, 0x0f, 0x3f, 0x6e, 0x63, 0x79, 0x31, 0x00, 0x10, 0x00, 0x2c, 0x00, 0x0f, 0x5e, 0x00, 0x05,
+                0x0f, 0x44, 0x02, 0x28, 0x1f, 0x63, 0xc6, 0x01, 0x00, 0x0f, 0x40, 0x02, 0x0d, 0x0f, 0x1c, 0x04, 0x1b, 0x0e, 0x1f, 0x00,
+                0x12, 0x5f, 0xb2, 0x06, 0xa3, 0x3e, 0x4f, 0x76, 0x65, 0x72, 0x76, 0x69, 0x65, 0x77, 0x20, 0x76, 0x08, 0x0a, 0x58, 0x00,
+                0x0a, 0x3b, 0x00, 0x06, 0x1e, 0x06, 0x50, 0x54, 0x6f, 0x70, 0x2d, 0x4c, 0x4f, 0x07, 0xc2, 0x20, 0x53, 0x74, 0x61, 0x74,
+                0x73, 0x3a, 0x0a, 0x54, 0x68, 0x69, 0x73, 0x3a, 0x02, 0x97, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x54, 0x6f, 0x70, 0x20, 0xaf,
+                0x09, 0x70, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x1c, 0x00, 0x24, 0x20, 0x6f, 0x71, 0x00, 0x21, 0x6f, 0x66, 0x5a,
+                0x0c, 0x00, 0x47, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x97, 0x08, 0x14, 0x20, 0x3d, 0x10, 0xf1, 0x01, 0x2e,
+                0x0a, 0x49, 0x66, 0x20, 0x47, 0x52, 0x20, 0x45, 0x6e, 0x67, 0x69, 0x6e, 0x65, 0x20, 0x41, 0xce, 0x10, 0xe0, 0x25, 0x20,
+                0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x65, 0x08, 0x40, 0x31, 0x30, 0x30, 0x25, 0x1f,
+                0x0c, 0x70, 0x65, 0x20, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x00, 0xf1, 0x02, 0x6c, 0x69, 0x6b, 0x65, 0x6c, 0x79, 0x20,
+                0x73, 0x74, 0x61, 0x72, 0x76, 0x65, 0x64, 0x20, 0x62, 0x79, 0x1f, 0x00, 0xb0, 0x43, 0x50, 0x55, 0x3b, 0x20, 0x75, 0x73,
+                0x65, 0x20, 0x61, 0x20, 0x07, 0xbe, 0x00, 0x3d, 0x00, 0x20, 0x6f, 0x6c, 0x42, 0x00, 0x20, 0x69, 0x6d, 0x9f, 0x00, 0x00,
+                0xfb, 0x0c, 0x90, 0x61, 0x74, 0x2c, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0xb8, 0x08, 0x70, 0x74, 0x75, 0x72, 0x6e, 0x69,
+                0x6e, 0x67, 0x22, 0x00, 0x51, 0x6c, 0x6f, 0x77, 0x2d, 0x6c, 0xef, 0x00, 0x30, 0x47, 0x50, 0x55, 0xcd, 0x00, 0x8d, 0x66,
+                0x69, 0x6c, 0x69, 0x6e, 0x67, 0x2e, 0x0a, 0x2e, 0x01, 0x0f, 0xd4, 0x03, 0x29, 0x05, 0x55, 0x01, 0x11, 0x2d, 0x55, 0x01,
+                0x0f, 0xd6, 0x03, 0x2e, 0x1f, 0x33, 0xd6, 0x03, 0x04, 0x0b, 0xbd, 0x01, 0x0f, 0xf8, 0x02, 0x06, 0x0f, 0xcb, 0x05, 0x01,
+                0xbf, 0x22, 0x3e, 0x25, 0x2d, 0x6f, 0x66, 0x2d, 0x50, 0x65, 0x61, 0x6b, 0x38, 0x00, 0x0e, 0x19, 0x31, 0x38, 0x00, 0x0f,
+                0x36, 0x04, 0x33, 0x7f, 0x43, 0x61, 0x74, 0x65, 0x67, 0x6f, 0x72, 0xad, 0x03, 0x0d, 0x0f, 0x61, 0x04, 0x18, 0x0f, 0x13,
+                0x06, 0x04, 0x0d, 0x28, 0x00, 0x1f, 0x25, 0x24, 0x00, 0x0c, 0x96, 0x62, 0x61, 0x73, 0x65, 0x22, 0x3e, 0xe2, 0x94, 0x82,
+                0x03, 0x00, 0x2f, 0x96, 0x8c, 0x0f, 0x00, 0x1a, 0x0f, 0xd4, 0x00, 0x10, 0x22, 0x44, 0x65, 0x31, 0x0b, 0x01, 0xa9, 0x03,
+                0x0f, 0x82, 0x04, 0x31, 0x41, 0x74, 0x6f, 0x70, 0x5f, 0xda, 0x02, 0x00, 0xe0, 0x14, 0x0c, 0x74, 0x02, 0x0f, 0xc4, 0x06,
+                0x10, 0x30, 0x62, 0x72, 0x20, 0x55, 0x02, 0x21, 0x3d, 0x22, 0x1a, 0x00, 0x31, 0x5f, 0x73, 0x70, 0x60, 0xc1, 0x0f, 0x7c,
+                0x04, 0x05, 0x09, 0x41, 0x04, 0x08, 0x21, 0x04, 0x71, 0x3a, 0x0a, 0x4f, 0x62, 0x73, 0x65, 0x72, 0x85, 0x03, 0xb0, 0x65,
+                0x20, 0x6d, 0x6f, 0x73, 0x74, 0x20, 0x75, 0x74, 0x69, 0x6c, 0x17, 0x12, 0xa0, 0x20, 0x68, 0x61, 0x72, 0x64, 0x77, 0x61,
+                0x72, 0x65, 0x20, 0xd0, 0x1e, 0x21, 0x73, 0x2c, 0x60, 0x04, 0x60, 0x6e, 0x61, 0x76, 0x69, 0x67, 0x61, 0xaf, 0x10, 0x01,
+                0x9f, 0x10, 0xd0, 0x69, 0x72, 0x20, 0x63, 0x6f, 0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0xb4, 0x03, 0x03, 0xe5,
+                0x04, 0x10, 0x73, 0xf6, 0x09, 0x20, 0x20, 0x6d, 0xd0, 0x03, 0xb0, 0x64, 0x65, 0x74, 0x61, 0x69, 0x6c, 0x73, 0x2e, 0x20,
+                0x20, 0x54, 0x2b, 0x04, 0x40, 0x6f, 0x77, 0x73, 0x20, 0x54, 0x00, 0x71, 0x73, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x3b, 0x77,
+                0x00, 0x50, 0x66, 0x69, 0x72, 0x73, 0x74, 0x1b, 0x00, 0xb1, 0x20, 0x61, 0x6c, 0x77, 0x61, 0x79, 0x73, 0x20, 0x68, 0x61,
+                0x73, 0x19, 0x00, 0x40, 0x68, 0x69, 0x67, 0x68, 0x11, 0x11, 0x02, 0x93, 0x00, 0x01, 0x36, 0x11, 0x01, 0x9d, 0x04, 0x31,
+                0x61, 0x6c, 0x6c, 0x95, 0x00, 0x09, 0xda, 0x10, 0x00, 0x56, 0x00, 0x30, 0x6c, 0x65, 0x73, 0x3a, 0x00, 0x40, 0x61, 0x6e,
+                0x20, 0x36, 0x9d, 0x04, 0x01, 0x1a, 0x0a, 0x8a, 0x20, 0x77, 0x68, 0x65, 0x74, 0x68, 0x65, 0x72, 0xab, 0x04, 0x01, 0xa4,
+                0x04, 0x01, 0x52, 0x00, 0x20, 0x2d, 0x6c, 0xd9, 0xd3, 0xfd, 0x03, 0x65, 0x64, 0x20, 0x28, 0x6c, 0x6f, 0x77, 0x20, 0x3c,
+                0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x23, 0x16, 0x04, 0x0d, 0x13, 0x05, 0x51, 0x3c, 0x2f, 0x61, 0x3e, 0x29,
+                0x91, 0x00, 0x00, 0x19, 0x05, 0x0e, 0x52, 0x00, 0x00, 0x87, 0x18, 0x52, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0xe3, 0x04, 0x01,
+                0x81, 0x00, 0x05, 0x6e, 0x05, 0x00, 0x2f, 0x05, 0x02, 0x73, 0x13, 0x04, 0x2f, 0x00, 0x92, 0x2e, 0x20, 0x20, 0x49, 0x6e,
+                0x76, 0x65, 0x73, 0x74, 0x62, 0x01, 0x06, 0x8a, 0x00, 0x32, 0x4c, 0x32, 0x2d, 0x8b, 0x1e, 0x13, 0x2d, 0x8c, 0x1e, 0x42,
+                0x2d, 0x42, 0x79, 0x2d, 0x52, 0x73, 0x14, 0x2d, 0x53, 0x73, 0x20, 0x2d, 0x53, 0xe8, 0xe2, 0x41, 0x22, 0x3e, 0x4c, 0x32,
+                0x51, 0x06, 0x33, 0x6f, 0x72, 0x20, 0x2c, 0x00, 0x00, 0xa5, 0x00, 0x01, 0xbb, 0x01, 0x06, 0x50, 0x00, 0x30, 0x53, 0x4d,
+                0x2d, 0x33, 0xdf, 0x11, 0x2d, 0x34, 0xdf, 0x00, 0xde, 0x00, 0x41, 0x6c, 0x6c, 0x2d, 0x52, 0x07, 0xf0, 0x60, 0x73, 0x22,
+                0x3e, 0x53, 0x4d, 0x20, 0x1d, 0x00, 0x11, 0x20, 0x1d, 0x00, 0x00, 0xa9, 0x04, 0x33, 0x6c, 0x6c, 0x20, 0x1d, 0x00, 0x01,
+                0x4b, 0x00, 0x00, 0xd9, 0x01, 0x15, 0x61, 0x6e, 0x12, 0x6f, 0x20, 0x63, 0x6c, 0x75, 0x65, 0x73, 0x90, 0x05, 0x40, 0x07,
+                0xa4, 0x02, 0x0f, 0x13, 0x0b, 0x38, 0x1c, 0x6c, 0x90, 0x05, 0x08, 0x0c, 0x03, 0x0f, 0x90, 0x05, 0x37, 0x0f, 0x61, 0x05,
+                0x4c, 0x06, 0xb4, 0x00, 0x1f, 0x20, 0x6c, 0x05, 0x14, 0x0f, 0x44, 0x05, 0x61, 0x0f, 0x16, 0x05, 0x25, 0x07, 0xd4, 0x03,
+                0x0f, 0x16, 0x05, 0x56, 0xb0, 0x43, 0x61, 0x63, 0x68, 0x65, 0x20, 0x48, 0x69, 0x74, 0x2d, 0x52, 0x83, 0x15, 0x32, 0x3a,
+                0x0a, 0x42, 0x8d, 0x08, 0x00, 0xe3, 0x14, 0x30, 0x69, 0x64, 0x65, 0x53, 0x16, 0x21, 0x20, 0x63, 0x24, 0x00, 0x50, 0x68,
+                0x69, 0x74, 0x2d, 0x72, 0x24, 0x00, 0x00, 0x02, 0x05, 0x10, 0x62, 0xd4, 0x08, 0x83, 0x70, 0x72, 0x6f, 0x62, 0x6c, 0x65,
+                0x6d, 0x2c, 0xc7, 0x04, 0x60, 0x64, 0x65, 0x74, 0x65, 0x72, 0x6d, 0x26, 0x04, 0x12, 0x69, 0x68, 0x09, 0x0a, 0x21, 0x05,
+                0x0b, 0xb7, 0x04, 0x00, 0x07, 0x04, 0x00, 0xe6, 0x04, 0x45, 0x2c, 0x20, 0x6f, 0x72, 0x31, 0x00, 0x01, 0x69, 0x00, 0x52,
+                0x69, 0x73, 0x20, 0x61, 0x20, 0xa1, 0xfc, 0x00, 0xa6, 0x09, 0x0f, 0xbe, 0x03, 0x14, 0x00, 0xcb, 0x17, 0x00, 0x8a, 0x04,
+                0x32, 0x6c, 0x6c, 0x20, 0x8d, 0x1a, 0x3f, 0x3c, 0x61, 0x3e, 0x9e, 0x03, 0x3c, 0x01, 0x2c, 0x01, 0x15, 0x2d, 0x2c, 0x01,
+                0x0f, 0xb1, 0x0e, 0x46, 0x0b, 0x94, 0x01, 0x0f, 0x9e, 0x03, 0x1c, 0x05, 0x38, 0x00, 0x0f, 0xfb, 0x02, 0x00, 0x0f, 0x9f,
+                0x03, 0x21, 0x02, 0x6f, 0x05, 0x5f, 0x20, 0x53, 0x70, 0x61, 0x63, 0x8c, 0x00, 0x08, 0x0f, 0x05, 0x09, 0x1e, 0x6f, 0x41,
+                0x6c, 0x6c, 0x20, 0x4f, 0x70, 0xa5, 0x00, 0x01, 0x0f, 0xa0, 0x03, 0x82, 0x01, 0x9b, 0x02, 0x00, 0x06, 0x1f, 0x00, 0x76,
+                0x16, 0x0f, 0x7a, 0x0f, 0x20, 0x0f, 0xa0, 0x03, 0x0d, 0x0f, 0x5d, 0x0d, 0x35, 0x03, 0xae, 0x01, 0x00, 0xfc, 0x13, 0x7f,
+                0x6f, 0x72, 0x6d, 0x61, 0x6e, 0x63, 0x65, 0x67, 0x0d, 0x1b, 0x53, 0x4d, 0x61, 0x69, 0x6e, 0x20, 0x45, 0x00, 0x06, 0x6e,
+                0x05, 0x0a, 0x2d, 0x09, 0x98, 0x62, 0x61, 0x6e, 0x64, 0x77, 0x69, 0x64, 0x74, 0x68, 0x9f, 0x08, 0x60, 0x20, 0x70, 0x65,
+                0x72, 0x20, 0x6d, 0x3e, 0x00, 0x02, 0x9a, 0xc9, 0x10, 0x20, 0xa0, 0xf7, 0x00, 0xb6, 0x08, 0x0f, 0x83, 0x03, 0x3a, 0x00,
+                0x9f, 0x00, 0x04, 0x01, 0x08, 0x06, 0x9f, 0x00, 0x0f, 0xb8, 0x0c, 0x38, 0x0a, 0x28, 0x07, 0x0f, 0x0e, 0x01, 0x03, 0x0f,
+                0x2f, 0x07, 0x21, 0x1f, 0x70, 0x2f, 0x07, 0x36, 0x0f, 0x60, 0x03, 0x14, 0x2f, 0x42, 0x79, 0x3b, 0x04, 0x09, 0x06, 0x28,
+                0x00, 0x21, 0x4d, 0x69, 0x2a, 0x00, 0x4f, 0x2f, 0x53, 0x65, 0x63, 0x4f, 0x07, 0xb8, 0x00, 0x89, 0x02, 0x03, 0x23, 0xcc,
+                0x0f, 0x4b, 0x07, 0x56, 0x0d, 0x81, 0x0a, 0x35, 0x3a, 0x0a, 0x44, 0x13, 0x07, 0x52, 0x77, 0x68, 0x69, 0x63, 0x68, 0x50,
+                0x0c, 0x01, 0x94, 0x0a, 0x05, 0xc6, 0x7c, 0x02, 0xbf, 0x0b, 0x51, 0x69, 0x6e, 0x63, 0x75, 0x72, 0x6d, 0x07, 0x05, 0x8e,
+                0x0c, 0x26, 0x4c, 0x32, 0x69, 0x03, 0x02, 0x83, 0x0c, 0x02, 0x44, 0x00, 0x10, 0x64, 0x28, 0x0b, 0x17, 0x6e, 0x3c, 0x00,
+                0x20, 0x62, 0x65, 0x38, 0x00, 0x50, 0x61, 0x64, 0x64, 0x72, 0x65, 0x40, 0xe3, 0x20, 0x2e, 0x0a, 0x5b, 0x05, 0x01, 0x75,
+                0x02, 0x02, 0x8f, 0x00, 0x30, 0x73, 0x20, 0x76, 0x71, 0x0e, 0x02, 0x2d, 0x00, 0x40, 0x72, 0x65, 0x6c, 0x61, 0xc3, 0x0b,
+                0x04, 0x66, 0x1d, 0x51, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0xbd, 0x0c, 0x00, 0x29, 0x00, 0x01, 0x14, 0xd2, 0x00, 0x45, 0x00,
+                0x04, 0xc2, 0x10, 0x22, 0x4c, 0x32, 0x95, 0x07, 0x20, 0x2e, 0x0a, 0xc4, 0x0c, 0x00, 0xcd, 0x00, 0x11, 0x20, 0x72, 0x04,
+                0x50, 0x6f, 0x72, 0x22, 0x20, 0x72, 0x4d, 0x1b, 0x01, 0x0e, 0x08, 0xa0, 0x61, 0x20, 0x33, 0x32, 0x20, 0x62, 0x79, 0x74,
+                0x65, 0x20, 0x60, 0x18, 0x03, 0x76, 0x1a, 0x12, 0x61, 0x3a, 0x00, 0x00, 0xd6, 0x03, 0x37, 0x2e, 0x0a, 0x20, 0xae, 0x11,
+                0x20, 0x64, 0x65, 0xfa, 0xfb, 0x49, 0x6f, 0x73, 0x65, 0x73, 0xe4, 0x00, 0x00, 0x49, 0x00, 0x2a, 0x65, 0x61, 0xe1, 0x00,
+                0x11, 0x2c, 0x56, 0x04, 0x05, 0x2c, 0x01, 0x3f, 0x2e, 0x20, 0x41, 0x1d, 0x0c, 0x1c, 0x27, 0x22, 0x3e, 0x8b, 0x0d, 0x73,
+                0x65, 0x64, 0x20, 0x76, 0x65, 0x72, 0x73, 0xa0, 0x00, 0x15, 0x74, 0x92, 0x00, 0x01, 0xde, 0x0b, 0x30, 0x63, 0x61, 0x6e,
+                0xd6, 0x08, 0x10, 0x66, 0xdf, 0x17, 0x7f, 0x20, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x2e, 0xba, 0x04, 0x3a, 0x0f, 0xcb, 0x0c,
+                0x19, 0x0f, 0xf6, 0x0b, 0x44, 0x0d, 0xa1, 0x02, 0x00, 0xe6, 0x01, 0x03, 0xde, 0x04, 0x04, 0x83, 0x00, 0x0f, 0xdc, 0x04,
+                0x21, 0x03, 0x67, 0x02, 0x0f, 0x3b, 0x00, 0x1c, 0x2f, 0x4f, 0x70, 0x6c, 0x00, 0x2e, 0x0f, 0x4c, 0x05, 0x2e, 0x23, 0x54,
+                0x6f, 0x00, 0x01, 0x0f, 0xfb, 0x04, 0x10, 0x04, 0x58, 0x09, 0x0f, 0x03, 0x05, 0x0d, 0x01, 0xab, 0x00, 0x0f, 0xba, 0x11,
+                0x71, 0x0f, 0x61, 0x01, 0x08, 0x0f, 0xd6, 0x00, 0x97, 0x0f, 0xfd, 0x05, 0x21, 0x0f, 0x30, 0xd2, 0x11, 0x02, 0x1e, 0xf3,
+                0x0f, 0x1c, 0x06, 0x56, 0x0f, 0x00, 0x05, 0x11, 0x42, 0x66, 0x72, 0x6f, 0x6d, 0x02, 0x05, 0x03, 0xfd, 0x0c, 0x00, 0x2e,
+                0x06, 0x1f, 0x2c, 0x17, 0x05, 0x12, 0x90, 0x53, 0x65, 0x65, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x3a, 0xb5, 0x05, 0x00, 0xa5,
+                0x16, 0x00, 0x69, 0x00, 0x01, 0x10, 0x12, 0x80, 0x74, 0x20, 0x70, 0x72, 0x69, 0x6f, 0x72, 0x69, 0xf0, 0x24, 0x0f, 0x3c,
+                0x05, 0x1e, 0x07, 0x73, 0x00, 0x0e, 0x28, 0x04, 0x0d, 0x5d, 0x11, 0x0f, 0x54, 0x00, 0x02, 0x05, 0x32, 0x30, 0x00, 0x90,
+                0x02, 0x03, 0x0b, 0x00, 0x00, 0x3c, 0x00, 0x0f, 0x5d, 0x05, 0x50, 0x11, 0x53, 0x46, 0x01, 0x0f, 0x4e, 0x05, 0x5b, 0x02,
+                0x74, 0x00, 0x15, 0x20, 0x33, 0x31, 0x0f, 0x4f, 0x05, 0x57, 0x00, 0x24, 0x1a, 0x0f, 0x78, 0x00, 0x38, 0x0f, 0x3c, 0x00,
+                0x17, 0x0f, 0x41, 0x06, 0x3d, 0x0f, 0x42, 0x06, 0x9b, 0x10, 0x46, 0xb5, 0x03, 0x02, 0xf6, 0x01, 0x0f, 0x44, 0x06, 0xc1,
+                0x01, 0xdf, 0x00, 0x00, 0x5b, 0x02, 0x0f, 0xdd, 0x00, 0xc1, 0x0f, 0xfe, 0x07, 0xff, 0xd9, 0x02, 0x52, 0x07, 0x0f, 0x0b,
+                0x0e, 0x57, 0x49, 0x31, 0x54, 0x45, 0x58, 0x40, 0x11, 0x0c, 0x0a, 0x0e, 0x41, 0x73, 0x74, 0x61, 0x67, 0xdf, 0x14, 0x01,
+                0x66, 0x0d, 0x01, 0x2f, 0x00, 0x01, 0xf7, 0x13, 0x30, 0x27, 0x73, 0x20, 0x85, 0x30, 0x00, 0xf5, 0x06, 0x02, 0x58, 0x1e,
+                0x00, 0x7b, 0xed, 0x20, 0x6e, 0x67, 0xf1, 0x07, 0x04, 0xd1, 0x11, 0x02, 0x8c, 0x0d, 0x32, 0x4c, 0x53, 0x55, 0xf8, 0x1e,
+                0x21, 0x45, 0x58, 0x32, 0x00, 0x14, 0x73, 0xc6, 0x1e, 0x70, 0x20, 0x69, 0x6e, 0x20, 0x70, 0x61, 0x72, 0x3b, 0x30, 0x31,
+                0x6c, 0x2e, 0x20, 0x28, 0x00, 0x40, 0x68, 0x61, 0x6e, 0x64, 0x10, 0x08, 0x72, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x2c, 0x20,
+                0xd6, 0x25, 0x23, 0x2c, 0x20, 0x05, 0x31, 0x63, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0xe7, 0x1a, 0x02, 0x76, 0x31, 0x03,
+                0xc4, 0x11, 0x11, 0x3b, 0x13, 0x00, 0x00, 0xe6, 0xfc, 0xa7, 0x65, 0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x20,
+                0xcf, 0xfc, 0x01, 0xdb, 0x1a, 0x25, 0x45, 0x58, 0x5f, 0x00, 0x03, 0x26, 0x31, 0x02, 0x48, 0x00, 0x03, 0x5c, 0x00, 0x01,
+                0xb1, 0xe7, 0x0f, 0x05, 0x12, 0x3c, 0x01, 0x2f, 0x01, 0x0f, 0xff, 0x11, 0x31, 0x0f, 0xd7, 0x07, 0x00, 0x08, 0x4c, 0x1e,
+                0x0d, 0xc7, 0x01, 0x0f, 0x26, 0x03, 0x0f, 0x08, 0x7a, 0x06, 0x10, 0x3e, 0x7b, 0x01, 0x0f, 0xbc, 0x1e, 0x0f, 0x0f, 0x3c,
+                0x00, 0x03, 0x00, 0x79, 0x00, 0x0f, 0x68, 0x19, 0x3c, 0x31, 0x50, 0x69, 0x70, 0xd7, 0x1a, 0x1f, 0x67, 0x7c, 0x1e, 0x92,
+                0x0f, 0x61, 0x00, 0x4e, 0x0f, 0xe6, 0x00, 0x04, 0x0f, 0x73, 0x04, 0x22, 0x0b, 0xc6, 0x2d, 0x0f, 0x68, 0x04, 0x5c, 0x0f,
+                0x76, 0x12, 0x0d, 0x02, 0x26, 0xeb, 0x04, 0x98, 0x15, 0x00, 0x5d, 0x00, 0x00, 0x0d, 0x12, 0x0f, 0x85, 0x12, 0x13, 0x01,
+                0x61, 0x00, 0x02, 0x50, 0x05, 0x06, 0xab, 0x0c, 0x20, 0x2e, 0x0a, 0x39, 0x06, 0x02, 0x0d, 0x1a, 0x00, 0x39, 0x00, 0x50,
+                0x63, 0x61, 0x6c, 0x63, 0x75, 0xd4, 0x1d, 0x11, 0x64, 0x99, 0x0c, 0x00, 0x8f, 0x04, 0x12, 0x2f, 0x6e, 0x00, 0x84, 0x2f,
+                0x6f, 0x70, 0x20, 0x63, 0x6f, 0x6d, 0x62, 0x46, 0x0c, 0x92, 0x28, 0x62, 0x6f, 0x74, 0x68, 0x20, 0x6e, 0x75, 0x6d, 0x33,
+                0x2f, 0x01, 0x86, 0x00, 0x50, 0x64, 0x65, 0x6e, 0x6f, 0x6d, 0x21, 0x00, 0x00, 0x10, 0x00, 0x00, 0x21, 0x1f, 0x40, 0x70,
+                0x65, 0x63, 0x69, 0x50, 0x0b, 0x03, 0xa3, 0x12, 0x0a, 0x4f, 0x00, 0x10, 0x29, 0xd4, 0x04, 0x27, 0x6f, 0x77, 0x8f, 0x1a,
+                0x00, 0x34, 0x00, 0x46, 0x6f, 0x6e, 0x6c, 0x79, 0x92, 0x1a, 0x0f, 0x81, 0x1a, 0x03, 0x09, 0x13, 0x13, 0x03, 0x7e, 0x1a,
+                0x33, 0x2e, 0x0a, 0x54, 0xb5, 0x04, 0x03, 0x2d, 0x06, 0x00, 0x19, 0x00, 0x05, 0xa1, 0x0d, 0x10, 0x64, 0x4c, 0x05, 0x40,
+                0x74, 0x77, 0x6f, 0x20, 0x9c, 0x1f, 0x10, 0x3a, 0xe0, 0x0b, 0x02, 0x87, 0x00, 0x02, 0x2b, 0x05, 0x25, 0x62, 0x79, 0xe6,
+                0x04, 0x01, 0x9b, 0x05, 0x1f, 0x74, 0x7a, 0x13, 0x3b, 0x01, 0x7a, 0x01, 0x02, 0x7d, 0x13, 0x02, 0x42, 0x20, 0x30, 0x73,
+                0x75, 0x6d, 0x31, 0x06, 0x10, 0x22, 0x57, 0x04, 0x02, 0xb9, 0x11, 0x11, 0x22, 0x88, 0x00, 0x10, 0x22, 0x29, 0x00, 0x04,
+                0x11, 0x00, 0x40, 0x77, 0x69, 0x6c, 0x6c, 0x0c, 0x14, 0x34, 0x20, 0x75, 0x70, 0xab, 0x24, 0x00, 0xc5, 0x00, 0x01, 0x42,
+                0x0e, 0x5f, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x92, 0x17, 0x3d, 0x02, 0x8d, 0x05, 0x0a, 0x7e, 0x0d, 0x0f, 0x74, 0x0d, 0x2e,
+                0x1f, 0x34, 0x74, 0x0d, 0x05, 0x0f, 0xf0, 0x02, 0x00, 0x0f, 0x04, 0x0c, 0x0e, 0x06, 0x4d, 0x00, 0x00, 0xc7, 0x08, 0x33,
+                0x50, 0x65, 0x72, 0xe9, 0x0e, 0x02, 0xd3, 0x1a, 0x02, 0xb0, 0x01, 0x10, 0x54, 0x8d, 0x01, 0x0f, 0x4a, 0x00, 0x20, 0x22,
+                0x4f, 0x70, 0x40, 0x00, 0x01, 0xcd, 0x01, 0x0f, 0xa7, 0x05, 0x38, 0x0f, 0xc9, 0x0d, 0x0f, 0x0f, 0xc5, 0x09, 0x1f, 0x00,
+                0x5d, 0x00, 0x0f, 0x61, 0x0e, 0x12, 0x0f, 0xa6, 0x0a, 0x58, 0x08, 0x8a, 0x01, 0x0f, 0xeb, 0x00, 0xcc, 0x0f, 0x91, 0x0b,
+                0x3a, 0x0f, 0xe1, 0x00, 0x70, 0x0f, 0x29, 0x07, 0x28, 0x0f, 0x26, 0x04, 0x01, 0x0f, 0x44, 0x1d, 0x78, 0x12, 0x53, 0x30,
+                0x07, 0x0f, 0x44, 0x1d, 0x26, 0x46, 0x53, 0x4d, 0x20, 0x49, 0x26, 0x0b, 0x0f, 0x07, 0x0c, 0x0b, 0x02, 0x6b, 0x00, 0x04,
+                0xf3, 0x0b, 0x03, 0xcc, 0x25, 0x0f, 0xf5, 0x0b, 0x00, 0x02, 0x73, 0x06, 0x0f, 0x79, 0x26, 0x02, 0x02, 0x43, 0x00, 0x09,
+                0x98, 0x0b, 0x30, 0x0a, 0x53, 0x69, 0xb6, 0x00, 0x00, 0x0d, 0x21, 0x06, 0x5b, 0x00, 0x0f, 0x20, 0x0c, 0x00, 0x31, 0x2c,
+                0x20, 0x69, 0x89, 0x21, 0x40, 0x70, 0x6f, 0x73, 0x73, 0x1e, 0x3b, 0x02, 0xbd, 0x26, 0x62, 0x75, 0x6c, 0x74, 0x69, 0x70,
+                0x6c, 0x79, 0x07, 0x02, 0x3b, 0x00, 0x20, 0x74, 0x6f, 0xc9, 0x0b, 0x22, 0x63, 0x68, 0x50, 0x06, 0x20, 0x73, 0x69, 0x23,
+                0x00, 0x02, 0x10, 0x0c, 0x2f, 0x6c, 0x79, 0x50, 0x06, 0x3c, 0x37, 0x53, 0x4d, 0x2d, 0x3d, 0x01, 0x0f, 0xe5, 0x1d, 0x39,
+                0x0f, 0xc9, 0x13, 0x05, 0x0f, 0xaf, 0x01, 0x06, 0x0f, 0x6f, 0x2a, 0x1c, 0x00, 0xa9, 0x2b, 0x0f, 0x48, 0x06, 0x13, 0x0a,
+                0x96, 0x12, 0x6f, 0x70, 0x65, 0x72, 0x2d, 0x53, 0x4d, 0x84, 0x25, 0x6b, 0x0f, 0xe6, 0x29, 0x0a, 0x0f, 0xa3, 0x06, 0x02,
+                0x00, 0xcc, 0x01, 0x0f, 0x2b, 0x00, 0x10, 0x02, 0x52, 0x27, 0x2f, 0x6e, 0x73, 0x41, 0x12, 0x11, 0x3f, 0x49, 0x50, 0x43,
+                0x26, 0x00, 0x10, 0x8f, 0x26, 0x23, 0x78, 0x32, 0x35, 0x43, 0x32, 0x3b, 0x55, 0x0d, 0x10, 0x0f, 0xb2, 0x1e, 0x99, 0x2f,
+                0x73, 0x6d, 0x41, 0x0c, 0x61, 0x0b, 0xfc, 0x02, 0x11, 0x45, 0x23, 0x04, 0x39, 0x69, 0x6f, 0x6e, 0x5f, 0x2f, 0x03, 0xc2,
+                0x03, 0x1f, 0x73, 0x6b, 0x04, 0x00, 0x02, 0x6f, 0x42, 0x32, 0x73, 0x20, 0x28, 0xce, 0x0a, 0x00, 0xa4, 0x04, 0x00, 0xcf,
+                0x02, 0x04, 0x3a, 0x04, 0x04, 0xad, 0x0b, 0x02, 0x37, 0x2a, 0x00, 0x5b, 0x03, 0x40, 0x65, 0x61, 0x64, 0x25, 0xff, 0x2e,
+                0x20, 0x6c, 0x69, 0x92, 0x04, 0x11, 0x69, 0x9f, 0x2a, 0xa0, 0x68, 0x65, 0x61, 0x76, 0x79, 0x20, 0x62, 0x72, 0x61, 0x6e,
+                0xe7, 0x18, 0x50, 0x69, 0x76, 0x65, 0x72, 0x67, 0xa4, 0x39, 0x10, 0x20, 0xe8, 0x3c, 0x00, 0x3f, 0x10, 0x42, 0x20, 0x74,
+                0x61, 0x6b, 0x63, 0x2b, 0x00, 0xb8, 0x04, 0x00, 0xc2, 0x04, 0x50, 0x66, 0x2f, 0x65, 0x6c, 0x73, 0xe0, 0x0b, 0x10, 0x64,
+                0x45, 0x3c, 0x41, 0x74, 0x68, 0x73, 0x29, 0x47, 0x26, 0x00, 0xc7, 0x2a, 0x40, 0x6e, 0x75, 0x6d, 0x62, 0x97, 0x1e, 0x34,
+                0x6f, 0x66, 0x20, 0x77, 0x40, 0x00, 0x76, 0x26, 0x01, 0x48, 0x00, 0x00, 0x9d, 0x0c, 0x00, 0x28, 0x26, 0x82, 0x2e, 0x0a,
+                0x43, 0x72, 0x6f, 0x73, 0x73, 0x2d, 0x26, 0x2b, 0x02, 0x1e, 0x00, 0x03, 0x2e, 0x00, 0x00, 0x99, 0x11, 0x60, 0x74, 0x69,
+                0x73, 0x74, 0x69, 0x63, 0xeb, 0x10, 0x01, 0x8a, 0x0b, 0x09, 0x81, 0x26, 0x02, 0x1c, 0x06, 0x15, 0x2d, 0x29, 0x01, 0x01,
+                0x43, 0x01, 0x03, 0x31, 0x06, 0x05, 0x15, 0x00, 0x01, 0x1d, 0x19, 0x01, 0x3c, 0x01, 0x0f, 0x1d, 0x05, 0x4b, 0x07, 0x86,
+                0x00, 0x0f, 0x1c, 0x05, 0x53, 0x07, 0xe2, 0x00, 0x0f, 0xae, 0x04, 0x1a, 0x0f, 0x1b, 0x05, 0x25, 0x02, 0x31, 0x02, 0x10,
+                0x73, 0x8b, 0x07, 0x02, 0x9c, 0x2b, 0x8f, 0x28, 0x4d, 0x61, 0x78, 0x20, 0x33, 0x32, 0x29, 0x48, 0x00, 0x1c, 0x33, 0x41,
+                0x76, 0x67, 0xbc, 0x00, 0x25, 0x65, 0x64, 0x4d, 0x00, 0x0f, 0x3a, 0x05, 0xb4, 0x03, 0x18, 0x2b, 0x00, 0xc3, 0x02, 0x0f,
+                0x2e, 0x00, 0x14, 0x00, 0x0e, 0x01, 0x09, 0x92, 0x03, 0x0f, 0xd7, 0x27, 0x11, 0x0a, 0xc3, 0x03, 0x0f, 0xc0, 0x00, 0x59,
+                0x0f, 0x4e, 0x05, 0x24, 0x09, 0x17, 0x44, 0x0f, 0x51, 0x05, 0x59, 0x0c, 0x0e, 0x04, 0x0f, 0xf6, 0x09, 0x06, 0x01, 0x04,
+                0x16, 0x05, 0x98, 0x09, 0x01, 0xde, 0x09, 0x02, 0x76, 0x11, 0x08, 0xcc, 0x09, 0x05, 0xf9, 0x09, 0x0c, 0xcf, 0x04, 0x20,
+                0x20, 0x65, 0x45, 0x0b, 0x10, 0x69, 0x48, 0x2f, 0x23, 0x20, 0x28, 0xc8, 0x01, 0x10, 0x2f, 0x75, 0x01, 0x10, 0x29, 0x21,
+                0x16, 0x02, 0x38, 0x03, 0x14, 0x4c, 0x33, 0x00, 0x07, 0x88, 0x10, 0x00, 0x1c, 0x41, 0x51, 0x76, 0x61, 0x6c, 0x65, 0x6e,
+                0x31, 0x3d, 0x15, 0x22, 0xd4, 0x05, 0x32, 0x76, 0x6f, 0x63, 0x0c, 0x12, 0x14, 0x22, 0xf9, 0x04, 0xb0, 0x44, 0x33, 0x44,
+                0x2f, 0x47, 0x4c, 0x2f, 0x56, 0x75, 0x6c, 0x6b, 0x05, 0x3b, 0x03, 0x97, 0x11, 0x02, 0x25, 0x00, 0x40, 0x2c, 0x20, 0x65,
+                0x78, 0xc8, 0xfd, 0x01, 0x32, 0x0a, 0x10, 0x50, 0x24, 0xfe, 0x03, 0xf8, 0x00, 0x10, 0x73, 0x76, 0x30, 0x60, 0x72, 0x65,
+                0x20, 0x68, 0x65, 0x6c, 0x6f, 0x05, 0x04, 0x7b, 0x05, 0x00, 0x7a, 0x00, 0x00, 0xa2, 0x1e, 0x03, 0xa0, 0x48, 0x03, 0xa6,
+                0x24, 0x07, 0x97, 0x00, 0x50, 0x70, 0x72, 0x65, 0x73, 0x65, 0x1a, 0x00, 0x31, 0x20, 0x61, 0x73, 0xf4, 0x34, 0x01, 0x52,
+                0x06, 0x0f, 0x3b, 0x16, 0x3d, 0x0f, 0xc2, 0x05, 0x02, 0x0f, 0x3c, 0x05, 0x2c, 0x06, 0x06, 0x0a, 0x0d, 0x3c, 0x05, 0x0e,
+                0x19, 0x06, 0x0f, 0xb7, 0x04, 0x0c, 0x08, 0x41, 0x35, 0x05, 0x89, 0x0c, 0x02, 0xc6, 0x01, 0x25, 0x20, 0x28, 0x46, 0x05,
+                0x0f, 0xff, 0x04, 0x1d, 0x05, 0x8b, 0x03, 0x04, 0x55, 0x02, 0x0f, 0x4c, 0x00, 0x28, 0x06, 0x2f, 0x11, 0x03, 0x8d, 0x2d,
+                0x0f, 0xb4, 0x03, 0x12, 0x0f, 0x4a, 0x05, 0x11, 0x03, 0xee, 0x00, 0x0f, 0xa2, 0x16, 0x11, 0x04, 0x60, 0x04, 0x06, 0xe2,
+                0x02, 0x0f, 0x65, 0x04, 0x16, 0x0f, 0x33, 0x00, 0x21, 0x01, 0x57, 0x03, 0x0f, 0x6c, 0x0a, 0x10, 0x05, 0x68, 0x01, 0x05,
+                0x6d, 0x06, 0x0f, 0xf6, 0x0a, 0x11, 0x3f, 0x6e, 0x73, 0x74, 0x61, 0x00, 0x15, 0x0f, 0xcd, 0x0a, 0x98, 0x02, 0x58, 0x04,
+                0x03, 0x81, 0x05, 0x0d, 0x67, 0x03, 0x0f, 0x82, 0x05, 0x4b, 0x23, 0x52, 0x65, 0x42, 0x23, 0x59, 0x55, 0x73, 0x61, 0x67,
+                0x65, 0xcc, 0x0a, 0x62, 0x72, 0x65, 0x76, 0x65, 0x61, 0x6c, 0x65, 0x35, 0x80, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x74,
+                0x79, 0x2c, 0x0a, 0x02, 0x78, 0x23, 0x02, 0x82, 0x02, 0x14, 0x72, 0x3f, 0x00, 0x10, 0x75, 0x90, 0x15, 0x33, 0x6f, 0x6e,
+                0x20, 0xeb, 0x54, 0x02, 0x8b, 0x05, 0x00, 0x29, 0x28, 0x00, 0xdd, 0x04, 0x01, 0x99, 0x23, 0x30, 0x78, 0x70, 0x6c, 0x23,
+                0x2c, 0x00, 0x79, 0x0a, 0x01, 0x81, 0x30, 0xcf, 0x6f, 0x63, 0x63, 0x75, 0x70, 0x61, 0x6e, 0x63, 0x79, 0x2e, 0x20, 0x20,
+                0xe1, 0x04, 0x06, 0x02, 0xf1, 0x0d, 0x0f, 0xda, 0x04, 0x3f, 0x04, 0xf7, 0x00, 0x11, 0x2d, 0xf7, 0x00, 0x0f, 0xd8, 0x04,
+                0x49, 0x0a, 0x61, 0x01, 0x0f, 0xd6, 0x04, 0x1d, 0x1f, 0x4d, 0x0c, 0x0a, 0x14, 0x0a, 0x37, 0x00, 0x33, 0x56, 0x54, 0x47,
+                0x50, 0x05, 0x0f, 0x39, 0x00, 0x1c, 0x08, 0x9e, 0x06, 0x0f, 0x3b, 0x00, 0x1c, 0x40, 0x43, 0x6f, 0x6d, 0x70, 0x33, 0x11,
+                0x0f, 0x3d, 0x00, 0x05, 0x0f, 0xe7, 0x04, 0x22, 0x0f, 0x82, 0x1b, 0x14, 0x00, 0x26, 0x02, 0x01, 0xca, 0x32, 0x0f, 0xae,
+                0x1b, 0x91, 0x0f, 0xb1, 0x00, 0xff, 0xf4, 0x0f, 0x2b, 0x06, 0x24, 0x04, 0x70, 0x05, 0x2e, 0x5f, 0x75, 0xb8, 0x04, 0x0f,
+                0x29, 0x06, 0x4b, 0x01, 0xb1, 0x07, 0x20, 0x43, 0x61, 0xaa, 0x4c, 0x03, 0x65, 0x09, 0x03, 0x50, 0x36, 0x0f, 0x34, 0x06,
+                0x06, 0x01, 0xa0, 0x0b, 0x00, 0xb1, 0x10, 0x32, 0x69, 0x6c, 0x79, 0x20, 0x06, 0x0b, 0x35, 0x06, 0x0f, 0x25, 0x06, 0x1a,
+                0x04, 0xd3, 0x3b, 0x07, 0x27, 0x06, 0x42, 0x7a, 0x65, 0x72, 0x6f, 0x5d, 0x40, 0x08, 0x31, 0x3b, 0x60, 0x74, 0x6f, 0x6f,
+                0x20, 0x73, 0x6d, 0x2b, 0x00, 0x40, 0x74, 0x6f, 0x20, 0x66, 0xe4, 0x1b, 0x56, 0x65, 0x76, 0x65, 0x72, 0x79, 0xaa, 0x3c,
+                0x02, 0xff, 0x36, 0x43, 0x6c, 0x6f, 0x74, 0x2c, 0x64, 0x0c, 0x01, 0x46, 0x37, 0x00, 0x3e, 0x16, 0x00, 0xde, 0x06, 0x06,
+                0xa2, 0x3b, 0x0f, 0x76, 0x06, 0x3f, 0x01, 0x06, 0x0a, 0x52, 0x43, 0x61, 0x6e, 0x74, 0x2d, 0x43, 0x01, 0x0f, 0x78, 0x06,
+                0x49, 0x0f, 0xb0, 0x01, 0x06, 0x0f, 0x10, 0x10, 0x1d, 0x23, 0x6e, 0x79, 0x3a, 0x00, 0x0f, 0x4a, 0x0b, 0x21, 0x4f, 0x41,
+                0x6c, 0x6c, 0x6f, 0x77, 0x1c, 0x0f, 0x0a, 0x39, 0x00, 0x40, 0x52, 0x65, 0x67, 0x69, 0x6d, 0x66, 0x0f, 0x3d, 0x00, 0x22,
+                0xaf, 0x41, 0x74, 0x74, 0x72, 0x2f, 0x53, 0x68, 0x4d, 0x65, 0x6d, 0x3f, 0x00, 0x14, 0x0a, 0xc6, 0x06, 0x10, 0x4f, 0x66,
+                0x13, 0x0f, 0xbd, 0x06, 0x5b, 0x0f, 0x2f, 0x05, 0x72, 0x0f, 0x85, 0x00, 0xff, 0x7d, 0x0f, 0x71, 0x03, 0x0c, 0x0f, 0xbb,
+                0x06, 0x9f, 0x03, 0x3e, 0x54, 0x00, 0x88, 0x04, 0x02, 0xac, 0x57, 0x0f, 0xb7, 0x3d, 0x57, 0x0f, 0xac, 0x40, 0x08, 0x09,
+                0xbb, 0x06, 0x00, 0x26, 0x4d, 0x00, 0x92, 0x11, 0x00, 0x12, 0x06, 0x00, 0xf7, 0x46, 0x01, 0x18, 0x17, 0x08, 0x5f, 0x12,
+                0x01, 0x27, 0x4f, 0x30, 0x72, 0x69, 0x62, 0xe6, 0x0a, 0x01, 0xdc, 0x06, 0x00, 0x45, 0x4f, 0x02, 0xd2, 0x06, 0x01, 0x53,
+                0x06, 0x05, 0xc0, 0x0d, 0x80, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x2e, 0x0a, 0x46, 0x67, 0x17, 0x36, 0x61, 0x72, 0x67, 0x9f,
+                0x06, 0x04, 0xf1, 0x11, 0x0f, 0x2b, 0x17, 0x10, 0x02, 0x25, 0x18, 0x02, 0xa2, 0x17, 0x01, 0x81, 0x47, 0x01, 0xc3, 0x0f,
+                0x04, 0xd8, 0x12, 0x05, 0x87, 0x35, 0x07, 0xe0, 0x06, 0x46, 0x53, 0x4d, 0x27, 0x73, 0xdc, 0x06, 0x70, 0x73, 0x2c, 0x20,
+                0x72, 0x65, 0x64, 0x75, 0x23, 0x01, 0x01, 0x6f, 0x00, 0x03, 0x98, 0x0d, 0x02, 0x21, 0x00, 0x03, 0x54, 0x42, 0x02, 0x02,
+                0x23, 0x75, 0x75, 0x73, 0x75, 0x61, 0x6c, 0x6c, 0x79, 0x69, 0x47, 0x11, 0x77, 0x18, 0x3e, 0x00, 0xcc, 0x06, 0x03, 0xc8,
+                0x00, 0x01, 0xcf, 0x36, 0x01, 0x23, 0x01, 0x00, 0x13, 0x43, 0x0f, 0x93, 0x43, 0x19, 0x05, 0x31, 0x01, 0x0f, 0x4e, 0x07,
+                0x47, 0x0f, 0xe1, 0x3e, 0x02, 0x0f, 0xe2, 0x17, 0x47, 0x0f, 0xf6, 0x42, 0x07, 0x0f, 0x67, 0x06, 0x1a, 0x00, 0x57, 0x16,
+                0x01, 0x4b, 0x00, 0x12, 0x4c, 0x8a, 0x01, 0x0f, 0x3f, 0x1d, 0x1c, 0x00, 0x3f, 0x00, 0x01, 0x3c, 0x11, 0x0f, 0x3f, 0x00,
+                0x06, 0x0f, 0xb1, 0x06, 0x21, 0x03, 0x4d, 0x00, 0x0f, 0xee, 0x07, 0x0d, 0x0f, 0x5f, 0x3b, 0x1e, 0x0f, 0x52, 0x05, 0x72,
+                0x12, 0x43, 0xe9, 0x40, 0x0f, 0x29, 0x00, 0x27, 0x0f, 0xf6, 0x04, 0x26, 0x10, 0x69, 0x2e, 0x02, 0x0f, 0xf5, 0x04, 0x45,
+                0x0f, 0xc8, 0x21, 0x35, 0x34, 0x33, 0x44, 0x20, 0x70, 0x19, 0x0f, 0xc1, 0x21, 0x1b, 0x21, 0x50, 0x72, 0x82, 0x21, 0x90,
+                0x76, 0x65, 0x20, 0x44, 0x61, 0x74, 0x61, 0x20, 0x46, 0x90, 0x52, 0x0e, 0x56, 0x05, 0x01, 0x62, 0x28, 0x23, 0x72, 0x65,
+                0x92, 0x35, 0x00, 0x2c, 0x35, 0x03, 0x55, 0x05, 0x02, 0x03, 0x0c, 0x03, 0xd2, 0x27, 0x00, 0xac, 0x04, 0xc0, 0x6f, 0x66,
+                0x20, 0x67, 0x65, 0x6f, 0x6d, 0x65, 0x74, 0x72, 0x79, 0x20, 0x68, 0x5e, 0x04, 0x07, 0x43, 0x01, 0x43, 0x00, 0x80, 0x33,
+                0x44, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x72, 0x1c, 0x04, 0x38, 0x1d, 0x07, 0x14, 0x4c, 0x34, 0x61, 0x63, 0x68, 0xef,
+                0x04, 0x02, 0xaf, 0x70, 0x4f, 0x69, 0x7a, 0x65, 0x72, 0x78, 0x04, 0x3c, 0x05, 0xf0, 0x00, 0x10, 0x2d, 0xf0, 0x00, 0x10,
+                0x2d, 0xf0, 0x00, 0x0f, 0xc6, 0x0b, 0x2f, 0x1f, 0x30, 0xde, 0x42, 0x04, 0x0f, 0x5d, 0x01, 0x00, 0x0f, 0x39, 0x27, 0x37,
+                0x02, 0xec, 0x01, 0x0f, 0xa5, 0x0a, 0x14, 0x11, 0x49, 0x68, 0x53, 0x05, 0x90, 0x00, 0x0f, 0x49, 0x03, 0x11, 0x02, 0x33,
+                0x00, 0x10, 0x56, 0x7f, 0x51, 0x0f, 0x0e, 0x43, 0x0f, 0x06, 0x31, 0x00, 0x00, 0xc1, 0x0b, 0x01, 0x64, 0x07, 0x0f, 0xad,
+                0x03, 0x12, 0x10, 0x75, 0xf6, 0x5f, 0x0f, 0x98, 0x00, 0x1b, 0x3f, 0x4f, 0x75, 0x74, 0xcc, 0x00, 0x1e, 0x03, 0x34, 0x00,
+                0x0f, 0xcd, 0x00, 0x18, 0x03, 0x32, 0x00, 0x0f, 0xce, 0x00, 0x09, 0x0f, 0x52, 0x04, 0x21, 0x14, 0x70, 0xb6, 0x00, 0x02,
+                0x85, 0x61, 0x02, 0x84, 0x03, 0x0f, 0x49, 0x09, 0x54, 0x11, 0x52, 0x54, 0x03, 0x0f, 0xe8, 0x03, 0x37, 0x10, 0x70, 0x6d,
+                0x14, 0x02, 0x5e, 0x2d, 0x40, 0x73, 0x61, 0x6d, 0x70, 0x17, 0x31, 0x6f, 0x28, 0x4d, 0x53, 0x41, 0x41, 0x29, 0xf4, 0x03,
+                0x0e, 0x0f, 0xd4, 0x03, 0x3c, 0x02, 0xd9, 0x00, 0x0f, 0xd1, 0x03, 0x39, 0x0f, 0xd0, 0x03, 0x04, 0x0c, 0x42, 0x01, 0x0f,
+                0x9e, 0x15, 0x21, 0x0f, 0x6b, 0x08, 0x1d, 0x12, 0x53, 0x5b, 0x01, 0x0f, 0x38, 0x04, 0x64, 0x02, 0xb3, 0x00, 0x2f, 0x20,
+                0x49, 0xcc, 0x0c, 0x11, 0x03, 0x2c, 0x00, 0x20, 0x4b, 0x69, 0xd4, 0x03, 0x0f, 0x30, 0x00, 0x17, 0x1f, 0x4f, 0x6d, 0x32,
+                0x0e, 0x00, 0x2d, 0x00, 0x03, 0x07, 0x01, 0x0f, 0x8a, 0x00, 0x13, 0x04, 0x2d, 0x00, 0x0f, 0x8b, 0x00, 0x16, 0x04, 0x31,
+                0x00, 0x0f, 0x8c, 0x00, 0x02, 0x0f, 0xe8, 0x03, 0x21, 0x03, 0x6f, 0x77, 0x0f, 0xe5, 0x03, 0x61, 0x10, 0x79, 0x2e, 0x2e,
+                0x01, 0x38, 0x0c, 0x05, 0x5a, 0x2d, 0x0f, 0xea, 0x03, 0x00, 0x30, 0x52, 0x54, 0x43, 0x75, 0x07, 0x07, 0xd6, 0x46, 0x06,
+                0x7e, 0x1f, 0x06, 0xb6, 0x0c, 0x05, 0x74, 0x13, 0x10, 0x72, 0x1f, 0x0c, 0x40, 0x63, 0x61, 0x73, 0x74, 0xed, 0x19, 0x10,
+                0x20, 0x02, 0x04, 0x11, 0x6c, 0x0c, 0x31, 0x01, 0xa5, 0x13, 0x41, 0x48, 0x4c, 0x53, 0x4c, 0x75, 0x00, 0xa0, 0x65, 0x52,
+                0x61, 0x79, 0x28, 0x29, 0x20, 0x2f, 0x20, 0x47, 0x12, 0x00, 0x01, 0x08, 0x54, 0x81, 0x52, 0x61, 0x79, 0x45, 0x58, 0x54,
+                0x28, 0x29, 0xee, 0x0c, 0x03, 0xad, 0x60, 0x02, 0x4e, 0x00, 0x02, 0x5b, 0x4b, 0x20, 0x72, 0x65, 0x56, 0x00, 0x06, 0x89,
+                0x29, 0x00, 0xb3, 0x0c, 0x11, 0x73, 0xd9, 0x13, 0x00, 0xab, 0x00, 0x32, 0x65, 0x61, 0x72, 0x14, 0x08, 0x01, 0x91, 0x4e,
+                0x31, 0x6e, 0x20, 0x69, 0x93, 0x5f, 0x03, 0xc2, 0x5d, 0x02, 0x2b, 0x30, 0x0c, 0xbf, 0x04, 0x04, 0xd2, 0x30, 0x01, 0xbc,
+                0x4e, 0x02, 0x03, 0x0e, 0x52, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x75, 0x00, 0x00, 0xe3, 0x00, 0x03, 0x73, 0x00, 0x00, 0x10,
+                0x00, 0x0f, 0x89, 0x04, 0x3e, 0x10, 0x79, 0xf5, 0x00, 0x45, 0x69, 0x6e, 0x67, 0x2d, 0x7c, 0x01, 0x0f, 0x8d, 0x04, 0x48,
+                0x0f, 0xea, 0x01, 0x00, 0x0f, 0x92, 0x04, 0x1d, 0x21, 0x65, 0x72, 0xf3, 0x3a, 0x01, 0x8e, 0x0c, 0x01, 0xfe, 0x2b, 0x4f,
+                0x28, 0x61, 0x76, 0x67, 0x28, 0x1f, 0x1d, 0x01, 0xe3, 0x1a, 0x5f, 0x20, 0x28, 0x73, 0x75, 0x6d, 0x62, 0x1f, 0x22, 0x0f,
+                0xdb, 0x29, 0x37, 0x0f, 0xd1, 0x0c, 0x14, 0x01, 0x83, 0x16, 0x0f, 0x84, 0x18, 0x3c, 0x00, 0xf5, 0x48, 0x01, 0xee, 0x1c,
+                0x0f, 0x31, 0x00, 0x15, 0x0f, 0x85, 0x00, 0x19, 0x5f, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0xc8, 0x04, 0x11, 0x0f, 0x4f, 0x12,
+                0x95, 0x15, 0x72, 0x29, 0x03, 0x2f, 0x5f, 0x62, 0x29, 0x03, 0x03, 0x0f, 0x5c, 0x0d, 0x78, 0x06, 0x77, 0x65, 0x00, 0xc5,
+                0x42, 0x04, 0x02, 0x41, 0x05, 0x73, 0x03, 0x1f, 0x73, 0x71, 0x0d, 0x1b, 0x02, 0x1f, 0x43, 0x00, 0xb3, 0x18, 0x80, 0x6e,
+                0x20, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x09, 0x35, 0x04, 0x4d, 0x00, 0x0a, 0x06, 0x50, 0x0f, 0x14, 0x54, 0x1c, 0x07,
+                0x9d, 0x41, 0x07, 0xcf, 0x42, 0x01, 0x83, 0x42, 0x20, 0x20, 0x49, 0xb5, 0x50, 0x0f, 0x8d, 0x48, 0x18, 0x0f, 0xa2, 0x43,
+                0x04, 0x0a, 0x8d, 0x43, 0x0f, 0x36, 0x48, 0x5e, 0x0f, 0x30, 0x48, 0xd4, 0x0f, 0x5b, 0x43, 0x3e, 0x0f, 0x5c, 0x43, 0x90,
+                0x0f, 0x24, 0x49, 0xff, 0x4f, 0x0f, 0xbf, 0x43, 0xff, 0xaa, 0x0f, 0xe0, 0x4a, 0xff, 0x0b, 0x0f, 0xda, 0x4a, 0x7a, 0x09,
+                0x21, 0x07, 0x0f, 0xd2, 0x4a, 0x04, 0x0f, 0x5c, 0x07, 0x02, 0x0f, 0x4d, 0x07, 0x50, 0x07, 0xa1, 0x4a, 0x0f, 0x47, 0x07,
+                0x59, 0x0f, 0xda, 0x05, 0x30, 0x0f, 0x3b, 0x00, 0x16, 0x0f, 0xa2, 0x49, 0x67, 0x0f, 0xb4, 0x07, 0xc4, 0x0f, 0x47, 0x07,
+                0x21, 0x0f, 0xae, 0x04, 0xb2, 0x0f, 0x1d, 0x08, 0xff, 0xff, 0x88, 0x0f, 0x47, 0x07, 0x36, 0x05, 0xa7, 0x06, 0x0f, 0x7a,
+                0x0f, 0x86, 0x61, 0x45, 0x78, 0x68, 0x61, 0x75, 0x73, 0x41, 0x1b, 0x10, 0x4c, 0xa9, 0x38, 0x2f, 0x6e, 0x67, 0x6d, 0x0f,
+                0x07, 0x0f, 0xd5, 0x07, 0x10, 0x0f, 0x51, 0x07, 0x29, 0x44, 0x41, 0x6c, 0x6c, 0x2d, 0x3f, 0x74, 0x0f, 0x84, 0x5b, 0x46,
+                0x00, 0x47, 0x2f, 0x04, 0x65, 0x00, 0x0f, 0xca, 0x13, 0x85, 0x00, 0xdd, 0x65, 0x0f, 0x3a, 0x00, 0x00, 0x05, 0xb5, 0x10,
+                0x04, 0x10, 0x72, 0x90, 0x65, 0x6e, 0x2e, 0x77, 0x69, 0x6b, 0x69, 0x70, 0x65, 0x0c, 0x72, 0x40, 0x6f, 0x72, 0x67, 0x2f,
+                0x0e, 0x00, 0x60, 0x2f, 0x44, 0x69, 0x6d, 0x65, 0x6e, 0x97, 0x58, 0xe0, 0x61, 0x6c, 0x5f, 0x61, 0x6e, 0x61, 0x6c, 0x79,
+                0x73, 0x69, 0x73, 0x22, 0x20, 0x74, 0x66, 0x23, 0xb7, 0x74, 0x3d, 0x22, 0x5f, 0x62, 0x6c, 0x61, 0x6e, 0x6b, 0x22, 0x3e,
+                0x26, 0x00, 0x04, 0x11, 0x6c, 0x1f, 0x61, 0xe3, 0x68, 0x35, 0x02, 0x5f, 0x01, 0x0f, 0x54, 0x63, 0x89, 0x0f, 0xb0, 0x14,
+                0xc7, 0x0f, 0xbb, 0x04, 0x21, 0x08, 0x8c, 0x77, 0x0f, 0xea, 0x0b, 0x41, 0x0f, 0x15, 0x04, 0x2d, 0x02, 0xc4, 0x77, 0x0f,
+                0x13, 0x04, 0x4a, 0x01, 0x63, 0x00, 0x13, 0x20, 0xc7, 0x77, 0x0f, 0xd2, 0x03, 0x1c, 0x00, 0xac, 0x1c, 0x0f, 0x3a, 0x03,
+                0x33, 0x02, 0x86, 0x00, 0x0f, 0x38, 0x03, 0x99, 0x01, 0xde, 0x06, 0x0f, 0x18, 0x60, 0x11, 0x20, 0x61, 0x78, 0x64, 0x01,
+                0x0f, 0xbb, 0x72, 0x34, 0x06, 0xaf, 0x79, 0x0f, 0xaf, 0x02, 0x81, 0x0f, 0x73, 0x69, 0x39, 0x0f, 0xb4, 0x02, 0x09, 0x07,
+                0xbf, 0x68, 0x0f, 0xb9, 0x02, 0x06, 0x0f, 0xa3, 0x13, 0x22, 0x0f, 0x17, 0x69, 0xc6, 0x0b, 0x56, 0x7b, 0x0f, 0x95, 0x09,
+                0x58, 0x09, 0x64, 0x7b, 0x0f, 0x6e, 0x02, 0x31, 0x0f, 0xa5, 0x52, 0x2d, 0x04, 0x1c, 0x75, 0x06, 0xc8, 0x76, 0x24, 0x3a,
+                0x20, 0x84, 0x80, 0x0f, 0x21, 0x09, 0x08, 0x0f, 0x8a, 0x1a, 0x22, 0x0d, 0x81, 0x8a, 0x0c, 0x7b, 0x00, 0x0f, 0x7a, 0x76,
+                0x55, 0x0f, 0x35, 0x01, 0x4a, 0x02, 0xa6, 0x06, 0x0f, 0x33, 0x01, 0x3c, 0x03, 0xff, 0x83, 0x0f, 0x31, 0x01, 0xc2, 0x0f,
+                0x33, 0x6e, 0x0a, 0x0f, 0x36, 0x01, 0x2a, 0x08, 0x11, 0x83, 0x0f, 0x3b, 0x01, 0x2b, 0x0f, 0xd2, 0x03, 0x9a, 0x02, 0xe7,
+                0x78, 0x0f, 0xc8, 0x03, 0x58, 0x0f, 0xbe, 0x79, 0x01, 0x0f, 0x8d, 0x02, 0x89, 0x0d, 0x21, 0x01, 0x0f, 0xb4, 0x03, 0x49,
+                0x0f, 0x1d, 0x01, 0xae, 0x0f, 0xa0, 0x03, 0x53, 0x0f, 0x27, 0x01, 0x21, 0x0f, 0x96, 0x03, 0x9a, 0x31, 0x54, 0x6f, 0x70,
+                0xff, 0x74, 0x02, 0x69, 0x7a, 0x0f, 0x9d, 0x03, 0x57, 0x09, 0x78, 0x00, 0x0f, 0x87, 0x02, 0x97, 0x0f, 0x2f, 0x01, 0x05,
+                0x0f, 0xab, 0x03, 0x49, 0x0f, 0x2b, 0x01, 0xbc, 0x0f, 0xb9, 0x03, 0x53, 0x0f, 0x35, 0x01, 0x28, 0x0f, 0xc0, 0x03, 0x9d,
+                0x08, 0xe9, 0x79, 0x0f, 0xc1, 0x03, 0x5a, 0x0f, 0x4b, 0x0e, 0x06, 0x0f, 0x97, 0x02, 0x8c, 0x0f, 0x31, 0x01, 0x03, 0x0f,
+                0xc3, 0x03, 0x4c, 0x0f, 0x2d, 0x01, 0xbb, 0x0f, 0xc5, 0x03, 0x56, 0x0f, 0x37, 0x01, 0x26, 0x0f, 0x1c, 0x0b, 0x9b, 0x00,
+                0xfb, 0x5c, 0x32, 0x48, 0x69, 0x74, 0x98, 0x78, 0x0f, 0x23, 0x0b, 0x58, 0x08, 0x78, 0x00, 0x0f, 0x0d, 0x0a, 0x98, 0x0f,
+                0x2f, 0x01, 0x04, 0x0f, 0x31, 0x0b, 0x4a, 0x0f, 0x2b, 0x01, 0xbb, 0x0f, 0x3f, 0x0b, 0x54, 0x0f, 0x35, 0x01, 0x27, 0x0f,
+                0xc0, 0x03, 0x9a, 0x00, 0x3c, 0x77, 0x02, 0x1c, 0x20, 0x0f, 0xbd, 0x03, 0x58, 0x06, 0x75, 0x00, 0x0f, 0x8f, 0x02, 0x97,
+                0x0f, 0x29, 0x01, 0x02, 0x0f, 0xb7, 0x03, 0x49, 0x0f, 0x25, 0x01, 0xb6, 0x0f, 0xb1, 0x03, 0x53, 0x0f, 0x2f, 0x01, 0x25,
+                0x0f, 0xae, 0x03, 0x9a, 0x0f, 0xc1, 0xf6, 0x15, 0x01, 0x59, 0x2f, 0x0f, 0xd1, 0x03, 0x58, 0x0f, 0x98, 0x00, 0x1a, 0x0f,
+                0xcf, 0x02, 0x97, 0x0f, 0x6f, 0x01, 0x25, 0x0f, 0x17, 0x04, 0x49, 0x0f, 0x6b, 0x01, 0xfc, 0x0f, 0x5d, 0x04, 0x53, 0x0f,
+                0x75, 0x01, 0x48, 0x0f, 0x80, 0x04, 0xb4, 0x02, 0x81, 0x27, 0x0f, 0x73, 0x04, 0x72, 0x0f, 0x52, 0x76, 0x01, 0x0f, 0xfb,
+                0x02, 0xa3, 0x0d, 0x55, 0x01, 0x0f, 0x59, 0x04, 0x63, 0x0f, 0x51, 0x01, 0xc8, 0x0f, 0x3f, 0x04, 0x6d, 0x0f, 0x5b, 0x01,
+                0x21, 0x0f, 0x32, 0x04, 0x9b, 0x4f, 0x31, 0x54, 0x65, 0x78, 0xe8, 0x13, 0x63, 0x0c, 0x7b, 0x00, 0x0f, 0xc1, 0x02, 0x98,
+                0x0f, 0x35, 0x01, 0x07, 0x0f, 0x02, 0x04, 0x4a, 0x0f, 0x31, 0x01, 0xc1, 0x0f, 0xe2, 0x03, 0x54, 0x0f, 0x3b, 0x01, 0x2a,
+                0x0f, 0xd2, 0x03, 0xa0, 0x0b, 0xca, 0x04, 0x0f, 0xd7, 0x03, 0x5e, 0x0b, 0x80, 0x00, 0x0f, 0xab, 0x02, 0x9d, 0x0f, 0x3f,
+                0x01, 0x07, 0x0f, 0xe1, 0x03, 0x4f, 0x0f, 0x3b, 0x01, 0xc6, 0x0f, 0xeb, 0x03, 0x59, 0x0f, 0x45, 0x01, 0x2a, 0x0f, 0xf0,
+                0x03, 0x9a, 0x2f, 0x53, 0x6d, 0xbf, 0x07, 0x63, 0x09, 0x78, 0x00, 0x0f, 0xa5, 0x02, 0x97, 0x0f, 0x2f, 0x01, 0x05, 0x0f,
+                0xd8, 0x03, 0x49, 0x0f, 0x2b, 0x01, 0xbc, 0x0f, 0xc8, 0x03, 0x53, 0x0f, 0x35, 0x01, 0x28, 0x0f, 0xc0, 0x03, 0x9c, 0x00,
+                0x58, 0x33, 0x04, 0xeb, 0x64, 0x0f, 0xc1, 0x03, 0x5a, 0x08, 0x79, 0x00, 0x0f, 0x97, 0x02, 0x99, 0x0f, 0x31, 0x01, 0x04,
+                0x0f, 0xc3, 0x03, 0x4b, 0x0f, 0x2d, 0x01, 0xbc, 0x0f, 0xc5, 0x03, 0x55, 0x0f, 0x37, 0x01, 0x27, 0x0f, 0xc6, 0x03, 0x9c,
+                0x02, 0xa9, 0x59, 0x06, 0xb0, 0x6c, 0x0f, 0xc9, 0x03, 0x59, 0x0b, 0x7c, 0x00, 0x0f, 0x9f, 0x02, 0x99, 0x0f, 0x37, 0x01,
+                0x07, 0x0f, 0xcf, 0x03, 0x4b, 0x0f, 0x33, 0x01, 0xc2, 0x0f, 0xd5, 0x03, 0x55, 0x0f, 0x3d, 0x01, 0x2a, 0x0f, 0xd8, 0x03,
+                0x9c, 0x04, 0xa6, 0x69, 0x02, 0x06, 0x6b, 0x0f, 0xd6, 0x03, 0x59, 0x09, 0x7a, 0x00, 0x0f, 0xa1, 0x02, 0x99, 0x0f, 0x33,
+                0x01, 0x05, 0x0f, 0xd2, 0x03, 0x4b, 0x0f, 0x2f, 0x01, 0xbe, 0x0f, 0xce, 0x03, 0x55, 0x0f, 0x39, 0x01, 0x28, 0x0f, 0xcc,
+                0x03, 0x9c, 0x00, 0x59, 0x5f, 0x02, 0xf3, 0x66, 0x01, 0xa3, 0x5f, 0x0f, 0x2f, 0x0f, 0x5b, 0x0c, 0x7d, 0x00, 0x0f, 0xa3,
+                0x02, 0x99, 0x0f, 0x39, 0x01, 0x08, 0x0f, 0xd5, 0x03, 0x4b, 0x0f, 0x35, 0x01, 0xc4, 0x0f, 0xdb, 0x03, 0x55, 0x0f, 0x3f,
+                0x01, 0x2b, 0x0f, 0xde, 0x03, 0x9a, 0x00, 0xeb, 0x00, 0x01, 0x7f, 0x63, 0x0f, 0xdb, 0x03, 0x5e, 0x0b, 0x7a, 0x00, 0x0f,
+                0xa3, 0x02, 0x97, 0x0f, 0x33, 0x01, 0x07, 0x0f, 0xd5, 0x03, 0x49, 0x0f, 0x2f, 0x01, 0xc0, 0x0f, 0xcf, 0x03, 0x53, 0x0f,
+                0x39, 0x01, 0x2a, 0x0f, 0xcc, 0x03, 0x9a, 0x05, 0x82, 0x61, 0x00, 0x64, 0x42, 0x01, 0xc9, 0xb6, 0x0f, 0xce, 0x03, 0x57,
+                0x0d, 0x7c, 0x00, 0x0f, 0xa1, 0x02, 0x97, 0x0f, 0x37, 0x01, 0x09, 0x0f, 0xd2, 0x03, 0x49, 0x0f, 0x33, 0x01, 0xc4, 0x0f,
+                0xd6, 0x03, 0x53, 0x0f, 0x3d, 0x01, 0x2c, 0x0f, 0xd8, 0x03, 0x9a, 0x02, 0xe6, 0x62, 0x0f, 0xd5, 0x03, 0x60, 0x0a, 0x79,
+                0x00, 0x0f, 0x9f, 0x02, 0x97, 0x0f, 0x31, 0x01, 0x06, 0x0f, 0xcf, 0x03, 0x49, 0x0f, 0x2d, 0x01, 0xbe, 0x0f, 0xc9, 0x03,
+                0x53, 0x0f, 0x37, 0x01, 0x29, 0x0f, 0xc6, 0x03, 0x9c, 0x04, 0x63, 0x5f, 0x0f, 0x60, 0x22, 0x61, 0x0f, 0x7e, 0x00, 0x00,
+                0x0f, 0xa3, 0x02, 0x99, 0x0f, 0x3b, 0x01, 0x09, 0x0f, 0xd5, 0x03, 0x4b, 0x0f, 0x37, 0x01, 0xc6, 0x0f, 0xdf, 0x03, 0x55,
+                0x0f, 0x41, 0x01, 0x2c, 0x0f, 0xca, 0x32, 0xc2, 0x0f, 0xc5, 0x32, 0x80, 0x0f, 0x55, 0x31, 0xbf, 0x0f, 0xbb, 0x32, 0x7c,
+                0x0f, 0x61, 0x01, 0xca, 0x0f, 0xb1, 0x32, 0x7b, 0x0f, 0x62, 0x04, 0xe2, 0x05, 0x4d, 0x5e, 0x0f, 0x5d, 0x04, 0x72, 0x0f,
+                0xdb, 0x5e, 0x04, 0x0f, 0xf7, 0x02, 0xa3, 0x0f, 0x5b, 0x01, 0x01, 0x0f, 0x53, 0x04, 0x63, 0x0f, 0x57, 0x01, 0xce, 0x0f,
+                0x49, 0x04, 0x6d, 0x0f, 0x61, 0x01, 0x24, 0x0f, 0x44, 0x04, 0x9a, 0x0d, 0xb7, 0xd0, 0x0f, 0x32, 0x04, 0x58, 0x0d, 0x7c,
+                0x00, 0x0f, 0xc9, 0x02, 0x97, 0x0f, 0x37, 0x01, 0x09, 0x0f, 0x0e, 0x04, 0x49, 0x0f, 0x33, 0x01, 0xc4, 0x0f, 0xea, 0x03,
+                0x53, 0x0f, 0x3d, 0x01, 0x2c, 0x08, 0xd8, 0x03, 0x09, 0x0c, 0x00, 0x00, 0xe2, 0x03, 0x00, 0x7b, 0x00, 0x56, 0x66, 0x6f,
+                0x6f, 0x74, 0x65, 0x8b, 0xcf, 0x01, 0xb4, 0xcd, 0x11, 0x3e, 0x97, 0x66, 0x03, 0x0b, 0xd0, 0x03, 0xc1, 0xc7, 0x50, 0x6c,
+                0x69, 0x63, 0x65, 0x6e, 0xb3, 0x87, 0x00, 0x39, 0x73, 0x80, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x6d, 0x61, 0x72, 0x5a, 0x98,
+                0x40, 0x2c, 0x20, 0x6e, 0x6f, 0x57, 0x9d, 0x70, 0x6d, 0x70, 0x61, 0x72, 0x69, 0x73, 0x6f, 0x09, 0xb6, 0x52, 0x74, 0x77,
+                0x65, 0x65, 0x6e, 0x7c, 0xc7, 0x55, 0x61, 0x72, 0x74, 0x73, 0x28, 0xcb, 0x5d, 0x00, 0x11, 0x90, 0xa0, 0x6d, 0x65, 0x2e,
+                0x68, 0x74, 0x6d, 0x6c, 0x23, 0x75, 0x6e, 0x7c, 0x73, 0x00, 0xad, 0x6e, 0x20, 0x5f, 0x75, 0x30, 0x57, 0x00, 0x33, 0xd0,
+                0x11, 0x6e, 0xfd, 0xc3, 0x02, 0x21, 0xc3, 0x0a, 0x7b, 0xd0, 0x07, 0xba, 0x00, 0x0a, 0xcd, 0xd0, 0x30, 0x67, 0x5f, 0x6a,
+                0x75, 0x00, 0x17, 0x3d, 0x9a, 0xd1, 0x40, 0x2f, 0x2a, 0x2a, 0x2a, 0xd6, 0xd5, 0xe3, 0x5f, 0x44, 0x41, 0x54, 0x41, 0x5f,
+                0x48, 0x45, 0x52, 0x45, 0x2a, 0x2a, 0x2a, 0x2f, 0x1f, 0x00, 0x15, 0x7d, 0x5a, 0xd2, 0x20, 0x67, 0x5f, 0x1b, 0x74, 0x23,
+                0x20, 0x3d, 0x43, 0x00, 0x12, 0x2e, 0x64, 0x5c, 0x11, 0x73, 0xfe, 0x9d, 0xa4, 0x45, 0x70, 0x6f, 0x63, 0x68, 0x20, 0x7c,
+                0x7c, 0x20, 0x30, 0xc0, 0xd1, 0x21, 0x67, 0x5f, 0x05, 0xc4, 0x00, 0x23, 0x58, 0x06, 0x33, 0x00, 0x06, 0x13, 0x00, 0x41,
+                0x7c, 0x7c, 0x20, 0x27, 0x34, 0xd0, 0x43, 0x4d, 0x61, 0x72, 0x6b, 0x0e, 0x5e, 0x16, 0x27, 0x3c, 0x00, 0x02, 0x3a, 0xca,
+                0x06, 0x39, 0x00, 0x03, 0x10, 0x00, 0x5c, 0x7c, 0x7c, 0x20, 0x7b, 0x7d, 0x26, 0x00, 0x45, 0x2e, 0x67, 0x70, 0x75, 0x67,
+                0x00, 0x0b, 0x13, 0x00, 0x00, 0x67, 0x00, 0x40, 0x55, 0x6e, 0x6b, 0x6e, 0xd9, 0x6f, 0x3d, 0x47, 0x50, 0x55, 0x62, 0x00,
+                0x5c, 0x2e, 0x63, 0x68, 0x69, 0x70, 0x3d, 0x00, 0x05, 0x14, 0x00, 0x08, 0x3e, 0x00, 0x4f, 0x43, 0x68, 0x69, 0x70, 0x3f,
+                0x00, 0x00, 0x00, 0x4c, 0x03, 0x30, 0x4c, 0x6f, 0x63, 0xd9, 0x01, 0x00, 0xea, 0x4c, 0x10, 0x75, 0x53, 0xd3, 0x0f, 0x1e,
+                0x00, 0x09, 0x07, 0x53, 0x00, 0x17, 0x27, 0x5a, 0x01, 0x07, 0xc7, 0xe1, 0x03, 0xf2, 0x00, 0x05, 0x12, 0x00, 0x0b, 0xf4,
+                0x00, 0x05, 0x38, 0xda, 0x05, 0x53, 0x01, 0x01, 0x10, 0x00, 0x0b, 0x26, 0x00, 0x0a, 0x44, 0xd8, 0x03, 0x2b, 0x00, 0x08,
+                0x15, 0x00, 0x03, 0x30, 0x00, 0x03, 0x31, 0x00, 0x21, 0x2f, 0x2f, 0xa7, 0x02, 0x01, 0xbb, 0x06, 0x47, 0x67, 0x69, 0x6e,
+                0x67, 0xe7, 0x00, 0x50, 0x62, 0x75, 0x67, 0x20, 0x3d, 0xe7, 0xd4, 0x03, 0x88, 0x01, 0x01, 0x10, 0x00, 0xf6, 0x06, 0x3d,
+                0x20, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x29, 0x20, 0x3f, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x3a,
+                0xac, 0x01, 0x36, 0x62, 0x75, 0x67, 0x8b, 0x00, 0x31, 0x70, 0x6f, 0x70, 0xaf, 0xa7, 0x51, 0x44, 0x75, 0x6d, 0x6d, 0x79,
+                0x8e, 0xc8, 0x00, 0x93, 0x00, 0x04, 0x51, 0x00, 0x0f, 0x1e, 0x00, 0x02, 0x0f, 0x5f, 0x00, 0x0a, 0x0f, 0x32, 0x00, 0x00,
+                0x06, 0x6d, 0x00, 0x05, 0x77, 0x06, 0x01, 0x30, 0xba, 0x01, 0x7d, 0xd5, 0x41, 0x20, 0x3d, 0x20, 0x6e, 0x00, 0xcc, 0x16,
+                0x74, 0x80, 0xd5, 0x04, 0x47, 0x01, 0x0f, 0x27, 0x00, 0x0e, 0x08, 0x5a, 0x04, 0x0f, 0x2c, 0x00, 0x09, 0x0b, 0x91, 0xd4,
+                0x02, 0x64, 0x04, 0x90, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a, 0x00,
+            };
+
+            static const CompressedReportDefinition reportDefinition(CompressedContents, sizeof(CompressedContents), 329792, 162, 274, 21);
+            return reportDefinition.GetReportDefinition();
+        }
+
+    } // namespace PerRangeReport
+
+    namespace SummaryReport {
+
+        inline ReportDefinition GetReportDefinition()
+        {
+            static const unsigned char CompressedContents[] = {
+                0xf0, 0x00, 0x66, 0x65, 0x5f, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x00, 0x0f, 0x00, 0xf1,
+                0x2c, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5f, 0x6f, 0x70, 0x73, 0x5f, 0x63, 0x6d, 0x64, 0x5f, 0x67, 0x6f, 0x5f, 0x69,
+                0x64, 0x6c, 0x65, 0x00, 0x67, 0x70, 0x75, 0x5f, 0x5f, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x64, 0x75, 0x72, 0x61, 0x74, 0x69,
+                0x6f, 0x6e, 0x00, 0x67, 0x72, 0x5f, 0x5f, 0x63, 0x79, 0x63, 0x6c, 0x65, 0x73, 0x5f, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65,
+                0x12, 0x00, 0x83, 0x64, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x53, 0x00, 0x70, 0x70, 0x64, 0x61, 0x5f, 0x5f, 0x69,
+                0x6e, 0x53, 0x00, 0xc0, 0x70, 0x72, 0x69, 0x6d, 0x73, 0x00, 0x70, 0x72, 0x6f, 0x70, 0x5f, 0x5f, 0x06, 0x00, 0x20, 0x32,
+                0x63, 0x0b, 0x00, 0xb0, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x73, 0x5f, 0x72, 0x65, 0x61, 0x6c, 0x5f, 0x00, 0x08, 0x20, 0x00,
+                0x1f, 0x7a, 0x20, 0x00, 0x01, 0x01, 0x35, 0x00, 0xf9, 0x01, 0x5f, 0x74, 0x68, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x70, 0x75,
+                0x74, 0x00, 0x64, 0x72, 0x61, 0x6d, 0x11, 0x00, 0x5a, 0x6c, 0x31, 0x74, 0x65, 0x78, 0x12, 0x00, 0x29, 0x74, 0x73, 0x10,
+                0x00, 0x4a, 0x70, 0x63, 0x69, 0x65, 0x11, 0x00, 0x00, 0xa6, 0x00, 0x08, 0x10, 0x00, 0x1b, 0x65, 0x31, 0x00, 0x0c, 0x75,
+                0x00, 0x69, 0x72, 0x61, 0x73, 0x74, 0x65, 0x72, 0x13, 0x00, 0x1a, 0x73, 0x86, 0x00, 0x3a, 0x76, 0x61, 0x66, 0x10, 0x00,
+                0x29, 0x70, 0x63, 0x10, 0x00, 0x01, 0xdd, 0x00, 0x08, 0x11, 0x00, 0xf6, 0x11, 0x0a, 0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x3e,
+                0x0a, 0x20, 0x20, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3d, 0x22, 0x75, 0x74,
+                0x66, 0x2d, 0x38, 0x22, 0x2f, 0x1a, 0x00, 0xf1, 0x17, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x76, 0x69, 0x65, 0x77, 0x70,
+                0x6f, 0x72, 0x74, 0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d,
+                0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2d, 0x0d, 0x00, 0xf0, 0x02, 0x2c, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c,
+                0x2d, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x3d, 0x31, 0x48, 0x00, 0x00, 0x49, 0x00, 0x40, 0x68, 0x65, 0x61, 0x64, 0x52, 0x00,
+                0xf2, 0x03, 0x20, 0x20, 0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x3c, 0x2f,
+                0x0f, 0x00, 0x00, 0x25, 0x00, 0xf0, 0x00, 0x20, 0x20, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x69, 0x64, 0x3d, 0x22,
+                0x52, 0x65, 0x6d, 0x00, 0x10, 0x53, 0x10, 0x00, 0x13, 0x22, 0x1e, 0x00, 0x93, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65,
+                0x20, 0x7b, 0x0e, 0x00, 0xf5, 0x03, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x31,
+                0x34, 0x70, 0x78, 0x3b, 0x19, 0x00, 0xe6, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x32, 0x20, 0x61, 0x75, 0x74,
+                0x6f, 0x18, 0x00, 0xf4, 0x02, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x63, 0x6f, 0x6c, 0x6c, 0x61, 0x70, 0x73, 0x65,
+                0x3a, 0x20, 0x0a, 0x00, 0x0c, 0x23, 0x00, 0xc4, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20,
+                0x1c, 0x00, 0x1a, 0x7d, 0x87, 0x00, 0x27, 0x74, 0x68, 0x8a, 0x00, 0x04, 0x71, 0x00, 0x1f, 0x30, 0x71, 0x00, 0x39, 0xf0,
+                0x02, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x23, 0x46, 0x38, 0x02, 0x00,
+                0x0f, 0x8e, 0x00, 0x05, 0x1f, 0x64, 0x8e, 0x00, 0x4d, 0x0c, 0x71, 0x00, 0x7f, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x74, 0x72,
+                0x7a, 0x00, 0x59, 0x11, 0x2e, 0x7b, 0x00, 0x00, 0x90, 0x02, 0x07, 0x73, 0x00, 0xff, 0x01, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+                0x3a, 0x20, 0x44, 0x61, 0x72, 0x6b, 0x47, 0x72, 0x65, 0x65, 0x6e, 0x75, 0x00, 0x01, 0x00, 0x21, 0x00, 0x5f, 0x42, 0x6c,
+                0x61, 0x63, 0x6b, 0x5b, 0x01, 0x12, 0x03, 0x59, 0x02, 0xce, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x62, 0x6f,
+                0x6c, 0x64, 0x8b, 0x00, 0x67, 0x73, 0x75, 0x62, 0x68, 0x64, 0x72, 0x88, 0x00, 0x0f, 0xac, 0x01, 0x11, 0x37, 0x2e, 0x63,
+                0x61, 0x32, 0x00, 0xfe, 0x03, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x20, 0x63, 0x65, 0x6e,
+                0x74, 0x65, 0x72, 0x31, 0x00, 0x1f, 0x6c, 0x31, 0x00, 0x05, 0x4e, 0x6c, 0x65, 0x66, 0x74, 0x2f, 0x00, 0x1f, 0x72, 0x2f,
+                0x00, 0x05, 0x10, 0x72, 0xcc, 0x00, 0x0e, 0x30, 0x00, 0x27, 0x77, 0x77, 0x30, 0x00, 0xf0, 0x02, 0x77, 0x6f, 0x72, 0x64,
+                0x2d, 0x77, 0x72, 0x61, 0x70, 0x3a, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x2d, 0x11, 0x00, 0x0e, 0x34, 0x00, 0x5b, 0x66,
+                0x75, 0x6c, 0x6c, 0x5f, 0x85, 0x01, 0x32, 0x6d, 0x69, 0x6e, 0x02, 0x04, 0x58, 0x3a, 0x20, 0x31, 0x35, 0x30, 0x8b, 0x03,
+                0x03, 0x16, 0x00, 0x48, 0x33, 0x33, 0x76, 0x77, 0xa0, 0x03, 0x14, 0x78, 0x2f, 0x00, 0xfe, 0x03, 0x63, 0x61, 0x6c, 0x63,
+                0x28, 0x39, 0x32, 0x76, 0x77, 0x20, 0x2d, 0x20, 0x39, 0x32, 0x30, 0x70, 0x78, 0x29, 0x72, 0x00, 0x3f, 0x62, 0x61, 0x73,
+                0xf7, 0x03, 0x04, 0x18, 0x38, 0x6b, 0x00, 0x03, 0xe9, 0x01, 0x30, 0x23, 0x36, 0x30, 0x02, 0x00, 0x0f, 0x08, 0x02, 0x12,
+                0x07, 0x9a, 0x01, 0x3f, 0x6f, 0x6d, 0x70, 0x64, 0x00, 0x17, 0x8d, 0x73, 0x74, 0x65, 0x65, 0x6c, 0x62, 0x6c, 0x75, 0xc0,
+                0x02, 0x0f, 0x66, 0x00, 0x0c, 0xab, 0x6e, 0x6f, 0x74, 0x5f, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0xcb, 0x04, 0x04, 0xbc,
+                0x00, 0x11, 0x43, 0x01, 0x00, 0x0f, 0x39, 0x00, 0x04, 0x4f, 0x76, 0x61, 0x69, 0x6c, 0x38, 0x00, 0x04, 0x11, 0x38, 0x01,
+                0x00, 0x0f, 0x32, 0x03, 0x00, 0x00, 0x5f, 0x05, 0x38, 0x61, 0x72, 0x65, 0x18, 0x02, 0x00, 0x34, 0x07, 0x87, 0x6c, 0x61,
+                0x79, 0x3a, 0x20, 0x66, 0x6c, 0x65, 0xdb, 0x00, 0x01, 0x2a, 0x02, 0x6c, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x90, 0x02,
+                0x05, 0x68, 0x00, 0x47, 0x77, 0x68, 0x69, 0x74, 0xf4, 0x00, 0x01, 0x26, 0x01, 0xff, 0x00, 0x66, 0x61, 0x6d, 0x69, 0x6c,
+                0x79, 0x3a, 0x20, 0x76, 0x65, 0x72, 0x64, 0x61, 0x6e, 0x61, 0x84, 0x00, 0x04, 0x28, 0x62, 0x61, 0x2d, 0x03, 0x02, 0x28,
+                0x04, 0x10, 0x2d, 0xc5, 0x02, 0x27, 0x3a, 0x20, 0xab, 0x01, 0x03, 0x18, 0x00, 0x01, 0xae, 0x02, 0x19, 0x3a, 0x44, 0x04,
+                0x06, 0x4f, 0x00, 0xff, 0x00, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73,
+                0x56, 0x00, 0x05, 0x0a, 0x81, 0x04, 0x0a, 0x59, 0x00, 0x05, 0x72, 0x00, 0x0b, 0xa5, 0x00, 0x0f, 0x01, 0x02, 0x03, 0x19,
+                0x32, 0x02, 0x02, 0x09, 0x65, 0x00, 0x17, 0x31, 0xec, 0x02, 0x07, 0x1c, 0x04, 0x20, 0x65, 0x63, 0xb3, 0x08, 0x08, 0x1d,
+                0x04, 0x02, 0x1d, 0x02, 0x60, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x24, 0x03, 0x08, 0x52, 0x00, 0x7a, 0x70, 0x61, 0x64,
+                0x64, 0x69, 0x6e, 0x67, 0x4e, 0x00, 0x0c, 0x51, 0x04, 0x01, 0x01, 0x00, 0x0e, 0xe2, 0x06, 0x0a, 0x33, 0x00, 0x07, 0x87,
+                0x03, 0x01, 0x58, 0x03, 0x88, 0x31, 0x30, 0x30, 0x25, 0x20, 0x2d, 0x20, 0x34, 0x57, 0x03, 0x05, 0x93, 0x03, 0x00, 0x85,
+                0x03, 0x03, 0xcc, 0x07, 0x0f, 0xc3, 0x00, 0x06, 0x1f, 0x5f, 0x17, 0x01, 0x02, 0x0f, 0xf2, 0x01, 0x04, 0x0f, 0x38, 0x05,
+                0x08, 0x05, 0x41, 0x02, 0x1f, 0x62, 0x18, 0x03, 0x03, 0x79, 0x77, 0x6f, 0x72, 0x6b, 0x66, 0x6c, 0x6f, 0x8e, 0x04, 0x02,
+                0xa6, 0x00, 0x2a, 0x39, 0x36, 0xe2, 0x00, 0x06, 0x3a, 0x04, 0x26, 0x39, 0x30, 0x53, 0x04, 0x06, 0x4a, 0x00, 0x6f, 0x64,
+                0x65, 0x62, 0x75, 0x67, 0x5f, 0x82, 0x01, 0x40, 0x11, 0x44, 0x01, 0x00, 0x0f, 0x82, 0x01, 0x56, 0x68, 0x23, 0x66, 0x6f,
+                0x6f, 0x74, 0x65, 0x34, 0x03, 0x40, 0x70, 0x6f, 0x73, 0x69, 0xd5, 0x00, 0x67, 0x3a, 0x20, 0x66, 0x69, 0x78, 0x65, 0x5b,
+                0x01, 0x0d, 0x46, 0x03, 0x69, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x13, 0x00, 0x04, 0x9d, 0x05, 0x3f, 0x30, 0x30, 0x25,
+                0xe0, 0x00, 0x03, 0xa6, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x32, 0x35, 0x2c, 0x20, 0x05, 0x00, 0x37, 0x30, 0x2e, 0x35,
+                0xb5, 0x00, 0x03, 0xc2, 0x01, 0x58, 0x64, 0x61, 0x72, 0x6b, 0x72, 0x7f, 0x00, 0x0f, 0xc7, 0x06, 0x07, 0x33, 0x20, 0x20,
+                0x68, 0x0c, 0x02, 0x00, 0xd9, 0x05, 0x07, 0xb1, 0x00, 0x4f, 0x69, 0x6e, 0x65, 0x2d, 0x1b, 0x00, 0x03, 0x09, 0x42, 0x02,
+                0x2c, 0x37, 0x30, 0xa9, 0x03, 0x21, 0x3c, 0x2f, 0x23, 0x0a, 0x24, 0x3e, 0x0a, 0x31, 0x0a, 0xc0, 0x63, 0x72, 0x69, 0x70,
+                0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x89, 0x00, 0x61, 0x2f, 0x4a, 0x61, 0x76, 0x61, 0x53, 0x16, 0x00, 0x06,
+                0x38, 0x0a, 0xaf, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x20, 0x4e, 0x6f, 0x74, 0x41, 0x7b, 0x05, 0x01, 0x97, 0x76, 0x61, 0x6c,
+                0x75, 0x65, 0x4f, 0x66, 0x28, 0x29, 0x14, 0x00, 0xf8, 0x01, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x75,
+                0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0xf0, 0x00, 0x16, 0x7d, 0xfa, 0x00, 0x7f, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67,
+                0x3b, 0x00, 0x03, 0x19, 0x27, 0x71, 0x00, 0x1e, 0x27, 0x41, 0x00, 0x04, 0x08, 0x00, 0x06, 0x9f, 0x00, 0x0f, 0xe1, 0x05,
+                0x00, 0x0f, 0x9e, 0x00, 0x4a, 0x04, 0x70, 0x00, 0x0f, 0x9d, 0x00, 0x02, 0x03, 0x09, 0x00, 0x32, 0x66, 0x75, 0x6e, 0x4c,
+                0x03, 0x00, 0x10, 0x0d, 0x10, 0x54, 0x54, 0x00, 0xf8, 0x03, 0x28, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x73, 0x53, 0x69,
+                0x6e, 0x63, 0x65, 0x45, 0x70, 0x6f, 0x63, 0x68, 0x62, 0x00, 0xfe, 0x04, 0x76, 0x61, 0x72, 0x20, 0x64, 0x61, 0x74, 0x65,
+                0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x44, 0x61, 0x74, 0x65, 0x31, 0x00, 0x20, 0x20, 0x2a, 0x8b, 0x02, 0x60, 0x30,
+                0x29, 0x3b, 0x20, 0x2f, 0x2f, 0x51, 0x0c, 0xd3, 0x76, 0x65, 0x72, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x6d, 0x69, 0x6c, 0x6c,
+                0x69, 0x2e, 0x00, 0x09, 0x52, 0x00, 0x61, 0x79, 0x65, 0x61, 0x72, 0x20, 0x3d, 0x59, 0x00, 0xd7, 0x2e, 0x67, 0x65, 0x74,
+                0x46, 0x75, 0x6c, 0x6c, 0x59, 0x65, 0x61, 0x72, 0x28, 0xa0, 0x02, 0x00, 0x27, 0x00, 0xf0, 0x06, 0x4d, 0x6f, 0x6e, 0x74,
+                0x68, 0x73, 0x20, 0x3d, 0x20, 0x5b, 0x27, 0x4a, 0x61, 0x6e, 0x27, 0x2c, 0x20, 0x27, 0x46, 0x65, 0x62, 0x07, 0x00, 0x30,
+                0x4d, 0x61, 0x72, 0x07, 0x00, 0x21, 0x41, 0x70, 0x07, 0x00, 0x30, 0x4d, 0x61, 0x79, 0x07, 0x00, 0x21, 0x4a, 0x75, 0x23,
+                0x00, 0x31, 0x4a, 0x75, 0x6c, 0x1c, 0x00, 0x20, 0x75, 0x67, 0x07, 0x00, 0x30, 0x53, 0x65, 0x70, 0x07, 0x00, 0x30, 0x4f,
+                0x63, 0x74, 0x07, 0x00, 0x30, 0x4e, 0x6f, 0x76, 0x07, 0x00, 0x5a, 0x44, 0x65, 0x63, 0x27, 0x5d, 0x6b, 0x00, 0x10, 0x6d,
+                0x6b, 0x00, 0x23, 0x20, 0x3d, 0x73, 0x00, 0x14, 0x5b, 0x9a, 0x00, 0x01, 0x0f, 0x00, 0x2b, 0x28, 0x29, 0x2d, 0x00, 0x37,
+                0x64, 0x61, 0x79, 0xbe, 0x00, 0x01, 0x14, 0x01, 0x0b, 0xba, 0x00, 0x40, 0x68, 0x6f, 0x75, 0x72, 0xb9, 0x00, 0x04, 0x24,
+                0x00, 0x10, 0x48, 0x10, 0x00, 0x0c, 0x25, 0x00, 0x60, 0x6d, 0x69, 0x6e, 0x75, 0x74, 0x65, 0x27, 0x00, 0x55, 0x22, 0x30,
+                0x22, 0x20, 0x2b, 0x2d, 0x00, 0x12, 0x4d, 0x18, 0x00, 0x0c, 0x2f, 0x00, 0x03, 0x49, 0x01, 0x0d, 0x2f, 0x00, 0x12, 0x53,
+                0x18, 0x00, 0x0c, 0x2f, 0x00, 0xc0, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x74, 0x65, 0x64, 0x54, 0x69, 0x6d, 0xbf, 0x01,
+                0x02, 0xe2, 0x00, 0x51, 0x2b, 0x20, 0x27, 0x20, 0x27, 0x3d, 0x00, 0x10, 0x79, 0x0c, 0x00, 0x11, 0x2c, 0x0d, 0x00, 0x01,
+                0x8f, 0x01, 0x04, 0x1a, 0x00, 0x02, 0xbb, 0x00, 0x40, 0x2b, 0x20, 0x27, 0x3a, 0x0e, 0x00, 0x03, 0xa4, 0x00, 0x00, 0x21,
+                0x0b, 0x75, 0x73, 0x74, 0x72, 0x28, 0x2d, 0x32, 0x29, 0x1b, 0x00, 0x03, 0x90, 0x00, 0x07, 0x1b, 0x00, 0x06, 0x81, 0x00,
+                0x03, 0x97, 0x02, 0x09, 0x84, 0x00, 0x0d, 0x15, 0x05, 0x05, 0x8c, 0x02, 0xb1, 0x65, 0x73, 0x63, 0x61, 0x70, 0x65, 0x48,
+                0x74, 0x6d, 0x6c, 0x28, 0xee, 0x0f, 0x08, 0x81, 0x02, 0x40, 0x69, 0x66, 0x20, 0x28, 0x11, 0x04, 0x31, 0x6f, 0x66, 0x20,
+                0x1c, 0x00, 0x61, 0x20, 0x3d, 0x3d, 0x20, 0x27, 0x73, 0x0b, 0x03, 0x43, 0x27, 0x20, 0x7c, 0x7c, 0x15, 0x00, 0x70, 0x69,
+                0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x26, 0x00, 0x02, 0x27, 0x03, 0x0f, 0x26, 0x03, 0x02, 0x01, 0x2c, 0x00, 0x07, 0x17,
+                0x00, 0x00, 0x63, 0x0b, 0xf0, 0x06, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x28, 0x2f, 0x26, 0x2f, 0x67, 0x2c, 0x20, 0x22,
+                0x26, 0x61, 0x6d, 0x70, 0x3b, 0x22, 0x29, 0xc8, 0x02, 0xcf, 0x6d, 0x61, 0x6b, 0x65, 0x20, 0x69, 0x74, 0x20, 0x66, 0x69,
+                0x72, 0x73, 0x35, 0x00, 0x05, 0x12, 0x20, 0x35, 0x00, 0x30, 0x6e, 0x62, 0x73, 0x36, 0x00, 0x0f, 0x25, 0x00, 0x04, 0x12,
+                0x3c, 0x25, 0x00, 0x2f, 0x6c, 0x74, 0x23, 0x00, 0x07, 0x12, 0x3e, 0x23, 0x00, 0x1f, 0x67, 0x23, 0x00, 0x08, 0x12, 0x22,
+                0x23, 0x00, 0x3f, 0x71, 0x75, 0x6f, 0x25, 0x00, 0x08, 0x13, 0x27, 0xc5, 0x00, 0x57, 0x70, 0x6f, 0x73, 0x3b, 0x22, 0x8f,
+                0x01, 0x06, 0x47, 0x04, 0x08, 0x0a, 0x01, 0x0f, 0x91, 0x01, 0x07, 0xf0, 0x03, 0x73, 0x61, 0x66, 0x65, 0x44, 0x69, 0x76,
+                0x28, 0x64, 0x69, 0x76, 0x69, 0x64, 0x65, 0x6e, 0x64, 0x2c, 0x20, 0x0a, 0x00, 0x3c, 0x73, 0x6f, 0x72, 0x9a, 0x01, 0x04,
+                0x21, 0x00, 0x00, 0x96, 0x01, 0x44, 0x30, 0x20, 0x26, 0x26, 0x28, 0x00, 0x01, 0x10, 0x00, 0x0f, 0x84, 0x01, 0x02, 0x07,
+                0xc6, 0x06, 0x0d, 0x96, 0x00, 0x05, 0x4e, 0x00, 0x14, 0x2f, 0x48, 0x00, 0x0d, 0xa3, 0x00, 0xd0, 0x2f, 0x2f, 0x20, 0x4e,
+                0x61, 0x4e, 0x20, 0x3c, 0x20, 0x2d, 0x49, 0x6e, 0x66, 0x9f, 0x10, 0x47, 0x79, 0x20, 0x3c, 0x20, 0x0b, 0x00, 0x01, 0x09,
+                0x00, 0x84, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x75, 0x04, 0x05, 0xd8, 0x00, 0x00, 0x17, 0x0c, 0x42, 0x61,
+                0x72, 0x65, 0x4e, 0x1e, 0x00, 0x9c, 0x28, 0x6c, 0x68, 0x73, 0x2c, 0x20, 0x72, 0x68, 0x73, 0xd6, 0x00, 0x31, 0x69, 0x73,
+                0x46, 0x47, 0x00, 0x00, 0x21, 0x00, 0x10, 0x29, 0xd6, 0x00, 0x05, 0x11, 0x00, 0x00, 0x2d, 0x00, 0x0f, 0xd7, 0x00, 0x02,
+                0x50, 0x6c, 0x68, 0x73, 0x20, 0x2d, 0x4c, 0x00, 0x07, 0xdf, 0x00, 0x5e, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x51, 0x00, 0x0f,
+                0x40, 0x00, 0x02, 0x1f, 0x31, 0x38, 0x00, 0x0b, 0x0f, 0x78, 0x00, 0x06, 0x1e, 0x2d, 0x39, 0x00, 0x08, 0x26, 0x00, 0x02,
+                0x45, 0x00, 0x37, 0x4e, 0x61, 0x4e, 0xcb, 0x00, 0x00, 0x0e, 0x00, 0x0e, 0x50, 0x00, 0x0f, 0xa1, 0x01, 0x01, 0x0b, 0x8c,
+                0x00, 0x04, 0x47, 0x00, 0x0f, 0x39, 0x00, 0x04, 0x08, 0x8b, 0x00, 0x0f, 0x3a, 0x00, 0x00, 0x0f, 0x73, 0x00, 0x08, 0x0f,
+                0x39, 0x00, 0x01, 0x0f, 0x29, 0x00, 0x02, 0x00, 0x7f, 0x00, 0x00, 0x5b, 0x02, 0x01, 0xb4, 0x01, 0x71, 0x3f, 0x20, 0x30,
+                0x20, 0x3a, 0x20, 0x28, 0x14, 0x00, 0x14, 0x3e, 0x13, 0x00, 0x67, 0x31, 0x20, 0x3a, 0x20, 0x2d, 0x31, 0xfb, 0x02, 0x08,
+                0x67, 0x02, 0x0f, 0x0e, 0x07, 0x07, 0x40, 0x67, 0x65, 0x74, 0x43, 0x73, 0x14, 0x30, 0x65, 0x72, 0x56, 0xa2, 0x07, 0x10,
+                0x28, 0xa4, 0x0e, 0xbc, 0x2c, 0x20, 0x73, 0x75, 0x62, 0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 0x21, 0x02, 0x01, 0xc3, 0x0e,
+                0x07, 0x74, 0x04, 0x0a, 0x8d, 0x08, 0x3f, 0x7c, 0x7c, 0x20, 0x21, 0x00, 0x01, 0x04, 0x9f, 0x07, 0x0f, 0xc8, 0x01, 0x02,
+                0x00, 0x31, 0x00, 0x0f, 0x1a, 0x03, 0x01, 0xe4, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x61, 0x73, 0x73, 0x65,
+                0x72, 0x74, 0x0a, 0x05, 0x01, 0x5f, 0x00, 0x0b, 0x09, 0x05, 0x0c, 0x73, 0x00, 0x03, 0x08, 0x05, 0x08, 0xf2, 0x09, 0x0f,
+                0x4b, 0x00, 0x01, 0x05, 0xe4, 0x00, 0x0c, 0x50, 0x00, 0x06, 0x19, 0x00, 0x0f, 0x55, 0x00, 0x01, 0x09, 0x0f, 0x01, 0x21,
+                0x67, 0x5f, 0xa8, 0x0b, 0x0a, 0xd9, 0x00, 0x12, 0x67, 0xc5, 0x15, 0x20, 0x65, 0x72, 0x80, 0x15, 0xc1, 0x66, 0x65, 0x72,
+                0x65, 0x6e, 0x63, 0x65, 0x64, 0x2e, 0x61, 0x64, 0x64, 0x3e, 0x01, 0x09, 0x9d, 0x04, 0x07, 0xa3, 0x00, 0x01, 0x32, 0x00,
+                0x27, 0x20, 0x3d, 0x3e, 0x00, 0x10, 0x5b, 0x2f, 0x00, 0x07, 0x81, 0x07, 0x00, 0x71, 0x00, 0x05, 0x28, 0x00, 0x26, 0x3d,
+                0x3d, 0x36, 0x09, 0x0a, 0x7f, 0x00, 0x06, 0x4b, 0x00, 0x28, 0x7b, 0x7d, 0x0e, 0x02, 0x0c, 0x59, 0x00, 0x24, 0x20, 0x3d,
+                0x2b, 0x00, 0x0f, 0x7f, 0x01, 0x01, 0x01, 0xb0, 0x09, 0x06, 0x23, 0x00, 0x15, 0x5b, 0x15, 0x01, 0x0b, 0x91, 0x00, 0x03,
+                0x28, 0x00, 0x0f, 0x8f, 0x00, 0x07, 0x02, 0x27, 0x01, 0xd1, 0x70, 0x6f, 0x70, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x44, 0x75,
+                0x6d, 0x6d, 0x79, 0x6a, 0x02, 0x09, 0x7c, 0x04, 0x08, 0x72, 0x00, 0xd2, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x72, 0x61, 0x6e,
+                0x64, 0x6f, 0x6d, 0x28, 0x29, 0x61, 0x09, 0x0f, 0x26, 0x03, 0x0e, 0x04, 0x3c, 0x00, 0x3f, 0x4e, 0x61, 0x4e, 0x01, 0x03,
+                0x03, 0x05, 0x17, 0x01, 0x07, 0xc9, 0x00, 0x22, 0x20, 0x3d, 0x38, 0x00, 0x0f, 0x98, 0x05, 0x08, 0x09, 0x20, 0x00, 0x0f,
+                0x3d, 0x03, 0x09, 0x32, 0x50, 0x63, 0x74, 0xde, 0x01, 0x0f, 0x30, 0x03, 0x66, 0x03, 0x1f, 0x00, 0x0f, 0xd0, 0x03, 0x03,
+                0xf0, 0x07, 0x27, 0x61, 0x76, 0x67, 0x2e, 0x70, 0x63, 0x74, 0x5f, 0x6f, 0x66, 0x5f, 0x70, 0x65, 0x61, 0x6b, 0x5f, 0x73,
+                0x75, 0x73, 0x74, 0x61, 0xad, 0x01, 0x21, 0x5f, 0x65, 0xc0, 0x14, 0x2e, 0x64, 0x27, 0xb0, 0x12, 0x0f, 0xe7, 0x00, 0x03,
+                0x00, 0x39, 0x0b, 0x0f, 0xea, 0x00, 0x3e, 0x00, 0x20, 0x00, 0x1c, 0x21, 0x56, 0x00, 0x06, 0xe4, 0x0b, 0x0f, 0xd8, 0x0b,
+                0x00, 0x09, 0x10, 0x01, 0x00, 0x9a, 0x09, 0x1f, 0x2e, 0xe3, 0x00, 0x0f, 0x0f, 0xe2, 0x00, 0x11, 0x8f, 0x44, 0x69, 0x6d,
+                0x55, 0x6e, 0x69, 0x74, 0x73, 0xce, 0x01, 0x6c, 0x0f, 0xfe, 0x04, 0x30, 0x0f, 0xa9, 0x04, 0xd4, 0x50, 0x64, 0x69, 0x6d,
+                0x5f, 0x75, 0xb2, 0x01, 0x07, 0xad, 0x04, 0x15, 0x27, 0x15, 0x00, 0x08, 0xee, 0x0c, 0x02, 0xb7, 0x09, 0x05, 0x2e, 0x00,
+                0x0f, 0x99, 0x00, 0x07, 0x08, 0x53, 0x00, 0x08, 0x7c, 0x02, 0x06, 0x45, 0x04, 0x08, 0x61, 0x00, 0x00, 0xed, 0x0c, 0x04,
+                0x0e, 0x00, 0x0f, 0xe3, 0x09, 0x0a, 0x0b, 0x24, 0x00, 0x0f, 0x86, 0x02, 0x02, 0x10, 0x52, 0x25, 0x1c, 0x0f, 0x8a, 0x07,
+                0x7c, 0x00, 0x6e, 0x00, 0x0f, 0x9d, 0x03, 0x07, 0x09, 0x73, 0x05, 0x0f, 0xbf, 0x07, 0xb3, 0x01, 0xaa, 0x1d, 0x0f, 0x14,
+                0x03, 0x18, 0x01, 0x30, 0x00, 0x01, 0x12, 0x03, 0x02, 0x3a, 0x00, 0x0f, 0x10, 0x03, 0x01, 0x03, 0x24, 0x00, 0x0f, 0x75,
+                0x02, 0x07, 0x04, 0x45, 0x00, 0x0c, 0x0c, 0x03, 0x08, 0x53, 0x00, 0x22, 0x20, 0x3d, 0x27, 0x00, 0x0f, 0xb1, 0x07, 0x09,
+                0x01, 0x21, 0x00, 0x0f, 0xaf, 0x07, 0xaf, 0x0c, 0xc7, 0x00, 0x0f, 0xad, 0x07, 0x32, 0x01, 0x5e, 0x03, 0x0f, 0xab, 0x07,
+                0x79, 0x0d, 0xef, 0x03, 0x4f, 0x27, 0x70, 0x63, 0x74, 0x8b, 0x07, 0x00, 0x0f, 0xc6, 0x00, 0x02, 0x0f, 0x8a, 0x07, 0x86,
+                0x00, 0xc4, 0x00, 0x0f, 0x88, 0x01, 0x0a, 0x15, 0x54, 0xc0, 0x1f, 0x0f, 0xeb, 0x04, 0xff, 0x6e, 0x06, 0x4a, 0x21, 0x0f,
+                0xf0, 0x04, 0x18, 0x06, 0x35, 0x00, 0x01, 0xf5, 0x04, 0x07, 0x44, 0x00, 0x0f, 0xfa, 0x04, 0x01, 0x08, 0x2e, 0x00, 0x0f,
+                0x78, 0x04, 0x07, 0x09, 0x54, 0x00, 0x0c, 0x04, 0x05, 0x0d, 0x62, 0x00, 0x27, 0x20, 0x3d, 0x31, 0x00, 0x0f, 0x0e, 0x05,
+                0x09, 0x06, 0x26, 0x00, 0x0f, 0x13, 0x05, 0xaf, 0x0f, 0xcc, 0x00, 0x02, 0x0f, 0x18, 0x05, 0x32, 0x06, 0x90, 0x03, 0x0f,
+                0x1d, 0x05, 0x79, 0x0f, 0x26, 0x04, 0x03, 0x0f, 0xcb, 0x0c, 0x2e, 0x09, 0xed, 0x00, 0x0f, 0xce, 0x0c, 0xc2, 0xfa, 0x01,
+                0x74, 0x6f, 0x42, 0x61, 0x72, 0x43, 0x68, 0x61, 0x72, 0x74, 0x28, 0x70, 0x63, 0x74, 0x2c, 0x20, 0xd9, 0x18, 0x00, 0xdf,
+                0x00, 0x29, 0x70, 0x63, 0x3a, 0x16, 0x0d, 0xde, 0x00, 0x0f, 0x20, 0x00, 0x00, 0x0f, 0xcd, 0x01, 0x0a, 0x0f, 0xd4, 0x00,
+                0x03, 0x00, 0xce, 0x04, 0x10, 0x74, 0x17, 0x1a, 0x60, 0x6d, 0x70, 0x65, 0x64, 0x50, 0x63, 0xda, 0x03, 0x01, 0x1b, 0x03,
+                0x42, 0x6d, 0x69, 0x6e, 0x28, 0x09, 0x00, 0x22, 0x61, 0x78, 0xa2, 0x00, 0x30, 0x30, 0x29, 0x2c, 0x26, 0x03, 0x03, 0x48,
+                0x19, 0x00, 0x31, 0x00, 0x00, 0x46, 0x19, 0x5b, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x4e, 0x00, 0x01, 0x01, 0x1c, 0x47, 0x20,
+                0x3d, 0x20, 0x32, 0x53, 0x03, 0x02, 0x1a, 0x00, 0x34, 0x62, 0x61, 0x72, 0x1d, 0x00, 0x01, 0x5d, 0x00, 0x67, 0x63, 0x65,
+                0x69, 0x6c, 0x28, 0x28, 0x7e, 0x00, 0x11, 0x2f, 0x63, 0x00, 0x22, 0x20, 0x2a, 0x44, 0x00, 0x07, 0xdb, 0x04, 0x00, 0xd4,
+                0x1f, 0x0a, 0xea, 0x0b, 0xf0, 0x01, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x6c, 0x65, 0x74, 0x20, 0x69, 0x69, 0x20, 0x3d, 0x20,
+                0x31, 0x3b, 0x08, 0x00, 0x25, 0x3c, 0x3d, 0x63, 0x00, 0x00, 0x10, 0x00, 0x2a, 0x2b, 0x2b, 0x0a, 0x01, 0x00, 0x45, 0x00,
+                0x5f, 0x2b, 0x3d, 0x20, 0x63, 0x68, 0xde, 0x01, 0x0a, 0x0e, 0xd8, 0x15, 0x05, 0xb6, 0x01, 0x01, 0xc1, 0x1c, 0xf8, 0x02,
+                0x55, 0x70, 0x28, 0x6e, 0x75, 0x6d, 0x2c, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x65, 0x00, 0x05,
+                0x15, 0x00, 0x04, 0xe3, 0x00, 0x68, 0x70, 0x6f, 0x77, 0x28, 0x31, 0x30, 0x2e, 0x00, 0x0d, 0x89, 0x18, 0x06, 0x0b, 0x01,
+                0x58, 0x6e, 0x75, 0x6d, 0x20, 0x2a, 0x59, 0x00, 0x16, 0x2f, 0x0d, 0x00, 0x0f, 0x96, 0x00, 0x07, 0x02, 0xc9, 0x18, 0x33,
+                0x5f, 0x70, 0x63, 0x4c, 0x02, 0x05, 0x33, 0x00, 0x2f, 0x3d, 0x31, 0x55, 0x02, 0x4d, 0x2f, 0x70, 0x63, 0xdb, 0x05, 0x02,
+                0x06, 0x59, 0x15, 0x3f, 0x70, 0x63, 0x74, 0x1c, 0x16, 0x03, 0x4f, 0x27, 0xe2, 0x9a, 0xa0, 0x92, 0x02, 0x02, 0x01, 0xe0,
+                0x07, 0x05, 0x5c, 0x16, 0x0f, 0x40, 0x00, 0x06, 0x02, 0x9e, 0x02, 0x41, 0x73, 0x69, 0x67, 0x6e, 0x24, 0x00, 0x00, 0x77,
+                0x07, 0x10, 0x31, 0x64, 0x15, 0xa0, 0x27, 0xe2, 0x88, 0x9e, 0x27, 0x20, 0x3a, 0x20, 0x27, 0x2d, 0x09, 0x00, 0x0f, 0xe9,
+                0x01, 0x08, 0x04, 0xcc, 0x01, 0x0a, 0x33, 0x01, 0x60, 0x29, 0x2e, 0x74, 0x6f, 0x4c, 0x6f, 0x52, 0x28, 0x03, 0xd2, 0x1c,
+                0x05, 0x71, 0x06, 0x30, 0x2c, 0x20, 0x7b, 0x71, 0x1a, 0x60, 0x69, 0x6d, 0x75, 0x6d, 0x46, 0x72, 0x17, 0x2a, 0x96, 0x6f,
+                0x6e, 0x44, 0x69, 0x67, 0x69, 0x74, 0x73, 0x3a, 0x3e, 0x00, 0x10, 0x2c, 0x68, 0x1f, 0x0f, 0x22, 0x00, 0x0a, 0x2f, 0x20,
+                0x7d, 0xfa, 0x04, 0x08, 0x03, 0xc9, 0x01, 0x7f, 0x61, 0x76, 0x67, 0x28, 0x61, 0x76, 0x67, 0xc9, 0x01, 0x0a, 0x3f, 0x61,
+                0x76, 0x67, 0xc9, 0x01, 0x0a, 0x0f, 0x20, 0x00, 0x00, 0x0f, 0xc9, 0x01, 0x0a, 0x3f, 0x61, 0x76, 0x67, 0xc9, 0x01, 0x0b,
+                0x3f, 0x61, 0x76, 0x67, 0xc9, 0x01, 0x2a, 0x0f, 0x40, 0x00, 0x06, 0x07, 0xc9, 0x01, 0x00, 0x24, 0x00, 0x0f, 0xc9, 0x01,
+                0x1f, 0x00, 0x87, 0x05, 0x0f, 0xb5, 0x01, 0x6f, 0x59, 0x73, 0x75, 0x6d, 0x28, 0x73, 0x17, 0x04, 0x0e, 0xb5, 0x01, 0x3f,
+                0x73, 0x75, 0x6d, 0xb5, 0x01, 0x0a, 0x0f, 0x20, 0x00, 0x00, 0x0f, 0xb5, 0x01, 0x0a, 0x3f, 0x73, 0x75, 0x6d, 0xb5, 0x01,
+                0x0b, 0x3f, 0x73, 0x75, 0x6d, 0xb5, 0x01, 0x2a, 0x0f, 0x40, 0x00, 0x06, 0x07, 0xb5, 0x01, 0x00, 0x24, 0x00, 0x0f, 0xb5,
+                0x01, 0x1f, 0x3f, 0x73, 0x75, 0x6d, 0xb5, 0x01, 0x69, 0xf0, 0x09, 0x61, 0x64, 0x64, 0x43, 0x65, 0x6c, 0x6c, 0x41, 0x74,
+                0x74, 0x72, 0x28, 0x74, 0x72, 0x6f, 0x77, 0x2c, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x4f, 0x1e, 0x11, 0x2c, 0x67,
+                0x22, 0x63, 0x2c, 0x20, 0x70, 0x61, 0x73, 0x73, 0x89, 0x08, 0x6a, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x2d, 0x08, 0x00,
+                0x7b, 0x06, 0x20, 0x74, 0x64, 0x5a, 0x12, 0xf0, 0x02, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65,
+                0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x0e, 0x00, 0x37, 0x28, 0x27, 0x74, 0xe6, 0x08, 0x03, 0xaf, 0x06, 0x02, 0x06, 0x07,
+                0x00, 0x6b, 0x00, 0x37, 0x20, 0x69, 0x6e, 0x73, 0x00, 0x0b, 0x68, 0x0b, 0x50, 0x64, 0x2e, 0x73, 0x65, 0x74, 0x9c, 0x00,
+                0x01, 0x1e, 0x00, 0x10, 0x28, 0x28, 0x00, 0x08, 0xa1, 0x00, 0x10, 0x5b, 0x0b, 0x00, 0x1f, 0x5d, 0x42, 0x1d, 0x02, 0x01,
+                0xcd, 0x0b, 0x2f, 0x65, 0x78, 0xe5, 0x05, 0x07, 0x0a, 0x6a, 0x00, 0x00, 0xc4, 0x00, 0x30, 0x73, 0x70, 0x61, 0xad, 0x06,
+                0x0f, 0xc6, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x08, 0xc8, 0x00, 0x11, 0x20, 0x31, 0x00, 0x0a, 0xa1, 0x00, 0x11, 0x22, 0x57,
+                0x22, 0x4a, 0x22, 0x2c, 0x20, 0x22, 0x75, 0x28, 0x08, 0xe6, 0x1d, 0x03, 0x38, 0x00, 0x90, 0x69, 0x6e, 0x6e, 0x65, 0x72,
+                0x48, 0x54, 0x4d, 0x4c, 0xce, 0x07, 0x19, 0x2d, 0xb9, 0x13, 0xf0, 0x00, 0x74, 0x64, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e,
+                0x64, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x2f, 0x00, 0x08, 0xe4, 0x00, 0x06, 0xb3, 0x1b, 0x0f, 0xe1, 0x00, 0x01, 0x0f,
+                0x28, 0x03, 0x03, 0x0f, 0xe0, 0x00, 0x43, 0x04, 0x6c, 0x00, 0x0f, 0xdf, 0x00, 0x40, 0x0c, 0xd4, 0x0c, 0x07, 0x84, 0x02,
+                0x0c, 0xca, 0x0c, 0x29, 0x74, 0x64, 0x6e, 0x00, 0x00, 0x15, 0x01, 0x0f, 0xc2, 0x0c, 0x0e, 0x0b, 0x34, 0x00, 0x07, 0xdb,
+                0x20, 0x00, 0x3f, 0x00, 0x0f, 0x99, 0x1c, 0x0c, 0x20, 0x20, 0x20, 0x2a, 0x03, 0x09, 0xc5, 0x00, 0x2f, 0x74, 0x64, 0x64,
+                0x03, 0x0f, 0x63, 0x53, 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x66, 0x03, 0x01, 0x49, 0x01, 0x0f, 0x63, 0x03, 0x0a, 0x90, 0x2c,
+                0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x74, 0x69, 0x70, 0x4b, 0x22, 0x18, 0x22, 0xf5, 0x00, 0x0e, 0xb4, 0x03, 0x23, 0x7b, 0x20,
+                0x9a, 0x01, 0x16, 0x3a, 0x59, 0x00, 0x11, 0x22, 0x47, 0x28, 0x25, 0x22, 0x3a, 0x47, 0x00, 0x1f, 0x7d, 0x6d, 0x00, 0x00,
+                0x0e, 0xb6, 0x00, 0x21, 0x2f, 0x2f, 0xa2, 0x03, 0x01, 0x81, 0x0f, 0xcd, 0x67, 0x69, 0x6e, 0x67, 0x20, 0x75, 0x74, 0x69,
+                0x6c, 0x69, 0x74, 0x79, 0xa5, 0x1f, 0x00, 0xe3, 0x2a, 0x15, 0x52, 0x86, 0x0f, 0x11, 0x4d, 0xe2, 0x0d, 0x19, 0x73, 0xf8,
+                0x24, 0x0f, 0xb3, 0x17, 0x03, 0x01, 0x39, 0x00, 0x08, 0x07, 0x23, 0x0f, 0xc4, 0x14, 0x01, 0x0f, 0x25, 0x00, 0x00, 0x0f,
+                0xfe, 0x0f, 0x04, 0x0b, 0x2a, 0x00, 0x0f, 0x61, 0x0c, 0x00, 0x00, 0x35, 0x2f, 0x93, 0x5f, 0x52, 0x65, 0x71, 0x75, 0x69,
+                0x72, 0x65, 0x64, 0x3a, 0x19, 0x21, 0x73, 0x28, 0x17, 0x00, 0x0c, 0xc7, 0x04, 0x02, 0xa8, 0x0e, 0x31, 0x4e, 0x61, 0x6d,
+                0xf0, 0x23, 0x17, 0x5b, 0x7d, 0x0f, 0x33, 0x66, 0x6f, 0x72, 0xb5, 0x04, 0x04, 0x0a, 0x18, 0x2f, 0x6f, 0x66, 0xe1, 0x00,
+                0x03, 0x0a, 0x9f, 0x02, 0x07, 0x52, 0x00, 0x54, 0x2e, 0x70, 0x75, 0x73, 0x68, 0x6c, 0x18, 0x0f, 0xb5, 0x04, 0x02, 0x08,
+                0x2d, 0x00, 0x40, 0x73, 0x6f, 0x72, 0x74, 0xd7, 0x00, 0x0f, 0x38, 0x05, 0x01, 0x06, 0x28, 0x00, 0x00, 0x86, 0x00, 0x07,
+                0x36, 0x00, 0x0a, 0x7c, 0x00, 0x00, 0x60, 0x24, 0x00, 0x20, 0x02, 0x0f, 0x9b, 0x05, 0x09, 0x1a, 0x72, 0xf3, 0x03, 0x0f,
+                0xab, 0x02, 0x01, 0x30, 0x22, 0x6c, 0x61, 0xf2, 0x03, 0x10, 0x27, 0xce, 0x24, 0x07, 0x7a, 0x00, 0x5a, 0x2b, 0x20, 0x22,
+                0x27, 0x2c, 0xfa, 0x03, 0x01, 0x54, 0x01, 0x0a, 0x18, 0x03, 0x3f, 0x72, 0x6f, 0x77, 0xe2, 0x22, 0x09, 0x07, 0xbc, 0x00,
+                0x0f, 0xc2, 0x01, 0x15, 0x01, 0x52, 0x14, 0x0f, 0xc0, 0x01, 0x28, 0x02, 0xbc, 0x16, 0x01, 0xbe, 0x01, 0x0d, 0x78, 0x02,
+                0x0f, 0xbc, 0x01, 0x0c, 0x01, 0x30, 0x00, 0x0f, 0xba, 0x01, 0xff, 0x28, 0x06, 0xcd, 0x10, 0x0f, 0xbf, 0x01, 0x28, 0x07,
+                0x7c, 0x13, 0x01, 0xc4, 0x01, 0x0f, 0x17, 0x04, 0x03, 0x0f, 0xc9, 0x01, 0x0c, 0x06, 0x35, 0x00, 0x0f, 0xce, 0x01, 0xff,
+                0x11, 0x00, 0xe6, 0x10, 0x31, 0x61, 0x6c, 0x63, 0x51, 0x14, 0x50, 0x20, 0x74, 0x68, 0x65, 0x20, 0xcb, 0x00, 0x01, 0x4d,
+                0x08, 0x00, 0x01, 0x12, 0x20, 0x64, 0x20, 0xaa, 0x12, 0x40, 0x72, 0x6f, 0x75, 0x70, 0x2d, 0x06, 0xd2, 0x72, 0x6f, 0x77,
+                0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x68, 0x61, 0x76, 0x2e, 0x00, 0x10, 0x73, 0xa5, 0x00, 0x05, 0xb4, 0x09, 0x00,
+                0x71, 0x00, 0xa1, 0x72, 0x69, 0x65, 0x76, 0x65, 0x64, 0x20, 0x76, 0x69, 0x61, 0x22, 0x18, 0x26, 0x6f, 0x77, 0x61, 0x08,
+                0x26, 0x29, 0x2c, 0x75, 0x00, 0x04, 0xea, 0x24, 0x00, 0x00, 0x08, 0x00, 0x49, 0x00, 0x71, 0x63, 0x75, 0x72, 0x72, 0x65,
+                0x6e, 0x74, 0x7f, 0x00, 0x20, 0x68, 0x61, 0x67, 0x00, 0x0d, 0x5d, 0x00, 0x30, 0x61, 0x73, 0x20, 0x0a, 0x1d, 0x80, 0x70,
+                0x72, 0x65, 0x76, 0x69, 0x6f, 0x75, 0x73, 0x2b, 0x00, 0x0d, 0xb8, 0x06, 0xb0, 0x61, 0x6c, 0x63, 0x52, 0x6f, 0x77, 0x53,
+                0x70, 0x61, 0x6e, 0x28, 0xae, 0x00, 0x10, 0x2c, 0x25, 0x00, 0x4c, 0x49, 0x64, 0x78, 0x2c, 0x8c, 0x00, 0x0c, 0x9d, 0x02,
+                0x00, 0x2d, 0x00, 0x02, 0x42, 0x09, 0x07, 0xce, 0x11, 0x01, 0x26, 0x0c, 0x02, 0x41, 0x00, 0x00, 0xb8, 0x0c, 0x0c, 0xcf,
+                0x00, 0x00, 0x34, 0x00, 0x12, 0x5b, 0x1f, 0x00, 0x5f, 0x5d, 0x29, 0x20, 0x21, 0x3d, 0x21, 0x00, 0x09, 0x5b, 0x20, 0x2d,
+                0x20, 0x31, 0x5d, 0x65, 0x0c, 0x0a, 0xdb, 0x11, 0x02, 0x28, 0x00, 0x02, 0xe0, 0x11, 0x01, 0x8f, 0x00, 0x50, 0x2e, 0x6c,
+                0x65, 0x6e, 0x67, 0xe2, 0x11, 0x4c, 0x2b, 0x2b, 0x69, 0x69, 0x17, 0x09, 0x01, 0x0a, 0x16, 0x0f, 0x90, 0x00, 0x22, 0x2c,
+                0x69, 0x69, 0x88, 0x00, 0x01, 0x34, 0x12, 0x00, 0x9f, 0x34, 0x08, 0x66, 0x02, 0x0a, 0xf1, 0x15, 0x43, 0x20, 0x20, 0x2b,
+                0x2b, 0x23, 0x01, 0x0f, 0x3e, 0x09, 0x0d, 0x05, 0x78, 0x10, 0x09, 0x2e, 0x00, 0x0f, 0x51, 0x0e, 0x05, 0x02, 0x5a, 0x08,
+                0x80, 0x46, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x28, 0x14, 0x00, 0x3c, 0x75, 0x6c, 0x61, 0x51, 0x0e, 0x1f, 0x21, 0x18,
+                0x00, 0x00, 0x0f, 0xc5, 0x14, 0x13, 0x30, 0x27, 0x4e, 0x73, 0xf9, 0x2e, 0x93, 0x20, 0x50, 0x65, 0x72, 0x66, 0x20, 0x53,
+                0x44, 0x4b, 0x0b, 0x03, 0x41, 0x28, 0x73, 0x29, 0x3a, 0x69, 0x2b, 0x03, 0x59, 0x00, 0x07, 0xa6, 0x00, 0x0f, 0xe6, 0x04,
+                0x04, 0x42, 0x43, 0x6f, 0x6c, 0x6c, 0x02, 0x31, 0x4e, 0x49, 0x6e, 0x66, 0x6f, 0xe1, 0x04, 0x02, 0x72, 0x2e, 0x19, 0x52,
+                0x70, 0x31, 0x03, 0x0f, 0x14, 0x70, 0x72, 0x75, 0x63, 0x74, 0x6f, 0x72, 0x28, 0xe0, 0x35, 0x12, 0x2c, 0x02, 0x17, 0x01,
+                0x2d, 0x00, 0x03, 0x0c, 0x00, 0x0d, 0xf0, 0x0a, 0x41, 0x68, 0x69, 0x73, 0x2e, 0x0c, 0x36, 0x11, 0x3d, 0x28, 0x3a, 0x0a,
+                0x94, 0x01, 0x01, 0x1e, 0x00, 0x06, 0x44, 0x00, 0x04, 0x73, 0x17, 0x01, 0x0d, 0x00, 0x0f, 0x2a, 0x00, 0x05, 0x0e, 0x98,
+                0x17, 0x0a, 0xb9, 0x01, 0x0d, 0x08, 0x03, 0x00, 0x9e, 0x05, 0x07, 0x2c, 0x00, 0x00, 0x74, 0x2e, 0x56, 0x52, 0x6f, 0x77,
+                0x28, 0x27, 0x04, 0x01, 0x10, 0x20, 0x4c, 0x2c, 0x1a, 0x27, 0x42, 0x02, 0x05, 0x01, 0x00, 0x64, 0x2c, 0x20, 0x22, 0x72,
+                0x61, 0x22, 0x0c, 0x00, 0x06, 0xe4, 0x2e, 0x11, 0x67, 0x7f, 0x3c, 0x1f, 0x29, 0x36, 0x00, 0x04, 0x0f, 0x01, 0x00, 0x01,
+                0x05, 0x30, 0x04, 0x09, 0x87, 0x00, 0x40, 0x47, 0x50, 0x55, 0x20, 0xcc, 0x04, 0x0f, 0x80, 0x00, 0x05, 0x0f, 0x87, 0x00,
+                0x02, 0x00, 0x75, 0x1a, 0x00, 0x56, 0x3b, 0x41, 0x2e, 0x67, 0x70, 0x75, 0x59, 0x05, 0x0f, 0x87, 0x00, 0x2e, 0x4f, 0x43,
+                0x68, 0x69, 0x70, 0x88, 0x00, 0x10, 0x0f, 0x87, 0x00, 0x04, 0x4f, 0x63, 0x68, 0x69, 0x70, 0x88, 0x00, 0x1c, 0x0f, 0x87,
+                0x00, 0x03, 0x20, 0x23, 0x52, 0x9b, 0x16, 0x1f, 0x73, 0x0d, 0x01, 0x0c, 0x0d, 0x87, 0x00, 0x01, 0xd1, 0x16, 0x04, 0x63,
+                0x04, 0x17, 0x2e, 0xd9, 0x30, 0x0f, 0x87, 0x00, 0x11, 0x05, 0x88, 0x00, 0x1f, 0x5d, 0x3a, 0x07, 0x03, 0x00, 0xc4, 0x05,
+                0x21, 0x6f, 0x66, 0x4c, 0x02, 0x0f, 0x2c, 0x07, 0x45, 0x00, 0x71, 0x1c, 0x41, 0x68, 0x64, 0x72, 0x22, 0xe1, 0x05, 0x01,
+                0x30, 0x03, 0x0f, 0x36, 0x00, 0x0e, 0x00, 0x29, 0x00, 0x08, 0x7f, 0x03, 0x05, 0x10, 0x00, 0x0f, 0x5e, 0x07, 0x23, 0x03,
+                0x39, 0x03, 0x02, 0xf2, 0x00, 0xf0, 0x0f, 0x49, 0x53, 0x5f, 0x43, 0x4f, 0x4c, 0x55, 0x4d, 0x4e, 0x5f, 0x41, 0x53, 0x43,
+                0x45, 0x4e, 0x44, 0x49, 0x4e, 0x47, 0x5f, 0x42, 0x59, 0x5f, 0x44, 0x45, 0x46, 0x41, 0x55, 0x4c, 0x54, 0x51, 0x03, 0x30,
+                0x74, 0x72, 0x75, 0xf5, 0x0d, 0x01, 0x06, 0x00, 0x03, 0x02, 0x0e, 0x0f, 0x07, 0x00, 0x5b, 0x03, 0x70, 0x09, 0x02, 0xb0,
+                0x00, 0xd0, 0x69, 0x73, 0x43, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x41, 0x73, 0x63, 0x65, 0x6e, 0xa9, 0x35, 0x06, 0xa3, 0x00,
+                0x4f, 0x6e, 0x75, 0x6c, 0x6c, 0x06, 0x00, 0x53, 0x03, 0x92, 0x00, 0x01, 0xbe, 0x10, 0x30, 0x6f, 0x72, 0x74, 0xbf, 0x0d,
+                0x00, 0x94, 0x00, 0x52, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x89, 0x07, 0x01, 0x20, 0x00, 0x06, 0x12, 0x2f, 0x02, 0xe2, 0x3e,
+                0x10, 0x5f, 0x2d, 0x00, 0x10, 0x54, 0x9a, 0x10, 0x30, 0x28, 0x73, 0x65, 0x91, 0x04, 0x09, 0x39, 0x00, 0x50, 0x2c, 0x20,
+                0x65, 0x78, 0x74, 0x2d, 0x13, 0x01, 0xaa, 0x1b, 0x14, 0x2c, 0x6f, 0x2e, 0x06, 0x88, 0x02, 0x01, 0x84, 0x02, 0x01, 0x8b,
+                0x14, 0x07, 0x85, 0x02, 0x33, 0x67, 0x65, 0x74, 0x82, 0x02, 0x61, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x21, 0x00, 0x00,
+                0xed, 0x14, 0x00, 0x71, 0x00, 0x06, 0x7f, 0x09, 0x00, 0x3c, 0x00, 0x03, 0x22, 0x05, 0x01, 0x22, 0x00, 0x10, 0x2e, 0x0d,
+                0x00, 0x04, 0x1d, 0x00, 0x02, 0x5a, 0x01, 0xa2, 0x6e, 0x75, 0x6d, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x52, 0x28, 0x00,
+                0x05, 0x58, 0x2d, 0x01, 0x7b, 0x23, 0x06, 0xd7, 0x07, 0x2b, 0x20, 0x3c, 0x2b, 0x00, 0x38, 0x2b, 0x20, 0x32, 0x2d, 0x03,
+                0x02, 0xc1, 0x06, 0x0f, 0xaf, 0x09, 0x01, 0x82, 0x64, 0x65, 0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e, 0x81, 0x09, 0x01, 0x85,
+                0x37, 0x02, 0x95, 0x09, 0x61, 0x77, 0x65, 0x20, 0x77, 0x61, 0x6e, 0xf6, 0x33, 0x00, 0x23, 0x01, 0x07, 0x78, 0x00, 0x0d,
+                0xef, 0x01, 0x1f, 0x5b, 0x3a, 0x01, 0x00, 0x10, 0x5d, 0xdf, 0x14, 0x00, 0x98, 0x01, 0x09, 0x7f, 0x07, 0x0f, 0x3a, 0x00,
+                0x14, 0x0f, 0x02, 0x03, 0x0c, 0x0f, 0x36, 0x00, 0x02, 0x05, 0xdd, 0x00, 0x06, 0xf4, 0x12, 0x0f, 0x27, 0x00, 0x00, 0x00,
+                0x96, 0x00, 0x0d, 0x1f, 0x02, 0x0f, 0xa3, 0x00, 0x22, 0x1f, 0x21, 0x2a, 0x00, 0x13, 0x0b, 0x97, 0x00, 0x06, 0x69, 0x00,
+                0x71, 0x2f, 0x2f, 0x20, 0x6b, 0x65, 0x65, 0x70, 0x77, 0x01, 0x05, 0x85, 0x0a, 0x01, 0x80, 0x01, 0x0c, 0xa6, 0x01, 0x0f,
+                0xcf, 0x02, 0x01, 0x0f, 0x6b, 0x00, 0x00, 0x05, 0x3e, 0x05, 0x01, 0x5b, 0x34, 0x30, 0x74, 0x6f, 0x72, 0x94, 0x02, 0x06,
+                0x19, 0x0d, 0x01, 0x52, 0x05, 0x00, 0x1b, 0x00, 0x01, 0x20, 0x0a, 0x09, 0x2e, 0x02, 0x0f, 0x27, 0x0a, 0x01, 0x0c, 0x09,
+                0x1c, 0x03, 0xad, 0x02, 0x02, 0x5b, 0x0a, 0x01, 0xf8, 0x09, 0x0a, 0x9d, 0x34, 0x04, 0x1d, 0x08, 0x08, 0x30, 0x03, 0x00,
+                0xa2, 0x02, 0x07, 0x0d, 0x03, 0x60, 0x73, 0x42, 0x79, 0x54, 0x61, 0x67, 0xa8, 0x06, 0x6f, 0x28, 0x22, 0x54, 0x44, 0x22,
+                0x29, 0x30, 0x01, 0x02, 0x02, 0x6c, 0x13, 0x1a, 0x54, 0x5a, 0x13, 0x01, 0xce, 0x00, 0x02, 0x8f, 0x0d, 0x11, 0x5b, 0x69,
+                0x00, 0x01, 0x70, 0x05, 0x06, 0xce, 0x15, 0x04, 0x46, 0x05, 0x02, 0x28, 0x00, 0x01, 0x87, 0x0d, 0x04, 0xe8, 0x03, 0x00,
+                0x4d, 0x30, 0x51, 0x5f, 0x70, 0x61, 0x69, 0x72, 0x18, 0x32, 0x01, 0x0a, 0x00, 0x09, 0x6a, 0x09, 0x02, 0x63, 0x06, 0x10,
+                0x65, 0xc4, 0x1d, 0x03, 0xdd, 0x03, 0x05, 0x32, 0x00, 0x36, 0x5b, 0x30, 0x5d, 0x35, 0x00, 0x28, 0x5b, 0x30, 0x3d, 0x16,
+                0x0f, 0x07, 0x03, 0x17, 0x0f, 0x66, 0x0a, 0x02, 0x28, 0x72, 0x65, 0x02, 0x1c, 0x0e, 0x75, 0x14, 0x04, 0x80, 0x31, 0x0a,
+                0x28, 0x00, 0x04, 0xed, 0x00, 0x05, 0x88, 0x00, 0x50, 0x2f, 0x2f, 0x20, 0x6e, 0x6f, 0x1c, 0x33, 0xf0, 0x12, 0x6f, 0x64,
+                0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x64, 0x3a, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a,
+                0x2f, 0x2f, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x6f, 0x76, 0x65, 0x72, 0xbc, 0x3b, 0x00, 0x43, 0x3f, 0x50, 0x2f, 0x71, 0x75,
+                0x65, 0x73, 0x17, 0x01, 0xf2, 0x05, 0x73, 0x2f, 0x31, 0x32, 0x31, 0x34, 0x36, 0x38, 0x38, 0x38, 0x2f, 0x77, 0x68, 0x79,
+                0x2d, 0x64, 0x6f, 0x65, 0x73, 0x2d, 0xa7, 0x06, 0x10, 0x63, 0xa7, 0x06, 0x10, 0x2d, 0x49, 0x00, 0x40, 0x73, 0x2d, 0x61,
+                0x2d, 0x5b, 0x00, 0x0f, 0x41, 0x02, 0x02, 0x13, 0x30, 0x35, 0x02, 0x02, 0x73, 0x01, 0x0f, 0x36, 0x02, 0x05, 0x02, 0xd8,
+                0x04, 0x09, 0xc3, 0x15, 0x00, 0x30, 0x00, 0x00, 0x3f, 0x02, 0x2c, 0x5b, 0x31, 0xc0, 0x01, 0x03, 0xf1, 0x02, 0x0b, 0x2c,
+                0x0b, 0x03, 0x8a, 0x44, 0x0c, 0x25, 0x0b, 0x00, 0xe8, 0x05, 0x30, 0x61, 0x64, 0x64, 0x24, 0x0b, 0x15, 0x3d, 0x33, 0x00,
+                0x11, 0x28, 0x89, 0x08, 0x03, 0xba, 0x05, 0x01, 0x0c, 0x00, 0x00, 0x6e, 0x02, 0x51, 0x2c, 0x20, 0x70, 0x65, 0x72, 0xd9,
+                0x08, 0x02, 0xb6, 0x44, 0x4c, 0x4c, 0x69, 0x6e, 0x6b, 0xb2, 0x0d, 0x00, 0x35, 0x41, 0x01, 0x42, 0x09, 0x00, 0x69, 0x28,
+                0x03, 0x38, 0x00, 0x08, 0xc2, 0x3b, 0xa0, 0x74, 0x20, 0x68, 0x69, 0x65, 0x72, 0x61, 0x72, 0x63, 0x68, 0x29, 0x38, 0x05,
+                0x23, 0x00, 0x98, 0x2e, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x28, 0x27, 0x2f, 0x67, 0x08, 0x00, 0x2e, 0x00, 0x43, 0x6c, 0x65,
+                0x61, 0x66, 0x50, 0x00, 0x05, 0x39, 0x00, 0x15, 0x5b, 0x0a, 0x00, 0x04, 0xb6, 0x05, 0x00, 0xc7, 0x0d, 0x0a, 0x47, 0x03,
+                0x0f, 0xd0, 0x08, 0x1a, 0x0f, 0x98, 0x08, 0x01, 0x43, 0x27, 0x72, 0x61, 0x27, 0xfc, 0x00, 0x03, 0x08, 0x01, 0x00, 0xc3,
+                0x15, 0x03, 0xc5, 0x10, 0x10, 0x3d, 0x95, 0x07, 0x0f, 0x41, 0x00, 0x0d, 0x51, 0x6c, 0x61, 0x20, 0x77, 0x77, 0x11, 0x01,
+                0x01, 0x46, 0x42, 0x28, 0x27, 0x2c, 0xf3, 0x16, 0x04, 0x28, 0x01, 0x7f, 0x29, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x28, 0x59,
+                0x01, 0x00, 0x02, 0x97, 0x08, 0x0f, 0xa6, 0x00, 0x12, 0x07, 0xbb, 0x1d, 0x0c, 0xdf, 0x2f, 0x1e, 0x27, 0x62, 0x48, 0x00,
+                0xdb, 0x38, 0x6e, 0x61, 0x76, 0x67, 0x27, 0x29, 0x29, 0xd4, 0x00, 0x04, 0x4c, 0x00, 0x0a, 0x01, 0x0e, 0x0f, 0x45, 0x00,
+                0x00, 0x00, 0x80, 0x22, 0x2f, 0x27, 0x29, 0x9e, 0x00, 0x19, 0x00, 0x22, 0x20, 0x0a, 0x10, 0x31, 0x1d, 0x27, 0xeb, 0x48,
+                0x0f, 0x9b, 0x00, 0x21, 0x0c, 0x44, 0x00, 0x0f, 0x1a, 0x23, 0x10, 0x0f, 0xb8, 0x00, 0x13, 0x0e, 0x4c, 0x01, 0x0a, 0xd8,
+                0x49, 0x00, 0xad, 0x00, 0x41, 0x73, 0x75, 0x6d, 0x27, 0x7b, 0x1c, 0x81, 0x26, 0x23, 0x78, 0x32, 0x37, 0x31, 0x33, 0x3b,
+                0x80, 0x1c, 0x1f, 0x27, 0xbf, 0x00, 0x17, 0x0a, 0x53, 0x00, 0x11, 0x2e, 0x50, 0x00, 0x0f, 0x9e, 0x00, 0x24, 0x0e, 0x27,
+                0x4a, 0x0f, 0xa2, 0x00, 0x32, 0x0e, 0x57, 0x00, 0x0f, 0xa6, 0x00, 0x18, 0x07, 0xa0, 0x1e, 0x0f, 0x4e, 0x01, 0x02, 0x0f,
+                0x17, 0x4b, 0x03, 0x05, 0xb8, 0x00, 0x0f, 0x48, 0x01, 0x1b, 0x0f, 0x4d, 0x00, 0x03, 0x0f, 0xae, 0x00, 0x34, 0x0c, 0x72,
+                0x4b, 0x0f, 0xa4, 0x00, 0x20, 0x0c, 0x43, 0x00, 0x0f, 0x9a, 0x00, 0x35, 0x0f, 0xdb, 0x4b, 0x0b, 0x0f, 0xa9, 0x00, 0x21,
+                0x0f, 0x52, 0x00, 0x0b, 0x0f, 0xb8, 0x00, 0x3f, 0x0f, 0xb3, 0x4c, 0x01, 0x0f, 0xb8, 0x00, 0x2b, 0x0f, 0x52, 0x00, 0x01,
+                0x0f, 0xb8, 0x00, 0x1f, 0x03, 0xb4, 0x04, 0x0a, 0xff, 0x28, 0x1a, 0x27, 0x93, 0x4c, 0x0f, 0xa1, 0x00, 0x18, 0x0f, 0x5d,
+                0x28, 0x01, 0x0e, 0x4e, 0x00, 0x0f, 0xa1, 0x00, 0x2f, 0x0d, 0xab, 0x4d, 0x0f, 0xa4, 0x00, 0x2d, 0x0f, 0x51, 0x00, 0x01,
+                0x0f, 0xa7, 0x00, 0x30, 0x0a, 0x40, 0x4e, 0x0f, 0xa5, 0x00, 0x2e, 0x0d, 0x4f, 0x00, 0x0f, 0xa3, 0x00, 0x2f, 0x0c, 0x06,
+                0x4f, 0x0f, 0xa4, 0x00, 0x2d, 0x0f, 0x50, 0x00, 0x00, 0x0f, 0xa5, 0x00, 0x2f, 0x0c, 0x78, 0x4f, 0x0f, 0xa5, 0x00, 0x2d,
+                0x0f, 0x50, 0x00, 0x00, 0x0f, 0xa5, 0x00, 0x30, 0x0a, 0x0c, 0x50, 0x0f, 0xa4, 0x00, 0x2e, 0x0d, 0x4f, 0x00, 0x0f, 0xa3,
+                0x00, 0x1d, 0x05, 0x61, 0x2a, 0x0e, 0xac, 0x00, 0x0b, 0x65, 0x50, 0x00, 0x2d, 0x07, 0x0f, 0x25, 0x00, 0x00, 0x0a, 0x7a,
+                0x50, 0x0f, 0x25, 0x00, 0x03, 0x0b, 0xf2, 0x50, 0x00, 0xa7, 0x00, 0x0f, 0xce, 0x04, 0x16, 0x00, 0x9c, 0x00, 0x00, 0x0e,
+                0x17, 0x0f, 0x00, 0x01, 0x02, 0x0d, 0xa3, 0x00, 0x06, 0xb4, 0x42, 0x0f, 0x30, 0x00, 0x03, 0x0c, 0xae, 0x00, 0x0f, 0x30,
+                0x00, 0x0c, 0x0d, 0xb9, 0x00, 0x00, 0x30, 0x00, 0x1f, 0x29, 0x3e, 0x05, 0x31, 0x0e, 0xe4, 0x51, 0x0f, 0x0c, 0x02, 0x2d,
+                0x0f, 0x52, 0x00, 0x02, 0x0f, 0xb2, 0x02, 0x30, 0x0b, 0x4b, 0x52, 0x0f, 0xb3, 0x02, 0x2e, 0x0e, 0x50, 0x00, 0x0f, 0xa5,
+                0x00, 0x2f, 0x0c, 0xf0, 0x52, 0x0f, 0xa5, 0x00, 0x2d, 0x0f, 0x50, 0x00, 0x00, 0x0f, 0xa5, 0x00, 0x2f, 0x0c, 0x5d, 0x54,
+                0x0f, 0xa5, 0x00, 0x2d, 0x0f, 0x50, 0x00, 0x00, 0x08, 0x2e, 0x1e, 0x0f, 0x2d, 0x16, 0x0c, 0x15, 0x7d, 0x2b, 0x00, 0x05,
+                0x71, 0x17, 0x75, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0xed, 0x10, 0x00, 0x8f, 0x37, 0x05, 0xf5, 0x0e, 0x06, 0x04,
+                0x0e, 0x0f, 0x69, 0x23, 0x03, 0x03, 0xd9, 0x37, 0x00, 0x49, 0x00, 0x06, 0x99, 0x3a, 0x05, 0x40, 0x00, 0x10, 0x5d, 0xa4,
+                0x1c, 0x08, 0xb0, 0x32, 0x04, 0x03, 0x21, 0x08, 0x37, 0x00, 0x03, 0xc4, 0x37, 0x0f, 0x35, 0x00, 0x09, 0x07, 0x74, 0x1f,
+                0x08, 0x3a, 0x00, 0x08, 0xfa, 0x32, 0x0f, 0x3f, 0x00, 0x07, 0x0e, 0x5f, 0x0e, 0x06, 0x44, 0x00, 0x51, 0x5f, 0x66, 0x69,
+                0x6c, 0x65, 0xa2, 0x0e, 0x03, 0x42, 0x00, 0x0a, 0x70, 0x13, 0x01, 0xf5, 0x01, 0x00, 0xd4, 0x18, 0x0f, 0x13, 0x10, 0x17,
+                0x05, 0x69, 0x01, 0x03, 0x0a, 0x00, 0x0e, 0x66, 0x1c, 0xc1, 0x6f, 0x6e, 0x42, 0x6f, 0x64, 0x79, 0x4c, 0x6f, 0x61, 0x64,
+                0x65, 0x64, 0xbf, 0x24, 0x0f, 0x8b, 0x34, 0x0f, 0x0f, 0xfc, 0x24, 0x05, 0x0f, 0x12, 0x4a, 0x02, 0x0f, 0x1d, 0x1c, 0x01,
+                0x0f, 0x56, 0x16, 0x05, 0x12, 0x27, 0x2e, 0x00, 0x00, 0xa9, 0x53, 0x03, 0x0c, 0x4e, 0x41, 0x69, 0x6e, 0x66, 0x6f, 0xea,
+                0x04, 0x0f, 0x96, 0x00, 0x10, 0x06, 0x04, 0x02, 0x0f, 0xf4, 0x24, 0x04, 0x0f, 0x77, 0x00, 0x0c, 0x13, 0x72, 0x30, 0x00,
+                0x06, 0xd6, 0x24, 0x0a, 0xb7, 0x00, 0x09, 0x72, 0x05, 0x02, 0x89, 0x00, 0x52, 0x4a, 0x53, 0x4f, 0x4e, 0x2e, 0xe5, 0x35,
+                0x34, 0x69, 0x66, 0x79, 0xdd, 0x24, 0x11, 0x73, 0x5c, 0x1e, 0x0b, 0x1c, 0x00, 0x1e, 0x5b, 0x55, 0x1e, 0x20, 0x61, 0x6c,
+                0x39, 0x36, 0x1b, 0x22, 0x66, 0x00, 0x24, 0x73, 0x20, 0x89, 0x00, 0x06, 0xd3, 0x00, 0x40, 0x6d, 0x69, 0x73, 0x6d, 0xf5,
+                0x0d, 0x50, 0x21, 0x20, 0x50, 0x6c, 0x65, 0x77, 0x32, 0x10, 0x70, 0x68, 0x05, 0x01, 0x68, 0x15, 0x00, 0x97, 0x20, 0x50,
+                0x73, 0x74, 0x20, 0x6c, 0x69, 0x1d, 0x22, 0x11, 0x6f, 0x13, 0x00, 0xaa, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x6f,
+                0x72, 0x2e, 0x18, 0x21, 0x06, 0xb4, 0x36, 0x3f, 0x6c, 0x6f, 0x67, 0x78, 0x00, 0x1b, 0x0f, 0x49, 0x00, 0x0a, 0x90, 0x41,
+                0x63, 0x74, 0x75, 0x61, 0x6c, 0x3a, 0x20, 0x22, 0x4d, 0x18, 0x03, 0x02, 0x01, 0x0f, 0x2f, 0x00, 0x08, 0x14, 0x47, 0x9f,
+                0x00, 0x4a, 0x3a, 0x20, 0x5b, 0x5d, 0x59, 0x00, 0x0d, 0x56, 0x3a, 0x0e, 0xce, 0x01, 0x03, 0x00, 0x25, 0x0f, 0xcc, 0x01,
+                0x15, 0x03, 0xe4, 0x24, 0x0f, 0xca, 0x01, 0x1d, 0x02, 0x37, 0x00, 0x0f, 0xc8, 0x01, 0x35, 0x03, 0xcb, 0x00, 0x61, 0x64,
+                0x6f, 0x6e, 0x27, 0x74, 0x20, 0x51, 0x01, 0x01, 0xa8, 0x01, 0x61, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0xc4, 0x11, 0x0f,
+                0xd9, 0x01, 0x54, 0x03, 0x89, 0x00, 0x0f, 0xd7, 0x01, 0x1e, 0x03, 0x0f, 0x01, 0x0f, 0xd5, 0x01, 0x2f, 0x0a, 0x3b, 0x05,
+                0x0f, 0x20, 0x25, 0x07, 0x0f, 0xdf, 0x01, 0x15, 0x08, 0xff, 0x24, 0x0f, 0xe4, 0x01, 0x1d, 0x07, 0x3c, 0x00, 0x0f, 0xe9,
+                0x01, 0x35, 0x08, 0xdf, 0x00, 0x0f, 0xee, 0x01, 0x6f, 0x08, 0x8e, 0x00, 0x0f, 0xf3, 0x01, 0x1e, 0x08, 0x1e, 0x01, 0x0f,
+                0xf8, 0x01, 0x2d, 0x07, 0x43, 0x21, 0x0f, 0x55, 0x06, 0x38, 0x04, 0x46, 0x17, 0x0f, 0x2c, 0x02, 0x0c, 0x03, 0xa4, 0x1c,
+                0x0f, 0x46, 0x06, 0x67, 0x02, 0x80, 0x20, 0x03, 0xae, 0x00, 0x0f, 0x45, 0x06, 0x2c, 0x0f, 0xf8, 0x14, 0x00, 0x0f, 0xbc,
+                0x13, 0x0b, 0x0f, 0x74, 0x16, 0x03, 0x0f, 0xee, 0x15, 0x02, 0x0f, 0xb5, 0x14, 0x03, 0x0f, 0x6d, 0x13, 0x01, 0x0f, 0x2f,
+                0x12, 0x10, 0x0f, 0x0a, 0x13, 0x0d, 0x0f, 0x5d, 0x03, 0x06, 0x0a, 0x2e, 0x01, 0x0f, 0x0d, 0x07, 0x56, 0x0f, 0x77, 0x00,
+                0x18, 0x0f, 0x0c, 0x07, 0x45, 0x0f, 0xdc, 0x01, 0xb7, 0x0f, 0xd5, 0x07, 0x54, 0x0f, 0x59, 0x03, 0x1c, 0x0f, 0xd4, 0x07,
+                0x21, 0x0f, 0x17, 0x02, 0x06, 0x0f, 0xd3, 0x07, 0x5c, 0x0f, 0x88, 0x00, 0x0d, 0x0f, 0xd2, 0x07, 0xc3, 0x0f, 0xe1, 0x01,
+                0x1c, 0x0f, 0xd1, 0x07, 0x0d, 0x0e, 0xad, 0x0e, 0x2e, 0x2c, 0x20, 0x07, 0x14, 0x00, 0x2f, 0x1c, 0x0d, 0x64, 0x15, 0x00,
+                0x15, 0x00, 0x0b, 0xd4, 0x14, 0x01, 0x01, 0x44, 0x0b, 0x9e, 0x13, 0x04, 0x54, 0x03, 0x0b, 0x13, 0x00, 0x0b, 0xc1, 0x11,
+                0x05, 0x43, 0x03, 0x0a, 0x14, 0x00, 0x0f, 0x3c, 0x11, 0x00, 0x00, 0x78, 0x17, 0x0d, 0x9e, 0x00, 0x0c, 0x70, 0x12, 0x00,
+                0x13, 0x00, 0x0b, 0x53, 0x12, 0x2e, 0x2c, 0x20, 0x3e, 0x10, 0x0f, 0xe4, 0x02, 0x1f, 0x0f, 0xce, 0x08, 0x61, 0x0f, 0x8d,
+                0x00, 0x12, 0x0f, 0xcd, 0x08, 0x51, 0x0f, 0x2d, 0x02, 0xec, 0x0f, 0xcb, 0x09, 0x14, 0x1f, 0x21, 0x45, 0x09, 0x02, 0x01,
+                0x7f, 0x58, 0x00, 0x17, 0x00, 0x12, 0x53, 0x99, 0x0a, 0x01, 0x65, 0x58, 0x0e, 0x00, 0x04, 0x40, 0x73, 0x42, 0x79, 0x43,
+                0x6a, 0x28, 0x01, 0x3f, 0x23, 0x19, 0x27, 0x46, 0x5d, 0x0a, 0xe3, 0x28, 0x00, 0xff, 0x30, 0x08, 0x50, 0x00, 0x00, 0x3c,
+                0x29, 0x09, 0x60, 0x00, 0x0c, 0xda, 0x02, 0x08, 0x1d, 0x00, 0x11, 0x2e, 0xbf, 0x5b, 0x13, 0x2e, 0x82, 0x60, 0x00, 0x4e,
+                0x36, 0x5f, 0x6e, 0x6f, 0x6e, 0x65, 0x22, 0xdf, 0x00, 0x0c, 0x02, 0x13, 0x00, 0x22, 0x3c, 0x2f, 0xee, 0x5b, 0x02, 0x52,
+                0x66, 0x12, 0x2f, 0x53, 0x66, 0x00, 0x0b, 0x00, 0x01, 0x8a, 0x64, 0x8a, 0x6f, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x3d, 0x22,
+                0x43, 0x11, 0x21, 0x22, 0x20, 0x71, 0x00, 0x26, 0x3d, 0x22, 0xeb, 0x5c, 0x03, 0xa2, 0x61, 0x30, 0x23, 0x32, 0x30, 0x02,
+                0x00, 0x23, 0x3b, 0x22, 0x97, 0x66, 0x24, 0x6e, 0x6f, 0x5e, 0x00, 0x02, 0x74, 0x00, 0x51, 0x3c, 0x70, 0x3e, 0x45, 0x6e,
+                0x79, 0x27, 0x44, 0x6a, 0x61, 0x76, 0x61, 0x68, 0x5c, 0x40, 0x6f, 0x20, 0x73, 0x65, 0x38, 0x30, 0x00, 0xd4, 0x11, 0x04,
+                0x09, 0x67, 0x30, 0x73, 0x3c, 0x2f, 0x3c, 0x2e, 0x03, 0x48, 0x00, 0x16, 0x2f, 0x49, 0x00, 0x02, 0x11, 0x00, 0x33, 0x64,
+                0x69, 0x76, 0x1b, 0x00, 0x32, 0x64, 0x69, 0x76, 0x7a, 0x2d, 0x12, 0x3d, 0x10, 0x37, 0x00, 0x97, 0x61, 0x03, 0x7f, 0x00,
+                0x0f, 0x20, 0x00, 0x02, 0x37, 0x62, 0x61, 0x72, 0x1f, 0x00, 0xc4, 0x20, 0x20, 0x3c, 0x69, 0x6d, 0x67, 0x20, 0x73, 0x72,
+                0x63, 0x3d, 0x22, 0x80, 0x23, 0xf1, 0x01, 0x64, 0x65, 0x76, 0x65, 0x6c, 0x6f, 0x70, 0x65, 0x72, 0x2e, 0x6e, 0x76, 0x69,
+                0x64, 0x69, 0x61, 0x83, 0x23, 0xf0, 0x01, 0x73, 0x69, 0x74, 0x65, 0x73, 0x2f, 0x61, 0x6c, 0x6c, 0x2f, 0x74, 0x68, 0x65,
+                0x6d, 0x65, 0x73, 0x26, 0x00, 0x92, 0x7a, 0x6f, 0x6e, 0x65, 0x5f, 0x6e, 0x65, 0x77, 0x2f, 0x28, 0x00, 0x92, 0x5f, 0x6c,
+                0x6f, 0x67, 0x6f, 0x2e, 0x70, 0x6e, 0x67, 0xe8, 0x67, 0x05, 0x61, 0x00, 0x01, 0x55, 0x30, 0x08, 0x83, 0x00, 0x11, 0x22,
+                0x8d, 0x67, 0x04, 0x8e, 0x00, 0x10, 0x5f, 0xb4, 0x37, 0x2c, 0x22, 0x3e, 0xa6, 0x2e, 0x30, 0x50, 0x72, 0x6f, 0x2c, 0x13,
+                0x22, 0x72, 0x20, 0xec, 0x12, 0x08, 0x0f, 0x01, 0x02, 0x13, 0x01, 0x06, 0x03, 0x01, 0x02, 0x0b, 0x00, 0x04, 0x63, 0x01,
+                0x07, 0xf1, 0x00, 0x03, 0x6b, 0x02, 0x06, 0xb4, 0x5d, 0x00, 0x2a, 0x68, 0x01, 0x7f, 0x01, 0x03, 0xc1, 0x01, 0x05, 0xb5,
+                0x62, 0x21, 0x69, 0x6e, 0x3f, 0x5e, 0x6e, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0x36, 0x66, 0x04, 0xd1, 0x01, 0x04, 0x44,
+                0x00, 0x06, 0x7a, 0x68, 0x06, 0x14, 0x00, 0x1a, 0x72, 0x11, 0x00, 0x01, 0x27, 0x00, 0x00, 0xdf, 0x5e, 0x00, 0xb8, 0x00,
+                0x44, 0x3d, 0x22, 0x32, 0x22, 0x95, 0x00, 0x22, 0x63, 0x61, 0x61, 0x24, 0x00, 0x05, 0x14, 0x27, 0x22, 0x3e, 0x51, 0x2e,
+                0x00, 0xdd, 0x0d, 0x00, 0x94, 0x15, 0x7b, 0x69, 0x6f, 0x6e, 0x3c, 0x2f, 0x74, 0x68, 0x60, 0x00, 0x1c, 0x2f, 0x61, 0x00,
+                0x0f, 0x72, 0x00, 0x05, 0x02, 0x66, 0x00, 0x40, 0x6c, 0x61, 0x22, 0x3e, 0x76, 0x03, 0x0e, 0x4a, 0x00, 0x0d, 0x27, 0x00,
+                0x01, 0x22, 0x1e, 0x0f, 0x72, 0x00, 0x0f, 0x00, 0x22, 0x00, 0x0b, 0xf7, 0x00, 0x12, 0x3c, 0xb0, 0x67, 0x01, 0xce, 0x01,
+                0x0f, 0xd8, 0x13, 0x01, 0x0a, 0x36, 0x01, 0x11, 0x2f, 0x24, 0x00, 0x08, 0xc3, 0x01, 0x01, 0x08, 0x01, 0x06, 0xba, 0x01,
+                0x0f, 0xc8, 0x01, 0x1a, 0x0e, 0x1f, 0x00, 0x02, 0x57, 0x62, 0x14, 0x22, 0x06, 0x6a, 0x00, 0x43, 0x04, 0x50, 0x4d, 0x65,
+                0x61, 0x73, 0x75, 0x5c, 0x06, 0x02, 0x75, 0x06, 0x0a, 0x62, 0x00, 0x0a, 0x45, 0x00, 0x04, 0x2d, 0x62, 0x50, 0x22, 0x3e,
+                0x0a, 0x54, 0x6f, 0xc0, 0x59, 0x00, 0x91, 0x06, 0x60, 0x65, 0x20, 0x62, 0x69, 0x67, 0x67, 0xe9, 0x06, 0x00, 0xf7, 0x0a,
+                0x01, 0x4b, 0x06, 0x61, 0x75, 0x6d, 0x65, 0x72, 0x73, 0x2c, 0xdf, 0x28, 0x44, 0x20, 0x62, 0x79, 0x20, 0x98, 0x0b, 0x00,
+                0x0c, 0x00, 0x50, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x49, 0x2c, 0x00, 0x07, 0x26, 0x00, 0xd0, 0x33, 0x01, 0x52, 0x27, 0x10,
+                0x20, 0x36, 0x01, 0x66, 0x65, 0x72, 0x2e, 0x3c, 0x62, 0x72, 0x5b, 0x00, 0x97, 0x63, 0x6f, 0x6c, 0x64, 0x20, 0x73, 0x70,
+                0x6f, 0x74, 0x4b, 0x00, 0x41, 0x47, 0x52, 0x20, 0x41, 0xcf, 0x0b, 0x1a, 0x25, 0x2c, 0x00, 0x31, 0x72, 0x65, 0x67, 0x62,
+                0x05, 0xf1, 0x0a, 0x77, 0x69, 0x74, 0x68, 0x20, 0x65, 0x78, 0x63, 0x65, 0x73, 0x73, 0x69, 0x76, 0x65, 0x20, 0x73, 0x79,
+                0x6e, 0x63, 0x68, 0x72, 0x6f, 0x6e, 0x69, 0x7a, 0x81, 0x00, 0x06, 0x48, 0x00, 0x40, 0x23, 0x57, 0x46, 0x49, 0xe9, 0x49,
+                0x04, 0x7f, 0x5a, 0x00, 0x09, 0x01, 0xc0, 0x57, 0x61, 0x69, 0x74, 0x2d, 0x66, 0x6f, 0x72, 0x2d, 0x49, 0x64, 0x6c, 0x99,
+                0x00, 0x73, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x73, 0x29, 0x69, 0x00, 0x20, 0x68, 0x65, 0x8c, 0x32, 0x10, 0x6c, 0x2b, 0x63,
+                0x01, 0xdc, 0x07, 0x40, 0x69, 0x6e, 0x6b, 0x73, 0x97, 0x04, 0x11, 0x70, 0xdc, 0x62, 0x24, 0x6e, 0x67, 0x9d, 0x04, 0x10,
+                0x73, 0xcc, 0x3e, 0x00, 0x22, 0x00, 0x00, 0x2a, 0x5f, 0x01, 0xf9, 0x2f, 0x04, 0xe4, 0x00, 0x00, 0x67, 0x27, 0x10, 0x6d,
+                0xbd, 0x29, 0x8d, 0x64, 0x65, 0x74, 0x61, 0x69, 0x6c, 0x2e, 0x0a, 0x6b, 0x01, 0x09, 0x78, 0x03, 0x0e, 0x61, 0x03, 0x02,
+                0x14, 0x03, 0x74, 0x2d, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x8d, 0x62, 0x03, 0x29, 0x04, 0x09, 0x89, 0x2c, 0x07, 0x54,
+                0x00, 0x0f, 0x8a, 0x03, 0x1b, 0x02, 0xe7, 0x01, 0x00, 0x02, 0x30, 0x21, 0x6f, 0x6e, 0xaa, 0x01, 0x2e, 0x3d, 0x22, 0x4e,
+                0x2d, 0x00, 0xbf, 0x45, 0x00, 0xb3, 0x6c, 0x41, 0x49, 0x6e, 0x74, 0x2c, 0xe7, 0x59, 0x03, 0x99, 0x5b, 0x26, 0x3d, 0x3e,
+                0x5b, 0x5b, 0x06, 0x00, 0x06, 0xa1, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a, 0x70, 0x6f, 0x69, 0x10, 0x53, 0x21, 0x22,
+                0x20, 0x82, 0x02, 0x30, 0x3d, 0x22, 0x43, 0x5f, 0x00, 0x04, 0x84, 0x2c, 0x00, 0x93, 0x01, 0x02, 0x45, 0x01, 0x10, 0x69,
+                0xd0, 0x17, 0x3f, 0x22, 0x3e, 0x23, 0x94, 0x03, 0x0f, 0x0f, 0xa3, 0x00, 0x09, 0x40, 0x31, 0x2c, 0x20, 0x73, 0x90, 0x00,
+                0x1f, 0x73, 0xa1, 0x00, 0x00, 0x21, 0x2e, 0x6c, 0x67, 0x41, 0x13, 0x43, 0x14, 0x2a, 0x01, 0xec, 0x5a, 0x0f, 0xae, 0x00,
+                0x1f, 0x00, 0x2f, 0x27, 0x01, 0x79, 0x33, 0x25, 0x22, 0x3e, 0xe9, 0x01, 0x0f, 0xb4, 0x00, 0x0c, 0x10, 0x72, 0x7f, 0x27,
+                0x0f, 0xb7, 0x00, 0x0a, 0x13, 0x32, 0xb7, 0x00, 0x01, 0x5f, 0x01, 0x74, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x73, 0x32,
+                0x5e, 0x60, 0x41, 0x6c, 0x6c, 0x28, 0x27, 0x2c, 0xa7, 0x08, 0x01, 0xad, 0x1a, 0x0a, 0x1f, 0x5d, 0x0f, 0xc1, 0x00, 0x20,
+                0x14, 0x44, 0x95, 0x03, 0x47, 0x6e, 0x73, 0x22, 0x3e, 0x0d, 0x00, 0x0f, 0xc5, 0x00, 0x2e, 0x1f, 0x33, 0xc5, 0x00, 0x58,
+                0x06, 0x0f, 0x04, 0x26, 0x22, 0x3e, 0x0c, 0x00, 0x0f, 0xc3, 0x00, 0x2e, 0x1f, 0x34, 0xc3, 0x00, 0x58, 0x8f, 0x33, 0x44,
+                0x3f, 0x22, 0x3e, 0x33, 0x44, 0x3f, 0xb5, 0x00, 0x2e, 0x1f, 0x35, 0xb5, 0x00, 0x58, 0x00, 0x3d, 0x03, 0x10, 0x3f, 0x99,
+                0x07, 0x2f, 0x6d, 0x70, 0xb9, 0x00, 0x2f, 0x1f, 0x36, 0xb9, 0x00, 0x58, 0x00, 0xf8, 0x05, 0x20, 0x22, 0x3e, 0x06, 0x00,
+                0x0f, 0xb7, 0x00, 0x2e, 0x1f, 0x37, 0xb7, 0x00, 0x59, 0x10, 0x50, 0x99, 0x12, 0x22, 0x22, 0x3e, 0x08, 0x00, 0x0f, 0xbb,
+                0x00, 0x2e, 0x1f, 0x38, 0xbb, 0x00, 0x5a, 0x01, 0x18, 0x13, 0x20, 0x2d, 0x5a, 0xbe, 0x00, 0x03, 0x0b, 0x00, 0x0f, 0xc1,
+                0x00, 0x2e, 0x1f, 0x39, 0xc1, 0x00, 0x60, 0x16, 0x43, 0xc1, 0x00, 0x1f, 0x43, 0xc1, 0x00, 0x2e, 0x00, 0x04, 0x4d, 0x0f,
+                0xc2, 0x00, 0x56, 0x7f, 0x53, 0x4d, 0x25, 0x22, 0x3e, 0x53, 0x4d, 0x18, 0x05, 0x2f, 0x14, 0x31, 0x58, 0x07, 0x0f, 0xb6,
+                0x00, 0x51, 0x82, 0x4c, 0x31, 0x54, 0x45, 0x58, 0x25, 0x22, 0x3e, 0x08, 0x00, 0x0f, 0xbc, 0x00, 0x2f, 0x0f, 0x5d, 0x07,
+                0x59, 0x20, 0x4c, 0x32, 0xb9, 0x00, 0x1f, 0x32, 0xb6, 0x00, 0x30, 0x0f, 0x4e, 0x07, 0x59, 0x30, 0x44, 0x52, 0x41, 0x2a,
+                0x02, 0x01, 0x07, 0x00, 0x0f, 0xba, 0x00, 0x2f, 0x0f, 0x45, 0x07, 0x59, 0x30, 0x50, 0x43, 0x49, 0x03, 0x08, 0x01, 0x07,
+                0x00, 0x0f, 0xba, 0x00, 0x2f, 0x0f, 0x4a, 0x07, 0x59, 0x20, 0x50, 0x44, 0xb8, 0x00, 0x1f, 0x44, 0xb6, 0x00, 0x30, 0x0f,
+                0x47, 0x07, 0x59, 0x20, 0x50, 0x45, 0xb6, 0x00, 0x1f, 0x45, 0xb6, 0x00, 0x30, 0x0f, 0x46, 0x07, 0x59, 0x71, 0x52, 0x53,
+                0x54, 0x52, 0x25, 0x22, 0x3e, 0x07, 0x00, 0x0f, 0xba, 0x00, 0x2f, 0x0f, 0x45, 0x07, 0x59, 0x40, 0x50, 0x52, 0x4f, 0x50,
+                0x72, 0x01, 0x00, 0x07, 0x00, 0x0f, 0xba, 0x00, 0x2f, 0x0f, 0x3e, 0x07, 0x59, 0x12, 0x5a, 0xba, 0x00, 0x01, 0x07, 0x00,
+                0x0f, 0x20, 0x0d, 0x2f, 0x0f, 0x36, 0x07, 0x59, 0x12, 0x43, 0xba, 0x00, 0x01, 0x07, 0x00, 0x02, 0xba, 0x00, 0x0f, 0xfb,
+                0x11, 0x2e, 0x06, 0xa0, 0x0f, 0x0f, 0xf3, 0x11, 0x32, 0x09, 0x2c, 0x16, 0x0f, 0xc1, 0x13, 0x69, 0x06, 0x28, 0x13, 0x0a,
+                0x87, 0x21, 0x24, 0x3a, 0x20, 0x04, 0x1b, 0x14, 0x20, 0x39, 0x20, 0x0f, 0x44, 0x13, 0x33, 0x0f, 0xa5, 0x26, 0x0d, 0x0f,
+                0x62, 0x01, 0x1b, 0x0f, 0x31, 0x01, 0x82, 0x02, 0x0d, 0x1e, 0x0f, 0x2f, 0x01, 0x3c, 0x0f, 0x08, 0x26, 0x02, 0x0f, 0x2d,
+                0x01, 0xb0, 0x07, 0x63, 0x1d, 0x0f, 0x32, 0x01, 0x3c, 0x0f, 0x5b, 0x25, 0x07, 0x0f, 0xc6, 0x03, 0xc8, 0x09, 0x7f, 0x1c,
+                0x0f, 0xc5, 0x03, 0x58, 0x09, 0x78, 0x00, 0x0f, 0x97, 0x02, 0x97, 0x0f, 0x2f, 0x01, 0x05, 0x0f, 0xc3, 0x03, 0x49, 0x0f,
+                0x2b, 0x01, 0xbc, 0x0f, 0xc1, 0x03, 0x53, 0x0f, 0x35, 0x01, 0x28, 0x08, 0xc0, 0x03, 0x09, 0x0c, 0x00, 0x00, 0xca, 0x03,
+                0x00, 0x77, 0x00, 0x02, 0x36, 0x7a, 0x05, 0x55, 0x00, 0x01, 0xd2, 0x1b, 0x40, 0x3e, 0x54, 0x68, 0x69, 0xbd, 0x1f, 0x01,
+                0xb5, 0x1c, 0x20, 0x69, 0x73, 0xd4, 0x3f, 0x60, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x32, 0x4d, 0x00, 0x0f, 0x18, 0x80,
+                0x62, 0x65, 0x6e, 0x63, 0x68, 0x6d, 0x61, 0x72, 0x12, 0x19, 0x53, 0x2c, 0x20, 0x6e, 0x6f, 0x72, 0xb7, 0x08, 0x20, 0x69,
+                0x73, 0x2e, 0x19, 0x70, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x20, 0xc9, 0x48, 0xf0, 0x07, 0x70, 0x61, 0x72, 0x74, 0x73,
+                0x28, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x72, 0x65, 0x61, 0x64, 0x6d, 0x65, 0x2e, 0x49, 0x84, 0x30,
+                0x23, 0x75, 0x6e, 0xca, 0x08, 0xa0, 0x6e, 0x64, 0x65, 0x64, 0x5f, 0x75, 0x73, 0x65, 0x22, 0x3e, 0xdf, 0x1c, 0x11, 0x6e,
+                0x69, 0x18, 0x6a, 0x3c, 0x2f, 0x61, 0x3e, 0x29, 0x2e, 0x25, 0x1d, 0x07, 0xba, 0x00, 0x0a, 0x77, 0x1d, 0x30, 0x67, 0x5f,
+                0x6a, 0x75, 0x00, 0x18, 0x3d, 0xc9, 0x42, 0x30, 0x2a, 0x2a, 0x2a, 0x3e, 0x22, 0xef, 0x5f, 0x44, 0x41, 0x54, 0x41, 0x5f,
+                0x48, 0x45, 0x52, 0x45, 0x2a, 0x2a, 0x2a, 0x2f, 0xb5, 0x30, 0x00, 0x01, 0xf9, 0x19, 0x00, 0xc0, 0x2f, 0x00, 0x43, 0x00,
+                0x00, 0xc2, 0x7c, 0x0b, 0x74, 0x78, 0x26, 0x7c, 0x7c, 0x2f, 0x4d, 0x04, 0xdb, 0x48, 0x06, 0x30, 0x00, 0x03, 0x10, 0x00,
+                0x09, 0x22, 0x30, 0x0d, 0x88, 0x49, 0x00, 0x2e, 0x00, 0x0b, 0x13, 0x00, 0xa1, 0x7c, 0x7c, 0x20, 0x27, 0x55, 0x6e, 0x6b,
+                0x6e, 0x6f, 0x77, 0x24, 0x01, 0x05, 0xe0, 0x4b, 0x0e, 0x3d, 0x49, 0x07, 0x3d, 0x00, 0x05, 0x14, 0x00, 0x08, 0x3e, 0x00,
+                0x00, 0xa4, 0x49, 0x1d, 0x27, 0x85, 0x31, 0x06, 0xa2, 0x00, 0x03, 0x10, 0x00, 0x27, 0x7c, 0x7c, 0x76, 0x43, 0x0e, 0xad,
+                0x30, 0x0b, 0x30, 0x00, 0x08, 0x1a, 0x00, 0x0f, 0x3a, 0x00, 0x01, 0x06, 0x9c, 0x31, 0x0c, 0x69, 0x00, 0x04, 0x67, 0x05,
+                0x0c, 0x13, 0x01, 0x09, 0x9c, 0x31, 0x0c, 0x35, 0x00, 0x02, 0x6d, 0x04, 0x0f, 0x33, 0x00, 0x04, 0x0c, 0xac, 0x31, 0x07,
+                0x38, 0x00, 0x07, 0x7a, 0x03, 0x04, 0x3d, 0x00, 0x05, 0x3e, 0x00, 0x07, 0xa1, 0x00, 0x0a, 0x55, 0x00, 0x03, 0x81, 0x00,
+                0x08, 0x15, 0x00, 0x0a, 0x63, 0x00, 0x07, 0x47, 0x00, 0x0c, 0x4c, 0x56, 0x07, 0xa6, 0x01, 0x20, 0x62, 0x75, 0x51, 0x48,
+                0x15, 0x28, 0x08, 0x02, 0x01, 0x10, 0x00, 0x09, 0xd6, 0x64, 0x11, 0x3f, 0x74, 0x40, 0x26, 0x20, 0x3a, 0x2c, 0x02, 0x25,
+                0x62, 0x75, 0x9b, 0x5d, 0x0f, 0xe3, 0x64, 0x02, 0x07, 0x51, 0x00, 0x0f, 0x1e, 0x00, 0x02, 0x0f, 0x5f, 0x00, 0x0a, 0x0f,
+                0x32, 0x00, 0x00, 0x08, 0x98, 0x47, 0x0f, 0x54, 0x65, 0x0e, 0x05, 0xc0, 0x33, 0x01, 0xd2, 0x44, 0xb8, 0x27, 0x51, 0x30,
+                0x20, 0x2f, 0x20, 0x46, 0x52, 0x41, 0x4d, 0x45, 0xca, 0x21, 0x0e, 0x3a, 0x02, 0x03, 0x2f, 0x00, 0x10, 0x30, 0x01, 0x00,
+                0x11, 0x5f, 0x30, 0x00, 0x01, 0xdb, 0x03, 0x0f, 0x35, 0x00, 0x00, 0x09, 0x5a, 0x00, 0x7f, 0x4c, 0x45, 0x46, 0x54, 0x5f,
+                0x45, 0x59, 0x5d, 0x00, 0x17, 0x24, 0x31, 0x5f, 0x33, 0x00, 0x0f, 0x60, 0x00, 0x1a, 0x30, 0x20, 0x2f, 0x20, 0xac, 0x47,
+                0x0f, 0x68, 0x00, 0x17, 0x21, 0x32, 0x5f, 0x30, 0x00, 0x0f, 0x65, 0x00, 0x22, 0x20, 0x20, 0x2f, 0xcd, 0x03, 0xaf, 0x5f,
+                0x50, 0x41, 0x52, 0x54, 0x49, 0x43, 0x4c, 0x45, 0x53, 0x75, 0x00, 0x16, 0x29, 0x33, 0x5f, 0x38, 0x00, 0x0f, 0x7d, 0x00,
+                0x25, 0x10, 0x56, 0x9e, 0x48, 0xff, 0x07, 0x45, 0x54, 0x52, 0x49, 0x43, 0x5f, 0x43, 0x4c, 0x4f, 0x55, 0x44, 0x53, 0x5f,
+                0x53, 0x48, 0x41, 0x44, 0x4f, 0x57, 0x47, 0x45, 0x4e, 0x8b, 0x00, 0x16, 0x2f, 0x34, 0x5f, 0x46, 0x00, 0x08, 0x0f, 0x99,
+                0x00, 0x25, 0x00, 0x1a, 0x39, 0xc1, 0x27, 0x49, 0x5f, 0x41, 0x4d, 0x5f, 0x41, 0x5f, 0x4c, 0x4f, 0x4e, 0x47, 0x10, 0x00,
+                0x20, 0x47, 0x27, 0xff, 0x0e, 0x61, 0x65, 0x61, 0x74, 0x28, 0x35, 0x30, 0x12, 0x39, 0x7f, 0x5f, 0x53, 0x54, 0x52, 0x49,
+                0x4e, 0x47, 0xab, 0x00, 0x16, 0x27, 0x35, 0x5f, 0x53, 0x00, 0x03, 0x3d, 0x00, 0x0b, 0xa2, 0x00, 0x04, 0x18, 0x24, 0x0f,
+                0xe9, 0x58, 0x02, 0x03, 0x6d, 0x7e, 0x21, 0x53, 0x65, 0x20, 0x55, 0x0a, 0x22, 0x04, 0x0f, 0x27, 0x00, 0x0e, 0x0f, 0xb7,
+                0x55, 0x03, 0x0e, 0x2c, 0x00, 0x0b, 0x81, 0x24, 0x02, 0xaa, 0x07, 0x90, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a,
+                0x00,
+            };
+
+            static const CompressedReportDefinition reportDefinition(CompressedContents, sizeof(CompressedContents), 36061, 8, 0, 13);
+            return reportDefinition.GetReportDefinition();
+        }
+
+    } // namespace SummaryReport
+
+} } } }
@@ -0,0 +1,2294 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+// Generated by tools/ReportDefinitionCompressor from NvPerfReportDefinitionTU11X.h, do not edit.
+
+#pragma once
+
+#include "NvPerfCompressedReportDefinition.h"
+
+namespace nv { namespace perf { namespace compressed { namespace tu11x {
+
+    namespace PerRangeReport {
+
+        inline ReportDefinition GetReportDefinition()
+        {
+            static const unsigned char CompressedContents[] = {
+                0xf1, 0x14, 0x64, 0x72, 0x61, 0x6d, 0x5f, 0x5f, 0x63, 0x79, 0x63, 0x6c, 0x65, 0x73, 0x5f, 0x65, 0x6c, 0x61, 0x70, 0x73,
+                0x65, 0x64, 0x00, 0x66, 0x65, 0x5f, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x0f, 0x00, 0xf1,
+                0x13, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5f, 0x6f, 0x70, 0x73, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x5f, 0x62, 0x75, 0x6e,
+                0x64, 0x6c, 0x65, 0x5f, 0x63, 0x6d, 0x64, 0x5f, 0x67, 0x6f, 0x5f, 0x69, 0x64, 0x6c, 0x65, 0x27, 0x00, 0xfd, 0x0a, 0x70,
+                0x69, 0x78, 0x65, 0x6c, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x73,
+                0x00, 0x67, 0x70, 0x63, 0x64, 0x00, 0xf5, 0x06, 0x67, 0x70, 0x75, 0x5f, 0x5f, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x64, 0x75,
+                0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x67, 0x72, 0x26, 0x00, 0x61, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x12, 0x00,
+                0x83, 0x64, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x8d, 0x00, 0xda, 0x69, 0x64, 0x63, 0x5f, 0x5f, 0x72, 0x65, 0x71,
+                0x75, 0x65, 0x73, 0x74, 0x73, 0x0e, 0x00, 0xab, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x5f, 0x68, 0x69, 0x27, 0x00,
+                0x04, 0x19, 0x00, 0xff, 0x14, 0x6d, 0x69, 0x73, 0x73, 0x00, 0x6c, 0x31, 0x74, 0x65, 0x78, 0x5f, 0x5f, 0x64, 0x61, 0x74,
+                0x61, 0x5f, 0x70, 0x69, 0x70, 0x65, 0x5f, 0x6c, 0x73, 0x75, 0x5f, 0x77, 0x61, 0x76, 0x65, 0x66, 0x72, 0x6f, 0x6e, 0x74,
+                0x20, 0x00, 0x0e, 0x7f, 0x5f, 0x6d, 0x65, 0x6d, 0x5f, 0x6c, 0x67, 0x27, 0x00, 0x12, 0x6f, 0x73, 0x68, 0x61, 0x72, 0x65,
+                0x64, 0x2b, 0x00, 0x13, 0x6e, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x2c, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x9e, 0x00, 0x09,
+                0x0a, 0x20, 0x00, 0x0f, 0x4c, 0x00, 0x19, 0x01, 0x2c, 0x00, 0x65, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x2c, 0x00, 0x01,
+                0x9a, 0x00, 0x84, 0x72, 0x69, 0x74, 0x65, 0x62, 0x61, 0x63, 0x6b, 0x86, 0x01, 0x06, 0x1c, 0x00, 0x26, 0x69, 0x6e, 0x7b,
+                0x01, 0x03, 0x16, 0x00, 0x01, 0x54, 0x00, 0x0f, 0x32, 0x00, 0x04, 0x54, 0x74, 0x65, 0x78, 0x69, 0x6e, 0xd3, 0x01, 0xf9,
+                0x00, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x65, 0x64, 0x5f, 0x6f, 0x6e, 0x5f, 0x74, 0x73, 0x6c, 0x31, 0x8d, 0x01, 0x02, 0x29,
+                0x00, 0x0f, 0x5b, 0x00, 0x00, 0x60, 0x69, 0x6e, 0x5f, 0x73, 0x6d, 0x32, 0x0e, 0x00, 0x3b, 0x72, 0x65, 0x71, 0x1d, 0x02,
+                0x3d, 0x6c, 0x74, 0x73, 0x56, 0x02, 0x40, 0x70, 0x63, 0x69, 0x65, 0xf8, 0x01, 0x83, 0x61, 0x64, 0x5f, 0x62, 0x79, 0x74,
+                0x65, 0x73, 0x11, 0x00, 0x01, 0xa1, 0x00, 0x04, 0x12, 0x00, 0x60, 0x64, 0x61, 0x5f, 0x5f, 0x69, 0x6e, 0xce, 0x02, 0x49,
+                0x70, 0x72, 0x69, 0x6d, 0x11, 0x00, 0xf4, 0x02, 0x76, 0x65, 0x72, 0x74, 0x73, 0x00, 0x70, 0x65, 0x73, 0x5f, 0x5f, 0x73,
+                0x74, 0x72, 0x65, 0x61, 0x6d, 0xf8, 0x02, 0x4f, 0x61, 0x74, 0x74, 0x72, 0x19, 0x00, 0x02, 0x03, 0x43, 0x00, 0x0e, 0x19,
+                0x00, 0x03, 0x4b, 0x00, 0xb3, 0x72, 0x6f, 0x70, 0x5f, 0x5f, 0x65, 0x61, 0x72, 0x6c, 0x79, 0x7a, 0x64, 0x00, 0x50, 0x73,
+                0x61, 0x6d, 0x70, 0x6c, 0x88, 0x00, 0x08, 0x1b, 0x00, 0x21, 0x6b, 0x69, 0x1c, 0x01, 0x01, 0x3f, 0x03, 0x10, 0x73, 0xc0,
+                0x00, 0x10, 0x6c, 0x1b, 0x03, 0x0f, 0x24, 0x00, 0x02, 0x0f, 0x40, 0x00, 0x02, 0x03, 0x75, 0x00, 0x0a, 0x1c, 0x00, 0x03,
+                0xe5, 0x00, 0x02, 0x54, 0x00, 0x01, 0xb6, 0x03, 0x2c, 0x33, 0x64, 0x5c, 0x00, 0x4f, 0x6c, 0x61, 0x74, 0x65, 0x5b, 0x00,
+                0x04, 0x02, 0x1b, 0x00, 0x0f, 0x5a, 0x00, 0x02, 0x00, 0x06, 0x00, 0x70, 0x32, 0x78, 0x62, 0x61, 0x72, 0x5f, 0x63, 0x10,
+                0x00, 0x0f, 0xb7, 0x00, 0x03, 0x06, 0x25, 0x00, 0x1f, 0x7a, 0x25, 0x00, 0x01, 0xdb, 0x72, 0x61, 0x73, 0x74, 0x65, 0x72,
+                0x5f, 0x5f, 0x7a, 0x63, 0x75, 0x6c, 0x6c, 0x1c, 0x01, 0x0f, 0x1c, 0x00, 0x08, 0xcf, 0x5f, 0x6f, 0x70, 0x5f, 0x61, 0x63,
+                0x63, 0x65, 0x70, 0x74, 0x65, 0x64, 0x28, 0x00, 0x0d, 0x50, 0x72, 0x65, 0x6a, 0x65, 0x63, 0x28, 0x00, 0x10, 0x73, 0xe4,
+                0x04, 0x25, 0x74, 0x61, 0x3b, 0x02, 0x01, 0x10, 0x00, 0x09, 0x4d, 0x02, 0x0d, 0x12, 0x00, 0x04, 0xc5, 0x04, 0x28, 0x63,
+                0x73, 0x1c, 0x00, 0x04, 0x68, 0x02, 0x00, 0x13, 0x00, 0xa4, 0x69, 0x6e, 0x73, 0x74, 0x5f, 0x65, 0x78, 0x65, 0x63, 0x75,
+                0x63, 0x00, 0x09, 0x12, 0x00, 0x02, 0x73, 0x03, 0x3f, 0x61, 0x64, 0x75, 0x1b, 0x00, 0x06, 0x1f, 0x6c, 0x1b, 0x00, 0x06,
+                0x2f, 0x63, 0x62, 0x1b, 0x00, 0x06, 0x3f, 0x66, 0x6d, 0x61, 0x1b, 0x00, 0x06, 0x3f, 0x70, 0x31, 0x36, 0x1c, 0x00, 0x07,
+                0x2f, 0x36, 0x34, 0x1c, 0x00, 0x05, 0x2f, 0x69, 0x70, 0x53, 0x00, 0x06, 0x2f, 0x6c, 0x73, 0x89, 0x00, 0x06, 0x6f, 0x74,
+                0x65, 0x6e, 0x73, 0x6f, 0x72, 0x1e, 0x00, 0x07, 0x1f, 0x78, 0x1b, 0x00, 0x05, 0x7f, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72,
+                0x6d, 0x1f, 0x00, 0x05, 0x13, 0x78, 0x72, 0x00, 0x48, 0x73, 0x73, 0x75, 0x65, 0x9e, 0x01, 0x6e, 0x6d, 0x69, 0x6f, 0x32,
+                0x72, 0x66, 0x6c, 0x04, 0x03, 0x1c, 0x00, 0x32, 0x5f, 0x70, 0x71, 0xf8, 0x03, 0x0e, 0xd8, 0x01, 0x0f, 0x1e, 0x00, 0x06,
+                0x0a, 0xe4, 0x00, 0x0f, 0x27, 0x00, 0x0c, 0x04, 0xd2, 0x00, 0x03, 0x27, 0x00, 0x02, 0x53, 0x04, 0x0e, 0x6d, 0x00, 0xf3,
+                0x00, 0x70, 0x73, 0x5f, 0x71, 0x75, 0x61, 0x64, 0x73, 0x5f, 0x6c, 0x61, 0x75, 0x6e, 0x63, 0x68, 0x1a, 0x02, 0x21, 0x74,
+                0x68, 0x57, 0x00, 0x0f, 0x06, 0x02, 0x03, 0x31, 0x5f, 0x70, 0x72, 0x18, 0x05, 0x0f, 0x2a, 0x00, 0x0c, 0x3f, 0x66, 0x6d,
+                0x61, 0x2a, 0x00, 0x15, 0x3f, 0x70, 0x31, 0x36, 0x2b, 0x00, 0x16, 0x2f, 0x36, 0x34, 0x2b, 0x00, 0x14, 0x2f, 0x69, 0x70,
+                0x80, 0x00, 0x15, 0x00, 0x46, 0x06, 0x0f, 0x2a, 0x00, 0x13, 0x1f, 0x78, 0x29, 0x00, 0x01, 0x0f, 0x3c, 0x01, 0x02, 0x06,
+                0x15, 0x00, 0x0b, 0x9a, 0x03, 0x0f, 0x1f, 0x00, 0x05, 0x1f, 0x67, 0x1f, 0x00, 0x0b, 0x1f, 0x70, 0x1f, 0x00, 0x0d, 0x01,
+                0x15, 0x05, 0x8f, 0x6d, 0x61, 0x73, 0x6b, 0x5f, 0x6f, 0x66, 0x66, 0x2c, 0x00, 0x0a, 0x1f, 0x74, 0x8a, 0x00, 0x0c, 0x00,
+                0x76, 0x06, 0x0f, 0x20, 0x00, 0x09, 0x12, 0x76, 0x1f, 0x00, 0x49, 0x77, 0x61, 0x72, 0x70, 0x4b, 0x02, 0x02, 0x11, 0x00,
+                0x09, 0x0c, 0x01, 0x0a, 0x13, 0x00, 0x0b, 0x0a, 0x01, 0x0f, 0x1d, 0x00, 0x03, 0x03, 0x08, 0x01, 0x0f, 0x1d, 0x00, 0x03,
+                0x03, 0x06, 0x01, 0x0f, 0x1d, 0x00, 0x03, 0x04, 0xd8, 0x00, 0x0f, 0x1e, 0x00, 0x04, 0x03, 0xd6, 0x00, 0x0f, 0x1e, 0x00,
+                0x03, 0x01, 0xd4, 0x00, 0x11, 0x73, 0x85, 0x06, 0x0a, 0x26, 0x05, 0x0d, 0x14, 0x00, 0x09, 0xc5, 0x00, 0x0f, 0x1e, 0x00,
+                0x06, 0x01, 0xc6, 0x00, 0x0f, 0x1e, 0x00, 0x06, 0x01, 0xc7, 0x00, 0x0f, 0x1e, 0x00, 0x06, 0x02, 0xc8, 0x00, 0x0f, 0x1f,
+                0x00, 0x07, 0x01, 0xc9, 0x00, 0x0f, 0x1f, 0x00, 0x06, 0x05, 0xca, 0x00, 0x0f, 0xc6, 0x02, 0x01, 0x0f, 0x1b, 0x00, 0x08,
+                0x03, 0xd9, 0x02, 0x01, 0x3c, 0x02, 0x0f, 0x24, 0x00, 0x0c, 0x00, 0xfd, 0x02, 0x00, 0x23, 0x00, 0x0b, 0x02, 0x02, 0x06,
+                0x13, 0x00, 0x7a, 0x65, 0x6c, 0x69, 0x67, 0x69, 0x62, 0x6c, 0x15, 0x00, 0x02, 0x22, 0x05, 0x04, 0x57, 0x09, 0x03, 0x6d,
+                0x0b, 0x0f, 0x22, 0x00, 0x09, 0xff, 0x00, 0x72, 0x61, 0x6e, 0x63, 0x68, 0x5f, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x76, 0x69,
+                0x6e, 0x67, 0x2b, 0x00, 0x08, 0x05, 0x74, 0x0b, 0x01, 0x11, 0x00, 0x0f, 0x29, 0x00, 0x09, 0x3a, 0x72, 0x61, 0x69, 0xbe,
+                0x00, 0x0a, 0x20, 0x00, 0x32, 0x69, 0x6d, 0x63, 0xe9, 0x09, 0x0f, 0x23, 0x00, 0x07, 0x20, 0x6c, 0x67, 0x1b, 0x01, 0x3f,
+                0x6f, 0x74, 0x74, 0xdf, 0x00, 0x0a, 0xe4, 0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x62, 0x6f, 0x61,
+                0x72, 0x78, 0x01, 0x0f, 0x2a, 0x00, 0x01, 0x43, 0x6d, 0x61, 0x74, 0x68, 0xb2, 0x05, 0x0f, 0x57, 0x00, 0x0f, 0x5f, 0x6d,
+                0x65, 0x6d, 0x62, 0x61, 0x35, 0x01, 0x09, 0x00, 0xee, 0x05, 0x0f, 0x48, 0x00, 0x11, 0x3f, 0x69, 0x73, 0x63, 0x1f, 0x00,
+                0x08, 0x21, 0x6e, 0x6f, 0xf8, 0x01, 0x31, 0x72, 0x75, 0x63, 0xe9, 0x0c, 0x0f, 0x29, 0x00, 0x09, 0x54, 0x74, 0x5f, 0x73,
+                0x65, 0x6c, 0xb6, 0x08, 0x0f, 0x27, 0x00, 0x05, 0x0f, 0x23, 0x00, 0x11, 0x4f, 0x68, 0x6f, 0x72, 0x74, 0x32, 0x01, 0x13,
+                0x5f, 0x73, 0x6c, 0x65, 0x65, 0x70, 0x11, 0x02, 0x0b, 0x00, 0x82, 0x0b, 0x0f, 0x07, 0x01, 0x10, 0x49, 0x77, 0x61, 0x69,
+                0x74, 0x1f, 0x00, 0x06, 0xbd, 0x04, 0x1e, 0x79, 0xad, 0x0b, 0x17, 0x74, 0x17, 0x0e, 0x0a, 0x75, 0x09, 0x13, 0x33, 0x1d,
+                0x00, 0x02, 0x09, 0x0c, 0x06, 0x4b, 0x0d, 0x02, 0xcc, 0x0c, 0x54, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0xd0, 0x0b, 0x70, 0x5f,
+                0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x0d, 0x01, 0x0f, 0x33, 0x00, 0x08, 0x3f, 0x69, 0x73, 0x62, 0x30, 0x00, 0x1a, 0x10,
+                0x74, 0x17, 0x0f, 0x0f, 0x30, 0x00, 0x02, 0x50, 0x70, 0x65, 0x32, 0x73, 0x6d, 0x1f, 0x06, 0x01, 0x23, 0x00, 0x03, 0x1d,
+                0x00, 0x2c, 0x69, 0x6f, 0xe7, 0x0c, 0x08, 0x2d, 0x00, 0x32, 0x76, 0x74, 0x67, 0x81, 0x00, 0x0f, 0x2e, 0x00, 0x0c, 0xa0,
+                0x73, 0x6d, 0x5f, 0x72, 0x66, 0x5f, 0x72, 0x65, 0x67, 0x69, 0xd6, 0x0a, 0x0d, 0x7a, 0x00, 0x0f, 0x1f, 0x00, 0x06, 0x07,
+                0x42, 0x05, 0x0f, 0x29, 0x00, 0x13, 0x1f, 0x70, 0x29, 0x00, 0x15, 0x32, 0x76, 0x74, 0x67, 0x2a, 0x00, 0x00, 0xce, 0x01,
+                0x03, 0xcd, 0x01, 0x0c, 0xd0, 0x0d, 0x05, 0x7d, 0x00, 0x00, 0x3a, 0x09, 0x10, 0x73, 0xdb, 0x00, 0x27, 0x74, 0x61, 0xea,
+                0x00, 0x0f, 0x40, 0x00, 0x1f, 0x04, 0x90, 0x00, 0x0f, 0x45, 0x00, 0x2a, 0x20, 0x73, 0x68, 0xd3, 0x01, 0x0f, 0x42, 0x00,
+                0x29, 0x01, 0x2c, 0x00, 0x0f, 0x41, 0x00, 0x1f, 0x13, 0x67, 0x5c, 0x01, 0x0f, 0x2a, 0x00, 0x0f, 0x04, 0x86, 0x01, 0x0f,
+                0x2a, 0x00, 0x11, 0x04, 0x95, 0x00, 0x32, 0x6f, 0x6f, 0x6f, 0x30, 0x00, 0x00, 0x04, 0x03, 0x2f, 0x6c, 0x65, 0x99, 0x00,
+                0x19, 0x06, 0x45, 0x00, 0x0f, 0x61, 0x01, 0x28, 0x06, 0x45, 0x00, 0x0f, 0x1f, 0x01, 0x24, 0x00, 0x8c, 0x07, 0x0f, 0x2b,
+                0x00, 0x15, 0x1f, 0x65, 0x2b, 0x00, 0x16, 0x1f, 0x76, 0x2a, 0x00, 0x17, 0x08, 0xd2, 0x02, 0x0e, 0xec, 0x0d, 0x06, 0x9f,
+                0x0e, 0x0f, 0x25, 0x00, 0x06, 0x02, 0x03, 0x01, 0x0f, 0x25, 0x00, 0x0c, 0x00, 0xf3, 0x03, 0x05, 0x26, 0x00, 0x11, 0x76,
+                0xe8, 0x04, 0x39, 0x6c, 0x69, 0x70, 0x77, 0x10, 0x0f, 0x16, 0x00, 0x02, 0x00, 0xb6, 0x0e, 0x00, 0x14, 0x00, 0x37, 0x70,
+                0x65, 0x64, 0x21, 0x00, 0x09, 0x6c, 0x10, 0x02, 0x17, 0x00, 0x06, 0xf0, 0x0e, 0x0f, 0x16, 0x00, 0x08, 0x01, 0x4e, 0x00,
+                0x11, 0x75, 0x61, 0x04, 0x0f, 0x20, 0x00, 0x06, 0x30, 0x70, 0x61, 0x73, 0x8c, 0x05, 0x01, 0x20, 0x00, 0x0d, 0x51, 0x00,
+                0x09, 0xfe, 0x10, 0x08, 0x12, 0x00, 0x02, 0x24, 0x00, 0x08, 0x65, 0x13, 0x00, 0x76, 0x13, 0x45, 0x5f, 0x72, 0x61, 0x74,
+                0xfd, 0x11, 0x80, 0x61, 0x76, 0x65, 0x72, 0x61, 0x67, 0x65, 0x5f, 0xd1, 0x06, 0x46, 0x63, 0x74, 0x6f, 0x72, 0x6d, 0x0d,
+                0x0f, 0x21, 0x00, 0x0d, 0x08, 0xc8, 0x13, 0x0f, 0x2c, 0x00, 0x0e, 0x00, 0xe7, 0x03, 0x61, 0x67, 0x6c, 0x6f, 0x62, 0x61,
+                0x6c, 0x1a, 0x10, 0x3f, 0x74, 0x6f, 0x6d, 0x34, 0x00, 0x21, 0x0f, 0x73, 0x00, 0x28, 0x15, 0x6c, 0xe1, 0x13, 0x0f, 0x32,
+                0x00, 0x17, 0x0f, 0x6f, 0x00, 0x28, 0x07, 0x51, 0x14, 0x0f, 0x33, 0x00, 0x18, 0x0f, 0x71, 0x00, 0x28, 0x1f, 0x73, 0x32,
+                0x00, 0x20, 0x0f, 0x6f, 0x00, 0x1e, 0x00, 0x47, 0x04, 0x0f, 0x4e, 0x01, 0x1a, 0x07, 0x31, 0x00, 0x0f, 0x6d, 0x00, 0x27,
+                0x0f, 0xdb, 0x00, 0x15, 0x07, 0x31, 0x00, 0x0f, 0x6d, 0x00, 0x16, 0x00, 0x2f, 0x10, 0x0f, 0x21, 0x00, 0x0d, 0x10, 0x5f,
+                0x08, 0x11, 0x7f, 0x61, 0x74, 0x5f, 0x31, 0x64, 0x5f, 0x32, 0xf8, 0x00, 0x0c, 0x0c, 0x2e, 0x00, 0x0f, 0x88, 0x00, 0x19,
+                0x07, 0x39, 0x00, 0x6f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x32, 0x00, 0x1f, 0x0f, 0x6f, 0x00, 0x21, 0x10, 0x32, 0xcf,
+                0x0a, 0x6f, 0x6d, 0x69, 0x70, 0x6d, 0x61, 0x70, 0x34, 0x00, 0x21, 0x0f, 0x73, 0x00, 0x21, 0x1f, 0x33, 0x46, 0x01, 0x17,
+                0x1f, 0x33, 0x43, 0x01, 0x22, 0x4f, 0x63, 0x75, 0x62, 0x65, 0xd0, 0x00, 0x19, 0x03, 0x30, 0x00, 0x0f, 0x6b, 0x00, 0x1a,
+                0x0f, 0x2c, 0x00, 0x19, 0x0f, 0xef, 0x17, 0x00, 0x0f, 0x2d, 0x00, 0x12, 0x0f, 0x65, 0x00, 0x25, 0x0f, 0x64, 0x05, 0x13,
+                0x0f, 0x35, 0x00, 0x04, 0x0f, 0x75, 0x00, 0x29, 0x0f, 0x18, 0x04, 0x0d, 0x0f, 0x33, 0x00, 0x02, 0x0f, 0x71, 0x00, 0x29,
+                0x0f, 0x68, 0x05, 0x0e, 0x0f, 0x34, 0x00, 0x03, 0x0f, 0x73, 0x00, 0x29, 0x0f, 0x8f, 0x04, 0x0d, 0x0f, 0x33, 0x00, 0x02,
+                0x0f, 0x71, 0x00, 0x1e, 0x0b, 0xf2, 0x19, 0x0f, 0x2d, 0x00, 0x12, 0x0f, 0x65, 0x00, 0x25, 0x0f, 0xba, 0x01, 0x19, 0x09,
+                0x33, 0x00, 0x0f, 0x71, 0x00, 0x29, 0x0f, 0x7a, 0x05, 0x12, 0x0e, 0x34, 0x00, 0x0f, 0x73, 0x00, 0x00, 0x05, 0x37, 0x00,
+                0x06, 0xdc, 0x08, 0x00, 0x74, 0x1a, 0x0d, 0x56, 0x00, 0x41, 0x61, 0x70, 0x65, 0x72, 0x4a, 0x00, 0x40, 0x64, 0x65, 0x76,
+                0x69, 0x8a, 0x03, 0x0f, 0x26, 0x00, 0x11, 0x09, 0x70, 0x00, 0x0f, 0x31, 0x00, 0x12, 0x05, 0x7c, 0x03, 0x0f, 0x2e, 0x00,
+                0x19, 0x0f, 0x67, 0x00, 0x22, 0x00, 0xaa, 0x12, 0x0f, 0x2e, 0x00, 0x1b, 0x0f, 0x67, 0x00, 0x24, 0x0f, 0x66, 0x00, 0x1a,
+                0x0f, 0x65, 0x00, 0x23, 0x01, 0xa9, 0x17, 0x0f, 0x2f, 0x00, 0x1c, 0x0f, 0x69, 0x00, 0x18, 0x20, 0x70, 0x65, 0x50, 0x07,
+                0x0f, 0x24, 0x00, 0x0f, 0x0f, 0x53, 0x00, 0x1c, 0x0f, 0xed, 0x01, 0x15, 0x08, 0x2c, 0x00, 0x0f, 0x63, 0x00, 0x20, 0x0f,
+                0xe9, 0x01, 0x11, 0x08, 0x2c, 0x00, 0x0f, 0x63, 0x00, 0x22, 0x0f, 0x62, 0x00, 0x18, 0x0f, 0x61, 0x00, 0x21, 0x0f, 0xe1,
+                0x01, 0x12, 0x09, 0x2d, 0x00, 0x0f, 0x65, 0x00, 0x18, 0x5f, 0x73, 0x79, 0x73, 0x6d, 0x65, 0x86, 0x01, 0x0e, 0x02, 0x26,
+                0x00, 0x0f, 0x57, 0x00, 0x1e, 0x0f, 0xe5, 0x01, 0x15, 0x0a, 0x2e, 0x00, 0x0f, 0x67, 0x00, 0x22, 0x0f, 0xe9, 0x01, 0x11,
+                0x0a, 0x2e, 0x00, 0x0f, 0x67, 0x00, 0x24, 0x0f, 0x66, 0x00, 0x1a, 0x0f, 0x65, 0x00, 0x23, 0x0f, 0xf1, 0x01, 0x12, 0x0b,
+                0x2f, 0x00, 0x0f, 0x69, 0x00, 0x0f, 0x0f, 0x8c, 0x01, 0x0b, 0x0f, 0x7c, 0x01, 0x16, 0x0f, 0x6c, 0x01, 0x0b, 0x0f, 0x5c,
+                0x01, 0x16, 0x0f, 0x4c, 0x01, 0x0a, 0x0f, 0x3c, 0x01, 0x15, 0x0f, 0x2c, 0x01, 0x0c, 0x0f, 0x1c, 0x01, 0x17, 0xbf, 0x73,
+                0x72, 0x63, 0x6e, 0x6f, 0x64, 0x65, 0x5f, 0x66, 0x62, 0x70, 0x22, 0x00, 0x0f, 0x0f, 0x0f, 0x07, 0x14, 0x0f, 0x32, 0x00,
+                0x08, 0x0f, 0x91, 0x00, 0x1a, 0x0f, 0xc0, 0x06, 0x1c, 0x0f, 0x3a, 0x00, 0x10, 0x0f, 0x7f, 0x00, 0x2e, 0x0f, 0x75, 0x01,
+                0x09, 0x0f, 0x3b, 0x00, 0x11, 0x0f, 0x81, 0x00, 0x24, 0x0f, 0x8b, 0x06, 0x08, 0x0f, 0x30, 0x00, 0x06, 0x0f, 0x6b, 0x00,
+                0x28, 0x0f, 0x69, 0x01, 0x21, 0x0f, 0x4c, 0x06, 0x1b, 0x0f, 0x43, 0x00, 0x0a, 0x0f, 0x65, 0x01, 0x1e, 0x0f, 0x03, 0x06,
+                0x1c, 0x0f, 0x44, 0x00, 0x02, 0x0f, 0x0f, 0x06, 0x0a, 0x0f, 0x32, 0x00, 0x08, 0x0f, 0x6f, 0x00, 0x2a, 0x0f, 0x69, 0x01,
+                0x21, 0x0f, 0xcc, 0x05, 0x1d, 0x0f, 0x45, 0x00, 0x0c, 0x0f, 0x6d, 0x01, 0x1e, 0x0f, 0x7f, 0x05, 0x1e, 0x08, 0x46, 0x00,
+                0x0f, 0x2d, 0x00, 0x16, 0x3f, 0x67, 0x70, 0x63, 0x22, 0x00, 0x0f, 0x0f, 0x90, 0x04, 0x1c, 0x0f, 0x32, 0x00, 0x00, 0x0f,
+                0x91, 0x00, 0x1a, 0x0f, 0xb7, 0x0b, 0x1c, 0x0f, 0x3a, 0x00, 0x10, 0x0f, 0x7f, 0x00, 0x2e, 0x0f, 0x3d, 0x02, 0x10, 0x0f,
+                0x3a, 0x00, 0x08, 0x0f, 0x7f, 0x00, 0x30, 0x0f, 0x7e, 0x00, 0x26, 0x0f, 0x7d, 0x00, 0x2f, 0x0f, 0xba, 0x02, 0x11, 0x0f,
+                0x3b, 0x00, 0x09, 0x0f, 0x81, 0x00, 0x24, 0x0f, 0x8c, 0x05, 0x10, 0x0d, 0x30, 0x00, 0x0f, 0x6b, 0x00, 0x28, 0x0f, 0x65,
+                0x02, 0x21, 0x0f, 0x3b, 0x0c, 0x1b, 0x0f, 0x43, 0x00, 0x0a, 0x0f, 0x61, 0x02, 0x1d, 0x0f, 0x07, 0x06, 0x23, 0x0f, 0x43,
+                0x00, 0x04, 0x0f, 0x7a, 0x00, 0x24, 0x0f, 0x79, 0x00, 0x2d, 0x0f, 0x59, 0x02, 0x1e, 0x0f, 0x80, 0x06, 0x24, 0x09, 0x44,
+                0x00, 0x0f, 0x80, 0x06, 0x12, 0x0f, 0x32, 0x00, 0x00, 0x0f, 0x6f, 0x00, 0x2a, 0x0f, 0x5d, 0x02, 0x21, 0x0f, 0xb3, 0x0c,
+                0x1d, 0x0f, 0x45, 0x00, 0x0c, 0x0f, 0x61, 0x02, 0x1d, 0x0f, 0xff, 0x06, 0x25, 0x0f, 0x45, 0x00, 0x06, 0x0f, 0x7e, 0x00,
+                0x26, 0x0f, 0x7d, 0x00, 0x2f, 0x0f, 0x69, 0x02, 0x1e, 0x0f, 0x7c, 0x07, 0x26, 0x00, 0x46, 0x00, 0x0f, 0x2d, 0x00, 0x16,
+                0x3f, 0x68, 0x75, 0x62, 0x5a, 0x07, 0x1c, 0x0f, 0x32, 0x00, 0x00, 0x0f, 0x6f, 0x00, 0x2a, 0x0f, 0x19, 0x02, 0x14, 0x0f,
+                0x3a, 0x00, 0x08, 0x0f, 0x7f, 0x00, 0x2e, 0x0f, 0x9c, 0x01, 0x11, 0x0f, 0x3b, 0x00, 0x09, 0x0f, 0x81, 0x00, 0x24, 0x0f,
+                0x5e, 0x06, 0x10, 0x0d, 0x30, 0x00, 0x0f, 0x6b, 0x00, 0x28, 0x0f, 0x69, 0x01, 0x21, 0x0f, 0xe3, 0x05, 0x23, 0x0f, 0x43,
+                0x00, 0x02, 0x0f, 0x65, 0x01, 0x1e, 0x0f, 0x6a, 0x05, 0x24, 0x09, 0x44, 0x00, 0x0f, 0x6a, 0x05, 0x12, 0x0f, 0x32, 0x00,
+                0x00, 0x0f, 0x6f, 0x00, 0x2a, 0x0f, 0x69, 0x01, 0x21, 0x0f, 0xeb, 0x04, 0x25, 0x0f, 0x45, 0x00, 0x04, 0x0f, 0x6d, 0x01,
+                0x1e, 0x0f, 0x6e, 0x04, 0x21, 0x41, 0x75, 0x6e, 0x69, 0x74, 0x3b, 0x30, 0x0f, 0x23, 0x00, 0x10, 0x0f, 0x65, 0x04, 0x17,
+                0x0f, 0x33, 0x00, 0x06, 0x0f, 0x94, 0x00, 0x1b, 0x0f, 0x67, 0x04, 0x1f, 0x0f, 0x3b, 0x00, 0x0e, 0x0f, 0x81, 0x00, 0x2f,
+                0x0f, 0x97, 0x01, 0x0c, 0x0f, 0x3c, 0x00, 0x0f, 0x0f, 0x83, 0x00, 0x25, 0x0f, 0x6b, 0x04, 0x0b, 0x0f, 0x31, 0x00, 0x04,
+                0x0f, 0x6d, 0x00, 0x29, 0x0f, 0x6f, 0x01, 0x22, 0x0f, 0x6e, 0x04, 0x1e, 0x0f, 0x44, 0x00, 0x08, 0x0f, 0x6b, 0x01, 0x1f,
+                0x0f, 0x70, 0x04, 0x1f, 0x0f, 0x45, 0x00, 0x00, 0x0f, 0x71, 0x04, 0x0d, 0x0f, 0x33, 0x00, 0x06, 0x0f, 0x71, 0x00, 0x2b,
+                0x0f, 0x6f, 0x01, 0x22, 0x0f, 0x74, 0x04, 0x20, 0x0f, 0x46, 0x00, 0x0a, 0x0f, 0x73, 0x01, 0x1f, 0x0f, 0x76, 0x04, 0x2a,
+                0x0f, 0x2e, 0x00, 0x17, 0x6f, 0x67, 0x70, 0x63, 0x6f, 0x74, 0x68, 0x02, 0x03, 0x0e, 0x04, 0x27, 0x00, 0x0f, 0xac, 0x04,
+                0x1c, 0x0f, 0x37, 0x00, 0x05, 0x0f, 0xa0, 0x00, 0x1f, 0x0f, 0xb4, 0x04, 0x24, 0x0f, 0x3f, 0x00, 0x0d, 0x0f, 0x89, 0x00,
+                0x33, 0x0f, 0xde, 0x01, 0x11, 0x0f, 0x40, 0x00, 0x0e, 0x0f, 0x8b, 0x00, 0x29, 0x0f, 0xc4, 0x04, 0x10, 0x0f, 0x35, 0x00,
+                0x03, 0x0f, 0x75, 0x00, 0x2d, 0x0f, 0x87, 0x01, 0x26, 0x0f, 0xd0, 0x04, 0x23, 0x0f, 0x48, 0x00, 0x07, 0x0f, 0x83, 0x01,
+                0x23, 0x0f, 0xd8, 0x04, 0x24, 0x0e, 0x49, 0x00, 0x0f, 0xdc, 0x04, 0x12, 0x0f, 0x37, 0x00, 0x05, 0x0f, 0x79, 0x00, 0x2f,
+                0x0f, 0x87, 0x01, 0x26, 0x0f, 0xe8, 0x04, 0x25, 0x0f, 0x4a, 0x00, 0x09, 0x0f, 0x8b, 0x01, 0x23, 0x0f, 0xf0, 0x04, 0x26,
+                0x05, 0x4b, 0x00, 0x0f, 0x32, 0x00, 0x16, 0x1f, 0x70, 0x9e, 0x00, 0x0d, 0x00, 0xb6, 0x36, 0x0f, 0xe8, 0x04, 0x1a, 0x0e,
+                0x31, 0x00, 0x0f, 0x8e, 0x00, 0x19, 0x0f, 0xdc, 0x04, 0x24, 0x0f, 0x39, 0x00, 0x07, 0x0f, 0x7d, 0x00, 0x2d, 0x0f, 0xc2,
+                0x01, 0x11, 0x0f, 0x3a, 0x00, 0x08, 0x0f, 0x7f, 0x00, 0x23, 0x0f, 0xc4, 0x04, 0x10, 0x0c, 0x2f, 0x00, 0x0f, 0x69, 0x00,
+                0x27, 0x0f, 0x63, 0x01, 0x20, 0x0f, 0xb2, 0x04, 0x23, 0x0f, 0x42, 0x00, 0x01, 0x0f, 0x5f, 0x01, 0x1d, 0x0f, 0xa6, 0x04,
+                0x24, 0x08, 0x43, 0x00, 0x0f, 0xa0, 0x04, 0x12, 0x0e, 0x31, 0x00, 0x0f, 0x6d, 0x00, 0x29, 0x0f, 0x63, 0x01, 0x20, 0x0f,
+                0x8e, 0x04, 0x25, 0x0f, 0x44, 0x00, 0x03, 0x0f, 0x67, 0x01, 0x1d, 0x0f, 0x82, 0x04, 0x26, 0x00, 0x49, 0x2b, 0x0f, 0x2c,
+                0x00, 0x15, 0x01, 0xbc, 0x25, 0x0f, 0x22, 0x00, 0x0d, 0x0f, 0x7e, 0x04, 0x1c, 0x0f, 0x32, 0x00, 0x00, 0x0f, 0x91, 0x00,
+                0x1a, 0x0f, 0xd1, 0x19, 0x1f, 0x0f, 0x3a, 0x00, 0x0d, 0x0f, 0x7f, 0x00, 0x2e, 0x0f, 0x39, 0x02, 0x10, 0x0f, 0x3a, 0x00,
+                0x08, 0x0f, 0x7f, 0x00, 0x30, 0x0f, 0x7e, 0x00, 0x26, 0x0f, 0x7d, 0x00, 0x2f, 0x0f, 0xb8, 0x02, 0x11, 0x0f, 0x3b, 0x00,
+                0x09, 0x0f, 0x81, 0x00, 0x24, 0x0f, 0x80, 0x05, 0x10, 0x0d, 0x30, 0x00, 0x0f, 0x6b, 0x00, 0x28, 0x0f, 0x65, 0x02, 0x21,
+                0x0f, 0xd1, 0x19, 0x1e, 0x0f, 0x43, 0x00, 0x07, 0x0f, 0x61, 0x02, 0x1d, 0x0f, 0xfe, 0x05, 0x23, 0x0f, 0x43, 0x00, 0x04,
+                0x0f, 0x7a, 0x00, 0x24, 0x0f, 0x79, 0x00, 0x2d, 0x0f, 0x59, 0x02, 0x1e, 0x0f, 0x79, 0x06, 0x24, 0x09, 0x44, 0x00, 0x0f,
+                0x7a, 0x06, 0x12, 0x0f, 0x32, 0x00, 0x00, 0x0f, 0x6f, 0x00, 0x2a, 0x0f, 0x5d, 0x02, 0x21, 0x0f, 0xd1, 0x19, 0x20, 0x0f,
+                0x45, 0x00, 0x09, 0x0f, 0x61, 0x02, 0x1d, 0x0f, 0xfc, 0x06, 0x25, 0x0f, 0x45, 0x00, 0x06, 0x0f, 0x7e, 0x00, 0x26, 0x0f,
+                0x7d, 0x00, 0x2f, 0x0f, 0x69, 0x02, 0x1e, 0x0f, 0x7b, 0x07, 0x26, 0x0c, 0xd7, 0x2c, 0x0f, 0x2d, 0x00, 0x0a, 0x00, 0xa6,
+                0x45, 0x0f, 0x23, 0x00, 0x10, 0x0f, 0x7e, 0x07, 0x1c, 0x0f, 0x33, 0x00, 0x01, 0x0f, 0x94, 0x00, 0x1b, 0x0f, 0x01, 0x07,
+                0x24, 0x0f, 0x3b, 0x00, 0x09, 0x0f, 0x81, 0x00, 0x2f, 0x0f, 0xc4, 0x01, 0x11, 0x0f, 0x3c, 0x00, 0x0a, 0x0f, 0x83, 0x00,
+                0x25, 0x0f, 0x88, 0x06, 0x10, 0x0e, 0x31, 0x00, 0x0f, 0x6d, 0x00, 0x29, 0x0f, 0x6f, 0x01, 0x22, 0x0f, 0x10, 0x06, 0x23,
+                0x0f, 0x44, 0x00, 0x03, 0x0f, 0x6b, 0x01, 0x1f, 0x0f, 0x99, 0x05, 0x24, 0x0a, 0x45, 0x00, 0x0f, 0x9a, 0x05, 0x12, 0x0f,
+                0x33, 0x00, 0x01, 0x0f, 0x71, 0x00, 0x2b, 0x0f, 0x6f, 0x01, 0x22, 0x0f, 0x1e, 0x05, 0x25, 0x0f, 0x46, 0x00, 0x05, 0x0f,
+                0x73, 0x01, 0x1f, 0x0f, 0xa3, 0x04, 0x26, 0x01, 0x47, 0x00, 0x0c, 0x2e, 0x00, 0x0e, 0x79, 0x31, 0x02, 0x55, 0x40, 0x71,
+                0x61, 0x6d, 0x6f, 0x72, 0x74, 0x69, 0x7a, 0x6a, 0x40, 0x01, 0xea, 0x3b, 0x61, 0x74, 0x65, 0x6e, 0x63, 0x79, 0x00, 0xd4,
+                0x15, 0x01, 0xa0, 0x40, 0x72, 0x75, 0x67, 0x68, 0x70, 0x75, 0x74, 0x00, 0xd6, 0x4e, 0x01, 0x0c, 0x01, 0x0d, 0x16, 0x00,
+                0x0d, 0x11, 0x00, 0x02, 0xb1, 0x00, 0x07, 0x17, 0x00, 0x03, 0xfe, 0x31, 0x12, 0x6d, 0x1c, 0x40, 0x02, 0xc3, 0x4a, 0x0f,
+                0x1f, 0x00, 0x16, 0x0d, 0xe7, 0x3a, 0x0f, 0x28, 0x00, 0x0a, 0x07, 0xac, 0x32, 0x20, 0x6d, 0x5f, 0x22, 0x00, 0x12, 0x32,
+                0x0e, 0x00, 0x0f, 0x6f, 0x00, 0x01, 0x0f, 0x1f, 0x00, 0x02, 0x0f, 0x6f, 0x00, 0x00, 0x0f, 0x28, 0x00, 0x08, 0x07, 0x6f,
+                0x00, 0x08, 0x62, 0x00, 0x01, 0x73, 0x01, 0x06, 0x10, 0x00, 0x02, 0x34, 0x4d, 0x08, 0x11, 0x00, 0x00, 0x22, 0x4d, 0x08,
+                0x10, 0x00, 0x00, 0xef, 0x4c, 0x08, 0x10, 0x00, 0x0c, 0x80, 0x01, 0x04, 0x98, 0x4b, 0x07, 0x13, 0x00, 0x03, 0x01, 0x47,
+                0x04, 0x0f, 0x00, 0x39, 0x76, 0x61, 0x66, 0x10, 0x00, 0x01, 0x07, 0x02, 0x08, 0x11, 0x00, 0xf6, 0x11, 0x0a, 0x3c, 0x68,
+                0x74, 0x6d, 0x6c, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74,
+                0x3d, 0x22, 0x75, 0x74, 0x66, 0x2d, 0x38, 0x22, 0x2f, 0x1a, 0x00, 0xf2, 0x10, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x76,
+                0x69, 0x65, 0x77, 0x70, 0x6f, 0x72, 0x74, 0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x77, 0x69,
+                0x64, 0x74, 0x68, 0x3d, 0x78, 0x05, 0x11, 0x2d, 0x0d, 0x00, 0xf0, 0x02, 0x2c, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61,
+                0x6c, 0x2d, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x3d, 0x31, 0x48, 0x00, 0x00, 0x49, 0x00, 0x40, 0x68, 0x65, 0x61, 0x64, 0x52,
+                0x00, 0xf2, 0x07, 0x20, 0x20, 0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x4d, 0x79, 0x52, 0x61, 0x6e, 0x67, 0x65, 0x4e,
+                0x61, 0x6d, 0x65, 0x3c, 0x2f, 0x13, 0x00, 0x00, 0x29, 0x00, 0xf0, 0x00, 0x20, 0x20, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65,
+                0x20, 0x69, 0x64, 0x3d, 0x22, 0x52, 0x65, 0x71, 0x00, 0x10, 0x53, 0x10, 0x00, 0x13, 0x22, 0x1e, 0x00, 0x93, 0x20, 0x20,
+                0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x7b, 0x0e, 0x00, 0xf5, 0x03, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69,
+                0x7a, 0x65, 0x3a, 0x20, 0x31, 0x34, 0x70, 0x78, 0x3b, 0x19, 0x00, 0xe6, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20,
+                0x32, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x18, 0x00, 0xa1, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x63, 0x6f, 0x6c, 0x27,
+                0x43, 0x24, 0x3a, 0x20, 0x0a, 0x00, 0x0c, 0x23, 0x00, 0xc4, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69,
+                0x64, 0x20, 0x1c, 0x00, 0x1a, 0x7d, 0x87, 0x00, 0x27, 0x74, 0x68, 0x8a, 0x00, 0x04, 0x71, 0x00, 0x1f, 0x30, 0x71, 0x00,
+                0x39, 0x20, 0x20, 0x20, 0x8c, 0x4b, 0xb0, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x23, 0x46, 0x38, 0x02, 0x00,
+                0x0f, 0x8e, 0x00, 0x05, 0x1f, 0x64, 0x8e, 0x00, 0x4d, 0x0c, 0x71, 0x00, 0x7f, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x74, 0x72,
+                0x7a, 0x00, 0x59, 0x11, 0x2e, 0x7b, 0x00, 0x00, 0x94, 0x02, 0x07, 0x73, 0x00, 0xff, 0x01, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+                0x3a, 0x20, 0x44, 0x61, 0x72, 0x6b, 0x47, 0x72, 0x65, 0x65, 0x6e, 0x75, 0x00, 0x01, 0x00, 0x21, 0x00, 0x5f, 0x42, 0x6c,
+                0x61, 0x63, 0x6b, 0x5b, 0x01, 0x12, 0x03, 0x59, 0x02, 0xce, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x62, 0x6f,
+                0x6c, 0x64, 0x8b, 0x00, 0x67, 0x73, 0x75, 0x62, 0x68, 0x64, 0x72, 0x88, 0x00, 0x0f, 0xac, 0x01, 0x11, 0x37, 0x2e, 0x63,
+                0x61, 0x32, 0x00, 0x00, 0x24, 0x37, 0xee, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65,
+                0x72, 0x31, 0x00, 0x1f, 0x6c, 0x31, 0x00, 0x05, 0x4e, 0x6c, 0x65, 0x66, 0x74, 0x2f, 0x00, 0x1f, 0x72, 0x2f, 0x00, 0x05,
+                0x10, 0x72, 0xcc, 0x00, 0x0e, 0x30, 0x00, 0x27, 0x77, 0x77, 0x30, 0x00, 0xf0, 0x02, 0x77, 0x6f, 0x72, 0x64, 0x2d, 0x77,
+                0x72, 0x61, 0x70, 0x3a, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x2d, 0x11, 0x00, 0x0e, 0x34, 0x00, 0x10, 0x66, 0xea, 0x40,
+                0x0b, 0x85, 0x01, 0x32, 0x6d, 0x69, 0x6e, 0x06, 0x04, 0x58, 0x3a, 0x20, 0x31, 0x35, 0x30, 0x8b, 0x03, 0x03, 0x16, 0x00,
+                0x48, 0x33, 0x33, 0x76, 0x77, 0xa0, 0x03, 0x14, 0x78, 0x2f, 0x00, 0xfe, 0x03, 0x63, 0x61, 0x6c, 0x63, 0x28, 0x39, 0x32,
+                0x76, 0x77, 0x20, 0x2d, 0x20, 0x39, 0x32, 0x30, 0x70, 0x78, 0x29, 0x72, 0x00, 0x3f, 0x62, 0x61, 0x73, 0xf7, 0x03, 0x04,
+                0x18, 0x38, 0x6b, 0x00, 0x03, 0xe9, 0x01, 0x30, 0x23, 0x36, 0x30, 0x02, 0x00, 0x0f, 0x08, 0x02, 0x12, 0x07, 0x9a, 0x01,
+                0x3f, 0x6f, 0x6d, 0x70, 0x64, 0x00, 0x17, 0x8d, 0x73, 0x74, 0x65, 0x65, 0x6c, 0x62, 0x6c, 0x75, 0xc0, 0x02, 0x0f, 0x66,
+                0x00, 0x0c, 0x00, 0x84, 0x48, 0x6b, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0xcb, 0x04, 0x04, 0xbc, 0x00, 0x11, 0x43, 0x01,
+                0x00, 0x0f, 0x39, 0x00, 0x04, 0x4f, 0x76, 0x61, 0x69, 0x6c, 0x38, 0x00, 0x04, 0x11, 0x38, 0x01, 0x00, 0x0f, 0x32, 0x03,
+                0x00, 0x00, 0x5f, 0x05, 0x38, 0x61, 0x72, 0x65, 0x18, 0x02, 0x00, 0x82, 0x4a, 0x87, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x66,
+                0x6c, 0x65, 0xdb, 0x00, 0x01, 0x2a, 0x02, 0x6c, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x90, 0x02, 0x05, 0x68, 0x00, 0x47,
+                0x77, 0x68, 0x69, 0x74, 0xf4, 0x00, 0x01, 0x26, 0x01, 0xff, 0x00, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x20, 0x76,
+                0x65, 0x72, 0x64, 0x61, 0x6e, 0x61, 0x84, 0x00, 0x04, 0x28, 0x62, 0x61, 0x2d, 0x03, 0x02, 0x28, 0x04, 0x10, 0x2d, 0xc5,
+                0x02, 0x27, 0x3a, 0x20, 0xab, 0x01, 0x03, 0x18, 0x00, 0x01, 0xae, 0x02, 0x19, 0x3a, 0x44, 0x04, 0x06, 0x4f, 0x00, 0x03,
+                0x0d, 0x41, 0x8f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x56, 0x00, 0x05, 0x0a, 0x81, 0x04, 0x0a, 0x59, 0x00,
+                0x05, 0x72, 0x00, 0x0b, 0xa5, 0x00, 0x0f, 0x01, 0x02, 0x03, 0x19, 0x32, 0x02, 0x02, 0x09, 0x65, 0x00, 0x17, 0x31, 0xec,
+                0x02, 0x07, 0x1c, 0x04, 0x11, 0x65, 0x8c, 0x4a, 0x08, 0x1d, 0x04, 0x02, 0x1d, 0x02, 0x60, 0x72, 0x61, 0x64, 0x69, 0x75,
+                0x73, 0x24, 0x03, 0x08, 0x52, 0x00, 0x7a, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x4e, 0x00, 0x0c, 0x51, 0x04, 0x01,
+                0x01, 0x00, 0x0e, 0xe2, 0x06, 0x0a, 0x33, 0x00, 0x07, 0x87, 0x03, 0x01, 0x58, 0x03, 0x88, 0x31, 0x30, 0x30, 0x25, 0x20,
+                0x2d, 0x20, 0x34, 0x57, 0x03, 0x05, 0x93, 0x03, 0x00, 0x85, 0x03, 0x03, 0xd0, 0x07, 0x0f, 0xc3, 0x00, 0x06, 0x1f, 0x5f,
+                0x17, 0x01, 0x02, 0x0f, 0xf2, 0x01, 0x04, 0x0f, 0x38, 0x05, 0x08, 0x05, 0x41, 0x02, 0x1f, 0x62, 0x18, 0x03, 0x03, 0x79,
+                0x77, 0x6f, 0x72, 0x6b, 0x66, 0x6c, 0x6f, 0x8e, 0x04, 0x02, 0xa6, 0x00, 0x2a, 0x39, 0x36, 0xe2, 0x00, 0x06, 0x3a, 0x04,
+                0x26, 0x39, 0x30, 0x53, 0x04, 0x06, 0x4a, 0x00, 0x51, 0x64, 0x65, 0x62, 0x75, 0x67, 0xe3, 0x0a, 0x0f, 0x82, 0x01, 0x3c,
+                0x11, 0x44, 0x01, 0x00, 0x0f, 0x82, 0x01, 0x56, 0x68, 0x23, 0x66, 0x6f, 0x6f, 0x74, 0x65, 0x34, 0x03, 0x40, 0x70, 0x6f,
+                0x73, 0x69, 0xd5, 0x00, 0x67, 0x3a, 0x20, 0x66, 0x69, 0x78, 0x65, 0x5b, 0x01, 0x0d, 0x46, 0x03, 0x69, 0x62, 0x6f, 0x74,
+                0x74, 0x6f, 0x6d, 0x13, 0x00, 0x04, 0x9d, 0x05, 0x3f, 0x30, 0x30, 0x25, 0xe0, 0x00, 0x03, 0xa6, 0x72, 0x67, 0x62, 0x61,
+                0x28, 0x32, 0x32, 0x35, 0x2c, 0x20, 0x05, 0x00, 0x37, 0x30, 0x2e, 0x35, 0xb5, 0x00, 0x03, 0xc2, 0x01, 0x58, 0x64, 0x61,
+                0x72, 0x6b, 0x72, 0x7f, 0x00, 0x0f, 0xc7, 0x06, 0x07, 0x33, 0x20, 0x20, 0x68, 0x0c, 0x02, 0x00, 0xd9, 0x05, 0x07, 0xb1,
+                0x00, 0x4f, 0x69, 0x6e, 0x65, 0x2d, 0x1b, 0x00, 0x03, 0x09, 0x42, 0x02, 0x2c, 0x37, 0x30, 0xa9, 0x03, 0x21, 0x3c, 0x2f,
+                0x23, 0x0a, 0x24, 0x3e, 0x0a, 0x31, 0x0a, 0x60, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x81, 0x57, 0x20, 0x3d, 0x22, 0x89,
+                0x00, 0x61, 0x2f, 0x4a, 0x61, 0x76, 0x61, 0x53, 0x16, 0x00, 0x06, 0x38, 0x0a, 0xaf, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x20,
+                0x4e, 0x6f, 0x74, 0x41, 0x7b, 0x05, 0x01, 0x97, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x4f, 0x66, 0x28, 0x29, 0x14, 0x00, 0xf8,
+                0x01, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0xf0, 0x00, 0x16,
+                0x7d, 0xfa, 0x00, 0x7f, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3b, 0x00, 0x03, 0x19, 0x27, 0x71, 0x00, 0x1e, 0x27,
+                0x41, 0x00, 0x04, 0x08, 0x00, 0x06, 0x9f, 0x00, 0x0f, 0xe1, 0x05, 0x00, 0x0f, 0x9e, 0x00, 0x4a, 0x04, 0x70, 0x00, 0x0f,
+                0x9d, 0x00, 0x02, 0x03, 0x09, 0x00, 0x32, 0x66, 0x75, 0x6e, 0x4c, 0x03, 0x00, 0x70, 0x49, 0x10, 0x54, 0x54, 0x00, 0xf8,
+                0x03, 0x28, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x73, 0x53, 0x69, 0x6e, 0x63, 0x65, 0x45, 0x70, 0x6f, 0x63, 0x68, 0x62,
+                0x00, 0xfe, 0x04, 0x76, 0x61, 0x72, 0x20, 0x64, 0x61, 0x74, 0x65, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x44, 0x61,
+                0x74, 0x65, 0x31, 0x00, 0x20, 0x20, 0x2a, 0x8b, 0x02, 0x60, 0x30, 0x29, 0x3b, 0x20, 0x2f, 0x2f, 0x55, 0x0c, 0x00, 0xd2,
+                0x59, 0x93, 0x20, 0x74, 0x6f, 0x20, 0x6d, 0x69, 0x6c, 0x6c, 0x69, 0x2e, 0x00, 0x09, 0x52, 0x00, 0x61, 0x79, 0x65, 0x61,
+                0x72, 0x20, 0x3d, 0x59, 0x00, 0xd7, 0x2e, 0x67, 0x65, 0x74, 0x46, 0x75, 0x6c, 0x6c, 0x59, 0x65, 0x61, 0x72, 0x28, 0xa0,
+                0x02, 0x00, 0x27, 0x00, 0xf0, 0x06, 0x4d, 0x6f, 0x6e, 0x74, 0x68, 0x73, 0x20, 0x3d, 0x20, 0x5b, 0x27, 0x4a, 0x61, 0x6e,
+                0x27, 0x2c, 0x20, 0x27, 0x46, 0x65, 0x62, 0x07, 0x00, 0x30, 0x4d, 0x61, 0x72, 0x07, 0x00, 0x21, 0x41, 0x70, 0x07, 0x00,
+                0x30, 0x4d, 0x61, 0x79, 0x07, 0x00, 0x21, 0x4a, 0x75, 0x23, 0x00, 0x31, 0x4a, 0x75, 0x6c, 0x1c, 0x00, 0x20, 0x75, 0x67,
+                0x07, 0x00, 0x30, 0x53, 0x65, 0x70, 0x07, 0x00, 0x30, 0x4f, 0x63, 0x74, 0x07, 0x00, 0x30, 0x4e, 0x6f, 0x76, 0x07, 0x00,
+                0x5a, 0x44, 0x65, 0x63, 0x27, 0x5d, 0x6b, 0x00, 0x10, 0x6d, 0x6b, 0x00, 0x23, 0x20, 0x3d, 0x73, 0x00, 0x14, 0x5b, 0x9a,
+                0x00, 0x01, 0x0f, 0x00, 0x2b, 0x28, 0x29, 0x2d, 0x00, 0x37, 0x64, 0x61, 0x79, 0xbe, 0x00, 0x01, 0x14, 0x01, 0x0b, 0xba,
+                0x00, 0x40, 0x68, 0x6f, 0x75, 0x72, 0xb9, 0x00, 0x04, 0x24, 0x00, 0x10, 0x48, 0x10, 0x00, 0x0c, 0x25, 0x00, 0x60, 0x6d,
+                0x69, 0x6e, 0x75, 0x74, 0x65, 0x27, 0x00, 0x55, 0x22, 0x30, 0x22, 0x20, 0x2b, 0x2d, 0x00, 0x12, 0x4d, 0x18, 0x00, 0x0c,
+                0x2f, 0x00, 0x03, 0x49, 0x01, 0x0d, 0x2f, 0x00, 0x12, 0x53, 0x18, 0x00, 0x0c, 0x2f, 0x00, 0x02, 0x58, 0x45, 0x60, 0x74,
+                0x65, 0x64, 0x54, 0x69, 0x6d, 0xbf, 0x01, 0x02, 0xe2, 0x00, 0x51, 0x2b, 0x20, 0x27, 0x20, 0x27, 0x3d, 0x00, 0x10, 0x79,
+                0x0c, 0x00, 0x11, 0x2c, 0x0d, 0x00, 0x01, 0x8f, 0x01, 0x04, 0x1a, 0x00, 0x02, 0xbb, 0x00, 0x40, 0x2b, 0x20, 0x27, 0x3a,
+                0x0e, 0x00, 0x03, 0xa4, 0x00, 0x00, 0x21, 0x0b, 0x75, 0x73, 0x74, 0x72, 0x28, 0x2d, 0x32, 0x29, 0x1b, 0x00, 0x03, 0x90,
+                0x00, 0x07, 0x1b, 0x00, 0x06, 0x81, 0x00, 0x03, 0x97, 0x02, 0x09, 0x84, 0x00, 0x0d, 0x15, 0x05, 0x05, 0x8c, 0x02, 0xb1,
+                0x65, 0x73, 0x63, 0x61, 0x70, 0x65, 0x48, 0x74, 0x6d, 0x6c, 0x28, 0x59, 0x4b, 0x08, 0x81, 0x02, 0x40, 0x69, 0x66, 0x20,
+                0x28, 0x11, 0x04, 0x31, 0x6f, 0x66, 0x20, 0x1c, 0x00, 0x61, 0x20, 0x3d, 0x3d, 0x20, 0x27, 0x73, 0x0b, 0x03, 0x43, 0x27,
+                0x20, 0x7c, 0x7c, 0x15, 0x00, 0x00, 0x34, 0x52, 0x30, 0x61, 0x6e, 0x63, 0x26, 0x00, 0x02, 0x27, 0x03, 0x0f, 0x26, 0x03,
+                0x02, 0x01, 0x2c, 0x00, 0x07, 0x17, 0x00, 0x00, 0x63, 0x0b, 0xf0, 0x06, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x28, 0x2f,
+                0x26, 0x2f, 0x67, 0x2c, 0x20, 0x22, 0x26, 0x61, 0x6d, 0x70, 0x3b, 0x22, 0x29, 0xc8, 0x02, 0xcf, 0x6d, 0x61, 0x6b, 0x65,
+                0x20, 0x69, 0x74, 0x20, 0x66, 0x69, 0x72, 0x73, 0x35, 0x00, 0x05, 0x12, 0x20, 0x35, 0x00, 0x30, 0x6e, 0x62, 0x73, 0x36,
+                0x00, 0x0f, 0x25, 0x00, 0x04, 0x12, 0x3c, 0x25, 0x00, 0x2f, 0x6c, 0x74, 0x23, 0x00, 0x07, 0x12, 0x3e, 0x23, 0x00, 0x1f,
+                0x67, 0x23, 0x00, 0x08, 0x12, 0x22, 0x23, 0x00, 0x3f, 0x71, 0x75, 0x6f, 0x25, 0x00, 0x08, 0x13, 0x27, 0xc5, 0x00, 0x57,
+                0x70, 0x6f, 0x73, 0x3b, 0x22, 0x8f, 0x01, 0x06, 0x47, 0x04, 0x08, 0x0a, 0x01, 0x0f, 0x91, 0x01, 0x07, 0xf0, 0x03, 0x73,
+                0x61, 0x66, 0x65, 0x44, 0x69, 0x76, 0x28, 0x64, 0x69, 0x76, 0x69, 0x64, 0x65, 0x6e, 0x64, 0x2c, 0x20, 0x0a, 0x00, 0x3c,
+                0x73, 0x6f, 0x72, 0x9a, 0x01, 0x04, 0x21, 0x00, 0x00, 0x96, 0x01, 0x44, 0x30, 0x20, 0x26, 0x26, 0x28, 0x00, 0x01, 0x10,
+                0x00, 0x0f, 0x84, 0x01, 0x02, 0x07, 0xc6, 0x06, 0x0d, 0x96, 0x00, 0x05, 0x4e, 0x00, 0x14, 0x2f, 0x48, 0x00, 0x0d, 0xa3,
+                0x00, 0xd0, 0x2f, 0x2f, 0x20, 0x4e, 0x61, 0x4e, 0x20, 0x3c, 0x20, 0x2d, 0x49, 0x6e, 0x66, 0xa3, 0x10, 0x47, 0x79, 0x20,
+                0x3c, 0x20, 0x0b, 0x00, 0x01, 0x09, 0x00, 0x84, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x75, 0x04, 0x05, 0xd8,
+                0x00, 0x00, 0x17, 0x0c, 0x42, 0x61, 0x72, 0x65, 0x4e, 0x1e, 0x00, 0x9c, 0x28, 0x6c, 0x68, 0x73, 0x2c, 0x20, 0x72, 0x68,
+                0x73, 0xd6, 0x00, 0x31, 0x69, 0x73, 0x46, 0x47, 0x00, 0x00, 0x21, 0x00, 0x10, 0x29, 0xd6, 0x00, 0x05, 0x11, 0x00, 0x00,
+                0x2d, 0x00, 0x0f, 0xd7, 0x00, 0x02, 0x50, 0x6c, 0x68, 0x73, 0x20, 0x2d, 0x4c, 0x00, 0x07, 0xdf, 0x00, 0x5e, 0x20, 0x65,
+                0x6c, 0x73, 0x65, 0x51, 0x00, 0x0f, 0x40, 0x00, 0x02, 0x1f, 0x31, 0x38, 0x00, 0x0b, 0x0f, 0x78, 0x00, 0x06, 0x1e, 0x2d,
+                0x39, 0x00, 0x08, 0x26, 0x00, 0x02, 0x45, 0x00, 0x37, 0x4e, 0x61, 0x4e, 0xcb, 0x00, 0x00, 0x0e, 0x00, 0x0e, 0x50, 0x00,
+                0x0f, 0xa1, 0x01, 0x01, 0x0b, 0x8c, 0x00, 0x04, 0x47, 0x00, 0x0f, 0x39, 0x00, 0x04, 0x08, 0x8b, 0x00, 0x0f, 0x3a, 0x00,
+                0x00, 0x0f, 0x73, 0x00, 0x08, 0x0f, 0x39, 0x00, 0x01, 0x0f, 0x29, 0x00, 0x02, 0x00, 0x7f, 0x00, 0x00, 0x5b, 0x02, 0x01,
+                0xb4, 0x01, 0x71, 0x3f, 0x20, 0x30, 0x20, 0x3a, 0x20, 0x28, 0x14, 0x00, 0x14, 0x3e, 0x13, 0x00, 0x67, 0x31, 0x20, 0x3a,
+                0x20, 0x2d, 0x31, 0xfb, 0x02, 0x08, 0x67, 0x02, 0x0f, 0x0e, 0x07, 0x07, 0x40, 0x67, 0x65, 0x74, 0x43, 0x35, 0x63, 0x30,
+                0x65, 0x72, 0x56, 0xa2, 0x07, 0x10, 0x28, 0xa4, 0x0e, 0xbc, 0x2c, 0x20, 0x73, 0x75, 0x62, 0x6d, 0x65, 0x74, 0x72, 0x69,
+                0x63, 0x21, 0x02, 0x01, 0xc3, 0x0e, 0x07, 0x74, 0x04, 0x0a, 0x8d, 0x08, 0x3f, 0x7c, 0x7c, 0x20, 0x21, 0x00, 0x01, 0x04,
+                0x9f, 0x07, 0x0f, 0xc8, 0x01, 0x02, 0x00, 0x31, 0x00, 0x0f, 0x1a, 0x03, 0x01, 0x80, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c,
+                0x65, 0x2e, 0x7c, 0x50, 0x24, 0x72, 0x74, 0x0a, 0x05, 0x01, 0x5f, 0x00, 0x0b, 0x09, 0x05, 0x0c, 0x73, 0x00, 0x03, 0x08,
+                0x05, 0x08, 0xf2, 0x09, 0x0f, 0x4b, 0x00, 0x01, 0x05, 0xe4, 0x00, 0x0c, 0x50, 0x00, 0x06, 0x19, 0x00, 0x0f, 0x55, 0x00,
+                0x01, 0x09, 0x0f, 0x01, 0x21, 0x67, 0x5f, 0xa8, 0x0b, 0x0a, 0xd9, 0x00, 0x12, 0x67, 0x87, 0x64, 0x00, 0x2e, 0x55, 0xe1,
+                0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x64, 0x2e, 0x61, 0x64, 0x64, 0x3e, 0x01, 0x09, 0x9d, 0x04, 0x07,
+                0xa3, 0x00, 0x01, 0x32, 0x00, 0x27, 0x20, 0x3d, 0x3e, 0x00, 0x10, 0x5b, 0x2f, 0x00, 0x07, 0x81, 0x07, 0x00, 0x71, 0x00,
+                0x05, 0x28, 0x00, 0x26, 0x3d, 0x3d, 0x36, 0x09, 0x0a, 0x7f, 0x00, 0x06, 0x4b, 0x00, 0x28, 0x7b, 0x7d, 0x0e, 0x02, 0x0c,
+                0x59, 0x00, 0x24, 0x20, 0x3d, 0x2b, 0x00, 0x0f, 0x7f, 0x01, 0x01, 0x01, 0xb0, 0x09, 0x06, 0x23, 0x00, 0x15, 0x5b, 0x15,
+                0x01, 0x0b, 0x91, 0x00, 0x03, 0x28, 0x00, 0x0f, 0x8f, 0x00, 0x07, 0x02, 0x27, 0x01, 0x40, 0x70, 0x6f, 0x70, 0x75, 0x8b,
+                0x17, 0x51, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x6a, 0x02, 0x09, 0x7c, 0x04, 0x08, 0x72, 0x00, 0xd2, 0x4d, 0x61, 0x74, 0x68,
+                0x2e, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x28, 0x29, 0x61, 0x09, 0x0f, 0x26, 0x03, 0x0e, 0x04, 0x3c, 0x00, 0x3f, 0x4e,
+                0x61, 0x4e, 0x01, 0x03, 0x03, 0x05, 0x17, 0x01, 0x07, 0xc9, 0x00, 0x22, 0x20, 0x3d, 0x38, 0x00, 0x0f, 0x98, 0x05, 0x08,
+                0x09, 0x20, 0x00, 0x0f, 0x3d, 0x03, 0x09, 0x32, 0x50, 0x63, 0x74, 0xde, 0x01, 0x0f, 0x30, 0x03, 0x66, 0x03, 0x1f, 0x00,
+                0x0f, 0xd0, 0x03, 0x03, 0xf0, 0x07, 0x27, 0x61, 0x76, 0x67, 0x2e, 0x70, 0x63, 0x74, 0x5f, 0x6f, 0x66, 0x5f, 0x70, 0x65,
+                0x61, 0x6b, 0x5f, 0x73, 0x75, 0x73, 0x74, 0x61, 0xad, 0x01, 0x04, 0x6a, 0x59, 0x1e, 0x27, 0xb0, 0x12, 0x0f, 0xe7, 0x00,
+                0x03, 0x00, 0x39, 0x0b, 0x0f, 0xea, 0x00, 0x3e, 0x00, 0x20, 0x00, 0x1c, 0x21, 0x56, 0x00, 0x06, 0xe4, 0x0b, 0x0f, 0xd8,
+                0x0b, 0x00, 0x09, 0x10, 0x01, 0x00, 0x9a, 0x09, 0x1f, 0x2e, 0xe3, 0x00, 0x0f, 0x0f, 0xe2, 0x00, 0x11, 0x8f, 0x44, 0x69,
+                0x6d, 0x55, 0x6e, 0x69, 0x74, 0x73, 0xce, 0x01, 0x6c, 0x0f, 0xfe, 0x04, 0x30, 0x0f, 0xa9, 0x04, 0xd4, 0x30, 0x64, 0x69,
+                0x6d, 0x2f, 0x64, 0x10, 0x74, 0x1f, 0x0c, 0x04, 0xe4, 0x03, 0x15, 0x27, 0x15, 0x00, 0x08, 0xee, 0x0c, 0x02, 0xb7, 0x09,
+                0x05, 0x2e, 0x00, 0x0f, 0x99, 0x00, 0x07, 0x08, 0x53, 0x00, 0x08, 0x7c, 0x02, 0x06, 0x45, 0x04, 0x08, 0x61, 0x00, 0x00,
+                0xed, 0x0c, 0x04, 0x0e, 0x00, 0x0f, 0xe3, 0x09, 0x0a, 0x0b, 0x24, 0x00, 0x0f, 0x86, 0x02, 0x02, 0x10, 0x52, 0x2a, 0x59,
+                0x0f, 0x8a, 0x07, 0x7c, 0x00, 0x6e, 0x00, 0x0f, 0x9d, 0x03, 0x07, 0x09, 0x73, 0x05, 0x0f, 0xbf, 0x07, 0xb3, 0x01, 0x6c,
+                0x6c, 0x0f, 0x14, 0x03, 0x18, 0x01, 0x30, 0x00, 0x01, 0x12, 0x03, 0x02, 0x3a, 0x00, 0x0f, 0x10, 0x03, 0x01, 0x03, 0x24,
+                0x00, 0x0f, 0x75, 0x02, 0x07, 0x04, 0x45, 0x00, 0x0c, 0x0c, 0x03, 0x08, 0x53, 0x00, 0x22, 0x20, 0x3d, 0x27, 0x00, 0x0f,
+                0xb1, 0x07, 0x09, 0x01, 0x21, 0x00, 0x0f, 0xaf, 0x07, 0xaf, 0x0c, 0xc7, 0x00, 0x0f, 0xad, 0x07, 0x32, 0x01, 0x5e, 0x03,
+                0x0f, 0xab, 0x07, 0x79, 0x0d, 0xef, 0x03, 0x4f, 0x27, 0x70, 0x63, 0x74, 0x8b, 0x07, 0x00, 0x0f, 0xc6, 0x00, 0x02, 0x0f,
+                0x8a, 0x07, 0x86, 0x00, 0xc4, 0x00, 0x0f, 0x88, 0x01, 0x0a, 0x15, 0x54, 0xc4, 0x1f, 0x0f, 0xeb, 0x04, 0xff, 0x6e, 0x06,
+                0x4e, 0x21, 0x0f, 0xf0, 0x04, 0x18, 0x06, 0x35, 0x00, 0x01, 0xf5, 0x04, 0x07, 0x44, 0x00, 0x0f, 0xfa, 0x04, 0x01, 0x08,
+                0x2e, 0x00, 0x0f, 0x78, 0x04, 0x07, 0x09, 0x54, 0x00, 0x0c, 0x04, 0x05, 0x0d, 0x62, 0x00, 0x27, 0x20, 0x3d, 0x31, 0x00,
+                0x0f, 0x0e, 0x05, 0x09, 0x06, 0x26, 0x00, 0x0f, 0x13, 0x05, 0xaf, 0x0f, 0xcc, 0x00, 0x02, 0x0f, 0x18, 0x05, 0x32, 0x06,
+                0x90, 0x03, 0x0f, 0x1d, 0x05, 0x79, 0x0f, 0x26, 0x04, 0x03, 0x0f, 0xcb, 0x0c, 0x2e, 0x09, 0xed, 0x00, 0x0f, 0xce, 0x0c,
+                0xc2, 0xfa, 0x01, 0x74, 0x6f, 0x42, 0x61, 0x72, 0x43, 0x68, 0x61, 0x72, 0x74, 0x28, 0x70, 0x63, 0x74, 0x2c, 0x20, 0xd9,
+                0x18, 0x00, 0xdf, 0x00, 0x29, 0x70, 0x63, 0x3a, 0x16, 0x0d, 0xde, 0x00, 0x0f, 0x20, 0x00, 0x00, 0x0f, 0xcd, 0x01, 0x0a,
+                0x0f, 0xd4, 0x00, 0x03, 0x00, 0xce, 0x04, 0x10, 0x74, 0x17, 0x1a, 0x60, 0x6d, 0x70, 0x65, 0x64, 0x50, 0x63, 0xda, 0x03,
+                0x01, 0x1b, 0x03, 0x42, 0x6d, 0x69, 0x6e, 0x28, 0x09, 0x00, 0x22, 0x61, 0x78, 0xa2, 0x00, 0x30, 0x30, 0x29, 0x2c, 0x26,
+                0x03, 0x03, 0x48, 0x19, 0x00, 0x31, 0x00, 0x00, 0x46, 0x19, 0x10, 0x72, 0x5f, 0x25, 0x0b, 0x4e, 0x00, 0x01, 0x01, 0x1c,
+                0x47, 0x20, 0x3d, 0x20, 0x32, 0x53, 0x03, 0x02, 0x1a, 0x00, 0x34, 0x62, 0x61, 0x72, 0x1d, 0x00, 0x01, 0x5d, 0x00, 0x67,
+                0x63, 0x65, 0x69, 0x6c, 0x28, 0x28, 0x7e, 0x00, 0x11, 0x2f, 0x63, 0x00, 0x22, 0x20, 0x2a, 0x44, 0x00, 0x07, 0xdb, 0x04,
+                0x00, 0xd4, 0x1f, 0x0a, 0xea, 0x0b, 0xf0, 0x01, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x6c, 0x65, 0x74, 0x20, 0x69, 0x69, 0x20,
+                0x3d, 0x20, 0x31, 0x3b, 0x08, 0x00, 0x25, 0x3c, 0x3d, 0x63, 0x00, 0x00, 0x10, 0x00, 0x2a, 0x2b, 0x2b, 0x0a, 0x01, 0x00,
+                0x45, 0x00, 0x5f, 0x2b, 0x3d, 0x20, 0x63, 0x68, 0xde, 0x01, 0x0a, 0x0e, 0xd8, 0x15, 0x05, 0xb6, 0x01, 0x01, 0xc1, 0x1c,
+                0xf8, 0x02, 0x55, 0x70, 0x28, 0x6e, 0x75, 0x6d, 0x2c, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x65,
+                0x00, 0x05, 0x15, 0x00, 0x04, 0xe3, 0x00, 0x68, 0x70, 0x6f, 0x77, 0x28, 0x31, 0x30, 0x2e, 0x00, 0x0d, 0x89, 0x18, 0x06,
+                0x0b, 0x01, 0x58, 0x6e, 0x75, 0x6d, 0x20, 0x2a, 0x59, 0x00, 0x16, 0x2f, 0x0d, 0x00, 0x0f, 0x96, 0x00, 0x07, 0x03, 0xa5,
+                0x5e, 0x23, 0x70, 0x63, 0x4c, 0x02, 0x05, 0x33, 0x00, 0x2f, 0x3d, 0x31, 0x55, 0x02, 0x4d, 0x2f, 0x70, 0x63, 0xdb, 0x05,
+                0x02, 0x06, 0x59, 0x15, 0x3f, 0x70, 0x63, 0x74, 0x1c, 0x16, 0x03, 0x4f, 0x27, 0xe2, 0x9a, 0xa0, 0x92, 0x02, 0x02, 0x01,
+                0xe0, 0x07, 0x05, 0x5c, 0x16, 0x0f, 0x40, 0x00, 0x06, 0x02, 0x9e, 0x02, 0x41, 0x73, 0x69, 0x67, 0x6e, 0x24, 0x00, 0x00,
+                0x77, 0x07, 0x10, 0x31, 0x64, 0x15, 0xa0, 0x27, 0xe2, 0x88, 0x9e, 0x27, 0x20, 0x3a, 0x20, 0x27, 0x2d, 0x09, 0x00, 0x0f,
+                0xe9, 0x01, 0x08, 0x04, 0xcc, 0x01, 0x0a, 0x33, 0x01, 0x50, 0x29, 0x2e, 0x74, 0x6f, 0x4c, 0x28, 0x62, 0x13, 0x65, 0xd2,
+                0x1c, 0x05, 0x71, 0x06, 0x30, 0x2c, 0x20, 0x7b, 0x71, 0x1a, 0x60, 0x69, 0x6d, 0x75, 0x6d, 0x46, 0x72, 0x27, 0x66, 0x96,
+                0x6f, 0x6e, 0x44, 0x69, 0x67, 0x69, 0x74, 0x73, 0x3a, 0x3e, 0x00, 0x10, 0x2c, 0x68, 0x1f, 0x0f, 0x22, 0x00, 0x0a, 0x2f,
+                0x20, 0x7d, 0xfa, 0x04, 0x08, 0x03, 0xc9, 0x01, 0x7f, 0x61, 0x76, 0x67, 0x28, 0x61, 0x76, 0x67, 0xc9, 0x01, 0x0a, 0x3f,
+                0x61, 0x76, 0x67, 0xc9, 0x01, 0x0a, 0x0f, 0x20, 0x00, 0x00, 0x0f, 0xc9, 0x01, 0x0a, 0x3f, 0x61, 0x76, 0x67, 0xc9, 0x01,
+                0x0b, 0x3f, 0x61, 0x76, 0x67, 0xc9, 0x01, 0x2a, 0x0f, 0x40, 0x00, 0x06, 0x07, 0xc9, 0x01, 0x00, 0x24, 0x00, 0x0f, 0xc9,
+                0x01, 0x1f, 0x00, 0x87, 0x05, 0x0f, 0xb5, 0x01, 0x6f, 0x59, 0x73, 0x75, 0x6d, 0x28, 0x73, 0x17, 0x04, 0x0e, 0xb5, 0x01,
+                0x3f, 0x73, 0x75, 0x6d, 0xb5, 0x01, 0x0a, 0x0f, 0x20, 0x00, 0x00, 0x0f, 0xb5, 0x01, 0x0a, 0x3f, 0x73, 0x75, 0x6d, 0xb5,
+                0x01, 0x0b, 0x3f, 0x73, 0x75, 0x6d, 0xb5, 0x01, 0x2a, 0x0f, 0x40, 0x00, 0x06, 0x07, 0xb5, 0x01, 0x00, 0x24, 0x00, 0x0f,
+                0xb5, 0x01, 0x1f, 0x3f, 0x73, 0x75, 0x6d, 0xb5, 0x01, 0x69, 0xf0, 0x03, 0x61, 0x64, 0x64, 0x43, 0x65, 0x6c, 0x6c, 0x41,
+                0x74, 0x74, 0x72, 0x28, 0x74, 0x72, 0x6f, 0x77, 0x2c, 0x20, 0x1d, 0x69, 0x20, 0x69, 0x62, 0x4f, 0x1e, 0x11, 0x2c, 0x67,
+                0x22, 0x20, 0x2c, 0x20, 0x53, 0x69, 0x03, 0x89, 0x08, 0x6a, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x2d, 0x08, 0x00, 0x7b,
+                0x06, 0x20, 0x74, 0x64, 0x5a, 0x12, 0xf0, 0x02, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61,
+                0x74, 0x65, 0x45, 0x6c, 0x65, 0x0e, 0x00, 0x37, 0x28, 0x27, 0x74, 0xe6, 0x08, 0x03, 0xaf, 0x06, 0x02, 0x06, 0x07, 0x00,
+                0x6b, 0x00, 0x37, 0x20, 0x69, 0x6e, 0x73, 0x00, 0x0b, 0x68, 0x0b, 0x50, 0x64, 0x2e, 0x73, 0x65, 0x74, 0x9c, 0x00, 0x01,
+                0x1e, 0x00, 0x10, 0x28, 0x28, 0x00, 0x08, 0xa1, 0x00, 0x10, 0x5b, 0x0b, 0x00, 0x1f, 0x5d, 0x42, 0x1d, 0x02, 0x01, 0xcd,
+                0x0b, 0x2f, 0x65, 0x78, 0xe5, 0x05, 0x07, 0x0a, 0x6a, 0x00, 0x00, 0xc4, 0x00, 0x30, 0x73, 0x70, 0x61, 0xad, 0x06, 0x0f,
+                0xc6, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x08, 0xc8, 0x00, 0x11, 0x20, 0x31, 0x00, 0x0a, 0xa1, 0x00, 0x11, 0x22, 0x57, 0x22,
+                0x4a, 0x22, 0x2c, 0x20, 0x22, 0x75, 0x28, 0x08, 0xe6, 0x1d, 0x03, 0x38, 0x00, 0x90, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x48,
+                0x54, 0x4d, 0x4c, 0xce, 0x07, 0x19, 0x2d, 0xb9, 0x13, 0xf0, 0x00, 0x74, 0x64, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64,
+                0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x2f, 0x00, 0x08, 0xe4, 0x00, 0x06, 0xb3, 0x1b, 0x0f, 0xe1, 0x00, 0x01, 0x0f, 0x28,
+                0x03, 0x03, 0x0f, 0xe0, 0x00, 0x43, 0x04, 0x6c, 0x00, 0x0f, 0xdf, 0x00, 0x40, 0x0c, 0xd4, 0x0c, 0x07, 0x84, 0x02, 0x0c,
+                0xca, 0x0c, 0x29, 0x74, 0x64, 0x6e, 0x00, 0x00, 0x15, 0x01, 0x0f, 0xc2, 0x0c, 0x0e, 0x0b, 0x34, 0x00, 0x07, 0xdb, 0x20,
+                0x00, 0x3f, 0x00, 0x0f, 0x99, 0x1c, 0x0c, 0x20, 0x20, 0x20, 0x2a, 0x03, 0x09, 0xc5, 0x00, 0x2f, 0x74, 0x64, 0x64, 0x03,
+                0x0f, 0x20, 0x53, 0x69, 0xe3, 0x6e, 0x03, 0x66, 0x03, 0x01, 0x49, 0x01, 0x0f, 0x63, 0x03, 0x0a, 0x90, 0x2c, 0x20, 0x74,
+                0x6f, 0x6f, 0x6c, 0x74, 0x69, 0x70, 0x4b, 0x22, 0x18, 0x22, 0xf5, 0x00, 0x0e, 0xb4, 0x03, 0x23, 0x7b, 0x20, 0x9a, 0x01,
+                0x16, 0x3a, 0x59, 0x00, 0x11, 0x22, 0x47, 0x28, 0x25, 0x22, 0x3a, 0x47, 0x00, 0x1f, 0x7d, 0x6d, 0x00, 0x00, 0x0e, 0xb6,
+                0x00, 0x21, 0x2f, 0x2f, 0xa2, 0x03, 0x01, 0x81, 0x0f, 0xcd, 0x67, 0x69, 0x6e, 0x67, 0x20, 0x75, 0x74, 0x69, 0x6c, 0x69,
+                0x74, 0x79, 0xa5, 0x1f, 0x00, 0xe3, 0x2a, 0x15, 0x52, 0x86, 0x0f, 0x11, 0x4d, 0xe2, 0x0d, 0x19, 0x73, 0xf8, 0x24, 0x0f,
+                0xb3, 0x17, 0x03, 0x01, 0x39, 0x00, 0x08, 0x07, 0x23, 0x0f, 0xc4, 0x14, 0x01, 0x0f, 0x25, 0x00, 0x00, 0x0f, 0xfe, 0x0f,
+                0x04, 0x0b, 0x2a, 0x00, 0x0f, 0x61, 0x0c, 0x00, 0x00, 0x35, 0x2f, 0x93, 0x5f, 0x52, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65,
+                0x64, 0x3a, 0x19, 0x21, 0x73, 0x28, 0x17, 0x00, 0x0c, 0xc7, 0x04, 0x02, 0xa8, 0x0e, 0x00, 0x25, 0x31, 0x01, 0xd0, 0x24,
+                0x07, 0x7d, 0x0f, 0x33, 0x66, 0x6f, 0x72, 0xb5, 0x04, 0x04, 0x0a, 0x18, 0x2f, 0x6f, 0x66, 0xe1, 0x00, 0x03, 0x0a, 0x9f,
+                0x02, 0x07, 0x52, 0x00, 0x54, 0x2e, 0x70, 0x75, 0x73, 0x68, 0x6c, 0x18, 0x0f, 0xb5, 0x04, 0x02, 0x08, 0x2d, 0x00, 0x40,
+                0x73, 0x6f, 0x72, 0x74, 0xd7, 0x00, 0x0f, 0x38, 0x05, 0x01, 0x06, 0x28, 0x00, 0x00, 0x86, 0x00, 0x07, 0x36, 0x00, 0x0a,
+                0x7c, 0x00, 0x00, 0x60, 0x24, 0x00, 0x20, 0x02, 0x0f, 0x9b, 0x05, 0x09, 0x1a, 0x72, 0xf3, 0x03, 0x0f, 0xab, 0x02, 0x01,
+                0x30, 0x22, 0x6c, 0x61, 0xf2, 0x03, 0x10, 0x27, 0xce, 0x24, 0x07, 0x7a, 0x00, 0x5a, 0x2b, 0x20, 0x22, 0x27, 0x2c, 0xfa,
+                0x03, 0x01, 0x54, 0x01, 0x0a, 0x18, 0x03, 0x3f, 0x72, 0x6f, 0x77, 0xe2, 0x22, 0x09, 0x07, 0xbc, 0x00, 0x0f, 0xc2, 0x01,
+                0x15, 0x01, 0x52, 0x14, 0x0f, 0xc0, 0x01, 0x28, 0x02, 0xbc, 0x16, 0x01, 0xbe, 0x01, 0x0d, 0x78, 0x02, 0x0f, 0xbc, 0x01,
+                0x0c, 0x01, 0x30, 0x00, 0x0f, 0xba, 0x01, 0xff, 0x28, 0x06, 0xcd, 0x10, 0x0f, 0xbf, 0x01, 0x28, 0x07, 0x7c, 0x13, 0x01,
+                0xc4, 0x01, 0x0f, 0x17, 0x04, 0x03, 0x0f, 0xc9, 0x01, 0x0c, 0x06, 0x35, 0x00, 0x0f, 0xce, 0x01, 0xff, 0x11, 0x00, 0xe6,
+                0x10, 0x31, 0x61, 0x6c, 0x63, 0x51, 0x14, 0x50, 0x20, 0x74, 0x68, 0x65, 0x20, 0xcb, 0x00, 0x01, 0x4d, 0x08, 0x00, 0x01,
+                0x12, 0x20, 0x64, 0x20, 0xaa, 0x12, 0x30, 0x72, 0x6f, 0x75, 0x72, 0x79, 0x00, 0x1b, 0x00, 0xa2, 0x73, 0x20, 0x74, 0x68,
+                0x61, 0x74, 0x20, 0x68, 0x61, 0x76, 0x2e, 0x00, 0x10, 0x73, 0xa5, 0x00, 0x05, 0xb4, 0x09, 0x00, 0x71, 0x00, 0xa1, 0x72,
+                0x69, 0x65, 0x76, 0x65, 0x64, 0x20, 0x76, 0x69, 0x61, 0x22, 0x18, 0x26, 0x6f, 0x77, 0x61, 0x08, 0x26, 0x29, 0x2c, 0x75,
+                0x00, 0x04, 0xea, 0x24, 0x00, 0x00, 0x08, 0x00, 0x49, 0x00, 0x71, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x7f, 0x00,
+                0x20, 0x68, 0x61, 0x67, 0x00, 0x0d, 0x5d, 0x00, 0x30, 0x61, 0x73, 0x20, 0x0a, 0x1d, 0x80, 0x70, 0x72, 0x65, 0x76, 0x69,
+                0x6f, 0x75, 0x73, 0x2b, 0x00, 0x0d, 0xb8, 0x06, 0xb0, 0x61, 0x6c, 0x63, 0x52, 0x6f, 0x77, 0x53, 0x70, 0x61, 0x6e, 0x28,
+                0xae, 0x00, 0x10, 0x2c, 0x25, 0x00, 0x4c, 0x49, 0x64, 0x78, 0x2c, 0x8c, 0x00, 0x0c, 0x9d, 0x02, 0x00, 0x2d, 0x00, 0x02,
+                0x42, 0x09, 0x07, 0xce, 0x11, 0x01, 0x26, 0x0c, 0x02, 0x41, 0x00, 0x00, 0xb8, 0x0c, 0x0c, 0xcf, 0x00, 0x00, 0x34, 0x00,
+                0x12, 0x5b, 0x1f, 0x00, 0x5f, 0x5d, 0x29, 0x20, 0x21, 0x3d, 0x21, 0x00, 0x09, 0x5b, 0x20, 0x2d, 0x20, 0x31, 0x5d, 0x65,
+                0x0c, 0x0a, 0xdb, 0x11, 0x02, 0x28, 0x00, 0x02, 0xe0, 0x11, 0x01, 0x8f, 0x00, 0x50, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0xe2,
+                0x11, 0x4c, 0x2b, 0x2b, 0x69, 0x69, 0x17, 0x09, 0x01, 0x0a, 0x16, 0x0f, 0x90, 0x00, 0x22, 0x2c, 0x69, 0x69, 0x88, 0x00,
+                0x01, 0x34, 0x12, 0x00, 0x9f, 0x34, 0x08, 0x66, 0x02, 0x0a, 0xf1, 0x15, 0x43, 0x20, 0x20, 0x2b, 0x2b, 0x23, 0x01, 0x0f,
+                0x3e, 0x09, 0x0d, 0x05, 0x78, 0x10, 0x09, 0x2e, 0x00, 0x0f, 0x51, 0x0e, 0x05, 0x02, 0x5a, 0x08, 0x80, 0x46, 0x6f, 0x72,
+                0x6d, 0x75, 0x6c, 0x61, 0x28, 0x14, 0x00, 0x3c, 0x75, 0x6c, 0x61, 0x51, 0x0e, 0x1f, 0x21, 0x18, 0x00, 0x00, 0x0f, 0xc5,
+                0x14, 0x13, 0x30, 0x27, 0x4e, 0x73, 0xf9, 0x2e, 0x93, 0x20, 0x50, 0x65, 0x72, 0x66, 0x20, 0x53, 0x44, 0x4b, 0x0b, 0x03,
+                0x41, 0x28, 0x73, 0x29, 0x3a, 0x69, 0x2b, 0x03, 0x59, 0x00, 0x07, 0xa6, 0x00, 0x0c, 0xa7, 0x00, 0xd3, 0x6f, 0x6e, 0x43,
+                0x6c, 0x69, 0x63, 0x6b, 0x5f, 0x53, 0x68, 0x6f, 0x77, 0x57, 0x54, 0x31, 0x09, 0x08, 0x09, 0x01, 0x7d, 0x0b, 0x07, 0x1d,
+                0x00, 0x83, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0xfe, 0x03, 0x08, 0x17, 0x04, 0x33, 0x67, 0x65, 0x74, 0x16,
+                0x00, 0x60, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x37, 0x00, 0x00, 0x13, 0x36, 0x01, 0x38, 0x00, 0x08, 0x23, 0x04, 0x00,
+                0x54, 0x00, 0x13, 0x63, 0x48, 0x00, 0x01, 0x72, 0x16, 0x2f, 0x20, 0x3d, 0x64, 0x00, 0x09, 0x11, 0x2e, 0x2c, 0x00, 0x0a,
+                0xc1, 0x30, 0x02, 0x3b, 0x0c, 0x03, 0xc4, 0x7d, 0x03, 0x28, 0x00, 0x01, 0x0e, 0x2d, 0x0e, 0x8d, 0x00, 0x40, 0x73, 0x42,
+                0x79, 0x43, 0x58, 0x0a, 0x00, 0x21, 0x04, 0x24, 0x28, 0x22, 0x90, 0x00, 0x08, 0x75, 0x04, 0x05, 0xaa, 0x02, 0x40, 0x65,
+                0x6c, 0x65, 0x6d, 0x0e, 0x05, 0x0f, 0x5c, 0x00, 0x00, 0x0a, 0x9d, 0x01, 0x00, 0x29, 0x00, 0x60, 0x2e, 0x68, 0x69, 0x64,
+                0x64, 0x65, 0x54, 0x03, 0x19, 0x21, 0xcd, 0x00, 0x0f, 0x1b, 0x2f, 0x11, 0x04, 0x77, 0x01, 0xcd, 0x4d, 0x6f, 0x62, 0x69,
+                0x6c, 0x65, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x77, 0x01, 0x17, 0x6d, 0x1d, 0x00, 0x0f, 0x77, 0x01, 0x18, 0x02, 0x37,
+                0x00, 0x21, 0x2d, 0x6c, 0x38, 0x00, 0x0f, 0x77, 0x01, 0x0d, 0x0f, 0x64, 0x00, 0x08, 0x0f, 0x77, 0x01, 0x03, 0x01, 0x52,
+                0x39, 0x7f, 0x53, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x78, 0x01, 0x0e, 0x02, 0x73, 0x01, 0x01, 0x33, 0x00, 0x22, 0x5f,
+                0x73, 0x34, 0x00, 0x0f, 0x78, 0x01, 0x0a, 0x0f, 0x5d, 0x00, 0x01, 0x0f, 0x79, 0x01, 0x3b, 0x02, 0xd5, 0x07, 0x11, 0x44,
+                0x87, 0x3c, 0x2f, 0x49, 0x64, 0xcb, 0x07, 0x00, 0x02, 0x5c, 0x31, 0x19, 0x52, 0x5a, 0x34, 0x03, 0xf9, 0x16, 0x00, 0x12,
+                0x02, 0x30, 0x6f, 0x72, 0x28, 0xca, 0x38, 0x12, 0x2c, 0xec, 0x19, 0x01, 0x2d, 0x00, 0x03, 0x0c, 0x00, 0x05, 0xf3, 0x0c,
+                0x0d, 0xe3, 0x0d, 0x41, 0x68, 0x69, 0x73, 0x2e, 0xff, 0x38, 0x11, 0x3d, 0x1f, 0x3d, 0x0a, 0x87, 0x04, 0x01, 0x1e, 0x00,
+                0x06, 0x4d, 0x00, 0x04, 0x66, 0x1a, 0x01, 0x0d, 0x00, 0x0f, 0x2a, 0x00, 0x05, 0x0e, 0x8b, 0x1a, 0x05, 0x20, 0x00, 0x06,
+                0x77, 0x0d, 0x03, 0x0a, 0x00, 0x0f, 0xd0, 0x04, 0x05, 0x08, 0x69, 0x24, 0x00, 0x0f, 0x08, 0x21, 0x73, 0x6d, 0x5e, 0x0c,
+                0x05, 0x55, 0x1b, 0x00, 0x58, 0x15, 0x14, 0x28, 0xa5, 0x2d, 0x0c, 0xec, 0x26, 0x1e, 0x27, 0x86, 0x89, 0x00, 0xe8, 0x2f,
+                0x51, 0x73, 0x75, 0x6d, 0x27, 0x29, 0x8c, 0x06, 0x0f, 0x2e, 0x00, 0x11, 0x6b, 0x61, 0x76, 0x67, 0x27, 0x29, 0x29, 0x94,
+                0x1d, 0x05, 0x89, 0x00, 0x21, 0x53, 0x74, 0x2b, 0x18, 0x0e, 0x3b, 0x00, 0x10, 0x2e, 0x60, 0x13, 0x2f, 0x2f, 0x20, 0x19,
+                0x00, 0x00, 0x00, 0x51, 0x00, 0x0c, 0x4e, 0x00, 0x3f, 0x6c, 0x74, 0x73, 0xd8, 0x00, 0x19, 0x0f, 0xc7, 0x8c, 0x00, 0x0f,
+                0xd9, 0x00, 0x09, 0x0f, 0x2f, 0x00, 0x04, 0x0f, 0xda, 0x00, 0x04, 0xf6, 0x01, 0x6c, 0x32, 0x63, 0x61, 0x63, 0x68, 0x65,
+                0x53, 0x69, 0x7a, 0x65, 0x4b, 0x69, 0x42, 0x20, 0x3d, 0x9d, 0x00, 0x47, 0x2a, 0x20, 0x31, 0x32, 0x4e, 0x3c, 0x0f, 0x2f,
+                0x00, 0x01, 0x03, 0x10, 0x01, 0x0f, 0x72, 0x00, 0x00, 0x03, 0x11, 0x01, 0x0f, 0x1a, 0x00, 0x01, 0x00, 0x40, 0x16, 0x01,
+                0x5c, 0x00, 0x17, 0x27, 0x04, 0x0a, 0x04, 0x10, 0x08, 0x00, 0xa6, 0x0a, 0x07, 0x1d, 0x02, 0x00, 0x7c, 0x33, 0x50, 0x52,
+                0x6f, 0x77, 0x28, 0x27, 0x6d, 0x32, 0x30, 0x20, 0x26, 0x20, 0x50, 0x31, 0x1a, 0x27, 0x46, 0x07, 0x09, 0x01, 0x00, 0x64,
+                0x2c, 0x20, 0x22, 0x72, 0x61, 0x22, 0x0c, 0x00, 0x06, 0xec, 0x33, 0x11, 0x67, 0x49, 0x90, 0x1c, 0x29, 0x2c, 0x00, 0x03,
+                0x2a, 0x00, 0x0f, 0x01, 0x00, 0x03, 0x05, 0x3a, 0x09, 0x09, 0x89, 0x00, 0x40, 0x47, 0x50, 0x55, 0x20, 0x42, 0x04, 0x0f,
+                0x86, 0x00, 0x09, 0x0d, 0x89, 0x00, 0x00, 0x7f, 0x1f, 0x00, 0xdd, 0x03, 0x41, 0x2e, 0x67, 0x70, 0x75, 0x63, 0x0a, 0x0f,
+                0x89, 0x00, 0x30, 0x4f, 0x43, 0x68, 0x69, 0x70, 0x8a, 0x00, 0x10, 0x0f, 0x89, 0x00, 0x04, 0x4d, 0x63, 0x68, 0x69, 0x70,
+                0x8a, 0x00, 0x0f, 0x89, 0x00, 0x24, 0x90, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x4c, 0x6f, 0x63, 0x6b, 0xb0, 0x0a, 0x6f, 0x53,
+                0x74, 0x61, 0x74, 0x75, 0x73, 0x94, 0x00, 0x00, 0x0f, 0x89, 0x00, 0x05, 0x00, 0x3e, 0x00, 0x03, 0x3d, 0x00, 0x02, 0x3c,
+                0x00, 0x0f, 0x89, 0x00, 0x26, 0x4f, 0x23, 0x20, 0x53, 0x4d, 0x7a, 0x00, 0x01, 0x0f, 0x89, 0x00, 0x0a, 0x04, 0x63, 0x04,
+                0x0f, 0x2c, 0x00, 0x05, 0x07, 0xfa, 0x03, 0x0f, 0x89, 0x00, 0x16, 0x40, 0x4c, 0x32, 0x20, 0x43, 0x26, 0x03, 0x10, 0x20,
+                0x27, 0x03, 0x6f, 0x20, 0x28, 0x4b, 0x69, 0x42, 0x29, 0x97, 0x00, 0x01, 0x0a, 0x89, 0x00, 0x0b, 0x89, 0x03, 0x0d, 0x2c,
+                0x00, 0x0e, 0x7a, 0x03, 0x0b, 0x89, 0x00, 0x05, 0x8a, 0x00, 0x1f, 0x5d, 0x5c, 0x0d, 0x03, 0x00, 0xe6, 0x0b, 0x21, 0x6f,
+                0x66, 0x66, 0x03, 0x0f, 0x4e, 0x0d, 0x45, 0x00, 0x93, 0x22, 0x41, 0x68, 0x64, 0x72, 0x22, 0x03, 0x0c, 0x01, 0x5f, 0x06,
+                0x0f, 0x89, 0x13, 0x04, 0x0f, 0x89, 0x0a, 0x01, 0x00, 0x33, 0x00, 0x04, 0xae, 0x06, 0x0f, 0x6d, 0x00, 0x0e, 0x00, 0x2d,
+                0x00, 0x08, 0xee, 0x06, 0x05, 0x10, 0x00, 0x0f, 0x71, 0x00, 0x31, 0x0f, 0xee, 0x0d, 0x16, 0x0f, 0xcb, 0x07, 0x0b, 0x01,
+                0x19, 0x03, 0x0f, 0xce, 0x07, 0x28, 0x00, 0xb3, 0x04, 0x02, 0x06, 0x00, 0x01, 0x94, 0x2c, 0x04, 0xd0, 0x04, 0x01, 0xb1,
+                0x00, 0x62, 0x2c, 0x20, 0x66, 0x72, 0x65, 0x71, 0x06, 0x00, 0x03, 0x1e, 0x00, 0x00, 0x0b, 0x00, 0x03, 0x1e, 0x00, 0x0f,
+                0xee, 0x07, 0x20, 0x00, 0x5c, 0x00, 0x00, 0xa1, 0x07, 0x07, 0xb1, 0x36, 0x0b, 0x1e, 0x00, 0x01, 0x67, 0x00, 0x03, 0x23,
+                0x00, 0x01, 0x0c, 0x00, 0x0f, 0x28, 0x00, 0x04, 0x03, 0x84, 0x00, 0x03, 0x2a, 0x00, 0x03, 0x0e, 0x00, 0x0f, 0x2c, 0x00,
+                0x00, 0x00, 0xb0, 0x00, 0x00, 0xa1, 0x01, 0x3f, 0x72, 0x65, 0x71, 0x1e, 0x00, 0x04, 0x04, 0x72, 0x00, 0x05, 0x0c, 0x00,
+                0x0f, 0x28, 0x00, 0x04, 0x06, 0x72, 0x00, 0x07, 0x0e, 0x00, 0x0f, 0x64, 0x08, 0x0f, 0x0f, 0x74, 0x06, 0x0d, 0x01, 0x41,
+                0x38, 0x13, 0x44, 0x7c, 0x96, 0x02, 0xc1, 0x03, 0x0f, 0x6f, 0x07, 0x00, 0x0e, 0xa7, 0x96, 0x05, 0x9d, 0x07, 0x0f, 0x84,
+                0x04, 0x09, 0x27, 0x27, 0x6e, 0xab, 0x04, 0x2f, 0x2c, 0x20, 0x47, 0x00, 0x00, 0x00, 0x43, 0x07, 0x03, 0x23, 0x00, 0x11,
+                0x2c, 0x95, 0x00, 0x0a, 0xd5, 0x1b, 0x0f, 0x01, 0x00, 0x21, 0x38, 0x2c, 0x20, 0x27, 0x89, 0x04, 0x0b, 0x0f, 0x00, 0x0f,
+                0xde, 0x04, 0x14, 0x41, 0x53, 0x59, 0x53, 0x20, 0xdb, 0x02, 0x08, 0xc0, 0x00, 0x0e, 0x5f, 0x09, 0x0e, 0xcf, 0x89, 0x05,
+                0x86, 0x08, 0x0f, 0xa0, 0x00, 0x09, 0x00, 0x38, 0x00, 0x31, 0x63, 0x6c, 0x6b, 0x1d, 0x01, 0x03, 0x0f, 0x00, 0x0f, 0x53,
+                0x09, 0x01, 0x0f, 0x77, 0x00, 0x1f, 0x40, 0x2e, 0x70, 0x65, 0x72, 0x52, 0x3f, 0x41, 0x6f, 0x6e, 0x64, 0x27, 0x97, 0x25,
+                0x36, 0x65, 0x2d, 0x36, 0x77, 0x00, 0x35, 0x4d, 0x48, 0x7a, 0xcf, 0x00, 0x0f, 0x77, 0x00, 0x07, 0x07, 0x44, 0x00, 0x02,
+                0x50, 0x22, 0x00, 0x01, 0x00, 0x1f, 0x27, 0x29, 0x08, 0x05, 0x1f, 0x43, 0x27, 0x01, 0x10, 0x0f, 0xf9, 0x98, 0x00, 0x0f,
+                0x27, 0x01, 0x12, 0x00, 0x38, 0x00, 0x07, 0x27, 0x01, 0x0f, 0x47, 0x00, 0x00, 0x0f, 0x27, 0x01, 0x0a, 0x0f, 0x77, 0x00,
+                0x07, 0x0f, 0x27, 0x01, 0x1a, 0x0f, 0x77, 0x00, 0x04, 0x0f, 0x27, 0x01, 0x19, 0x00, 0x2c, 0x07, 0x0a, 0x26, 0x01, 0x0f,
+                0xb0, 0x00, 0x01, 0x0f, 0xd4, 0x0a, 0x09, 0x0f, 0x27, 0x01, 0x09, 0x00, 0x38, 0x00, 0x07, 0x27, 0x01, 0x0f, 0x8f, 0x0a,
+                0x04, 0x0f, 0x27, 0x01, 0x06, 0x0f, 0x77, 0x00, 0x07, 0x0f, 0x27, 0x01, 0x1a, 0x0f, 0x77, 0x00, 0x04, 0x0f, 0x27, 0x01,
+                0x19, 0x69, 0x4d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x2b, 0x01, 0x0f, 0xb0, 0x00, 0x00, 0x0f, 0xac, 0x9b, 0x01, 0x0f, 0x28,
+                0x01, 0x0e, 0x22, 0x2c, 0x20, 0x38, 0x00, 0x03, 0x28, 0x01, 0x04, 0x0f, 0x00, 0x0f, 0x28, 0x01, 0x05, 0x0f, 0x77, 0x00,
+                0x1b, 0x0c, 0x28, 0x01, 0x15, 0x32, 0x2c, 0x01, 0x00, 0x27, 0x01, 0x25, 0x54, 0x2f, 0x05, 0x05, 0x0f, 0x77, 0x00, 0x08,
+                0x08, 0x28, 0x01, 0x00, 0x42, 0x00, 0x09, 0x2c, 0x01, 0x0f, 0xf6, 0x08, 0x82, 0x0f, 0x36, 0x00, 0x0f, 0x10, 0x72, 0x7a,
+                0x16, 0x07, 0xe0, 0x21, 0x01, 0x8c, 0x08, 0x00, 0xa3, 0x0c, 0x0f, 0xc0, 0x08, 0x1d, 0x06, 0x63, 0x07, 0x0f, 0x35, 0x09,
+                0x0f, 0x02, 0x76, 0x00, 0x04, 0x37, 0x00, 0x01, 0x52, 0x07, 0x0f, 0xaa, 0x00, 0x23, 0x00, 0x67, 0x07, 0x0f, 0xaa, 0x00,
+                0x1d, 0x08, 0x9f, 0x08, 0x0f, 0xaa, 0x00, 0x18, 0x05, 0xfc, 0x07, 0x0f, 0xa2, 0x09, 0x3b, 0x80, 0x54, 0x6f, 0x70, 0x4c,
+                0x65, 0x76, 0x65, 0x6c, 0x73, 0x0c, 0x0f, 0xa3, 0x09, 0x22, 0x00, 0x06, 0x8f, 0x51, 0x67, 0x6f, 0x72, 0x79, 0x2c, 0x51,
+                0x09, 0x05, 0x6f, 0x11, 0x01, 0x07, 0x00, 0x05, 0xa4, 0x09, 0x02, 0x01, 0x26, 0x25, 0x63, 0x74, 0x11, 0x00, 0x22, 0x64,
+                0x65, 0xec, 0x43, 0x0b, 0xdb, 0x27, 0x05, 0xce, 0x08, 0x04, 0x56, 0x00, 0x00, 0xce, 0x34, 0x03, 0x0b, 0x00, 0x0f, 0xf4,
+                0x08, 0x00, 0x0f, 0xb8, 0x11, 0x10, 0x0f, 0x8e, 0x11, 0x08, 0x08, 0xa3, 0x00, 0x04, 0x27, 0x00, 0x0f, 0xa6, 0x09, 0x07,
+                0x00, 0xb7, 0x27, 0x1a, 0x3d, 0x8d, 0x27, 0x08, 0x1c, 0x00, 0x06, 0x48, 0x00, 0x06, 0x0d, 0x00, 0x0f, 0x2a, 0x00, 0x00,
+                0x07, 0xf8, 0x00, 0x00, 0x70, 0x03, 0x06, 0x0e, 0x00, 0x0f, 0xa6, 0x09, 0x06, 0x0f, 0xa5, 0x09, 0x15, 0x42, 0x33, 0x44,
+                0x2b, 0x43, 0xee, 0x91, 0x08, 0x72, 0x05, 0xb1, 0x47, 0x52, 0x20, 0x45, 0x6e, 0x67, 0x69, 0x6e, 0x65, 0x20, 0x41, 0x76,
+                0x8d, 0x0f, 0xe7, 0x08, 0x04, 0x0f, 0x1a, 0x07, 0x01, 0x0c, 0x63, 0xa0, 0x0f, 0x68, 0x06, 0x0f, 0x0c, 0x9b, 0x07, 0x0c,
+                0x42, 0x00, 0x06, 0x63, 0x06, 0x0f, 0xb4, 0x09, 0x23, 0x0a, 0x68, 0x3a, 0x0f, 0xa2, 0x00, 0x00, 0x0f, 0x9b, 0x00, 0x13,
+                0x0f, 0x52, 0x00, 0x05, 0x00, 0x20, 0x11, 0x0f, 0x55, 0x00, 0x18, 0x76, 0x2c, 0x20, 0x22, 0x54, 0x68, 0x65, 0x20, 0x62,
+                0x01, 0x03, 0xab, 0x96, 0xd3, 0x73, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x33, 0x44, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x93, 0x01,
+                0x00, 0x8d, 0x4d, 0x8f, 0x6b, 0x6c, 0x6f, 0x61, 0x64, 0x73, 0x2e, 0x22, 0xd8, 0x06, 0x03, 0x2d, 0x33, 0x44, 0x1a, 0x01,
+                0xff, 0x06, 0x2c, 0x20, 0x27, 0x48, 0x61, 0x72, 0x64, 0x77, 0x61, 0x72, 0x65, 0x20, 0x44, 0x72, 0x61, 0x77, 0x20, 0x43,
+                0x61, 0x6c, 0x6c, 0xd8, 0x0f, 0x02, 0x0f, 0xbf, 0x01, 0x00, 0x0a, 0x99, 0xa2, 0x0f, 0x8a, 0x0b, 0x10, 0x0d, 0x7c, 0x00,
+                0x0a, 0x42, 0x00, 0x07, 0x85, 0x0b, 0x0f, 0xbf, 0x01, 0x25, 0x0f, 0xbb, 0x0b, 0x33, 0x0f, 0xb6, 0x0b, 0x17, 0x0f, 0x3e,
+                0x00, 0x0d, 0x40, 0x22, 0x48, 0x57, 0x20, 0xe1, 0x00, 0x02, 0x78, 0x21, 0xf3, 0x00, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x65,
+                0x78, 0x63, 0x65, 0x65, 0x64, 0x20, 0x41, 0x50, 0x49, 0x1a, 0x00, 0x00, 0x72, 0x01, 0x11, 0x2c, 0xca, 0x01, 0x00, 0x1f,
+                0x00, 0x72, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0xa2, 0x22, 0x0f, 0xcb, 0x01, 0x06, 0x0c, 0x87, 0x03, 0x0b, 0xcb,
+                0x01, 0x04, 0x13, 0x02, 0x13, 0x44, 0x3a, 0x98, 0x19, 0x65, 0xd3, 0x01, 0x0f, 0x8a, 0x03, 0x04, 0x0a, 0xdb, 0xa3, 0x0f,
+                0xcf, 0x01, 0x1a, 0x03, 0x8a, 0x03, 0x0a, 0x42, 0x00, 0x0f, 0xcf, 0x01, 0x2a, 0x0f, 0xcb, 0x01, 0x84, 0x03, 0xe1, 0x00,
+                0x0f, 0xcf, 0x01, 0x04, 0x05, 0x6e, 0x01, 0x0f, 0xb7, 0x01, 0x05, 0x10, 0x53, 0xff, 0x92, 0x0a, 0x5f, 0x03, 0xf1, 0x00,
+                0x2c, 0x20, 0x27, 0x57, 0x61, 0x69, 0x74, 0x20, 0x46, 0x6f, 0x72, 0x20, 0x49, 0x64, 0x6c, 0xbc, 0x01, 0x4e, 0x6d, 0x61,
+                0x6e, 0x64, 0x85, 0x03, 0x0f, 0x82, 0x03, 0x04, 0x0f, 0x0c, 0xa6, 0x0f, 0x0f, 0xcb, 0x01, 0x06, 0x03, 0x82, 0x03, 0x0f,
+                0x42, 0x00, 0x0f, 0x0f, 0xcb, 0x01, 0x16, 0x0f, 0xb7, 0x01, 0x80, 0x00, 0x5e, 0x01, 0x50, 0x2d, 0x66, 0x6f, 0x72, 0x2d,
+                0xc9, 0x00, 0x00, 0x9e, 0x45, 0x01, 0x5e, 0x01, 0x11, 0x20, 0x8a, 0x94, 0x01, 0x86, 0x1f, 0x00, 0x66, 0x16, 0x10, 0x46,
+                0x84, 0xa5, 0xb1, 0x20, 0x45, 0x6e, 0x64, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0xc7, 0x45, 0x01, 0x29, 0x00, 0x0f,
+                0xcb, 0x01, 0x1b, 0x10, 0x50, 0x57, 0xa3, 0x21, 0x20, 0x53, 0x77, 0x94, 0x23, 0x20, 0x42, 0x72, 0xa7, 0x0e, 0xc0, 0x00,
+                0x0f, 0xcb, 0x01, 0x04, 0x0f, 0xb0, 0xa7, 0x02, 0x0f, 0x89, 0x03, 0x13, 0x03, 0xcb, 0x01, 0x0f, 0x42, 0x00, 0x02, 0x0f,
+                0x89, 0x03, 0x23, 0x0f, 0xcb, 0x01, 0x80, 0x02, 0x5e, 0x01, 0x02, 0xde, 0x00, 0x00, 0xe2, 0x31, 0x01, 0xde, 0x00, 0x07,
+                0xca, 0x01, 0x50, 0x50, 0x52, 0x4f, 0x50, 0x20, 0xfa, 0x3d, 0x05, 0xc6, 0x01, 0x06, 0x62, 0x05, 0x0f, 0xc8, 0x01, 0x06,
+                0x01, 0x4e, 0x00, 0x0c, 0xc8, 0x01, 0x23, 0x53, 0x4d, 0xcd, 0x08, 0x21, 0x20, 0x43, 0xa9, 0x07, 0x0f, 0xd4, 0x08, 0x17,
+                0x0d, 0xbb, 0xa4, 0x0f, 0xd4, 0x08, 0x1e, 0x0d, 0x42, 0x00, 0x0f, 0xd4, 0x08, 0x3c, 0x0e, 0xa2, 0x00, 0x0f, 0xd4, 0x08,
+                0x30, 0x0f, 0x55, 0x00, 0x17, 0x70, 0x2c, 0x20, 0x22, 0x49, 0x6e, 0x64, 0x69, 0x73, 0x0b, 0x63, 0x73, 0x20, 0x77, 0x68,
+                0x65, 0x6e, 0xd1, 0x01, 0xef, 0x73, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x72, 0x75, 0x6e, 0x6e, 0x69, 0x6e, 0x67, 0xaf,
+                0x01, 0x2b, 0x3f, 0x20, 0x2d, 0x20, 0xed, 0x08, 0x00, 0x0f, 0xaf, 0x01, 0x01, 0x0f, 0xf6, 0x9c, 0x09, 0x0f, 0xba, 0x01,
+                0x10, 0x2f, 0x2c, 0x20, 0x42, 0x00, 0x0a, 0x0f, 0xba, 0x01, 0x20, 0x0d, 0xaf, 0x01, 0x0f, 0xa2, 0x00, 0x0a, 0x0f, 0xba,
+                0x01, 0x11, 0x0f, 0xaf, 0x01, 0x01, 0x0f, 0x55, 0x00, 0x17, 0x0e, 0xaf, 0x01, 0x2f, 0x33, 0x44, 0xb2, 0x01, 0x03, 0xf0,
+                0x02, 0x20, 0x20, 0x4d, 0x61, 0x79, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x6c, 0x61, 0x70, 0x20, 0x77, 0x69, 0x74, 0x27, 0x07,
+                0x01, 0x88, 0x08, 0x0f, 0xcd, 0x01, 0x2e, 0x0f, 0xef, 0x08, 0x00, 0x0f, 0x7c, 0x03, 0x12, 0x06, 0x4b, 0x9a, 0x0f, 0x86,
+                0x03, 0x11, 0x0f, 0x7c, 0x03, 0x01, 0x06, 0x42, 0x00, 0x0f, 0x86, 0x03, 0x21, 0x0f, 0x7c, 0x03, 0x0f, 0x07, 0xa2, 0x00,
+                0x0f, 0x6a, 0x09, 0x14, 0x0f, 0x7c, 0x03, 0x10, 0x0f, 0x55, 0x00, 0x06, 0x0e, 0xcd, 0x01, 0x03, 0xa2, 0x01, 0x0f, 0xd2,
+                0x01, 0x16, 0x2f, 0x33, 0x44, 0xcd, 0x01, 0x1e, 0x16, 0x49, 0x4c, 0x23, 0x20, 0x20, 0x49, 0xa1, 0xa0, 0x0f, 0x54, 0x05,
+                0x00, 0x0f, 0xcd, 0x01, 0x04, 0x08, 0x77, 0xa8, 0x0f, 0x48, 0x05, 0x1b, 0x04, 0xcd, 0x01, 0x08, 0x42, 0x00, 0x0f, 0x48,
+                0x05, 0x2b, 0x0f, 0xcd, 0x01, 0x03, 0x09, 0xa2, 0x00, 0x0f, 0x48, 0x05, 0x1c, 0x0f, 0xcd, 0x01, 0x06, 0x0f, 0x55, 0x00,
+                0x13, 0x09, 0xcd, 0x01, 0x11, 0x68, 0x7b, 0x13, 0xa1, 0x74, 0x65, 0x6e, 0x20, 0x61, 0x6e, 0x20, 0x53, 0x4d, 0x20, 0x43,
+                0x00, 0x18, 0x64, 0xc8, 0x24, 0x20, 0x73, 0x2c, 0xec, 0x28, 0x03, 0xfa, 0x61, 0x0f, 0xc5, 0x01, 0x1b, 0xfd, 0x07, 0x57,
+                0x61, 0x72, 0x70, 0x20, 0x4f, 0x63, 0x63, 0x75, 0x70, 0x61, 0x6e, 0x63, 0x79, 0x20, 0x28, 0x70, 0x65, 0x72, 0x20, 0x53,
+                0x4d, 0x68, 0x1d, 0x0f, 0xc5, 0x01, 0x04, 0x08, 0x92, 0x9d, 0x08, 0xaa, 0x14, 0x01, 0xb3, 0x02, 0x06, 0x4a, 0x3c, 0x0f,
+                0xc5, 0x01, 0x08, 0x08, 0x42, 0x00, 0x05, 0xa5, 0x14, 0x0a, 0x3f, 0x00, 0x0f, 0xc5, 0x01, 0x2a, 0x09, 0xa2, 0x00, 0x0f,
+                0xc5, 0x01, 0x35, 0x0f, 0x55, 0x00, 0x13, 0x60, 0x2c, 0x20, 0x22, 0x52, 0x65, 0x73, 0x92, 0x50, 0x21, 0x74, 0x20, 0x32,
+                0x00, 0x12, 0x20, 0x5d, 0x01, 0x09, 0xad, 0x01, 0x30, 0x20, 0x20, 0x4c, 0xdf, 0x01, 0x05, 0x81, 0x01, 0xe0, 0x69, 0x73,
+                0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x61, 0x20, 0x70, 0x72, 0x6f, 0x62, 0x3b, 0x25, 0x01, 0xcc, 0x03, 0x02, 0x5d, 0x03,
+                0x02, 0x3c, 0x05, 0x10, 0x25, 0x25, 0x00, 0x31, 0x6c, 0x6f, 0x77, 0xe9, 0x01, 0x0f, 0xb8, 0x15, 0x07, 0x03, 0xf2, 0x11,
+                0x00, 0xc1, 0x29, 0x00, 0x1a, 0x2a, 0x04, 0x0c, 0x00, 0x0d, 0xa1, 0x29, 0x02, 0x18, 0x00, 0x0c, 0x55, 0x48, 0x04, 0xf4,
+                0x15, 0x01, 0xdd, 0x29, 0x05, 0x9b, 0x29, 0x08, 0x67, 0x12, 0x0f, 0xf9, 0x15, 0x20, 0x05, 0x57, 0x00, 0x03, 0xb0, 0x2a,
+                0x0f, 0xf3, 0x2a, 0x07, 0x00, 0x0f, 0x00, 0x41, 0x29, 0x20, 0x3d, 0x3e, 0xbc, 0x14, 0x04, 0xc3, 0x13, 0x09, 0x4c, 0x00,
+                0x01, 0x0f, 0x46, 0x02, 0x4a, 0x00, 0x0c, 0x03, 0x14, 0x0f, 0x87, 0x32, 0x00, 0x13, 0x27, 0x2b, 0x00, 0x23, 0x27, 0x3a,
+                0x09, 0x00, 0x31, 0x2c, 0x20, 0x27, 0x9d, 0x14, 0x27, 0x27, 0x3a, 0x7a, 0x16, 0x12, 0x7d, 0x2c, 0x15, 0x0f, 0x70, 0x00,
+                0x02, 0x08, 0x53, 0x2a, 0x0f, 0xc1, 0x16, 0x44, 0x00, 0x56, 0x3a, 0x05, 0x81, 0x1f, 0x0f, 0x18, 0x16, 0x1d, 0x08, 0x80,
+                0x14, 0x0f, 0x19, 0x16, 0x15, 0x07, 0x97, 0x3c, 0x00, 0x43, 0x00, 0x00, 0xa6, 0x3b, 0x0f, 0x76, 0x00, 0x1c, 0x06, 0xae,
+                0x14, 0x0f, 0x74, 0x00, 0x10, 0x21, 0x6c, 0x61, 0x94, 0x06, 0x10, 0x22, 0x4e, 0x27, 0x05, 0x5c, 0x3f, 0x03, 0x46, 0x00,
+                0x60, 0x2c, 0x20, 0x27, 0xe2, 0x96, 0x88, 0x89, 0x25, 0x0f, 0x80, 0x00, 0x4a, 0x09, 0xa2, 0x01, 0x07, 0x40, 0x15, 0x09,
+                0x77, 0x00, 0x4a, 0x3d, 0x74, 0x72, 0x75, 0xbb, 0x01, 0x0f, 0x28, 0x17, 0x31, 0x0f, 0x65, 0x30, 0x0a, 0x0f, 0x29, 0x17,
+                0x26, 0x0f, 0x98, 0x28, 0x09, 0x0f, 0x06, 0x17, 0x51, 0x0f, 0x94, 0x28, 0x17, 0x04, 0x0b, 0x00, 0x01, 0x69, 0x2a, 0x06,
+                0x0c, 0x01, 0x0f, 0x91, 0x16, 0x05, 0x0f, 0xaf, 0x06, 0x03, 0xd7, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22,
+                0x23, 0x53, 0x4d, 0x2d, 0x7e, 0x08, 0x16, 0x2d, 0x5e, 0x01, 0x63, 0x22, 0x3e, 0x53, 0x4d, 0x20, 0x28, 0xa8, 0x0f, 0xaf,
+                0x43, 0x6f, 0x72, 0x65, 0x73, 0x29, 0x3c, 0x2f, 0x61, 0x3e, 0x47, 0x06, 0x02, 0x01, 0xe1, 0x05, 0x0a, 0xb8, 0x43, 0x01,
+                0xe1, 0x05, 0x06, 0xa0, 0x00, 0x0f, 0x5a, 0x11, 0x01, 0x0f, 0xff, 0x42, 0x01, 0x0f, 0x37, 0x00, 0x0b, 0x0f, 0x8d, 0x1c,
+                0x09, 0x0f, 0xe3, 0x00, 0x07, 0x59, 0x4c, 0x31, 0x54, 0x45, 0x58, 0xda, 0x00, 0x01, 0x12, 0x00, 0x02, 0x15, 0x25, 0x0f,
+                0xd4, 0x00, 0x06, 0x0f, 0xe3, 0x00, 0x10, 0x0d, 0x9a, 0x68, 0x0d, 0x4c, 0x0a, 0x0f, 0xe3, 0x00, 0x02, 0x0f, 0x37, 0x00,
+                0x0a, 0x0f, 0xe3, 0x00, 0x24, 0x31, 0x32, 0x2d, 0x53, 0x81, 0x6a, 0xc2, 0x2d, 0x54, 0x72, 0x61, 0x66, 0x66, 0x69, 0x63,
+                0x2d, 0x42, 0x79, 0x2d, 0x35, 0x00, 0x23, 0x2d, 0x41, 0xf3, 0x6a, 0x20, 0x2d, 0x53, 0x62, 0xab, 0x24, 0x22, 0x3e, 0x0f,
+                0x26, 0x0d, 0xfa, 0x00, 0x0f, 0xe3, 0x00, 0x02, 0x0a, 0x6b, 0x69, 0x0d, 0xc7, 0x01, 0x0f, 0xe3, 0x00, 0x05, 0x0f, 0x37,
+                0x00, 0x09, 0x0f, 0xe3, 0x00, 0x23, 0x44, 0x4d, 0x61, 0x69, 0x6e, 0xd3, 0x00, 0x08, 0xcc, 0x01, 0x4f, 0x44, 0x52, 0x41,
+                0x4d, 0xc5, 0x01, 0x15, 0x0f, 0xe3, 0x00, 0x02, 0x0c, 0x66, 0x6b, 0x0c, 0xe4, 0x00, 0x0f, 0xe3, 0x00, 0x04, 0x0f, 0x37,
+                0x00, 0x0a, 0x0f, 0xe3, 0x00, 0x3b, 0x3f, 0x50, 0x43, 0x49, 0xa8, 0x02, 0x16, 0x0f, 0xe3, 0x00, 0x02, 0x0c, 0x21, 0x6b,
+                0x0f, 0xe3, 0x00, 0x14, 0x0f, 0x37, 0x00, 0x0a, 0x0f, 0xe3, 0x00, 0x03, 0x99, 0x57, 0x6f, 0x72, 0x6c, 0x64, 0x20, 0x50,
+                0x69, 0x70, 0x00, 0x1b, 0x06, 0xe3, 0x00, 0x50, 0x50, 0x72, 0x69, 0x6d, 0x69, 0x7e, 0x09, 0x70, 0x2d, 0x44, 0x61, 0x74,
+                0x61, 0x2d, 0x46, 0x66, 0x30, 0xff, 0x01, 0x3e, 0x50, 0x44, 0x41, 0x20, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x46, 0x65,
+                0x74, 0x63, 0x68, 0xeb, 0x00, 0x0e, 0x0f, 0xe3, 0x00, 0x02, 0x0a, 0xf3, 0x6b, 0x0f, 0xa9, 0x02, 0x15, 0x0f, 0x37, 0x00,
+                0x0a, 0x0f, 0xe3, 0x00, 0x38, 0x70, 0x56, 0x65, 0x72, 0x74, 0x65, 0x78, 0x20, 0x4c, 0x09, 0x1f, 0x2e, 0xe6, 0x00, 0x11,
+                0x0f, 0xe3, 0x00, 0x01, 0x0b, 0x83, 0x6c, 0x0f, 0xe3, 0x00, 0x15, 0x0f, 0x37, 0x00, 0x0a, 0x0f, 0xc6, 0x01, 0x39, 0x04,
+                0x15, 0x00, 0x03, 0x8a, 0x1b, 0x0f, 0xc7, 0x01, 0x0d, 0x0f, 0xc6, 0x01, 0x02, 0x0a, 0xa9, 0x6d, 0x0f, 0xc6, 0x01, 0x16,
+                0x0f, 0x37, 0x00, 0x09, 0x0f, 0xc7, 0x0d, 0x04, 0x10, 0x63, 0xd8, 0x6a, 0x09, 0xe4, 0x00, 0x09, 0xe3, 0x00, 0x11, 0x52,
+                0x12, 0x6e, 0x08, 0xe0, 0x00, 0x6f, 0x52, 0x41, 0x53, 0x54, 0x45, 0x52, 0x88, 0x03, 0x16, 0x0f, 0xe3, 0x00, 0x05, 0x0e,
+                0x6b, 0x6e, 0x0c, 0x4e, 0x12, 0x0f, 0xe3, 0x00, 0x02, 0x0f, 0x37, 0x00, 0x0a, 0x0f, 0xe3, 0x00, 0x35, 0x01, 0x1e, 0x16,
+                0x8f, 0x28, 0x50, 0x72, 0x65, 0x2d, 0x52, 0x4f, 0x50, 0xef, 0x07, 0x07, 0x0f, 0xc6, 0x01, 0x0e, 0x0b, 0x1c, 0x6f, 0x0f,
+                0x6f, 0x04, 0x15, 0x0f, 0x37, 0x00, 0x09, 0x0f, 0xe3, 0x00, 0x35, 0x11, 0x5a, 0xe3, 0x00, 0xaf, 0x44, 0x65, 0x70, 0x74,
+                0x68, 0x2d, 0x54, 0x65, 0x73, 0x74, 0xe6, 0x00, 0x10, 0x0f, 0xe3, 0x00, 0x01, 0x0c, 0xff, 0x6f, 0x0f, 0xe3, 0x00, 0x14,
+                0x0f, 0x37, 0x00, 0x0a, 0x0f, 0xe3, 0x00, 0x35, 0x11, 0x43, 0xe3, 0x00, 0x10, 0x43, 0x5a, 0x66, 0x6f, 0x20, 0x42, 0x6c,
+                0x65, 0x6e, 0x64, 0xe4, 0x00, 0x0f, 0x0f, 0xe3, 0x00, 0x01, 0x0c, 0xa5, 0x72, 0x0f, 0xe3, 0x00, 0x14, 0x0f, 0x37, 0x00,
+                0x0a, 0x0b, 0x6a, 0x0f, 0x06, 0x03, 0x0b, 0x05, 0xc8, 0x0a, 0x02, 0x90, 0x3b, 0x00, 0x4e, 0x5e, 0x02, 0x59, 0x2d, 0x01,
+                0x08, 0x00, 0x01, 0xc3, 0x0e, 0x0b, 0x36, 0x60, 0x02, 0x1a, 0x00, 0x04, 0x66, 0x2d, 0x02, 0x30, 0x00, 0x03, 0xf3, 0x0d,
+                0x02, 0xba, 0x4b, 0x00, 0x49, 0x00, 0x00, 0x7d, 0x44, 0x00, 0x9f, 0x0c, 0x20, 0x65, 0x6e, 0x8b, 0x68, 0x11, 0x20, 0xaf,
+                0x68, 0x0f, 0x98, 0x25, 0x09, 0x07, 0x89, 0x00, 0x0f, 0x9f, 0x25, 0x53, 0x0f, 0x24, 0x0f, 0x02, 0x0f, 0xcf, 0x2e, 0x23,
+                0x01, 0x6f, 0x0d, 0x0f, 0xcc, 0x2e, 0x30, 0x0f, 0xd4, 0x0e, 0x02, 0x0f, 0x4c, 0x0f, 0x00, 0x1f, 0x3d, 0x3d, 0x2f, 0x35,
+                0x0f, 0xd1, 0x0e, 0x07, 0x03, 0xdd, 0x01, 0x0f, 0xd3, 0x0e, 0x00, 0x0f, 0x7d, 0x00, 0x22, 0x0f, 0x7f, 0x0e, 0x2e, 0x01,
+                0x38, 0x0b, 0x20, 0x48, 0x69, 0xf5, 0x54, 0x1f, 0x65, 0x7e, 0x0e, 0x32, 0x12, 0x68, 0x4c, 0x00, 0x5f, 0x54, 0x6f, 0x74,
+                0x61, 0x6c, 0x85, 0x0e, 0x4f, 0x08, 0x6e, 0x00, 0x29, 0x20, 0x3d, 0x7d, 0x00, 0x0f, 0x93, 0x0e, 0x36, 0x0f, 0x1d, 0x25,
+                0x09, 0x01, 0xe4, 0x09, 0x10, 0x65, 0x8f, 0x23, 0x01, 0xd3, 0x46, 0x1f, 0x74, 0x34, 0x1c, 0x04, 0x63, 0x2c, 0x20, 0x27,
+                0x49, 0x44, 0x43, 0xb4, 0x32, 0x40, 0x48, 0x69, 0x74, 0x2d, 0xa6, 0x00, 0x2f, 0x20, 0x25, 0xc5, 0x33, 0x02, 0x08, 0x48,
+                0x57, 0x1f, 0x27, 0xdf, 0xb1, 0x02, 0x0f, 0xb7, 0x04, 0x02, 0x08, 0xb6, 0x56, 0x0f, 0x37, 0x00, 0x05, 0x0f, 0x21, 0x2c,
+                0x04, 0x00, 0xc9, 0x49, 0x31, 0x2c, 0x20, 0x47, 0x30, 0x6f, 0x32, 0x2c, 0x20, 0x54, 0x93, 0xa9, 0x32, 0x2c, 0x20, 0x53,
+                0xe4, 0xaa, 0x07, 0xa3, 0x05, 0x07, 0x65, 0x0e, 0x0f, 0xc6, 0x00, 0x09, 0x0b, 0xc4, 0x00, 0x0f, 0xca, 0xa9, 0x05, 0x09,
+                0xc7, 0x00, 0x0e, 0xc4, 0x00, 0x0f, 0x37, 0x00, 0x07, 0x0f, 0xc7, 0x00, 0x03, 0x32, 0x41, 0x6c, 0x6c, 0x9b, 0x00, 0x2f,
+                0x64, 0x20, 0x96, 0x0c, 0x00, 0x08, 0x8b, 0x01, 0x05, 0x3e, 0x34, 0x0f, 0x8a, 0x01, 0x0a, 0x0d, 0xc7, 0x00, 0x0f, 0x16,
+                0x79, 0x02, 0x0f, 0x20, 0x0f, 0x01, 0x0a, 0xc7, 0x00, 0x0f, 0x37, 0x00, 0x04, 0x0f, 0x5a, 0x2b, 0x81, 0x0f, 0xbb, 0x05,
+                0x39, 0x0f, 0x4b, 0x05, 0x36, 0x0f, 0xbc, 0x05, 0x01, 0x08, 0xe8, 0x03, 0x0f, 0xc3, 0x05, 0x5e, 0x0a, 0xe2, 0x04, 0x0f,
+                0xca, 0x05, 0x76, 0x00, 0x6b, 0x0f, 0x02, 0xf9, 0x02, 0x0f, 0x11, 0x35, 0x27, 0x03, 0xea, 0x47, 0x00, 0xb8, 0x38, 0x0d,
+                0x5c, 0x2b, 0x0f, 0xf3, 0x34, 0x1b, 0x07, 0xa4, 0x60, 0x01, 0x06, 0x39, 0x00, 0x5a, 0x59, 0x09, 0x4b, 0x6e, 0x0e, 0xae,
+                0x41, 0x01, 0x51, 0x00, 0x01, 0xf1, 0xbb, 0x03, 0x14, 0x6e, 0x08, 0x30, 0x00, 0x0a, 0x5e, 0x00, 0x08, 0x2d, 0x00, 0x06,
+                0x21, 0x2b, 0x0a, 0x4c, 0x60, 0x05, 0x26, 0x00, 0x21, 0x6d, 0x69, 0x28, 0x00, 0x6f, 0x50, 0x65, 0x72, 0x53, 0x65, 0x63,
+                0x5b, 0x00, 0x15, 0x09, 0x35, 0x00, 0x0f, 0x63, 0x00, 0x07, 0x0f, 0xaa, 0x4b, 0x02, 0x0b, 0xcb, 0x00, 0x0c, 0x20, 0x1b,
+                0x09, 0x65, 0x01, 0x02, 0xe6, 0x23, 0x0f, 0xde, 0x00, 0x11, 0x08, 0x4e, 0x01, 0x00, 0xc2, 0x56, 0x00, 0x39, 0x00, 0x0f,
+                0xf0, 0x00, 0x12, 0x0f, 0x80, 0x00, 0x0e, 0x0a, 0x43, 0x30, 0x00, 0xfd, 0x2f, 0x23, 0x32, 0x34, 0x07, 0x00, 0x0f, 0x1c,
+                0x01, 0x19, 0x0f, 0xa1, 0x00, 0x00, 0x0c, 0x81, 0x31, 0x05, 0x58, 0x00, 0x0c, 0x47, 0x01, 0x0f, 0x17, 0x2d, 0x3e, 0x0f,
+                0xc5, 0x43, 0x01, 0x08, 0xcd, 0x07, 0x07, 0xab, 0x0b, 0x01, 0xf6, 0x1a, 0x01, 0x64, 0x47, 0x06, 0x0d, 0x3d, 0x41, 0x52,
+                0x41, 0x4d, 0x20, 0xe1, 0x03, 0x0f, 0xa3, 0x07, 0x02, 0x0a, 0xca, 0x02, 0x0f, 0x92, 0x13, 0x65, 0x0f, 0x01, 0x00, 0x01,
+                0x08, 0x54, 0x04, 0x0f, 0xd8, 0x00, 0x05, 0x10, 0x52, 0x02, 0xc5, 0x0f, 0xd8, 0x00, 0x3a, 0x0b, 0xe6, 0x7f, 0x07, 0xa6,
+                0x00, 0x0f, 0xd8, 0x00, 0x0a, 0x0f, 0x37, 0x00, 0x07, 0x0f, 0xd8, 0x00, 0x22, 0x10, 0x57, 0x45, 0x80, 0x0f, 0x78, 0x27,
+                0x02, 0x0f, 0xd8, 0x00, 0x25, 0x0c, 0x97, 0x80, 0x06, 0xa2, 0x00, 0x0f, 0xd8, 0x00, 0x0a, 0x0f, 0x37, 0x00, 0x07, 0x0f,
+                0xd8, 0x00, 0x1d, 0x00, 0x27, 0x15, 0x0f, 0xb0, 0x01, 0x09, 0x0c, 0x6c, 0xcd, 0x0f, 0x2c, 0x23, 0x06, 0x07, 0x34, 0x15,
+                0x07, 0x2e, 0x00, 0x0e, 0x98, 0x00, 0x0f, 0xd8, 0x1e, 0x01, 0x0f, 0x37, 0x00, 0x10, 0x0f, 0xd8, 0x00, 0x22, 0x0f, 0xb0,
+                0x01, 0x08, 0x0d, 0x33, 0xce, 0x0f, 0x37, 0x22, 0x05, 0x07, 0xd8, 0x00, 0x08, 0x2e, 0x00, 0x0f, 0x9b, 0x19, 0x03, 0x0f,
+                0xd8, 0x00, 0x02, 0x0f, 0x37, 0x00, 0x0a, 0x0f, 0xd8, 0x00, 0x02, 0x0f, 0x05, 0x35, 0xac, 0x01, 0xeb, 0x00, 0x0f, 0xb1,
+                0x08, 0x1b, 0x08, 0x8a, 0x06, 0x0f, 0xb2, 0x09, 0x1c, 0x04, 0xba, 0x1e, 0x09, 0x34, 0x06, 0x0f, 0x7e, 0x00, 0x1b, 0x0f,
+                0x6f, 0x06, 0x01, 0x0f, 0xc8, 0x1e, 0x35, 0x0f, 0x7c, 0x00, 0x0d, 0x0f, 0xc6, 0x1e, 0x4b, 0x0f, 0x7e, 0x00, 0x25, 0x0f,
+                0x2c, 0x0a, 0x2e, 0x22, 0x4c, 0x32, 0x5c, 0x1b, 0x03, 0x5b, 0x1b, 0x10, 0x42, 0x28, 0x4b, 0x62, 0x64, 0x6f, 0x77, 0x6e,
+                0x42, 0x79, 0x42, 0x0a, 0x04, 0x61, 0x1b, 0x01, 0x60, 0x1b, 0x0f, 0x4f, 0x0a, 0x05, 0x3a, 0x4e, 0x6f, 0x64, 0xfa, 0x08,
+                0x08, 0x50, 0x0a, 0x62, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2c, 0xba, 0x50, 0x10, 0x41, 0xb8, 0x47, 0x20, 0x64, 0x73, 0x29,
+                0x5f, 0x5f, 0x69, 0x6c, 0x64, 0x72, 0x65, 0x9a, 0x35, 0x03, 0x01, 0x32, 0x00, 0x00, 0x1f, 0x45, 0x00, 0x08, 0x00, 0x0f,
+                0xf5, 0x07, 0x00, 0x08, 0x4b, 0x00, 0x04, 0x88, 0x67, 0x03, 0x0f, 0x00, 0x0f, 0x2e, 0x00, 0x00, 0x04, 0x6b, 0x00, 0x00,
+                0x98, 0x08, 0x03, 0x0b, 0x00, 0x0f, 0x26, 0x00, 0x00, 0x02, 0x96, 0x0d, 0x00, 0xbd, 0x5e, 0x07, 0x01, 0x00, 0x00, 0xd6,
+                0x62, 0x0b, 0x70, 0x00, 0xc9, 0x2e, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x28, 0x28, 0x61, 0x63, 0x63, 0xd5, 0x00, 0x01,
+                0xc7, 0x13, 0x59, 0x61, 0x63, 0x63, 0x20, 0x2b, 0x2d, 0x0e, 0x08, 0x22, 0x00, 0x00, 0x7e, 0x5f, 0x0f, 0x7b, 0x00, 0x09,
+                0x04, 0xca, 0x08, 0x0f, 0x7b, 0x00, 0x05, 0x38, 0x6d, 0x61, 0x70, 0x50, 0x00, 0x01, 0xfb, 0x22, 0x07, 0x0f, 0x00, 0x04,
+                0x11, 0x66, 0x70, 0x29, 0x2e, 0x6a, 0x6f, 0x69, 0x6e, 0x28, 0x00, 0x4c, 0x0c, 0x50, 0x0a, 0x07, 0x70, 0x00, 0x20, 0x48,
+                0x69, 0xac, 0x06, 0x0f, 0xeb, 0x00, 0x44, 0x00, 0x7b, 0x00, 0x07, 0x48, 0x88, 0x00, 0xed, 0x02, 0x0f, 0xfb, 0x00, 0x08,
+                0x02, 0x8b, 0x00, 0x05, 0xfe, 0x00, 0x0f, 0xfb, 0x00, 0x23, 0x07, 0x6f, 0x00, 0x0f, 0x06, 0x01, 0x0d, 0x02, 0x2c, 0x65,
+                0x0c, 0x63, 0x00, 0x02, 0xee, 0x24, 0x20, 0x20, 0x3e, 0x03, 0x5b, 0x0f, 0xc6, 0x0b, 0x02, 0x0d, 0xa8, 0x01, 0x31, 0x3d,
+                0x20, 0x27, 0x60, 0x00, 0x0f, 0x1e, 0x00, 0x03, 0x00, 0x78, 0x00, 0x0f, 0x97, 0x0b, 0x03, 0x0f, 0xf6, 0x00, 0x01, 0x0f,
+                0x4c, 0x00, 0x00, 0x0a, 0x21, 0x00, 0x0f, 0x4f, 0x00, 0x00, 0x0f, 0x2c, 0x0b, 0x00, 0x06, 0x38, 0x25, 0x05, 0xf7, 0x61,
+                0x23, 0x31, 0x2c, 0xee, 0x00, 0x06, 0xe3, 0x02, 0x00, 0x3a, 0x77, 0x23, 0x2e, 0x30, 0xcb, 0x74, 0x04, 0x15, 0x03, 0x0a,
+                0xef, 0x01, 0x01, 0x16, 0x00, 0x07, 0xe9, 0x01, 0x01, 0x10, 0x00, 0x04, 0x5f, 0x00, 0x00, 0xce, 0x01, 0x0a, 0x88, 0x04,
+                0x05, 0x7c, 0x38, 0x11, 0x70, 0x17, 0x62, 0x0f, 0x54, 0x00, 0x0d, 0x05, 0x9d, 0x00, 0x06, 0x18, 0x00, 0x02, 0x3c, 0x00,
+                0x01, 0x29, 0x02, 0x2b, 0x20, 0x2b, 0xaf, 0x75, 0x0f, 0xc2, 0x0b, 0x04, 0x13, 0x74, 0x59, 0x3a, 0x00, 0x7f, 0x04, 0x0f,
+                0x98, 0x13, 0x01, 0x00, 0x18, 0x00, 0x02, 0x12, 0x0a, 0x42, 0x27, 0x2c, 0x20, 0x5b, 0x80, 0x11, 0x0f, 0x76, 0xba, 0x0d,
+                0x59, 0x27, 0x2c, 0x20, 0x5d, 0x2c, 0x4a, 0x00, 0x08, 0x4c, 0x00, 0x02, 0x81, 0x09, 0x0f, 0x4d, 0x00, 0x16, 0x04, 0x04,
+                0x8c, 0x03, 0x55, 0x00, 0x19, 0x5d, 0xaf, 0x12, 0x08, 0x58, 0x00, 0x03, 0x01, 0x09, 0x0f, 0x59, 0x00, 0x1a, 0x01, 0xaf,
+                0x08, 0x0f, 0x5a, 0x00, 0x0e, 0x51, 0x41, 0x74, 0x6f, 0x6d, 0x69, 0x00, 0x2d, 0x0f, 0x5b, 0x00, 0x18, 0x00, 0x55, 0x92,
+                0x0f, 0x5a, 0x00, 0x0e, 0x10, 0x52, 0xdb, 0x01, 0x01, 0x5a, 0x2a, 0x0f, 0x11, 0x01, 0x1d, 0x0f, 0x10, 0x01, 0x03, 0x0a,
+                0x0e, 0x00, 0x06, 0x68, 0x00, 0x64, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0xca, 0x13, 0x0f, 0x6b, 0x00, 0x10, 0x02, 0xfe,
+                0x8c, 0x0f, 0xc9, 0x01, 0x34, 0x0a, 0xcd, 0x8d, 0x0f, 0xc9, 0x01, 0x38, 0x0b, 0xa4, 0x8d, 0x0f, 0xc9, 0x01, 0x39, 0x0a,
+                0x1e, 0x94, 0x0f, 0xc9, 0x01, 0x3c, 0x09, 0x7e, 0x93, 0x0f, 0xc9, 0x01, 0x1a, 0x4f, 0x50, 0x65, 0x65, 0x72, 0xc7, 0x01,
+                0x18, 0x00, 0x38, 0x90, 0x0f, 0xc5, 0x01, 0x34, 0x08, 0x01, 0x91, 0x0f, 0xc3, 0x01, 0x38, 0x09, 0xda, 0x90, 0x0f, 0xc1,
+                0x01, 0x39, 0x08, 0x3c, 0x98, 0x0f, 0xbf, 0x01, 0x3c, 0x07, 0xa2, 0x97, 0x0f, 0xbd, 0x01, 0x06, 0x0f, 0xc6, 0x1c, 0x01,
+                0x07, 0xd8, 0x69, 0x20, 0x6e, 0x65, 0xb8, 0x16, 0x10, 0x54, 0x42, 0x0f, 0x82, 0x52, 0x65, 0x63, 0x75, 0x72, 0x73, 0x69,
+                0x76, 0xf9, 0x0a, 0x10, 0x5f, 0x6f, 0x62, 0x20, 0x2c, 0x20, 0x96, 0xaa, 0x0b, 0xfc, 0x0c, 0x01, 0xae, 0x05, 0x02, 0xfc,
+                0x0c, 0x05, 0x29, 0x00, 0x08, 0xe2, 0x05, 0x0a, 0x2b, 0x56, 0x13, 0x30, 0x26, 0x56, 0x01, 0x49, 0x00, 0x0f, 0x27, 0x56,
+                0x0e, 0x4c, 0x69, 0x69, 0x20, 0x3e, 0x09, 0x7e, 0x01, 0x91, 0x06, 0x0f, 0x6c, 0x0d, 0x1b, 0x0f, 0x4e, 0x0b, 0x12, 0x0e,
+                0x76, 0x07, 0x00, 0xb5, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x4e, 0x14, 0x00, 0xaf, 0x00, 0x00, 0x80, 0x56, 0x0a, 0x30, 0x00,
+                0x00, 0x22, 0x00, 0x03, 0x29, 0x16, 0x00, 0xe7, 0x54, 0x03, 0x7a, 0x50, 0x00, 0x2d, 0x00, 0x09, 0xe8, 0x07, 0x02, 0x38,
+                0x01, 0x06, 0xa5, 0x07, 0x0f, 0xcf, 0x6c, 0x00, 0x09, 0x4c, 0x00, 0x06, 0x39, 0x08, 0x0d, 0x4b, 0x00, 0x06, 0x33, 0x08,
+                0x40, 0x22, 0x20, 0x2f, 0x20, 0x72, 0x59, 0x0a, 0x5b, 0x00, 0x08, 0x20, 0x00, 0x01, 0x65, 0x00, 0x10, 0x22, 0x66, 0x00,
+                0x0f, 0x1f, 0x2d, 0x17, 0x01, 0x4e, 0x00, 0x0f, 0x24, 0x2d, 0x0c, 0x01, 0x24, 0x00, 0x03, 0xfb, 0x0b, 0x0f, 0x37, 0x2b,
+                0x0a, 0x0f, 0x6c, 0x00, 0x23, 0x01, 0xd3, 0x0d, 0x11, 0x27, 0x25, 0x60, 0x2f, 0x27, 0x3a, 0x35, 0x0d, 0x01, 0x0a, 0x26,
+                0x01, 0x29, 0x29, 0x7d, 0x01, 0x0e, 0x03, 0x1d, 0x00, 0x0c, 0xc3, 0x08, 0x0f, 0x89, 0x00, 0x42, 0x0f, 0x7b, 0x01, 0x02,
+                0x0b, 0x90, 0x00, 0x0b, 0xfa, 0x01, 0x0f, 0x97, 0x00, 0x30, 0x06, 0x81, 0x0e, 0x0f, 0x9c, 0x00, 0x22, 0x07, 0xb6, 0x0e,
+                0x0a, 0x24, 0x00, 0x04, 0xbd, 0x0e, 0x08, 0xfd, 0x10, 0x04, 0x89, 0x03, 0x0a, 0x2a, 0x00, 0x00, 0x95, 0x03, 0x1f, 0x2e,
+                0x97, 0x03, 0x00, 0x0f, 0x40, 0x04, 0x08, 0x03, 0x36, 0x02, 0x05, 0x1c, 0x0e, 0x0f, 0x78, 0x03, 0x09, 0x0f, 0x6d, 0x17,
+                0x02, 0x05, 0x47, 0x04, 0x22, 0x6a, 0x6a, 0x4d, 0x6c, 0x23, 0x6a, 0x6a, 0x47, 0x04, 0x02, 0x5e, 0x0a, 0x00, 0x45, 0x04,
+                0x2e, 0x6a, 0x6a, 0x94, 0x00, 0x0f, 0x64, 0x01, 0x03, 0x0f, 0xd8, 0x02, 0x02, 0x1e, 0x27, 0x36, 0x04, 0x0f, 0x3e, 0x00,
+                0x0b, 0x2f, 0x72, 0x61, 0x37, 0x00, 0x59, 0x04, 0xf8, 0x01, 0x0f, 0x3c, 0x00, 0x03, 0x0a, 0x43, 0x01, 0x08, 0x0e, 0x00,
+                0x0f, 0x63, 0x0b, 0x06, 0x40, 0x72, 0x6f, 0x77, 0x46, 0x9e, 0x84, 0x0f, 0x4a, 0x05, 0x16, 0x0f, 0x44, 0x05, 0x03, 0x01,
+                0x44, 0x00, 0x08, 0x12, 0x63, 0x0f, 0x06, 0x02, 0x07, 0x01, 0x2b, 0x00, 0x00, 0x83, 0x02, 0x07, 0xdd, 0x0b, 0x0f, 0x22,
+                0x63, 0x0e, 0x0f, 0xc7, 0x10, 0x07, 0x6f, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0xba, 0x10, 0xff, 0xff, 0xff, 0xff, 0xa6,
+                0x00, 0xd7, 0x50, 0x01, 0x90, 0x4b, 0x0f, 0xd9, 0x0b, 0x08, 0x07, 0x2e, 0xba, 0x0f, 0x2d, 0x0d, 0x0b, 0x0c, 0x33, 0x32,
+                0x0a, 0x53, 0x31, 0x0e, 0x37, 0x32, 0x0f, 0x73, 0x00, 0x0a, 0x04, 0xd0, 0xa0, 0x0f, 0x73, 0x00, 0x01, 0x0f, 0x7c, 0x11,
+                0x18, 0x0f, 0x22, 0xa6, 0x08, 0x0f, 0x5a, 0x00, 0x03, 0x0f, 0xfe, 0x0d, 0x19, 0x0f, 0x7c, 0xa7, 0x10, 0x0f, 0x5c, 0x0d,
+                0x04, 0x0f, 0x10, 0x0e, 0x1c, 0x0f, 0xe8, 0xa6, 0x11, 0x0f, 0x6a, 0x00, 0x12, 0x0f, 0x22, 0x0e, 0x0f, 0x0f, 0xcf, 0xa8,
+                0x10, 0x0f, 0x6a, 0x00, 0x12, 0x0f, 0x34, 0x0e, 0x12, 0x0f, 0x3f, 0xa8, 0x0f, 0x0f, 0x6c, 0x00, 0x06, 0x0e, 0x12, 0x00,
+                0x0f, 0x07, 0x10, 0x1d, 0x0f, 0xe4, 0xa5, 0x06, 0x0f, 0x19, 0x02, 0x44, 0x0f, 0x23, 0x10, 0x10, 0x0f, 0x17, 0x02, 0x31,
+                0x0f, 0x33, 0x10, 0x11, 0x0f, 0x15, 0x02, 0x32, 0x0f, 0x43, 0x10, 0x10, 0x0f, 0x13, 0x02, 0x35, 0x0f, 0x53, 0x10, 0x0d,
+                0x0f, 0x11, 0x02, 0x0d, 0x0f, 0xe1, 0x13, 0x15, 0x0f, 0x8e, 0xa5, 0x08, 0x0f, 0x15, 0x02, 0x44, 0x0f, 0xfd, 0x13, 0x12,
+                0x0f, 0x17, 0x02, 0x31, 0x0f, 0x0d, 0x14, 0x13, 0x0f, 0x19, 0x02, 0x32, 0x0f, 0x1d, 0x14, 0x12, 0x0f, 0x1b, 0x02, 0x35,
+                0x0f, 0x2d, 0x14, 0x0f, 0x0f, 0x1d, 0x02, 0x01, 0x0f, 0xec, 0x12, 0x07, 0x0c, 0x87, 0x33, 0x0f, 0x90, 0x00, 0x10, 0x1f,
+                0x70, 0x4b, 0x06, 0x04, 0x0f, 0xa5, 0x06, 0x1e, 0x0e, 0x45, 0xb2, 0x0f, 0x76, 0x02, 0x37, 0x0f, 0x1f, 0xb3, 0x07, 0x0f,
+                0x75, 0x02, 0x3b, 0x0f, 0x09, 0xb3, 0x08, 0x0f, 0xcc, 0x05, 0x50, 0x0c, 0x28, 0xb2, 0x0f, 0x40, 0x01, 0x43, 0x0f, 0xca,
+                0x05, 0x47, 0x0f, 0xe8, 0xb2, 0x06, 0x0f, 0xf7, 0x04, 0x52, 0x0e, 0xff, 0xb1, 0x0f, 0x40, 0x01, 0x43, 0x0f, 0xf5, 0x04,
+                0x49, 0x0f, 0xc3, 0xb2, 0x08, 0x0f, 0x1e, 0x04, 0x30, 0x01, 0x5b, 0xb7, 0x10, 0x20, 0x36, 0x0b, 0x02, 0x31, 0x8a, 0x0f,
+                0x90, 0x00, 0x0f, 0x04, 0x90, 0xb7, 0x0f, 0x23, 0x04, 0x34, 0x0f, 0x38, 0xbb, 0x05, 0x0f, 0xa9, 0x01, 0x37, 0x0f, 0x24,
+                0xbc, 0x0d, 0x0f, 0xaf, 0x01, 0x3b, 0x0f, 0x08, 0xbc, 0x0e, 0x0f, 0x35, 0x04, 0x50, 0x0f, 0x09, 0xbb, 0x03, 0x0f, 0x52,
+                0x01, 0x49, 0x0f, 0x41, 0x04, 0x47, 0x0f, 0xd5, 0xbb, 0x0c, 0x0f, 0x47, 0x04, 0x52, 0x0f, 0xce, 0xba, 0x05, 0x0f, 0x52,
+                0x01, 0x49, 0x0f, 0x53, 0x04, 0x49, 0x0f, 0x9e, 0xbb, 0x0e, 0x0f, 0x59, 0x04, 0x24, 0x0f, 0xc6, 0x1c, 0x05, 0x3f, 0x46,
+                0x42, 0x50, 0x95, 0x0f, 0x16, 0x20, 0x66, 0x62, 0x1a, 0x9c, 0x0f, 0x95, 0x0f, 0x08, 0x00, 0xb1, 0x39, 0x0f, 0xe4, 0x00,
+                0x10, 0x00, 0x5a, 0x39, 0x0f, 0xa3, 0x04, 0x34, 0x0f, 0x07, 0xaf, 0x01, 0x0f, 0xfb, 0x01, 0x37, 0x0f, 0xe7, 0xaf, 0x09,
+                0x0f, 0xf7, 0x01, 0x3b, 0x0f, 0xcf, 0xaf, 0x0a, 0x0f, 0x97, 0x04, 0x50, 0x0e, 0xe4, 0xae, 0x0f, 0x46, 0x01, 0x45, 0x0f,
+                0x8f, 0x04, 0x47, 0x0f, 0xa8, 0xaf, 0x08, 0x0f, 0x8b, 0x04, 0x52, 0x0f, 0xb5, 0xae, 0x01, 0x0f, 0x46, 0x01, 0x45, 0x0f,
+                0x83, 0x04, 0x49, 0x0f, 0x7d, 0xaf, 0x0a, 0x0f, 0xd8, 0x08, 0x30, 0x00, 0xf4, 0x3c, 0x0f, 0x87, 0x00, 0x10, 0x00, 0x9d,
+                0x3c, 0x0f, 0x26, 0x04, 0x34, 0x0f, 0xbd, 0xc8, 0x01, 0x0f, 0x9a, 0x01, 0x37, 0x0f, 0x9d, 0xc9, 0x09, 0x0f, 0x9a, 0x01,
+                0x3b, 0x0f, 0x85, 0xc9, 0x0a, 0x0f, 0x26, 0x04, 0x50, 0x0e, 0x9a, 0xc8, 0x0f, 0x46, 0x01, 0x45, 0x0f, 0x26, 0x04, 0x47,
+                0x0f, 0x5e, 0xc9, 0x08, 0x0f, 0x26, 0x04, 0x52, 0x0f, 0x6b, 0xc8, 0x01, 0x0f, 0x46, 0x01, 0x45, 0x0f, 0x26, 0x04, 0x49,
+                0x0f, 0x33, 0xc9, 0x0a, 0x0f, 0xa5, 0x08, 0x3c, 0x3f, 0x48, 0x55, 0x42, 0xa5, 0x08, 0x16, 0x0f, 0x12, 0xd1, 0x00, 0x00,
+                0xa7, 0x51, 0x0f, 0xe2, 0xcf, 0x1c, 0x0f, 0x33, 0x00, 0x1c, 0x0f, 0xa4, 0x27, 0x11, 0x00, 0xd7, 0x59, 0x0f, 0xc9, 0x00,
+                0xa8, 0x0f, 0x77, 0x05, 0x1b, 0x0f, 0xc2, 0x00, 0x08, 0x0f, 0xea, 0x02, 0x2f, 0x0f, 0x7a, 0xd3, 0x0d, 0x0f, 0xe9, 0x02,
+                0x36, 0x0f, 0x63, 0xd3, 0x0e, 0x0f, 0x74, 0x05, 0x4b, 0x0f, 0xd2, 0x01, 0x06, 0x0f, 0x43, 0x01, 0x41, 0x0f, 0x72, 0x05,
+                0x42, 0x0f, 0x3f, 0xd3, 0x0c, 0x0f, 0x71, 0x05, 0x4d, 0x0f, 0xe0, 0x02, 0x1b, 0x0f, 0x43, 0x01, 0x2e, 0x0f, 0x6f, 0x05,
+                0x44, 0x0f, 0x17, 0xd3, 0x0e, 0x0f, 0x6e, 0x05, 0x28, 0x0f, 0x1c, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x46,
+                0x31, 0x54, 0x65, 0x78, 0xa2, 0x3e, 0x0f, 0x14, 0x44, 0x27, 0x31, 0x6c, 0x73, 0x75, 0xf8, 0x02, 0x10, 0x41, 0xbb, 0xb3,
+                0x01, 0x0f, 0x00, 0x01, 0xf6, 0x02, 0x02, 0x08, 0x00, 0x05, 0x78, 0x6f, 0x31, 0x74, 0x65, 0x78, 0x17, 0x00, 0x02, 0x08,
+                0x00, 0x0f, 0x26, 0x79, 0x27, 0x09, 0x6e, 0x00, 0x00, 0x54, 0x29, 0x08, 0x10, 0x00, 0x0f, 0x30, 0x00, 0x03, 0x02, 0xfa,
+                0x98, 0x02, 0x09, 0x00, 0x0f, 0x22, 0x00, 0x06, 0x06, 0x1d, 0x06, 0x09, 0x10, 0x00, 0x0f, 0x25, 0x4a, 0x01, 0x29, 0x65,
+                0x78, 0x82, 0x00, 0x00, 0xc4, 0x88, 0x0f, 0x27, 0x00, 0x03, 0x02, 0x79, 0x00, 0x02, 0x09, 0x00, 0x0f, 0x22, 0x00, 0x06,
+                0x07, 0xad, 0x79, 0x08, 0x10, 0x00, 0x0f, 0xac, 0x42, 0x37, 0x0a, 0x6d, 0x61, 0x0b, 0x50, 0x3f, 0x00, 0xd7, 0x0c, 0x1f,
+                0x61, 0xcf, 0x74, 0x00, 0x06, 0xcb, 0x60, 0x43, 0x6e, 0x73, 0x74, 0x5f, 0x61, 0x6e, 0x15, 0x64, 0xca, 0xc0, 0x0f, 0x1a,
+                0x40, 0x14, 0x0f, 0x41, 0x00, 0x1a, 0x0f, 0x52, 0x00, 0x0d, 0x0f, 0x4f, 0x00, 0x06, 0x00, 0x72, 0x26, 0x0f, 0x90, 0x00,
+                0x2a, 0x0f, 0x41, 0x00, 0x00, 0x0f, 0xa0, 0x40, 0x0c, 0xa0, 0x4d, 0x49, 0x4f, 0x20, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x65,
+                0x37, 0x8f, 0x47, 0x51, 0x75, 0x65, 0x75, 0x37, 0x42, 0x4f, 0x2c, 0x20, 0x27, 0x72, 0x54, 0x01, 0x0a, 0x62, 0x6d, 0x69,
+                0x6f, 0x5f, 0x70, 0x71, 0x32, 0x41, 0x0a, 0xa3, 0x63, 0x0b, 0x1f, 0x01, 0x0f, 0xc4, 0x00, 0x05, 0x0f, 0x41, 0x00, 0x16,
+                0x0f, 0x54, 0x01, 0x13, 0x0f, 0x4f, 0x00, 0x0c, 0x06, 0x1f, 0x01, 0x0f, 0x90, 0x00, 0x24, 0x03, 0x41, 0x00, 0x0f, 0x54,
+                0x01, 0x0c, 0x11, 0x49, 0x50, 0xb3, 0x0f, 0x5a, 0x69, 0x04, 0x0f, 0xa8, 0x02, 0x0a, 0x03, 0x0a, 0x4c, 0x54, 0x6c, 0x73,
+                0x75, 0x69, 0x6e, 0xd6, 0x4c, 0x0f, 0xad, 0x41, 0x06, 0x0f, 0xc4, 0x00, 0x01, 0x0f, 0x41, 0x00, 0x1a, 0x0f, 0x54, 0x01,
+                0x0f, 0x04, 0x9a, 0x4c, 0x80, 0x65, 0x78, 0x69, 0x6e, 0x5f, 0x73, 0x6d, 0x32, 0x0e, 0x00, 0x3f, 0x72, 0x65, 0x71, 0x0b,
+                0x69, 0x03, 0x0f, 0x90, 0x00, 0x08, 0x0f, 0x41, 0x00, 0x10, 0x0f, 0xa8, 0x02, 0x0d, 0x60, 0x2d, 0x53, 0x74, 0x61, 0x67,
+                0x65, 0xcd, 0x9d, 0x4d, 0x58, 0x42, 0x41, 0x52, 0xfc, 0x03, 0x0a, 0xa8, 0x02, 0x0f, 0xec, 0x5b, 0x03, 0x0f, 0x45, 0xc5,
+                0x0d, 0x2f, 0x27, 0x29, 0xf6, 0x5b, 0x0c, 0x0f, 0x41, 0x00, 0x10, 0x0f, 0x54, 0x01, 0x03, 0x0f, 0x90, 0x00, 0x20, 0x02,
+                0x6b, 0x02, 0x0f, 0x90, 0x00, 0x28, 0x01, 0x41, 0x00, 0x0f, 0x56, 0x01, 0x0c, 0x00, 0x4b, 0x01, 0x00, 0x53, 0x01, 0x03,
+                0x5e, 0x01, 0x0f, 0x56, 0x01, 0x24, 0x0f, 0x2c, 0xc6, 0x0b, 0x0f, 0xc6, 0x00, 0x10, 0x0f, 0x41, 0x00, 0x0e, 0x0f, 0x56,
+                0x01, 0x1b, 0x0f, 0x94, 0xc6, 0x0b, 0x0f, 0x90, 0x00, 0x2b, 0x0f, 0x56, 0x01, 0x11, 0x00, 0xcf, 0x55, 0x0f, 0x59, 0x6d,
+                0x06, 0x0f, 0x00, 0x04, 0x11, 0x45, 0x64, 0x61, 0x74, 0x61, 0xff, 0x00, 0x60, 0x5f, 0x77, 0x61, 0x76, 0x65, 0x66, 0xc1,
+                0x6f, 0x0b, 0xc9, 0x03, 0x0f, 0x70, 0x03, 0x08, 0x0f, 0x41, 0x00, 0x13, 0x0f, 0x00, 0x04, 0x16, 0x06, 0x4f, 0x00, 0x00,
+                0x0f, 0x00, 0x0f, 0x90, 0x00, 0x2a, 0x0f, 0x41, 0x00, 0x06, 0x0f, 0x54, 0x01, 0x0c, 0x00, 0xbd, 0x2d, 0x30, 0x46, 0x69,
+                0x6c, 0xa5, 0x06, 0x0f, 0x5f, 0x69, 0x01, 0x08, 0x54, 0x01, 0x0f, 0xd8, 0x6f, 0x29, 0x0f, 0xc4, 0x6f, 0x2b, 0x0f, 0x54,
+                0x01, 0x9c, 0x01, 0x6c, 0x12, 0x00, 0xf3, 0xbe, 0x0f, 0xad, 0x02, 0x01, 0x0f, 0xa8, 0x06, 0x14, 0x02, 0x71, 0x12, 0x00,
+                0x45, 0x00, 0x0f, 0x0c, 0x68, 0x06, 0x0f, 0xa8, 0x06, 0x0b, 0x0f, 0x41, 0x00, 0x10, 0x0f, 0xa8, 0x06, 0x19, 0x0f, 0x90,
+                0x00, 0x2b, 0x0f, 0x41, 0x00, 0x10, 0x0f, 0x18, 0x49, 0xa8, 0x04, 0x1c, 0x48, 0x02, 0x18, 0x0c, 0x0f, 0xa1, 0x47, 0x1b,
+                0x09, 0x4c, 0x0c, 0x0f, 0x54, 0x87, 0x13, 0x0a, 0xe1, 0x0c, 0x00, 0x71, 0x12, 0x0f, 0x34, 0x48, 0x03, 0x04, 0x68, 0x0d,
+                0x0f, 0x37, 0x48, 0x20, 0x0f, 0x96, 0x00, 0x20, 0x0a, 0xf5, 0x0c, 0x0f, 0x96, 0x00, 0x07, 0x04, 0xe7, 0x0d, 0x0f, 0xf6,
+                0x52, 0x21, 0x09, 0x1a, 0x0e, 0x0f, 0xa4, 0x01, 0x23, 0x02, 0x44, 0x00, 0x0f, 0x78, 0x00, 0x36, 0x0f, 0x48, 0x49, 0x2f,
+                0x01, 0x65, 0x0f, 0x0b, 0x7e, 0x38, 0x0f, 0x76, 0x38, 0xc8, 0x0f, 0xaf, 0x35, 0x03, 0x0f, 0x92, 0x35, 0x25, 0x0f, 0x34,
+                0x35, 0x37, 0x60, 0x4c, 0x53, 0x55, 0x20, 0x62, 0x79, 0xed, 0x18, 0x02, 0x24, 0x18, 0x02, 0xb8, 0x04, 0x0d, 0x26, 0x18,
+                0x05, 0x3c, 0x09, 0x0f, 0x82, 0x1c, 0x0a, 0x02, 0x09, 0x59, 0x0f, 0x49, 0x00, 0x12, 0x10, 0x5f, 0x60, 0x18, 0x03, 0x69,
+                0xc8, 0x00, 0x44, 0xd1, 0x01, 0x3e, 0x74, 0x0f, 0x35, 0x00, 0x1c, 0x11, 0x73, 0x76, 0x7b, 0x0f, 0x35, 0x00, 0x1c, 0x03,
+                0xc6, 0x2f, 0x0f, 0x37, 0x00, 0x1d, 0x06, 0x90, 0x2f, 0x0f, 0x38, 0x1a, 0x06, 0x02, 0xfe, 0x00, 0x31, 0x20, 0x4c, 0x6f,
+                0x9b, 0x19, 0x0f, 0x03, 0x01, 0x23, 0x0f, 0x67, 0x19, 0x03, 0x0d, 0x64, 0x00, 0x43, 0x53, 0x74, 0x6f, 0x72, 0xcd, 0x2f,
+                0x0f, 0x33, 0x01, 0x20, 0x0f, 0x65, 0x00, 0x14, 0x00, 0x31, 0x31, 0x0f, 0x64, 0x00, 0x21, 0x0f, 0x28, 0x31, 0x0a, 0x0d,
+                0x66, 0x00, 0x11, 0x52, 0x59, 0x01, 0x0f, 0x65, 0x00, 0x1e, 0x0f, 0x20, 0x31, 0x07, 0x0f, 0x18, 0x24, 0x07, 0x01, 0xaf,
+                0x5b, 0x0f, 0x6d, 0x00, 0x17, 0x10, 0x6c, 0x2f, 0x00, 0x0f, 0x9d, 0x02, 0x1c, 0x05, 0x34, 0x00, 0x05, 0x69, 0x01, 0x0f,
+                0x00, 0x01, 0x06, 0x01, 0x8e, 0x00, 0x0f, 0x2e, 0x02, 0x1c, 0x0a, 0x93, 0x00, 0x0f, 0x62, 0x01, 0x0d, 0x02, 0x62, 0x00,
+                0x0f, 0x2c, 0x02, 0x1c, 0x0e, 0xc2, 0x00, 0x0f, 0x53, 0x21, 0x23, 0x00, 0x61, 0x0b, 0x0f, 0x59, 0x04, 0x15, 0x0f, 0x1a,
+                0x39, 0x04, 0x07, 0x4d, 0x00, 0x02, 0x5a, 0x5d, 0x0f, 0x4a, 0x00, 0x12, 0x01, 0xc6, 0x00, 0x00, 0xfc, 0xa2, 0x02, 0x31,
+                0x00, 0x0f, 0x84, 0x01, 0x0a, 0x03, 0x58, 0x00, 0x02, 0x85, 0x67, 0x0f, 0x5e, 0x00, 0x1e, 0x00, 0x26, 0x01, 0x06, 0xbb,
+                0x00, 0x0f, 0x8a, 0x01, 0x09, 0x04, 0x68, 0x00, 0x0f, 0xee, 0x01, 0x13, 0x0f, 0x67, 0x00, 0x00, 0x0f, 0xf0, 0x01, 0x06,
+                0x0f, 0xee, 0x02, 0x07, 0x04, 0x85, 0x5e, 0x0f, 0x6f, 0x00, 0x16, 0x15, 0x73, 0x31, 0x00, 0x0f, 0x34, 0x01, 0x0a, 0x03,
+                0x58, 0x00, 0x0f, 0xcc, 0x00, 0x1c, 0x03, 0x5d, 0x00, 0x0f, 0xbc, 0x02, 0x16, 0x04, 0x66, 0x00, 0x0f, 0xbe, 0x02, 0x14,
+                0x0f, 0x67, 0x00, 0x00, 0x0f, 0xeb, 0x04, 0x12, 0x04, 0x67, 0x00, 0x0f, 0xec, 0x04, 0x13, 0x0f, 0x66, 0x00, 0x00, 0x0f,
+                0xed, 0x04, 0x14, 0x04, 0x68, 0x00, 0x0f, 0xee, 0x04, 0x12, 0x0f, 0x67, 0x00, 0x00, 0x0f, 0xef, 0x04, 0x15, 0x0f, 0x8e,
+                0x03, 0x0c, 0x00, 0xde, 0x09, 0x10, 0x61, 0x18, 0x01, 0x0f, 0x91, 0x03, 0x2d, 0x71, 0x31, 0x44, 0x20, 0x42, 0x75, 0x66,
+                0x66, 0x2d, 0x22, 0x0f, 0xce, 0x00, 0x10, 0x03, 0x8d, 0x0a, 0x44, 0x31, 0x64, 0x5f, 0x62, 0x36, 0x00, 0x0f, 0xa5, 0x49,
+                0x0b, 0x80, 0x31, 0x44, 0x20, 0x6f, 0x72, 0x20, 0x32, 0x44, 0x54, 0x61, 0x10, 0x2f, 0x3d, 0x01, 0x0f, 0x68, 0x00, 0x1d,
+                0x1f, 0x32, 0xb9, 0x4a, 0x0f, 0x07, 0x5e, 0x00, 0x00, 0x2e, 0x1c, 0x73, 0x20, 0x4d, 0x69, 0x70, 0x6d, 0x61, 0x70, 0x2c,
+                0x21, 0x0f, 0x6a, 0x00, 0x14, 0x61, 0x32, 0x64, 0x5f, 0x6e, 0x6f, 0x6d, 0x39, 0x00, 0x0f, 0x70, 0x00, 0x0e, 0x1f, 0x33,
+                0xce, 0x00, 0x24, 0x01, 0x5a, 0x7d, 0x0f, 0x5b, 0x00, 0x0b, 0x42, 0x43, 0x75, 0x62, 0x65, 0x83, 0x00, 0x0f, 0x57, 0x00,
+                0x17, 0x15, 0x63, 0x34, 0x00, 0x0f, 0xd6, 0x4a, 0xff, 0x56, 0x0f, 0x7a, 0x44, 0x04, 0x02, 0x77, 0x1f, 0x0f, 0x7a, 0x44,
+                0x46, 0x09, 0x7a, 0x00, 0x0a, 0x79, 0x44, 0x0e, 0x7a, 0x00, 0x0f, 0x79, 0x44, 0x2f, 0x06, 0x6f, 0x00, 0x0d, 0x78, 0x44,
+                0x0f, 0xe9, 0x00, 0x39, 0x0f, 0x78, 0x44, 0x10, 0x0c, 0x8a, 0x00, 0x07, 0x77, 0x44, 0x0f, 0xf9, 0x00, 0x21, 0x0f, 0x77,
+                0x44, 0x1c, 0x0e, 0x63, 0x00, 0x09, 0x77, 0x44, 0x0c, 0xa8, 0x02, 0x0f, 0x73, 0x44, 0x06, 0x0f, 0x6e, 0x44, 0x13, 0x0f,
+                0x69, 0x44, 0x09, 0x0f, 0x64, 0x44, 0x15, 0x07, 0xbd, 0x67, 0x04, 0x3f, 0x01, 0x0e, 0x6c, 0x24, 0x0a, 0x67, 0x24, 0x0f,
+                0x62, 0x24, 0x20, 0x0f, 0x5d, 0x24, 0x0b, 0x0f, 0x58, 0x24, 0x0a, 0x0f, 0x56, 0x24, 0xff, 0x45, 0x0f, 0x51, 0x24, 0x0c,
+                0x0f, 0x4c, 0x24, 0x60, 0x0f, 0x47, 0x24, 0x0c, 0x0f, 0x42, 0x24, 0x0e, 0x0f, 0x18, 0x24, 0x24, 0x0f, 0xb9, 0x22, 0xad,
+                0x2f, 0x53, 0x6d, 0xb6, 0x22, 0x31, 0x00, 0x07, 0x20, 0x13, 0x45, 0x06, 0x20, 0x21, 0x2c, 0x20, 0xb4, 0x16, 0x3f, 0x69,
+                0x74, 0x79, 0x20, 0x92, 0x0f, 0x0f, 0x9e, 0x22, 0x0b, 0x08, 0x56, 0x00, 0x29, 0x20, 0x3d, 0x65, 0x00, 0x0f, 0x2e, 0x00,
+                0x00, 0x04, 0x76, 0x00, 0x25, 0x20, 0x3d, 0x81, 0x00, 0x0f, 0xba, 0x91, 0x3e, 0x00, 0x10, 0x09, 0x0f, 0x9e, 0x6c, 0x06,
+                0x3e, 0x61, 0x64, 0x75, 0xaf, 0x81, 0x0f, 0x26, 0x21, 0x05, 0x02, 0x2d, 0x00, 0x0f, 0xeb, 0x19, 0x0d, 0x24, 0x2c, 0x20,
+                0x87, 0x8e, 0x60, 0x64, 0x20, 0x62, 0x72, 0x61, 0x6e, 0xf9, 0x8c, 0x01, 0xc7, 0x8e, 0x13, 0x69, 0x0a, 0x6d, 0x01, 0x8b,
+                0x01, 0x0f, 0x0a, 0x6d, 0x05, 0x0f, 0xba, 0x6b, 0x03, 0x2f, 0x61, 0x6c, 0xa7, 0x00, 0x19, 0x01, 0x2d, 0x00, 0x0f, 0xa7,
+                0x00, 0x10, 0x51, 0x49, 0x4e, 0x54, 0x33, 0x32, 0xaa, 0x8d, 0x50, 0x70, 0x74, 0x20, 0x6d, 0x75, 0x82, 0x03, 0x83, 0x6c,
+                0x79, 0x3b, 0x20, 0x46, 0x50, 0x33, 0x32, 0x79, 0x71, 0x24, 0x69, 0x73, 0x76, 0x9c, 0x0f, 0xa7, 0x00, 0x12, 0x2f, 0x63,
+                0x62, 0xa7, 0x00, 0x18, 0x02, 0x2d, 0x00, 0x0f, 0xa7, 0x00, 0x10, 0x60, 0x44, 0x69, 0x76, 0x65, 0x72, 0x67, 0x0a, 0x82,
+                0x09, 0x4f, 0x01, 0x00, 0xf0, 0xd9, 0x41, 0x72, 0x6f, 0x6c, 0x20, 0x45, 0xa9, 0x0f, 0x3e, 0x00, 0x04, 0x0f, 0xa7, 0x00,
+                0x03, 0x24, 0x66, 0x6d, 0xa1, 0x1a, 0x0f, 0xa7, 0x00, 0x10, 0x02, 0x2d, 0x00, 0x0f, 0xa7, 0x00, 0x10, 0x01, 0x37, 0x01,
+                0x71, 0x6d, 0x75, 0x6c, 0x2f, 0x61, 0x64, 0x64, 0xa1, 0x00, 0x02, 0x5f, 0x01, 0x04, 0x58, 0x01, 0x0f, 0x3f, 0x00, 0x09,
+                0x0f, 0xa7, 0x00, 0x04, 0x3b, 0x70, 0x31, 0x36, 0x36, 0x00, 0x0f, 0xa7, 0x00, 0x08, 0x01, 0x2d, 0x00, 0x0f, 0xa7, 0x00,
+                0x12, 0x24, 0x31, 0x36, 0xa7, 0x00, 0x0f, 0xb3, 0x1c, 0x1c, 0x0f, 0xa7, 0x00, 0x05, 0x2f, 0x36, 0x34, 0xa7, 0x00, 0x18,
+                0x00, 0x2d, 0x00, 0x0f, 0xa7, 0x00, 0x12, 0x2f, 0x36, 0x34, 0xa7, 0x00, 0x3a, 0x2f, 0x69, 0x70, 0xf5, 0x01, 0x18, 0x02,
+                0x2d, 0x00, 0x0f, 0xa7, 0x00, 0x10, 0x09, 0x7b, 0x8d, 0x06, 0xb3, 0xae, 0x10, 0x69, 0x24, 0x1c, 0x37, 0x70, 0x6f, 0x6c,
+                0xb7, 0x9f, 0x0f, 0xa7, 0x00, 0x14, 0x00, 0x7c, 0x17, 0x0f, 0xa7, 0x00, 0x16, 0x02, 0x2d, 0x00, 0x0f, 0xa7, 0x00, 0x10,
+                0x04, 0xba, 0x70, 0x01, 0xf5, 0x13, 0x10, 0x2c, 0xb0, 0x00, 0x51, 0x72, 0x65, 0x64, 0x20, 0x6d, 0xfa, 0x30, 0x03, 0x64,
+                0x93, 0x3f, 0x69, 0x73, 0x63, 0xea, 0x03, 0x18, 0x5d, 0x74, 0x65, 0x6e, 0x73, 0x6f, 0x62, 0x80, 0x0f, 0x5e, 0x26, 0x06,
+                0x01, 0x2d, 0x00, 0x0f, 0xa8, 0x00, 0x10, 0x11, 0x54, 0x2a, 0x00, 0x75, 0x20, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x3b,
+                0x03, 0x20, 0x20, 0x28, 0xb5, 0x02, 0x10, 0x2c, 0x51, 0x03, 0x5f, 0x38, 0x2f, 0x34, 0x2f, 0x31, 0xca, 0xa4, 0x02, 0x0f,
+                0xa8, 0x00, 0x05, 0x1f, 0x78, 0x4f, 0x01, 0x17, 0x02, 0x2d, 0x00, 0x0f, 0xa7, 0x00, 0x12, 0x02, 0xe7, 0x13, 0x00, 0x39,
+                0x01, 0x03, 0xbd, 0x11, 0x03, 0x4d, 0x01, 0x0f, 0xab, 0x02, 0x0e, 0x0f, 0xa7, 0x00, 0x03, 0x30, 0x75, 0x6e, 0x69, 0x20,
+                0x09, 0x0b, 0x9c, 0x20, 0x0f, 0xa7, 0x00, 0x04, 0x04, 0x2d, 0x00, 0x0f, 0xa9, 0x00, 0x10, 0x00, 0xa2, 0x88, 0x20, 0x2d,
+                0x6c, 0x5a, 0x08, 0x10, 0x20, 0x4c, 0xe8, 0x50, 0x61, 0x72, 0x20, 0x6f, 0x70, 0x8b, 0x08, 0x0e, 0x07, 0x29, 0x0f, 0xa9,
+                0x00, 0x14, 0x1d, 0x78, 0x9e, 0x02, 0x0f, 0xa9, 0x00, 0x08, 0x02, 0x2d, 0x00, 0x0f, 0x50, 0x01, 0x11, 0x31, 0x72, 0x61,
+                0x6e, 0xb0, 0x77, 0x52, 0x65, 0x6e, 0x74, 0x61, 0x6c, 0xdf, 0x05, 0x80, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x2f, 0x69, 0x6e,
+                0x9c, 0xb7, 0x00, 0xd6, 0xdc, 0x00, 0xf5, 0xbc, 0x0f, 0x48, 0x00, 0x00, 0x0f, 0x25, 0x72, 0x10, 0x00, 0x8c, 0x00, 0x00,
+                0x63, 0x1f, 0x01, 0x09, 0x08, 0x0f, 0xac, 0x87, 0x01, 0x09, 0xb4, 0x08, 0x00, 0x30, 0x6d, 0x39, 0x69, 0x70, 0x65, 0xc9,
+                0x08, 0x0e, 0x88, 0x87, 0x00, 0x5b, 0xaa, 0x00, 0x01, 0x00, 0x0a, 0xe2, 0x08, 0x2d, 0x20, 0x3f, 0x4b, 0x6e, 0x0a, 0x66,
+                0x09, 0x03, 0xb2, 0x92, 0x1f, 0x3a, 0x62, 0x6f, 0x0a, 0x05, 0x62, 0x00, 0x01, 0x61, 0xa7, 0x0d, 0x62, 0x00, 0x09, 0x0f,
+                0x00, 0x04, 0xe7, 0x6e, 0x00, 0x95, 0xbe, 0x0b, 0x28, 0xd0, 0x01, 0xda, 0x00, 0x2f, 0x70, 0x63, 0xa7, 0x00, 0x22, 0x0f,
+                0x8c, 0x8a, 0x05, 0x0f, 0xb9, 0x00, 0x11, 0x3f, 0x69, 0x70, 0x63, 0xb9, 0x00, 0x14, 0x0f, 0xb3, 0x8a, 0x04, 0x0f, 0xcb,
+                0x00, 0x03, 0x1f, 0x70, 0xcb, 0x00, 0x2a, 0x08, 0xc0, 0xc6, 0x0f, 0xc8, 0x00, 0x14, 0x1f, 0x70, 0xc8, 0x00, 0x1c, 0x09,
+                0x63, 0x00, 0x0f, 0xc5, 0x00, 0x05, 0x03, 0x28, 0x11, 0x03, 0x64, 0x02, 0x05, 0xff, 0x0a, 0x08, 0xc6, 0x00, 0x00, 0x01,
+                0x11, 0x09, 0x1e, 0x00, 0x00, 0xaf, 0x00, 0x0a, 0x1f, 0x00, 0x08, 0x82, 0x00, 0x0f, 0x25, 0x8a, 0x00, 0x11, 0x70, 0x9d,
+                0x22, 0x0f, 0x66, 0x00, 0x0e, 0x00, 0xc1, 0x22, 0x0f, 0x69, 0x00, 0x0b, 0x00, 0x22, 0x00, 0x0b, 0x6c, 0x00, 0x0f, 0xa1,
+                0x22, 0x4c, 0x01, 0x90, 0x00, 0x08, 0x82, 0x0c, 0x0f, 0x3e, 0x00, 0x1f, 0x0f, 0xf8, 0x6b, 0x23, 0x00, 0xe8, 0xc1, 0x0f,
+                0x35, 0x21, 0x16, 0x02, 0x9c, 0x03, 0x0f, 0xe8, 0x6b, 0x20, 0x6f, 0x69, 0x70, 0x63, 0x2c, 0x20, 0x32, 0x69, 0x00, 0x17,
+                0x02, 0x4c, 0x03, 0x0f, 0x69, 0x00, 0x20, 0x1f, 0x70, 0x69, 0x00, 0x1c, 0x02, 0xed, 0x02, 0x0f, 0x74, 0x22, 0x20, 0x0f,
+                0x30, 0x6c, 0x1a, 0x02, 0x99, 0x02, 0x0f, 0x28, 0x6c, 0x25, 0x0f, 0x24, 0x6c, 0x21, 0x0f, 0x72, 0x00, 0x01, 0x0f, 0xd4,
+                0x22, 0x2e, 0x20, 0x53, 0x6d, 0x4f, 0x30, 0x04, 0x15, 0x03, 0x0f, 0x82, 0x0f, 0x05, 0x00, 0xbd, 0x7f, 0x0f, 0x83, 0x0f,
+                0x0c, 0x09, 0x45, 0x8b, 0x0a, 0xb8, 0x04, 0x20, 0x74, 0x68, 0x4c, 0x2e, 0x08, 0x68, 0x00, 0x0f, 0x8d, 0x0f, 0x20, 0x0f,
+                0x39, 0x0f, 0x12, 0x0f, 0xb9, 0x0f, 0x0f, 0x0f, 0xb9, 0x31, 0x00, 0x0d, 0x9e, 0x00, 0x02, 0xea, 0xce, 0x0b, 0x15, 0x00,
+                0x0f, 0x9f, 0x0f, 0x29, 0x00, 0x3f, 0x01, 0x3e, 0x28, 0x27, 0x74, 0x62, 0x74, 0x00, 0x61, 0xe4, 0x29, 0x6c, 0x6c, 0xc3,
+                0x91, 0x0f, 0x21, 0x0c, 0x18, 0x0f, 0xae, 0x08, 0x01, 0x0f, 0x07, 0x7b, 0x06, 0x02, 0xd0, 0xf3, 0x02, 0xd8, 0x00, 0x0c,
+                0xe1, 0x08, 0x00, 0x64, 0xf9, 0x0d, 0x92, 0x08, 0x0d, 0x35, 0x09, 0x02, 0xc6, 0x00, 0x0f, 0x66, 0x10, 0x03, 0x0f, 0x26,
+                0x10, 0x28, 0x0f, 0xa4, 0x10, 0x0d, 0x09, 0x2a, 0x00, 0x0f, 0x99, 0x2a, 0x1e, 0x0f, 0xc6, 0x00, 0x05, 0x0f, 0x85, 0x10,
+                0x02, 0x0f, 0x45, 0x10, 0x28, 0x0f, 0xc3, 0x10, 0x0d, 0x0d, 0x2a, 0x00, 0x0f, 0x8a, 0x01, 0x03, 0x03, 0x31, 0x00, 0x0c,
+                0x93, 0x01, 0x0f, 0xc6, 0x00, 0x04, 0x0f, 0xa4, 0x10, 0x03, 0x0f, 0x64, 0x10, 0x28, 0x0f, 0xe2, 0x10, 0x0d, 0x0f, 0x8c,
+                0x01, 0x42, 0x0f, 0xc3, 0x10, 0x03, 0x0f, 0x83, 0x10, 0x28, 0x0f, 0x01, 0x11, 0x0d, 0x0f, 0x8c, 0x01, 0x18, 0x3f, 0x66,
+                0x6d, 0x61, 0x8c, 0x01, 0x14, 0x0f, 0xe2, 0x10, 0x03, 0x0f, 0xa2, 0x10, 0x28, 0x0f, 0x20, 0x11, 0x0d, 0x0f, 0xc6, 0x00,
+                0x19, 0x3b, 0x70, 0x31, 0x36, 0xc7, 0x00, 0x0f, 0xc6, 0x00, 0x06, 0x0f, 0x01, 0x11, 0x01, 0x0f, 0xc1, 0x10, 0x28, 0x0f,
+                0x3f, 0x11, 0x0d, 0x0f, 0xc6, 0x00, 0x1a, 0x2f, 0x36, 0x34, 0xc6, 0x00, 0x13, 0x0f, 0x20, 0x11, 0x03, 0x0f, 0xe0, 0x10,
+                0x28, 0x0f, 0x5e, 0x11, 0x0d, 0x0f, 0xc6, 0x00, 0x18, 0x2f, 0x69, 0x70, 0x52, 0x02, 0x15, 0x0f, 0x3f, 0x11, 0x03, 0x0f,
+                0xff, 0x10, 0x28, 0x0f, 0x7d, 0x11, 0x0d, 0x0f, 0xc6, 0x00, 0x18, 0x00, 0x7a, 0x25, 0x0f, 0xc6, 0x00, 0x13, 0x0f, 0x5e,
+                0x11, 0x03, 0x0f, 0x1d, 0x11, 0x28, 0x0f, 0x9c, 0x11, 0x0e, 0x0f, 0xa4, 0x04, 0x41, 0x0f, 0x7c, 0x11, 0x03, 0x0f, 0x3c,
+                0x11, 0x28, 0x0f, 0xba, 0x11, 0x0d, 0x0f, 0x6a, 0x05, 0x42, 0x0f, 0x9b, 0x11, 0x03, 0x0f, 0x59, 0x11, 0x28, 0x0f, 0xd9,
+                0x11, 0x0f, 0x0f, 0xc6, 0x00, 0x40, 0x0f, 0xb8, 0x11, 0x03, 0x0f, 0x78, 0x11, 0x28, 0x0f, 0xf6, 0x11, 0x0d, 0x0f, 0x18,
+                0x03, 0x18, 0x1d, 0x78, 0x17, 0x03, 0x0f, 0xd6, 0x11, 0x06, 0x03, 0x82, 0xd5, 0x00, 0x11, 0x9a, 0x30, 0x4c, 0x61, 0x75,
+                0xa8, 0x07, 0x00, 0x79, 0x0a, 0x0f, 0x5f, 0x9b, 0x08, 0x13, 0x6c, 0x26, 0x00, 0x05, 0x2e, 0xa4, 0x0c, 0x4d, 0xbc, 0x09,
+                0x4c, 0x00, 0x07, 0x5c, 0xbd, 0x0a, 0x3f, 0x00, 0x03, 0x4b, 0x80, 0x0f, 0x5e, 0x12, 0x22, 0x00, 0x4a, 0x00, 0x03, 0x9f,
+                0x00, 0x06, 0xfa, 0x0f, 0x0f, 0x5e, 0x12, 0x0b, 0x02, 0x2c, 0x01, 0x04, 0x35, 0x00, 0x03, 0x33, 0x00, 0x0e, 0x5f, 0x0b,
+                0x09, 0x8e, 0x0f, 0x06, 0x6d, 0x00, 0x00, 0x23, 0x00, 0x0f, 0x16, 0x01, 0x00, 0x07, 0x88, 0x00, 0x0f, 0x55, 0x81, 0x01,
+                0x0a, 0x40, 0x00, 0x02, 0x0a, 0x01, 0x08, 0xbb, 0x00, 0x0f, 0x51, 0x81, 0x01, 0x0a, 0x34, 0x00, 0x30, 0x50, 0x65, 0x72,
+                0x17, 0x03, 0x07, 0x99, 0x01, 0x04, 0x4d, 0x20, 0x04, 0x22, 0x00, 0x1a, 0x2c, 0x6f, 0x01, 0x0f, 0x80, 0x00, 0x08, 0x0b,
+                0x4c, 0x00, 0x06, 0x8f, 0x00, 0x04, 0x9d, 0x00, 0x00, 0x33, 0xef, 0x11, 0x2f, 0xcc, 0xc3, 0x0c, 0xc2, 0x01, 0x09, 0xeb,
+                0x0d, 0x05, 0x34, 0x01, 0x0f, 0xd6, 0x82, 0x0c, 0x06, 0x29, 0x00, 0x03, 0x04, 0x02, 0x0a, 0xdd, 0xce, 0x01, 0x1e, 0x00,
+                0x00, 0x60, 0x7b, 0x01, 0xf3, 0x9d, 0x0f, 0x4b, 0x00, 0x11, 0x04, 0x2d, 0x00, 0x0f, 0x4f, 0x00, 0x0f, 0x02, 0x24, 0x3f,
+                0x0f, 0x52, 0x00, 0x17, 0x02, 0x98, 0x11, 0x0f, 0x55, 0x00, 0x04, 0x0f, 0x88, 0x01, 0x03, 0x0f, 0xfa, 0x00, 0x13, 0x0f,
+                0x74, 0x01, 0x02, 0x0a, 0x65, 0x00, 0x03, 0x4e, 0xdd, 0x07, 0x9d, 0x02, 0x10, 0x21, 0x23, 0x00, 0x0e, 0x9b, 0x0e, 0x07,
+                0x77, 0x01, 0x0c, 0x88, 0x02, 0x09, 0x40, 0x00, 0x0f, 0xdf, 0x83, 0x03, 0x0c, 0x8e, 0x01, 0x0a, 0x73, 0x00, 0x0f, 0xdb,
+                0x83, 0x03, 0x0d, 0xa4, 0x01, 0x04, 0x7d, 0x02, 0x06, 0x4d, 0x00, 0x02, 0x7f, 0x02, 0x00, 0x0a, 0x00, 0x0f, 0x70, 0x00,
+                0x02, 0x0a, 0xb3, 0x01, 0x0a, 0x84, 0x00, 0x0a, 0x6f, 0x02, 0x03, 0x16, 0x00, 0x0f, 0x45, 0x00, 0x09, 0x02, 0xd6, 0x01,
+                0x5c, 0x31, 0x30, 0x30, 0x20, 0x2a, 0x9b, 0x00, 0x4f, 0x2f, 0x20, 0x33, 0x32, 0x3b, 0x00, 0x0c, 0x08, 0x83, 0x00, 0x08,
+                0x97, 0x00, 0x30, 0x2b, 0x20, 0x27, 0x3e, 0x00, 0x02, 0x2a, 0x23, 0x1f, 0x27, 0x34, 0x01, 0x04, 0x0f, 0x88, 0x03, 0x07,
+                0x0c, 0x0b, 0x01, 0x0f, 0x8a, 0x03, 0x03, 0x0f, 0x14, 0x02, 0x0e, 0x0f, 0x1b, 0x01, 0x09, 0x0f, 0x8a, 0x03, 0x05, 0x09,
+                0x75, 0x24, 0x0f, 0x3a, 0x14, 0xba, 0x05, 0x54, 0x02, 0x09, 0x95, 0x12, 0x02, 0x47, 0xe0, 0x0f, 0x9a, 0x12, 0x08, 0x07,
+                0x48, 0x02, 0x0f, 0x77, 0x13, 0x1c, 0x00, 0x75, 0x00, 0x06, 0x83, 0x01, 0x0f, 0x77, 0x00, 0x1c, 0x09, 0xbc, 0x01, 0x0f,
+                0x59, 0x14, 0x20, 0x0a, 0x94, 0x02, 0x0f, 0x7d, 0x00, 0x22, 0x07, 0xd1, 0x02, 0x0f, 0x71, 0x14, 0x20, 0x0d, 0x2c, 0x03,
+                0x0f, 0x84, 0x00, 0x2a, 0x02, 0x6c, 0x03, 0x0f, 0x08, 0x01, 0x20, 0x0f, 0xa9, 0x06, 0x04, 0x0f, 0x05, 0x02, 0x24, 0x0e,
+                0x67, 0x03, 0x0f, 0x9b, 0x01, 0x26, 0x0f, 0x95, 0x00, 0x2f, 0x0f, 0xfe, 0x03, 0x09, 0x0f, 0x4a, 0x15, 0x3e, 0x02, 0x6c,
+                0x9e, 0x02, 0xd2, 0x08, 0x2f, 0x69, 0x6f, 0x1a, 0x38, 0x01, 0x0f, 0xf3, 0x09, 0x42, 0x0b, 0xbb, 0x14, 0x0f, 0x66, 0xa7,
+                0x03, 0x09, 0x24, 0x14, 0x0f, 0x4e, 0x00, 0x15, 0x07, 0x44, 0x0a, 0x09, 0x41, 0x00, 0x0c, 0x43, 0x0a, 0x0f, 0xa7, 0x25,
+                0x0f, 0x10, 0x73, 0x5b, 0x41, 0x02, 0x84, 0x8a, 0x03, 0x39, 0x8a, 0x5b, 0x53, 0x75, 0x66, 0x66, 0x69, 0x6f, 0xa4, 0x04,
+                0x82, 0x6e, 0x04, 0x2d, 0x00, 0x00, 0xef, 0x05, 0x04, 0x0c, 0x00, 0x0f, 0xec, 0x47, 0x01, 0x03, 0x1e, 0x01, 0x00, 0xd8,
+                0x01, 0x0f, 0x7b, 0x8b, 0x01, 0x0f, 0x49, 0x01, 0x01, 0x00, 0x9b, 0x38, 0x08, 0x81, 0x00, 0x0f, 0xb5, 0x07, 0x05, 0x0c,
+                0x5f, 0x00, 0x0f, 0x4f, 0x0b, 0x06, 0x0d, 0x52, 0x00, 0x0f, 0xd4, 0x07, 0x06, 0x07, 0x53, 0x00, 0x12, 0x54, 0xb9, 0x03,
+                0x0f, 0xb4, 0x00, 0x05, 0x03, 0xd8, 0x03, 0x0f, 0xb6, 0x00, 0x2a, 0x03, 0x63, 0x00, 0x07, 0xb8, 0x00, 0x0f, 0x56, 0x00,
+                0x0e, 0x0f, 0xba, 0x00, 0x18, 0x0f, 0x9b, 0x08, 0x01, 0x0e, 0x26, 0x00, 0x00, 0xfb, 0x17, 0x0c, 0x49, 0x01, 0x0f, 0xb4,
+                0x00, 0x10, 0x0b, 0xbc, 0x08, 0x0f, 0xd5, 0x00, 0x03, 0x06, 0xab, 0x07, 0x0f, 0xad, 0x01, 0x02, 0x0f, 0x16, 0x18, 0x04,
+                0x03, 0xb5, 0x00, 0x0f, 0x76, 0x01, 0x00, 0x00, 0x1e, 0x17, 0x0b, 0x4a, 0x17, 0x0f, 0x75, 0x01, 0x17, 0x04, 0x5b, 0x00,
+                0x05, 0x6e, 0x01, 0x0f, 0x4e, 0x00, 0x0f, 0x0f, 0x6d, 0x01, 0x09, 0x00, 0x3a, 0x00, 0x0f, 0x62, 0x01, 0x04, 0x04, 0x6a,
+                0x00, 0x0f, 0x5b, 0x01, 0x15, 0x07, 0x4b, 0x00, 0x07, 0x50, 0x01, 0x08, 0xb0, 0x00, 0x0f, 0x49, 0x01, 0x1f, 0x02, 0xad,
+                0x8d, 0x0f, 0x97, 0x00, 0x04, 0x0c, 0x44, 0x04, 0x0f, 0x66, 0x2d, 0x02, 0x04, 0x47, 0x00, 0x0f, 0x93, 0x00, 0x0e, 0x0f,
+                0x92, 0x04, 0x01, 0x00, 0x1e, 0x00, 0x02, 0x35, 0x0a, 0x0f, 0xd1, 0x95, 0x1a, 0x0f, 0x58, 0x4b, 0x0b, 0x0f, 0xff, 0x8d,
+                0x05, 0x0f, 0xbd, 0x10, 0x08, 0x0f, 0x5a, 0x42, 0x0c, 0x03, 0x32, 0x9f, 0x0f, 0xc0, 0xa4, 0x00, 0x02, 0x52, 0x00, 0x04,
+                0xc2, 0xad, 0x16, 0x76, 0x65, 0x11, 0x0f, 0x00, 0x44, 0x0d, 0x30, 0x65, 0x73, 0x73, 0x7c, 0x96, 0x01, 0xc7, 0x17, 0x0c,
+                0x58, 0x00, 0x07, 0x52, 0x00, 0x25, 0x74, 0x63, 0x53, 0x00, 0x0f, 0x52, 0x00, 0x11, 0x20, 0x45, 0x76, 0x72, 0x39, 0x0f,
+                0x67, 0xa5, 0x02, 0x05, 0x52, 0x00, 0x06, 0x19, 0x43, 0x0f, 0x52, 0x00, 0x0c, 0x30, 0x47, 0x65, 0x6f, 0xa0, 0xd2, 0x1f,
+                0x79, 0xf8, 0x00, 0x02, 0x07, 0x52, 0x00, 0x1f, 0x67, 0xf6, 0x00, 0x16, 0x08, 0x70, 0xb5, 0x0f, 0xf9, 0x11, 0x01, 0x04,
+                0x52, 0x00, 0x1f, 0x70, 0x52, 0x00, 0x16, 0x04, 0x3b, 0xb9, 0x0f, 0x54, 0x00, 0x02, 0x07, 0x52, 0x00, 0x06, 0x47, 0x01,
+                0x0f, 0xf2, 0x42, 0x77, 0x05, 0x10, 0x07, 0x0f, 0x0f, 0x8c, 0x23, 0x0a, 0x30, 0x04, 0x0f, 0x4c, 0x09, 0x1b, 0x0d, 0x40,
+                0x00, 0x0f, 0xef, 0x0b, 0x23, 0x08, 0x47, 0x00, 0x03, 0xd0, 0x05, 0x0f, 0x89, 0x00, 0x28, 0x06, 0x12, 0x06, 0x0f, 0xab,
+                0x8c, 0x24, 0x0f, 0x7c, 0x06, 0x03, 0x0f, 0x92, 0x00, 0x2f, 0x0f, 0x19, 0x0c, 0x26, 0x04, 0x24, 0x01, 0x04, 0x11, 0x05,
+                0x0f, 0x8b, 0x00, 0x20, 0x07, 0x4c, 0x05, 0x0f, 0x16, 0x01, 0x24, 0x07, 0x37, 0x06, 0x0f, 0x80, 0x00, 0x24, 0x0f, 0x19,
+                0x0d, 0x2a, 0x0f, 0xbe, 0x8d, 0x02, 0x0f, 0x7b, 0x00, 0x12, 0x0f, 0x97, 0x21, 0x2b, 0x0f, 0xbf, 0x8d, 0x09, 0x0f, 0x7f,
+                0x00, 0x26, 0x0f, 0x5a, 0x0c, 0x30, 0x31, 0x52, 0x65, 0x73, 0xe3, 0x7c, 0x4f, 0x55, 0x73, 0x61, 0x67, 0xe8, 0x7c, 0x00,
+                0x01, 0x80, 0x38, 0x50, 0x73, 0x56, 0x61, 0x6c, 0x69, 0x01, 0x0c, 0x04, 0x3e, 0x00, 0x01, 0x8e, 0xe4, 0x0f, 0x70, 0xd8,
+                0x02, 0x11, 0x21, 0x1b, 0x00, 0x0f, 0x96, 0xe8, 0x0b, 0x0f, 0x21, 0x00, 0x00, 0x05, 0xba, 0xe3, 0x07, 0xbb, 0x00, 0x07,
+                0x43, 0x0c, 0x0f, 0x05, 0x0c, 0x0e, 0x13, 0x72, 0xc6, 0x00, 0x00, 0x73, 0x01, 0xa0, 0x74, 0x2c, 0x20, 0x67, 0x66, 0x78,
+                0x2c, 0x20, 0x76, 0x74, 0x3e, 0xe9, 0x00, 0xfe, 0x44, 0x0d, 0x01, 0xf0, 0x02, 0x84, 0x44, 0x03, 0x34, 0x00, 0x00, 0xd4,
+                0x44, 0x03, 0x0b, 0x00, 0x0f, 0xeb, 0x9d, 0x02, 0x01, 0x9c, 0x53, 0x1f, 0x6f, 0x99, 0x53, 0x01, 0x20, 0x67, 0x66, 0xf9,
+                0xb0, 0x3f, 0x67, 0x66, 0x78, 0xd6, 0xac, 0x01, 0x20, 0x74, 0x67, 0xd4, 0xac, 0x17, 0x74, 0x52, 0xe9, 0x06, 0x9f, 0x08,
+                0x00, 0x36, 0x08, 0x1f, 0x70, 0x3e, 0x45, 0x02, 0x01, 0x1e, 0xf9, 0x1f, 0x73, 0x03, 0x58, 0x00, 0x03, 0x85, 0x01, 0x3c,
+                0x28, 0x74, 0x6f, 0x0c, 0xeb, 0x07, 0x11, 0x17, 0x60, 0x6f, 0x74, 0x53, 0x6d, 0x46, 0x61, 0x12, 0x01, 0x02, 0xb4, 0x00,
+                0x13, 0x2e, 0x10, 0xc0, 0x13, 0x73, 0xb4, 0xb7, 0x10, 0x27, 0x9f, 0xe7, 0x5a, 0x30, 0x2e, 0x35, 0x20, 0x3a, 0x69, 0x7a,
+                0x08, 0xee, 0x00, 0x04, 0xdb, 0xd7, 0x0d, 0x91, 0x14, 0x00, 0x59, 0x01, 0x0f, 0xf3, 0x28, 0x06, 0x18, 0x2a, 0x7d, 0x00,
+                0x0f, 0x5b, 0x00, 0x0a, 0x03, 0x99, 0x09, 0x2f, 0x6f, 0x74, 0xdd, 0x28, 0x07, 0x22, 0x20, 0x2a, 0x35, 0x0a, 0x06, 0x52,
+                0x00, 0x20, 0x2e, 0x74, 0x1d, 0xd4, 0x00, 0x21, 0xe8, 0x0f, 0xe3, 0x98, 0x03, 0x21, 0x74, 0x6f, 0x5d, 0x39, 0x08, 0xb6,
+                0x00, 0x00, 0x02, 0x28, 0x00, 0x2d, 0x01, 0x0f, 0x30, 0x00, 0x08, 0x02, 0x8b, 0x00, 0x0d, 0xcc, 0x27, 0x0e, 0x36, 0x00,
+                0x0b, 0x0c, 0x38, 0x08, 0x90, 0x01, 0x3f, 0x67, 0x66, 0x78, 0x90, 0x01, 0x06, 0x37, 0x67, 0x66, 0x78, 0x90, 0x01, 0x3f,
+                0x67, 0x66, 0x78, 0x90, 0x01, 0x1e, 0x25, 0x67, 0x66, 0x6b, 0xd9, 0x0c, 0x90, 0x01, 0x01, 0xe4, 0x02, 0x0f, 0x90, 0x01,
+                0x08, 0x07, 0x7d, 0x00, 0x0f, 0x5b, 0x00, 0x0a, 0x03, 0x05, 0x01, 0x12, 0x66, 0x37, 0x0c, 0x0f, 0x90, 0x01, 0x09, 0x07,
+                0x52, 0x00, 0x0f, 0x90, 0x01, 0x0d, 0x23, 0x67, 0x66, 0xd5, 0x56, 0x0a, 0x90, 0x01, 0x00, 0x2d, 0x01, 0x0f, 0x30, 0x00,
+                0x08, 0x0f, 0x90, 0x01, 0x04, 0x0e, 0x36, 0x00, 0x07, 0x08, 0xe8, 0x04, 0x88, 0x01, 0x74, 0x76, 0x74, 0x67, 0x29, 0x20,
+                0x26, 0x26, 0xad, 0x04, 0x3f, 0x28, 0x70, 0x73, 0x97, 0x01, 0x06, 0x37, 0x76, 0x74, 0x67, 0x97, 0x01, 0x3f, 0x76, 0x74,
+                0x67, 0x97, 0x01, 0x1e, 0x3f, 0x76, 0x74, 0x67, 0x97, 0x01, 0x05, 0x01, 0x76, 0x04, 0x0f, 0x97, 0x01, 0x08, 0x07, 0x7d,
+                0x00, 0x0f, 0x5b, 0x00, 0x0a, 0x02, 0x0c, 0x01, 0x00, 0x46, 0x04, 0x0f, 0x97, 0x01, 0x0d, 0x07, 0x52, 0x00, 0x0f, 0x97,
+                0x01, 0x0d, 0x3f, 0x76, 0x74, 0x67, 0x97, 0x01, 0x01, 0x00, 0x3c, 0x01, 0x0f, 0x30, 0x00, 0x08, 0x0f, 0x97, 0x01, 0x04,
+                0x0f, 0x36, 0x00, 0x01, 0x03, 0xed, 0x1b, 0x1f, 0x73, 0x60, 0x01, 0x2c, 0x10, 0x70, 0xc5, 0x01, 0x0f, 0x5f, 0x01, 0x02,
+                0x00, 0xd0, 0x05, 0x0f, 0x5e, 0x01, 0x08, 0x06, 0x7a, 0x00, 0x0f, 0x58, 0x00, 0x09, 0x02, 0xd1, 0x00, 0x2f, 0x70, 0x73,
+                0x5b, 0x01, 0x0e, 0x06, 0x4f, 0x00, 0x0f, 0x5a, 0x01, 0x0d, 0x2f, 0x70, 0x73, 0x59, 0x01, 0x01, 0x0d, 0x39, 0x0f, 0x08,
+                0x2e, 0x00, 0x0f, 0x57, 0x01, 0x04, 0x0d, 0x34, 0x00, 0x0f, 0x7d, 0x04, 0x08, 0x1f, 0x63, 0xe5, 0x02, 0x07, 0x18, 0x63,
+                0x84, 0x01, 0x10, 0x63, 0x05, 0x0f, 0x0f, 0x83, 0x01, 0x1b, 0x1f, 0x63, 0x83, 0x01, 0x06, 0x1f, 0x63, 0x83, 0x01, 0x0b,
+                0x06, 0x79, 0x00, 0x0f, 0x58, 0x00, 0x09, 0x07, 0xee, 0x9d, 0x0f, 0x87, 0x01, 0x0f, 0x06, 0x53, 0x00, 0x0f, 0x87, 0x01,
+                0x0d, 0x1f, 0x63, 0x87, 0x01, 0x02, 0x1f, 0x63, 0x87, 0x01, 0x04, 0x01, 0x2e, 0x00, 0x0f, 0x8a, 0x00, 0x03, 0x0f, 0xd2,
+                0xf5, 0x12, 0x0c, 0x1f, 0x10, 0x0f, 0xfc, 0xa5, 0x19, 0x06, 0x27, 0x52, 0x00, 0xf0, 0x0c, 0x0f, 0x0c, 0x20, 0x02, 0x09,
+                0x04, 0xba, 0x0f, 0x40, 0x10, 0x04, 0x0f, 0x53, 0x10, 0x02, 0x0f, 0xa3, 0x53, 0x2c, 0x01, 0x21, 0x02, 0x08, 0x7d, 0x00,
+                0x05, 0x50, 0x10, 0x20, 0x74, 0x67, 0xbc, 0x59, 0x10, 0x6c, 0x94, 0xce, 0x0f, 0x0e, 0x2a, 0x06, 0x0f, 0x3e, 0x00, 0x06,
+                0x10, 0x70, 0xa5, 0xe6, 0x0f, 0x3d, 0x00, 0x09, 0x0f, 0x3e, 0x00, 0x0a, 0x1f, 0x63, 0x3e, 0x00, 0x0e, 0x07, 0xd4, 0x21,
+                0x05, 0x5d, 0x01, 0x40, 0x52, 0x65, 0x67, 0x69, 0x04, 0xac, 0x0a, 0xc2, 0xd5, 0x01, 0x65, 0x00, 0x74, 0x73, 0x6d, 0x5f,
+                0x72, 0x66, 0x5f, 0x72, 0x21, 0x00, 0x30, 0x5f, 0x61, 0x6c, 0xf8, 0x24, 0x0f, 0xe8, 0x2a, 0x06, 0x0f, 0x5d, 0x01, 0x3a,
+                0x0f, 0x7c, 0x00, 0x06, 0x07, 0x6a, 0x01, 0x0f, 0xdc, 0x56, 0x02, 0x0f, 0x3e, 0x00, 0x13, 0x0c, 0x50, 0x02, 0x0f, 0x3e,
+                0x00, 0x1b, 0x07, 0x9c, 0x10, 0x0f, 0x5d, 0x01, 0x0b, 0x00, 0xeb, 0x3e, 0x30, 0x2f, 0x53, 0x68, 0xd4, 0x4a, 0x0f, 0x1f,
+                0x01, 0x35, 0x0f, 0x5d, 0x01, 0x31, 0x02, 0xf2, 0x45, 0x01, 0x32, 0x48, 0x01, 0xc2, 0x26, 0x02, 0xcb, 0x55, 0x33, 0x69,
+                0x73, 0x62, 0x9e, 0x9d, 0x0f, 0xea, 0x01, 0x03, 0x0f, 0x3e, 0x00, 0x0b, 0x10, 0x74, 0x90, 0x9f, 0x0f, 0x3e, 0x00, 0x26,
+                0x03, 0x27, 0xc1, 0x0f, 0x41, 0x00, 0x06, 0x0f, 0x5d, 0x01, 0x01, 0x3c, 0x43, 0x54, 0x41, 0x88, 0x01, 0x0f, 0x5d, 0x01,
+                0x6b, 0x0f, 0xd9, 0x01, 0x6a, 0x01, 0xa5, 0xc2, 0x2f, 0x74, 0x61, 0x0e, 0x05, 0x20, 0x0f, 0x70, 0xdd, 0x71, 0x00, 0xeb,
+                0x57, 0x02, 0x64, 0x13, 0x04, 0x69, 0x0e, 0x0a, 0x23, 0x34, 0x08, 0xd3, 0x07, 0x02, 0xd8, 0xa7, 0x0e, 0xe4, 0x0d, 0x0f,
+                0x60, 0x11, 0x16, 0x04, 0x68, 0x0d, 0x0f, 0x63, 0x10, 0x20, 0x07, 0xa3, 0x0d, 0x0f, 0xde, 0x42, 0x04, 0x0f, 0x5a, 0x55,
+                0x10, 0x01, 0x5a, 0x0d, 0x0f, 0x7d, 0x00, 0x23, 0x0f, 0x67, 0x1e, 0x01, 0x0f, 0x64, 0x11, 0x1d, 0x02, 0x47, 0x00, 0x0f,
+                0x67, 0x11, 0x27, 0x0f, 0x87, 0x00, 0x04, 0x0f, 0xa0, 0xa7, 0x02, 0x0f, 0x2f, 0x66, 0x02, 0x22, 0x6f, 0x6c, 0xf3, 0x43,
+                0x1a, 0x33, 0x75, 0x44, 0x03, 0xf9, 0xbf, 0x0c, 0x5c, 0x0e, 0x09, 0xdd, 0x09, 0x0c, 0x08, 0x02, 0x0f, 0x5c, 0x0e, 0x01,
+                0x0f, 0x01, 0xf3, 0x01, 0x03, 0x74, 0x00, 0x00, 0x73, 0x00, 0x01, 0x72, 0x00, 0x05, 0xe4, 0x66, 0xa0, 0x3c, 0x65, 0x6d,
+                0x3e, 0x56, 0x54, 0x47, 0x2b, 0x50, 0x53, 0x05, 0xc7, 0x10, 0x62, 0xc5, 0x08, 0xcf, 0x3c, 0x2f, 0x65, 0x6d, 0x3e, 0x20,
+                0xe2, 0xae, 0x95, 0x27, 0x2c, 0x20, 0xdc, 0x45, 0x07, 0x0f, 0x67, 0x02, 0x0f, 0x04, 0x3f, 0x0e, 0x0f, 0x63, 0x01, 0x20,
+                0x07, 0x7a, 0x0e, 0x0f, 0x67, 0x02, 0x26, 0x02, 0x31, 0x0e, 0x0f, 0x7d, 0x00, 0x23, 0x0f, 0x67, 0x02, 0x31, 0x02, 0x47,
+                0x00, 0x0f, 0x67, 0x02, 0x27, 0x0f, 0x87, 0x00, 0x04, 0x0f, 0xd9, 0x0e, 0x00, 0x01, 0xed, 0xb1, 0x0b, 0xdd, 0x0e, 0x01,
+                0x10, 0x14, 0x0e, 0xfc, 0x0b, 0x0f, 0xff, 0xc1, 0x17, 0x03, 0x65, 0x0e, 0x0f, 0xb9, 0x00, 0x20, 0x07, 0xa0, 0x0e, 0x0f,
+                0xbd, 0x01, 0x26, 0x02, 0x57, 0x0e, 0x0f, 0x7d, 0x00, 0x23, 0x0f, 0xbd, 0x01, 0x31, 0x02, 0x47, 0x00, 0x0f, 0xbd, 0x01,
+                0x27, 0x0f, 0x87, 0x00, 0x1b, 0x0f, 0x81, 0x01, 0x01, 0x03, 0x89, 0x0e, 0x0f, 0x07, 0x16, 0x21, 0x05, 0xc3, 0x0e, 0x0f,
+                0x7f, 0x01, 0x26, 0x01, 0x7e, 0x0e, 0x0f, 0x7b, 0x00, 0x22, 0x0f, 0x7d, 0x01, 0x31, 0x01, 0x46, 0x00, 0x0f, 0x07, 0x17,
+                0x28, 0x0f, 0x85, 0x00, 0x02, 0x0f, 0x9f, 0x05, 0x02, 0x03, 0xc0, 0xc5, 0x01, 0xa7, 0x15, 0x0f, 0x2a, 0xfa, 0x12, 0x0f,
+                0xd4, 0x05, 0x0e, 0x1f, 0x36, 0xd4, 0x05, 0x02, 0x0f, 0xa0, 0x12, 0x0a, 0x03, 0x30, 0x02, 0x0f, 0x81, 0x00, 0x05, 0x00,
+                0xd6, 0x03, 0x02, 0xd7, 0x00, 0x0f, 0xa3, 0x00, 0x34, 0x0f, 0x77, 0x06, 0x03, 0x0f, 0xac, 0x11, 0x01, 0x0f, 0x47, 0x00,
+                0x20, 0x0e, 0x9c, 0x10, 0x0f, 0x2e, 0x6e, 0x03, 0x0f, 0x45, 0x01, 0x1c, 0x0d, 0x1d, 0x0a, 0x0f, 0x5e, 0x50, 0x08, 0x0f,
+                0x31, 0x07, 0x0a, 0x0f, 0x10, 0x11, 0x00, 0x0f, 0x93, 0x03, 0x16, 0x03, 0x99, 0x10, 0x0f, 0x93, 0x02, 0x20, 0x0a, 0xd3,
+                0x10, 0x0f, 0x97, 0x03, 0x26, 0x01, 0x8e, 0x10, 0x0f, 0x7f, 0x00, 0x22, 0x0f, 0x97, 0x5e, 0x05, 0x0f, 0x9b, 0x03, 0x1d,
+                0x01, 0x4a, 0x00, 0x0f, 0x9b, 0x03, 0x27, 0x0f, 0x89, 0x00, 0x07, 0x0f, 0x3e, 0x09, 0x35, 0x0b, 0xc9, 0x11, 0x08, 0x18,
+                0x02, 0x0f, 0x0b, 0x1b, 0x30, 0x06, 0xc5, 0x27, 0x02, 0x9f, 0xd5, 0x0f, 0x35, 0x4c, 0x21, 0x07, 0x8e, 0x26, 0x32, 0x61,
+                0x6e, 0x79, 0xb4, 0x22, 0x50, 0x2c, 0x20, 0x72, 0x65, 0x67, 0x50, 0x35, 0x31, 0x6d, 0x2c, 0x20, 0x6d, 0x84, 0x02, 0x20,
+                0x00, 0x01, 0x0b, 0x00, 0x02, 0x46, 0x01, 0x0f, 0xac, 0x26, 0x2a, 0x00, 0x63, 0x00, 0x0f, 0xf6, 0x12, 0x01, 0x00, 0x18,
+                0x00, 0x0f, 0xb8, 0x23, 0x01, 0x03, 0x30, 0x00, 0x0f, 0x7f, 0x14, 0x04, 0x0f, 0x36, 0x00, 0x05, 0x2f, 0x72, 0x65, 0x3b,
+                0x16, 0x02, 0x2c, 0x72, 0x65, 0x59, 0x04, 0x07, 0x2e, 0x00, 0x0f, 0x63, 0x00, 0x04, 0x0f, 0x34, 0x00, 0x04, 0x3f, 0x73,
+                0x68, 0x6d, 0x62, 0x00, 0x01, 0x3f, 0x73, 0x68, 0x6d, 0x2e, 0x00, 0x07, 0x0f, 0x62, 0x00, 0x04, 0x0f, 0x34, 0x00, 0x04,
+                0x05, 0x7d, 0x01, 0x26, 0x20, 0x3d, 0x89, 0x01, 0x0f, 0x28, 0x00, 0x05, 0x0f, 0x8c, 0x00, 0x01, 0x08, 0xb3, 0x01, 0x0f,
+                0x38, 0x00, 0x08, 0x0f, 0x96, 0x00, 0x04, 0x0f, 0x3e, 0x00, 0x0c, 0x32, 0x61, 0x6e, 0x79, 0x74, 0x00, 0x2e, 0x61, 0x6e,
+                0xeb, 0x42, 0x21, 0x61, 0x6e, 0x78, 0x42, 0x05, 0x2e, 0x61, 0x08, 0xca, 0x01, 0x03, 0xb1, 0x25, 0x02, 0x74, 0x01, 0x03,
+                0x0d, 0x00, 0x02, 0x1f, 0x01, 0x03, 0x0d, 0x00, 0x04, 0x98, 0x00, 0x0f, 0x76, 0x00, 0x07, 0x02, 0xb2, 0x00, 0x0f, 0x79,
+                0x00, 0x00, 0x00, 0xb8, 0x00, 0x03, 0x7c, 0x00, 0x10, 0x27, 0x78, 0x00, 0x05, 0xcd, 0x25, 0x07, 0x46, 0x02, 0x20, 0x2b,
+                0x20, 0xf7, 0x29, 0x04, 0x19, 0x00, 0x06, 0xfb, 0x01, 0x0a, 0x18, 0x00, 0x06, 0xb1, 0x01, 0x0a, 0x18, 0x00, 0x08, 0x35,
+                0x01, 0x0d, 0x88, 0x53, 0x0f, 0x7b, 0x25, 0x2c, 0x0f, 0x29, 0x25, 0x0d, 0x05, 0x6e, 0x14, 0x03, 0xba, 0x28, 0x04, 0x39,
+                0x6d, 0x01, 0x15, 0xd8, 0x07, 0x8e, 0x13, 0x0f, 0x69, 0x6a, 0x02, 0x0f, 0xe1, 0xd8, 0x3f, 0x0f, 0x52, 0x00, 0xff, 0x34,
+                0x0f, 0xeb, 0x26, 0x2c, 0x0f, 0x14, 0x02, 0x14, 0x07, 0x0a, 0x27, 0x0f, 0x14, 0x02, 0xff, 0xb5, 0x0f, 0xad, 0x28, 0x08,
+                0x0f, 0x14, 0x02, 0x15, 0x0f, 0x91, 0x72, 0x02, 0x0f, 0x14, 0x02, 0xff, 0xa5, 0x0f, 0x6f, 0x2a, 0x0d, 0x0f, 0x14, 0x02,
+                0x14, 0x07, 0x8e, 0x2a, 0x0f, 0x14, 0x02, 0xff, 0xb0, 0x3f, 0x56, 0x54, 0x47, 0x2f, 0x2c, 0x05, 0x0f, 0x50, 0x08, 0x1a,
+                0x0f, 0xde, 0x1b, 0x00, 0x0f, 0x70, 0x01, 0x93, 0x02, 0xe2, 0x00, 0x51, 0x70, 0x65, 0x32, 0x73, 0x6d, 0x0e, 0x1e, 0x01,
+                0x56, 0x1b, 0x03, 0xd1, 0x1a, 0x3b, 0x69, 0x6f, 0x6e, 0xf0, 0x00, 0x0f, 0xe2, 0xf7, 0x11, 0x0f, 0x14, 0x02, 0xae, 0x0f,
+                0x45, 0x2e, 0x0d, 0x0f, 0x14, 0x02, 0x14, 0x0f, 0xb4, 0x1d, 0x01, 0x0f, 0x3e, 0x00, 0x19, 0x00, 0x1e, 0x1f, 0x32, 0x73,
+                0x6f, 0x6e, 0x2c, 0x00, 0x06, 0x92, 0x01, 0x0e, 0x83, 0x2e, 0x0f, 0x52, 0x00, 0x1e, 0x04, 0x2b, 0x1e, 0x0f, 0x56, 0x00,
+                0x03, 0x0a, 0x14, 0x02, 0x00, 0x05, 0xe6, 0x00, 0x2b, 0x1d, 0x0f, 0x13, 0x02, 0x28, 0x00, 0x52, 0x00, 0x80, 0x4f, 0x75,
+                0x74, 0x2d, 0x6f, 0x66, 0x2d, 0x4f, 0x94, 0xca, 0x5f, 0x20, 0x45, 0x78, 0x69, 0x74, 0x36, 0x74, 0x2b, 0x0f, 0xf6, 0x00,
+                0x21, 0x32, 0x6f, 0x6f, 0x6f, 0x30, 0x00, 0x00, 0x2b, 0x11, 0x2b, 0x6c, 0x65, 0xf6, 0x00, 0x0f, 0x07, 0x30, 0x2b, 0x0f,
+                0xa0, 0x21, 0x35, 0x0f, 0xcc, 0x00, 0x0b, 0x02, 0x32, 0x21, 0x0f, 0x14, 0x02, 0x39, 0x06, 0x52, 0x00, 0x0f, 0x14, 0x02,
+                0x13, 0x0f, 0x52, 0x00, 0x19, 0x20, 0x73, 0x68, 0x36, 0x1f, 0x0f, 0xa5, 0x00, 0x05, 0x00, 0x08, 0x4c, 0x40, 0x54, 0x41,
+                0x20, 0x41, 0x1f, 0x00, 0x0f, 0x42, 0x76, 0x33, 0x0f, 0xa4, 0x00, 0x21, 0x3f, 0x63, 0x74, 0x61, 0x47, 0x01, 0x07, 0x0f,
+                0xc9, 0x31, 0xae, 0x04, 0x88, 0x14, 0x02, 0x12, 0x10, 0x0f, 0x00, 0x14, 0x20, 0x05, 0x4b, 0x10, 0x0f, 0x24, 0x2f, 0x29,
+                0x02, 0x45, 0x00, 0x0f, 0x85, 0x14, 0x27, 0x0f, 0x85, 0x00, 0x19, 0x0f, 0xfe, 0x00, 0x01, 0x03, 0xd8, 0x10, 0x0f, 0x7a,
+                0x00, 0x20, 0x06, 0x12, 0x11, 0x0f, 0x00, 0x01, 0x29, 0x05, 0xd4, 0x11, 0x0f, 0x01, 0x01, 0x25, 0x0f, 0x87, 0x00, 0x1a,
+                0x0f, 0x02, 0x01, 0x01, 0x02, 0xc1, 0x11, 0x0f, 0x7a, 0x00, 0x20, 0x05, 0xfa, 0x11, 0x0f, 0x00, 0x01, 0x29, 0x04, 0xc6,
+                0x12, 0x0f, 0xff, 0x00, 0x25, 0x0f, 0x85, 0x00, 0x19, 0x0f, 0xfe, 0x00, 0x01, 0x02, 0xa7, 0x12, 0x0f, 0x79, 0x00, 0x20,
+                0x05, 0xe0, 0x12, 0x0f, 0xfe, 0x00, 0x29, 0x04, 0xb7, 0x13, 0x0f, 0xfe, 0x00, 0x25, 0x0f, 0x85, 0x00, 0x1b, 0x03, 0x30,
+                0x04, 0x05, 0x0b, 0x15, 0x0f, 0x32, 0x01, 0x23, 0x05, 0x5e, 0x14, 0x0f, 0xaf, 0x00, 0x1f, 0x07, 0xfc, 0x13, 0x0f, 0x36,
+                0x01, 0x29, 0x04, 0x47, 0x00, 0x0f, 0x38, 0x01, 0x27, 0x0f, 0x89, 0x00, 0x06, 0x0f, 0x57, 0x18, 0x2e, 0x00, 0x55, 0x18,
+                0x01, 0x5b, 0xe3, 0x0f, 0x54, 0x18, 0x06, 0x01, 0x25, 0x06, 0x02, 0xd8, 0x24, 0x0f, 0x6f, 0x3e, 0x08, 0x00, 0xf7, 0x3b,
+                0x0f, 0x0c, 0xe5, 0x00, 0x0e, 0x6a, 0x3f, 0x07, 0x4a, 0x00, 0x09, 0x34, 0x3c, 0x0c, 0x07, 0xe5, 0x07, 0x68, 0x15, 0x0f,
+                0x3d, 0x40, 0x16, 0x06, 0x48, 0x00, 0x08, 0x3f, 0x40, 0x0f, 0x87, 0x00, 0x02, 0x0f, 0x32, 0x4a, 0x03, 0x0e, 0x41, 0x00,
+                0x0f, 0x8b, 0x00, 0x02, 0x0b, 0x66, 0x55, 0x0f, 0x54, 0x3d, 0x12, 0x0f, 0x89, 0x00, 0x05, 0x08, 0x4c, 0x00, 0x0f, 0x45,
+                0x3d, 0x07, 0x03, 0x87, 0x00, 0x0f, 0xea, 0x19, 0x18, 0x00, 0x45, 0x45, 0x04, 0xac, 0xd2, 0x07, 0xb2, 0xca, 0x0c, 0xcb,
+                0x19, 0x03, 0x8e, 0x2d, 0x07, 0xbf, 0x00, 0x0f, 0x4a, 0xcb, 0x0e, 0x0b, 0xc7, 0x00, 0x0d, 0x46, 0x00, 0x02, 0xc6, 0x00,
+                0x0c, 0x26, 0xcb, 0x0a, 0x48, 0x01, 0x01, 0xbc, 0x02, 0x04, 0xdd, 0x56, 0x03, 0xd6, 0x56, 0x0f, 0x15, 0xd3, 0x1e, 0x02,
+                0x8e, 0x3d, 0x02, 0x9e, 0x47, 0x04, 0x94, 0x3d, 0x08, 0xca, 0x00, 0x03, 0x10, 0x67, 0x02, 0x6d, 0x02, 0x0f, 0x5d, 0x18,
+                0x01, 0x05, 0x88, 0x3d, 0x07, 0xba, 0x00, 0x06, 0x82, 0x3d, 0x0b, 0xaa, 0x02, 0x0f, 0x7d, 0x3d, 0x03, 0x07, 0xb5, 0x1a,
+                0x40, 0x4c, 0x61, 0x74, 0x65, 0xc1, 0xe6, 0x06, 0x21, 0x3e, 0x0a, 0x8d, 0x00, 0x0f, 0xac, 0x47, 0x0b, 0x0a, 0x45, 0x00,
+                0x0f, 0x97, 0x00, 0x08, 0x0f, 0xa0, 0x47, 0x09, 0x07, 0xfb, 0x3e, 0x0f, 0x8e, 0x00, 0x0d, 0x0f, 0x7e, 0x5c, 0x06, 0x0e,
+                0x44, 0x00, 0x0f, 0x8d, 0x00, 0x08, 0x0b, 0xbe, 0x02, 0x0f, 0x1c, 0x19, 0x38, 0x41, 0x41, 0x6c, 0x6c, 0x3b, 0xa1, 0x5f,
+                0x21, 0x6f, 0x66, 0x10, 0xf8, 0x02, 0xff, 0xa4, 0x02, 0xea, 0x0a, 0x70, 0x73, 0x20, 0x28, 0x77, 0x61, 0x69, 0x74, 0x18,
+                0xd8, 0x11, 0x2b, 0x0d, 0xea, 0x3f, 0x69, 0x6e, 0x67, 0x32, 0x51, 0x02, 0x09, 0x50, 0x0b, 0x0f, 0xe9, 0x3e, 0x0d, 0x0f,
+                0xc5, 0x04, 0x00, 0x0f, 0x7a, 0x0f, 0x2a, 0x00, 0x9c, 0xf3, 0x00, 0xa3, 0x00, 0x00, 0x6c, 0x0b, 0xc1, 0x61, 0x20, 0x73,
+                0x79, 0x6e, 0x63, 0x68, 0x72, 0x6f, 0x6e, 0x69, 0x7a, 0x9e, 0x0b, 0x04, 0xe2, 0xf1, 0x0f, 0x2e, 0x0c, 0x17, 0x33, 0x2c,
+                0x20, 0x27, 0x74, 0xf3, 0x0f, 0xea, 0x58, 0x0c, 0x02, 0xc2, 0x00, 0x02, 0x67, 0xeb, 0x04, 0x2c, 0x0c, 0x0f, 0x6e, 0x00,
+                0x04, 0x0f, 0xc2, 0x00, 0x18, 0x73, 0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69, 0x63, 0x5a, 0x57, 0x60, 0x20, 0x74, 0x61, 0x72,
+                0x67, 0x65, 0xf3, 0x03, 0x00, 0x4a, 0x0e, 0x02, 0xd2, 0x00, 0x00, 0x78, 0x50, 0x00, 0x7c, 0x00, 0x10, 0x20, 0xa3, 0xa6,
+                0x20, 0x70, 0x64, 0xfe, 0xd3, 0x0e, 0xc2, 0x00, 0x02, 0x3e, 0x00, 0x00, 0xd6, 0x39, 0x4a, 0x6c, 0x76, 0x69, 0x6e, 0x68,
+                0x12, 0x0f, 0xc2, 0x00, 0x0b, 0x01, 0x3a, 0x00, 0x10, 0x5f, 0xa2, 0x2a, 0x08, 0x3a, 0x00, 0x0f, 0x84, 0x01, 0x1a, 0x41,
+                0x62, 0x75, 0x73, 0x79, 0x25, 0x4a, 0x10, 0x6c, 0x6f, 0xfa, 0x10, 0x61, 0xa3, 0x4f, 0x16, 0x65, 0xf7, 0xf6, 0x01, 0x98,
+                0x0c, 0x30, 0x3b, 0x20, 0x77, 0x96, 0xdb, 0x30, 0x64, 0x20, 0x73, 0x5f, 0x03, 0x51, 0x75, 0x6c, 0x65, 0x72, 0x20, 0x77,
+                0x0d, 0x02, 0x6f, 0x00, 0x01, 0x64, 0x58, 0x03, 0x2f, 0x00, 0x01, 0x31, 0x07, 0x0f, 0x33, 0x67, 0x01, 0x0f, 0xc2, 0x00,
+                0x05, 0x05, 0x41, 0xf8, 0x01, 0x11, 0x00, 0x0f, 0xb3, 0x3f, 0x15, 0x08, 0xc2, 0x00, 0x02, 0x62, 0x53, 0x09, 0x35, 0x5b,
+                0x00, 0x79, 0x75, 0x50, 0x70, 0x69, 0x78, 0x6f, 0x75, 0x5f, 0x39, 0x01, 0x8f, 0x01, 0x70, 0x6c, 0x65, 0x74, 0x65, 0x20,
+                0x61, 0x66, 0x64, 0x4d, 0x01, 0x8e, 0x01, 0x49, 0x45, 0x58, 0x49, 0x54, 0x42, 0x1a, 0x53, 0x44, 0x72, 0x61, 0x69, 0x6e,
+                0x22, 0x00, 0x0d, 0xbd, 0x10, 0x0f, 0xc2, 0x00, 0x0b, 0x00, 0x3a, 0x00, 0x0e, 0x7e, 0x02, 0x0f, 0xc2, 0x00, 0x18, 0xb0,
+                0x49, 0x4d, 0x43, 0x20, 0x28, 0x69, 0x6d, 0x6d, 0x65, 0x64, 0x69, 0xaa, 0x70, 0x04, 0x1f, 0x5b, 0x20, 0x20, 0x63, 0x9a,
+                0xb3, 0x31, 0x29, 0x20, 0x2d, 0x25, 0x00, 0x10, 0x73, 0x51, 0x02, 0x16, 0x63, 0x1d, 0x00, 0x73, 0x61, 0x64, 0x64, 0x72,
+                0x65, 0x73, 0x73, 0xbe, 0x18, 0x00, 0xae, 0x5a, 0x6f, 0x4d, 0x43, 0x20, 0x4d, 0x69, 0x73, 0xa4, 0x53, 0x03, 0x0f, 0xc2,
+                0x00, 0x0a, 0x5e, 0x69, 0x6d, 0x63, 0x5f, 0x6d, 0x3a, 0x00, 0x0f, 0xc2, 0x00, 0x18, 0x70, 0x66, 0x72, 0x65, 0x65, 0x20,
+                0x73, 0x70, 0xf1, 0x54, 0x21, 0x69, 0x6e, 0x41, 0x02, 0x32, 0x4c, 0x47, 0x20, 0xf4, 0x8b, 0x52, 0x46, 0x49, 0x46, 0x4f,
+                0x3a, 0x9f, 0x56, 0x12, 0x2f, 0xfc, 0x7c, 0x08, 0xab, 0x01, 0x02, 0xb6, 0xee, 0x00, 0xa6, 0x01, 0x30, 0x4c, 0x53, 0x55,
+                0x0f, 0x08, 0x30, 0x4c, 0x47, 0x20, 0x04, 0x0a, 0x10, 0x74, 0x59, 0x6f, 0x0f, 0xc6, 0x00, 0x1b, 0x21, 0x6c, 0x67, 0x9a,
+                0x88, 0x0c, 0x3a, 0x00, 0x0f, 0xc6, 0x00, 0x14, 0x20, 0x6f, 0x6e, 0xdb, 0x0f, 0x11, 0x69, 0xd9, 0x11, 0x13, 0x6c, 0x26,
+                0x06, 0x20, 0x64, 0x65, 0x42, 0x0a, 0x00, 0x0b, 0x00, 0x10, 0x3a, 0x9f, 0x00, 0x28, 0x20, 0x28, 0xc6, 0x00, 0x30, 0x29,
+                0x2c, 0x20, 0x92, 0x78, 0x13, 0x28, 0xe2, 0x7a, 0x14, 0x2c, 0xf2, 0x55, 0x11, 0x29, 0xc6, 0x00, 0xdb, 0x6f, 0x6e, 0x67,
+                0x20, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x62, 0x6f, 0x61, 0x72, 0x41, 0x13, 0x0f, 0xc6, 0x00, 0x0b, 0x5d, 0x6f, 0x6e, 0x67,
+                0x5f, 0x73, 0x3a, 0x00, 0x0f, 0xd2, 0x03, 0x1a, 0x42, 0x6d, 0x61, 0x74, 0x68, 0xbd, 0x53, 0xbf, 0x74, 0x6f, 0x20, 0x62,
+                0x65, 0x63, 0x6f, 0x6d, 0x65, 0x20, 0x61, 0x02, 0xd1, 0x06, 0x0f, 0x2e, 0x02, 0x03, 0x00, 0xb5, 0x20, 0x02, 0xe8, 0x5f,
+                0x0f, 0x8f, 0x01, 0x00, 0x0f, 0xc2, 0x00, 0x0a, 0x00, 0x7e, 0x00, 0x03, 0xbb, 0x56, 0x08, 0x3a, 0x00, 0x0f, 0xc2, 0x00,
+                0x1b, 0x02, 0xd4, 0x03, 0x0f, 0x0f, 0x06, 0x1e, 0x09, 0xc2, 0x00, 0x02, 0x44, 0x00, 0x0f, 0x1f, 0x06, 0x03, 0x0f, 0xc2,
+                0x00, 0x0b, 0x4e, 0x65, 0x6d, 0x62, 0x61, 0x76, 0x00, 0x0f, 0x10, 0x03, 0x2a, 0x00, 0x55, 0x90, 0x08, 0x11, 0x03, 0xa0,
+                0x41, 0x44, 0x55, 0x2c, 0x20, 0x43, 0x42, 0x55, 0x2c, 0x20, 0x4e, 0x5b, 0x12, 0x2c, 0x60, 0x02, 0x39, 0x6e, 0x6f, 0x74,
+                0x2a, 0x03, 0x60, 0x29, 0x2c, 0x20, 0x49, 0x50, 0x41, 0x51, 0x02, 0x00, 0x3f, 0x00, 0x0f, 0x18, 0x03, 0x06, 0x0f, 0xcd,
+                0x00, 0x0b, 0x2f, 0x69, 0x6f, 0x18, 0x03, 0x01, 0x0f, 0x8f, 0x01, 0x1b, 0xc3, 0x69, 0x73, 0x63, 0x65, 0x6c, 0x6c, 0x61,
+                0x6e, 0x65, 0x6f, 0x75, 0x73, 0x6f, 0x08, 0x70, 0x20, 0x28, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x3f, 0xfb, 0x5f, 0x20, 0x72,
+                0x61, 0x72, 0x65, 0x6b, 0x08, 0x0a, 0x00, 0xc2, 0x00, 0x0f, 0x87, 0x5a, 0x05, 0x0f, 0xc2, 0x00, 0x10, 0x0f, 0x3a, 0x00,
+                0x02, 0x0f, 0xc2, 0x00, 0x18, 0x08, 0x71, 0x04, 0x10, 0x66, 0x28, 0x7f, 0x10, 0x2c, 0x22, 0x06, 0x08, 0x16, 0x00, 0x01,
+                0x6b, 0x05, 0x00, 0xe8, 0x00, 0x0f, 0xf8, 0xf9, 0x07, 0x38, 0x27, 0x4e, 0x6f, 0x6c, 0x93, 0x0f, 0x51, 0x02, 0x19, 0x21,
+                0x6e, 0x6f, 0xb9, 0x0c, 0x0c, 0x3a, 0x00, 0x0f, 0x2b, 0x09, 0x1b, 0x0a, 0x7b, 0x07, 0x60, 0x2c, 0x20, 0x66, 0x72, 0x6f,
+                0x6d, 0xfb, 0xf3, 0x01, 0x04, 0x0a, 0x40, 0x77, 0x69, 0x73, 0x65, 0x99, 0x01, 0x62, 0x64, 0x79, 0x2d, 0x74, 0x6f, 0x2d,
+                0x55, 0x05, 0x00, 0x8a, 0x00, 0x0a, 0xb5, 0x03, 0x9f, 0x4e, 0x6f, 0x74, 0x20, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x32, 0x37,
+                0x01, 0x0f, 0xc2, 0x00, 0x0c, 0x00, 0x85, 0x7b, 0x0d, 0x3a, 0x00, 0x0f, 0xf6, 0x91, 0x0d, 0x02, 0x86, 0x0a, 0x00, 0xa6,
+                0x00, 0x0f, 0x00, 0x01, 0x01, 0x0f, 0xd5, 0x03, 0x20, 0x0f, 0xbe, 0x00, 0x06, 0x0f, 0xc2, 0x00, 0x0e, 0x0f, 0xbe, 0x00,
+                0x00, 0x0f, 0x1f, 0x06, 0x38, 0x1f, 0x58, 0xc9, 0x03, 0x0e, 0x06, 0xf1, 0x03, 0x70, 0x4c, 0x44, 0x43, 0x2f, 0x49, 0x44,
+                0x43, 0xd7, 0x03, 0x01, 0x63, 0xd1, 0x0f, 0x29, 0x06, 0x05, 0x0f, 0xcf, 0x00, 0x0b, 0x00, 0x3a, 0x00, 0x0e, 0x29, 0x06,
+                0x0f, 0x53, 0x02, 0x1a, 0xa0, 0x6e, 0x61, 0x6e, 0x6f, 0x73, 0x6c, 0x65, 0x65, 0x70, 0x20, 0xa2, 0x39, 0x10, 0x72, 0x2e,
+                0x06, 0x5f, 0x65, 0x78, 0x70, 0x69, 0x72, 0xab, 0x35, 0x16, 0x00, 0xc2, 0x00, 0x00, 0x40, 0x00, 0x0c, 0xb4, 0x0a, 0x0f,
+                0xc2, 0x00, 0x13, 0x0f, 0x3a, 0x00, 0x03, 0x0f, 0x66, 0x05, 0x2a, 0x00, 0x92, 0x07, 0x08, 0x66, 0x05, 0x00, 0x10, 0x00,
+                0x02, 0x09, 0x07, 0x03, 0x9b, 0x5d, 0x00, 0x49, 0x09, 0x03, 0x9a, 0x5d, 0x09, 0x66, 0x65, 0x00, 0x0a, 0x0d, 0x2f, 0x45,
+                0x58, 0x63, 0x05, 0x24, 0x04, 0x15, 0x91, 0x0f, 0x63, 0x05, 0x23, 0x00, 0x25, 0x0c, 0x30, 0x20, 0x66, 0x69, 0x19, 0x65,
+                0x0e, 0x5a, 0x02, 0x0f, 0x0a, 0x0d, 0x1a, 0x00, 0xba, 0x1a, 0x12, 0x6f, 0x17, 0x5d, 0x0e, 0xca, 0x00, 0x0f, 0xc2, 0x00,
+                0x0a, 0x00, 0x39, 0x0e, 0x0f, 0x63, 0x05, 0x04, 0x0a, 0xc3, 0x00, 0x0f, 0xce, 0xe6, 0x1c, 0x01, 0x3d, 0x47, 0x03, 0xcc,
+                0xe6, 0x00, 0xc1, 0x47, 0x0f, 0xca, 0xe6, 0x27, 0x0f, 0x8a, 0x19, 0x57, 0x02, 0x24, 0x12, 0x0f, 0x4f, 0x7b, 0x0a, 0x0f,
+                0xd1, 0xe6, 0x28, 0x0f, 0xbb, 0xd6, 0x57, 0x0f, 0xf8, 0x48, 0x44, 0x0f, 0x7a, 0x00, 0x36, 0x0f, 0xd0, 0x2f, 0x01, 0x07,
+                0xed, 0x11, 0x0f, 0x76, 0x00, 0x1b, 0x0a, 0x26, 0x12, 0x0f, 0xe6, 0x4a, 0x28, 0x0f, 0x7e, 0x00, 0x22, 0x0a, 0x17, 0x12,
+                0x0f, 0x8d, 0x16, 0x3c, 0x05, 0x01, 0xbb, 0x00, 0x44, 0x95, 0x00, 0xae, 0x67, 0x0f, 0xe3, 0x2e, 0x26, 0x00, 0xe0, 0x12,
+                0x00, 0xdc, 0x95, 0x43, 0x72, 0x69, 0x6d, 0x73, 0x0c, 0x00, 0x00, 0x6d, 0x2b, 0x04, 0x0c, 0x00, 0x00, 0xd5, 0x2f, 0x00,
+                0x7a, 0x49, 0x10, 0x75, 0x13, 0x04, 0x03, 0x25, 0x00, 0x36, 0x6f, 0x75, 0x74, 0x32, 0x00, 0x02, 0x0d, 0x00, 0x03, 0x33,
+                0x00, 0x02, 0x0d, 0x00, 0x01, 0x34, 0x00, 0x0c, 0x3f, 0x15, 0x00, 0xd0, 0x12, 0x0b, 0x2e, 0x15, 0x50, 0x49, 0x66, 0x44,
+                0x65, 0x66, 0xcb, 0x38, 0x08, 0x91, 0x4a, 0x08, 0x82, 0x15, 0x0c, 0x8e, 0x32, 0x0f, 0x43, 0xe2, 0x05, 0x05, 0x7f, 0x1f,
+                0x0f, 0x44, 0xe2, 0x00, 0x05, 0xd1, 0x4a, 0x0d, 0xac, 0x1f, 0x0d, 0xfa, 0x9f, 0x06, 0xec, 0x33, 0x0f, 0xa8, 0xe2, 0x1c,
+                0x0d, 0x64, 0x00, 0x0f, 0x49, 0xe2, 0x05, 0x0f, 0x66, 0x33, 0x04, 0x05, 0x40, 0x00, 0x0f, 0x19, 0xe2, 0x20, 0x0b, 0xb0,
+                0xa0, 0x0e, 0xaa, 0x80, 0x06, 0x54, 0x00, 0x02, 0x71, 0x43, 0x0f, 0x76, 0x01, 0x40, 0x00, 0x0d, 0x4c, 0x0f, 0x33, 0x01,
+                0x25, 0x0e, 0xa3, 0xe3, 0x0a, 0xd2, 0x00, 0x05, 0x29, 0x00, 0x0f, 0xee, 0xe2, 0x0f, 0x0b, 0xfd, 0x00, 0x06, 0x7c, 0x31,
+                0x04, 0x78, 0x31, 0x0f, 0xbd, 0x15, 0x02, 0x04, 0xcb, 0x02, 0x05, 0x18, 0x00, 0x0d, 0xd6, 0x17, 0x05, 0x32, 0x01, 0x16,
+                0x28, 0x2e, 0x00, 0x0f, 0x09, 0x16, 0x03, 0x04, 0x1e, 0x00, 0x07, 0x93, 0x83, 0x0f, 0x7f, 0x01, 0x06, 0x0f, 0x4d, 0x00,
+                0x11, 0x01, 0x57, 0x03, 0x0f, 0x99, 0x00, 0x16, 0x01, 0x2e, 0x00, 0x0f, 0x4c, 0x00, 0x0b, 0x0f, 0x99, 0x00, 0x17, 0x0f,
+                0x4d, 0x00, 0x0b, 0x01, 0xe3, 0x03, 0x0f, 0x99, 0x00, 0x16, 0x02, 0x11, 0x04, 0x0f, 0x4c, 0x00, 0x0a, 0x0f, 0x99, 0x00,
+                0x17, 0x0f, 0x4d, 0x00, 0x06, 0x07, 0xa4, 0x04, 0x0f, 0x99, 0x00, 0x10, 0x07, 0x2e, 0x00, 0x0f, 0x4d, 0x00, 0x0c, 0x06,
+                0x58, 0x46, 0x0f, 0x9a, 0x00, 0x07, 0x0f, 0x4e, 0x00, 0x0c, 0x07, 0x32, 0x05, 0x0f, 0x9b, 0x00, 0x10, 0x07, 0x2e, 0x00,
+                0x0f, 0x4d, 0x00, 0x0c, 0x0f, 0x9b, 0x00, 0x11, 0x0f, 0x4e, 0x00, 0x12, 0x09, 0x69, 0x02, 0x0f, 0x9b, 0x00, 0x0e, 0x0f,
+                0x1c, 0x02, 0x06, 0x07, 0x1f, 0x00, 0x0f, 0x9b, 0x00, 0x17, 0x0f, 0x4e, 0x00, 0x0c, 0x09, 0x6b, 0x02, 0x0f, 0x9b, 0x00,
+                0x0e, 0x0f, 0x1e, 0x02, 0x06, 0x07, 0x1f, 0x00, 0x0f, 0x9b, 0x00, 0x17, 0x0e, 0x4e, 0x00, 0x0f, 0x9a, 0xa3, 0x0d, 0x0f,
+                0x45, 0x7a, 0x01, 0x06, 0xae, 0xc2, 0x32, 0x44, 0x69, 0x73, 0x53, 0x6c, 0x0b, 0xee, 0x6a, 0x04, 0x8d, 0x0b, 0x01, 0xaa,
+                0xf7, 0x01, 0xe6, 0x02, 0x20, 0x5f, 0x70, 0xb1, 0x01, 0x0c, 0xfb, 0x0d, 0x07, 0x20, 0x00, 0x10, 0x76, 0x36, 0x01, 0x0f,
+                0x98, 0x10, 0x09, 0x09, 0xa1, 0x05, 0x0f, 0x20, 0x00, 0x1b, 0x0f, 0x94, 0x00, 0x17, 0x0d, 0x54, 0x00, 0x0f, 0x54, 0xe5,
+                0x08, 0x0f, 0x74, 0x00, 0x0b, 0x0f, 0x80, 0x7b, 0x03, 0x0f, 0xf8, 0x33, 0x0a, 0x0f, 0x3b, 0x01, 0x1a, 0x0f, 0xde, 0x5c,
+                0x01, 0x0f, 0x17, 0x34, 0x00, 0x0f, 0xc7, 0x00, 0x2d, 0x0f, 0x3b, 0x01, 0x24, 0x0f, 0x9e, 0x00, 0x0c, 0x0f, 0x96, 0x00,
+                0x0d, 0x0f, 0x3d, 0x01, 0x03, 0x00, 0x0d, 0x31, 0x1f, 0x2e, 0x22, 0x33, 0x06, 0x0f, 0x2e, 0x02, 0x19, 0x0f, 0x9f, 0x00,
+                0x09, 0x07, 0x40, 0x33, 0x0f, 0x3d, 0x01, 0x3a, 0x0f, 0x4a, 0x00, 0x0a, 0x0f, 0x78, 0x02, 0x1e, 0x0f, 0x3b, 0x01, 0x22,
+                0x0f, 0x49, 0x32, 0x05, 0x0f, 0x7d, 0x00, 0x19, 0x0f, 0x3b, 0x01, 0x0a, 0x06, 0x67, 0x32, 0x0f, 0x3b, 0x01, 0xb7, 0x0f,
+                0x6f, 0x31, 0x0a, 0x0f, 0x3b, 0x01, 0x36, 0x07, 0x8e, 0x31, 0x0f, 0x3b, 0x01, 0xb7, 0x81, 0x53, 0x74, 0x72, 0x65, 0x61,
+                0x6d, 0x20, 0x28, 0xa8, 0x6e, 0x00, 0x58, 0x0e, 0x50, 0x20, 0x46, 0x65, 0x65, 0x64, 0x64, 0x9f, 0x09, 0x49, 0x17, 0x0f,
+                0xdf, 0x05, 0x3a, 0x0f, 0x29, 0x06, 0x38, 0x00, 0xa1, 0xfc, 0x11, 0x73, 0xc3, 0x00, 0x12, 0x5f, 0x3f, 0x07, 0x0f, 0xf6,
+                0x04, 0x02, 0x0f, 0x2a, 0x00, 0x03, 0x06, 0xcf, 0x06, 0x0f, 0x20, 0x00, 0x03, 0x00, 0x6c, 0x58, 0x02, 0x20, 0x00, 0x0f,
+                0x3b, 0x01, 0x03, 0x06, 0x64, 0x07, 0xc8, 0x41, 0x73, 0x73, 0x65, 0x6d, 0x62, 0x6c, 0x79, 0x20, 0x43, 0x6c, 0x69, 0xeb,
+                0x16, 0x04, 0x7d, 0x00, 0x10, 0x76, 0x2d, 0x2c, 0x4f, 0x63, 0x6c, 0x69, 0x70, 0x9a, 0x05, 0x01, 0x0f, 0x02, 0x02, 0x3a,
+                0x0f, 0x6a, 0x00, 0x02, 0x00, 0xf6, 0x94, 0x00, 0x14, 0x00, 0x15, 0x70, 0x76, 0x16, 0x09, 0x2a, 0x00, 0x0f, 0x39, 0x01,
+                0x08, 0x0f, 0xaf, 0x01, 0x2f, 0x0f, 0x3b, 0x01, 0x17, 0x1d, 0x75, 0xb1, 0x1f, 0x06, 0xa7, 0x00, 0x3f, 0x75, 0x6c, 0x6c,
+                0x3b, 0x01, 0x54, 0x0b, 0x6a, 0x00, 0x01, 0x3b, 0x01, 0x01, 0x69, 0x0b, 0x07, 0x74, 0x00, 0x0f, 0x2a, 0x00, 0x06, 0x00,
+                0xab, 0x11, 0x09, 0x2a, 0x00, 0x0f, 0x3b, 0x01, 0x53, 0x10, 0x28, 0xad, 0x7b, 0x01, 0x26, 0xa8, 0x15, 0x73, 0xb5, 0x03,
+                0x04, 0xa7, 0x00, 0x0f, 0x9f, 0x08, 0x08, 0x0f, 0xb1, 0x03, 0x61, 0x01, 0x94, 0x00, 0x0f, 0x71, 0x02, 0x0a, 0x0f, 0x74,
+                0x00, 0x15, 0x08, 0x4a, 0x00, 0x06, 0xaa, 0x03, 0x06, 0x3b, 0x01, 0x0f, 0xd8, 0xf6, 0x7e, 0x01, 0x0f, 0x10, 0x0f, 0x74,
+                0x5f, 0x25, 0x05, 0x4f, 0x0d, 0x09, 0x10, 0x14, 0x0f, 0xf3, 0x5e, 0x11, 0x0b, 0xb8, 0x0d, 0x0f, 0xf6, 0x5f, 0x26, 0x05,
+                0x36, 0x0d, 0x0f, 0x82, 0x00, 0x21, 0x08, 0x9f, 0x0d, 0x0f, 0x82, 0x00, 0x29, 0x02, 0x1d, 0x0d, 0x0f, 0x82, 0x00, 0x21,
+                0x08, 0x86, 0x0d, 0x0f, 0x82, 0x00, 0x24, 0x08, 0x71, 0x0f, 0x0f, 0x83, 0x00, 0x1c, 0x0e, 0xdb, 0x0f, 0x0f, 0x84, 0x00,
+                0x24, 0x08, 0x5a, 0x0f, 0x0f, 0x84, 0x00, 0x1c, 0x0e, 0xc4, 0x0f, 0x0f, 0x84, 0x00, 0x2a, 0x0f, 0x0d, 0x02, 0x22, 0x0e,
+                0xad, 0x0f, 0x0f, 0x84, 0x00, 0x2a, 0x0f, 0x0f, 0x02, 0x22, 0x0e, 0x96, 0x0f, 0x0f, 0x29, 0x17, 0x3c, 0x10, 0x52, 0xa4,
+                0x26, 0x1f, 0x72, 0x26, 0x17, 0x30, 0x10, 0x70, 0x1e, 0x38, 0x11, 0x73, 0x48, 0x1c, 0x04, 0x0d, 0x00, 0x20, 0x4b, 0x69,
+                0x49, 0x02, 0x04, 0x0e, 0x00, 0x11, 0x4f, 0xcb, 0x00, 0x40, 0x2c, 0x20, 0x73, 0x61, 0x30, 0x01, 0x04, 0x2a, 0x00, 0x03,
+                0x0e, 0x00, 0x04, 0x2b, 0x00, 0x03, 0x0f, 0x00, 0x02, 0x2c, 0x00, 0x0f, 0x23, 0x17, 0xff, 0xff, 0x96, 0x07, 0xfa, 0x02,
+                0x06, 0x1a, 0x00, 0x0f, 0x89, 0x13, 0x08, 0x07, 0x30, 0x00, 0x0f, 0x4b, 0x2e, 0x02, 0x06, 0x1f, 0x00, 0x06, 0xb6, 0x9b,
+                0x0f, 0x8b, 0x13, 0x09, 0x0f, 0x50, 0x00, 0x12, 0x02, 0x61, 0x03, 0x0f, 0x9f, 0x00, 0x17, 0x02, 0x30, 0x00, 0x0f, 0x50,
+                0x00, 0x0d, 0x0f, 0x96, 0x16, 0x12, 0x0f, 0x51, 0x00, 0x13, 0x02, 0xf3, 0x03, 0x0f, 0xa1, 0x00, 0x17, 0x03, 0x23, 0x04,
+                0x0f, 0x50, 0x00, 0x0c, 0x0f, 0xa1, 0x00, 0x18, 0x0f, 0x51, 0x00, 0x07, 0x08, 0xb2, 0x04, 0x0f, 0xa1, 0x00, 0x11, 0x08,
+                0x30, 0x00, 0x0f, 0x50, 0x00, 0x0d, 0x0f, 0xa1, 0x00, 0x12, 0x0f, 0x51, 0x00, 0x14, 0x0a, 0xe4, 0x01, 0x0f, 0xa1, 0x00,
+                0x0f, 0x0f, 0x93, 0x01, 0x07, 0x09, 0x21, 0x00, 0x0f, 0x0f, 0x16, 0x11, 0x0f, 0x52, 0x00, 0x15, 0x0a, 0xe6, 0x01, 0x0f,
+                0xa3, 0x00, 0x0f, 0x0f, 0x95, 0x01, 0x0e, 0x0a, 0xe7, 0x01, 0x0f, 0xa3, 0x00, 0x10, 0x0f, 0x52, 0x00, 0x00, 0x0f, 0xcc,
+                0x5e, 0x17, 0x07, 0xdb, 0x0c, 0x5f, 0x5a, 0x43, 0x55, 0x4c, 0x4c, 0xbd, 0x11, 0x08, 0x11, 0x72, 0x59, 0x07, 0x37, 0x5f,
+                0x5f, 0x7a, 0x7c, 0x0d, 0x03, 0x83, 0x00, 0x0f, 0x47, 0x0c, 0x06, 0x0f, 0x34, 0x00, 0x08, 0x02, 0x0d, 0xa4, 0x1b, 0x6a,
+                0x8e, 0x25, 0x0f, 0x34, 0x00, 0x0f, 0x20, 0x61, 0x63, 0x89, 0x87, 0x0b, 0x34, 0x00, 0x0f, 0x03, 0x0d, 0x14, 0x0f, 0x37,
+                0x0d, 0x21, 0x0f, 0x34, 0x00, 0x2c, 0x0f, 0x47, 0x0e, 0x04, 0x32, 0x52, 0x4f, 0x50, 0xa3, 0x24, 0x0f, 0xd5, 0xfb, 0x04,
+                0x00, 0x33, 0xca, 0x04, 0x3e, 0x0e, 0x01, 0xcd, 0x03, 0x8f, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x5f, 0x33, 0x64, 0x4b, 0x5f,
+                0x04, 0x0f, 0x04, 0x01, 0x5c, 0x0f, 0x47, 0x2c, 0x19, 0x0f, 0x6c, 0x01, 0x72, 0x6f, 0x45, 0x61, 0x72, 0x6c, 0x79, 0x5a,
+                0x19, 0xfe, 0x1f, 0x0f, 0x9c, 0x00, 0x04, 0x02, 0xa0, 0x01, 0x10, 0x65, 0x55, 0x00, 0x31, 0x7a, 0x5f, 0x6b, 0x24, 0x04,
+                0x04, 0xa8, 0x01, 0x0f, 0xa0, 0x01, 0x0a, 0x0f, 0x68, 0x00, 0x2a, 0x0f, 0x73, 0x03, 0x10, 0x0f, 0x9c, 0x00, 0x05, 0x0f,
+                0xa8, 0x03, 0x0d, 0x09, 0x34, 0x00, 0x03, 0xd7, 0x0f, 0x0f, 0x34, 0x00, 0x0b, 0x0f, 0x6c, 0x01, 0x04, 0x07, 0x52, 0x43,
+                0x12, 0x28, 0x74, 0x01, 0x30, 0x20, 0x2b, 0x20, 0x15, 0x23, 0x11, 0x5a, 0x12, 0x2f, 0x0f, 0xe1, 0x15, 0x09, 0x21, 0x70,
+                0x73, 0xae, 0x00, 0x85, 0x6d, 0x61, 0x73, 0x6b, 0x5f, 0x6f, 0x66, 0x66, 0x56, 0x32, 0x0f, 0x70, 0x02, 0x25, 0x0f, 0xa4,
+                0x02, 0x83, 0x0f, 0xd8, 0x02, 0x3c, 0x01, 0x5b, 0x01, 0x0f, 0xe3, 0x19, 0x07, 0x0f, 0x38, 0x01, 0x55, 0x0f, 0x34, 0x00,
+                0x51, 0x02, 0xa4, 0x02, 0x00, 0x1d, 0x29, 0x0f, 0xd7, 0x02, 0x13, 0x0c, 0x34, 0x00, 0x0f, 0xd7, 0x02, 0x11, 0x0f, 0x6c,
+                0x01, 0x05, 0x01, 0xaf, 0xd7, 0x0f, 0x9c, 0x00, 0x0e, 0x00, 0x06, 0x00, 0x02, 0x73, 0xbc, 0x01, 0x19, 0xd4, 0x0f, 0x11,
+                0x04, 0x09, 0x0f, 0xb0, 0x05, 0x90, 0x0f, 0x34, 0x00, 0x4f, 0x0f, 0xd8, 0x02, 0x08, 0x3f, 0x43, 0x6f, 0x6c, 0x32, 0x1f,
+                0x01, 0x0f, 0xd8, 0x02, 0xc1, 0x0f, 0x6c, 0x01, 0x69, 0x01, 0x61, 0xd6, 0x0f, 0xd8, 0x02, 0x18, 0x01, 0xcb, 0xd2, 0x0f,
+                0xd8, 0x02, 0x10, 0x0f, 0x6c, 0x01, 0xee, 0x0f, 0x00, 0x17, 0xb9, 0x08, 0x8f, 0x0f, 0x0f, 0xee, 0x13, 0x1c, 0x0e, 0xfb,
+                0x0f, 0x0f, 0x72, 0x14, 0x24, 0x09, 0x73, 0x0f, 0x0f, 0x85, 0x00, 0x22, 0x09, 0xfb, 0x0d, 0x0f, 0x86, 0x00, 0x2a, 0x03,
+                0x71, 0x0d, 0x0f, 0x86, 0x00, 0x22, 0x09, 0xde, 0x0d, 0x0f, 0x86, 0x00, 0x24, 0x09, 0x3d, 0x0f, 0x0f, 0x86, 0x00, 0x1c,
+                0x0f, 0xaa, 0x0f, 0x00, 0x0f, 0x86, 0x00, 0x2b, 0x0f, 0x93, 0x01, 0x23, 0x0f, 0x8f, 0x0f, 0x01, 0x0f, 0x88, 0x00, 0x2b,
+                0x0f, 0x95, 0x01, 0x23, 0x0f, 0x74, 0x0f, 0x01, 0x0f, 0x20, 0xbc, 0x3d, 0x0f, 0xa1, 0xf4, 0x06, 0x02, 0x9b, 0x38, 0x13,
+                0x41, 0xab, 0xd2, 0x0f, 0xa9, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xa6, 0x0f, 0xdf, 0xda, 0x0c, 0x0f, 0xd3, 0xda, 0x10, 0x0f,
+                0xf5, 0xf4, 0x26, 0x0f, 0x30, 0xdb, 0x13, 0x0f, 0x07, 0xf5, 0x4c, 0x0f, 0xbd, 0xf4, 0xff, 0xd9, 0x0f, 0x81, 0xf0, 0x21,
+                0x0f, 0x38, 0xf0, 0xff, 0x00, 0x0f, 0xaa, 0xed, 0x27, 0x0f, 0x5b, 0xed, 0xff, 0x00, 0x0f, 0x46, 0xbb, 0x07, 0x0f, 0xab,
+                0xea, 0x1c, 0x0f, 0x4b, 0x05, 0x1d, 0x0f, 0xbd, 0xea, 0x18, 0x0f, 0x72, 0xea, 0xff, 0x04, 0x0f, 0xd8, 0xe7, 0x18, 0x0f,
+                0x8d, 0xe7, 0xf7, 0x0f, 0xef, 0x02, 0x07, 0x0f, 0x2c, 0xe4, 0x2f, 0x0f, 0xef, 0x02, 0x0a, 0x0f, 0x8f, 0xe4, 0x33, 0x0f,
+                0xcd, 0xe3, 0xe2, 0x0f, 0xd4, 0xc1, 0x13, 0x0f, 0xe7, 0xe3, 0x13, 0x0f, 0xdb, 0xe3, 0x0e, 0x0f, 0x4b, 0x0a, 0x30, 0x0f,
+                0x36, 0xe4, 0x07, 0x0f, 0x49, 0x0a, 0x56, 0x0f, 0xeb, 0xfc, 0xff, 0xc4, 0x0f, 0x3f, 0x0a, 0x2c, 0x0f, 0x35, 0xf9, 0xef,
+                0x0f, 0x39, 0x0a, 0x31, 0x0f, 0x40, 0xf6, 0xef, 0x0f, 0x33, 0x0a, 0x40, 0x0f, 0x33, 0x05, 0x11, 0x0f, 0x31, 0x0a, 0x22,
+                0x0f, 0x5b, 0xf3, 0xf3, 0x0f, 0x2b, 0x0a, 0x22, 0x0f, 0x70, 0xf0, 0xe7, 0x0f, 0x25, 0x0a, 0x40, 0x0f, 0xe1, 0x02, 0x11,
+                0x0f, 0x23, 0x0a, 0x2a, 0x0f, 0xab, 0xec, 0xe5, 0x0f, 0x1d, 0x0a, 0x13, 0x0f, 0xc5, 0xec, 0x15, 0x0f, 0x62, 0xf0, 0x1a,
+                0x0f, 0x21, 0x0a, 0x26, 0x0f, 0xf6, 0xef, 0x13, 0x0f, 0x23, 0x0a, 0x4c, 0x0f, 0x0b, 0xf3, 0x3d, 0x0f, 0x5d, 0x00, 0x00,
+                0x0f, 0x27, 0x0a, 0x50, 0x0f, 0x9b, 0xed, 0x15, 0x0f, 0x29, 0x0a, 0x30, 0x06, 0x6b, 0x00, 0x0f, 0x2b, 0x0a, 0x50, 0x08,
+                0x41, 0x01, 0x0f, 0x2d, 0x0a, 0x62, 0x0f, 0x1f, 0x02, 0x3d, 0x0e, 0x5c, 0x00, 0x0f, 0x31, 0x0a, 0x4f, 0x0f, 0xb8, 0xef,
+                0x25, 0x0f, 0x33, 0x0a, 0x3d, 0x0f, 0x23, 0xff, 0xff, 0x04, 0x0f, 0x39, 0x0a, 0x32, 0x0f, 0x4b, 0x05, 0x13, 0x0f, 0x3b,
+                0x0a, 0x22, 0x0f, 0x52, 0xfc, 0xed, 0x0f, 0x41, 0x0a, 0x2e, 0x0f, 0x6d, 0xf9, 0xfb, 0x0f, 0x47, 0x0a, 0x32, 0x0f, 0xef,
+                0x02, 0x13, 0x0f, 0x49, 0x0a, 0x2a, 0x0f, 0xb3, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x0f, 0x2e, 0x2a,
+                0x06, 0x14, 0x4f, 0x7f, 0xb9, 0x0f, 0x29, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xa6, 0x0f, 0x73, 0x0c, 0x0d, 0x0a, 0x57, 0x0c,
+                0x0f, 0x7c, 0x0d, 0x04, 0x0f, 0x6e, 0x2a, 0x1b, 0x0f, 0x54, 0x00, 0x09, 0x0f, 0x78, 0x2a, 0x38, 0x0f, 0x67, 0x00, 0x0b,
+                0x0f, 0x82, 0x2a, 0x5e, 0x0f, 0xa1, 0x0d, 0x1a, 0x0f, 0xd5, 0x28, 0x32, 0x0f, 0x72, 0x00, 0x1a, 0x0f, 0x00, 0x28, 0x37,
+                0x0f, 0x77, 0x00, 0x0e, 0x0f, 0x15, 0x11, 0x09, 0x0f, 0x21, 0x27, 0x2c, 0x0f, 0xf4, 0x01, 0x17, 0x0f, 0x2b, 0x27, 0x28,
+                0x0f, 0x58, 0x01, 0x1a, 0x0f, 0x52, 0x26, 0x28, 0x0f, 0x49, 0x01, 0x2a, 0x0f, 0x18, 0x25, 0x2c, 0x0f, 0x49, 0x01, 0x17,
+                0x0f, 0x85, 0x25, 0x30, 0x0f, 0xe9, 0x00, 0x1e, 0x0f, 0x06, 0x12, 0x07, 0x0f, 0xb2, 0x24, 0x20, 0x0f, 0x8f, 0x04, 0x4e,
+                0x0f, 0x65, 0x00, 0x0f, 0x0f, 0xc6, 0x24, 0x5c, 0x0f, 0x8b, 0x04, 0x59, 0x0f, 0x70, 0x00, 0x1e, 0x0f, 0x50, 0x22, 0x35,
+                0x0f, 0x87, 0x04, 0x63, 0x0f, 0xec, 0x01, 0x1b, 0x0f, 0x7f, 0x21, 0x26, 0x0f, 0x83, 0x04, 0x4f, 0x0f, 0x43, 0x01, 0x2e,
+                0x0f, 0x76, 0x1f, 0x2a, 0x0f, 0x7f, 0x04, 0x54, 0x0f, 0xe5, 0x00, 0x22, 0x0f, 0x10, 0xed, 0x08, 0x0f, 0x12, 0x1f, 0x23,
+                0x0f, 0x81, 0x04, 0x4e, 0x0f, 0x67, 0x00, 0x11, 0x0f, 0x26, 0x1f, 0x5e, 0x0f, 0x85, 0x04, 0x59, 0x0f, 0x72, 0x00, 0x20,
+                0x0f, 0xa4, 0x1c, 0x37, 0x0f, 0x89, 0x04, 0x63, 0x0f, 0xf4, 0x01, 0x1d, 0x0f, 0xcf, 0x1b, 0x28, 0x0f, 0x8d, 0x04, 0x4f,
+                0x0f, 0x49, 0x01, 0x30, 0x0f, 0xbc, 0x19, 0x2c, 0x0f, 0x91, 0x04, 0x54, 0x0f, 0xe9, 0x00, 0x24, 0x0f, 0xb1, 0x23, 0x13,
+                0x0f, 0xf6, 0x19, 0x0e, 0x0b, 0xda, 0x19, 0x0f, 0xed, 0x0d, 0x36, 0x0f, 0x55, 0x00, 0x06, 0x0f, 0xee, 0x0d, 0x3c, 0x0f,
+                0x68, 0x00, 0x08, 0x0f, 0xef, 0x0d, 0x62, 0x0f, 0x3f, 0x23, 0x17, 0x0f, 0xf0, 0x0d, 0x36, 0x0f, 0x73, 0x00, 0x17, 0x0f,
+                0xf1, 0x0d, 0x3b, 0x0f, 0x07, 0x1f, 0x27, 0x0f, 0xf2, 0x0d, 0x30, 0x0f, 0xf8, 0x01, 0x14, 0x0f, 0xf3, 0x0d, 0x2c, 0x0f,
+                0x5b, 0x01, 0x17, 0x0f, 0xf4, 0x0d, 0x2c, 0x0f, 0x4c, 0x01, 0x27, 0x0f, 0x88, 0x0d, 0x30, 0x0f, 0x4c, 0x01, 0x14, 0x0f,
+                0xf6, 0x0d, 0x34, 0x0f, 0xfd, 0x1f, 0x35, 0x0f, 0xf7, 0x0d, 0x24, 0x0f, 0x99, 0x04, 0x4b, 0x0f, 0x66, 0x00, 0x10, 0x0f,
+                0xf9, 0x0d, 0x60, 0x0f, 0x95, 0x04, 0x56, 0x0f, 0x71, 0x00, 0x1f, 0x0f, 0xfb, 0x0d, 0x39, 0x0f, 0x91, 0x04, 0x60, 0x0f,
+                0xf0, 0x01, 0x1c, 0x0f, 0xfd, 0x0d, 0x2a, 0x0f, 0x8d, 0x04, 0x4c, 0x0f, 0x46, 0x01, 0x2f, 0x0f, 0x94, 0x0d, 0x2e, 0x0f,
+                0x89, 0x04, 0x51, 0x0f, 0xcb, 0x2e, 0x3d, 0x0f, 0x01, 0x0e, 0x28, 0x0f, 0x8b, 0x04, 0x4b, 0x0f, 0x68, 0x00, 0x12, 0x0f,
+                0x03, 0x0e, 0x62, 0x0f, 0x8f, 0x04, 0x56, 0x0f, 0x73, 0x00, 0x21, 0x0f, 0x05, 0x0e, 0x3b, 0x0f, 0x93, 0x04, 0x60, 0x0f,
+                0xf8, 0x01, 0x1e, 0x0f, 0x07, 0x0e, 0x2c, 0x0f, 0x97, 0x04, 0x4c, 0x0f, 0x4c, 0x01, 0x31, 0x0f, 0x9c, 0x0d, 0x30, 0x0f,
+                0x9b, 0x04, 0x51, 0x0f, 0x6d, 0x27, 0x37, 0x0f, 0x9b, 0x00, 0x01, 0x0f, 0xaf, 0x2f, 0x0f, 0x0a, 0x93, 0x2f, 0x0f, 0x0b,
+                0x0e, 0x36, 0x0f, 0x54, 0x00, 0x05, 0x0f, 0x0a, 0x0e, 0x3c, 0x0f, 0x67, 0x00, 0x07, 0x0f, 0x09, 0x0e, 0x62, 0x0f, 0xdd,
+                0x30, 0x0a, 0x0f, 0xe6, 0x0a, 0x4e, 0x0f, 0x74, 0x01, 0x4a, 0x0f, 0x65, 0x00, 0x0f, 0x0f, 0xe4, 0x0a, 0x60, 0x0f, 0x70,
+                0x01, 0x34, 0x0f, 0xcf, 0x07, 0x28, 0x0f, 0x74, 0x01, 0x4a, 0x0f, 0x67, 0x00, 0x11, 0x0f, 0xcd, 0x07, 0x62, 0x0f, 0x78,
+                0x01, 0x28, 0x0f, 0xaa, 0x04, 0x05, 0x0f, 0xef, 0x33, 0x12, 0x09, 0xd3, 0x33, 0x0f, 0xa4, 0x20, 0x38, 0x0f, 0xa3, 0x20,
+                0x53, 0x0f, 0xa2, 0x20, 0x7b, 0x0f, 0x86, 0x1d, 0x6a, 0x0f, 0x85, 0x1d, 0x51, 0x0f, 0x84, 0x1d, 0x79, 0x0f, 0x76, 0x1a,
+                0x6e, 0x0f, 0x75, 0x1a, 0x53, 0x0f, 0x74, 0x1a, 0x7b, 0x0f, 0x58, 0x17, 0x29, 0x0f, 0xba, 0x30, 0xff, 0xff, 0xff, 0xff,
+                0xff, 0xff, 0xa0, 0x40, 0x41, 0x64, 0x64, 0x69, 0x09, 0x00, 0x22, 0x61, 0x6c, 0xdc, 0x02, 0x28, 0x73, 0x28, 0xe0, 0x01,
+                0x0a, 0x0d, 0xb5, 0xf9, 0x00, 0x22, 0x69, 0x64, 0x63, 0x5f, 0x5f, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x73, 0x22,
+                0x90, 0x00, 0x0f, 0x28, 0x00, 0x07, 0x07, 0x57, 0x2e, 0x0f, 0x33, 0x00, 0x1d, 0x00, 0xcd, 0x91, 0x0f, 0x34, 0x00, 0x08,
+                0x02, 0xf6, 0xc5, 0x02, 0xec, 0xc5, 0x05, 0xc4, 0xec, 0xa1, 0x77, 0x61, 0x76, 0x65, 0x66, 0x72, 0x6f, 0x6e, 0x74, 0x73,
+                0x10, 0xc6, 0x2f, 0x6c, 0x67, 0x41, 0x00, 0x2c, 0x02, 0x51, 0xc6, 0x0f, 0x45, 0x00, 0x2d, 0x02, 0xb1, 0x8e, 0x0f, 0x46,
+                0x00, 0x19, 0x00, 0x0f, 0x00, 0x0f, 0x46, 0x00, 0x42, 0x03, 0x48, 0x8f, 0x0f, 0x46, 0x00, 0x0f, 0x01, 0xc8, 0x00, 0x00,
+                0x59, 0x12, 0x00, 0xd3, 0x7c, 0x03, 0x3a, 0x9c, 0x0f, 0x36, 0x00, 0x12, 0x10, 0x69, 0xa9, 0xa8, 0x0f, 0x25, 0x02, 0x0e,
+                0x03, 0x30, 0x00, 0x01, 0xa2, 0x00, 0x0f, 0x66, 0x00, 0x1e, 0x4c, 0x74, 0x65, 0x78, 0x69, 0xe4, 0xaa, 0x8f, 0x5f, 0x6f,
+                0x6e, 0x5f, 0x74, 0x73, 0x6c, 0x31, 0x37, 0x02, 0x14, 0x02, 0x43, 0x00, 0x0f, 0xa9, 0x00, 0x1a, 0x60, 0x69, 0x6e, 0x5f,
+                0x73, 0x6d, 0x32, 0x0e, 0x00, 0x34, 0x72, 0x65, 0x71, 0x7e, 0x00, 0x0f, 0xb3, 0x00, 0x0e, 0x00, 0x38, 0x69, 0x00, 0xc3,
+                0x95, 0x21, 0x70, 0x71, 0xb2, 0x21, 0x0f, 0x38, 0x00, 0x21, 0x01, 0x21, 0x01, 0x0f, 0x39, 0x00, 0x1d, 0x3f, 0x32, 0x72,
+                0x66, 0x5a, 0x01, 0x19, 0x00, 0x36, 0x00, 0x58, 0x70, 0x73, 0x5f, 0x71, 0x75, 0xe0, 0x69, 0x0f, 0x30, 0x00, 0x0a, 0x0f,
+                0x7f, 0xf6, 0x05, 0x0f, 0x35, 0x00, 0x22, 0x03, 0x66, 0xed, 0x2f, 0x66, 0x66, 0x3e, 0x00, 0x29, 0x1f, 0x6e, 0x3d, 0x00,
+                0x0e, 0x02, 0x3b, 0x91, 0x7c, 0x65, 0x6c, 0x69, 0x67, 0x69, 0x62, 0x6c, 0x0f, 0x01, 0x05, 0x89, 0x33, 0x03, 0x2d, 0x00,
+                0x71, 0x61, 0x6d, 0x6f, 0x72, 0x74, 0x69, 0x7a, 0x5e, 0x91, 0x01, 0xaf, 0xaa, 0x01, 0x20, 0x8e, 0x0b, 0x35, 0x00, 0x06,
+                0xf0, 0xa4, 0x08, 0x2e, 0x02, 0x12, 0x6d, 0x94, 0xca, 0x02, 0x7a, 0x65, 0x00, 0x5a, 0x92, 0x02, 0x23, 0x00, 0x0f, 0x3c,
+                0x00, 0x14, 0x00, 0x36, 0x00, 0x12, 0x32, 0x0e, 0x00, 0x0a, 0x3c, 0x00, 0x0f, 0x82, 0x36, 0x0c, 0x33, 0x41, 0x6c, 0x6c,
+                0xf3, 0x00, 0x0f, 0xf2, 0xa4, 0x00, 0x00, 0x91, 0x06, 0x07, 0x74, 0x74, 0x0c, 0xac, 0xa0, 0x07, 0xe1, 0x64, 0x03, 0x26,
+                0x00, 0x00, 0xe1, 0x91, 0x23, 0x67, 0x5f, 0x0d, 0x00, 0x0d, 0x3e, 0xee, 0x06, 0x49, 0x00, 0x02, 0x16, 0x93, 0x03, 0x12,
+                0x00, 0x0f, 0x5e, 0x61, 0x00, 0x0b, 0x2e, 0x00, 0x01, 0x81, 0x92, 0x0f, 0xb5, 0xab, 0x04, 0x04, 0x7a, 0x00, 0x29, 0x6f,
+                0x66, 0x34, 0x00, 0x0f, 0xba, 0xee, 0x01, 0x00, 0x44, 0xa1, 0x0f, 0xd3, 0xa3, 0x06, 0x0f, 0x44, 0xee, 0x07, 0x02, 0x1e,
+                0xfd, 0x06, 0xf8, 0xa1, 0x0f, 0x3b, 0xee, 0x08, 0x1f, 0x73, 0x15, 0xa6, 0x02, 0x09, 0x62, 0x00, 0x01, 0x3c, 0xd1, 0x6f,
+                0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x6d, 0x00, 0x02, 0x04, 0x0d, 0xa6, 0x0b, 0x6d, 0x00, 0x08, 0x37, 0x00, 0x0e, 0x36,
+                0x00, 0x20, 0x61, 0x76, 0xc4, 0xd8, 0x0f, 0x78, 0x00, 0x07, 0x0d, 0xa9, 0xa4, 0x05, 0x37, 0x00, 0x0e, 0x6d, 0x00, 0x0c,
+                0x9f, 0xa4, 0x06, 0xea, 0xff, 0x0f, 0x62, 0x00, 0x0c, 0x0f, 0x8c, 0xd1, 0x0c, 0x0f, 0xd9, 0xff, 0x07, 0x0d, 0x80, 0x00,
+                0x0f, 0xd6, 0xd1, 0x18, 0x03, 0xc9, 0x00, 0x10, 0x70, 0x3b, 0xa5, 0x0f, 0x9e, 0x00, 0x0c, 0x0e, 0x05, 0xd3, 0x0f, 0x49,
+                0x00, 0x02, 0x0f, 0x92, 0x00, 0x04, 0x0d, 0x3e, 0x00, 0x0f, 0x3d, 0x00, 0x01, 0x0f, 0xfe, 0x01, 0x0b, 0x02, 0x48, 0x00,
+                0x08, 0xd3, 0x00, 0x0f, 0x83, 0x00, 0x03, 0x0f, 0x02, 0x02, 0x00, 0x0f, 0x3b, 0x00, 0x00, 0x0e, 0x3a, 0x00, 0x30, 0x64,
+                0x69, 0x6d, 0x74, 0xf3, 0x1a, 0x74, 0x86, 0x00, 0x31, 0x44, 0x69, 0x6d, 0x6b, 0x11, 0x07, 0x6f, 0x03, 0x0f, 0xe3, 0x02,
+                0x00, 0x10, 0x62, 0xd4, 0x85, 0x11, 0x69, 0xd6, 0xda, 0x06, 0xc1, 0x03, 0x13, 0x5b, 0x09, 0x00, 0x09, 0x61, 0x0f, 0x0f,
+                0xb3, 0x68, 0x41, 0x0e, 0x0a, 0x04, 0x0f, 0xaf, 0xff, 0x25, 0x0f, 0x45, 0xaa, 0x0e, 0x0f, 0xb4, 0xff, 0x43, 0x0f, 0x77,
+                0x00, 0x37, 0x0c, 0xa4, 0x94, 0x3f, 0x61, 0x76, 0x67, 0x6b, 0x00, 0x1c, 0x02, 0xd6, 0x03, 0x0f, 0x6b, 0x00, 0x21, 0x5f,
+                0x70, 0x63, 0x2c, 0x20, 0x32, 0x6e, 0x00, 0x1d, 0x01, 0x32, 0x03, 0x0f, 0x6e, 0x00, 0x22, 0x1f, 0x73, 0x6e, 0x00, 0x21,
+                0x0f, 0x72, 0xe2, 0x24, 0x3f, 0x73, 0x75, 0x6d, 0x6b, 0x00, 0x1c, 0x02, 0xf7, 0x05, 0x0f, 0x6b, 0x00, 0x21, 0x0f, 0x56,
+                0xe3, 0x1e, 0x02, 0xf5, 0x05, 0x0f, 0x6b, 0x00, 0x15, 0x05, 0xe7, 0x03, 0x0f, 0xba, 0x68, 0x3b, 0x31, 0x41, 0x6c, 0x6c,
+                0xce, 0x08, 0x0f, 0x08, 0x08, 0x04, 0x01, 0xb8, 0x3b, 0x0f, 0x06, 0x08, 0x0c, 0x01, 0x24, 0x00, 0x02, 0x04, 0x08, 0x01,
+                0x0b, 0x00, 0x0b, 0x86, 0x07, 0x06, 0x43, 0x00, 0x02, 0x00, 0x08, 0x01, 0x10, 0x00, 0x0f, 0xfe, 0x07, 0x02, 0x07, 0x2a,
+                0x00, 0x0f, 0xfc, 0x07, 0x09, 0x02, 0x70, 0x00, 0x00, 0x59, 0x6d, 0x05, 0x30, 0x00, 0x0f, 0xf8, 0x07, 0x01, 0x05, 0xbc,
+                0x06, 0x01, 0xe0, 0x00, 0x02, 0x96, 0x05, 0x01, 0x32, 0x00, 0x00, 0xf3, 0x6e, 0x00, 0xb7, 0x3c, 0x0f, 0x9a, 0x06, 0x08,
+                0x02, 0x63, 0x00, 0x04, 0xe7, 0x3d, 0x0e, 0x29, 0x00, 0x3f, 0x72, 0x69, 0x6f, 0x5c, 0x00, 0x06, 0x01, 0x08, 0x00, 0x0f,
+                0x5e, 0x00, 0x01, 0x20, 0x72, 0x69, 0x1d, 0xd9, 0x09, 0x5e, 0x00, 0x02, 0x2c, 0x00, 0x0e, 0x2b, 0x00, 0x33, 0x6d, 0x61,
+                0x78, 0xc9, 0x14, 0x0f, 0x64, 0x00, 0x03, 0x30, 0x6d, 0x61, 0x78, 0x6c, 0x01, 0x1f, 0x65, 0x67, 0x00, 0x01, 0x03, 0x3c,
+                0x00, 0x0c, 0x6b, 0x00, 0x05, 0x33, 0x00, 0x09, 0x09, 0x06, 0x0f, 0x8a, 0x6e, 0x42, 0x0b, 0xe1, 0x01, 0x0f, 0xd5, 0x05,
+                0x17, 0x0f, 0x1a, 0x04, 0x1f, 0x0f, 0xd8, 0x05, 0x9d, 0x3f, 0x72, 0x69, 0x6f, 0xff, 0xb0, 0x1d, 0x01, 0x36, 0x02, 0x0f,
+                0x6b, 0x00, 0x20, 0x03, 0x08, 0x02, 0x3f, 0x2c, 0x20, 0x34, 0x72, 0x00, 0x1c, 0x06, 0x41, 0x02, 0x0f, 0x26, 0x6d, 0x3c,
+                0x36, 0x41, 0x6c, 0x6c, 0x84, 0x00, 0x0f, 0x71, 0x04, 0x04, 0x06, 0xc7, 0x0c, 0x0f, 0x76, 0x04, 0x0c, 0x06, 0x29, 0x00,
+                0x02, 0x7b, 0x04, 0x06, 0x10, 0x00, 0x0b, 0x0e, 0x04, 0x0b, 0x52, 0x00, 0x02, 0x85, 0x04, 0x06, 0x15, 0x00, 0x0f, 0x8a,
+                0x04, 0x02, 0x0c, 0x34, 0x00, 0x0f, 0x8f, 0x04, 0x09, 0x07, 0x89, 0x00, 0x2c, 0x6f, 0x66, 0x3a, 0x00, 0x0f, 0x99, 0x04,
+                0x0a, 0x0a, 0xd6, 0x0d, 0x0f, 0x93, 0x00, 0x02, 0x0d, 0x9a, 0x04, 0x0c, 0x37, 0x00, 0x01, 0x11, 0xe3, 0x08, 0x3a, 0x00,
+                0x0f, 0xe6, 0x09, 0x0d, 0x07, 0x28, 0x01, 0x16, 0x5b, 0x0c, 0x00, 0x0f, 0xec, 0x09, 0x4e, 0x0f, 0xde, 0x00, 0x04, 0x0f,
+                0xef, 0x09, 0xcf, 0x0f, 0x36, 0x03, 0x28, 0xc9, 0x6f, 0x6e, 0x42, 0x6f, 0x64, 0x79, 0x4c, 0x6f, 0x61, 0x64, 0x65, 0x64,
+                0x6f, 0x15, 0x05, 0x96, 0x01, 0x01, 0x75, 0x18, 0x01, 0xd7, 0x01, 0x3c, 0x72, 0x61, 0x6e, 0x82, 0xcc, 0x05, 0x26, 0x00,
+                0x33, 0x67, 0x65, 0x74, 0xb9, 0x01, 0x52, 0x42, 0x79, 0x49, 0x64, 0x28, 0xab, 0x18, 0x01, 0x70, 0x10, 0x20, 0x65, 0x78,
+                0xbf, 0x43, 0x9c, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x48, 0x54, 0x4d, 0x4c, 0x4a, 0x00, 0x05, 0x4b, 0x00, 0x40, 0x2f, 0x2f,
+                0x20, 0x43, 0x83, 0x26, 0x00, 0x79, 0xa3, 0xf0, 0x01, 0x6f, 0x6e, 0x43, 0x6c, 0x69, 0x63, 0x6b, 0x20, 0x68, 0x61, 0x6e,
+                0x64, 0x6c, 0x65, 0x72, 0x73, 0x4c, 0xa4, 0x41, 0x72, 0x65, 0x61, 0x63, 0x81, 0xad, 0x00, 0x21, 0x00, 0x00, 0x76, 0x1c,
+                0x90, 0x69, 0x61, 0x6c, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x4a, 0xae, 0xb0, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x20, 0x20,
+                0x54, 0x68, 0x69, 0x73, 0xcb, 0xb0, 0x00, 0x9f, 0x80, 0x12, 0x63, 0xbf, 0x94, 0x11, 0x6c, 0x11, 0xa2, 0x00, 0x36, 0x03,
+                0x00, 0x37, 0x00, 0x00, 0x60, 0x01, 0x12, 0x65, 0xa9, 0x00, 0xc3, 0x73, 0x27, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c,
+                0x74, 0x20, 0x22, 0x48, 0x00, 0x12, 0x22, 0x49, 0x00, 0x04, 0x00, 0xa4, 0x00, 0xb0, 0x00, 0x15, 0x2e, 0xa1, 0x00, 0x03,
+                0x95, 0x00, 0x91, 0x5f, 0x53, 0x68, 0x6f, 0x77, 0x57, 0x6f, 0x72, 0x6b, 0x17, 0x88, 0x07, 0x65, 0x01, 0x04, 0x20, 0x00,
+                0xb2, 0x4d, 0x6f, 0x62, 0x69, 0x6c, 0x65, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0xd1, 0x03, 0x05, 0x22, 0x00, 0x00, 0x5b, 0x19,
+                0x7b, 0x67, 0x5f, 0x64, 0x65, 0x62, 0x75, 0x67, 0xb5, 0x03, 0xe5, 0x6c, 0x65, 0x61, 0x72, 0x52, 0x65, 0x66, 0x65, 0x72,
+                0x65, 0x6e, 0x63, 0x65, 0x64, 0xff, 0x16, 0x0f, 0x38, 0x04, 0x02, 0x01, 0xe8, 0x04, 0x11, 0x44, 0x03, 0x21, 0x4f, 0x49,
+                0x64, 0x73, 0x28, 0x83, 0x01, 0x07, 0x01, 0x29, 0x00, 0x03, 0x2c, 0x21, 0x00, 0x7b, 0x77, 0x6a, 0x65, 0x72, 0x74, 0x69,
+                0x65, 0x73, 0xf2, 0x19, 0x0f, 0x93, 0x00, 0x07, 0x03, 0xaa, 0x0d, 0x00, 0xe8, 0x1d, 0x02, 0x10, 0x89, 0x64, 0x65, 0x71,
+                0x75, 0x69, 0x72, 0x65, 0x5d, 0xfc, 0x0f, 0x79, 0x00, 0x0e, 0x00, 0xce, 0x14, 0x00, 0x30, 0x00, 0x05, 0xf4, 0x0d, 0x03,
+                0xb4, 0x00, 0x1a, 0x50, 0x8a, 0x00, 0x0a, 0x79, 0x1a, 0x50, 0x4a, 0x53, 0x4f, 0x4e, 0x2e, 0xea, 0x98, 0x54, 0x6e, 0x67,
+                0x69, 0x66, 0x79, 0x59, 0x0e, 0x20, 0x73, 0x29, 0x3e, 0xfd, 0x0b, 0x1c, 0x00, 0x03, 0x50, 0x1f, 0x03, 0x89, 0x14, 0x04,
+                0x3c, 0x0f, 0x04, 0x29, 0xdc, 0x0a, 0x16, 0x00, 0x1e, 0x5d, 0x14, 0xd2, 0x6d, 0x6c, 0x65, 0x72, 0x74, 0x28, 0x22, 0x93,
+                0x00, 0x00, 0x90, 0xaa, 0x02, 0xb8, 0x00, 0x06, 0x02, 0x01, 0x40, 0x6d, 0x69, 0x73, 0x6d, 0x55, 0xb0, 0x80, 0x21, 0x20,
+                0x50, 0x6c, 0x65, 0x61, 0x73, 0x65, 0xb0, 0x03, 0x21, 0x74, 0x65, 0x22, 0x02, 0x00, 0x87, 0x13, 0x51, 0x73, 0x74, 0x20,
+                0x6c, 0x69, 0x7b, 0xe9, 0x01, 0x13, 0x00, 0x03, 0x10, 0x19, 0x38, 0x6f, 0x72, 0x2e, 0x61, 0x13, 0x04, 0x2c, 0x05, 0x7f,
+                0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x7a, 0x00, 0x1d, 0x0f, 0x4b, 0x00, 0x0a, 0x86, 0x41, 0x63, 0x74, 0x75, 0x61,
+                0x6c, 0x3a, 0x20, 0xef, 0x0e, 0x0c, 0xc8, 0x9a, 0x09, 0x2f, 0x00, 0x14, 0x47, 0xa1, 0x00, 0x14, 0x3a, 0x94, 0x20, 0x0f,
+                0x44, 0x01, 0x13, 0x0a, 0x84, 0x00, 0x08, 0x73, 0x1a, 0x02, 0x93, 0x0b, 0x0d, 0x2a, 0x02, 0x03, 0xf5, 0x0b, 0x0f, 0x28,
+                0x02, 0x15, 0x02, 0x46, 0x00, 0x0f, 0x26, 0x02, 0x20, 0x04, 0x12, 0x0c, 0x0f, 0x24, 0x02, 0x00, 0x0f, 0xf9, 0x01, 0x22,
+                0x03, 0xcf, 0x00, 0x40, 0x64, 0x6f, 0x6e, 0x27, 0xeb, 0x0a, 0x00, 0x89, 0xb2, 0x00, 0xd9, 0x01, 0x52, 0x65, 0x78, 0x70,
+                0x65, 0x63, 0x88, 0xb3, 0x0f, 0x0a, 0x02, 0x56, 0x03, 0x8b, 0x00, 0x0f, 0x08, 0x02, 0x1e, 0x03, 0x13, 0x01, 0x0f, 0x06,
+                0x02, 0x14, 0x0f, 0xdb, 0x01, 0x08, 0x07, 0xcb, 0x07, 0x0d, 0xe0, 0x01, 0x08, 0x69, 0x09, 0x0f, 0xe5, 0x01, 0x15, 0x07,
+                0x50, 0x00, 0x0f, 0xea, 0x01, 0x20, 0x09, 0x81, 0x09, 0x0f, 0xef, 0x01, 0x35, 0x08, 0xe3, 0x00, 0x0f, 0xf4, 0x01, 0x71,
+                0x08, 0x90, 0x00, 0x0f, 0xf9, 0x01, 0x1e, 0x08, 0x22, 0x01, 0x0f, 0xfe, 0x01, 0x2d, 0x07, 0xf4, 0x87, 0x0f, 0xba, 0x06,
+                0x3e, 0x5f, 0x43, 0x6c, 0x6f, 0x63, 0x6b, 0xbd, 0x06, 0x15, 0x11, 0x63, 0x2d, 0x00, 0x0f, 0xb9, 0x06, 0x67, 0x02, 0xad,
+                0x00, 0x0f, 0xaf, 0x06, 0x2d, 0x10, 0x64, 0x16, 0xc7, 0x0f, 0x6c, 0x05, 0x00, 0x00, 0x87, 0x26, 0x0f, 0x17, 0x00, 0x02,
+                0x30, 0x75, 0x5f, 0x5f, 0x18, 0x7f, 0x32, 0x5f, 0x64, 0x75, 0xb1, 0x4f, 0x00, 0x16, 0x00, 0x0f, 0xb0, 0x05, 0x05, 0x1e,
+                0x79, 0x17, 0x00, 0x0f, 0x0d, 0x03, 0x06, 0x03, 0xcf, 0x00, 0x0f, 0xeb, 0x06, 0x56, 0x0f, 0x70, 0x00, 0x11, 0x0f, 0xe1,
+                0x06, 0x46, 0x0f, 0x76, 0x01, 0x5e, 0x0f, 0x27, 0x07, 0x54, 0x0f, 0x94, 0x02, 0x15, 0x0f, 0x1d, 0x07, 0x21, 0x0e, 0xb1,
+                0x01, 0x0f, 0x13, 0x07, 0x5c, 0x0f, 0x81, 0x00, 0x06, 0x0f, 0x09, 0x07, 0xc3, 0x0f, 0xcc, 0x01, 0x15, 0x0f, 0xff, 0x06,
+                0x26, 0x0e, 0x50, 0x01, 0x0f, 0xf5, 0x06, 0x61, 0x0f, 0x86, 0x00, 0x0b, 0x0f, 0xeb, 0x06, 0xc0, 0x13, 0x54, 0xf9, 0x24,
+                0x3f, 0x53, 0x74, 0x61, 0x1a, 0x02, 0x0f, 0x50, 0x74, 0x6f, 0x70, 0x5f, 0x6c, 0x2e, 0x00, 0x00, 0x44, 0x22, 0x1f, 0x74,
+                0xee, 0x06, 0x68, 0x09, 0xb6, 0x00, 0x0f, 0xf5, 0x06, 0x2d, 0x30, 0x66, 0x65, 0x5f, 0xd3, 0xbc, 0x12, 0x77, 0x5f, 0x00,
+                0x00, 0x35, 0x05, 0x00, 0x12, 0x00, 0x03, 0x43, 0x89, 0x10, 0x6f, 0x2c, 0xce, 0x00, 0x8f, 0x8e, 0x20, 0x62, 0x75, 0xe8,
+                0x0f, 0xb1, 0x5f, 0x63, 0x6d, 0x64, 0x5f, 0x67, 0x6f, 0x5f, 0x69, 0x64, 0x6c, 0xdc, 0xc4, 0x00, 0x2a, 0x00, 0x01, 0xee,
+                0x82, 0x04, 0xda, 0x8b, 0x03, 0xc1, 0xb9, 0x01, 0xd6, 0xa4, 0x25, 0x67, 0x72, 0x7b, 0x05, 0x06, 0x0e, 0xc5, 0x00, 0x15,
+                0x00, 0x05, 0x03, 0xbe, 0x05, 0x72, 0x00, 0x07, 0xcd, 0x0c, 0x06, 0x2b, 0x00, 0x0d, 0x15, 0x00, 0x07, 0xfc, 0xec, 0x03,
+                0x1f, 0x00, 0x02, 0xd5, 0xb2, 0x0a, 0x33, 0x00, 0x0c, 0x80, 0xc5, 0x01, 0x41, 0xcc, 0x0f, 0x48, 0x00, 0x02, 0x1f, 0x33,
+                0x82, 0x07, 0x08, 0x0a, 0x63, 0x01, 0x0f, 0x89, 0x07, 0x56, 0x0f, 0x77, 0x00, 0x18, 0x0f, 0x90, 0x07, 0x46, 0x0f, 0x11,
+                0x02, 0xeb, 0x0f, 0x1d, 0x08, 0x54, 0x0f, 0xc3, 0x03, 0x1c, 0x0f, 0x24, 0x08, 0x21, 0x0f, 0x4c, 0x02, 0x06, 0x0f, 0x2b,
+                0x08, 0x5c, 0x0f, 0x88, 0x00, 0x0d, 0x0f, 0x32, 0x08, 0xc3, 0x0f, 0xe1, 0x01, 0x1c, 0x0f, 0x39, 0x08, 0x26, 0x0f, 0x5e,
+                0x01, 0x06, 0x0f, 0x40, 0x08, 0x61, 0x0f, 0x8d, 0x00, 0x12, 0x0f, 0x47, 0x08, 0xc3, 0x0f, 0x30, 0x02, 0x18, 0x00, 0x48,
+                0x08, 0x07, 0xd4, 0x00, 0x0f, 0x48, 0x08, 0x6a, 0x07, 0xb7, 0x00, 0x0f, 0x49, 0x08, 0x2c, 0x0f, 0xa2, 0x02, 0x09, 0x08,
+                0x66, 0x00, 0x0f, 0x4c, 0x07, 0x59, 0x0f, 0x78, 0x00, 0x16, 0x0f, 0x4d, 0x07, 0x45, 0x0f, 0x4f, 0x06, 0x58, 0x0f, 0xca,
+                0x01, 0x1a, 0x0f, 0x50, 0x06, 0x24, 0x0f, 0x50, 0x01, 0x04, 0x0f, 0x51, 0x06, 0x5f, 0x0f, 0x89, 0x00, 0x0b, 0x0f, 0x52,
+                0x06, 0xc6, 0x0f, 0xe4, 0x01, 0x1a, 0x0f, 0x53, 0x06, 0x0d, 0x11, 0x27, 0x0b, 0x43, 0x07, 0x63, 0x00, 0x00, 0x1d, 0x09,
+                0x02, 0x8d, 0x11, 0x0a, 0x14, 0x00, 0x04, 0xd3, 0x2e, 0x0a, 0x15, 0x00, 0x00, 0x71, 0x11, 0x0a, 0x13, 0x00, 0x4d, 0x70,
+                0x63, 0x69, 0x65, 0x14, 0x00, 0x00, 0x27, 0xb1, 0x0b, 0x13, 0x00, 0x00, 0x02, 0xac, 0x0b, 0x13, 0x00, 0x0f, 0x8a, 0x00,
+                0x00, 0x04, 0x1d, 0x9c, 0x0a, 0x16, 0x00, 0x03, 0x57, 0x98, 0x07, 0x12, 0x00, 0x3c, 0x76, 0x61, 0x66, 0x13, 0x00, 0x01,
+                0x4d, 0x44, 0x08, 0x14, 0x00, 0x0f, 0xd4, 0x02, 0x20, 0x0f, 0x3f, 0x07, 0x64, 0x0f, 0x8e, 0x00, 0x10, 0x0f, 0x40, 0x07,
+                0x51, 0x0f, 0x1c, 0x02, 0xd9, 0x0f, 0x2b, 0x08, 0x5b, 0x01, 0x71, 0x3c, 0x12, 0x48, 0x14, 0x39, 0x0f, 0x08, 0x04, 0x0e,
+                0x01, 0xa6, 0xc6, 0x00, 0x0c, 0x35, 0x01, 0xb5, 0x25, 0x0f, 0x60, 0x17, 0x69, 0x08, 0xb6, 0x00, 0x0f, 0x29, 0x08, 0x45,
+                0x0a, 0x65, 0x00, 0x0f, 0xfd, 0x16, 0x57, 0x0f, 0x77, 0x00, 0x17, 0x0f, 0x27, 0x08, 0xad, 0x0f, 0xc7, 0x01, 0x1c, 0x0f,
+                0x26, 0x08, 0x08, 0x18, 0x27, 0x83, 0x37, 0x05, 0xa2, 0x02, 0x08, 0x12, 0x04, 0x04, 0x3e, 0x3f, 0x09, 0x1c, 0x00, 0x01,
+                0x19, 0x04, 0x0d, 0x1a, 0x00, 0x0f, 0x12, 0x02, 0x1f, 0x0f, 0xee, 0x16, 0x5d, 0x0f, 0x88, 0x00, 0x0c, 0x0f, 0x71, 0x08,
+                0x4c, 0x0f, 0x6d, 0x01, 0x3b, 0x0f, 0x42, 0x17, 0x64, 0x0f, 0x7b, 0x02, 0x1b, 0x0f, 0x49, 0x17, 0x27, 0x0f, 0xab, 0x01,
+                0x05, 0x0f, 0x50, 0x17, 0x62, 0x0f, 0x8d, 0x00, 0x11, 0x0f, 0x10, 0x0f, 0xc0, 0x42, 0x4d, 0x61, 0x69, 0x6e, 0x3f, 0x44,
+                0x0f, 0x2c, 0x02, 0x0d, 0x40, 0x6d, 0x61, 0x69, 0x6e, 0x69, 0x3a, 0x00, 0x6a, 0x44, 0x0f, 0xde, 0x06, 0x66, 0x06, 0xaf,
+                0x00, 0x0f, 0x4d, 0x17, 0x2d, 0x02, 0xe7, 0x08, 0x01, 0x72, 0x38, 0x22, 0x62, 0x79, 0x1c, 0x5b, 0x03, 0x14, 0x00, 0x02,
+                0x95, 0x39, 0x02, 0x15, 0x00, 0x0f, 0xbd, 0x02, 0x06, 0x07, 0x89, 0x00, 0x0f, 0xff, 0x06, 0x56, 0x0f, 0x74, 0x00, 0x15,
+                0x0f, 0x70, 0x16, 0x46, 0x0f, 0x34, 0x01, 0x14, 0x0f, 0x23, 0x07, 0x54, 0x0f, 0x0c, 0x02, 0x19, 0x0f, 0x46, 0x0f, 0x21,
+                0x0f, 0x6f, 0x01, 0x03, 0x0f, 0xd0, 0x06, 0x5c, 0x0f, 0x85, 0x00, 0x0a, 0x0f, 0x3e, 0x0f, 0xc3, 0x0f, 0xd8, 0x01, 0x19,
+                0x0f, 0x3a, 0x0f, 0x0e, 0x02, 0x0a, 0x0d, 0x01, 0xb3, 0x02, 0x0f, 0x23, 0x0d, 0x0f, 0x02, 0x14, 0x00, 0x02, 0xcc, 0x02,
+                0x0f, 0x94, 0x0e, 0x11, 0x0f, 0x9d, 0x01, 0x03, 0x0f, 0xbf, 0x06, 0x61, 0x0f, 0x8a, 0x00, 0x0f, 0x0f, 0x8c, 0x0e, 0x52,
+                0x0f, 0x6e, 0x01, 0x32, 0x0f, 0x01, 0x07, 0x5b, 0x0f, 0x0b, 0x9e, 0x15, 0x01, 0x10, 0xd2, 0x0f, 0xd0, 0x02, 0x0d, 0x24,
+                0x6c, 0x32, 0xc5, 0x09, 0x12, 0x74, 0x4f, 0x00, 0x33, 0x5f, 0x62, 0x79, 0x34, 0x07, 0x07, 0x90, 0x4a, 0x00, 0x4a, 0x00,
+                0x0f, 0x43, 0x07, 0x67, 0x0f, 0xf1, 0x00, 0x1a, 0x0f, 0x41, 0x0e, 0x45, 0x0f, 0x85, 0x00, 0x1b, 0x0f, 0x62, 0x07, 0x56,
+                0x0f, 0x97, 0x00, 0x38, 0x0f, 0x81, 0x0e, 0xad, 0x0f, 0x27, 0x02, 0x3c, 0x0f, 0xa1, 0x0e, 0x09, 0x0f, 0xa8, 0x9c, 0x15,
+                0x0f, 0xbf, 0x51, 0x14, 0x07, 0x5e, 0x75, 0x0f, 0x34, 0x00, 0x16, 0x06, 0xc1, 0x52, 0x0f, 0x31, 0x00, 0x1b, 0x0f, 0x6d,
+                0x00, 0x25, 0x03, 0xe3, 0x65, 0x0f, 0x31, 0x00, 0x1b, 0x0f, 0x6d, 0x00, 0x27, 0x0f, 0x6c, 0x00, 0x1d, 0x0f, 0x6b, 0x00,
+                0x26, 0x04, 0xb1, 0x58, 0x0f, 0x32, 0x00, 0x1c, 0x0f, 0x6f, 0x00, 0x1b, 0x03, 0x9c, 0x8b, 0x0f, 0x5b, 0x52, 0x12, 0x0f,
+                0x59, 0x00, 0x1e, 0x0f, 0x0b, 0x02, 0x18, 0x08, 0x2f, 0x00, 0x0f, 0x69, 0x00, 0x23, 0x0f, 0x07, 0x02, 0x14, 0x08, 0x2f,
+                0x00, 0x0f, 0x69, 0x00, 0x25, 0x0f, 0x68, 0x00, 0x1b, 0x0f, 0x67, 0x00, 0x24, 0x0f, 0xff, 0x01, 0x15, 0x09, 0x30, 0x00,
+                0x0f, 0x6b, 0x00, 0x1b, 0x05, 0x50, 0x83, 0x0f, 0xeb, 0x52, 0x14, 0x0f, 0x5d, 0x00, 0x20, 0x0f, 0x03, 0x02, 0x18, 0x0a,
+                0x31, 0x00, 0x0f, 0x6d, 0x00, 0x25, 0x0f, 0x07, 0x02, 0x14, 0x0a, 0x31, 0x00, 0x0f, 0x6d, 0x00, 0x27, 0x0f, 0x6c, 0x00,
+                0x1d, 0x0f, 0x6b, 0x00, 0x26, 0x0f, 0x0f, 0x02, 0x15, 0x0b, 0x32, 0x00, 0x08, 0x6f, 0x00, 0x0f, 0x42, 0x08, 0x3f, 0x0f,
+                0xc1, 0x0d, 0x5c, 0x0f, 0xa8, 0x00, 0x2d, 0x0f, 0xb1, 0x14, 0x4d, 0x0f, 0x7d, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                0x10, 0x0f, 0x01, 0x14, 0x63, 0x0f, 0x7b, 0x0e, 0x3c, 0x0f, 0xa1, 0x1a, 0x26, 0x0f, 0xbb, 0x07, 0x26, 0x0f, 0x02, 0x14,
+                0x61, 0x0f, 0xad, 0x00, 0x32, 0x0f, 0xe1, 0x1a, 0xc0, 0x0f, 0x18, 0x01, 0x07, 0x6f, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65,
+                0xd3, 0x13, 0x22, 0x11, 0x73, 0x3b, 0x00, 0x0f, 0xc4, 0x13, 0x81, 0x02, 0xd5, 0x00, 0x0f, 0xb7, 0x13, 0x5f, 0x03, 0x78,
+                0x00, 0x0f, 0xaa, 0x13, 0x70, 0x0f, 0x8a, 0x00, 0x11, 0x0f, 0x9d, 0x13, 0xc7, 0x0f, 0x00, 0x02, 0x15, 0x0f, 0x90, 0x13,
+                0x1f, 0x07, 0x65, 0x6c, 0x0f, 0x56, 0x06, 0x07, 0x08, 0x8a, 0x6c, 0x0f, 0xb8, 0x06, 0x11, 0x07, 0x3f, 0x62, 0x0f, 0x25,
+                0x00, 0x12, 0x0f, 0x55, 0x00, 0x1a, 0x0f, 0xf4, 0xa7, 0x03, 0x0f, 0xae, 0x74, 0x20, 0x0f, 0x75, 0x00, 0x2c, 0x0f, 0x66,
+                0x08, 0x0f, 0x0f, 0x3d, 0x00, 0x10, 0x0f, 0x85, 0x00, 0x31, 0x0f, 0x13, 0x08, 0x0c, 0x0f, 0x3e, 0x00, 0x11, 0x0f, 0x87,
+                0x00, 0x27, 0x0f, 0x39, 0x0c, 0x0b, 0x0f, 0xa4, 0x71, 0x07, 0x0f, 0x71, 0x00, 0x2a, 0x0f, 0x7b, 0x01, 0x24, 0x0f, 0xf4,
+                0x0b, 0x1e, 0x0f, 0x63, 0x72, 0x12, 0x0f, 0x3c, 0x00, 0x26, 0x0f, 0x83, 0x00, 0x27, 0x0f, 0xb1, 0x0b, 0x0d, 0x0f, 0x80,
+                0x6e, 0x09, 0x0f, 0x75, 0x00, 0x2c, 0x0f, 0x7b, 0x01, 0x24, 0x0f, 0x68, 0x0b, 0x20, 0x0f, 0x45, 0x6f, 0x14, 0x0f, 0x3e,
+                0x00, 0x28, 0x0f, 0x87, 0x00, 0x15, 0x05, 0xb8, 0x70, 0x0f, 0x26, 0x00, 0x13, 0x0f, 0x9e, 0x04, 0x1a, 0x0f, 0x38, 0x7a,
+                0x07, 0x0f, 0x9d, 0x00, 0x1d, 0x0f, 0xa0, 0x04, 0x22, 0x0f, 0x3e, 0x00, 0x0e, 0x0f, 0x87, 0x00, 0x32, 0x0f, 0xac, 0x01,
+                0x0f, 0x0f, 0x3f, 0x00, 0x0f, 0x0f, 0x89, 0x00, 0x28, 0x0f, 0xa4, 0x04, 0x0e, 0x0f, 0x30, 0x77, 0x05, 0x0f, 0x73, 0x00,
+                0x2b, 0x0f, 0x81, 0x01, 0x25, 0x0f, 0xa7, 0x04, 0x21, 0x0f, 0xf2, 0x77, 0x10, 0x0f, 0x3d, 0x00, 0x27, 0x0f, 0x85, 0x00,
+                0x28, 0x0f, 0xaa, 0x04, 0x10, 0x0f, 0x16, 0x74, 0x07, 0x0f, 0x77, 0x00, 0x2d, 0x0f, 0x81, 0x01, 0x25, 0x0f, 0xad, 0x04,
+                0x23, 0x0f, 0xde, 0x74, 0x12, 0x0f, 0x3f, 0x00, 0x29, 0x0f, 0x89, 0x00, 0x1f, 0x0f, 0x31, 0x00, 0x19, 0x04, 0xe8, 0x76,
+                0x0f, 0x2a, 0x00, 0x17, 0x0f, 0xe8, 0x04, 0x1f, 0x0f, 0x70, 0x80, 0x06, 0x0f, 0xa9, 0x00, 0x21, 0x0f, 0xf0, 0x04, 0x27,
+                0x0f, 0x42, 0x00, 0x0d, 0x0f, 0x8f, 0x00, 0x36, 0x0f, 0xf6, 0x01, 0x14, 0x0f, 0x43, 0x00, 0x0e, 0x0f, 0x91, 0x00, 0x2c,
+                0x0f, 0x00, 0x05, 0x13, 0x0f, 0x7a, 0x7d, 0x04, 0x0f, 0x7b, 0x00, 0x2f, 0x0f, 0x99, 0x01, 0x29, 0x0f, 0x0c, 0x05, 0x26,
+                0x0f, 0x48, 0x7e, 0x0f, 0x0f, 0x41, 0x00, 0x2b, 0x0f, 0x8d, 0x00, 0x2c, 0x0f, 0x18, 0x05, 0x15, 0x0f, 0x7e, 0x7a, 0x06,
+                0x0f, 0x7f, 0x00, 0x31, 0x0f, 0x99, 0x01, 0x29, 0x0f, 0x24, 0x05, 0x28, 0x0f, 0x52, 0x7b, 0x11, 0x0f, 0x43, 0x00, 0x2d,
+                0x0f, 0x91, 0x00, 0x23, 0x0f, 0x35, 0x00, 0x19, 0x1f, 0x70, 0xa7, 0x00, 0x10, 0x0f, 0x97, 0xbc, 0x02, 0x0f, 0x06, 0x86,
+                0x1f, 0x0f, 0x97, 0x00, 0x1b, 0x0f, 0x18, 0x05, 0x27, 0x0f, 0x3c, 0x00, 0x07, 0x0f, 0x83, 0x00, 0x30, 0x0f, 0xda, 0x01,
+                0x14, 0x0f, 0x3d, 0x00, 0x08, 0x0f, 0x85, 0x00, 0x26, 0x0f, 0x00, 0x05, 0x13, 0x0d, 0xea, 0x82, 0x0f, 0x6f, 0x00, 0x29,
+                0x0f, 0x75, 0x01, 0x23, 0x0f, 0xee, 0x04, 0x26, 0x0f, 0xa6, 0x83, 0x09, 0x0f, 0x3b, 0x00, 0x25, 0x0f, 0x81, 0x00, 0x26,
+                0x0f, 0xdc, 0x04, 0x15, 0x0f, 0xcc, 0x7f, 0x00, 0x0f, 0x73, 0x00, 0x2b, 0x0f, 0x75, 0x01, 0x23, 0x0f, 0xca, 0x04, 0x28,
+                0x0f, 0x8e, 0x80, 0x0b, 0x0f, 0x3d, 0x00, 0x27, 0x0f, 0x85, 0x00, 0x1d, 0x0f, 0x2f, 0x00, 0x19, 0x3f, 0x74, 0x65, 0x78,
+                0x25, 0x00, 0x12, 0x0f, 0xba, 0x04, 0x1f, 0x0f, 0x81, 0x78, 0x01, 0x0f, 0x9a, 0x00, 0x1c, 0x0f, 0x45, 0x20, 0x1f, 0x0f,
+                0x3d, 0x00, 0x10, 0x0f, 0x85, 0x00, 0x31, 0x0f, 0x57, 0x02, 0x13, 0x0f, 0x3d, 0x00, 0x08, 0x0f, 0x85, 0x00, 0x33, 0x0f,
+                0x84, 0x00, 0x29, 0x0f, 0x83, 0x00, 0x32, 0x0f, 0xdc, 0x02, 0x14, 0x0f, 0x3e, 0x00, 0x09, 0x0f, 0x87, 0x00, 0x27, 0x0f,
+                0xc8, 0x05, 0x13, 0x0e, 0x99, 0x79, 0x0f, 0x71, 0x00, 0x2a, 0x0f, 0x83, 0x02, 0x24, 0x0f, 0xc9, 0x20, 0x1e, 0x0f, 0xdc,
+                0x97, 0x11, 0x0f, 0x3b, 0x00, 0x25, 0x0f, 0x81, 0x00, 0x31, 0x0f, 0x80, 0x00, 0x27, 0x0f, 0x7f, 0x00, 0x30, 0x0f, 0x77,
+                0x02, 0x21, 0x0f, 0xcd, 0x06, 0x27, 0x0f, 0x02, 0xb4, 0x03, 0x0f, 0x9d, 0x7a, 0x20, 0x0f, 0x75, 0x00, 0x2c, 0x0f, 0x7b,
+                0x02, 0x24, 0x0f, 0x41, 0x21, 0x20, 0x0f, 0xd6, 0x95, 0x13, 0x0f, 0x3d, 0x00, 0x27, 0x0f, 0x85, 0x00, 0x33, 0x0f, 0x84,
+                0x00, 0x29, 0x0f, 0x83, 0x00, 0x32, 0x0f, 0x87, 0x02, 0x21, 0x0f, 0xdb, 0x07, 0x29, 0x00, 0x49, 0x00, 0x0f, 0x30, 0x00,
+                0x19, 0x00, 0x5c, 0x41, 0x0f, 0x26, 0x00, 0x13, 0x0f, 0xde, 0x07, 0x1f, 0x0f, 0x45, 0x91, 0x02, 0x0f, 0x9d, 0x00, 0x1d,
+                0x0f, 0x5b, 0x07, 0x27, 0x0f, 0x3e, 0x00, 0x09, 0x0f, 0x87, 0x00, 0x32, 0x0f, 0xdc, 0x01, 0x14, 0x0f, 0x3f, 0x00, 0x0a,
+                0x0f, 0x89, 0x00, 0x28, 0x0f, 0xdc, 0x06, 0x13, 0x0f, 0x3b, 0x8e, 0x00, 0x0f, 0x73, 0x00, 0x2b, 0x0f, 0x81, 0x01, 0x25,
+                0x0f, 0x5e, 0x06, 0x26, 0x0f, 0xfd, 0x8e, 0x0b, 0x0f, 0x3d, 0x00, 0x27, 0x0f, 0x85, 0x00, 0x28, 0x0f, 0xe2, 0x05, 0x15,
+                0x0f, 0x23, 0x8b, 0x02, 0x0f, 0x77, 0x00, 0x2d, 0x0f, 0x81, 0x01, 0x25, 0x0f, 0x60, 0x05, 0x28, 0x0f, 0xeb, 0x8b, 0x0d,
+                0x0f, 0x3f, 0x00, 0x29, 0x0f, 0x89, 0x00, 0x1f, 0x0f, 0x16, 0x2e, 0x2b, 0x0e, 0x17, 0x22, 0x0f, 0x09, 0x2e, 0x76, 0x0f,
+                0x9b, 0x00, 0x06, 0x0f, 0xfc, 0x2d, 0x63, 0x0f, 0xe9, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                0xff, 0xff, 0x9a, 0x0f, 0x82, 0x48, 0x7d, 0x0f, 0x60, 0x43, 0x15, 0x0f, 0x75, 0x48, 0x40, 0x0e, 0x27, 0x22, 0x0f, 0x68,
+                0x48, 0x7b, 0x0f, 0xa0, 0x00, 0x0b, 0x0f, 0x5b, 0x48, 0xc1, 0x46, 0x31, 0x54, 0x65, 0x78, 0x6b, 0x02, 0x0f, 0x4a, 0x48,
+                0x0e, 0x0b, 0xf8, 0x99, 0x0f, 0x3f, 0x48, 0x68, 0x0a, 0xb9, 0x00, 0x0f, 0x3d, 0x88, 0x2f, 0x0f, 0x2b, 0x9f, 0x0b, 0x07,
+                0xff, 0x66, 0x0f, 0xc2, 0x9e, 0x05, 0x07, 0x23, 0x00, 0x0f, 0x9f, 0x9e, 0x01, 0x0a, 0x1f, 0x00, 0x07, 0xdf, 0x9d, 0x08,
+                0x5a, 0x67, 0x0f, 0x71, 0x9e, 0x00, 0x0a, 0x1f, 0x00, 0x0f, 0xe7, 0x9d, 0x08, 0x05, 0x96, 0x78, 0x0a, 0x7d, 0x9c, 0x03,
+                0xcc, 0x00, 0x0f, 0x1e, 0x00, 0x08, 0x03, 0x3c, 0x11, 0x0f, 0x0c, 0x9e, 0x0a, 0x0d, 0x48, 0x00, 0x0f, 0x2a, 0x00, 0x0c,
+                0x00, 0x54, 0x00, 0x0f, 0x20, 0x04, 0x07, 0x0c, 0xbc, 0x01, 0x0f, 0x73, 0x49, 0x57, 0x0f, 0x7a, 0x00, 0x1a, 0x0f, 0x66,
+                0x89, 0x47, 0x0f, 0x6d, 0x02, 0xff, 0x41, 0x0f, 0xb7, 0x4a, 0x55, 0x0f, 0x78, 0x04, 0x1e, 0x0f, 0xb8, 0x65, 0x21, 0x0f,
+                0xa8, 0x02, 0x09, 0x0f, 0xf4, 0x29, 0x5d, 0x0f, 0x8b, 0x00, 0x0f, 0x0f, 0xc4, 0x65, 0xc3, 0x0f, 0xea, 0x01, 0x1f, 0x0f,
+                0xca, 0x65, 0x0e, 0x0f, 0x81, 0xa1, 0x0b, 0x09, 0xf7, 0x02, 0x0f, 0x2b, 0x00, 0x11, 0x04, 0xf5, 0x16, 0x0f, 0x9b, 0xa1,
+                0x0a, 0x0f, 0x56, 0x00, 0x03, 0x0f, 0x2b, 0x00, 0x08, 0x0f, 0xbb, 0x05, 0x26, 0x0f, 0xcb, 0x09, 0x62, 0x0f, 0x90, 0x00,
+                0x14, 0x0f, 0x3b, 0x66, 0x52, 0x0f, 0xdf, 0x01, 0x97, 0x0f, 0x65, 0x0a, 0x61, 0x0b, 0x6d, 0x0b, 0x0f, 0x6b, 0x0a, 0x14,
+                0x02, 0x36, 0x00, 0x0f, 0x68, 0x0a, 0x6d, 0x0b, 0xbc, 0x00, 0x0f, 0x9c, 0x52, 0x46, 0x0f, 0x6d, 0x00, 0x02, 0x0f, 0x1e,
+                0x09, 0x5c, 0x0f, 0x7f, 0x00, 0x1a, 0x0f, 0x86, 0x52, 0xae, 0x0f, 0xdf, 0x01, 0x23, 0x0f, 0x7b, 0x52, 0x0a, 0x02, 0x85,
+                0x03, 0x0d, 0x20, 0x10, 0x0f, 0xa9, 0x03, 0x00, 0x0f, 0x24, 0x00, 0x06, 0x0c, 0x71, 0x10, 0x0f, 0x2f, 0x00, 0x0d, 0x00,
+                0xad, 0x10, 0x69, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5e, 0x17, 0x0f, 0x37, 0x00, 0x1f, 0x0f, 0x79, 0x00, 0x2b, 0x12,
+                0x6c, 0xf1, 0x11, 0x0f, 0x35, 0x00, 0x1d, 0x0f, 0x75, 0x00, 0x2b, 0x04, 0x42, 0x17, 0x0f, 0x36, 0x00, 0x1e, 0x0f, 0x77,
+                0x00, 0x2b, 0x1f, 0x73, 0x35, 0x00, 0x23, 0x0f, 0x75, 0x00, 0x21, 0x3f, 0x6c, 0x6f, 0x63, 0x60, 0x01, 0x1e, 0x07, 0x34,
+                0x00, 0x0f, 0x73, 0x00, 0x2a, 0x0f, 0xe7, 0x00, 0x18, 0x07, 0x34, 0x00, 0x0f, 0x73, 0x00, 0x19, 0x0a, 0xe7, 0x06, 0x0f,
+                0x24, 0x00, 0x06, 0x13, 0x5f, 0x9e, 0x9b, 0x4f, 0x31, 0x64, 0x5f, 0x32, 0x07, 0x01, 0x0f, 0x0c, 0x31, 0x00, 0x0f, 0x91,
+                0x00, 0x1c, 0x07, 0x3c, 0x00, 0x43, 0x62, 0x75, 0x66, 0x66, 0xc5, 0x16, 0x0f, 0x35, 0x00, 0x1d, 0x0f, 0x75, 0x00, 0x24,
+                0xa2, 0x32, 0x64, 0x5f, 0x6e, 0x6f, 0x6d, 0x69, 0x70, 0x6d, 0x61, 0xf7, 0x18, 0x0f, 0x37, 0x00, 0x1f, 0x0f, 0x79, 0x00,
+                0x24, 0x1f, 0x33, 0x58, 0x01, 0x1a, 0x1f, 0x33, 0x55, 0x01, 0x25, 0x4f, 0x63, 0x75, 0x62, 0x65, 0xdc, 0x00, 0x1c, 0x03,
+                0x33, 0x00, 0x0f, 0x71, 0x00, 0x1d, 0x0f, 0x2f, 0x00, 0x1c, 0x07, 0xc9, 0xb0, 0x0f, 0x30, 0x00, 0x1d, 0x0f, 0x6b, 0x00,
+                0x28, 0x0f, 0xb2, 0x05, 0x16, 0x0f, 0x38, 0x00, 0x04, 0x0f, 0x7b, 0x00, 0x2c, 0x0f, 0x54, 0x04, 0x10, 0x0f, 0x36, 0x00,
+                0x02, 0x0f, 0x77, 0x00, 0x2c, 0x0f, 0xb6, 0x05, 0x11, 0x0f, 0x37, 0x00, 0x03, 0x0f, 0x79, 0x00, 0x2c, 0x0f, 0xd1, 0x04,
+                0x10, 0x0f, 0x36, 0x00, 0x02, 0x0f, 0x77, 0x00, 0x21, 0x03, 0xd0, 0xb2, 0x0f, 0x30, 0x00, 0x1d, 0x0f, 0x6b, 0x00, 0x28,
+                0x0f, 0xd2, 0x01, 0x1c, 0x09, 0x36, 0x00, 0x0f, 0x77, 0x00, 0x2c, 0x0f, 0xc8, 0x05, 0x15, 0x0e, 0x37, 0x00, 0x0f, 0x17,
+                0x3b, 0x13, 0x0f, 0x9d, 0x0a, 0x0d, 0x0f, 0x18, 0x11, 0x62, 0x0f, 0x90, 0x00, 0x0f, 0x0f, 0x01, 0x3b, 0x4e, 0x0f, 0x6f,
+                0x0a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0x0f, 0x5c, 0x1a, 0x69, 0x0f, 0x77, 0x14, 0x1e, 0x0f,
+                0x92, 0x23, 0x27, 0x0f, 0xad, 0x0a, 0x0d, 0x0f, 0xbc, 0x19, 0x67, 0x0f, 0x95, 0x00, 0x14, 0x0f, 0x7c, 0x23, 0xc0, 0x2f,
+                0x53, 0x6d, 0x79, 0x23, 0x17, 0x2f, 0x73, 0x6d, 0x76, 0x23, 0x72, 0x08, 0xb3, 0x00, 0x0f, 0x73, 0x23, 0x2e, 0x0f, 0x22,
+                0x20, 0x04, 0x2f, 0x61, 0x64, 0x40, 0x20, 0x09, 0x2f, 0x61, 0x6c, 0x1e, 0x00, 0x09, 0x2f, 0x63, 0x62, 0x1e, 0x00, 0x09,
+                0x3f, 0x66, 0x6d, 0x61, 0x1e, 0x00, 0x09, 0x3f, 0x70, 0x31, 0x36, 0x1f, 0x00, 0x0a, 0x2f, 0x36, 0x34, 0x1f, 0x00, 0x08,
+                0x2f, 0x69, 0x70, 0x5c, 0x00, 0x09, 0x0f, 0x14, 0x21, 0x0d, 0x31, 0x6e, 0x73, 0x6f, 0xf4, 0x09, 0x0f, 0x35, 0x21, 0x0f,
+                0x0f, 0x1e, 0x00, 0x00, 0x30, 0x75, 0x6e, 0x69, 0xb8, 0x08, 0x0f, 0x22, 0x00, 0x08, 0x2f, 0x78, 0x75, 0x58, 0x0f, 0x07,
+                0x0a, 0xd3, 0x01, 0x0f, 0x6c, 0x1a, 0x56, 0x0f, 0x77, 0x00, 0x18, 0x0f, 0x87, 0x23, 0x46, 0x0f, 0x81, 0x02, 0xff, 0x5c,
+                0x0f, 0xd2, 0x1b, 0x54, 0x0f, 0xa3, 0x04, 0x1c, 0x0f, 0x9e, 0x23, 0x21, 0x0f, 0xbc, 0x02, 0x06, 0x0f, 0x83, 0x12, 0x5c,
+                0x0f, 0x88, 0x00, 0x0d, 0x0f, 0x98, 0x23, 0xc3, 0x0f, 0xe1, 0x01, 0x1c, 0x0f, 0x34, 0x09, 0x26, 0x0f, 0x5e, 0x01, 0x06,
+                0x0f, 0x2c, 0x09, 0x61, 0x0f, 0x8d, 0x00, 0x12, 0x0f, 0x24, 0x09, 0xc2, 0x53, 0x49, 0x6e, 0x73, 0x74, 0x45, 0x4d, 0x04,
+                0x0f, 0x26, 0x09, 0x10, 0x09, 0x7d, 0x04, 0x0f, 0x29, 0x09, 0x69, 0x08, 0xb8, 0x00, 0x0f, 0x2a, 0x09, 0x3e, 0x0f, 0xa0,
+                0x06, 0x09, 0x0f, 0xbe, 0x06, 0xff, 0x43, 0x06, 0xf1, 0x99, 0x0f, 0xe0, 0xc9, 0x00, 0x03, 0x59, 0x01, 0x04, 0xe9, 0xc9,
+                0x0f, 0x2d, 0x00, 0x0f, 0x3f, 0x66, 0x6d, 0x61, 0x2d, 0x00, 0x18, 0x3f, 0x70, 0x31, 0x36, 0x2e, 0x00, 0x19, 0x2f, 0x36,
+                0x34, 0x2e, 0x00, 0x17, 0x2f, 0x69, 0x70, 0x89, 0x00, 0x18, 0x00, 0x79, 0x15, 0x0f, 0x2d, 0x00, 0x16, 0x1d, 0x78, 0x2c,
+                0x00, 0x02, 0x1a, 0xa7, 0x04, 0xbe, 0xcb, 0x02, 0x16, 0x00, 0x0f, 0x34, 0xcb, 0x0d, 0x0f, 0xb7, 0x0a, 0x09, 0x09, 0x61,
+                0x03, 0x0f, 0xb8, 0x0a, 0x58, 0x0f, 0x78, 0x00, 0x17, 0x0f, 0xb9, 0x0a, 0x57, 0x0f, 0x10, 0x04, 0xff, 0xff, 0xd9, 0x0f,
+                0x46, 0x0c, 0x56, 0x0f, 0xc0, 0x07, 0x1b, 0x0f, 0x47, 0x0c, 0x23, 0x0f, 0x4b, 0x04, 0x05, 0x0f, 0x48, 0x0c, 0x5e, 0x0f,
+                0x89, 0x00, 0x0c, 0x0f, 0x49, 0x0c, 0xc5, 0x0f, 0xe4, 0x01, 0x1b, 0x0f, 0x4a, 0x0c, 0x28, 0x0f, 0x60, 0x01, 0x05, 0x0f,
+                0x4b, 0x0c, 0x63, 0x0f, 0x8e, 0x00, 0x11, 0x0f, 0x4c, 0x0c, 0xc2, 0x11, 0x53, 0x7a, 0xaf, 0x02, 0xfb, 0x00, 0x2f, 0x69,
+                0x6f, 0x83, 0x2e, 0x0e, 0x11, 0x73, 0x63, 0xd7, 0x00, 0xac, 0xaf, 0x02, 0x88, 0x04, 0x00, 0xfe, 0xb7, 0x0f, 0x52, 0x0c,
+                0x68, 0x0b, 0xbe, 0x00, 0x0f, 0x55, 0x0c, 0x46, 0x02, 0x81, 0x05, 0x0c, 0x9b, 0x05, 0x0e, 0x18, 0x00, 0x0e, 0x11, 0xb1,
+                0x0f, 0x22, 0x00, 0x05, 0x1f, 0x67, 0x22, 0x00, 0x0e, 0x1f, 0x70, 0x22, 0x00, 0x0e, 0x1f, 0x74, 0x67, 0x00, 0x0f, 0x03,
+                0xcf, 0x9b, 0x0f, 0x23, 0x00, 0x09, 0x15, 0x76, 0x22, 0x00, 0x0f, 0x7f, 0x06, 0x01, 0x0c, 0x16, 0x00, 0x0e, 0xe2, 0x00,
+                0x0f, 0x20, 0x00, 0x03, 0x06, 0xe0, 0x00, 0x0f, 0x20, 0x00, 0x03, 0x06, 0xde, 0x00, 0x0f, 0x20, 0x00, 0x03, 0x07, 0xdc,
+                0x00, 0x0f, 0x21, 0x00, 0x04, 0x06, 0xda, 0x00, 0x0f, 0x21, 0x00, 0x03, 0x04, 0xd8, 0x00, 0x00, 0x41, 0x07, 0x0f, 0xd5,
+                0x01, 0x00, 0x0d, 0x17, 0x00, 0x0c, 0xda, 0x00, 0x0f, 0x21, 0x00, 0x06, 0x04, 0xdb, 0x00, 0x0f, 0x21, 0x00, 0x06, 0x04,
+                0xdc, 0x00, 0x0f, 0x21, 0x00, 0x06, 0x05, 0xdd, 0x00, 0x0f, 0x22, 0x00, 0x07, 0x04, 0xde, 0x00, 0x0f, 0x22, 0x00, 0x06,
+                0x1f, 0x76, 0xc7, 0x9e, 0x08, 0x0e, 0x19, 0x03, 0x0f, 0x0d, 0x0c, 0x58, 0x0f, 0x7b, 0x00, 0x1a, 0x0f, 0x10, 0x0c, 0x5f,
+                0x0f, 0xcb, 0x03, 0xff, 0xff, 0x86, 0x0f, 0xc5, 0x0b, 0x56, 0x0f, 0x33, 0x07, 0x1e, 0x0f, 0xc8, 0x0b, 0x23, 0x0f, 0x06,
+                0x04, 0x08, 0x0f, 0xcb, 0x0b, 0x5e, 0x0f, 0x8c, 0x00, 0x0f, 0x0f, 0xce, 0x0b, 0xc5, 0x0f, 0xed, 0x01, 0x1e, 0x0f, 0xd1,
+                0x0b, 0x28, 0x0f, 0x66, 0x01, 0x08, 0x0f, 0xd4, 0x0b, 0x63, 0x0f, 0x91, 0x00, 0x14, 0x0f, 0xd7, 0x0b, 0xc2, 0x22, 0x52,
+                0x65, 0xcd, 0x8c, 0x4f, 0x55, 0x73, 0x61, 0x67, 0x0d, 0x8d, 0x0e, 0x43, 0x73, 0x6d, 0x5f, 0x72, 0x30, 0x00, 0x20, 0x5f,
+                0x75, 0x31, 0x00, 0x0f, 0xd3, 0x0b, 0x69, 0x09, 0xba, 0x00, 0x0f, 0xd1, 0x0b, 0x31, 0x3c, 0x63, 0x74, 0x61, 0xa3, 0x41,
+                0x0f, 0x92, 0xbc, 0x02, 0x02, 0x37, 0x25, 0x06, 0x45, 0xe4, 0x02, 0x69, 0x42, 0x00, 0x98, 0xd0, 0x14, 0x75, 0x05, 0xa7,
+                0x10, 0x5f, 0x38, 0xcf, 0x23, 0x63, 0x61, 0x79, 0x06, 0x0f, 0x36, 0x00, 0x08, 0x3f, 0x69, 0x73, 0x62, 0x33, 0x00, 0x1d,
+                0x10, 0x74, 0x38, 0xa3, 0x0f, 0x33, 0x00, 0x05, 0x00, 0xa2, 0x01, 0x60, 0x66, 0x5f, 0x72, 0x65, 0x67, 0x69, 0x78, 0xb1,
+                0x0f, 0x22, 0x00, 0x1a, 0x0a, 0x0c, 0x07, 0x0f, 0x2c, 0x00, 0x13, 0x02, 0xf6, 0x06, 0x0f, 0x2c, 0x00, 0x13, 0x35, 0x76,
+                0x74, 0x67, 0x2d, 0x00, 0x08, 0x58, 0x01, 0x06, 0x78, 0x00, 0x00, 0xa5, 0x42, 0x10, 0x6c, 0x31, 0xc6, 0x0f, 0x28, 0x00,
+                0x0a, 0x1f, 0x70, 0x28, 0x00, 0x14, 0x36, 0x76, 0x74, 0x67, 0x29, 0x00, 0x0f, 0x8f, 0x04, 0x08, 0x0a, 0x48, 0x02, 0x0f,
+                0x00, 0x0b, 0x58, 0x0f, 0x79, 0x00, 0x18, 0x0f, 0xfe, 0x0a, 0x4a, 0x0f, 0xf8, 0x02, 0xff, 0xcb, 0x0f, 0x2f, 0x0a, 0x56,
+                0x0f, 0x8f, 0x05, 0x1c, 0x0f, 0x2d, 0x0a, 0x23, 0x0f, 0x33, 0x03, 0x06, 0x0f, 0x2b, 0x0a, 0x5e, 0x0f, 0x8a, 0x00, 0x0d,
+                0x0f, 0x29, 0x0a, 0xc5, 0x0f, 0xe7, 0x01, 0x1c, 0x0f, 0x27, 0x0a, 0x28, 0x0f, 0x62, 0x01, 0x06, 0x0f, 0x25, 0x0a, 0x63,
+                0x0f, 0x8f, 0x00, 0x12, 0x0f, 0x23, 0x0a, 0xc2, 0x51, 0x57, 0x61, 0x72, 0x70, 0x4c, 0x69, 0x0f, 0x10, 0x53, 0x92, 0xeb,
+                0x0f, 0x3a, 0x02, 0x0e, 0x03, 0x55, 0xe9, 0x00, 0x31, 0x00, 0x02, 0xc4, 0xeb, 0x0f, 0x0f, 0xb9, 0x68, 0x0e, 0xbe, 0x00,
+                0x0f, 0x2a, 0x0a, 0x2d, 0x01, 0x78, 0x05, 0x50, 0x70, 0x65, 0x32, 0x73, 0x6d, 0x92, 0x05, 0x01, 0x95, 0x06, 0x03, 0xf3,
+                0x05, 0x2c, 0x69, 0x6f, 0xbb, 0xec, 0x05, 0xa8, 0x05, 0x02, 0x30, 0x00, 0x00, 0x9a, 0x05, 0x01, 0xf9, 0x06, 0x0f, 0x31,
+                0x00, 0x0f, 0x08, 0x44, 0x01, 0x0b, 0x0f, 0xed, 0x09, 0x37, 0x06, 0x10, 0x73, 0x43, 0x00, 0x27, 0x74, 0x61, 0x52, 0x00,
+                0x0f, 0x43, 0x00, 0x22, 0x04, 0xbf, 0x06, 0x0f, 0x48, 0x00, 0x2d, 0x20, 0x73, 0x68, 0xb6, 0x07, 0x0f, 0x45, 0x00, 0x2c,
+                0x01, 0x2c, 0x00, 0x0f, 0x44, 0x00, 0x22, 0x02, 0xa6, 0x11, 0x0f, 0x2d, 0x00, 0x14, 0x07, 0xc4, 0x07, 0x0f, 0x2d, 0x00,
+                0x11, 0x04, 0x9e, 0x00, 0x32, 0x6f, 0x6f, 0x6f, 0x30, 0x00, 0x00, 0xf9, 0x08, 0x2f, 0x6c, 0x65, 0xa2, 0x00, 0x1c, 0x06,
+                0x48, 0x00, 0x0f, 0x73, 0x01, 0x2b, 0x06, 0x48, 0x00, 0x0f, 0x2e, 0x01, 0x27, 0x03, 0x92, 0x12, 0x0f, 0x2e, 0x00, 0x15,
+                0x02, 0x9e, 0x12, 0x0f, 0x2e, 0x00, 0x14, 0x02, 0x89, 0x13, 0x0f, 0x2d, 0x00, 0x15, 0x2f, 0x74, 0x67, 0xa1, 0x0b, 0x09,
+                0x0d, 0xc2, 0x03, 0x0f, 0xa4, 0x0b, 0x58, 0x0f, 0x7c, 0x00, 0x1b, 0x0f, 0xa7, 0x0b, 0x46, 0x0f, 0x75, 0x04, 0xff, 0xff,
+                0xff, 0x48, 0x0f, 0x1e, 0x0d, 0x56, 0x0f, 0x86, 0x08, 0x1f, 0x0f, 0x21, 0x0d, 0x23, 0x0f, 0xb0, 0x04, 0x09, 0x0f, 0x24,
+                0x0d, 0x5e, 0x0f, 0x8d, 0x00, 0x10, 0x0f, 0x27, 0x0d, 0xc5, 0x0f, 0xf0, 0x01, 0x1f, 0x0f, 0x2a, 0x0d, 0x28, 0x0f, 0x68,
+                0x01, 0x09, 0x0f, 0x2d, 0x0d, 0x63, 0x0f, 0x92, 0x00, 0x15, 0x0f, 0x30, 0x0d, 0xc0, 0x00, 0xfb, 0x00, 0x10, 0x49, 0xdd,
+                0xd2, 0x0f, 0x2d, 0x0d, 0x18, 0x02, 0x0d, 0xd3, 0x0f, 0x2c, 0x0d, 0x6d, 0x0b, 0xba, 0x00, 0x0f, 0x53, 0x17, 0x2f, 0x0f,
+                0x86, 0x1d, 0x08, 0x0c, 0x61, 0x14, 0x08, 0x16, 0x00, 0x07, 0x0e, 0x01, 0x24, 0x65, 0x64, 0x98, 0xd4, 0x0f, 0x25, 0x00,
+                0x0c, 0x20, 0x72, 0x61, 0xea, 0x05, 0x00, 0x9d, 0x18, 0x41, 0x6c, 0x76, 0x69, 0x6e, 0x71, 0x13, 0x0f, 0x2e, 0x00, 0x07,
+                0x05, 0xc6, 0xd4, 0x01, 0x11, 0x00, 0x0f, 0x2c, 0x00, 0x0c, 0x33, 0x72, 0x61, 0x69, 0x77, 0x29, 0x0f, 0x23, 0x00, 0x05,
+                0x31, 0x69, 0x6d, 0x63, 0x9c, 0xfa, 0x0f, 0x26, 0x00, 0x0b, 0x12, 0x6c, 0xcc, 0xe9, 0x22, 0x74, 0x74, 0x80, 0xd5, 0x0f,
+                0x29, 0x00, 0x08, 0xdd, 0x6f, 0x6e, 0x67, 0x5f, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x62, 0x6f, 0x61, 0x72, 0x34, 0x01, 0x0a,
+                0x2d, 0x00, 0x43, 0x6d, 0x61, 0x74, 0x68, 0x99, 0x2b, 0x0f, 0x5d, 0x00, 0x12, 0x5f, 0x6d, 0x65, 0x6d, 0x62, 0x61, 0x4d,
+                0x01, 0x0c, 0x00, 0x32, 0x5a, 0x0f, 0x4e, 0x00, 0x14, 0x21, 0x69, 0x73, 0xcf, 0x81, 0x0f, 0x22, 0x00, 0x07, 0x21, 0x6e,
+                0x6f, 0x02, 0x02, 0x21, 0x72, 0x75, 0x23, 0xe9, 0x0f, 0x2c, 0x00, 0x0d, 0x00, 0x82, 0x3e, 0x3f, 0x6c, 0x65, 0x63, 0x2a,
+                0x02, 0x00, 0x0a, 0x2a, 0x00, 0x0f, 0x26, 0x00, 0x14, 0x00, 0xeb, 0xa8, 0x0f, 0x4a, 0x01, 0x16, 0x5f, 0x73, 0x6c, 0x65,
+                0x65, 0x70, 0x3b, 0x02, 0x0e, 0x04, 0x16, 0x56, 0x0f, 0x1c, 0x01, 0x0f, 0x22, 0x77, 0x61, 0x9c, 0x3f, 0x08, 0x22, 0x00,
+                0x05, 0x67, 0x21, 0x0f, 0xcd, 0x05, 0x06, 0x0c, 0x84, 0x03, 0x0f, 0xeb, 0x0c, 0x56, 0x0f, 0x79, 0x00, 0x1a, 0x0f, 0x8f,
+                0x18, 0x48, 0x0f, 0x34, 0x04, 0xff, 0xff, 0xff, 0x0b, 0x0f, 0xad, 0x0c, 0x54, 0x0f, 0x07, 0x08, 0x1e, 0x0f, 0xaa, 0x0c,
+                0x21, 0x0f, 0x6f, 0x04, 0x08, 0x0f, 0xa7, 0x0c, 0x5c, 0x0f, 0x8a, 0x00, 0x0f, 0x0f, 0xa4, 0x0c, 0xc3, 0x0f, 0xe7, 0x01,
+                0x1e, 0x0f, 0xa1, 0x0c, 0x26, 0x0f, 0x62, 0x01, 0x08, 0x0f, 0x9e, 0x0c, 0x61, 0x0f, 0x8f, 0x00, 0x14, 0x0f, 0x9b, 0x0c,
+                0xc0, 0x50, 0x50, 0x72, 0x69, 0x6d, 0x69, 0x3e, 0x07, 0x41, 0x44, 0x61, 0x74, 0x61, 0x73, 0xf1, 0x0f, 0x39, 0x02, 0x0c,
+                0x14, 0x70, 0x31, 0x00, 0x02, 0x82, 0x1f, 0x00, 0x33, 0x00, 0x0f, 0x9f, 0x0c, 0x67, 0x0d, 0xbe, 0x00, 0x0f, 0x03, 0xcc,
+                0x2e, 0x00, 0xd6, 0xd4, 0x01, 0xc7, 0xf2, 0x01, 0xe9, 0x00, 0x02, 0xcf, 0xca, 0x06, 0x14, 0x00, 0x32, 0x76, 0x65, 0x72,
+                0xf4, 0x65, 0x01, 0xeb, 0xd4, 0x64, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5d, 0xe1, 0x32, 0x61, 0x74, 0x74, 0x2a, 0xe1,
+                0x0f, 0x1c, 0x00, 0x00, 0x06, 0x4c, 0x00, 0x0e, 0x1c, 0x00, 0x05, 0x54, 0x00, 0x0f, 0x27, 0x2c, 0x2b, 0x0f, 0x05, 0x2c,
+                0x39, 0x11, 0x76, 0x65, 0xe1, 0x3c, 0x6c, 0x69, 0x70, 0x0b, 0x01, 0x0f, 0x19, 0x00, 0x02, 0x00, 0x07, 0x4a, 0x00, 0x14,
+                0x00, 0x12, 0x70, 0x49, 0x07, 0x06, 0x24, 0x00, 0x0c, 0xfd, 0x00, 0x02, 0x1a, 0x00, 0x3f, 0x75, 0x6c, 0x6c, 0x57, 0x00,
+                0x03, 0x0b, 0x19, 0x00, 0x01, 0x57, 0x00, 0x14, 0x75, 0x8d, 0x16, 0x0f, 0x23, 0x00, 0x06, 0x00, 0xdd, 0xf5, 0x07, 0x23,
+                0x00, 0x0f, 0x5a, 0x00, 0x01, 0x0c, 0xa1, 0x01, 0x08, 0x15, 0x00, 0x02, 0x2a, 0x00, 0x0f, 0xa8, 0x04, 0x06, 0x0e, 0x61,
+                0x02, 0x0f, 0x7e, 0x0b, 0x56, 0x0f, 0x7b, 0x00, 0x1c, 0x0f, 0xe2, 0xcd, 0x47, 0x0f, 0x13, 0x03, 0xff, 0xe5, 0x0f, 0x5b,
+                0x0a, 0x54, 0x0f, 0xc3, 0x05, 0x20, 0x0f, 0x5d, 0x0a, 0x21, 0x0f, 0x4e, 0x03, 0x0a, 0x0f, 0x5f, 0x0a, 0x5c, 0x0f, 0x8c,
+                0x00, 0x11, 0x0f, 0x61, 0x0a, 0xc3, 0x0f, 0xed, 0x01, 0x20, 0x0f, 0x63, 0x0a, 0x26, 0x0f, 0x66, 0x01, 0x0a, 0x0f, 0x65,
+                0x0a, 0x61, 0x0f, 0x91, 0x00, 0x16, 0x0f, 0x67, 0x0a, 0xc0, 0x11, 0x52, 0xf4, 0xdd, 0x0f, 0x64, 0x0a, 0x15, 0x03, 0x22,
+                0xde, 0x0f, 0x61, 0x0a, 0x70, 0x0a, 0xb8, 0x00, 0x0f, 0x5e, 0x0a, 0x2e, 0x01, 0xbf, 0xde, 0x63, 0x65, 0x61, 0x72, 0x6c,
+                0x79, 0x7a, 0x97, 0x05, 0x20, 0x73, 0x61, 0xbd, 0x1d, 0x02, 0x09, 0x07, 0x08, 0x1e, 0x00, 0x21, 0x6b, 0x69, 0xfe, 0x0f,
+                0x01, 0x8f, 0xeb, 0x0a, 0xe5, 0x29, 0x0f, 0x27, 0x00, 0x01, 0x0f, 0x46, 0x00, 0x05, 0x03, 0xd2, 0x05, 0x0d, 0x1f, 0x00,
+                0x03, 0x13, 0x06, 0x02, 0x5d, 0x00, 0x01, 0x12, 0xec, 0x2f, 0x33, 0x64, 0x65, 0x00, 0x00, 0x00, 0xec, 0x02, 0x0f, 0x64,
+                0x00, 0x07, 0x02, 0x1e, 0x00, 0x0f, 0x63, 0x00, 0x05, 0x00, 0x06, 0x00, 0x02, 0x88, 0x6b, 0x01, 0x65, 0x8e, 0x0f, 0xc9,
+                0x00, 0x06, 0x06, 0x28, 0x00, 0x01, 0xe9, 0x77, 0x0f, 0x28, 0x00, 0x00, 0x04, 0x30, 0xe0, 0x17, 0x7a, 0xec, 0x06, 0x07,
+                0x6f, 0x00, 0x0f, 0x1f, 0x00, 0x08, 0x01, 0x64, 0x57, 0x43, 0x63, 0x63, 0x65, 0x70, 0xe4, 0x11, 0x0f, 0x2b, 0x00, 0x0c,
+                0x37, 0x72, 0x65, 0x6a, 0x0f, 0x12, 0x0f, 0x92, 0x37, 0x09, 0x01, 0x14, 0x01, 0x8f, 0x6d, 0x61, 0x73, 0x6b, 0x5f, 0x6f,
+                0x66, 0x66, 0x3e, 0x0a, 0x07, 0x0b, 0x3e, 0x02, 0x0f, 0x3b, 0x0a, 0x56, 0x0f, 0x78, 0x00, 0x19, 0x0f, 0x38, 0x0a, 0x47,
+                0x0f, 0xed, 0x02, 0xff, 0xc5, 0x0f, 0x18, 0x0a, 0x54, 0x0f, 0x7a, 0x05, 0x1d, 0x0f, 0x15, 0x0a, 0x21, 0x0f, 0x28, 0x03,
+                0x07, 0x0f, 0x12, 0x0a, 0x5c, 0x0f, 0x89, 0x00, 0x0e, 0x0f, 0x0f, 0x0a, 0xc3, 0x0f, 0xe4, 0x01, 0x1d, 0x0f, 0x0c, 0x0a,
+                0x26, 0x0f, 0x60, 0x01, 0x07, 0x0f, 0x09, 0x0a, 0x61, 0x0f, 0x8e, 0x00, 0x13, 0x0f, 0x79, 0xc5, 0xda, 0x0a, 0x91, 0xc6,
+                0x0f, 0x54, 0xd9, 0x31, 0x0f, 0x4e, 0xd9, 0x8f, 0x0f, 0x49, 0xd9, 0x6d, 0x0f, 0x44, 0xd9, 0x7f, 0x0f, 0x3f, 0xd9, 0xf3,
+                0x0f, 0x3a, 0xd9, 0xa7, 0x0f, 0x09, 0xd0, 0x46, 0x0f, 0x65, 0xce, 0x41, 0x08, 0xaf, 0xa4, 0x0f, 0x2a, 0xa4, 0x1e, 0x0f,
+                0x35, 0x00, 0x00, 0x0f, 0x75, 0x00, 0x27, 0x0f, 0x1e, 0xa3, 0x13, 0x0d, 0x33, 0x00, 0x0f, 0x71, 0x00, 0x27, 0x0f, 0x1a,
+                0xa2, 0x15, 0x0f, 0x35, 0x00, 0x00, 0x0f, 0xda, 0xa5, 0x1d, 0x0f, 0x5b, 0x01, 0x1f, 0x0f, 0x35, 0x00, 0x00, 0x0f, 0x75,
+                0x00, 0x27, 0x0f, 0x5b, 0x01, 0x13, 0x0d, 0x33, 0x00, 0x0f, 0x71, 0x00, 0x27, 0x0f, 0x5b, 0x01, 0x15, 0x0f, 0x35, 0x00,
+                0x00, 0x0f, 0xe0, 0xa6, 0xff, 0xff, 0xff, 0xff, 0x99, 0x0f, 0xba, 0xa6, 0xff, 0xff, 0xff, 0xff, 0x76, 0x0f, 0x5f, 0xa6,
+                0xff, 0xff, 0xff, 0xff, 0xc2, 0x0f, 0x06, 0xa6, 0xff, 0xff, 0xff, 0xff, 0x56, 0x0f, 0xb2, 0xa5, 0xff, 0xff, 0xff, 0xff,
+                0xff, 0xff, 0xff, 0x7b, 0x0f, 0x5c, 0xa5, 0xff, 0xff, 0xff, 0xff, 0x59, 0x0f, 0x23, 0x24, 0x3a, 0x0f, 0x25, 0xf5, 0x84,
+                0x0f, 0x20, 0xf5, 0xdc, 0x0f, 0x63, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                0x9f, 0x0f, 0x8e, 0xc8, 0x7d, 0x0f, 0x4c, 0x46, 0x1d, 0x0f, 0x96, 0xc8, 0x40, 0x0f, 0xa1, 0x23, 0x07, 0x0f, 0x9e, 0xc8,
+                0x7b, 0x0f, 0xa8, 0x00, 0x13, 0x0f, 0x88, 0x4b, 0xda, 0x20, 0x4f, 0x70, 0x94, 0x00, 0x0f, 0xcc, 0x8f, 0x10, 0x0f, 0x83,
+                0x4b, 0x02, 0x14, 0x6f, 0x3e, 0x00, 0x0f, 0x7d, 0x4b, 0x81, 0x05, 0xdb, 0x00, 0x0f, 0x78, 0x4b, 0x5f, 0x06, 0x7b, 0x00,
+                0x0f, 0x73, 0x4b, 0x70, 0x0f, 0x8d, 0x00, 0x14, 0x0f, 0x6e, 0x4b, 0xc7, 0x0f, 0x09, 0x02, 0x18, 0x0f, 0x69, 0x4b, 0x2e,
+                0x0f, 0x88, 0x0c, 0x0f, 0x0f, 0x7a, 0x11, 0x29, 0x0f, 0x69, 0x0a, 0x1e, 0x0f, 0x5c, 0x0a, 0x29, 0x0f, 0x56, 0x11, 0x1d,
+                0x0f, 0x4a, 0x11, 0x28, 0x0f, 0xba, 0x0a, 0x1f, 0x0f, 0xad, 0x0a, 0x2a, 0x0f, 0xb5, 0x10, 0x1c, 0x0f, 0xa9, 0x10, 0x27,
+                0x0f, 0x96, 0x0a, 0x1c, 0x0f, 0x89, 0x0a, 0x27, 0x0f, 0x85, 0x10, 0x1b, 0x0f, 0x79, 0x10, 0x26, 0x0f, 0xe3, 0x0a, 0x1d,
+                0x0f, 0xd6, 0x0a, 0x28, 0x0f, 0xe0, 0x0f, 0x1e, 0x0f, 0xd4, 0x0f, 0x29, 0x0f, 0xbf, 0x0a, 0x1e, 0x0f, 0xb2, 0x0a, 0x29,
+                0x0f, 0xb0, 0x0f, 0x1d, 0x0f, 0xa4, 0x0f, 0x28, 0x0f, 0x10, 0x0b, 0x1f, 0x0f, 0x8c, 0x0f, 0x2a, 0x0f, 0xa4, 0x01, 0x0e,
+                0x0f, 0x94, 0x01, 0x19, 0x0f, 0x84, 0x01, 0x0e, 0x0f, 0x74, 0x01, 0x19, 0x0f, 0x64, 0x01, 0x0d, 0x0f, 0x54, 0x01, 0x18,
+                0x0f, 0x44, 0x01, 0x0f, 0x0f, 0x87, 0x27, 0x22, 0x0f, 0xfe, 0x2c, 0x01, 0x0f, 0x12, 0x27, 0x16, 0x0f, 0x3d, 0x00, 0x08,
+                0x0f, 0x85, 0x00, 0x31, 0x0f, 0x12, 0x27, 0x14, 0x0f, 0x3e, 0x00, 0x09, 0x0f, 0xca, 0x2d, 0x2b, 0x0f, 0x0a, 0x01, 0x24,
+                0x0f, 0x97, 0x29, 0x26, 0x0f, 0x46, 0x00, 0x02, 0x0f, 0x06, 0x01, 0x21, 0x0f, 0x97, 0x29, 0x27, 0x0f, 0x28, 0x2e, 0x01,
+                0x0f, 0x06, 0x01, 0x23, 0x0f, 0x22, 0x29, 0x28, 0x0f, 0x48, 0x00, 0x04, 0x0f, 0x0a, 0x01, 0x21, 0x0f, 0xdc, 0x13, 0x24,
+                0x0f, 0xbf, 0x2e, 0x06, 0x0f, 0xf0, 0x15, 0x11, 0x0f, 0x3d, 0x00, 0x0d, 0x0f, 0x85, 0x00, 0x31, 0x0f, 0x91, 0x01, 0x13,
+                0x0f, 0x3d, 0x00, 0x08, 0x0f, 0x85, 0x00, 0x33, 0x0f, 0x84, 0x00, 0x29, 0x0f, 0x83, 0x00, 0x32, 0x0f, 0x14, 0x02, 0x14,
+                0x0f, 0x3e, 0x00, 0x09, 0x0f, 0x93, 0x30, 0x2b, 0x0f, 0x12, 0x02, 0x24, 0x0f, 0x7d, 0x1a, 0x21, 0x0f, 0x46, 0x00, 0x07,
+                0x0f, 0x0e, 0x02, 0x20, 0x0f, 0xa5, 0x04, 0x26, 0x0f, 0x46, 0x00, 0x04, 0x0f, 0x80, 0x00, 0x27, 0x0f, 0x7f, 0x00, 0x30,
+                0x0f, 0x06, 0x02, 0x21, 0x0f, 0x24, 0x05, 0x27, 0x0f, 0xf1, 0x31, 0x01, 0x0f, 0x06, 0x02, 0x23, 0x0f, 0x08, 0x1a, 0x23,
+                0x0f, 0x48, 0x00, 0x09, 0x0f, 0x0a, 0x02, 0x20, 0x0f, 0xa9, 0x05, 0x28, 0x0f, 0x48, 0x00, 0x06, 0x0f, 0x84, 0x00, 0x29,
+                0x0f, 0x83, 0x00, 0x32, 0x0f, 0x12, 0x02, 0x21, 0x0f, 0x2c, 0x06, 0x29, 0x0f, 0x50, 0x33, 0xff, 0x0b, 0x0f, 0xdf, 0x32,
+                0xf3, 0x0f, 0x6a, 0x32, 0xfa, 0x0f, 0xf3, 0x31, 0xfb, 0x0f, 0x80, 0x31, 0xf7, 0x0f, 0x09, 0x31, 0xff, 0x02, 0x0f, 0x8a,
+                0x30, 0xff, 0x0c, 0x0f, 0x0f, 0x30, 0xff, 0x08, 0x0f, 0x90, 0x2f, 0xff, 0x08, 0x0f, 0x1d, 0x2f, 0xf3, 0x0f, 0xae, 0x2e,
+                0xef, 0x0f, 0x3b, 0x2e, 0xf6, 0x0f, 0xc6, 0x2d, 0xff, 0xff, 0x01, 0x0f, 0x55, 0x2d, 0xff, 0xf4, 0x0f, 0xe0, 0x2c, 0xff,
+                0xff, 0x04, 0x0f, 0x69, 0x2c, 0xfb, 0x0f, 0xf6, 0x2b, 0xf7, 0x0f, 0xe2, 0x4e, 0xfb, 0x0f, 0x00, 0x27, 0x02, 0x0f, 0xdd,
+                0x4e, 0x76, 0x0f, 0x9e, 0x00, 0x09, 0x0f, 0xd8, 0x4e, 0x72, 0x0f, 0xd2, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x73, 0x0f, 0x51, 0x52, 0x7d, 0x0f, 0x2f, 0x4d, 0x18, 0x0f,
+                0x4c, 0x52, 0x40, 0x0f, 0x10, 0x27, 0x02, 0x0f, 0x47, 0x52, 0x7b, 0x0f, 0xa3, 0x00, 0x0e, 0x0f, 0x42, 0x52, 0xba, 0x40,
+                0x41, 0x64, 0x64, 0x69, 0xed, 0x00, 0x27, 0x61, 0x6c, 0x27, 0x00, 0x0f, 0xeb, 0x51, 0x62, 0x0d, 0x8a, 0x00, 0x0f, 0x9f,
+                0xa7, 0x2d, 0x41, 0x69, 0x64, 0x63, 0x5f, 0x68, 0x00, 0x22, 0x65, 0x73, 0x7f, 0xae, 0x09, 0x11, 0x00, 0x0b, 0x2e, 0x04,
+                0x0f, 0x1c, 0x00, 0x02, 0x04, 0xbf, 0xb9, 0x03, 0x46, 0xfb, 0x01, 0xc1, 0xa8, 0x05, 0xdc, 0xe7, 0xa1, 0x77, 0x61, 0x76,
+                0x65, 0x66, 0x72, 0x6f, 0x6e, 0x74, 0x73, 0xc8, 0xd2, 0x11, 0x6c, 0x23, 0xb8, 0x0f, 0x2a, 0x00, 0x11, 0x02, 0xf2, 0xd2,
+                0x0f, 0x2e, 0x00, 0x16, 0x0d, 0x03, 0xff, 0x06, 0x2f, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x2f, 0x00, 0x2b, 0x0e, 0x14, 0xfd,
+                0x01, 0x83, 0x00, 0x00, 0xc6, 0x04, 0x47, 0x62, 0x61, 0x63, 0x6b, 0x8b, 0xbb, 0x06, 0x1f, 0x00, 0x10, 0x69, 0x65, 0xc6,
+                0x06, 0x56, 0x01, 0x03, 0x19, 0x00, 0x01, 0x5d, 0x00, 0x0f, 0x38, 0x00, 0x07, 0x4c, 0x74, 0x65, 0x78, 0x69, 0x96, 0xc8,
+                0x8c, 0x5f, 0x6f, 0x6e, 0x5f, 0x74, 0x73, 0x6c, 0x31, 0x68, 0x01, 0x02, 0x2c, 0x00, 0x0f, 0x64, 0x00, 0x03, 0x60, 0x69,
+                0x6e, 0x5f, 0x73, 0x6d, 0x32, 0x0e, 0x00, 0x34, 0x72, 0x65, 0x71, 0x50, 0x00, 0x0a, 0xda, 0xd4, 0x6f, 0x6d, 0x69, 0x6f,
+                0x32, 0x72, 0x66, 0x8d, 0x00, 0x02, 0x03, 0x1f, 0x00, 0x32, 0x5f, 0x70, 0x71, 0x32, 0x06, 0x0f, 0x40, 0x00, 0x05, 0x00,
+                0x21, 0x00, 0x02, 0xcb, 0x05, 0x0f, 0x22, 0x00, 0x02, 0x5e, 0x70, 0x73, 0x5f, 0x71, 0x75, 0x39, 0xe0, 0x0f, 0x9f, 0xe9,
+                0x05, 0x0f, 0xbd, 0xe9, 0x12, 0x2f, 0x66, 0x66, 0xe4, 0xe9, 0x14, 0x0b, 0x3d, 0xba, 0x7f, 0x65, 0x6c, 0x69, 0x67, 0x69,
+                0x62, 0x6c, 0x00, 0xd7, 0x08, 0x0e, 0x59, 0x03, 0x0f, 0xb7, 0x54, 0x56, 0x0f, 0x7b, 0x00, 0x1c, 0x0f, 0xbd, 0xa8, 0x46,
+                0x0f, 0x0b, 0x04, 0xff, 0xff, 0xdf, 0x0f, 0x95, 0x57, 0x54, 0x0f, 0xb3, 0x07, 0x20, 0x0f, 0x83, 0x57, 0x09, 0x02, 0xcc,
+                0x00, 0x71, 0x61, 0x6d, 0x6f, 0x72, 0x74, 0x69, 0x7a, 0x2c, 0xbf, 0x01, 0xe2, 0xcb, 0x5f, 0x74, 0x65, 0x6e, 0x63, 0x79,
+                0xdf, 0x04, 0x24, 0x0f, 0x09, 0x32, 0x5c, 0x0f, 0x8c, 0x00, 0x11, 0x0f, 0xf7, 0x31, 0x4d, 0x0f, 0x46, 0x01, 0x0b, 0x0f,
+                0x8f, 0x0c, 0x63, 0x0f, 0x29, 0x02, 0x20, 0x0f, 0x7d, 0x0c, 0x0d, 0x04, 0x09, 0x04, 0x12, 0x6d, 0x4c, 0xdc, 0x02, 0x87,
+                0xad, 0x06, 0x35, 0x00, 0x07, 0x2b, 0x04, 0x20, 0x6d, 0x5f, 0x1c, 0x00, 0x12, 0x32, 0x0e, 0x00, 0x07, 0x22, 0x00, 0x0f,
+                0x52, 0x02, 0x23, 0x0f, 0xad, 0x0c, 0x61, 0x0f, 0x91, 0x00, 0x16, 0x0f, 0x9b, 0x0c, 0x51, 0x0f, 0x79, 0x01, 0x30, 0x0f,
+                0x1f, 0x5f, 0x5b, 0x3f, 0x41, 0x6c, 0x6c, 0x96, 0x0c, 0x15, 0x35, 0x61, 0x6c, 0x6c, 0x91, 0x0c, 0x0f, 0xf5, 0x5e, 0x15,
+                0x0f, 0x90, 0x00, 0x21, 0x0f, 0x6f, 0x05, 0x13, 0x00, 0x8e, 0x00, 0x02, 0xfd, 0x03, 0x0f, 0x8c, 0x00, 0x49, 0x0f, 0xdc,
+                0x03, 0x18, 0x00, 0x91, 0x00, 0x07, 0x32, 0x02, 0x0e, 0x96, 0x00, 0x1f, 0x21, 0x97, 0x00, 0x02, 0x41, 0x76, 0x61, 0x72,
+                0x20, 0x17, 0x00, 0x00, 0x73, 0x0f, 0x30, 0x69, 0x6f, 0x6e, 0x60, 0x04, 0x0f, 0x6a, 0x00, 0x00, 0xe1, 0x73, 0x42, 0x79,
+                0x43, 0x6c, 0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x28, 0x27, 0x31, 0x00, 0x01, 0x77, 0x11, 0x01, 0xac, 0x10, 0x08,
+                0x31, 0x02, 0x48, 0x66, 0x6f, 0x72, 0x28, 0x50, 0x00, 0x3a, 0x20, 0x6f, 0x66, 0x60, 0x00, 0x0c, 0xd8, 0x03, 0x08, 0x1d,
+                0x00, 0x70, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0xed, 0xc7, 0xcf, 0x6c, 0x61, 0x79, 0x20, 0x3d, 0x20, 0x22, 0x6e,
+                0x6f, 0x6e, 0x65, 0x22, 0x91, 0x02, 0x0c, 0x02, 0x13, 0x00, 0x90, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+                0x17, 0x00, 0x62, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x0b, 0x00, 0x00, 0x1e, 0x01, 0xf1, 0x0a, 0x20, 0x6f, 0x6e, 0x6c,
+                0x6f, 0x61, 0x64, 0x3d, 0x22, 0x6f, 0x6e, 0x42, 0x6f, 0x64, 0x79, 0x4c, 0x6f, 0x61, 0x64, 0x65, 0x64, 0x28, 0x29, 0x22,
+                0x20, 0x71, 0x00, 0x20, 0x3d, 0x22, 0x80, 0x08, 0xf0, 0x01, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c,
+                0x6f, 0x72, 0x3a, 0x23, 0x32, 0x30, 0x02, 0x00, 0x32, 0x3b, 0x22, 0x3e, 0x5d, 0x00, 0x24, 0x6e, 0x6f, 0x5e, 0x00, 0x02,
+                0x74, 0x00, 0xe2, 0x3c, 0x70, 0x3e, 0x45, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6a, 0x61, 0x76, 0x61, 0x1c, 0x00, 0x00,
+                0x39, 0x04, 0xa0, 0x73, 0x65, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x72, 0x74, 0xa5, 0x03, 0x10, 0x74, 0x3a, 0x01, 0x63,
+                0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x48, 0x00, 0x16, 0x2f, 0x49, 0x00, 0x02, 0x11, 0x00, 0x35, 0x64, 0x69, 0x76, 0x54,
+                0x00, 0x50, 0x64, 0x69, 0x76, 0x20, 0x63, 0x66, 0x01, 0x50, 0x3d, 0x22, 0x74, 0x69, 0x74, 0x30, 0x02, 0x23, 0x65, 0x61,
+                0x81, 0x00, 0x0f, 0x20, 0x00, 0x02, 0x37, 0x62, 0x61, 0x72, 0x1f, 0x00, 0xf0, 0x0a, 0x20, 0x20, 0x3c, 0x69, 0x6d, 0x67,
+                0x20, 0x73, 0x72, 0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x64, 0x65, 0x76, 0x65, 0x6c, 0x2b,
+                0x62, 0xf0, 0x0d, 0x2e, 0x6e, 0x76, 0x69, 0x64, 0x69, 0x61, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x73, 0x69, 0x74, 0x65, 0x73,
+                0x2f, 0x61, 0x6c, 0x6c, 0x2f, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x73, 0x26, 0x00, 0x92, 0x7a, 0x6f, 0x6e, 0x65, 0x5f, 0x6e,
+                0x65, 0x77, 0x2f, 0x28, 0x00, 0xb9, 0x5f, 0x6c, 0x6f, 0x67, 0x6f, 0x2e, 0x70, 0x6e, 0x67, 0x22, 0x2f, 0x61, 0x00, 0x00,
+                0xca, 0x00, 0x09, 0x83, 0x00, 0x46, 0x22, 0x20, 0x69, 0x64, 0x8e, 0x00, 0x01, 0xa8, 0x0a, 0xf1, 0x0d, 0x22, 0x3e, 0x4e,
+                0x73, 0x69, 0x67, 0x68, 0x74, 0x20, 0x50, 0x65, 0x72, 0x66, 0x20, 0x53, 0x44, 0x4b, 0x20, 0x50, 0x72, 0x6f, 0x66, 0x69,
+                0x6c, 0x65, 0x72, 0x20, 0x52, 0x1a, 0x01, 0x08, 0x11, 0x01, 0x02, 0x15, 0x01, 0x07, 0x05, 0x01, 0x0a, 0xe7, 0x00, 0xfa,
+                0x00, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0xee, 0x00, 0x01, 0x8d,
+                0x00, 0x0f, 0xc1, 0x01, 0x05, 0x31, 0x20, 0x23, 0x35, 0x01, 0x00, 0x04, 0xc2, 0x01, 0x05, 0x36, 0x00, 0x50, 0x6c, 0x61,
+                0x62, 0x65, 0x6c, 0xa7, 0x02, 0xb0, 0x3d, 0x22, 0x73, 0x68, 0x6f, 0x77, 0x2d, 0x77, 0x6f, 0x72, 0x6b, 0x1c, 0xb0, 0x83,
+                0x22, 0x3e, 0x53, 0x68, 0x6f, 0x77, 0x20, 0x57, 0x0f, 0x00, 0x31, 0x3a, 0x3c, 0x2f, 0x2a, 0x00, 0x0b, 0x3e, 0x00, 0x01,
+                0xdc, 0xb3, 0x01, 0xf4, 0x00, 0x0a, 0x3d, 0x00, 0x10, 0x20, 0xed, 0xb4, 0xc1, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b,
+                0x62, 0x6f, 0x78, 0x22, 0x20, 0x0a, 0x00, 0xa0, 0x65, 0x64, 0x20, 0x6f, 0x6e, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x7a, 0x02,
+                0x10, 0x43, 0x09, 0x00, 0x10, 0x5f, 0x66, 0x00, 0x04, 0x65, 0x00, 0x2b, 0x28, 0x29, 0x60, 0x01, 0x0b, 0x1a, 0x01, 0x0f,
+                0xe5, 0x00, 0x0f, 0x11, 0x33, 0x01, 0x00, 0x0f, 0xe5, 0x00, 0x09, 0xf1, 0x01, 0x6d, 0x6f, 0x62, 0x69, 0x6c, 0x65, 0x2d,
+                0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x22, 0x3e, 0x4d, 0x0f, 0x00, 0x21, 0x20, 0x4c, 0x0f, 0x00, 0x0f, 0xe5, 0x00, 0x0e,
+                0x0a, 0x3d, 0x00, 0x0f, 0xe5, 0x00, 0x17, 0x02, 0x66, 0x00, 0x02, 0x65, 0x00, 0x0f, 0xe5, 0x00, 0x0d, 0x09, 0xff, 0x01,
+                0x03, 0x0d, 0x00, 0x0f, 0x12, 0x03, 0x00, 0x03, 0x6e, 0x04, 0x15, 0x22, 0x1d, 0x00, 0x41, 0x20, 0x20, 0x3c, 0x74, 0x82,
+                0x03, 0x03, 0x1e, 0x01, 0x03, 0x36, 0x04, 0xf2, 0x13, 0x3a, 0x20, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x62, 0x6c,
+                0x6f, 0x63, 0x6b, 0x3b, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c,
+                0x69, 0x64, 0x3b, 0xb4, 0x02, 0x11, 0x44, 0x30, 0x18, 0x30, 0x2d, 0x50, 0x72, 0x1f, 0x03, 0x3b, 0x74, 0x69, 0x65, 0x5d,
+                0x02, 0x12, 0x74, 0x41, 0x04, 0x09, 0x18, 0x01, 0x2a, 0x74, 0x72, 0x11, 0x00, 0x01, 0x27, 0x00, 0x40, 0x20, 0x63, 0x6f,
+                0x6c, 0xd1, 0x00, 0x44, 0x3d, 0x22, 0x32, 0x22, 0xac, 0x00, 0x31, 0x63, 0x61, 0x20, 0x9b, 0x00, 0x62, 0x6e, 0x61, 0x6d,
+                0x65, 0x22, 0x3e, 0x6a, 0x00, 0x00, 0x06, 0x03, 0x03, 0x6a, 0x00, 0x4b, 0x3c, 0x2f, 0x74, 0x68, 0x5b, 0x00, 0x1c, 0x2f,
+                0x5c, 0x00, 0x0f, 0x6d, 0x00, 0x05, 0x02, 0x61, 0x00, 0x40, 0x6c, 0x61, 0x22, 0x3e, 0x8b, 0x05, 0x0e, 0x4a, 0x00, 0x0d,
+                0x27, 0x00, 0x4f, 0x56, 0x61, 0x6c, 0x75, 0x28, 0x00, 0x00, 0x0c, 0x72, 0x00, 0x00, 0x22, 0x00, 0x0b, 0xf2, 0x00, 0x11,
+                0x3c, 0x59, 0x06, 0x02, 0xe1, 0x03, 0x01, 0x63, 0x06, 0x03, 0x63, 0x19, 0x00, 0x5a, 0xb7, 0x0f, 0x33, 0x01, 0x01, 0x11,
+                0x2f, 0x26, 0x00, 0x08, 0xd9, 0x01, 0x01, 0x05, 0x01, 0x0f, 0xb1, 0x01, 0x3c, 0x10, 0x43, 0x26, 0x00, 0x0f, 0xad, 0x01,
+                0x2f, 0x1f, 0x35, 0xad, 0x01, 0x0b, 0x02, 0x66, 0x00, 0x9f, 0x20, 0x4d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x64, 0xb2,
+                0x01, 0x56, 0xef, 0x72, 0x61, 0x22, 0x3e, 0x45, 0x6c, 0x61, 0x70, 0x73, 0x65, 0x64, 0x20, 0x54, 0x69, 0x2f, 0x00, 0x12,
+                0x00, 0x27, 0x00, 0x40, 0x20, 0x55, 0x6e, 0x69, 0x6a, 0x06, 0x0f, 0x2d, 0x00, 0x0e, 0x61, 0x41, 0x76, 0x67, 0x2e, 0x20,
+                0x46, 0xb4, 0x0f, 0x3f, 0x6e, 0x63, 0x79, 0x31, 0x00, 0x10, 0x00, 0x2c, 0x00, 0x0f, 0x5e, 0x00, 0x05, 0x0f, 0x44, 0x02,
+                0x28, 0x1f, 0x63, 0xc6, 0x01, 0x00, 0x0f, 0x40, 0x02, 0x0d, 0x0f, 0x1c, 0x04, 0x1b, 0x0e, 0x1f, 0x00, 0x12, 0x5f, 0xb2,
+                0x06, 0xa3, 0x3e, 0x4f, 0x76, 0x65, 0x72, 0x76, 0x69, 0x65, 0x77, 0x20, 0x76, 0x08, 0x0a, 0x58, 0x00, 0x0a, 0x3b, 0x00,
+                0x06, 0x1e, 0x06, 0x50, 0x54, 0x6f, 0x70, 0x2d, 0x4c, 0x4f, 0x07, 0xc2, 0x20, 0x53, 0x74, 0x61, 0x74, 0x73, 0x3a, 0x0a,
+                0x54, 0x68, 0x69, 0x73, 0x3a, 0x02, 0x97, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x54, 0x6f, 0x70, 0x20, 0xaf, 0x09, 0x70, 0x20,
+                0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x1c, 0x00, 0x24, 0x20, 0x6f, 0x71, 0x00, 0x21, 0x6f, 0x66, 0x5a, 0x0c, 0x00, 0x47,
+                0x05, 0x00, 0x0c, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x97, 0x08, 0x14, 0x20, 0x3d, 0x10, 0xf1, 0x01, 0x2e, 0x0a, 0x49, 0x66,
+                0x20, 0x47, 0x52, 0x20, 0x45, 0x6e, 0x67, 0x69, 0x6e, 0x65, 0x20, 0x41, 0xce, 0x10, 0xe0, 0x25, 0x20, 0x69, 0x73, 0x20,
+                0x6e, 0x6f, 0x74, 0x20, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x65, 0x08, 0x40, 0x31, 0x30, 0x30, 0x25, 0x1f, 0x0c, 0x70, 0x65,
+                0x20, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x00, 0xf1, 0x02, 0x6c, 0x69, 0x6b, 0x65, 0x6c, 0x79, 0x20, 0x73, 0x74, 0x61,
+                0x72, 0x76, 0x65, 0x64, 0x20, 0x62, 0x79, 0x1f, 0x00, 0xf0, 0x00, 0x43, 0x50, 0x55, 0x3b, 0x20, 0x75, 0x73, 0x65, 0x20,
+                0x61, 0x20, 0x74, 0x72, 0x61, 0x63, 0x3d, 0x00, 0x20, 0x6f, 0x6c, 0x42, 0x00, 0x20, 0x69, 0x6d, 0x9f, 0x00, 0x00, 0xfb,
+                0x0c, 0x90, 0x61, 0x74, 0x2c, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0xb8, 0x08, 0x70, 0x74, 0x75, 0x72, 0x6e, 0x69, 0x6e,
+                0x67, 0x22, 0x00, 0x51, 0x6c, 0x6f, 0x77, 0x2d, 0x6c, 0xef, 0x00, 0x30, 0x47, 0x50, 0x55, 0xcd, 0x00, 0x8d, 0x66, 0x69,
+                0x6c, 0x69, 0x6e, 0x67, 0x2e, 0x0a, 0x2e, 0x01, 0x0f, 0xd4, 0x03, 0x29, 0x05, 0x55, 0x01, 0x11, 0x2d, 0x55, 0x01, 0x0f,
+                0xd6, 0x03, 0x2e, 0x1f, 0x33, 0xd6, 0x03, 0x04, 0x0b, 0xbd, 0x01, 0x0f, 0xf8, 0x02, 0x06, 0x0f, 0xcb, 0x05, 0x01, 0xbf,
+                0x22, 0x3e, 0x25, 0x2d, 0x6f, 0x66, 0x2d, 0x50, 0x65, 0x61, 0x6b, 0x38, 0x00, 0x0e, 0x19, 0x31, 0x38, 0x00, 0x0f, 0x36,
+                0x04, 0x33, 0x7f, 0x43, 0x61, 0x74, 0x65, 0x67, 0x6f, 0x72, 0xad, 0x03, 0x0d, 0x0f, 0x61, 0x04, 0x18, 0x0f, 0x13, 0x06,
+                0x04, 0x0d, 0x28, 0x00, 0x1f, 0x25, 0x24, 0x00, 0x0c, 0x96, 0x62, 0x61, 0x73, 0x65, 0x22, 0x3e, 0xe2, 0x94, 0x82, 0x03,
+                0x00, 0x2f, 0x96, 0x8c, 0x0f, 0x00, 0x1a, 0x0f, 0xd4, 0x00, 0x10, 0x22, 0x44, 0x65, 0x31, 0x0b, 0x01, 0xa9, 0x03, 0x0f,
+                0x82, 0x04, 0x31, 0x41, 0x74, 0x6f, 0x70, 0x5f, 0xda, 0x02, 0x00, 0xe0, 0x14, 0x0c, 0x74, 0x02, 0x0f, 0xc4, 0x06, 0x10,
+                0x30, 0x62, 0x72, 0x20, 0x55, 0x02, 0x21, 0x3d, 0x22, 0x1a, 0x00, 0x8f, 0x5f, 0x73, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67,
+                0x7c, 0x04, 0x05, 0x09, 0x41, 0x04, 0x08, 0x21, 0x04, 0x71, 0x3a, 0x0a, 0x4f, 0x62, 0x73, 0x65, 0x72, 0x85, 0x03, 0xb0,
+                0x65, 0x20, 0x6d, 0x6f, 0x73, 0x74, 0x20, 0x75, 0x74, 0x69, 0x6c, 0x17, 0x12, 0xa0, 0x20, 0x68, 0x61, 0x72, 0x64, 0x77,
+                0x61, 0x72, 0x65, 0x20, 0xd0, 0x1e, 0x21, 0x73, 0x2c, 0x60, 0x04, 0x60, 0x6e, 0x61, 0x76, 0x69, 0x67, 0x61, 0xaf, 0x10,
+                0x01, 0x9f, 0x10, 0xd0, 0x69, 0x72, 0x20, 0x63, 0x6f, 0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0xb4, 0x03, 0x03,
+                0xe5, 0x04, 0x10, 0x73, 0xf6, 0x09, 0x20, 0x20, 0x6d, 0xd0, 0x03, 0xb0, 0x64, 0x65, 0x74, 0x61, 0x69, 0x6c, 0x73, 0x2e,
+                0x20, 0x20, 0x54, 0x2b, 0x04, 0x40, 0x6f, 0x77, 0x73, 0x20, 0x54, 0x00, 0x71, 0x73, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x3b,
+                0x77, 0x00, 0x50, 0x66, 0x69, 0x72, 0x73, 0x74, 0x1b, 0x00, 0xb1, 0x20, 0x61, 0x6c, 0x77, 0x61, 0x79, 0x73, 0x20, 0x68,
+                0x61, 0x73, 0x19, 0x00, 0x40, 0x68, 0x69, 0x67, 0x68, 0x11, 0x11, 0x02, 0x93, 0x00, 0x01, 0x36, 0x11, 0x01, 0x9d, 0x04,
+                0x31, 0x61, 0x6c, 0x6c, 0x95, 0x00, 0x09, 0xda, 0x10, 0x00, 0x56, 0x00, 0x30, 0x6c, 0x65, 0x73, 0x3a, 0x00, 0x40, 0x61,
+                0x6e, 0x20, 0x36, 0x9d, 0x04, 0x01, 0x1a, 0x0a, 0x40, 0x20, 0x77, 0x68, 0x65, 0xf1, 0x2b, 0x0a, 0xab, 0x04, 0x01, 0xa4,
+                0x04, 0x01, 0x52, 0x00, 0x20, 0x2d, 0x6c, 0xa6, 0xc5, 0xfd, 0x03, 0x65, 0x64, 0x20, 0x28, 0x6c, 0x6f, 0x77, 0x20, 0x3c,
+                0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x23, 0x16, 0x04, 0x0d, 0x13, 0x05, 0x51, 0x3c, 0x2f, 0x61, 0x3e, 0x29,
+                0x91, 0x00, 0x00, 0x19, 0x05, 0x0e, 0x52, 0x00, 0x00, 0x87, 0x18, 0x52, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0xe3, 0x04, 0x01,
+                0x81, 0x00, 0x05, 0x6e, 0x05, 0x00, 0x2f, 0x05, 0x02, 0x73, 0x13, 0x04, 0x2f, 0x00, 0x92, 0x2e, 0x20, 0x20, 0x49, 0x6e,
+                0x76, 0x65, 0x73, 0x74, 0x62, 0x01, 0x06, 0x8a, 0x00, 0x32, 0x4c, 0x32, 0x2d, 0x8b, 0x1e, 0x13, 0x2d, 0x8c, 0x1e, 0x42,
+                0x2d, 0x42, 0x79, 0x2d, 0xcc, 0x70, 0x14, 0x2d, 0xcd, 0x70, 0x20, 0x2d, 0x53, 0xb5, 0xd4, 0x41, 0x22, 0x3e, 0x4c, 0x32,
+                0x51, 0x06, 0x33, 0x6f, 0x72, 0x20, 0x2c, 0x00, 0x00, 0xa5, 0x00, 0x01, 0xbb, 0x01, 0x06, 0x50, 0x00, 0x30, 0x53, 0x4d,
+                0x2d, 0x00, 0xd1, 0x11, 0x2d, 0x01, 0xd1, 0x00, 0xde, 0x00, 0x41, 0x6c, 0x6c, 0x2d, 0x52, 0xd4, 0xe1, 0x60, 0x73, 0x22,
+                0x3e, 0x53, 0x4d, 0x20, 0x1d, 0x00, 0x11, 0x20, 0x1d, 0x00, 0x00, 0xa9, 0x04, 0x33, 0x6c, 0x6c, 0x20, 0x1d, 0x00, 0x01,
+                0x4b, 0x00, 0x00, 0xd9, 0x01, 0x15, 0x61, 0x6e, 0x12, 0x6f, 0x20, 0x63, 0x6c, 0x75, 0x65, 0x73, 0x90, 0x05, 0x40, 0x07,
+                0xa4, 0x02, 0x0f, 0x13, 0x0b, 0x38, 0x1c, 0x6c, 0x90, 0x05, 0x08, 0x0c, 0x03, 0x0f, 0x90, 0x05, 0x37, 0x0f, 0x61, 0x05,
+                0x4c, 0x06, 0xb4, 0x00, 0x1f, 0x20, 0x6c, 0x05, 0x14, 0x0f, 0x44, 0x05, 0x61, 0x0f, 0x16, 0x05, 0x25, 0x07, 0xd4, 0x03,
+                0x0f, 0x16, 0x05, 0x56, 0xb0, 0x43, 0x61, 0x63, 0x68, 0x65, 0x20, 0x48, 0x69, 0x74, 0x2d, 0x52, 0x83, 0x15, 0x32, 0x3a,
+                0x0a, 0x42, 0x8d, 0x08, 0x00, 0xe3, 0x14, 0x30, 0x69, 0x64, 0x65, 0x53, 0x16, 0x21, 0x20, 0x63, 0x24, 0x00, 0x50, 0x68,
+                0x69, 0x74, 0x2d, 0x72, 0x24, 0x00, 0x00, 0x02, 0x05, 0x10, 0x62, 0xd4, 0x08, 0x83, 0x70, 0x72, 0x6f, 0x62, 0x6c, 0x65,
+                0x6d, 0x2c, 0xc7, 0x04, 0x60, 0x64, 0x65, 0x74, 0x65, 0x72, 0x6d, 0x26, 0x04, 0x12, 0x69, 0x68, 0x09, 0x0a, 0x21, 0x05,
+                0x0b, 0xb7, 0x04, 0x00, 0x07, 0x04, 0x00, 0xe6, 0x04, 0x45, 0x2c, 0x20, 0x6f, 0x72, 0x31, 0x00, 0x01, 0x69, 0x00, 0x52,
+                0x69, 0x73, 0x20, 0x61, 0x20, 0x6e, 0xee, 0x00, 0xa6, 0x09, 0x0f, 0xbe, 0x03, 0x14, 0x00, 0xcb, 0x17, 0x00, 0x8a, 0x04,
+                0x32, 0x6c, 0x6c, 0x20, 0x8d, 0x1a, 0x3f, 0x3c, 0x61, 0x3e, 0x9e, 0x03, 0x3c, 0x01, 0x2c, 0x01, 0x15, 0x2d, 0x2c, 0x01,
+                0x0f, 0xb1, 0x0e, 0x46, 0x0b, 0x94, 0x01, 0x0f, 0x9e, 0x03, 0x1c, 0x05, 0x38, 0x00, 0x0f, 0xfb, 0x02, 0x00, 0x0f, 0x9f,
+                0x03, 0x21, 0x02, 0x6f, 0x05, 0x5f, 0x20, 0x53, 0x70, 0x61, 0x63, 0x8c, 0x00, 0x08, 0x0f, 0x05, 0x09, 0x1e, 0x6f, 0x41,
+                0x6c, 0x6c, 0x20, 0x4f, 0x70, 0xa5, 0x00, 0x01, 0x0f, 0xa0, 0x03, 0x82, 0x01, 0x9b, 0x02, 0x00, 0x06, 0x1f, 0x00, 0x76,
+                0x16, 0x0f, 0x7a, 0x0f, 0x20, 0x0f, 0xa0, 0x03, 0x0d, 0x0f, 0x5d, 0x0d, 0x35, 0x03, 0xae, 0x01, 0x00, 0xfc, 0x13, 0x7f,
+                0x6f, 0x72, 0x6d, 0x61, 0x6e, 0x63, 0x65, 0x67, 0x0d, 0x1b, 0x53, 0x4d, 0x61, 0x69, 0x6e, 0x20, 0x45, 0x00, 0x06, 0x6e,
+                0x05, 0x0a, 0x2d, 0x09, 0x98, 0x62, 0x61, 0x6e, 0x64, 0x77, 0x69, 0x64, 0x74, 0x68, 0x9f, 0x08, 0x60, 0x20, 0x70, 0x65,
+                0x72, 0x20, 0x6d, 0x3e, 0x00, 0x02, 0x9e, 0xc2, 0x10, 0x20, 0x6d, 0xe9, 0x00, 0xb6, 0x08, 0x0f, 0x83, 0x03, 0x3a, 0x00,
+                0x9f, 0x00, 0x04, 0x01, 0x08, 0x06, 0x9f, 0x00, 0x0f, 0xb8, 0x0c, 0x38, 0x0a, 0x28, 0x07, 0x0f, 0x0e, 0x01, 0x03, 0x0f,
+                0x2f, 0x07, 0x21, 0x1f, 0x70, 0x2f, 0x07, 0x36, 0x0f, 0x60, 0x03, 0x14, 0x10, 0x42, 0x2b, 0xf8, 0x0f, 0x28, 0x00, 0x10,
+                0x21, 0x4d, 0x69, 0x2a, 0x00, 0x4f, 0x2f, 0x53, 0x65, 0x63, 0x4f, 0x07, 0xb8, 0x00, 0x89, 0x02, 0x03, 0x27, 0xc5, 0x0f,
+                0x4b, 0x07, 0x56, 0x0d, 0x81, 0x0a, 0x35, 0x3a, 0x0a, 0x44, 0x13, 0x07, 0x52, 0x77, 0x68, 0x69, 0x63, 0x68, 0x50, 0x0c,
+                0x01, 0x94, 0x0a, 0x05, 0x40, 0x7a, 0x02, 0xbf, 0x0b, 0x51, 0x69, 0x6e, 0x63, 0x75, 0x72, 0x6d, 0x07, 0x05, 0x8e, 0x0c,
+                0x26, 0x4c, 0x32, 0x69, 0x03, 0x02, 0x83, 0x0c, 0x02, 0x44, 0x00, 0x10, 0x64, 0x28, 0x0b, 0x17, 0x6e, 0x3c, 0x00, 0x20,
+                0x62, 0x65, 0x38, 0x00, 0x50, 0x61, 0x64, 0x64, 0x72, 0x65, 0x0d, 0xd5, 0x20, 0x2e, 0x0a, 0x5b, 0x05, 0x01, 0x75, 0x02,
+                0x02, 0x8f, 0x00, 0x30, 0x73, 0x20, 0x76, 0x71, 0x0e, 0x02, 0x2d, 0x00, 0x40, 0x72, 0x65, 0x6c, 0x61, 0xc3, 0x0b, 0x04,
+                0x66, 0x1d, 0x51, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0xbd, 0x0c, 0x00, 0x29, 0x00, 0x41, 0x70, 0x72, 0x6f, 0x63, 0x45, 0x00,
+                0x04, 0xc2, 0x10, 0x22, 0x4c, 0x32, 0x95, 0x07, 0x20, 0x2e, 0x0a, 0xc4, 0x0c, 0x00, 0xcd, 0x00, 0x11, 0x20, 0x72, 0x04,
+                0x50, 0x6f, 0x72, 0x22, 0x20, 0x72, 0x4d, 0x1b, 0x01, 0x0e, 0x08, 0x50, 0x61, 0x20, 0x33, 0x32, 0x20, 0x9c, 0xfa, 0x10,
+                0x20, 0x60, 0x18, 0x03, 0x76, 0x1a, 0x12, 0x61, 0x3a, 0x00, 0x00, 0xd6, 0x03, 0x37, 0x2e, 0x0a, 0x20, 0xae, 0x11, 0x20,
+                0x64, 0x65, 0xc7, 0xed, 0x49, 0x6f, 0x73, 0x65, 0x73, 0xe4, 0x00, 0x00, 0x49, 0x00, 0x2a, 0x65, 0x61, 0xe1, 0x00, 0x11,
+                0x2c, 0x56, 0x04, 0x05, 0x2c, 0x01, 0x3f, 0x2e, 0x20, 0x41, 0x1d, 0x0c, 0x1c, 0x27, 0x22, 0x3e, 0x8b, 0x0d, 0x73, 0x65,
+                0x64, 0x20, 0x76, 0x65, 0x72, 0x73, 0xa0, 0x00, 0x15, 0x74, 0x92, 0x00, 0x01, 0xde, 0x0b, 0x30, 0x63, 0x61, 0x6e, 0xd6,
+                0x08, 0x10, 0x66, 0xdf, 0x17, 0x7f, 0x20, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x2e, 0xba, 0x04, 0x3a, 0x0f, 0xcb, 0x0c, 0x19,
+                0x0f, 0xf6, 0x0b, 0x44, 0x0d, 0xa1, 0x02, 0x00, 0xe6, 0x01, 0x03, 0xde, 0x04, 0x04, 0x83, 0x00, 0x0f, 0xdc, 0x04, 0x21,
+                0x03, 0x67, 0x02, 0x0f, 0x3b, 0x00, 0x1c, 0x2f, 0x4f, 0x70, 0x6c, 0x00, 0x2e, 0x0f, 0x4c, 0x05, 0x2e, 0x23, 0x54, 0x6f,
+                0x00, 0x01, 0x0f, 0xfb, 0x04, 0x10, 0x04, 0x58, 0x09, 0x0f, 0x03, 0x05, 0x0d, 0x01, 0xab, 0x00, 0x0f, 0xba, 0x11, 0x71,
+                0x0f, 0x61, 0x01, 0x08, 0x0f, 0xd6, 0x00, 0x97, 0x0f, 0xfd, 0x05, 0x21, 0x0f, 0x34, 0xcb, 0x11, 0x02, 0xeb, 0xe4, 0x0f,
+                0x1c, 0x06, 0x56, 0x0f, 0x00, 0x05, 0x11, 0x42, 0x66, 0x72, 0x6f, 0x6d, 0x02, 0x05, 0x03, 0xfd, 0x0c, 0x00, 0x2e, 0x06,
+                0x1f, 0x2c, 0x17, 0x05, 0x12, 0x90, 0x53, 0x65, 0x65, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x3a, 0xb5, 0x05, 0x00, 0xa5, 0x16,
+                0x00, 0x69, 0x00, 0x01, 0x10, 0x12, 0x80, 0x74, 0x20, 0x70, 0x72, 0x69, 0x6f, 0x72, 0x69, 0xf0, 0x24, 0x0f, 0x3c, 0x05,
+                0x1e, 0x07, 0x73, 0x00, 0x0e, 0x28, 0x04, 0x0d, 0x5d, 0x11, 0x0f, 0x54, 0x00, 0x02, 0x05, 0x32, 0x30, 0x00, 0x90, 0x02,
+                0x03, 0x0b, 0x00, 0x00, 0x3c, 0x00, 0x0f, 0x5d, 0x05, 0x50, 0x11, 0x53, 0x46, 0x01, 0x0f, 0x4e, 0x05, 0x5b, 0x02, 0x74,
+                0x00, 0x15, 0x20, 0x33, 0x31, 0x0f, 0x4f, 0x05, 0x57, 0x00, 0x24, 0x1a, 0x0f, 0x78, 0x00, 0x38, 0x0f, 0x3c, 0x00, 0x17,
+                0x0f, 0x41, 0x06, 0x3d, 0x0f, 0x42, 0x06, 0x9b, 0x10, 0x46, 0xb5, 0x03, 0x02, 0xf6, 0x01, 0x0f, 0x44, 0x06, 0xc1, 0x01,
+                0xdf, 0x00, 0x00, 0x5b, 0x02, 0x0f, 0xdd, 0x00, 0xc1, 0x0f, 0xfe, 0x07, 0xff, 0xd9, 0x02, 0x52, 0x07, 0x0f, 0x0b, 0x0e,
+                0x57, 0x49, 0x31, 0x54, 0x45, 0x58, 0x40, 0x11, 0x0c, 0x0a, 0x0e, 0x41, 0x73, 0x74, 0x61, 0x67, 0xdf, 0x14, 0x01, 0x66,
+                0x0d, 0x01, 0x2f, 0x00, 0x01, 0xf7, 0x13, 0x30, 0x27, 0x73, 0x20, 0x85, 0x30, 0x00, 0xf5, 0x06, 0x02, 0x58, 0x1e, 0x00,
+                0x48, 0xdf, 0x20, 0x6e, 0x67, 0xf1, 0x07, 0x04, 0xd1, 0x11, 0x02, 0x8c, 0x0d, 0x32, 0x4c, 0x53, 0x55, 0xf8, 0x1e, 0x21,
+                0x45, 0x58, 0x32, 0x00, 0x14, 0x73, 0xc6, 0x1e, 0x70, 0x20, 0x69, 0x6e, 0x20, 0x70, 0x61, 0x72, 0x3b, 0x30, 0x31, 0x6c,
+                0x2e, 0x20, 0x28, 0x00, 0x40, 0x68, 0x61, 0x6e, 0x64, 0x10, 0x08, 0x00, 0xb1, 0xfa, 0x32, 0x6c, 0x2c, 0x20, 0xd6, 0x25,
+                0x23, 0x2c, 0x20, 0x05, 0x31, 0x63, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0xe7, 0x1a, 0x02, 0x76, 0x31, 0x03, 0xc4, 0x11,
+                0x11, 0x3b, 0x13, 0x00, 0x00, 0xb3, 0xee, 0xa7, 0x65, 0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x20, 0x9c, 0xee,
+                0x01, 0xdb, 0x1a, 0x25, 0x45, 0x58, 0x5f, 0x00, 0x03, 0x26, 0x31, 0x02, 0x48, 0x00, 0x03, 0x5c, 0x00, 0x01, 0x6a, 0xd9,
+                0x0f, 0x05, 0x12, 0x3c, 0x01, 0x2f, 0x01, 0x0f, 0xff, 0x11, 0x31, 0x0f, 0xd7, 0x07, 0x00, 0x08, 0x4c, 0x1e, 0x0d, 0xc7,
+                0x01, 0x0f, 0x26, 0x03, 0x0f, 0x08, 0x7a, 0x06, 0x10, 0x3e, 0x7b, 0x01, 0x0f, 0xbc, 0x1e, 0x0f, 0x0f, 0x3c, 0x00, 0x03,
+                0x00, 0x79, 0x00, 0x0f, 0x68, 0x19, 0x3c, 0x31, 0x50, 0x69, 0x70, 0xd7, 0x1a, 0x1f, 0x67, 0x7c, 0x1e, 0x92, 0x0f, 0x61,
+                0x00, 0x4e, 0x0f, 0xe6, 0x00, 0x04, 0x0f, 0x73, 0x04, 0x22, 0x0b, 0xc6, 0x2d, 0x0f, 0x68, 0x04, 0x5c, 0x0f, 0x76, 0x12,
+                0x0d, 0x02, 0xdf, 0xdc, 0x04, 0x98, 0x15, 0x00, 0x5d, 0x00, 0x00, 0x0d, 0x12, 0x0f, 0x85, 0x12, 0x13, 0x01, 0x61, 0x00,
+                0x02, 0x50, 0x05, 0x06, 0xab, 0x0c, 0x20, 0x2e, 0x0a, 0x39, 0x06, 0x02, 0x0d, 0x1a, 0x00, 0x39, 0x00, 0x50, 0x63, 0x61,
+                0x6c, 0x63, 0x75, 0xd4, 0x1d, 0x11, 0x64, 0x99, 0x0c, 0x00, 0x8f, 0x04, 0x12, 0x2f, 0x6e, 0x00, 0x84, 0x2f, 0x6f, 0x70,
+                0x20, 0x63, 0x6f, 0x6d, 0x62, 0x46, 0x0c, 0x92, 0x28, 0x62, 0x6f, 0x74, 0x68, 0x20, 0x6e, 0x75, 0x6d, 0x33, 0x2f, 0x01,
+                0x86, 0x00, 0x50, 0x64, 0x65, 0x6e, 0x6f, 0x6d, 0x21, 0x00, 0x00, 0x10, 0x00, 0x00, 0x21, 0x1f, 0x40, 0x70, 0x65, 0x63,
+                0x69, 0x50, 0x0b, 0x03, 0xa3, 0x12, 0x0a, 0x4f, 0x00, 0x10, 0x29, 0xd4, 0x04, 0x27, 0x6f, 0x77, 0x8f, 0x1a, 0x00, 0x34,
+                0x00, 0x46, 0x6f, 0x6e, 0x6c, 0x79, 0x92, 0x1a, 0x0f, 0x81, 0x1a, 0x03, 0x09, 0x13, 0x13, 0x03, 0x7e, 0x1a, 0x33, 0x2e,
+                0x0a, 0x54, 0xb5, 0x04, 0x03, 0x2d, 0x06, 0x00, 0x19, 0x00, 0x05, 0xa1, 0x0d, 0x10, 0x64, 0x4c, 0x05, 0x40, 0x74, 0x77,
+                0x6f, 0x20, 0x9c, 0x1f, 0x10, 0x3a, 0xe0, 0x0b, 0x02, 0x87, 0x00, 0x02, 0x2b, 0x05, 0x25, 0x62, 0x79, 0xe6, 0x04, 0x01,
+                0x9b, 0x05, 0x1f, 0x74, 0x7a, 0x13, 0x3b, 0x01, 0x7a, 0x01, 0x02, 0x7d, 0x13, 0x02, 0x42, 0x20, 0x30, 0x73, 0x75, 0x6d,
+                0x31, 0x06, 0x10, 0x22, 0x57, 0x04, 0x02, 0xb9, 0x11, 0x11, 0x22, 0x88, 0x00, 0x10, 0x22, 0x29, 0x00, 0x04, 0x11, 0x00,
+                0x40, 0x77, 0x69, 0x6c, 0x6c, 0x0c, 0x14, 0x34, 0x20, 0x75, 0x70, 0xab, 0x24, 0x00, 0xc5, 0x00, 0x01, 0x42, 0x0e, 0x5f,
+                0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x92, 0x17, 0x3d, 0x02, 0x8d, 0x05, 0x0a, 0x7e, 0x0d, 0x0f, 0x74, 0x0d, 0x2e, 0x1f, 0x34,
+                0x74, 0x0d, 0x05, 0x0f, 0xf0, 0x02, 0x00, 0x0f, 0x04, 0x0c, 0x0e, 0x06, 0x4d, 0x00, 0x00, 0xc7, 0x08, 0x33, 0x50, 0x65,
+                0x72, 0xe9, 0x0e, 0x02, 0xd3, 0x1a, 0x02, 0xb0, 0x01, 0x10, 0x54, 0x8d, 0x01, 0x0f, 0x4a, 0x00, 0x20, 0x22, 0x4f, 0x70,
+                0x40, 0x00, 0x01, 0xcd, 0x01, 0x0f, 0xa7, 0x05, 0x38, 0x0f, 0xc9, 0x0d, 0x0f, 0x0f, 0xc5, 0x09, 0x1f, 0x00, 0x5d, 0x00,
+                0x0f, 0x61, 0x0e, 0x12, 0x0f, 0xa6, 0x0a, 0x58, 0x08, 0x8a, 0x01, 0x0f, 0xeb, 0x00, 0xcc, 0x0f, 0x91, 0x0b, 0x3a, 0x0f,
+                0xe1, 0x00, 0x70, 0x0f, 0x29, 0x07, 0x28, 0x0f, 0x26, 0x04, 0x01, 0x0f, 0x44, 0x1d, 0x78, 0x12, 0x53, 0x30, 0x07, 0x0f,
+                0x44, 0x1d, 0x26, 0x46, 0x53, 0x4d, 0x20, 0x49, 0x26, 0x0b, 0x0f, 0x07, 0x0c, 0x0b, 0x02, 0x6b, 0x00, 0x04, 0xf3, 0x0b,
+                0x03, 0xcc, 0x25, 0x0f, 0xf5, 0x0b, 0x00, 0x02, 0x73, 0x06, 0x0f, 0x79, 0x26, 0x02, 0x02, 0x43, 0x00, 0x09, 0x98, 0x0b,
+                0x30, 0x0a, 0x53, 0x69, 0xb6, 0x00, 0x00, 0x0d, 0x21, 0x06, 0x5b, 0x00, 0x0f, 0x20, 0x0c, 0x00, 0x31, 0x2c, 0x20, 0x69,
+                0x89, 0x21, 0x40, 0x70, 0x6f, 0x73, 0x73, 0x1e, 0x3b, 0x02, 0xbd, 0x26, 0x62, 0x75, 0x6c, 0x74, 0x69, 0x70, 0x6c, 0x79,
+                0x07, 0x02, 0x3b, 0x00, 0x20, 0x74, 0x6f, 0xc9, 0x0b, 0x22, 0x63, 0x68, 0x50, 0x06, 0x20, 0x73, 0x69, 0x23, 0x00, 0x02,
+                0x10, 0x0c, 0x2f, 0x6c, 0x79, 0x50, 0x06, 0x3c, 0x37, 0x53, 0x4d, 0x2d, 0x3d, 0x01, 0x0f, 0xe5, 0x1d, 0x39, 0x0f, 0xc9,
+                0x13, 0x05, 0x0f, 0xaf, 0x01, 0x06, 0x0f, 0x6f, 0x2a, 0x1c, 0x00, 0xa9, 0x2b, 0x0f, 0x48, 0x06, 0x13, 0x0a, 0x96, 0x12,
+                0x6f, 0x70, 0x65, 0x72, 0x2d, 0x53, 0x4d, 0x84, 0x25, 0x6b, 0x0f, 0xe6, 0x29, 0x0a, 0x0f, 0xa3, 0x06, 0x02, 0x00, 0xcc,
+                0x01, 0x0f, 0x2b, 0x00, 0x10, 0x02, 0x52, 0x27, 0x2f, 0x6e, 0x73, 0x41, 0x12, 0x11, 0x3f, 0x49, 0x50, 0x43, 0x26, 0x00,
+                0x10, 0x8f, 0x26, 0x23, 0x78, 0x32, 0x35, 0x43, 0x32, 0x3b, 0x55, 0x0d, 0x10, 0x0f, 0xb2, 0x1e, 0x99, 0x2f, 0x73, 0x6d,
+                0x41, 0x0c, 0x61, 0x0b, 0xfc, 0x02, 0x11, 0x45, 0x23, 0x04, 0x39, 0x69, 0x6f, 0x6e, 0x5f, 0x2f, 0x03, 0xc2, 0x03, 0x1f,
+                0x73, 0x6b, 0x04, 0x00, 0x02, 0x6f, 0x42, 0x32, 0x73, 0x20, 0x28, 0xce, 0x0a, 0x00, 0xa4, 0x04, 0x00, 0xcf, 0x02, 0x04,
+                0x3a, 0x04, 0x04, 0xad, 0x0b, 0x02, 0x37, 0x2a, 0x00, 0x5b, 0x03, 0x40, 0x65, 0x61, 0x64, 0x25, 0xff, 0x2e, 0x20, 0x6c,
+                0x69, 0x92, 0x04, 0x11, 0x69, 0x9f, 0x2a, 0xa0, 0x68, 0x65, 0x61, 0x76, 0x79, 0x20, 0x62, 0x72, 0x61, 0x6e, 0xe7, 0x18,
+                0x50, 0x69, 0x76, 0x65, 0x72, 0x67, 0xa4, 0x39, 0x10, 0x20, 0xe8, 0x3c, 0x00, 0x3f, 0x10, 0x42, 0x20, 0x74, 0x61, 0x6b,
+                0x63, 0x2b, 0x00, 0xb8, 0x04, 0x00, 0xc2, 0x04, 0x50, 0x66, 0x2f, 0x65, 0x6c, 0x73, 0xe0, 0x0b, 0x10, 0x64, 0x45, 0x3c,
+                0x41, 0x74, 0x68, 0x73, 0x29, 0x47, 0x26, 0x00, 0xc7, 0x2a, 0x40, 0x6e, 0x75, 0x6d, 0x62, 0x97, 0x1e, 0x34, 0x6f, 0x66,
+                0x20, 0x77, 0x40, 0x00, 0x76, 0x26, 0x01, 0x48, 0x00, 0x00, 0x9d, 0x0c, 0x00, 0x28, 0x26, 0x82, 0x2e, 0x0a, 0x43, 0x72,
+                0x6f, 0x73, 0x73, 0x2d, 0x26, 0x2b, 0x02, 0x1e, 0x00, 0x03, 0x2e, 0x00, 0x00, 0x99, 0x11, 0x60, 0x74, 0x69, 0x73, 0x74,
+                0x69, 0x63, 0xeb, 0x10, 0x01, 0x8a, 0x0b, 0x09, 0x81, 0x26, 0x02, 0x1c, 0x06, 0x15, 0x2d, 0x29, 0x01, 0x01, 0x43, 0x01,
+                0x03, 0x31, 0x06, 0x05, 0x15, 0x00, 0x01, 0x1d, 0x19, 0x01, 0x3c, 0x01, 0x0f, 0x1d, 0x05, 0x4b, 0x07, 0x86, 0x00, 0x0f,
+                0x1c, 0x05, 0x53, 0x07, 0xe2, 0x00, 0x0f, 0xae, 0x04, 0x1a, 0x0f, 0x1b, 0x05, 0x25, 0x02, 0x31, 0x02, 0x10, 0x73, 0x8b,
+                0x07, 0x02, 0x9c, 0x2b, 0x8f, 0x28, 0x4d, 0x61, 0x78, 0x20, 0x33, 0x32, 0x29, 0x48, 0x00, 0x1c, 0x33, 0x41, 0x76, 0x67,
+                0xbc, 0x00, 0x25, 0x65, 0x64, 0x4d, 0x00, 0x0f, 0x3a, 0x05, 0xb4, 0x03, 0x18, 0x2b, 0x00, 0xc3, 0x02, 0x0f, 0x2e, 0x00,
+                0x14, 0x00, 0x0e, 0x01, 0x09, 0x92, 0x03, 0x0f, 0xd7, 0x27, 0x11, 0x0a, 0xc3, 0x03, 0x0f, 0xc0, 0x00, 0x59, 0x0f, 0x4e,
+                0x05, 0x24, 0x09, 0x17, 0x44, 0x0f, 0x51, 0x05, 0x59, 0x0c, 0x0e, 0x04, 0x0f, 0xf6, 0x09, 0x06, 0x01, 0x04, 0x16, 0x05,
+                0x98, 0x09, 0x01, 0xde, 0x09, 0x02, 0x76, 0x11, 0x08, 0xcc, 0x09, 0x05, 0xf9, 0x09, 0x0c, 0xcf, 0x04, 0x20, 0x20, 0x65,
+                0x45, 0x0b, 0x10, 0x69, 0x48, 0x2f, 0x23, 0x20, 0x28, 0xc8, 0x01, 0x10, 0x2f, 0x75, 0x01, 0x10, 0x29, 0x21, 0x16, 0x02,
+                0x38, 0x03, 0x14, 0x4c, 0x33, 0x00, 0x07, 0x88, 0x10, 0x00, 0x1c, 0x41, 0x51, 0x76, 0x61, 0x6c, 0x65, 0x6e, 0x31, 0x3d,
+                0x15, 0x22, 0xd4, 0x05, 0x32, 0x76, 0x6f, 0x63, 0x0c, 0x12, 0x14, 0x22, 0xf9, 0x04, 0xb0, 0x44, 0x33, 0x44, 0x2f, 0x47,
+                0x4c, 0x2f, 0x56, 0x75, 0x6c, 0x6b, 0x05, 0x3b, 0x03, 0x97, 0x11, 0x02, 0x25, 0x00, 0x40, 0x2c, 0x20, 0x65, 0x78, 0x81,
+                0xef, 0x01, 0x32, 0x0a, 0x10, 0x50, 0xdd, 0xef, 0x03, 0xf8, 0x00, 0x10, 0x73, 0x76, 0x30, 0x60, 0x72, 0x65, 0x20, 0x68,
+                0x65, 0x6c, 0x6f, 0x05, 0x04, 0x7b, 0x05, 0x00, 0x7a, 0x00, 0x00, 0xa2, 0x1e, 0x03, 0xa0, 0x48, 0x03, 0xa6, 0x24, 0x07,
+                0x97, 0x00, 0x50, 0x70, 0x72, 0x65, 0x73, 0x65, 0x1a, 0x00, 0x31, 0x20, 0x61, 0x73, 0xf4, 0x34, 0x01, 0x52, 0x06, 0x0f,
+                0x3b, 0x16, 0x3d, 0x0f, 0xc2, 0x05, 0x02, 0x0f, 0x3c, 0x05, 0x2c, 0x06, 0x06, 0x0a, 0x0d, 0x3c, 0x05, 0x0e, 0x19, 0x06,
+                0x0f, 0xb7, 0x04, 0x0c, 0x08, 0x41, 0x35, 0x05, 0x89, 0x0c, 0x02, 0xc6, 0x01, 0x25, 0x20, 0x28, 0x46, 0x05, 0x0f, 0xff,
+                0x04, 0x1d, 0x05, 0x8b, 0x03, 0x04, 0x55, 0x02, 0x0f, 0x4c, 0x00, 0x28, 0x06, 0x2f, 0x11, 0x03, 0x8d, 0x2d, 0x0f, 0xb4,
+                0x03, 0x12, 0x0f, 0x4a, 0x05, 0x11, 0x03, 0xee, 0x00, 0x0f, 0xa2, 0x16, 0x11, 0x04, 0x60, 0x04, 0x06, 0xe2, 0x02, 0x0f,
+                0x65, 0x04, 0x16, 0x0f, 0x33, 0x00, 0x21, 0x01, 0x57, 0x03, 0x0f, 0x6c, 0x0a, 0x10, 0x05, 0x68, 0x01, 0x05, 0x6d, 0x06,
+                0x0f, 0xf6, 0x0a, 0x11, 0x3f, 0x6e, 0x73, 0x74, 0x61, 0x00, 0x15, 0x0f, 0xcd, 0x0a, 0x98, 0x03, 0x54, 0xf3, 0x02, 0xdd,
+                0x04, 0x0d, 0x67, 0x03, 0x0f, 0x82, 0x05, 0x4b, 0x23, 0x52, 0x65, 0x42, 0x23, 0x59, 0x55, 0x73, 0x61, 0x67, 0x65, 0xcc,
+                0x0a, 0x62, 0x72, 0x65, 0x76, 0x65, 0x61, 0x6c, 0x65, 0x35, 0x80, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x2c,
+                0x0a, 0x02, 0x78, 0x23, 0x02, 0x82, 0x02, 0x14, 0x72, 0x3f, 0x00, 0x10, 0x75, 0x90, 0x15, 0x33, 0x6f, 0x6e, 0x20, 0xeb,
+                0x54, 0x02, 0x8b, 0x05, 0x00, 0x29, 0x28, 0x00, 0xdd, 0x04, 0x01, 0x99, 0x23, 0x30, 0x78, 0x70, 0x6c, 0x23, 0x2c, 0x00,
+                0x79, 0x0a, 0x01, 0x81, 0x30, 0xcf, 0x6f, 0x63, 0x63, 0x75, 0x70, 0x61, 0x6e, 0x63, 0x79, 0x2e, 0x20, 0x20, 0xe1, 0x04,
+                0x06, 0x02, 0xf1, 0x0d, 0x0f, 0xda, 0x04, 0x3f, 0x04, 0xf7, 0x00, 0x11, 0x2d, 0xf7, 0x00, 0x0f, 0xd8, 0x04, 0x49, 0x0a,
+                0x61, 0x01, 0x0f, 0xd6, 0x04, 0x1d, 0x1f, 0x4d, 0x0c, 0x0a, 0x14, 0x0a, 0x37, 0x00, 0x33, 0x56, 0x54, 0x47, 0x50, 0x05,
+                0x0f, 0x39, 0x00, 0x1c, 0x08, 0x9e, 0x06, 0x0f, 0x3b, 0x00, 0x1c, 0x40, 0x43, 0x6f, 0x6d, 0x70, 0x33, 0x11, 0x0f, 0x3d,
+                0x00, 0x05, 0x0f, 0xe7, 0x04, 0x22, 0x0f, 0x82, 0x1b, 0x14, 0x00, 0x26, 0x02, 0x01, 0xca, 0x32, 0x0f, 0xae, 0x1b, 0x91,
+                0x0f, 0xb1, 0x00, 0xff, 0xf4, 0x0f, 0x2b, 0x06, 0x24, 0x04, 0x70, 0x05, 0x2e, 0x5f, 0x75, 0xb8, 0x04, 0x0f, 0x29, 0x06,
+                0x4b, 0x01, 0xb1, 0x07, 0x20, 0x43, 0x61, 0xaa, 0x4c, 0x03, 0x65, 0x09, 0x03, 0x50, 0x36, 0x0f, 0x34, 0x06, 0x06, 0x01,
+                0xa0, 0x0b, 0x00, 0xb1, 0x10, 0x32, 0x69, 0x6c, 0x79, 0x20, 0x06, 0x0b, 0x35, 0x06, 0x0f, 0x25, 0x06, 0x1a, 0x04, 0xd3,
+                0x3b, 0x07, 0x27, 0x06, 0x42, 0x7a, 0x65, 0x72, 0x6f, 0x5d, 0x40, 0x08, 0x31, 0x3b, 0x60, 0x74, 0x6f, 0x6f, 0x20, 0x73,
+                0x6d, 0x2b, 0x00, 0x40, 0x74, 0x6f, 0x20, 0x66, 0xe4, 0x1b, 0x56, 0x65, 0x76, 0x65, 0x72, 0x79, 0xaa, 0x3c, 0x02, 0xff,
+                0x36, 0x43, 0x6c, 0x6f, 0x74, 0x2c, 0x64, 0x0c, 0x01, 0x46, 0x37, 0x00, 0x3e, 0x16, 0x00, 0xde, 0x06, 0x06, 0xa2, 0x3b,
+                0x0f, 0x76, 0x06, 0x3f, 0x01, 0x06, 0x0a, 0x52, 0x43, 0x61, 0x6e, 0x74, 0x2d, 0x43, 0x01, 0x0f, 0x78, 0x06, 0x49, 0x0f,
+                0xb0, 0x01, 0x06, 0x0f, 0x10, 0x10, 0x1d, 0x23, 0x6e, 0x79, 0x3a, 0x00, 0x0f, 0x4a, 0x0b, 0x21, 0x4f, 0x41, 0x6c, 0x6c,
+                0x6f, 0x77, 0x1c, 0x0f, 0x0a, 0x39, 0x00, 0x40, 0x52, 0x65, 0x67, 0x69, 0x0b, 0xf9, 0x0f, 0x3d, 0x00, 0x22, 0xaf, 0x41,
+                0x74, 0x74, 0x72, 0x2f, 0x53, 0x68, 0x4d, 0x65, 0x6d, 0x3f, 0x00, 0x14, 0x0a, 0xc6, 0x06, 0x10, 0x4f, 0x66, 0x13, 0x0f,
+                0xbd, 0x06, 0x5b, 0x0f, 0x2f, 0x05, 0x72, 0x0f, 0x85, 0x00, 0xff, 0x7d, 0x0f, 0x71, 0x03, 0x0c, 0x0f, 0xbb, 0x06, 0x9f,
+                0x03, 0x3e, 0x54, 0x00, 0x88, 0x04, 0x02, 0xac, 0x57, 0x0f, 0xb7, 0x3d, 0x57, 0x0f, 0xac, 0x40, 0x08, 0x09, 0xbb, 0x06,
+                0x00, 0x26, 0x4d, 0x00, 0x92, 0x11, 0x00, 0x12, 0x06, 0x00, 0xf7, 0x46, 0x01, 0x18, 0x17, 0x08, 0x5f, 0x12, 0x01, 0x27,
+                0x4f, 0x30, 0x72, 0x69, 0x62, 0xe6, 0x0a, 0x01, 0xdc, 0x06, 0x00, 0x45, 0x4f, 0x02, 0xd2, 0x06, 0x01, 0x53, 0x06, 0x05,
+                0xc0, 0x0d, 0x80, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x2e, 0x0a, 0x46, 0x67, 0x17, 0x36, 0x61, 0x72, 0x67, 0x9f, 0x06, 0x04,
+                0xf1, 0x11, 0x0f, 0x2b, 0x17, 0x10, 0x02, 0x25, 0x18, 0x02, 0xa2, 0x17, 0x01, 0x81, 0x47, 0x01, 0xc3, 0x0f, 0x04, 0xd8,
+                0x12, 0x05, 0x87, 0x35, 0x07, 0xe0, 0x06, 0x46, 0x53, 0x4d, 0x27, 0x73, 0xdc, 0x06, 0x70, 0x73, 0x2c, 0x20, 0x72, 0x65,
+                0x64, 0x75, 0x23, 0x01, 0x01, 0x6f, 0x00, 0x03, 0x98, 0x0d, 0x02, 0x21, 0x00, 0x03, 0x54, 0x42, 0x02, 0x02, 0x23, 0x75,
+                0x75, 0x73, 0x75, 0x61, 0x6c, 0x6c, 0x79, 0x69, 0x47, 0x11, 0x77, 0x18, 0x3e, 0x00, 0xcc, 0x06, 0x03, 0xc8, 0x00, 0x01,
+                0xcf, 0x36, 0x01, 0x23, 0x01, 0x00, 0x13, 0x43, 0x0f, 0x93, 0x43, 0x19, 0x05, 0x31, 0x01, 0x0f, 0x4e, 0x07, 0x47, 0x0f,
+                0xe1, 0x3e, 0x02, 0x0f, 0xe2, 0x17, 0x47, 0x0f, 0xf6, 0x42, 0x07, 0x0f, 0x67, 0x06, 0x1a, 0x00, 0x57, 0x16, 0x01, 0x4b,
+                0x00, 0x12, 0x4c, 0x8a, 0x01, 0x0f, 0x3f, 0x1d, 0x1c, 0x00, 0x3f, 0x00, 0x01, 0x3c, 0x11, 0x0f, 0x3f, 0x00, 0x06, 0x0f,
+                0xb1, 0x06, 0x21, 0x03, 0x4d, 0x00, 0x0f, 0xee, 0x07, 0x0d, 0x0f, 0x5f, 0x3b, 0x1e, 0x0f, 0x52, 0x05, 0x72, 0x12, 0x43,
+                0xe9, 0x40, 0x0f, 0x29, 0x00, 0x27, 0x0f, 0xf6, 0x04, 0x26, 0x10, 0x69, 0x2e, 0x02, 0x0f, 0xf5, 0x04, 0x45, 0x0f, 0xc8,
+                0x21, 0x35, 0x34, 0x33, 0x44, 0x20, 0x70, 0x19, 0x0f, 0xc1, 0x21, 0x1b, 0x21, 0x50, 0x72, 0x82, 0x21, 0x90, 0x76, 0x65,
+                0x20, 0x44, 0x61, 0x74, 0x61, 0x20, 0x46, 0x90, 0x52, 0x0e, 0x56, 0x05, 0x01, 0x62, 0x28, 0x23, 0x72, 0x65, 0x92, 0x35,
+                0x00, 0x2c, 0x35, 0x03, 0x55, 0x05, 0x02, 0x03, 0x0c, 0x03, 0xd2, 0x27, 0x00, 0xac, 0x04, 0xc0, 0x6f, 0x66, 0x20, 0x67,
+                0x65, 0x6f, 0x6d, 0x65, 0x74, 0x72, 0x79, 0x20, 0x68, 0x5e, 0x04, 0x07, 0x43, 0x01, 0x43, 0x00, 0x80, 0x33, 0x44, 0x20,
+                0x67, 0x72, 0x61, 0x70, 0x68, 0x72, 0x1c, 0x04, 0x38, 0x1d, 0x07, 0x14, 0x4c, 0x34, 0x61, 0x63, 0x68, 0xef, 0x04, 0x10,
+                0x72, 0x2f, 0x59, 0x5f, 0x72, 0x69, 0x7a, 0x65, 0x72, 0x78, 0x04, 0x3c, 0x05, 0xf0, 0x00, 0x10, 0x2d, 0xf0, 0x00, 0x10,
+                0x2d, 0xf0, 0x00, 0x0f, 0xc6, 0x0b, 0x2f, 0x1f, 0x30, 0xde, 0x42, 0x04, 0x0f, 0x5d, 0x01, 0x00, 0x0f, 0x39, 0x27, 0x37,
+                0x02, 0xec, 0x01, 0x0f, 0xa5, 0x0a, 0x14, 0x11, 0x49, 0x68, 0x53, 0x05, 0x90, 0x00, 0x0f, 0x49, 0x03, 0x11, 0x02, 0x33,
+                0x00, 0x10, 0x56, 0x7f, 0x51, 0x0f, 0x0e, 0x43, 0x0f, 0x06, 0x31, 0x00, 0x00, 0xc1, 0x0b, 0x01, 0x64, 0x07, 0x0f, 0xad,
+                0x03, 0x12, 0x10, 0x75, 0xf6, 0x5f, 0x0f, 0x98, 0x00, 0x1b, 0x3f, 0x4f, 0x75, 0x74, 0xcc, 0x00, 0x1e, 0x03, 0x34, 0x00,
+                0x0f, 0xcd, 0x00, 0x18, 0x03, 0x32, 0x00, 0x0f, 0xce, 0x00, 0x09, 0x0f, 0x52, 0x04, 0x21, 0x14, 0x70, 0xb6, 0x00, 0x02,
+                0x85, 0x61, 0x02, 0x84, 0x03, 0x0f, 0x49, 0x09, 0x54, 0x11, 0x52, 0x54, 0x03, 0x0f, 0xe8, 0x03, 0x37, 0x10, 0x70, 0x6d,
+                0x14, 0x02, 0x5e, 0x2d, 0x40, 0x73, 0x61, 0x6d, 0x70, 0x17, 0x31, 0x6f, 0x28, 0x4d, 0x53, 0x41, 0x41, 0x29, 0xf4, 0x03,
+                0x0e, 0x0f, 0xd4, 0x03, 0x3c, 0x02, 0xd9, 0x00, 0x0f, 0xd1, 0x03, 0x39, 0x0f, 0xd0, 0x03, 0x04, 0x0c, 0x42, 0x01, 0x0f,
+                0x9e, 0x15, 0x21, 0x0f, 0x6b, 0x08, 0x1d, 0x12, 0x53, 0x5b, 0x01, 0x0f, 0x38, 0x04, 0x64, 0x02, 0xb3, 0x00, 0x2f, 0x20,
+                0x49, 0xcc, 0x0c, 0x11, 0x03, 0x2c, 0x00, 0x20, 0x4b, 0x69, 0xd4, 0x03, 0x0f, 0x30, 0x00, 0x17, 0x1f, 0x4f, 0x6d, 0x32,
+                0x0e, 0x00, 0x2d, 0x00, 0x03, 0x07, 0x01, 0x0f, 0x8a, 0x00, 0x13, 0x04, 0x2d, 0x00, 0x0f, 0x8b, 0x00, 0x16, 0x04, 0x31,
+                0x00, 0x0f, 0x8c, 0x00, 0x02, 0x0f, 0xe8, 0x03, 0x21, 0x02, 0xc0, 0x06, 0x0f, 0xe5, 0x03, 0x48, 0x0f, 0x39, 0x08, 0x35,
+                0x06, 0x54, 0x60, 0x00, 0xa2, 0x3d, 0x04, 0xdf, 0x3b, 0x07, 0x94, 0x2d, 0x0f, 0x45, 0x08, 0x11, 0x02, 0xf3, 0x3d, 0x00,
+                0x87, 0x13, 0x80, 0x6e, 0x20, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x64, 0xdd, 0x2f, 0x04, 0x44, 0x00, 0x0a, 0xda, 0x4a, 0x0f,
+                0xe8, 0x4e, 0x1c, 0x07, 0x71, 0x3c, 0x07, 0xa3, 0x3d, 0x01, 0x57, 0x3d, 0x20, 0x20, 0x49, 0x89, 0x4b, 0x0f, 0x61, 0x43,
+                0x18, 0x0f, 0x76, 0x3e, 0x04, 0x0a, 0x61, 0x3e, 0x0f, 0x0a, 0x43, 0x5e, 0x0f, 0x04, 0x43, 0xd4, 0x0f, 0x2f, 0x3e, 0x3e,
+                0x0f, 0x30, 0x3e, 0x90, 0x0f, 0xf8, 0x43, 0xff, 0x4f, 0x0f, 0x93, 0x3e, 0xff, 0xaa, 0x0f, 0xb4, 0x45, 0xff, 0x0b, 0x0f,
+                0xae, 0x45, 0x7a, 0x09, 0x21, 0x07, 0x0f, 0xa6, 0x45, 0x04, 0x0f, 0x5c, 0x07, 0x02, 0x0f, 0x4d, 0x07, 0x50, 0x07, 0x75,
+                0x45, 0x0f, 0x47, 0x07, 0x59, 0x0f, 0xda, 0x05, 0x30, 0x0f, 0x3b, 0x00, 0x16, 0x0f, 0x76, 0x44, 0x67, 0x0f, 0xb4, 0x07,
+                0xc4, 0x0f, 0x47, 0x07, 0x21, 0x0f, 0xae, 0x04, 0xb2, 0x0f, 0x1d, 0x08, 0xff, 0xff, 0x88, 0x0f, 0x47, 0x07, 0x36, 0x05,
+                0xa7, 0x06, 0x0f, 0x71, 0x0f, 0x86, 0x61, 0x45, 0x78, 0x68, 0x61, 0x75, 0x73, 0x15, 0x16, 0x10, 0x4c, 0x7d, 0x33, 0x3f,
+                0x6e, 0x67, 0x73, 0xb2, 0x17, 0x06, 0x0f, 0xd5, 0x07, 0x10, 0x0f, 0x51, 0x07, 0x29, 0x44, 0x41, 0x6c, 0x6c, 0x2d, 0x13,
+                0x6f, 0x0f, 0x58, 0x56, 0x46, 0x00, 0x1b, 0x2a, 0x04, 0x65, 0x00, 0x0f, 0x30, 0x13, 0x1d, 0x21, 0x65, 0x72, 0xe1, 0x02,
+                0x01, 0x2c, 0x1b, 0x01, 0x9c, 0x3a, 0x4f, 0x28, 0x61, 0x76, 0x67, 0xc6, 0x2d, 0x1d, 0x01, 0x81, 0x29, 0x5f, 0x20, 0x28,
+                0x73, 0x75, 0x6d, 0x3a, 0x00, 0x06, 0x00, 0xb1, 0x60, 0x0f, 0x3a, 0x00, 0x00, 0x05, 0xb5, 0x10, 0x04, 0xe4, 0x6c, 0x90,
+                0x65, 0x6e, 0x2e, 0x77, 0x69, 0x6b, 0x69, 0x70, 0x65, 0xe0, 0x6c, 0x40, 0x6f, 0x72, 0x67, 0x2f, 0x0e, 0x00, 0x60, 0x2f,
+                0x44, 0x69, 0x6d, 0x65, 0x6e, 0x6b, 0x53, 0xe0, 0x61, 0x6c, 0x5f, 0x61, 0x6e, 0x61, 0x6c, 0x79, 0x73, 0x69, 0x73, 0x22,
+                0x20, 0x74, 0x3a, 0x1e, 0xb7, 0x74, 0x3d, 0x22, 0x5f, 0x62, 0x6c, 0x61, 0x6e, 0x6b, 0x22, 0x3e, 0x26, 0x00, 0x04, 0xe5,
+                0x66, 0x1f, 0x61, 0xb7, 0x63, 0x35, 0x02, 0x5f, 0x01, 0x0f, 0x28, 0x5e, 0x89, 0x0d, 0x85, 0x00, 0x01, 0x07, 0x26, 0x0f,
+                0x08, 0x28, 0x3c, 0x00, 0x79, 0x58, 0x01, 0x72, 0x2c, 0x0f, 0x31, 0x00, 0x15, 0x0f, 0x85, 0x00, 0x19, 0x5f, 0x73, 0x65,
+                0x63, 0x6f, 0x6e, 0x9e, 0x69, 0x10, 0x0f, 0xbb, 0x04, 0x11, 0x08, 0x60, 0x72, 0x0f, 0xea, 0x0b, 0x41, 0x0f, 0x15, 0x04,
+                0x2d, 0x02, 0x98, 0x72, 0x0f, 0x13, 0x04, 0x4a, 0x01, 0x63, 0x00, 0x13, 0x20, 0x9b, 0x72, 0x0f, 0xd2, 0x03, 0x1c, 0x00,
+                0x80, 0x17, 0x0f, 0x3a, 0x03, 0x33, 0x02, 0x86, 0x00, 0x0f, 0x38, 0x03, 0x99, 0x01, 0xde, 0x06, 0x0f, 0xec, 0x5a, 0x11,
+                0x20, 0x61, 0x78, 0x64, 0x01, 0x0f, 0x8f, 0x6d, 0x34, 0x06, 0x83, 0x74, 0x0f, 0xaf, 0x02, 0x81, 0x0f, 0x47, 0x64, 0x39,
+                0x0f, 0xb4, 0x02, 0x09, 0x07, 0x93, 0x63, 0x0f, 0xb9, 0x02, 0x06, 0x0f, 0xa3, 0x13, 0x22, 0x0f, 0xeb, 0x63, 0xc6, 0x0b,
+                0x2a, 0x76, 0x0f, 0x95, 0x09, 0x58, 0x09, 0x38, 0x76, 0x0f, 0x6e, 0x02, 0x31, 0x0f, 0x79, 0x4d, 0x2d, 0x04, 0xf0, 0x6f,
+                0x06, 0x9c, 0x71, 0x24, 0x3a, 0x20, 0x58, 0x7b, 0x0f, 0x21, 0x09, 0x08, 0x0f, 0x7d, 0x1a, 0x22, 0x0d, 0x55, 0x85, 0x0c,
+                0x7b, 0x00, 0x0f, 0x4e, 0x71, 0x55, 0x0f, 0x35, 0x01, 0x4a, 0x02, 0xa6, 0x06, 0x0f, 0x33, 0x01, 0x3c, 0x03, 0xd3, 0x7e,
+                0x0f, 0x31, 0x01, 0xc2, 0x0f, 0x07, 0x69, 0x0a, 0x0f, 0x36, 0x01, 0x2a, 0x08, 0xe5, 0x7d, 0x0f, 0x3b, 0x01, 0x2b, 0x0f,
+                0xd2, 0x03, 0x9a, 0x02, 0xbb, 0x73, 0x0f, 0xc8, 0x03, 0x58, 0x0f, 0x92, 0x74, 0x01, 0x0f, 0x8d, 0x02, 0x89, 0x0d, 0x21,
+                0x01, 0x0f, 0xb4, 0x03, 0x49, 0x0f, 0x1d, 0x01, 0xae, 0x0f, 0xa0, 0x03, 0x53, 0x0f, 0x27, 0x01, 0x21, 0x0f, 0x96, 0x03,
+                0x9a, 0x31, 0x54, 0x6f, 0x70, 0xd3, 0x6f, 0x02, 0x3d, 0x75, 0x0f, 0x9d, 0x03, 0x57, 0x09, 0x78, 0x00, 0x0f, 0x87, 0x02,
+                0x97, 0x0f, 0x2f, 0x01, 0x05, 0x0f, 0xab, 0x03, 0x49, 0x0f, 0x2b, 0x01, 0xbc, 0x0f, 0xb9, 0x03, 0x53, 0x0f, 0x35, 0x01,
+                0x28, 0x0f, 0xc0, 0x03, 0x9d, 0x08, 0xbd, 0x74, 0x0f, 0xc1, 0x03, 0x5a, 0x0f, 0x4b, 0x0e, 0x06, 0x0f, 0x97, 0x02, 0x8c,
+                0x0f, 0x31, 0x01, 0x03, 0x0f, 0xc3, 0x03, 0x4c, 0x0f, 0x2d, 0x01, 0xbb, 0x0f, 0xc5, 0x03, 0x56, 0x0f, 0x37, 0x01, 0x26,
+                0x0f, 0x1c, 0x0b, 0x9b, 0x00, 0xcf, 0x57, 0x32, 0x48, 0x69, 0x74, 0x6c, 0x73, 0x0f, 0x23, 0x0b, 0x58, 0x08, 0x78, 0x00,
+                0x0f, 0x0d, 0x0a, 0x98, 0x0f, 0x2f, 0x01, 0x04, 0x0f, 0x31, 0x0b, 0x4a, 0x0f, 0x2b, 0x01, 0xbb, 0x0f, 0x3f, 0x0b, 0x54,
+                0x0f, 0x35, 0x01, 0x27, 0x0f, 0xc0, 0x03, 0x9a, 0x00, 0x10, 0x72, 0x02, 0x1c, 0x20, 0x0f, 0xbd, 0x03, 0x58, 0x06, 0x75,
+                0x00, 0x0f, 0x8f, 0x02, 0x97, 0x0f, 0x29, 0x01, 0x02, 0x0f, 0xb7, 0x03, 0x49, 0x0f, 0x25, 0x01, 0xb6, 0x0f, 0xb1, 0x03,
+                0x53, 0x0f, 0x2f, 0x01, 0x25, 0x0f, 0xae, 0x03, 0x9a, 0x0f, 0x0f, 0xef, 0x15, 0x01, 0x59, 0x2f, 0x0f, 0xd1, 0x03, 0x58,
+                0x0f, 0x98, 0x00, 0x1a, 0x0f, 0xcf, 0x02, 0x97, 0x0f, 0x6f, 0x01, 0x25, 0x0f, 0x17, 0x04, 0x49, 0x0f, 0x6b, 0x01, 0xfc,
+                0x0f, 0x5d, 0x04, 0x53, 0x0f, 0x75, 0x01, 0x48, 0x0f, 0x80, 0x04, 0xb4, 0x02, 0x81, 0x27, 0x0f, 0x73, 0x04, 0x72, 0x0f,
+                0x26, 0x71, 0x01, 0x0f, 0xfb, 0x02, 0xa3, 0x0d, 0x55, 0x01, 0x0f, 0x59, 0x04, 0x63, 0x0f, 0x51, 0x01, 0xc8, 0x0f, 0x3f,
+                0x04, 0x6d, 0x0f, 0x5b, 0x01, 0x21, 0x0f, 0x32, 0x04, 0x9b, 0x4f, 0x31, 0x54, 0x65, 0x78, 0xe8, 0x13, 0x63, 0x0c, 0x7b,
+                0x00, 0x0f, 0xc1, 0x02, 0x98, 0x0f, 0x35, 0x01, 0x07, 0x0f, 0x02, 0x04, 0x4a, 0x0f, 0x31, 0x01, 0xc1, 0x0f, 0xe2, 0x03,
+                0x54, 0x0f, 0x3b, 0x01, 0x2a, 0x0f, 0xd2, 0x03, 0xa0, 0x0b, 0xca, 0x04, 0x0f, 0xd7, 0x03, 0x5e, 0x0b, 0x80, 0x00, 0x0f,
+                0xab, 0x02, 0x9d, 0x0f, 0x3f, 0x01, 0x07, 0x0f, 0xe1, 0x03, 0x4f, 0x0f, 0x3b, 0x01, 0xc6, 0x0f, 0xeb, 0x03, 0x59, 0x0f,
+                0x45, 0x01, 0x2a, 0x0f, 0xf0, 0x03, 0x9a, 0x2f, 0x53, 0x6d, 0xbf, 0x07, 0x63, 0x09, 0x78, 0x00, 0x0f, 0xa5, 0x02, 0x97,
+                0x0f, 0x2f, 0x01, 0x05, 0x0f, 0xd8, 0x03, 0x49, 0x0f, 0x2b, 0x01, 0xbc, 0x0f, 0xc8, 0x03, 0x53, 0x0f, 0x35, 0x01, 0x28,
+                0x0f, 0xc0, 0x03, 0x9c, 0x00, 0x58, 0x33, 0x04, 0xbf, 0x5f, 0x0f, 0xc1, 0x03, 0x5a, 0x08, 0x79, 0x00, 0x0f, 0x97, 0x02,
+                0x99, 0x0f, 0x31, 0x01, 0x04, 0x0f, 0xc3, 0x03, 0x4b, 0x0f, 0x2d, 0x01, 0xbc, 0x0f, 0xc5, 0x03, 0x55, 0x0f, 0x37, 0x01,
+                0x27, 0x0f, 0xc6, 0x03, 0x9c, 0x02, 0x7d, 0x54, 0x06, 0x84, 0x67, 0x0f, 0xc9, 0x03, 0x59, 0x0b, 0x7c, 0x00, 0x0f, 0x9f,
+                0x02, 0x99, 0x0f, 0x37, 0x01, 0x07, 0x0f, 0xcf, 0x03, 0x4b, 0x0f, 0x33, 0x01, 0xc2, 0x0f, 0xd5, 0x03, 0x55, 0x0f, 0x3d,
+                0x01, 0x2a, 0x0f, 0xd8, 0x03, 0x9c, 0x04, 0x7a, 0x64, 0x02, 0xda, 0x65, 0x0f, 0xd6, 0x03, 0x59, 0x09, 0x7a, 0x00, 0x0f,
+                0xa1, 0x02, 0x99, 0x0f, 0x33, 0x01, 0x05, 0x0f, 0xd2, 0x03, 0x4b, 0x0f, 0x2f, 0x01, 0xbe, 0x0f, 0xce, 0x03, 0x55, 0x0f,
+                0x39, 0x01, 0x28, 0x0f, 0xcc, 0x03, 0x9c, 0x00, 0x2d, 0x5a, 0x02, 0xc7, 0x61, 0x01, 0x77, 0x5a, 0x0f, 0x2f, 0x0f, 0x5b,
+                0x0c, 0x7d, 0x00, 0x0f, 0xa3, 0x02, 0x99, 0x0f, 0x39, 0x01, 0x08, 0x0f, 0xd5, 0x03, 0x4b, 0x0f, 0x35, 0x01, 0xc4, 0x0f,
+                0xdb, 0x03, 0x55, 0x0f, 0x3f, 0x01, 0x2b, 0x0f, 0xde, 0x03, 0x9a, 0x00, 0xeb, 0x00, 0x01, 0x53, 0x5e, 0x0f, 0xdb, 0x03,
+                0x5e, 0x0b, 0x7a, 0x00, 0x0f, 0xa3, 0x02, 0x97, 0x0f, 0x33, 0x01, 0x07, 0x0f, 0xd5, 0x03, 0x49, 0x0f, 0x2f, 0x01, 0xc0,
+                0x0f, 0xcf, 0x03, 0x53, 0x0f, 0x39, 0x01, 0x2a, 0x0f, 0xcc, 0x03, 0x9a, 0x05, 0x56, 0x5c, 0x00, 0x64, 0x42, 0x01, 0x9d,
+                0xb1, 0x0f, 0xce, 0x03, 0x57, 0x0d, 0x7c, 0x00, 0x0f, 0xa1, 0x02, 0x97, 0x0f, 0x37, 0x01, 0x09, 0x0f, 0xd2, 0x03, 0x49,
+                0x0f, 0x33, 0x01, 0xc4, 0x0f, 0xd6, 0x03, 0x53, 0x0f, 0x3d, 0x01, 0x2c, 0x0f, 0xd8, 0x03, 0x9a, 0x02, 0xba, 0x5d, 0x0f,
+                0xd5, 0x03, 0x60, 0x0a, 0x79, 0x00, 0x0f, 0x9f, 0x02, 0x97, 0x0f, 0x31, 0x01, 0x06, 0x0f, 0xcf, 0x03, 0x49, 0x0f, 0x2d,
+                0x01, 0xbe, 0x0f, 0xc9, 0x03, 0x53, 0x0f, 0x37, 0x01, 0x29, 0x0f, 0xe6, 0x2e, 0xc2, 0x0f, 0xe1, 0x2e, 0x80, 0x0f, 0x71,
+                0x2d, 0xbf, 0x0f, 0xd7, 0x2e, 0x7c, 0x0f, 0x61, 0x01, 0xca, 0x0f, 0xcd, 0x2e, 0x7b, 0x0f, 0x62, 0x04, 0xe2, 0x05, 0x69,
+                0x5a, 0x0f, 0x5d, 0x04, 0x72, 0x0f, 0xf7, 0x5a, 0x04, 0x0f, 0xf7, 0x02, 0xa3, 0x0f, 0x5b, 0x01, 0x01, 0x0f, 0x53, 0x04,
+                0x63, 0x0f, 0x57, 0x01, 0xce, 0x0f, 0x49, 0x04, 0x6d, 0x0f, 0x61, 0x01, 0x24, 0x0f, 0x44, 0x04, 0x9a, 0x0d, 0xa7, 0xc7,
+                0x0f, 0x32, 0x04, 0x58, 0x0d, 0x7c, 0x00, 0x0f, 0xc9, 0x02, 0x97, 0x0f, 0x37, 0x01, 0x09, 0x0f, 0x0e, 0x04, 0x49, 0x0f,
+                0x33, 0x01, 0xc4, 0x0f, 0xea, 0x03, 0x53, 0x0f, 0x3d, 0x01, 0x2c, 0x08, 0xd8, 0x03, 0x09, 0x0c, 0x00, 0x00, 0xe2, 0x03,
+                0x00, 0x7b, 0x00, 0x56, 0x66, 0x6f, 0x6f, 0x74, 0x65, 0x7b, 0xc6, 0x01, 0xa4, 0xc4, 0x11, 0x3e, 0xb3, 0x62, 0x03, 0xfb,
+                0xc6, 0x03, 0xb1, 0xbe, 0x50, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0xa3, 0x7e, 0x00, 0xa4, 0x89, 0x80, 0x62, 0x65, 0x6e, 0x63,
+                0x68, 0x6d, 0x61, 0x72, 0x4a, 0x8f, 0x40, 0x2c, 0x20, 0x6e, 0x6f, 0x47, 0x94, 0x70, 0x6d, 0x70, 0x61, 0x72, 0x69, 0x73,
+                0x6f, 0xf9, 0xac, 0x52, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x6c, 0xbe, 0x55, 0x61, 0x72, 0x74, 0x73, 0x28, 0xe7, 0x59, 0x00,
+                0x01, 0x87, 0xb0, 0x6d, 0x65, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x23, 0x75, 0x6e, 0x69, 0x54, 0xc7, 0x50, 0x64, 0x65, 0x64,
+                0x5f, 0x75, 0x4c, 0x53, 0x00, 0x23, 0xc7, 0x11, 0x6e, 0xed, 0xba, 0x02, 0x11, 0xba, 0x0a, 0x6b, 0xc7, 0x07, 0xba, 0x00,
+                0x0a, 0xbd, 0xc7, 0x30, 0x67, 0x5f, 0x6a, 0x75, 0x00, 0x17, 0x3d, 0x8a, 0xc8, 0x40, 0x2f, 0x2a, 0x2a, 0x2a, 0xc6, 0xcc,
+                0xe3, 0x5f, 0x44, 0x41, 0x54, 0x41, 0x5f, 0x48, 0x45, 0x52, 0x45, 0x2a, 0x2a, 0x2a, 0x2f, 0x1f, 0x00, 0x15, 0x7d, 0x4a,
+                0xc9, 0x20, 0x67, 0x5f, 0xbe, 0x77, 0x23, 0x20, 0x3d, 0x43, 0x00, 0x12, 0x2e, 0x80, 0x58, 0x11, 0x73, 0xee, 0x94, 0xa4,
+                0x45, 0x70, 0x6f, 0x63, 0x68, 0x20, 0x7c, 0x7c, 0x20, 0x30, 0xb0, 0xc8, 0x21, 0x67, 0x5f, 0xf5, 0xba, 0x00, 0x3f, 0x54,
+                0x06, 0x33, 0x00, 0x06, 0x13, 0x00, 0x41, 0x7c, 0x7c, 0x20, 0x27, 0x24, 0xc7, 0x43, 0x4d, 0x61, 0x72, 0x6b, 0x2a, 0x5a,
+                0x16, 0x27, 0x3c, 0x00, 0x02, 0x2a, 0xc1, 0x06, 0x39, 0x00, 0x03, 0x10, 0x00, 0x5c, 0x7c, 0x7c, 0x20, 0x7b, 0x7d, 0x26,
+                0x00, 0x45, 0x2e, 0x67, 0x70, 0x75, 0x67, 0x00, 0x0b, 0x13, 0x00, 0x00, 0x67, 0x00, 0x40, 0x55, 0x6e, 0x6b, 0x6e, 0xf5,
+                0x6b, 0x3d, 0x47, 0x50, 0x55, 0x62, 0x00, 0x5c, 0x2e, 0x63, 0x68, 0x69, 0x70, 0x3d, 0x00, 0x05, 0x14, 0x00, 0x08, 0x3e,
+                0x00, 0x4f, 0x43, 0x68, 0x69, 0x70, 0x3f, 0x00, 0x00, 0x00, 0x4c, 0x03, 0x30, 0x4c, 0x6f, 0x63, 0xd9, 0x01, 0x00, 0x06,
+                0x49, 0x10, 0x75, 0x43, 0xca, 0x0f, 0x1e, 0x00, 0x09, 0x07, 0x53, 0x00, 0x17, 0x27, 0x5a, 0x01, 0x07, 0xb7, 0xd8, 0x03,
+                0xf2, 0x00, 0x05, 0x12, 0x00, 0x0b, 0xf4, 0x00, 0x05, 0x28, 0xd1, 0x05, 0x53, 0x01, 0x01, 0x10, 0x00, 0x0b, 0x26, 0x00,
+                0x0a, 0x34, 0xcf, 0x03, 0x2b, 0x00, 0x08, 0x15, 0x00, 0x03, 0x30, 0x00, 0x03, 0x31, 0x00, 0x21, 0x2f, 0x2f, 0xa7, 0x02,
+                0x01, 0xbb, 0x06, 0x47, 0x67, 0x69, 0x6e, 0x67, 0xe7, 0x00, 0x50, 0x62, 0x75, 0x67, 0x20, 0x3d, 0xd7, 0xcb, 0x03, 0x88,
+                0x01, 0x01, 0x10, 0x00, 0xf6, 0x06, 0x3d, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x29, 0x20, 0x3f,
+                0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x3a, 0xac, 0x01, 0x36, 0x62, 0x75, 0x67, 0x8b, 0x00, 0x31, 0x70, 0x6f, 0x70, 0x9f,
+                0x9e, 0x51, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x7e, 0xbf, 0x00, 0x93, 0x00, 0x04, 0x51, 0x00, 0x0f, 0x1e, 0x00, 0x02, 0x0f,
+                0x5f, 0x00, 0x0a, 0x0f, 0x32, 0x00, 0x00, 0x06, 0x6d, 0x00, 0x05, 0x77, 0x06, 0x01, 0x20, 0xb1, 0x01, 0x6d, 0xcc, 0x41,
+                0x20, 0x3d, 0x20, 0x6e, 0xf0, 0xc2, 0x16, 0x74, 0x70, 0xcc, 0x04, 0x47, 0x01, 0x0f, 0x27, 0x00, 0x0e, 0x08, 0x5a, 0x04,
+                0x0f, 0x2c, 0x00, 0x09, 0x0b, 0x81, 0xcb, 0x02, 0x64, 0x04, 0x90, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a, 0x00,
+            };
+
+            static const CompressedReportDefinition reportDefinition(CompressedContents, sizeof(CompressedContents), 313807, 158, 266, 20);
+            return reportDefinition.GetReportDefinition();
+        }
+
+    } // namespace PerRangeReport
+
+    namespace SummaryReport {
+
+        inline ReportDefinition GetReportDefinition()
+        {
+            static const unsigned char CompressedContents[] = {
+                0xf0, 0x00, 0x66, 0x65, 0x5f, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x00, 0x0f, 0x00, 0xf1,
+                0x38, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5f, 0x6f, 0x70, 0x73, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x5f, 0x62, 0x75, 0x6e,
+                0x64, 0x6c, 0x65, 0x5f, 0x63, 0x6d, 0x64, 0x5f, 0x67, 0x6f, 0x5f, 0x69, 0x64, 0x6c, 0x65, 0x00, 0x67, 0x70, 0x75, 0x5f,
+                0x5f, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x64, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x67, 0x72, 0x5f, 0x5f, 0x63,
+                0x79, 0x63, 0x6c, 0x65, 0x73, 0x5f, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x12, 0x00, 0x83, 0x64, 0x69, 0x73, 0x70, 0x61,
+                0x74, 0x63, 0x68, 0x5f, 0x00, 0x70, 0x70, 0x64, 0x61, 0x5f, 0x5f, 0x69, 0x6e, 0x5f, 0x00, 0xc0, 0x70, 0x72, 0x69, 0x6d,
+                0x73, 0x00, 0x70, 0x72, 0x6f, 0x70, 0x5f, 0x5f, 0x06, 0x00, 0x70, 0x32, 0x78, 0x62, 0x61, 0x72, 0x5f, 0x63, 0x10, 0x00,
+                0xb0, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x73, 0x5f, 0x72, 0x65, 0x61, 0x6c, 0x64, 0x00, 0x0d, 0x25, 0x00, 0x1f, 0x7a, 0x25,
+                0x00, 0x01, 0x01, 0x3a, 0x00, 0xf9, 0x01, 0x5f, 0x74, 0x68, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x70, 0x75, 0x74, 0x00, 0x64,
+                0x72, 0x61, 0x6d, 0x11, 0x00, 0x5a, 0x6c, 0x31, 0x74, 0x65, 0x78, 0x12, 0x00, 0x29, 0x74, 0x73, 0x10, 0x00, 0x4a, 0x70,
+                0x63, 0x69, 0x65, 0x11, 0x00, 0x00, 0xb0, 0x00, 0x08, 0x10, 0x00, 0x1b, 0x65, 0x31, 0x00, 0x0c, 0x75, 0x00, 0x69, 0x72,
+                0x61, 0x73, 0x74, 0x65, 0x72, 0x13, 0x00, 0x1a, 0x73, 0x86, 0x00, 0x3a, 0x76, 0x61, 0x66, 0x10, 0x00, 0x29, 0x70, 0x63,
+                0x10, 0x00, 0x01, 0xdd, 0x00, 0x08, 0x11, 0x00, 0xf6, 0x11, 0x0a, 0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a, 0x20, 0x20,
+                0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3d, 0x22, 0x75, 0x74, 0x66, 0x2d, 0x38,
+                0x22, 0x2f, 0x1a, 0x00, 0xf1, 0x17, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x76, 0x69, 0x65, 0x77, 0x70, 0x6f, 0x72, 0x74,
+                0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x64, 0x65, 0x76,
+                0x69, 0x63, 0x65, 0x2d, 0x0d, 0x00, 0xf0, 0x02, 0x2c, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x2d, 0x73, 0x63,
+                0x61, 0x6c, 0x65, 0x3d, 0x31, 0x48, 0x00, 0x00, 0x49, 0x00, 0x40, 0x68, 0x65, 0x61, 0x64, 0x52, 0x00, 0xf2, 0x03, 0x20,
+                0x20, 0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x3c, 0x2f, 0x0f, 0x00, 0x00,
+                0x25, 0x00, 0xf0, 0x00, 0x20, 0x20, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x52, 0x65, 0x6d,
+                0x00, 0x10, 0x53, 0x10, 0x00, 0x13, 0x22, 0x1e, 0x00, 0x93, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x7b, 0x0e,
+                0x00, 0xf5, 0x03, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x31, 0x34, 0x70, 0x78,
+                0x3b, 0x19, 0x00, 0xe6, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x32, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x18, 0x00,
+                0xf4, 0x02, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x63, 0x6f, 0x6c, 0x6c, 0x61, 0x70, 0x73, 0x65, 0x3a, 0x20, 0x0a,
+                0x00, 0x0c, 0x23, 0x00, 0xc4, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x1c, 0x00, 0x1a,
+                0x7d, 0x87, 0x00, 0x27, 0x74, 0x68, 0x8a, 0x00, 0x04, 0x71, 0x00, 0x1f, 0x30, 0x71, 0x00, 0x39, 0xf0, 0x02, 0x20, 0x20,
+                0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x23, 0x46, 0x38, 0x02, 0x00, 0x0f, 0x8e, 0x00,
+                0x05, 0x1f, 0x64, 0x8e, 0x00, 0x4d, 0x0c, 0x71, 0x00, 0x7f, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x74, 0x72, 0x7a, 0x00, 0x59,
+                0x11, 0x2e, 0x7b, 0x00, 0x00, 0x90, 0x02, 0x07, 0x73, 0x00, 0xff, 0x01, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x44,
+                0x61, 0x72, 0x6b, 0x47, 0x72, 0x65, 0x65, 0x6e, 0x75, 0x00, 0x01, 0x00, 0x21, 0x00, 0x5f, 0x42, 0x6c, 0x61, 0x63, 0x6b,
+                0x5b, 0x01, 0x12, 0x03, 0x59, 0x02, 0xce, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x62, 0x6f, 0x6c, 0x64, 0x8b,
+                0x00, 0x67, 0x73, 0x75, 0x62, 0x68, 0x64, 0x72, 0x88, 0x00, 0x0f, 0xac, 0x01, 0x11, 0x37, 0x2e, 0x63, 0x61, 0x32, 0x00,
+                0xfe, 0x03, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72,
+                0x31, 0x00, 0x1f, 0x6c, 0x31, 0x00, 0x05, 0x4e, 0x6c, 0x65, 0x66, 0x74, 0x2f, 0x00, 0x1f, 0x72, 0x2f, 0x00, 0x05, 0x10,
+                0x72, 0xcc, 0x00, 0x0e, 0x30, 0x00, 0x27, 0x77, 0x77, 0x30, 0x00, 0xf0, 0x02, 0x77, 0x6f, 0x72, 0x64, 0x2d, 0x77, 0x72,
+                0x61, 0x70, 0x3a, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x2d, 0x11, 0x00, 0x0e, 0x34, 0x00, 0x5b, 0x66, 0x75, 0x6c, 0x6c,
+                0x5f, 0x85, 0x01, 0x32, 0x6d, 0x69, 0x6e, 0x02, 0x04, 0x58, 0x3a, 0x20, 0x31, 0x35, 0x30, 0x8b, 0x03, 0x03, 0x16, 0x00,
+                0x48, 0x33, 0x33, 0x76, 0x77, 0xa0, 0x03, 0x14, 0x78, 0x2f, 0x00, 0xfe, 0x03, 0x63, 0x61, 0x6c, 0x63, 0x28, 0x39, 0x32,
+                0x76, 0x77, 0x20, 0x2d, 0x20, 0x39, 0x32, 0x30, 0x70, 0x78, 0x29, 0x72, 0x00, 0x3f, 0x62, 0x61, 0x73, 0xf7, 0x03, 0x04,
+                0x18, 0x38, 0x6b, 0x00, 0x03, 0xe9, 0x01, 0x30, 0x23, 0x36, 0x30, 0x02, 0x00, 0x0f, 0x08, 0x02, 0x12, 0x07, 0x9a, 0x01,
+                0x3f, 0x6f, 0x6d, 0x70, 0x64, 0x00, 0x17, 0x8d, 0x73, 0x74, 0x65, 0x65, 0x6c, 0x62, 0x6c, 0x75, 0xc0, 0x02, 0x0f, 0x66,
+                0x00, 0x0c, 0xab, 0x6e, 0x6f, 0x74, 0x5f, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0xcb, 0x04, 0x04, 0xbc, 0x00, 0x11, 0x43,
+                0x01, 0x00, 0x0f, 0x39, 0x00, 0x04, 0x4f, 0x76, 0x61, 0x69, 0x6c, 0x38, 0x00, 0x04, 0x11, 0x38, 0x01, 0x00, 0x0f, 0x32,
+                0x03, 0x00, 0x00, 0x5f, 0x05, 0x38, 0x61, 0x72, 0x65, 0x18, 0x02, 0x00, 0x3e, 0x07, 0x87, 0x6c, 0x61, 0x79, 0x3a, 0x20,
+                0x66, 0x6c, 0x65, 0xdb, 0x00, 0x01, 0x2a, 0x02, 0x6c, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x90, 0x02, 0x05, 0x68, 0x00,
+                0x47, 0x77, 0x68, 0x69, 0x74, 0xf4, 0x00, 0x01, 0x26, 0x01, 0xff, 0x00, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x20,
+                0x76, 0x65, 0x72, 0x64, 0x61, 0x6e, 0x61, 0x84, 0x00, 0x04, 0x28, 0x62, 0x61, 0x2d, 0x03, 0x02, 0x28, 0x04, 0x10, 0x2d,
+                0xc5, 0x02, 0x27, 0x3a, 0x20, 0xab, 0x01, 0x03, 0x18, 0x00, 0x01, 0xae, 0x02, 0x19, 0x3a, 0x44, 0x04, 0x06, 0x4f, 0x00,
+                0xff, 0x00, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x56, 0x00, 0x05,
+                0x0a, 0x81, 0x04, 0x0a, 0x59, 0x00, 0x05, 0x72, 0x00, 0x0b, 0xa5, 0x00, 0x0f, 0x01, 0x02, 0x03, 0x19, 0x32, 0x02, 0x02,
+                0x09, 0x65, 0x00, 0x17, 0x31, 0xec, 0x02, 0x07, 0x1c, 0x04, 0x20, 0x65, 0x63, 0xbd, 0x08, 0x08, 0x1d, 0x04, 0x02, 0x1d,
+                0x02, 0x60, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x24, 0x03, 0x08, 0x52, 0x00, 0x7a, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e,
+                0x67, 0x4e, 0x00, 0x0c, 0x51, 0x04, 0x01, 0x01, 0x00, 0x0e, 0xe2, 0x06, 0x0a, 0x33, 0x00, 0x07, 0x87, 0x03, 0x01, 0x58,
+                0x03, 0x88, 0x31, 0x30, 0x30, 0x25, 0x20, 0x2d, 0x20, 0x34, 0x57, 0x03, 0x05, 0x93, 0x03, 0x00, 0x85, 0x03, 0x03, 0xcc,
+                0x07, 0x0f, 0xc3, 0x00, 0x06, 0x1f, 0x5f, 0x17, 0x01, 0x02, 0x0f, 0xf2, 0x01, 0x04, 0x0f, 0x38, 0x05, 0x08, 0x05, 0x41,
+                0x02, 0x1f, 0x62, 0x18, 0x03, 0x03, 0x79, 0x77, 0x6f, 0x72, 0x6b, 0x66, 0x6c, 0x6f, 0x8e, 0x04, 0x02, 0xa6, 0x00, 0x2a,
+                0x39, 0x36, 0xe2, 0x00, 0x06, 0x3a, 0x04, 0x26, 0x39, 0x30, 0x53, 0x04, 0x06, 0x4a, 0x00, 0x6f, 0x64, 0x65, 0x62, 0x75,
+                0x67, 0x5f, 0x82, 0x01, 0x40, 0x11, 0x44, 0x01, 0x00, 0x0f, 0x82, 0x01, 0x56, 0x68, 0x23, 0x66, 0x6f, 0x6f, 0x74, 0x65,
+                0x34, 0x03, 0x40, 0x70, 0x6f, 0x73, 0x69, 0xd5, 0x00, 0x67, 0x3a, 0x20, 0x66, 0x69, 0x78, 0x65, 0x5b, 0x01, 0x0d, 0x46,
+                0x03, 0x69, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x13, 0x00, 0x04, 0x9d, 0x05, 0x3f, 0x30, 0x30, 0x25, 0xe0, 0x00, 0x03,
+                0xa6, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x32, 0x35, 0x2c, 0x20, 0x05, 0x00, 0x37, 0x30, 0x2e, 0x35, 0xb5, 0x00, 0x03,
+                0xc2, 0x01, 0x58, 0x64, 0x61, 0x72, 0x6b, 0x72, 0x7f, 0x00, 0x0f, 0xc7, 0x06, 0x07, 0x33, 0x20, 0x20, 0x68, 0x0c, 0x02,
+                0x00, 0xd9, 0x05, 0x07, 0xb1, 0x00, 0x4f, 0x69, 0x6e, 0x65, 0x2d, 0x1b, 0x00, 0x03, 0x09, 0x42, 0x02, 0x2c, 0x37, 0x30,
+                0xa9, 0x03, 0x21, 0x3c, 0x2f, 0x23, 0x0a, 0x24, 0x3e, 0x0a, 0x31, 0x0a, 0x60, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x51,
+                0x0c, 0x20, 0x3d, 0x22, 0x89, 0x00, 0x61, 0x2f, 0x4a, 0x61, 0x76, 0x61, 0x53, 0x16, 0x00, 0x06, 0x38, 0x0a, 0xaf, 0x63,
+                0x6c, 0x61, 0x73, 0x73, 0x20, 0x4e, 0x6f, 0x74, 0x41, 0x7b, 0x05, 0x01, 0x97, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x4f, 0x66,
+                0x28, 0x29, 0x14, 0x00, 0xf8, 0x01, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x66,
+                0x69, 0x6e, 0xf0, 0x00, 0x16, 0x7d, 0xfa, 0x00, 0x7f, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3b, 0x00, 0x03, 0x19,
+                0x27, 0x71, 0x00, 0x1e, 0x27, 0x41, 0x00, 0x04, 0x08, 0x00, 0x06, 0x9f, 0x00, 0x0f, 0xe1, 0x05, 0x00, 0x0f, 0x9e, 0x00,
+                0x4a, 0x04, 0x70, 0x00, 0x0f, 0x9d, 0x00, 0x02, 0x03, 0x09, 0x00, 0x32, 0x66, 0x75, 0x6e, 0x4c, 0x03, 0x00, 0x10, 0x0d,
+                0x10, 0x54, 0x54, 0x00, 0xf8, 0x03, 0x28, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x73, 0x53, 0x69, 0x6e, 0x63, 0x65, 0x45,
+                0x70, 0x6f, 0x63, 0x68, 0x62, 0x00, 0xfe, 0x04, 0x76, 0x61, 0x72, 0x20, 0x64, 0x61, 0x74, 0x65, 0x20, 0x3d, 0x20, 0x6e,
+                0x65, 0x77, 0x20, 0x44, 0x61, 0x74, 0x65, 0x31, 0x00, 0x20, 0x20, 0x2a, 0x8b, 0x02, 0x60, 0x30, 0x29, 0x3b, 0x20, 0x2f,
+                0x2f, 0x51, 0x0c, 0xd3, 0x76, 0x65, 0x72, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x6d, 0x69, 0x6c, 0x6c, 0x69, 0x2e, 0x00, 0x09,
+                0x52, 0x00, 0x61, 0x79, 0x65, 0x61, 0x72, 0x20, 0x3d, 0x59, 0x00, 0xd7, 0x2e, 0x67, 0x65, 0x74, 0x46, 0x75, 0x6c, 0x6c,
+                0x59, 0x65, 0x61, 0x72, 0x28, 0xa0, 0x02, 0x00, 0x27, 0x00, 0xf0, 0x06, 0x4d, 0x6f, 0x6e, 0x74, 0x68, 0x73, 0x20, 0x3d,
+                0x20, 0x5b, 0x27, 0x4a, 0x61, 0x6e, 0x27, 0x2c, 0x20, 0x27, 0x46, 0x65, 0x62, 0x07, 0x00, 0x30, 0x4d, 0x61, 0x72, 0x07,
+                0x00, 0x21, 0x41, 0x70, 0x07, 0x00, 0x30, 0x4d, 0x61, 0x79, 0x07, 0x00, 0x21, 0x4a, 0x75, 0x23, 0x00, 0x31, 0x4a, 0x75,
+                0x6c, 0x1c, 0x00, 0x20, 0x75, 0x67, 0x07, 0x00, 0x30, 0x53, 0x65, 0x70, 0x07, 0x00, 0x30, 0x4f, 0x63, 0x74, 0x07, 0x00,
+                0x30, 0x4e, 0x6f, 0x76, 0x07, 0x00, 0x5a, 0x44, 0x65, 0x63, 0x27, 0x5d, 0x6b, 0x00, 0x10, 0x6d, 0x6b, 0x00, 0x23, 0x20,
+                0x3d, 0x73, 0x00, 0x14, 0x5b, 0x9a, 0x00, 0x01, 0x0f, 0x00, 0x2b, 0x28, 0x29, 0x2d, 0x00, 0x37, 0x64, 0x61, 0x79, 0xbe,
+                0x00, 0x01, 0x14, 0x01, 0x0b, 0xba, 0x00, 0x40, 0x68, 0x6f, 0x75, 0x72, 0xb9, 0x00, 0x04, 0x24, 0x00, 0x10, 0x48, 0x10,
+                0x00, 0x0c, 0x25, 0x00, 0x60, 0x6d, 0x69, 0x6e, 0x75, 0x74, 0x65, 0x27, 0x00, 0x55, 0x22, 0x30, 0x22, 0x20, 0x2b, 0x2d,
+                0x00, 0x12, 0x4d, 0x18, 0x00, 0x0c, 0x2f, 0x00, 0x03, 0x49, 0x01, 0x0d, 0x2f, 0x00, 0x12, 0x53, 0x18, 0x00, 0x0c, 0x2f,
+                0x00, 0xc0, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x74, 0x65, 0x64, 0x54, 0x69, 0x6d, 0xbf, 0x01, 0x02, 0xe2, 0x00, 0x51,
+                0x2b, 0x20, 0x27, 0x20, 0x27, 0x3d, 0x00, 0x10, 0x79, 0x0c, 0x00, 0x11, 0x2c, 0x0d, 0x00, 0x01, 0x8f, 0x01, 0x04, 0x1a,
+                0x00, 0x02, 0xbb, 0x00, 0x40, 0x2b, 0x20, 0x27, 0x3a, 0x0e, 0x00, 0x03, 0xa4, 0x00, 0x00, 0x21, 0x0b, 0x75, 0x73, 0x74,
+                0x72, 0x28, 0x2d, 0x32, 0x29, 0x1b, 0x00, 0x03, 0x90, 0x00, 0x07, 0x1b, 0x00, 0x06, 0x81, 0x00, 0x03, 0x97, 0x02, 0x09,
+                0x84, 0x00, 0x0d, 0x15, 0x05, 0x05, 0x8c, 0x02, 0xb1, 0x65, 0x73, 0x63, 0x61, 0x70, 0x65, 0x48, 0x74, 0x6d, 0x6c, 0x28,
+                0xf8, 0x0f, 0x08, 0x81, 0x02, 0x40, 0x69, 0x66, 0x20, 0x28, 0x11, 0x04, 0x31, 0x6f, 0x66, 0x20, 0x1c, 0x00, 0x61, 0x20,
+                0x3d, 0x3d, 0x20, 0x27, 0x73, 0x0b, 0x03, 0x43, 0x27, 0x20, 0x7c, 0x7c, 0x15, 0x00, 0x70, 0x69, 0x6e, 0x73, 0x74, 0x61,
+                0x6e, 0x63, 0x26, 0x00, 0x02, 0x27, 0x03, 0x0f, 0x26, 0x03, 0x02, 0x01, 0x2c, 0x00, 0x07, 0x17, 0x00, 0x00, 0x63, 0x0b,
+                0xf0, 0x06, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x28, 0x2f, 0x26, 0x2f, 0x67, 0x2c, 0x20, 0x22, 0x26, 0x61, 0x6d, 0x70,
+                0x3b, 0x22, 0x29, 0xc8, 0x02, 0xcf, 0x6d, 0x61, 0x6b, 0x65, 0x20, 0x69, 0x74, 0x20, 0x66, 0x69, 0x72, 0x73, 0x35, 0x00,
+                0x05, 0x12, 0x20, 0x35, 0x00, 0x30, 0x6e, 0x62, 0x73, 0x36, 0x00, 0x0f, 0x25, 0x00, 0x04, 0x12, 0x3c, 0x25, 0x00, 0x2f,
+                0x6c, 0x74, 0x23, 0x00, 0x07, 0x12, 0x3e, 0x23, 0x00, 0x1f, 0x67, 0x23, 0x00, 0x08, 0x12, 0x22, 0x23, 0x00, 0x3f, 0x71,
+                0x75, 0x6f, 0x25, 0x00, 0x08, 0x13, 0x27, 0xc5, 0x00, 0x57, 0x70, 0x6f, 0x73, 0x3b, 0x22, 0x8f, 0x01, 0x06, 0x47, 0x04,
+                0x08, 0x0a, 0x01, 0x0f, 0x91, 0x01, 0x07, 0xf0, 0x03, 0x73, 0x61, 0x66, 0x65, 0x44, 0x69, 0x76, 0x28, 0x64, 0x69, 0x76,
+                0x69, 0x64, 0x65, 0x6e, 0x64, 0x2c, 0x20, 0x0a, 0x00, 0x3c, 0x73, 0x6f, 0x72, 0x9a, 0x01, 0x04, 0x21, 0x00, 0x00, 0x96,
+                0x01, 0x44, 0x30, 0x20, 0x26, 0x26, 0x28, 0x00, 0x01, 0x10, 0x00, 0x0f, 0x84, 0x01, 0x02, 0x07, 0xc6, 0x06, 0x0d, 0x96,
+                0x00, 0x05, 0x4e, 0x00, 0x14, 0x2f, 0x48, 0x00, 0x0d, 0xa3, 0x00, 0xd0, 0x2f, 0x2f, 0x20, 0x4e, 0x61, 0x4e, 0x20, 0x3c,
+                0x20, 0x2d, 0x49, 0x6e, 0x66, 0x9f, 0x10, 0x47, 0x79, 0x20, 0x3c, 0x20, 0x0b, 0x00, 0x01, 0x09, 0x00, 0x84, 0x65, 0x20,
+                0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x75, 0x04, 0x05, 0xd8, 0x00, 0x00, 0x17, 0x0c, 0x42, 0x61, 0x72, 0x65, 0x4e, 0x1e,
+                0x00, 0x9c, 0x28, 0x6c, 0x68, 0x73, 0x2c, 0x20, 0x72, 0x68, 0x73, 0xd6, 0x00, 0x31, 0x69, 0x73, 0x46, 0x47, 0x00, 0x00,
+                0x21, 0x00, 0x10, 0x29, 0xd6, 0x00, 0x05, 0x11, 0x00, 0x00, 0x2d, 0x00, 0x0f, 0xd7, 0x00, 0x02, 0x50, 0x6c, 0x68, 0x73,
+                0x20, 0x2d, 0x4c, 0x00, 0x07, 0xdf, 0x00, 0x5e, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x51, 0x00, 0x0f, 0x40, 0x00, 0x02, 0x1f,
+                0x31, 0x38, 0x00, 0x0b, 0x0f, 0x78, 0x00, 0x06, 0x1e, 0x2d, 0x39, 0x00, 0x08, 0x26, 0x00, 0x02, 0x45, 0x00, 0x37, 0x4e,
+                0x61, 0x4e, 0xcb, 0x00, 0x00, 0x0e, 0x00, 0x0e, 0x50, 0x00, 0x0f, 0xa1, 0x01, 0x01, 0x0b, 0x8c, 0x00, 0x04, 0x47, 0x00,
+                0x0f, 0x39, 0x00, 0x04, 0x08, 0x8b, 0x00, 0x0f, 0x3a, 0x00, 0x00, 0x0f, 0x73, 0x00, 0x08, 0x0f, 0x39, 0x00, 0x01, 0x0f,
+                0x29, 0x00, 0x02, 0x00, 0x7f, 0x00, 0x00, 0x5b, 0x02, 0x01, 0xb4, 0x01, 0x71, 0x3f, 0x20, 0x30, 0x20, 0x3a, 0x20, 0x28,
+                0x14, 0x00, 0x14, 0x3e, 0x13, 0x00, 0x67, 0x31, 0x20, 0x3a, 0x20, 0x2d, 0x31, 0xfb, 0x02, 0x08, 0x67, 0x02, 0x0f, 0x0e,
+                0x07, 0x07, 0x40, 0x67, 0x65, 0x74, 0x43, 0x7d, 0x14, 0x30, 0x65, 0x72, 0x56, 0xa2, 0x07, 0x10, 0x28, 0xa4, 0x0e, 0xbc,
+                0x2c, 0x20, 0x73, 0x75, 0x62, 0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 0x21, 0x02, 0x01, 0xc3, 0x0e, 0x07, 0x74, 0x04, 0x0a,
+                0x8d, 0x08, 0x3f, 0x7c, 0x7c, 0x20, 0x21, 0x00, 0x01, 0x04, 0x9f, 0x07, 0x0f, 0xc8, 0x01, 0x02, 0x00, 0x31, 0x00, 0x0f,
+                0x1a, 0x03, 0x01, 0xe4, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x61, 0x73, 0x73, 0x65, 0x72, 0x74, 0x0a, 0x05,
+                0x01, 0x5f, 0x00, 0x0b, 0x09, 0x05, 0x0c, 0x73, 0x00, 0x03, 0x08, 0x05, 0x08, 0xf2, 0x09, 0x0f, 0x4b, 0x00, 0x01, 0x05,
+                0xe4, 0x00, 0x0c, 0x50, 0x00, 0x06, 0x19, 0x00, 0x0f, 0x55, 0x00, 0x01, 0x09, 0x0f, 0x01, 0x21, 0x67, 0x5f, 0xa8, 0x0b,
+                0x0a, 0xd9, 0x00, 0x12, 0x67, 0xcf, 0x15, 0x20, 0x65, 0x72, 0x80, 0x15, 0xc1, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65,
+                0x64, 0x2e, 0x61, 0x64, 0x64, 0x3e, 0x01, 0x09, 0x9d, 0x04, 0x07, 0xa3, 0x00, 0x01, 0x32, 0x00, 0x27, 0x20, 0x3d, 0x3e,
+                0x00, 0x10, 0x5b, 0x2f, 0x00, 0x07, 0x81, 0x07, 0x00, 0x71, 0x00, 0x05, 0x28, 0x00, 0x26, 0x3d, 0x3d, 0x36, 0x09, 0x0a,
+                0x7f, 0x00, 0x06, 0x4b, 0x00, 0x28, 0x7b, 0x7d, 0x0e, 0x02, 0x0c, 0x59, 0x00, 0x24, 0x20, 0x3d, 0x2b, 0x00, 0x0f, 0x7f,
+                0x01, 0x01, 0x01, 0xb0, 0x09, 0x06, 0x23, 0x00, 0x15, 0x5b, 0x15, 0x01, 0x0b, 0x91, 0x00, 0x03, 0x28, 0x00, 0x0f, 0x8f,
+                0x00, 0x07, 0x02, 0x27, 0x01, 0xd1, 0x70, 0x6f, 0x70, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x6a,
+                0x02, 0x09, 0x7c, 0x04, 0x08, 0x72, 0x00, 0xd2, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x28,
+                0x29, 0x61, 0x09, 0x0f, 0x26, 0x03, 0x0e, 0x04, 0x3c, 0x00, 0x3f, 0x4e, 0x61, 0x4e, 0x01, 0x03, 0x03, 0x05, 0x17, 0x01,
+                0x07, 0xc9, 0x00, 0x22, 0x20, 0x3d, 0x38, 0x00, 0x0f, 0x98, 0x05, 0x08, 0x09, 0x20, 0x00, 0x0f, 0x3d, 0x03, 0x09, 0x32,
+                0x50, 0x63, 0x74, 0xde, 0x01, 0x0f, 0x30, 0x03, 0x66, 0x03, 0x1f, 0x00, 0x0f, 0xd0, 0x03, 0x03, 0xf0, 0x07, 0x27, 0x61,
+                0x76, 0x67, 0x2e, 0x70, 0x63, 0x74, 0x5f, 0x6f, 0x66, 0x5f, 0x70, 0x65, 0x61, 0x6b, 0x5f, 0x73, 0x75, 0x73, 0x74, 0x61,
+                0xad, 0x01, 0x21, 0x5f, 0x65, 0xc0, 0x14, 0x2e, 0x64, 0x27, 0xb0, 0x12, 0x0f, 0xe7, 0x00, 0x03, 0x00, 0x39, 0x0b, 0x0f,
+                0xea, 0x00, 0x3e, 0x00, 0x20, 0x00, 0x1c, 0x21, 0x56, 0x00, 0x06, 0xe4, 0x0b, 0x0f, 0xd8, 0x0b, 0x00, 0x09, 0x10, 0x01,
+                0x00, 0x9a, 0x09, 0x1f, 0x2e, 0xe3, 0x00, 0x0f, 0x0f, 0xe2, 0x00, 0x11, 0x8f, 0x44, 0x69, 0x6d, 0x55, 0x6e, 0x69, 0x74,
+                0x73, 0xce, 0x01, 0x6c, 0x0f, 0xfe, 0x04, 0x30, 0x0f, 0xa9, 0x04, 0xd4, 0x50, 0x64, 0x69, 0x6d, 0x5f, 0x75, 0xb2, 0x01,
+                0x07, 0xad, 0x04, 0x15, 0x27, 0x15, 0x00, 0x08, 0xee, 0x0c, 0x02, 0xb7, 0x09, 0x05, 0x2e, 0x00, 0x0f, 0x99, 0x00, 0x07,
+                0x08, 0x53, 0x00, 0x08, 0x7c, 0x02, 0x06, 0x45, 0x04, 0x08, 0x61, 0x00, 0x00, 0xed, 0x0c, 0x04, 0x0e, 0x00, 0x0f, 0xe3,
+                0x09, 0x0a, 0x0b, 0x24, 0x00, 0x0f, 0x86, 0x02, 0x02, 0x10, 0x52, 0x2f, 0x1c, 0x0f, 0x8a, 0x07, 0x7c, 0x00, 0x6e, 0x00,
+                0x0f, 0x9d, 0x03, 0x07, 0x09, 0x73, 0x05, 0x0f, 0xbf, 0x07, 0xb3, 0x01, 0xb4, 0x1d, 0x0f, 0x14, 0x03, 0x18, 0x01, 0x30,
+                0x00, 0x01, 0x12, 0x03, 0x02, 0x3a, 0x00, 0x0f, 0x10, 0x03, 0x01, 0x03, 0x24, 0x00, 0x0f, 0x75, 0x02, 0x07, 0x04, 0x45,
+                0x00, 0x0c, 0x0c, 0x03, 0x08, 0x53, 0x00, 0x22, 0x20, 0x3d, 0x27, 0x00, 0x0f, 0xb1, 0x07, 0x09, 0x01, 0x21, 0x00, 0x0f,
+                0xaf, 0x07, 0xaf, 0x0c, 0xc7, 0x00, 0x0f, 0xad, 0x07, 0x32, 0x01, 0x5e, 0x03, 0x0f, 0xab, 0x07, 0x79, 0x0d, 0xef, 0x03,
+                0x4f, 0x27, 0x70, 0x63, 0x74, 0x8b, 0x07, 0x00, 0x0f, 0xc6, 0x00, 0x02, 0x0f, 0x8a, 0x07, 0x86, 0x00, 0xc4, 0x00, 0x0f,
+                0x88, 0x01, 0x0a, 0x15, 0x54, 0xc0, 0x1f, 0x0f, 0xeb, 0x04, 0xff, 0x6e, 0x06, 0x4a, 0x21, 0x0f, 0xf0, 0x04, 0x18, 0x06,
+                0x35, 0x00, 0x01, 0xf5, 0x04, 0x07, 0x44, 0x00, 0x0f, 0xfa, 0x04, 0x01, 0x08, 0x2e, 0x00, 0x0f, 0x78, 0x04, 0x07, 0x09,
+                0x54, 0x00, 0x0c, 0x04, 0x05, 0x0d, 0x62, 0x00, 0x27, 0x20, 0x3d, 0x31, 0x00, 0x0f, 0x0e, 0x05, 0x09, 0x06, 0x26, 0x00,
+                0x0f, 0x13, 0x05, 0xaf, 0x0f, 0xcc, 0x00, 0x02, 0x0f, 0x18, 0x05, 0x32, 0x06, 0x90, 0x03, 0x0f, 0x1d, 0x05, 0x79, 0x0f,
+                0x26, 0x04, 0x03, 0x0f, 0xcb, 0x0c, 0x2e, 0x09, 0xed, 0x00, 0x0f, 0xce, 0x0c, 0xc2, 0xfa, 0x01, 0x74, 0x6f, 0x42, 0x61,
+                0x72, 0x43, 0x68, 0x61, 0x72, 0x74, 0x28, 0x70, 0x63, 0x74, 0x2c, 0x20, 0xd9, 0x18, 0x00, 0xdf, 0x00, 0x29, 0x70, 0x63,
+                0x3a, 0x16, 0x0d, 0xde, 0x00, 0x0f, 0x20, 0x00, 0x00, 0x0f, 0xcd, 0x01, 0x0a, 0x0f, 0xd4, 0x00, 0x03, 0x00, 0xce, 0x04,
+                0x10, 0x74, 0x17, 0x1a, 0x60, 0x6d, 0x70, 0x65, 0x64, 0x50, 0x63, 0xda, 0x03, 0x01, 0x1b, 0x03, 0x42, 0x6d, 0x69, 0x6e,
+                0x28, 0x09, 0x00, 0x22, 0x61, 0x78, 0xa2, 0x00, 0x30, 0x30, 0x29, 0x2c, 0x26, 0x03, 0x03, 0x48, 0x19, 0x00, 0x31, 0x00,
+                0x00, 0x46, 0x19, 0x5b, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x4e, 0x00, 0x01, 0x01, 0x1c, 0x47, 0x20, 0x3d, 0x20, 0x32, 0x53,
+                0x03, 0x02, 0x1a, 0x00, 0x34, 0x62, 0x61, 0x72, 0x1d, 0x00, 0x01, 0x5d, 0x00, 0x67, 0x63, 0x65, 0x69, 0x6c, 0x28, 0x28,
+                0x7e, 0x00, 0x11, 0x2f, 0x63, 0x00, 0x22, 0x20, 0x2a, 0x44, 0x00, 0x07, 0xdb, 0x04, 0x00, 0xd4, 0x1f, 0x0a, 0xea, 0x0b,
+                0xf0, 0x01, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x6c, 0x65, 0x74, 0x20, 0x69, 0x69, 0x20, 0x3d, 0x20, 0x31, 0x3b, 0x08, 0x00,
+                0x25, 0x3c, 0x3d, 0x63, 0x00, 0x00, 0x10, 0x00, 0x2a, 0x2b, 0x2b, 0x0a, 0x01, 0x00, 0x45, 0x00, 0x5f, 0x2b, 0x3d, 0x20,
+                0x63, 0x68, 0xde, 0x01, 0x0a, 0x0e, 0xd8, 0x15, 0x05, 0xb6, 0x01, 0x01, 0xc1, 0x1c, 0xf8, 0x02, 0x55, 0x70, 0x28, 0x6e,
+                0x75, 0x6d, 0x2c, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x65, 0x00, 0x05, 0x15, 0x00, 0x04, 0xe3,
+                0x00, 0x68, 0x70, 0x6f, 0x77, 0x28, 0x31, 0x30, 0x2e, 0x00, 0x0d, 0x89, 0x18, 0x06, 0x0b, 0x01, 0x58, 0x6e, 0x75, 0x6d,
+                0x20, 0x2a, 0x59, 0x00, 0x16, 0x2f, 0x0d, 0x00, 0x0f, 0x96, 0x00, 0x07, 0x02, 0xc9, 0x18, 0x33, 0x5f, 0x70, 0x63, 0x4c,
+                0x02, 0x05, 0x33, 0x00, 0x2f, 0x3d, 0x31, 0x55, 0x02, 0x4d, 0x2f, 0x70, 0x63, 0xdb, 0x05, 0x02, 0x06, 0x59, 0x15, 0x3f,
+                0x70, 0x63, 0x74, 0x1c, 0x16, 0x03, 0x4f, 0x27, 0xe2, 0x9a, 0xa0, 0x92, 0x02, 0x02, 0x01, 0xe0, 0x07, 0x05, 0x5c, 0x16,
+                0x0f, 0x40, 0x00, 0x06, 0x02, 0x9e, 0x02, 0x41, 0x73, 0x69, 0x67, 0x6e, 0x24, 0x00, 0x00, 0x77, 0x07, 0x10, 0x31, 0x64,
+                0x15, 0xa0, 0x27, 0xe2, 0x88, 0x9e, 0x27, 0x20, 0x3a, 0x20, 0x27, 0x2d, 0x09, 0x00, 0x0f, 0xe9, 0x01, 0x08, 0x04, 0xcc,
+                0x01, 0x0a, 0x33, 0x01, 0x60, 0x29, 0x2e, 0x74, 0x6f, 0x4c, 0x6f, 0x52, 0x28, 0x03, 0xd2, 0x1c, 0x05, 0x71, 0x06, 0x30,
+                0x2c, 0x20, 0x7b, 0x71, 0x1a, 0x60, 0x69, 0x6d, 0x75, 0x6d, 0x46, 0x72, 0x21, 0x2a, 0x96, 0x6f, 0x6e, 0x44, 0x69, 0x67,
+                0x69, 0x74, 0x73, 0x3a, 0x3e, 0x00, 0x10, 0x2c, 0x68, 0x1f, 0x0f, 0x22, 0x00, 0x0a, 0x2f, 0x20, 0x7d, 0xfa, 0x04, 0x08,
+                0x03, 0xc9, 0x01, 0x7f, 0x61, 0x76, 0x67, 0x28, 0x61, 0x76, 0x67, 0xc9, 0x01, 0x0a, 0x3f, 0x61, 0x76, 0x67, 0xc9, 0x01,
+                0x0a, 0x0f, 0x20, 0x00, 0x00, 0x0f, 0xc9, 0x01, 0x0a, 0x3f, 0x61, 0x76, 0x67, 0xc9, 0x01, 0x0b, 0x3f, 0x61, 0x76, 0x67,
+                0xc9, 0x01, 0x2a, 0x0f, 0x40, 0x00, 0x06, 0x07, 0xc9, 0x01, 0x00, 0x24, 0x00, 0x0f, 0xc9, 0x01, 0x1f, 0x00, 0x87, 0x05,
+                0x0f, 0xb5, 0x01, 0x6f, 0x59, 0x73, 0x75, 0x6d, 0x28, 0x73, 0x17, 0x04, 0x0e, 0xb5, 0x01, 0x3f, 0x73, 0x75, 0x6d, 0xb5,
+                0x01, 0x0a, 0x0f, 0x20, 0x00, 0x00, 0x0f, 0xb5, 0x01, 0x0a, 0x3f, 0x73, 0x75, 0x6d, 0xb5, 0x01, 0x0b, 0x3f, 0x73, 0x75,
+                0x6d, 0xb5, 0x01, 0x2a, 0x0f, 0x40, 0x00, 0x06, 0x07, 0xb5, 0x01, 0x00, 0x24, 0x00, 0x0f, 0xb5, 0x01, 0x1f, 0x3f, 0x73,
+                0x75, 0x6d, 0xb5, 0x01, 0x69, 0xf0, 0x09, 0x61, 0x64, 0x64, 0x43, 0x65, 0x6c, 0x6c, 0x41, 0x74, 0x74, 0x72, 0x28, 0x74,
+                0x72, 0x6f, 0x77, 0x2c, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x4f, 0x1e, 0x11, 0x2c, 0x67, 0x22, 0x63, 0x2c, 0x20,
+                0x70, 0x61, 0x73, 0x73, 0x89, 0x08, 0x6a, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x2d, 0x08, 0x00, 0x7b, 0x06, 0x20, 0x74,
+                0x64, 0x5a, 0x12, 0xf0, 0x02, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45,
+                0x6c, 0x65, 0x0e, 0x00, 0x37, 0x28, 0x27, 0x74, 0xe6, 0x08, 0x03, 0xaf, 0x06, 0x02, 0x06, 0x07, 0x00, 0x6b, 0x00, 0x37,
+                0x20, 0x69, 0x6e, 0x73, 0x00, 0x0b, 0x68, 0x0b, 0x50, 0x64, 0x2e, 0x73, 0x65, 0x74, 0x9c, 0x00, 0x01, 0x1e, 0x00, 0x10,
+                0x28, 0x28, 0x00, 0x08, 0xa1, 0x00, 0x10, 0x5b, 0x0b, 0x00, 0x1f, 0x5d, 0x42, 0x1d, 0x02, 0x01, 0xcd, 0x0b, 0x2f, 0x65,
+                0x78, 0xe5, 0x05, 0x07, 0x0a, 0x6a, 0x00, 0x00, 0xc4, 0x00, 0x30, 0x73, 0x70, 0x61, 0xad, 0x06, 0x0f, 0xc6, 0x00, 0x05,
+                0x00, 0x1f, 0x00, 0x08, 0xc8, 0x00, 0x11, 0x20, 0x31, 0x00, 0x0a, 0xa1, 0x00, 0x11, 0x22, 0x57, 0x22, 0x4a, 0x22, 0x2c,
+                0x20, 0x22, 0x75, 0x28, 0x08, 0xe6, 0x1d, 0x03, 0x38, 0x00, 0x90, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x48, 0x54, 0x4d, 0x4c,
+                0xce, 0x07, 0x19, 0x2d, 0xb9, 0x13, 0xf0, 0x00, 0x74, 0x64, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x43, 0x68, 0x69,
+                0x6c, 0x64, 0x28, 0x2f, 0x00, 0x08, 0xe4, 0x00, 0x06, 0xb3, 0x1b, 0x0f, 0xe1, 0x00, 0x01, 0x0f, 0x28, 0x03, 0x03, 0x0f,
+                0xe0, 0x00, 0x43, 0x04, 0x6c, 0x00, 0x0f, 0xdf, 0x00, 0x40, 0x0c, 0xd4, 0x0c, 0x07, 0x84, 0x02, 0x0c, 0xca, 0x0c, 0x29,
+                0x74, 0x64, 0x6e, 0x00, 0x00, 0x15, 0x01, 0x0f, 0xc2, 0x0c, 0x0e, 0x0b, 0x34, 0x00, 0x07, 0xdb, 0x20, 0x00, 0x3f, 0x00,
+                0x0f, 0x99, 0x1c, 0x0c, 0x20, 0x20, 0x20, 0x2a, 0x03, 0x09, 0xc5, 0x00, 0x2f, 0x74, 0x64, 0x64, 0x03, 0x0f, 0x63, 0x53,
+                0x69, 0x6d, 0x70, 0x6c, 0x65, 0x66, 0x03, 0x01, 0x49, 0x01, 0x0f, 0x63, 0x03, 0x0a, 0x90, 0x2c, 0x20, 0x74, 0x6f, 0x6f,
+                0x6c, 0x74, 0x69, 0x70, 0x4b, 0x22, 0x18, 0x22, 0xf5, 0x00, 0x0e, 0xb4, 0x03, 0x23, 0x7b, 0x20, 0x9a, 0x01, 0x16, 0x3a,
+                0x59, 0x00, 0x11, 0x22, 0x47, 0x28, 0x25, 0x22, 0x3a, 0x47, 0x00, 0x1f, 0x7d, 0x6d, 0x00, 0x00, 0x0e, 0xb6, 0x00, 0x21,
+                0x2f, 0x2f, 0xa2, 0x03, 0x01, 0x81, 0x0f, 0xcd, 0x67, 0x69, 0x6e, 0x67, 0x20, 0x75, 0x74, 0x69, 0x6c, 0x69, 0x74, 0x79,
+                0xa5, 0x1f, 0x00, 0xe3, 0x2a, 0x15, 0x52, 0x86, 0x0f, 0x11, 0x4d, 0xe2, 0x0d, 0x19, 0x73, 0xf8, 0x24, 0x0f, 0xb3, 0x17,
+                0x03, 0x01, 0x39, 0x00, 0x08, 0x07, 0x23, 0x0f, 0xc4, 0x14, 0x01, 0x0f, 0x25, 0x00, 0x00, 0x0f, 0xfe, 0x0f, 0x04, 0x0b,
+                0x2a, 0x00, 0x0f, 0x61, 0x0c, 0x00, 0x00, 0x35, 0x2f, 0x93, 0x5f, 0x52, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x3a,
+                0x19, 0x21, 0x73, 0x28, 0x17, 0x00, 0x0c, 0xc7, 0x04, 0x02, 0xa8, 0x0e, 0x31, 0x4e, 0x61, 0x6d, 0xf0, 0x23, 0x17, 0x5b,
+                0x7d, 0x0f, 0x33, 0x66, 0x6f, 0x72, 0xb5, 0x04, 0x04, 0x0a, 0x18, 0x2f, 0x6f, 0x66, 0xe1, 0x00, 0x03, 0x0a, 0x9f, 0x02,
+                0x07, 0x52, 0x00, 0x54, 0x2e, 0x70, 0x75, 0x73, 0x68, 0x6c, 0x18, 0x0f, 0xb5, 0x04, 0x02, 0x08, 0x2d, 0x00, 0x40, 0x73,
+                0x6f, 0x72, 0x74, 0xd7, 0x00, 0x0f, 0x38, 0x05, 0x01, 0x06, 0x28, 0x00, 0x00, 0x86, 0x00, 0x07, 0x36, 0x00, 0x0a, 0x7c,
+                0x00, 0x00, 0x60, 0x24, 0x00, 0x20, 0x02, 0x0f, 0x9b, 0x05, 0x09, 0x1a, 0x72, 0xf3, 0x03, 0x0f, 0xab, 0x02, 0x01, 0x30,
+                0x22, 0x6c, 0x61, 0xf2, 0x03, 0x10, 0x27, 0xce, 0x24, 0x07, 0x7a, 0x00, 0x5a, 0x2b, 0x20, 0x22, 0x27, 0x2c, 0xfa, 0x03,
+                0x01, 0x54, 0x01, 0x0a, 0x18, 0x03, 0x3f, 0x72, 0x6f, 0x77, 0xe2, 0x22, 0x09, 0x07, 0xbc, 0x00, 0x0f, 0xc2, 0x01, 0x15,
+                0x01, 0x52, 0x14, 0x0f, 0xc0, 0x01, 0x28, 0x02, 0xbc, 0x16, 0x01, 0xbe, 0x01, 0x0d, 0x78, 0x02, 0x0f, 0xbc, 0x01, 0x0c,
+                0x01, 0x30, 0x00, 0x0f, 0xba, 0x01, 0xff, 0x28, 0x06, 0xcd, 0x10, 0x0f, 0xbf, 0x01, 0x28, 0x07, 0x7c, 0x13, 0x01, 0xc4,
+                0x01, 0x0f, 0x17, 0x04, 0x03, 0x0f, 0xc9, 0x01, 0x0c, 0x06, 0x35, 0x00, 0x0f, 0xce, 0x01, 0xff, 0x11, 0x00, 0xe6, 0x10,
+                0x31, 0x61, 0x6c, 0x63, 0x51, 0x14, 0x50, 0x20, 0x74, 0x68, 0x65, 0x20, 0xcb, 0x00, 0x01, 0x4d, 0x08, 0x00, 0x01, 0x12,
+                0x20, 0x64, 0x20, 0xaa, 0x12, 0x40, 0x72, 0x6f, 0x75, 0x70, 0x2d, 0x06, 0xd2, 0x72, 0x6f, 0x77, 0x73, 0x20, 0x74, 0x68,
+                0x61, 0x74, 0x20, 0x68, 0x61, 0x76, 0x2e, 0x00, 0x10, 0x73, 0xa5, 0x00, 0x05, 0xb4, 0x09, 0x00, 0x71, 0x00, 0xa1, 0x72,
+                0x69, 0x65, 0x76, 0x65, 0x64, 0x20, 0x76, 0x69, 0x61, 0x22, 0x18, 0x26, 0x6f, 0x77, 0x61, 0x08, 0x26, 0x29, 0x2c, 0x75,
+                0x00, 0x04, 0xea, 0x24, 0x00, 0x00, 0x08, 0x00, 0x49, 0x00, 0x71, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x7f, 0x00,
+                0x20, 0x68, 0x61, 0x67, 0x00, 0x0d, 0x5d, 0x00, 0x30, 0x61, 0x73, 0x20, 0x0a, 0x1d, 0x80, 0x70, 0x72, 0x65, 0x76, 0x69,
+                0x6f, 0x75, 0x73, 0x2b, 0x00, 0x0d, 0xb8, 0x06, 0xb0, 0x61, 0x6c, 0x63, 0x52, 0x6f, 0x77, 0x53, 0x70, 0x61, 0x6e, 0x28,
+                0xae, 0x00, 0x10, 0x2c, 0x25, 0x00, 0x4c, 0x49, 0x64, 0x78, 0x2c, 0x8c, 0x00, 0x0c, 0x9d, 0x02, 0x00, 0x2d, 0x00, 0x02,
+                0x42, 0x09, 0x07, 0xce, 0x11, 0x01, 0x26, 0x0c, 0x02, 0x41, 0x00, 0x00, 0xb8, 0x0c, 0x0c, 0xcf, 0x00, 0x00, 0x34, 0x00,
+                0x12, 0x5b, 0x1f, 0x00, 0x5f, 0x5d, 0x29, 0x20, 0x21, 0x3d, 0x21, 0x00, 0x09, 0x5b, 0x20, 0x2d, 0x20, 0x31, 0x5d, 0x65,
+                0x0c, 0x0a, 0xdb, 0x11, 0x02, 0x28, 0x00, 0x02, 0xe0, 0x11, 0x01, 0x8f, 0x00, 0x50, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0xe2,
+                0x11, 0x4c, 0x2b, 0x2b, 0x69, 0x69, 0x17, 0x09, 0x01, 0x0a, 0x16, 0x0f, 0x90, 0x00, 0x22, 0x2c, 0x69, 0x69, 0x88, 0x00,
+                0x01, 0x34, 0x12, 0x00, 0x9f, 0x34, 0x08, 0x66, 0x02, 0x0a, 0xf1, 0x15, 0x43, 0x20, 0x20, 0x2b, 0x2b, 0x23, 0x01, 0x0f,
+                0x3e, 0x09, 0x0d, 0x05, 0x78, 0x10, 0x09, 0x2e, 0x00, 0x0f, 0x51, 0x0e, 0x05, 0x02, 0x5a, 0x08, 0x80, 0x46, 0x6f, 0x72,
+                0x6d, 0x75, 0x6c, 0x61, 0x28, 0x14, 0x00, 0x3c, 0x75, 0x6c, 0x61, 0x51, 0x0e, 0x1f, 0x21, 0x18, 0x00, 0x00, 0x0f, 0xc5,
+                0x14, 0x13, 0x30, 0x27, 0x4e, 0x73, 0xf9, 0x2e, 0x93, 0x20, 0x50, 0x65, 0x72, 0x66, 0x20, 0x53, 0x44, 0x4b, 0x0b, 0x03,
+                0x41, 0x28, 0x73, 0x29, 0x3a, 0x69, 0x2b, 0x03, 0x59, 0x00, 0x07, 0xa6, 0x00, 0x0f, 0xe6, 0x04, 0x04, 0x42, 0x43, 0x6f,
+                0x6c, 0x6c, 0x02, 0x31, 0x4e, 0x49, 0x6e, 0x66, 0x6f, 0xe1, 0x04, 0x02, 0x72, 0x2e, 0x19, 0x52, 0x70, 0x31, 0x03, 0x0f,
+                0x14, 0x70, 0x72, 0x75, 0x63, 0x74, 0x6f, 0x72, 0x28, 0xe0, 0x35, 0x12, 0x2c, 0x02, 0x17, 0x01, 0x2d, 0x00, 0x03, 0x0c,
+                0x00, 0x0d, 0xf0, 0x0a, 0x41, 0x68, 0x69, 0x73, 0x2e, 0x0c, 0x36, 0x11, 0x3d, 0x28, 0x3a, 0x0a, 0x94, 0x01, 0x01, 0x1e,
+                0x00, 0x06, 0x44, 0x00, 0x04, 0x73, 0x17, 0x01, 0x0d, 0x00, 0x0f, 0x2a, 0x00, 0x05, 0x0e, 0x98, 0x17, 0x0a, 0xb9, 0x01,
+                0x0d, 0x08, 0x03, 0x00, 0x9e, 0x05, 0x07, 0x2c, 0x00, 0x00, 0x74, 0x2e, 0x56, 0x52, 0x6f, 0x77, 0x28, 0x27, 0x04, 0x01,
+                0x10, 0x20, 0x4c, 0x2c, 0x1a, 0x27, 0x42, 0x02, 0x05, 0x01, 0x00, 0x64, 0x2c, 0x20, 0x22, 0x72, 0x61, 0x22, 0x0c, 0x00,
+                0x06, 0xe4, 0x2e, 0x11, 0x67, 0x89, 0x3c, 0x1f, 0x29, 0x36, 0x00, 0x04, 0x0f, 0x01, 0x00, 0x01, 0x05, 0x30, 0x04, 0x09,
+                0x87, 0x00, 0x40, 0x47, 0x50, 0x55, 0x20, 0xcc, 0x04, 0x0f, 0x80, 0x00, 0x05, 0x0f, 0x87, 0x00, 0x02, 0x00, 0x75, 0x1a,
+                0x00, 0x56, 0x3b, 0x41, 0x2e, 0x67, 0x70, 0x75, 0x59, 0x05, 0x0f, 0x87, 0x00, 0x2e, 0x4f, 0x43, 0x68, 0x69, 0x70, 0x88,
+                0x00, 0x10, 0x0f, 0x87, 0x00, 0x04, 0x4f, 0x63, 0x68, 0x69, 0x70, 0x88, 0x00, 0x1c, 0x0f, 0x87, 0x00, 0x03, 0x20, 0x23,
+                0x52, 0x9b, 0x16, 0x1f, 0x73, 0x0d, 0x01, 0x0c, 0x0d, 0x87, 0x00, 0x01, 0xd1, 0x16, 0x04, 0x63, 0x04, 0x17, 0x2e, 0xd9,
+                0x30, 0x0f, 0x87, 0x00, 0x11, 0x05, 0x88, 0x00, 0x1f, 0x5d, 0x3a, 0x07, 0x03, 0x00, 0xc4, 0x05, 0x21, 0x6f, 0x66, 0x4c,
+                0x02, 0x0f, 0x2c, 0x07, 0x45, 0x00, 0x71, 0x1c, 0x41, 0x68, 0x64, 0x72, 0x22, 0xe1, 0x05, 0x01, 0x30, 0x03, 0x0f, 0x36,
+                0x00, 0x0e, 0x00, 0x29, 0x00, 0x08, 0x7f, 0x03, 0x05, 0x10, 0x00, 0x0f, 0x5e, 0x07, 0x23, 0x03, 0x39, 0x03, 0x02, 0xf2,
+                0x00, 0xf0, 0x0f, 0x49, 0x53, 0x5f, 0x43, 0x4f, 0x4c, 0x55, 0x4d, 0x4e, 0x5f, 0x41, 0x53, 0x43, 0x45, 0x4e, 0x44, 0x49,
+                0x4e, 0x47, 0x5f, 0x42, 0x59, 0x5f, 0x44, 0x45, 0x46, 0x41, 0x55, 0x4c, 0x54, 0x51, 0x03, 0x30, 0x74, 0x72, 0x75, 0xf5,
+                0x0d, 0x01, 0x06, 0x00, 0x03, 0x02, 0x0e, 0x0f, 0x07, 0x00, 0x5b, 0x03, 0x70, 0x09, 0x02, 0xb0, 0x00, 0xd0, 0x69, 0x73,
+                0x43, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x41, 0x73, 0x63, 0x65, 0x6e, 0xa9, 0x35, 0x06, 0xa3, 0x00, 0x4f, 0x6e, 0x75, 0x6c,
+                0x6c, 0x06, 0x00, 0x53, 0x03, 0x92, 0x00, 0x01, 0xbe, 0x10, 0x30, 0x6f, 0x72, 0x74, 0xbf, 0x0d, 0x00, 0x94, 0x00, 0x52,
+                0x49, 0x6e, 0x64, 0x65, 0x78, 0x89, 0x07, 0x01, 0x20, 0x00, 0x06, 0x12, 0x2f, 0x02, 0xe2, 0x3e, 0x10, 0x5f, 0x2d, 0x00,
+                0x10, 0x54, 0x9a, 0x10, 0x30, 0x28, 0x73, 0x65, 0x91, 0x04, 0x09, 0x39, 0x00, 0x50, 0x2c, 0x20, 0x65, 0x78, 0x74, 0x2d,
+                0x13, 0x01, 0xaa, 0x1b, 0x14, 0x2c, 0x6f, 0x2e, 0x06, 0x88, 0x02, 0x01, 0x84, 0x02, 0x01, 0x8b, 0x14, 0x07, 0x85, 0x02,
+                0x33, 0x67, 0x65, 0x74, 0x82, 0x02, 0x61, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x21, 0x00, 0x00, 0xed, 0x14, 0x00, 0x71,
+                0x00, 0x06, 0x7f, 0x09, 0x00, 0x3c, 0x00, 0x03, 0x22, 0x05, 0x01, 0x22, 0x00, 0x10, 0x2e, 0x0d, 0x00, 0x04, 0x1d, 0x00,
+                0x02, 0x5a, 0x01, 0xa2, 0x6e, 0x75, 0x6d, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x52, 0x28, 0x00, 0x05, 0x58, 0x2d, 0x01,
+                0x7b, 0x23, 0x06, 0xd7, 0x07, 0x2b, 0x20, 0x3c, 0x2b, 0x00, 0x38, 0x2b, 0x20, 0x32, 0x2d, 0x03, 0x02, 0xc1, 0x06, 0x0f,
+                0xaf, 0x09, 0x01, 0x82, 0x64, 0x65, 0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e, 0x81, 0x09, 0x01, 0x85, 0x37, 0x02, 0x95, 0x09,
+                0x61, 0x77, 0x65, 0x20, 0x77, 0x61, 0x6e, 0xf6, 0x33, 0x00, 0x23, 0x01, 0x07, 0x78, 0x00, 0x0d, 0xef, 0x01, 0x1f, 0x5b,
+                0x3a, 0x01, 0x00, 0x10, 0x5d, 0xdf, 0x14, 0x00, 0x98, 0x01, 0x09, 0x7f, 0x07, 0x0f, 0x3a, 0x00, 0x14, 0x0f, 0x02, 0x03,
+                0x0c, 0x0f, 0x36, 0x00, 0x02, 0x05, 0xdd, 0x00, 0x06, 0xf4, 0x12, 0x0f, 0x27, 0x00, 0x00, 0x00, 0x96, 0x00, 0x0d, 0x1f,
+                0x02, 0x0f, 0xa3, 0x00, 0x22, 0x1f, 0x21, 0x2a, 0x00, 0x13, 0x0b, 0x97, 0x00, 0x06, 0x69, 0x00, 0x71, 0x2f, 0x2f, 0x20,
+                0x6b, 0x65, 0x65, 0x70, 0x77, 0x01, 0x05, 0x85, 0x0a, 0x01, 0x80, 0x01, 0x0c, 0xa6, 0x01, 0x0f, 0xcf, 0x02, 0x01, 0x0f,
+                0x6b, 0x00, 0x00, 0x05, 0x3e, 0x05, 0x01, 0x5b, 0x34, 0x30, 0x74, 0x6f, 0x72, 0x94, 0x02, 0x06, 0x19, 0x0d, 0x01, 0x52,
+                0x05, 0x00, 0x1b, 0x00, 0x01, 0x20, 0x0a, 0x09, 0x2e, 0x02, 0x0f, 0x27, 0x0a, 0x01, 0x0c, 0x09, 0x1c, 0x03, 0xad, 0x02,
+                0x02, 0x5b, 0x0a, 0x01, 0xf8, 0x09, 0x0a, 0x9d, 0x34, 0x04, 0x1d, 0x08, 0x08, 0x30, 0x03, 0x00, 0xa2, 0x02, 0x07, 0x0d,
+                0x03, 0x60, 0x73, 0x42, 0x79, 0x54, 0x61, 0x67, 0xa8, 0x06, 0x6f, 0x28, 0x22, 0x54, 0x44, 0x22, 0x29, 0x30, 0x01, 0x02,
+                0x02, 0x6c, 0x13, 0x1a, 0x54, 0x5a, 0x13, 0x01, 0xce, 0x00, 0x02, 0x8f, 0x0d, 0x11, 0x5b, 0x69, 0x00, 0x01, 0x70, 0x05,
+                0x06, 0xce, 0x15, 0x04, 0x46, 0x05, 0x02, 0x28, 0x00, 0x01, 0x87, 0x0d, 0x04, 0xe8, 0x03, 0x00, 0x4d, 0x30, 0x51, 0x5f,
+                0x70, 0x61, 0x69, 0x72, 0x18, 0x32, 0x01, 0x0a, 0x00, 0x09, 0x6a, 0x09, 0x02, 0x63, 0x06, 0x10, 0x65, 0xc4, 0x1d, 0x03,
+                0xdd, 0x03, 0x05, 0x32, 0x00, 0x36, 0x5b, 0x30, 0x5d, 0x35, 0x00, 0x28, 0x5b, 0x30, 0x3d, 0x16, 0x0f, 0x07, 0x03, 0x17,
+                0x0f, 0x66, 0x0a, 0x02, 0x28, 0x72, 0x65, 0x02, 0x1c, 0x0e, 0x75, 0x14, 0x04, 0x80, 0x31, 0x0a, 0x28, 0x00, 0x04, 0xed,
+                0x00, 0x05, 0x88, 0x00, 0x50, 0x2f, 0x2f, 0x20, 0x6e, 0x6f, 0x1c, 0x33, 0xf0, 0x12, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x61,
+                0x72, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x64, 0x3a, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x73, 0x74,
+                0x61, 0x63, 0x6b, 0x6f, 0x76, 0x65, 0x72, 0xbc, 0x3b, 0x00, 0x43, 0x3f, 0x50, 0x2f, 0x71, 0x75, 0x65, 0x73, 0x17, 0x01,
+                0xf2, 0x05, 0x73, 0x2f, 0x31, 0x32, 0x31, 0x34, 0x36, 0x38, 0x38, 0x38, 0x2f, 0x77, 0x68, 0x79, 0x2d, 0x64, 0x6f, 0x65,
+                0x73, 0x2d, 0xa7, 0x06, 0x10, 0x63, 0xa7, 0x06, 0x10, 0x2d, 0x49, 0x00, 0x40, 0x73, 0x2d, 0x61, 0x2d, 0x5b, 0x00, 0x0f,
+                0x41, 0x02, 0x02, 0x13, 0x30, 0x35, 0x02, 0x02, 0x73, 0x01, 0x0f, 0x36, 0x02, 0x05, 0x02, 0xd8, 0x04, 0x09, 0xc3, 0x15,
+                0x00, 0x30, 0x00, 0x00, 0x3f, 0x02, 0x2c, 0x5b, 0x31, 0xc0, 0x01, 0x03, 0xf1, 0x02, 0x0b, 0x2c, 0x0b, 0x03, 0x8a, 0x44,
+                0x0c, 0x25, 0x0b, 0x00, 0xe8, 0x05, 0x30, 0x61, 0x64, 0x64, 0x24, 0x0b, 0x15, 0x3d, 0x33, 0x00, 0x11, 0x28, 0x89, 0x08,
+                0x03, 0xba, 0x05, 0x01, 0x0c, 0x00, 0x00, 0x6e, 0x02, 0x51, 0x2c, 0x20, 0x70, 0x65, 0x72, 0xd9, 0x08, 0x02, 0xb6, 0x44,
+                0x4c, 0x4c, 0x69, 0x6e, 0x6b, 0xb2, 0x0d, 0x00, 0x35, 0x41, 0x01, 0x42, 0x09, 0x00, 0x69, 0x28, 0x03, 0x38, 0x00, 0x08,
+                0xc2, 0x3b, 0xa0, 0x74, 0x20, 0x68, 0x69, 0x65, 0x72, 0x61, 0x72, 0x63, 0x68, 0x29, 0x38, 0x05, 0x23, 0x00, 0x98, 0x2e,
+                0x73, 0x70, 0x6c, 0x69, 0x74, 0x28, 0x27, 0x2f, 0x67, 0x08, 0x00, 0x2e, 0x00, 0x43, 0x6c, 0x65, 0x61, 0x66, 0x50, 0x00,
+                0x05, 0x39, 0x00, 0x15, 0x5b, 0x0a, 0x00, 0x04, 0xb6, 0x05, 0x00, 0xc7, 0x0d, 0x0a, 0x47, 0x03, 0x0f, 0xd0, 0x08, 0x1a,
+                0x0f, 0x98, 0x08, 0x01, 0x43, 0x27, 0x72, 0x61, 0x27, 0xfc, 0x00, 0x03, 0x08, 0x01, 0x00, 0xc3, 0x15, 0x03, 0xc5, 0x10,
+                0x10, 0x3d, 0x95, 0x07, 0x0f, 0x41, 0x00, 0x0d, 0x51, 0x6c, 0x61, 0x20, 0x77, 0x77, 0x11, 0x01, 0x01, 0x46, 0x42, 0x28,
+                0x27, 0x2c, 0xf3, 0x16, 0x04, 0x28, 0x01, 0x7f, 0x29, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x28, 0x59, 0x01, 0x00, 0x02, 0x97,
+                0x08, 0x0f, 0xa6, 0x00, 0x12, 0x07, 0xbb, 0x1d, 0x0c, 0xdf, 0x2f, 0x1e, 0x27, 0x6c, 0x48, 0x00, 0xdb, 0x38, 0x6e, 0x61,
+                0x76, 0x67, 0x27, 0x29, 0x29, 0xd4, 0x00, 0x04, 0x4c, 0x00, 0x0a, 0x01, 0x0e, 0x0f, 0x45, 0x00, 0x00, 0x00, 0x80, 0x22,
+                0x2f, 0x27, 0x29, 0x9e, 0x00, 0x19, 0x00, 0x22, 0x20, 0x0a, 0x10, 0x31, 0x1d, 0x27, 0xf5, 0x48, 0x0f, 0x9b, 0x00, 0x21,
+                0x0c, 0x44, 0x00, 0x0f, 0x1a, 0x23, 0x10, 0x0f, 0xb8, 0x00, 0x13, 0x0e, 0x4c, 0x01, 0x0a, 0xee, 0x49, 0x00, 0xad, 0x00,
+                0x41, 0x73, 0x75, 0x6d, 0x27, 0x7b, 0x1c, 0x81, 0x26, 0x23, 0x78, 0x32, 0x37, 0x31, 0x33, 0x3b, 0x80, 0x1c, 0x1f, 0x27,
+                0xbf, 0x00, 0x17, 0x0a, 0x53, 0x00, 0x11, 0x2e, 0x50, 0x00, 0x0f, 0x9e, 0x00, 0x24, 0x0e, 0x31, 0x4a, 0x0f, 0xa2, 0x00,
+                0x32, 0x0e, 0x57, 0x00, 0x0f, 0xa6, 0x00, 0x18, 0x07, 0xa0, 0x1e, 0x0f, 0x4e, 0x01, 0x02, 0x0f, 0x2d, 0x4b, 0x0f, 0x05,
+                0xc4, 0x00, 0x0f, 0x54, 0x01, 0x1b, 0x0f, 0x59, 0x00, 0x0f, 0x0f, 0xc6, 0x00, 0x34, 0x0c, 0x94, 0x4b, 0x0f, 0xb0, 0x00,
+                0x20, 0x0c, 0x43, 0x00, 0x0f, 0x9a, 0x00, 0x35, 0x0f, 0xf8, 0x4b, 0x10, 0x0f, 0xae, 0x00, 0x21, 0x0f, 0x57, 0x00, 0x10,
+                0x0f, 0xc2, 0x00, 0x44, 0x0f, 0xdf, 0x4c, 0x01, 0x0f, 0xc2, 0x00, 0x30, 0x0f, 0x57, 0x00, 0x01, 0x0f, 0xc2, 0x00, 0x1f,
+                0x03, 0xe0, 0x04, 0x0a, 0x2b, 0x29, 0x1a, 0x27, 0xbf, 0x4c, 0x0f, 0xa6, 0x00, 0x18, 0x0f, 0x89, 0x28, 0x01, 0x0e, 0x4e,
+                0x00, 0x0f, 0xa1, 0x00, 0x2f, 0x0d, 0xd7, 0x4d, 0x0f, 0xa4, 0x00, 0x2d, 0x0f, 0x51, 0x00, 0x01, 0x0f, 0xa7, 0x00, 0x30,
+                0x0a, 0x6c, 0x4e, 0x0f, 0xa5, 0x00, 0x2e, 0x0d, 0x4f, 0x00, 0x0f, 0xa3, 0x00, 0x2f, 0x0c, 0x32, 0x4f, 0x0f, 0xa4, 0x00,
+                0x2d, 0x0f, 0x50, 0x00, 0x00, 0x0f, 0xa5, 0x00, 0x2f, 0x0c, 0xa4, 0x4f, 0x0f, 0xa5, 0x00, 0x2d, 0x0f, 0x50, 0x00, 0x00,
+                0x0f, 0xa5, 0x00, 0x30, 0x0a, 0x38, 0x50, 0x0f, 0xa4, 0x00, 0x2e, 0x0d, 0x4f, 0x00, 0x0f, 0xa3, 0x00, 0x1d, 0x05, 0x8d,
+                0x2a, 0x0e, 0xac, 0x00, 0x0b, 0x91, 0x50, 0x00, 0x59, 0x07, 0x0f, 0x25, 0x00, 0x00, 0x0a, 0xa6, 0x50, 0x0f, 0x25, 0x00,
+                0x03, 0x0b, 0x1e, 0x51, 0x00, 0xa7, 0x00, 0x0f, 0xd3, 0x04, 0x16, 0x00, 0x9c, 0x00, 0x00, 0x3a, 0x17, 0x0f, 0x00, 0x01,
+                0x02, 0x0d, 0xa3, 0x00, 0x06, 0xe0, 0x42, 0x0f, 0x30, 0x00, 0x03, 0x0c, 0xae, 0x00, 0x0f, 0x30, 0x00, 0x0c, 0x0d, 0xb9,
+                0x00, 0x00, 0x30, 0x00, 0x1f, 0x29, 0x3e, 0x05, 0x31, 0x0e, 0x10, 0x52, 0x0f, 0x0c, 0x02, 0x2d, 0x0f, 0x52, 0x00, 0x02,
+                0x0f, 0xb2, 0x02, 0x30, 0x0b, 0x77, 0x52, 0x0f, 0xb3, 0x02, 0x2e, 0x0e, 0x50, 0x00, 0x0f, 0xa5, 0x00, 0x2f, 0x0c, 0x1c,
+                0x53, 0x0f, 0xa5, 0x00, 0x2d, 0x0f, 0x50, 0x00, 0x00, 0x0f, 0xa5, 0x00, 0x2f, 0x0c, 0x89, 0x54, 0x0f, 0xa5, 0x00, 0x2d,
+                0x0f, 0x50, 0x00, 0x00, 0x08, 0x5a, 0x1e, 0x0f, 0x59, 0x16, 0x0c, 0x15, 0x7d, 0x2b, 0x00, 0x05, 0x9d, 0x17, 0x75, 0x66,
+                0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x19, 0x11, 0x00, 0xbb, 0x37, 0x05, 0x21, 0x0f, 0x06, 0x30, 0x0e, 0x0f, 0x95, 0x23,
+                0x03, 0x03, 0x05, 0x38, 0x00, 0x49, 0x00, 0x06, 0xc5, 0x3a, 0x05, 0x40, 0x00, 0x10, 0x5d, 0xd0, 0x1c, 0x08, 0xdc, 0x32,
+                0x04, 0x2f, 0x21, 0x08, 0x37, 0x00, 0x03, 0xf0, 0x37, 0x0f, 0x35, 0x00, 0x09, 0x07, 0xa0, 0x1f, 0x08, 0x3a, 0x00, 0x08,
+                0x26, 0x33, 0x0f, 0x3f, 0x00, 0x07, 0x0e, 0x8b, 0x0e, 0x06, 0x44, 0x00, 0x51, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0xce, 0x0e,
+                0x03, 0x42, 0x00, 0x0a, 0x9c, 0x13, 0x01, 0xf5, 0x01, 0x00, 0x00, 0x19, 0x0f, 0x3f, 0x10, 0x17, 0x05, 0x69, 0x01, 0x03,
+                0x0a, 0x00, 0x0e, 0x92, 0x1c, 0xc1, 0x6f, 0x6e, 0x42, 0x6f, 0x64, 0x79, 0x4c, 0x6f, 0x61, 0x64, 0x65, 0x64, 0xeb, 0x24,
+                0x0f, 0xb7, 0x34, 0x0f, 0x0f, 0x28, 0x25, 0x05, 0x0f, 0x3e, 0x4a, 0x02, 0x0f, 0x49, 0x1c, 0x01, 0x0f, 0x82, 0x16, 0x05,
+                0x12, 0x27, 0x2e, 0x00, 0x00, 0xd5, 0x53, 0x03, 0x38, 0x4e, 0x41, 0x69, 0x6e, 0x66, 0x6f, 0xea, 0x04, 0x0f, 0x96, 0x00,
+                0x10, 0x06, 0x04, 0x02, 0x0f, 0x20, 0x25, 0x04, 0x0f, 0x77, 0x00, 0x0c, 0x13, 0x72, 0x30, 0x00, 0x06, 0x02, 0x25, 0x0a,
+                0xb7, 0x00, 0x09, 0x72, 0x05, 0x02, 0x89, 0x00, 0x52, 0x4a, 0x53, 0x4f, 0x4e, 0x2e, 0x11, 0x36, 0x34, 0x69, 0x66, 0x79,
+                0x09, 0x25, 0x11, 0x73, 0x88, 0x1e, 0x0b, 0x1c, 0x00, 0x1e, 0x5b, 0x81, 0x1e, 0x20, 0x61, 0x6c, 0x65, 0x36, 0x1b, 0x22,
+                0x66, 0x00, 0x24, 0x73, 0x20, 0x89, 0x00, 0x06, 0xd3, 0x00, 0x40, 0x6d, 0x69, 0x73, 0x6d, 0x21, 0x0e, 0x50, 0x21, 0x20,
+                0x50, 0x6c, 0x65, 0xa3, 0x32, 0x10, 0x70, 0x68, 0x05, 0x01, 0x94, 0x15, 0x00, 0xc3, 0x20, 0x50, 0x73, 0x74, 0x20, 0x6c,
+                0x69, 0x49, 0x22, 0x11, 0x6f, 0x13, 0x00, 0xaa, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x2e, 0x44, 0x21,
+                0x06, 0xe0, 0x36, 0x3f, 0x6c, 0x6f, 0x67, 0x78, 0x00, 0x1b, 0x0f, 0x49, 0x00, 0x0a, 0x90, 0x41, 0x63, 0x74, 0x75, 0x61,
+                0x6c, 0x3a, 0x20, 0x22, 0x79, 0x18, 0x03, 0x02, 0x01, 0x0f, 0x2f, 0x00, 0x08, 0x14, 0x47, 0x9f, 0x00, 0x4a, 0x3a, 0x20,
+                0x5b, 0x5d, 0x59, 0x00, 0x0d, 0x82, 0x3a, 0x0e, 0xce, 0x01, 0x03, 0x2c, 0x25, 0x0f, 0xcc, 0x01, 0x15, 0x03, 0x10, 0x25,
+                0x0f, 0xca, 0x01, 0x1d, 0x02, 0x37, 0x00, 0x0f, 0xc8, 0x01, 0x35, 0x03, 0xcb, 0x00, 0x61, 0x64, 0x6f, 0x6e, 0x27, 0x74,
+                0x20, 0x51, 0x01, 0x01, 0xa8, 0x01, 0x61, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0xf0, 0x11, 0x0f, 0xd9, 0x01, 0x54, 0x03,
+                0x89, 0x00, 0x0f, 0xd7, 0x01, 0x1e, 0x03, 0x0f, 0x01, 0x0f, 0xd5, 0x01, 0x2f, 0x0a, 0x3b, 0x05, 0x0f, 0x4c, 0x25, 0x07,
+                0x0f, 0xdf, 0x01, 0x15, 0x08, 0x2b, 0x25, 0x0f, 0xe4, 0x01, 0x1d, 0x07, 0x3c, 0x00, 0x0f, 0xe9, 0x01, 0x35, 0x08, 0xdf,
+                0x00, 0x0f, 0xee, 0x01, 0x6f, 0x08, 0x8e, 0x00, 0x0f, 0xf3, 0x01, 0x1e, 0x08, 0x1e, 0x01, 0x0f, 0xf8, 0x01, 0x2d, 0x07,
+                0x6f, 0x21, 0x0f, 0x55, 0x06, 0x38, 0x04, 0x72, 0x17, 0x0f, 0x2c, 0x02, 0x0c, 0x03, 0xd0, 0x1c, 0x0f, 0x46, 0x06, 0x67,
+                0x02, 0xac, 0x20, 0x03, 0xae, 0x00, 0x0f, 0x45, 0x06, 0x2c, 0x0f, 0x24, 0x15, 0x00, 0x0f, 0xe8, 0x13, 0x17, 0x0f, 0xac,
+                0x16, 0x03, 0x0f, 0x26, 0x16, 0x02, 0x0f, 0xed, 0x14, 0x03, 0x0f, 0x8d, 0x13, 0x01, 0x0f, 0x45, 0x12, 0x15, 0x0f, 0x2f,
+                0x13, 0x12, 0x0f, 0x73, 0x03, 0x06, 0x0a, 0x44, 0x01, 0x0f, 0x23, 0x07, 0x56, 0x0f, 0x77, 0x00, 0x18, 0x0f, 0x22, 0x07,
+                0x45, 0x0f, 0xf2, 0x01, 0xcd, 0x0f, 0x01, 0x08, 0x54, 0x0f, 0x85, 0x03, 0x1c, 0x0f, 0x00, 0x08, 0x21, 0x0f, 0x2d, 0x02,
+                0x06, 0x0f, 0xff, 0x07, 0x5c, 0x0f, 0x88, 0x00, 0x0d, 0x0f, 0xfe, 0x07, 0xc3, 0x0f, 0xe1, 0x01, 0x1c, 0x0f, 0xfd, 0x07,
+                0x0d, 0x0e, 0xd9, 0x0e, 0x2e, 0x2c, 0x20, 0x33, 0x14, 0x00, 0x87, 0x1c, 0x0d, 0x90, 0x15, 0x00, 0x15, 0x00, 0x0b, 0x00,
+                0x15, 0x01, 0x59, 0x44, 0x0b, 0xca, 0x13, 0x04, 0x5e, 0x03, 0x0b, 0x13, 0x00, 0x0b, 0xed, 0x11, 0x05, 0x48, 0x03, 0x0a,
+                0x14, 0x00, 0x0f, 0x68, 0x11, 0x00, 0x00, 0xa9, 0x17, 0x0d, 0x9e, 0x00, 0x0c, 0x9c, 0x12, 0x00, 0x13, 0x00, 0x0b, 0x7f,
+                0x12, 0x2e, 0x2c, 0x20, 0x6a, 0x10, 0x0f, 0xe4, 0x02, 0x1f, 0x0f, 0xfa, 0x08, 0x61, 0x0f, 0x8d, 0x00, 0x12, 0x0f, 0xf9,
+                0x08, 0x51, 0x0f, 0x2d, 0x02, 0xec, 0x0f, 0xf7, 0x09, 0x14, 0x1f, 0x21, 0x71, 0x09, 0x02, 0x01, 0xd7, 0x58, 0x00, 0x17,
+                0x00, 0x12, 0x53, 0xc5, 0x0a, 0x01, 0xbd, 0x58, 0x0e, 0x00, 0x04, 0x40, 0x73, 0x42, 0x79, 0x43, 0xc2, 0x28, 0x01, 0x97,
+                0x23, 0x19, 0x27, 0x9e, 0x5d, 0x0a, 0x3b, 0x29, 0x00, 0x57, 0x31, 0x08, 0x50, 0x00, 0x00, 0x94, 0x29, 0x09, 0x60, 0x00,
+                0x0c, 0xda, 0x02, 0x08, 0x1d, 0x00, 0x11, 0x2e, 0x17, 0x5c, 0x13, 0x2e, 0xda, 0x60, 0x00, 0xa6, 0x36, 0x5f, 0x6e, 0x6f,
+                0x6e, 0x65, 0x22, 0xdf, 0x00, 0x0c, 0x02, 0x13, 0x00, 0x22, 0x3c, 0x2f, 0x46, 0x5c, 0x02, 0xaa, 0x66, 0x12, 0x2f, 0xab,
+                0x66, 0x00, 0x0b, 0x00, 0x01, 0xe2, 0x64, 0x8a, 0x6f, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x3d, 0x22, 0x6f, 0x11, 0x21, 0x22,
+                0x20, 0x71, 0x00, 0x26, 0x3d, 0x22, 0x43, 0x5d, 0x03, 0xfa, 0x61, 0x30, 0x23, 0x32, 0x30, 0x02, 0x00, 0x23, 0x3b, 0x22,
+                0xef, 0x66, 0x24, 0x6e, 0x6f, 0x5e, 0x00, 0x02, 0x74, 0x00, 0x51, 0x3c, 0x70, 0x3e, 0x45, 0x6e, 0xd1, 0x27, 0x44, 0x6a,
+                0x61, 0x76, 0x61, 0xc0, 0x5c, 0x40, 0x6f, 0x20, 0x73, 0x65, 0x90, 0x30, 0x00, 0x00, 0x12, 0x04, 0x61, 0x67, 0x30, 0x73,
+                0x3c, 0x2f, 0x94, 0x2e, 0x03, 0x48, 0x00, 0x16, 0x2f, 0x49, 0x00, 0x02, 0x11, 0x00, 0x33, 0x64, 0x69, 0x76, 0x1b, 0x00,
+                0x32, 0x64, 0x69, 0x76, 0xd2, 0x2d, 0x12, 0x3d, 0x68, 0x37, 0x00, 0xef, 0x61, 0x03, 0x7f, 0x00, 0x0f, 0x20, 0x00, 0x02,
+                0x37, 0x62, 0x61, 0x72, 0x1f, 0x00, 0xc4, 0x20, 0x20, 0x3c, 0x69, 0x6d, 0x67, 0x20, 0x73, 0x72, 0x63, 0x3d, 0x22, 0xd8,
+                0x23, 0xf1, 0x01, 0x64, 0x65, 0x76, 0x65, 0x6c, 0x6f, 0x70, 0x65, 0x72, 0x2e, 0x6e, 0x76, 0x69, 0x64, 0x69, 0x61, 0xdb,
+                0x23, 0xf0, 0x01, 0x73, 0x69, 0x74, 0x65, 0x73, 0x2f, 0x61, 0x6c, 0x6c, 0x2f, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x73, 0x26,
+                0x00, 0x92, 0x7a, 0x6f, 0x6e, 0x65, 0x5f, 0x6e, 0x65, 0x77, 0x2f, 0x28, 0x00, 0x92, 0x5f, 0x6c, 0x6f, 0x67, 0x6f, 0x2e,
+                0x70, 0x6e, 0x67, 0x40, 0x68, 0x05, 0x61, 0x00, 0x01, 0xad, 0x30, 0x08, 0x83, 0x00, 0x11, 0x22, 0xe5, 0x67, 0x04, 0x8e,
+                0x00, 0x10, 0x5f, 0x0c, 0x38, 0x2c, 0x22, 0x3e, 0xfe, 0x2e, 0x30, 0x50, 0x72, 0x6f, 0x58, 0x13, 0x22, 0x72, 0x20, 0x18,
+                0x13, 0x08, 0x0f, 0x01, 0x02, 0x13, 0x01, 0x06, 0x03, 0x01, 0x02, 0x0b, 0x00, 0x04, 0x63, 0x01, 0x07, 0xf1, 0x00, 0x03,
+                0x6b, 0x02, 0x06, 0x0c, 0x5e, 0x00, 0x82, 0x68, 0x01, 0x7f, 0x01, 0x03, 0xc1, 0x01, 0x05, 0x0d, 0x63, 0x21, 0x69, 0x6e,
+                0x97, 0x5e, 0x6e, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0x8e, 0x66, 0x04, 0xd1, 0x01, 0x04, 0x44, 0x00, 0x06, 0xd2, 0x68,
+                0x06, 0x14, 0x00, 0x1a, 0x72, 0x11, 0x00, 0x01, 0x27, 0x00, 0x00, 0x37, 0x5f, 0x00, 0xb8, 0x00, 0x44, 0x3d, 0x22, 0x32,
+                0x22, 0x95, 0x00, 0x22, 0x63, 0x61, 0xb9, 0x24, 0x00, 0x31, 0x14, 0x27, 0x22, 0x3e, 0xa9, 0x2e, 0x00, 0x09, 0x0e, 0x00,
+                0xc0, 0x15, 0x7b, 0x69, 0x6f, 0x6e, 0x3c, 0x2f, 0x74, 0x68, 0x60, 0x00, 0x1c, 0x2f, 0x61, 0x00, 0x0f, 0x72, 0x00, 0x05,
+                0x02, 0x66, 0x00, 0x40, 0x6c, 0x61, 0x22, 0x3e, 0x76, 0x03, 0x0e, 0x4a, 0x00, 0x0d, 0x27, 0x00, 0x01, 0x58, 0x1e, 0x0f,
+                0x72, 0x00, 0x0f, 0x00, 0x22, 0x00, 0x0b, 0xf7, 0x00, 0x12, 0x3c, 0x08, 0x68, 0x01, 0xce, 0x01, 0x0f, 0x04, 0x14, 0x01,
+                0x0a, 0x36, 0x01, 0x11, 0x2f, 0x24, 0x00, 0x08, 0xc3, 0x01, 0x01, 0x08, 0x01, 0x06, 0xba, 0x01, 0x0f, 0xc8, 0x01, 0x1a,
+                0x0e, 0x1f, 0x00, 0x02, 0xaf, 0x62, 0x14, 0x22, 0x5e, 0x6a, 0x00, 0x43, 0x04, 0x50, 0x4d, 0x65, 0x61, 0x73, 0x75, 0x5c,
+                0x06, 0x02, 0x75, 0x06, 0x0a, 0x62, 0x00, 0x0a, 0x45, 0x00, 0x04, 0x85, 0x62, 0x50, 0x22, 0x3e, 0x0a, 0x54, 0x6f, 0x18,
+                0x5a, 0x00, 0x91, 0x06, 0x60, 0x65, 0x20, 0x62, 0x69, 0x67, 0x67, 0xe9, 0x06, 0x00, 0xf7, 0x0a, 0x01, 0x4b, 0x06, 0x61,
+                0x75, 0x6d, 0x65, 0x72, 0x73, 0x2c, 0x37, 0x29, 0x44, 0x20, 0x62, 0x79, 0x20, 0xa2, 0x0b, 0x00, 0x0c, 0x00, 0x50, 0x63,
+                0x6c, 0x69, 0x63, 0x6b, 0xa1, 0x2c, 0x00, 0x5f, 0x26, 0x00, 0x28, 0x34, 0x01, 0xaa, 0x27, 0x10, 0x20, 0x36, 0x01, 0x66,
+                0x65, 0x72, 0x2e, 0x3c, 0x62, 0x72, 0x5b, 0x00, 0x97, 0x63, 0x6f, 0x6c, 0x64, 0x20, 0x73, 0x70, 0x6f, 0x74, 0x4b, 0x00,
+                0x41, 0x47, 0x52, 0x20, 0x41, 0xd9, 0x0b, 0x1a, 0x25, 0x2c, 0x00, 0x31, 0x72, 0x65, 0x67, 0x62, 0x05, 0xf1, 0x0a, 0x77,
+                0x69, 0x74, 0x68, 0x20, 0x65, 0x78, 0x63, 0x65, 0x73, 0x73, 0x69, 0x76, 0x65, 0x20, 0x73, 0x79, 0x6e, 0x63, 0x68, 0x72,
+                0x6f, 0x6e, 0x69, 0x7a, 0x81, 0x00, 0x06, 0x48, 0x00, 0x40, 0x23, 0x57, 0x46, 0x49, 0x41, 0x4a, 0x04, 0xd7, 0x5a, 0x00,
+                0x09, 0x01, 0xc0, 0x57, 0x61, 0x69, 0x74, 0x2d, 0x66, 0x6f, 0x72, 0x2d, 0x49, 0x64, 0x6c, 0x99, 0x00, 0x73, 0x6d, 0x6d,
+                0x61, 0x6e, 0x64, 0x73, 0x29, 0x69, 0x00, 0x20, 0x68, 0x65, 0xe4, 0x32, 0x10, 0x6c, 0x83, 0x63, 0x01, 0xdc, 0x07, 0x40,
+                0x69, 0x6e, 0x6b, 0x73, 0x97, 0x04, 0x11, 0x70, 0x34, 0x63, 0x24, 0x6e, 0x67, 0x9d, 0x04, 0x10, 0x73, 0x24, 0x3f, 0x00,
+                0x22, 0x00, 0x00, 0x82, 0x5f, 0x01, 0x51, 0x30, 0x04, 0xe4, 0x00, 0x00, 0xbf, 0x27, 0x10, 0x6d, 0x15, 0x2a, 0x8d, 0x64,
+                0x65, 0x74, 0x61, 0x69, 0x6c, 0x2e, 0x0a, 0x6b, 0x01, 0x09, 0x78, 0x03, 0x0e, 0x61, 0x03, 0x02, 0x14, 0x03, 0x74, 0x2d,
+                0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0xe5, 0x62, 0x03, 0x29, 0x04, 0x09, 0xe1, 0x2c, 0x07, 0x54, 0x00, 0x0f, 0x8a, 0x03,
+                0x1b, 0x02, 0xe7, 0x01, 0x00, 0x5a, 0x30, 0x21, 0x6f, 0x6e, 0xaa, 0x01, 0x2e, 0x3d, 0x22, 0xa6, 0x2d, 0x00, 0x17, 0x46,
+                0x00, 0x0b, 0x6d, 0x41, 0x49, 0x6e, 0x74, 0x2c, 0x3f, 0x5a, 0x03, 0xf1, 0x5b, 0x26, 0x3d, 0x3e, 0xb3, 0x5b, 0x06, 0x00,
+                0x06, 0xa1, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a, 0x70, 0x6f, 0x69, 0x68, 0x53, 0x21, 0x22, 0x20, 0x82, 0x02, 0x30,
+                0x3d, 0x22, 0x43, 0x5f, 0x00, 0x04, 0xdc, 0x2c, 0x00, 0x93, 0x01, 0x02, 0x45, 0x01, 0x10, 0x69, 0xfc, 0x17, 0x3f, 0x22,
+                0x3e, 0x23, 0x94, 0x03, 0x0f, 0x0f, 0xa3, 0x00, 0x09, 0x40, 0x31, 0x2c, 0x20, 0x73, 0x90, 0x00, 0x1f, 0x73, 0xa1, 0x00,
+                0x00, 0x21, 0x2e, 0x6c, 0xbf, 0x41, 0x13, 0x43, 0x6c, 0x2a, 0x01, 0x44, 0x5b, 0x0f, 0xae, 0x00, 0x1f, 0x00, 0x87, 0x27,
+                0x01, 0xd1, 0x33, 0x25, 0x22, 0x3e, 0xe9, 0x01, 0x0f, 0xb4, 0x00, 0x0c, 0x10, 0x72, 0xd7, 0x27, 0x0f, 0xb7, 0x00, 0x0a,
+                0x13, 0x32, 0xb7, 0x00, 0x01, 0x5f, 0x01, 0x74, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x73, 0x8a, 0x5e, 0x60, 0x41, 0x6c,
+                0x6c, 0x28, 0x27, 0x2c, 0xa7, 0x08, 0x01, 0xd9, 0x1a, 0x0a, 0x77, 0x5d, 0x0f, 0xc1, 0x00, 0x20, 0x14, 0x44, 0x95, 0x03,
+                0x47, 0x6e, 0x73, 0x22, 0x3e, 0x0d, 0x00, 0x0f, 0xc5, 0x00, 0x2e, 0x1f, 0x33, 0xc5, 0x00, 0x58, 0x06, 0x0f, 0x04, 0x26,
+                0x22, 0x3e, 0x0c, 0x00, 0x0f, 0xc3, 0x00, 0x2e, 0x1f, 0x34, 0xc3, 0x00, 0x58, 0x8f, 0x33, 0x44, 0x3f, 0x22, 0x3e, 0x33,
+                0x44, 0x3f, 0xb5, 0x00, 0x2e, 0x1f, 0x35, 0xb5, 0x00, 0x58, 0x00, 0x3d, 0x03, 0x10, 0x3f, 0x99, 0x07, 0x2f, 0x6d, 0x70,
+                0xb9, 0x00, 0x2f, 0x1f, 0x36, 0xb9, 0x00, 0x58, 0x00, 0xf8, 0x05, 0x20, 0x22, 0x3e, 0x06, 0x00, 0x0f, 0xb7, 0x00, 0x2e,
+                0x1f, 0x37, 0xb7, 0x00, 0x59, 0x10, 0x50, 0xa3, 0x12, 0x22, 0x22, 0x3e, 0x08, 0x00, 0x0f, 0xbb, 0x00, 0x2e, 0x1f, 0x38,
+                0xbb, 0x00, 0x5a, 0x01, 0x18, 0x13, 0x20, 0x2d, 0x5a, 0xbe, 0x00, 0x03, 0x0b, 0x00, 0x0f, 0xc1, 0x00, 0x2e, 0x1f, 0x39,
+                0xc1, 0x00, 0x60, 0x16, 0x43, 0xc1, 0x00, 0x1f, 0x43, 0xc1, 0x00, 0x2e, 0x00, 0x5c, 0x4d, 0x0f, 0xc2, 0x00, 0x56, 0x7f,
+                0x53, 0x4d, 0x25, 0x22, 0x3e, 0x53, 0x4d, 0x18, 0x05, 0x2f, 0x14, 0x31, 0x58, 0x07, 0x0f, 0xb6, 0x00, 0x51, 0x82, 0x4c,
+                0x31, 0x54, 0x45, 0x58, 0x25, 0x22, 0x3e, 0x08, 0x00, 0x0f, 0xbc, 0x00, 0x2f, 0x0f, 0x5d, 0x07, 0x59, 0x20, 0x4c, 0x32,
+                0xb9, 0x00, 0x1f, 0x32, 0xb6, 0x00, 0x30, 0x0f, 0x4e, 0x07, 0x59, 0x30, 0x44, 0x52, 0x41, 0x2a, 0x02, 0x01, 0x07, 0x00,
+                0x0f, 0xba, 0x00, 0x2f, 0x0f, 0x45, 0x07, 0x59, 0x30, 0x50, 0x43, 0x49, 0x03, 0x08, 0x01, 0x07, 0x00, 0x0f, 0xba, 0x00,
+                0x2f, 0x0f, 0x4a, 0x07, 0x59, 0x20, 0x50, 0x44, 0xb8, 0x00, 0x1f, 0x44, 0xb6, 0x00, 0x30, 0x0f, 0x47, 0x07, 0x59, 0x20,
+                0x50, 0x45, 0xb6, 0x00, 0x1f, 0x45, 0xb6, 0x00, 0x30, 0x0f, 0x46, 0x07, 0x59, 0x71, 0x52, 0x53, 0x54, 0x52, 0x25, 0x22,
+                0x3e, 0x07, 0x00, 0x0f, 0xba, 0x00, 0x2f, 0x0f, 0x45, 0x07, 0x59, 0x40, 0x50, 0x52, 0x4f, 0x50, 0x72, 0x01, 0x00, 0x07,
+                0x00, 0x0f, 0xba, 0x00, 0x2f, 0x0f, 0x3e, 0x07, 0x59, 0x12, 0x5a, 0xba, 0x00, 0x01, 0x07, 0x00, 0x0f, 0x20, 0x0d, 0x2f,
+                0x0f, 0x36, 0x07, 0x59, 0x12, 0x43, 0xba, 0x00, 0x01, 0x07, 0x00, 0x02, 0xba, 0x00, 0x0f, 0xfb, 0x11, 0x2e, 0x06, 0xa0,
+                0x0f, 0x0f, 0xf3, 0x11, 0x32, 0x09, 0x2c, 0x16, 0x0f, 0xc1, 0x13, 0x69, 0x06, 0x28, 0x13, 0x0a, 0xb3, 0x21, 0x24, 0x3a,
+                0x20, 0x04, 0x1b, 0x14, 0x20, 0x65, 0x20, 0x0f, 0x44, 0x13, 0x33, 0x0f, 0xd1, 0x26, 0x0d, 0x0f, 0x62, 0x01, 0x1b, 0x0f,
+                0x31, 0x01, 0x82, 0x02, 0x0d, 0x1e, 0x0f, 0x2f, 0x01, 0x3c, 0x0f, 0x34, 0x26, 0x02, 0x0f, 0x2d, 0x01, 0xb0, 0x07, 0x63,
+                0x1d, 0x0f, 0x32, 0x01, 0x3c, 0x0f, 0x87, 0x25, 0x07, 0x0f, 0xc6, 0x03, 0xc8, 0x09, 0x7f, 0x1c, 0x0f, 0xc5, 0x03, 0x58,
+                0x09, 0x78, 0x00, 0x0f, 0x97, 0x02, 0x97, 0x0f, 0x2f, 0x01, 0x05, 0x0f, 0xc3, 0x03, 0x49, 0x0f, 0x2b, 0x01, 0xbc, 0x0f,
+                0xc1, 0x03, 0x53, 0x0f, 0x35, 0x01, 0x28, 0x08, 0xc0, 0x03, 0x09, 0x0c, 0x00, 0x00, 0xca, 0x03, 0x00, 0x77, 0x00, 0x02,
+                0x8e, 0x7a, 0x05, 0x55, 0x00, 0x01, 0xd2, 0x1b, 0x40, 0x3e, 0x54, 0x68, 0x69, 0xbd, 0x1f, 0x01, 0xb5, 0x1c, 0x20, 0x69,
+                0x73, 0x2c, 0x40, 0x60, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x8a, 0x4d, 0x00, 0x0f, 0x18, 0x80, 0x62, 0x65, 0x6e, 0x63,
+                0x68, 0x6d, 0x61, 0x72, 0x12, 0x19, 0x53, 0x2c, 0x20, 0x6e, 0x6f, 0x72, 0xb7, 0x08, 0x20, 0x69, 0x73, 0x2e, 0x19, 0x70,
+                0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x20, 0x21, 0x49, 0xf0, 0x07, 0x70, 0x61, 0x72, 0x74, 0x73, 0x28, 0x3c, 0x61, 0x20,
+                0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x72, 0x65, 0x61, 0x64, 0x6d, 0x65, 0x2e, 0xa1, 0x84, 0x30, 0x23, 0x75, 0x6e, 0xca,
+                0x08, 0xa0, 0x6e, 0x64, 0x65, 0x64, 0x5f, 0x75, 0x73, 0x65, 0x22, 0x3e, 0xdf, 0x1c, 0x11, 0x6e, 0x69, 0x18, 0x6a, 0x3c,
+                0x2f, 0x61, 0x3e, 0x29, 0x2e, 0x25, 0x1d, 0x07, 0xba, 0x00, 0x0a, 0x77, 0x1d, 0x30, 0x67, 0x5f, 0x6a, 0x75, 0x00, 0x18,
+                0x3d, 0x21, 0x43, 0x30, 0x2a, 0x2a, 0x2a, 0x3e, 0x22, 0xef, 0x5f, 0x44, 0x41, 0x54, 0x41, 0x5f, 0x48, 0x45, 0x52, 0x45,
+                0x2a, 0x2a, 0x2a, 0x2f, 0xe1, 0x30, 0x00, 0x01, 0xf9, 0x19, 0x00, 0xec, 0x2f, 0x00, 0x43, 0x00, 0x00, 0x1a, 0x7d, 0x0b,
+                0xcc, 0x78, 0x26, 0x7c, 0x7c, 0x87, 0x4d, 0x04, 0x33, 0x49, 0x06, 0x30, 0x00, 0x03, 0x10, 0x00, 0x09, 0x4e, 0x30, 0x0d,
+                0xe0, 0x49, 0x00, 0x2e, 0x00, 0x0b, 0x13, 0x00, 0xa1, 0x7c, 0x7c, 0x20, 0x27, 0x55, 0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x24,
+                0x01, 0x05, 0x38, 0x4c, 0x0e, 0x95, 0x49, 0x07, 0x3d, 0x00, 0x05, 0x14, 0x00, 0x08, 0x3e, 0x00, 0x00, 0xfc, 0x49, 0x1d,
+                0x27, 0xb1, 0x31, 0x06, 0xa2, 0x00, 0x03, 0x10, 0x00, 0x27, 0x7c, 0x7c, 0xce, 0x43, 0x0e, 0xd9, 0x30, 0x0b, 0x30, 0x00,
+                0x08, 0x1a, 0x00, 0x0f, 0x3a, 0x00, 0x01, 0x06, 0xc8, 0x31, 0x0c, 0x69, 0x00, 0x04, 0x67, 0x05, 0x0c, 0x13, 0x01, 0x09,
+                0xc8, 0x31, 0x0c, 0x35, 0x00, 0x02, 0x6d, 0x04, 0x0f, 0x33, 0x00, 0x04, 0x0c, 0xd8, 0x31, 0x07, 0x38, 0x00, 0x07, 0x7a,
+                0x03, 0x04, 0x3d, 0x00, 0x05, 0x3e, 0x00, 0x07, 0xa1, 0x00, 0x0a, 0x55, 0x00, 0x03, 0x81, 0x00, 0x08, 0x15, 0x00, 0x0a,
+                0x63, 0x00, 0x07, 0x47, 0x00, 0x0c, 0xa4, 0x56, 0x07, 0xa6, 0x01, 0x20, 0x62, 0x75, 0xa9, 0x48, 0x15, 0x28, 0x08, 0x02,
+                0x01, 0x10, 0x00, 0x09, 0x2e, 0x65, 0x11, 0x3f, 0xcc, 0x40, 0x26, 0x20, 0x3a, 0x2c, 0x02, 0x25, 0x62, 0x75, 0xf3, 0x5d,
+                0x0f, 0x3b, 0x65, 0x02, 0x07, 0x51, 0x00, 0x0f, 0x1e, 0x00, 0x02, 0x0f, 0x5f, 0x00, 0x0a, 0x0f, 0x32, 0x00, 0x00, 0x08,
+                0xf0, 0x47, 0x0f, 0xac, 0x65, 0x0e, 0x05, 0xec, 0x33, 0x01, 0x2a, 0x45, 0xb8, 0x27, 0x51, 0x30, 0x20, 0x2f, 0x20, 0x46,
+                0x52, 0x41, 0x4d, 0x45, 0xca, 0x21, 0x0e, 0x3a, 0x02, 0x03, 0x2f, 0x00, 0x10, 0x30, 0x01, 0x00, 0x11, 0x5f, 0x30, 0x00,
+                0x01, 0xdb, 0x03, 0x0f, 0x35, 0x00, 0x00, 0x09, 0x5a, 0x00, 0x7f, 0x4c, 0x45, 0x46, 0x54, 0x5f, 0x45, 0x59, 0x5d, 0x00,
+                0x17, 0x24, 0x31, 0x5f, 0x33, 0x00, 0x0f, 0x60, 0x00, 0x1a, 0x30, 0x20, 0x2f, 0x20, 0x04, 0x48, 0x0f, 0x68, 0x00, 0x17,
+                0x21, 0x32, 0x5f, 0x30, 0x00, 0x0f, 0x65, 0x00, 0x22, 0x20, 0x20, 0x2f, 0xcd, 0x03, 0xaf, 0x5f, 0x50, 0x41, 0x52, 0x54,
+                0x49, 0x43, 0x4c, 0x45, 0x53, 0x75, 0x00, 0x16, 0x29, 0x33, 0x5f, 0x38, 0x00, 0x0f, 0x7d, 0x00, 0x25, 0x10, 0x56, 0xf6,
+                0x48, 0xff, 0x07, 0x45, 0x54, 0x52, 0x49, 0x43, 0x5f, 0x43, 0x4c, 0x4f, 0x55, 0x44, 0x53, 0x5f, 0x53, 0x48, 0x41, 0x44,
+                0x4f, 0x57, 0x47, 0x45, 0x4e, 0x8b, 0x00, 0x16, 0x2f, 0x34, 0x5f, 0x46, 0x00, 0x08, 0x0f, 0x99, 0x00, 0x25, 0x00, 0x46,
+                0x39, 0xc1, 0x27, 0x49, 0x5f, 0x41, 0x4d, 0x5f, 0x41, 0x5f, 0x4c, 0x4f, 0x4e, 0x47, 0x10, 0x00, 0x20, 0x47, 0x27, 0xff,
+                0x0e, 0x61, 0x65, 0x61, 0x74, 0x28, 0x35, 0x30, 0x3e, 0x39, 0x7f, 0x5f, 0x53, 0x54, 0x52, 0x49, 0x4e, 0x47, 0xab, 0x00,
+                0x16, 0x27, 0x35, 0x5f, 0x53, 0x00, 0x03, 0x3d, 0x00, 0x0b, 0xa2, 0x00, 0x04, 0x18, 0x24, 0x0f, 0x41, 0x59, 0x02, 0x03,
+                0xc5, 0x7e, 0x21, 0x53, 0x65, 0x78, 0x55, 0x0a, 0x22, 0x04, 0x0f, 0x27, 0x00, 0x0e, 0x0f, 0x0f, 0x56, 0x03, 0x0e, 0x2c,
+                0x00, 0x0b, 0x81, 0x24, 0x02, 0xaa, 0x07, 0x90, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a, 0x00,
+            };
+
+            static const CompressedReportDefinition reportDefinition(CompressedContents, sizeof(CompressedContents), 36171, 8, 0, 13);
+            return reportDefinition.GetReportDefinition();
+        }
+
+    } // namespace SummaryReport
+
+} } } }
@@ -16,7 +16,16 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <thread>
+#include <tuple>
 #include <vector>
+#include "NvPerfHash.h"
 #include "NvPerfInit.h"
 #include "NvPerfMetricsConfigBuilder.h"
 
@@ -110,4 +119,253 @@ namespace nv { namespace perf {
         return true;
     }
 
+    // On-disk layout of a CounterConfigurationCache entry:
+    //   CounterConfigurationCacheEntryHeader | key | configImage | counterDataPrefix
+    struct CounterConfigurationCacheEntryHeader
+    {
+        char magic[8];                  // "NVPWCCC"
+        uint32_t version;
+        uint32_t reserved;
+        uint64_t sdkVersion;            // NVPW_SDK_VERSION, metric indices and config images are only valid for the library that produced them
+        uint64_t keySize;
+        uint64_t configImageSize;
+        uint64_t counterDataPrefixSize;
+        uint64_t numPasses;
+        uint64_t payloadHash;           // of everything following this header, detects truncated or corrupt files
+
+        static const char* Magic()
+        {
+            return "NVPWCCC";
+        }
+        enum { Version = 1 };
+    };
+
+    // A directory of CounterConfigurations, one file per distinct key. A configuration only depends on the chip, the kind of raw metrics
+    // config (e.g. the range profiler of a graphics API, or the periodic sampler), the set of scheduled metric requests and the library
+    // version, so once an entry exists, creating the same configuration again costs a file read instead of resolving raw dependencies and
+    // scheduling passes. Entries are written to a temporary file and renamed into place, so processes can share a directory.
+    class CounterConfigurationCache
+    {
+    private:
+        std::string m_directory;
+
+    public:
+        CounterConfigurationCache() = default;
+        explicit CounterConfigurationCache(const std::string& directory)
+            : m_directory(directory)
+        {
+        }
+
+        // "directory" must exist; an empty string disables the cache
+        void SetDirectory(const std::string& directory)
+        {
+            m_directory = directory;
+        }
+
+        const std::string& GetDirectory() const
+        {
+            return m_directory;
+        }
+
+        bool IsEnabled() const
+        {
+            return !m_directory.empty();
+        }
+
+        // "pConfigurationKind" tells apart configurations created with different NVPA_RawMetricsConfig factories for the same chip.
+        // The key does not depend on the order of the requests, nor on duplicates.
+        static std::string MakeKey(const char* pChipName, const char* pConfigurationKind, const NVPW_MetricEvalRequest* pMetricEvalRequests, size_t numMetricEvalRequests)
+        {
+            std::vector<NVPW_MetricEvalRequest> metricEvalRequests(pMetricEvalRequests, pMetricEvalRequests + numMetricEvalRequests);
+            auto toTuple = [](const NVPW_MetricEvalRequest& request) {
+                return std::make_tuple(request.metricIndex, request.metricType, request.rollupOp, request.submetric);
+            };
+            std::sort(metricEvalRequests.begin(), metricEvalRequests.end(), [&](const NVPW_MetricEvalRequest& lhs, const NVPW_MetricEvalRequest& rhs) {
+                return toTuple(lhs) < toTuple(rhs);
+            });
+            metricEvalRequests.erase(std::unique(metricEvalRequests.begin(), metricEvalRequests.end(), [&](const NVPW_MetricEvalRequest& lhs, const NVPW_MetricEvalRequest& rhs) {
+                return toTuple(lhs) == toTuple(rhs);
+            }), metricEvalRequests.end());
+
+            // the chip name comes first, see GetEntryPath()
+            std::string key = pChipName;
+            key.push_back('\0');
+            key += pConfigurationKind;
+            key.push_back('\0');
+            for (const NVPW_MetricEvalRequest& request : metricEvalRequests)
+            {
+                const uint64_t metricIndex = request.metricIndex;
+                const uint8_t packed[4] = { request.metricType, request.rollupOp, (uint8_t)(request.submetric >> 8), (uint8_t)request.submetric };
+                key.append(reinterpret_cast<const char*>(&metricIndex), sizeof(metricIndex));
+                key.append(reinterpret_cast<const char*>(packed), sizeof(packed));
+            }
+            return key;
+        }
+
+        // e.g. "<directory>/GA10B_0123456789abcdef.nvpwconfig"
+        std::string GetEntryPath(const std::string& key) const
+        {
+            char hashString[17];
+            snprintf(hashString, sizeof(hashString), "%016llx", (unsigned long long)Fnv1a64(key.data(), key.size()));
+            std::string path = m_directory;
+            if (!path.empty() && path.back() != '/' && path.back() != '\\')
+            {
+                path.push_back('/');
+            }
+            path += key.c_str(); // the chip name
+            path += "_";
+            path += hashString;
+            path += ".nvpwconfig";
+            return path;
+        }
+
+        // Returns false on a miss; a missing entry is not an error, a stale or corrupt one is only reported as a warning.
+        bool Find(const std::string& key, CounterConfiguration& configuration) const
+        {
+            if (!IsEnabled())
+            {
+                return false;
+            }
+            const std::string path = GetEntryPath(key);
+            FILE* pFile = OpenFile(path.c_str(), "rb");
+            if (!pFile)
+            {
+                return false;
+            }
+            CounterConfigurationCacheEntryHeader header = {};
+            std::vector<uint8_t> payload;
+            bool success = fread(&header, sizeof(header), 1, pFile) == 1;
+            if (success)
+            {
+                success = !memcmp(header.magic, CounterConfigurationCacheEntryHeader::Magic(), sizeof(header.magic))
+                    && header.version == CounterConfigurationCacheEntryHeader::Version
+                    && header.sdkVersion == NVPW_SDK_VERSION
+                    && header.keySize == key.size();
+            }
+            if (success)
+            {
+                const uint64_t payloadSize = header.keySize + header.configImageSize + header.counterDataPrefixSize;
+                success = payloadSize >= header.keySize && payloadSize < (uint64_t(1) << 32); // guards the allocation against garbage sizes
+                if (success)
+                {
+                    payload.resize((size_t)payloadSize);
+                    success = fread(payload.data(), 1, payload.size(), pFile) == payload.size() && fgetc(pFile) == EOF;
+                }
+            }
+            fclose(pFile);
+            if (!success || header.payloadHash != Fnv1a64(payload.data(), payload.size()))
+            {
+                NV_PERF_LOG_WRN(50, "Ignoring stale or corrupt counter configuration cache entry %s\n", path.c_str());
+                return false;
+            }
+            if (memcmp(payload.data(), key.data(), key.size()))
+            {
+                NV_PERF_LOG_WRN(50, "Counter configuration cache entry %s belongs to a different key\n", path.c_str());
+                return false;
+            }
+
+            const uint8_t* pConfigImage = payload.data() + header.keySize;
+            const uint8_t* pCounterDataPrefix = pConfigImage + header.configImageSize;
+            configuration.configImage.assign(pConfigImage, pConfigImage + header.configImageSize);
+            configuration.counterDataPrefix.assign(pCounterDataPrefix, pCounterDataPrefix + header.counterDataPrefixSize);
+            configuration.numPasses = (size_t)header.numPasses;
+            return true;
+        }
+
+        bool Store(const std::string& key, const CounterConfiguration& configuration) const
+        {
+            if (!IsEnabled())
+            {
+                return false;
+            }
+            CounterConfigurationCacheEntryHeader header = {};
+            memcpy(header.magic, CounterConfigurationCacheEntryHeader::Magic(), sizeof(header.magic));
+            header.version = CounterConfigurationCacheEntryHeader::Version;
+            header.sdkVersion = NVPW_SDK_VERSION;
+            header.keySize = key.size();
+            header.configImageSize = configuration.configImage.size();
+            header.counterDataPrefixSize = configuration.counterDataPrefix.size();
+            header.numPasses = configuration.numPasses;
+            uint64_t hash = Fnv1a64(key.data(), key.size());
+            hash = Fnv1a64(configuration.configImage.data(), configuration.configImage.size(), hash);
+            header.payloadHash = Fnv1a64(configuration.counterDataPrefix.data(), configuration.counterDataPrefix.size(), hash);
+
+            // a unique temporary name, so that concurrent writers of the same entry never interleave
+            const std::string path = GetEntryPath(key);
+            char suffix[32];
+            snprintf(suffix, sizeof(suffix), ".%016llx.tmp", (unsigned long long)(std::hash<std::thread::id>()(std::this_thread::get_id())
+                ^ (uint64_t)std::chrono::high_resolution_clock::now().time_since_epoch().count()));
+            const std::string temporaryPath = path + suffix;
+            FILE* pFile = OpenFile(temporaryPath.c_str(), "wb");
+            if (!pFile)
+            {
+                NV_PERF_LOG_WRN(50, "OpenFile failed for file: %s\n", temporaryPath.c_str());
+                return false;
+            }
+            bool success = fwrite(&header, sizeof(header), 1, pFile) == 1;
+            success = success && fwrite(key.data(), 1, key.size(), pFile) == key.size();
+            success = success && fwrite(configuration.configImage.data(), 1, configuration.configImage.size(), pFile) == configuration.configImage.size();
+            success = success && fwrite(configuration.counterDataPrefix.data(), 1, configuration.counterDataPrefix.size(), pFile) == configuration.counterDataPrefix.size();
+            success = !fclose(pFile) && success;
+            if (success && rename(temporaryPath.c_str(), path.c_str()))
+            {
+                // rename() does not replace an existing file on Windows, the entry may have been written by another process meanwhile
+                remove(path.c_str());
+                success = !rename(temporaryPath.c_str(), path.c_str());
+            }
+            if (!success)
+            {
+                remove(temporaryPath.c_str());
+                NV_PERF_LOG_WRN(50, "Failed writing counter configuration cache entry %s\n", path.c_str());
+                return false;
+            }
+            return true;
+        }
+    };
+
+    /// Looks pMetricEvalRequests[0..numMetricEvalRequests-1] up in cache, or on a miss, adds them to a MetricsConfigBuilder, transforms it
+    /// into configuration and stores the result. "initializeConfigBuilder" is of the form bool(MetricsConfigBuilder&) and should call
+    /// MetricsConfigBuilder::Initialize(); it is only invoked on a miss, so that a hit does not create an NVPA_RawMetricsConfig either.
+    template <class TInitializeConfigBuilder>
+    inline bool CreateConfiguration(
+        const CounterConfigurationCache& cache,
+        const char* pChipName,
+        const char* pConfigurationKind,
+        const NVPW_MetricEvalRequest* pMetricEvalRequests,
+        size_t numMetricEvalRequests,
+        TInitializeConfigBuilder&& initializeConfigBuilder,
+        CounterConfiguration& configuration)
+    {
+        std::string key;
+        if (cache.IsEnabled())
+        {
+            key = CounterConfigurationCache::MakeKey(pChipName, pConfigurationKind, pMetricEvalRequests, numMetricEvalRequests);
+            if (cache.Find(key, configuration))
+            {
+                return true;
+            }
+        }
+
+        MetricsConfigBuilder configBuilder;
+        if (!initializeConfigBuilder(configBuilder))
+        {
+            return false;
+        }
+        if (!configBuilder.AddMetrics(pMetricEvalRequests, numMetricEvalRequests))
+        {
+            NV_PERF_LOG_ERR(10, "AddMetrics failed\n");
+            return false;
+        }
+        if (!CreateConfiguration(configBuilder, configuration))
+        {
+            return false;
+        }
+
+        if (cache.IsEnabled())
+        {
+            cache.Store(key, configuration); // a failure only costs the next run the scheduling
+        }
+        return true;
+    }
+
 }}
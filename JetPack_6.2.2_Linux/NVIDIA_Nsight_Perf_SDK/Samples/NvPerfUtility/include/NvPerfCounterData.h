@@ -19,8 +19,13 @@
 #include "nvperf_host.h"
 #include "nvperf_target.h"
 #include "NvPerfInit.h"
+#include "NvPerfSpscQueue.h"
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace nv { namespace perf {
@@ -322,6 +327,62 @@ namespace nv { namespace perf {
             }
             return true;
         }
+
+        struct WeightedSample
+        {
+            const uint8_t* pCounterDataSrc;
+            size_t rangeIndexSrc;
+            double weight; // typically the result of GetOverlapFactor(); 1.0 means the sample fully resides within the target interval
+        };
+
+        // Batched variant of the above: accumulates all samples in [pSamples, pSamples + numSamples) into a single destination range.
+        // The NVPW parameter structs are set up once and only the per-sample fields are updated in the loop, samples with a weight of 1.0
+        // take the SumIntoRange() fast path, and samples with a weight of 0.0 are skipped entirely.
+        bool SumIntoRange(size_t rangeIndexDst, const WeightedSample* pSamples, size_t numSamples)
+        {
+            NVPW_CounterDataCombiner_SumIntoRange_Params sumIntoRangeParams = { NVPW_CounterDataCombiner_SumIntoRange_Params_STRUCT_SIZE };
+            sumIntoRangeParams.pCounterDataCombiner = m_pCounterDataCombiner;
+            sumIntoRangeParams.rangeIndexDst = rangeIndexDst;
+
+            NVPW_CounterDataCombiner_WeightedSumIntoRange_Params weightedSumIntoRangeParams = { NVPW_CounterDataCombiner_WeightedSumIntoRange_Params_STRUCT_SIZE };
+            weightedSumIntoRangeParams.pCounterDataCombiner = m_pCounterDataCombiner;
+            weightedSumIntoRangeParams.rangeIndexDst = rangeIndexDst;
+            weightedSumIntoRangeParams.dstMultiplier = 1.0;
+
+            for (size_t sampleIdx = 0; sampleIdx < numSamples; ++sampleIdx)
+            {
+                const WeightedSample& sample = pSamples[sampleIdx];
+                if (sample.weight == 1.0)
+                {
+                    sumIntoRangeParams.pCounterDataSrc = sample.pCounterDataSrc;
+                    sumIntoRangeParams.rangeIndexSrc = sample.rangeIndexSrc;
+                    NVPA_Status nvpaStatus = NVPW_CounterDataCombiner_SumIntoRange(&sumIntoRangeParams);
+                    if (nvpaStatus != NVPA_STATUS_SUCCESS)
+                    {
+                        NV_PERF_LOG_ERR(50, "NVPW_CounterDataCombiner_SumIntoRange failed, nvpaStatus = %s\n", FormatStatus(nvpaStatus).c_str());
+                        return false;
+                    }
+                }
+                else if (sample.weight != 0.0)
+                {
+                    weightedSumIntoRangeParams.pCounterDataSrc = sample.pCounterDataSrc;
+                    weightedSumIntoRangeParams.rangeIndexSrc = sample.rangeIndexSrc;
+                    weightedSumIntoRangeParams.srcMultiplier = sample.weight;
+                    NVPA_Status nvpaStatus = NVPW_CounterDataCombiner_WeightedSumIntoRange(&weightedSumIntoRangeParams);
+                    if (nvpaStatus != NVPA_STATUS_SUCCESS)
+                    {
+                        NV_PERF_LOG_ERR(50, "NVPW_CounterDataCombiner_WeightedSumIntoRange failed, nvpaStatus = %s\n", FormatStatus(nvpaStatus).c_str());
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        bool SumIntoRange(size_t rangeIndexDst, const std::vector<WeightedSample>& samples)
+        {
+            return SumIntoRange(rangeIndexDst, samples.data(), samples.size());
+        }
     };
 
     inline size_t CounterDataGetNumRanges(const uint8_t* pCounterDataImage)
@@ -423,6 +484,7 @@ namespace nv { namespace perf {
             uint32_t m_numTotalRanges; // total number of allocated ranges in counter data
             RangeDataIndexDescriptor m_get; // the last consumed range data index
             RangeDataIndexDescriptor m_put; // the last produced range data index
+            RangeDataIndexDescriptor m_published; // the last range data index handed out through PublishCompletedRanges()
             bool m_validate; // perform additional validation at the cost of perf, useful for debugging
 
         public:
@@ -430,6 +492,7 @@ namespace nv { namespace perf {
                 : m_numTotalRanges()
                 , m_get({ (uint32_t)InvalidValues::RangeDataIndex, (uint32_t)InvalidValues::TriggerCount })
                 , m_put({ (uint32_t)InvalidValues::RangeDataIndex, (uint32_t)InvalidValues::TriggerCount })
+                , m_published({ (uint32_t)InvalidValues::RangeDataIndex, (uint32_t)InvalidValues::TriggerCount })
                 , m_validate(false)
             {
             }
@@ -459,6 +522,7 @@ namespace nv { namespace perf {
                 m_numTotalRanges = 0;
                 m_get = { (uint32_t)InvalidValues::RangeDataIndex, (uint32_t)InvalidValues::TriggerCount };
                 m_put = { (uint32_t)InvalidValues::RangeDataIndex, (uint32_t)InvalidValues::TriggerCount };
+                m_published = { (uint32_t)InvalidValues::RangeDataIndex, (uint32_t)InvalidValues::TriggerCount };
                 m_validate = false;
             }
 
@@ -599,6 +663,62 @@ namespace nv { namespace perf {
                 return true;
             }
 
+            uint32_t GetNumUnpublishedRanges() const
+            {
+                if (m_put.triggerCount == (uint32_t)InvalidValues::TriggerCount)
+                {
+                    return 0;
+                }
+                else if (m_published.triggerCount == (uint32_t)InvalidValues::TriggerCount)
+                {
+                    return m_put.rangeDataIndex + 1;
+                }
+                else
+                {
+                    return m_put.triggerCount - m_published.triggerCount;
+                }
+            }
+
+            // This is an alternative to ConsumeData()/UpdateGet() for when ranges are consumed on a different thread than the one decoding them:
+            // the decoding thread calls UpdatePut() followed by PublishCompletedRanges(), and hands the range indices over to the consuming thread,
+            // e.g. through an SpscQueue. GET is not tracked in this mode, it is up to the client to bound the number of outstanding ranges.
+            // TPublishRangeFunc should be in the form of bool(uint32_t rangeIndex), return false to stop publishing(e.g. because the queue is full),
+            // "this" range and all succeeding ones will be retried on the next call.
+            template <typename TPublishRangeFunc>
+            uint32_t PublishCompletedRanges(TPublishRangeFunc&& publishRangeFunc)
+            {
+                const uint32_t numUnpublishedRanges = GetNumUnpublishedRanges();
+                const bool isFirstPublish = (m_published.triggerCount == (uint32_t)InvalidValues::TriggerCount);
+                uint32_t numRangesPublished = 0;
+                for (; numRangesPublished < numUnpublishedRanges; ++numRangesPublished)
+                {
+                    const uint32_t rangeIndex = isFirstPublish ? numRangesPublished : CircularIncrement(m_published.rangeDataIndex, numRangesPublished + 1);
+                    if (!publishRangeFunc(rangeIndex))
+                    {
+                        break;
+                    }
+                }
+                if (numRangesPublished)
+                {
+                    if (isFirstPublish)
+                    {
+                        m_published.rangeDataIndex = numRangesPublished - 1;
+                        m_published.triggerCount = m_put.triggerCount - Distance(m_published.rangeDataIndex, m_put.rangeDataIndex);
+                    }
+                    else
+                    {
+                        m_published.rangeDataIndex = CircularIncrement(m_published.rangeDataIndex, numRangesPublished);
+                        m_published.triggerCount += numRangesPublished;
+                    }
+                }
+                return numRangesPublished;
+            }
+
+            uint32_t GetNumTotalRanges() const
+            {
+                return m_numTotalRanges;
+            }
+
             uint32_t CircularIncrement(uint32_t current, uint32_t stepSize) const
             {
                 if (!m_numTotalRanges)
@@ -655,6 +775,184 @@ namespace nv { namespace perf {
             }
         };
 
+        // Decodes into a RingBufferCounterData on a dedicated thread and hands the completed ranges to one consumer thread through a lock-free queue.
+        // A range stays outstanding from the moment it is decoded until the consumer pops it. Before every decode the thread checks that the
+        // outstanding ranges plus the most ranges the decode may write still fit into the ring buffer; if they do not, the decode is deferred to
+        // the next interval and the samples stay in the sampler's record buffer, so outstanding ranges are never overwritten.
+        // The decode thread writes the counter data image while holding a lock that ConsumeRanges() also holds while handing ranges out, so the
+        // consumer always sees a consistent image. ConsumeRanges() only tries to take the lock: while a decode is in progress it returns without
+        // handing anything out and the ranges stay queued for its next call, so the consumer never waits for a decode. A decode may still wait
+        // for the consumer to finish handing out ranges.
+        class RingBufferBackgroundDecoder
+        {
+        private:
+            std::thread m_thread;
+            std::mutex m_counterDataMutex;
+            std::atomic<bool> m_stop;
+            std::atomic<bool> m_failed;
+            std::atomic<size_t> m_numDeferredDecodes;
+            SpscQueue<uint32_t> m_completedRanges; // produced by the decode thread, consumed by ConsumeRanges()
+
+        public:
+            RingBufferBackgroundDecoder()
+                : m_stop(false)
+                , m_failed(false)
+                , m_numDeferredDecodes(0)
+            {
+            }
+            RingBufferBackgroundDecoder(const RingBufferBackgroundDecoder& decoder) = delete;
+            RingBufferBackgroundDecoder& operator=(const RingBufferBackgroundDecoder& decoder) = delete;
+            ~RingBufferBackgroundDecoder()
+            {
+                Stop();
+            }
+
+            // "counterData" must be initialized and outlive the decoder; it must not be touched by anyone else until Stop() returns.
+            // TDecodeFunc should be in the form of bool(), it decodes into "counterData" and calls its UpdatePut(); it runs with the counter data lock held.
+            // TGetMaxNumRangesToDecodeFunc should be in the form of size_t(), it returns an upper bound of the number of ranges the next decode may
+            // write; it is called once per decode interval, with the counter data lock held, right before the decode is either run or deferred.
+            template <typename TDecodeFunc, typename TGetMaxNumRangesToDecodeFunc>
+            bool Start(RingBufferCounterData& counterData, std::chrono::microseconds decodeInterval, TDecodeFunc&& decodeFunc, TGetMaxNumRangesToDecodeFunc&& getMaxNumRangesToDecodeFunc)
+            {
+                if (m_thread.joinable())
+                {
+                    NV_PERF_LOG_ERR(50, "Background decoding has already been started\n");
+                    return false;
+                }
+                if (!Initialize(counterData))
+                {
+                    return false;
+                }
+                m_thread = std::thread([this, &counterData, decodeInterval, decodeFunc = std::forward<TDecodeFunc>(decodeFunc), getMaxNumRangesToDecodeFunc = std::forward<TGetMaxNumRangesToDecodeFunc>(getMaxNumRangesToDecodeFunc)]() mutable {
+                    DecodeThreadProc(counterData, decodeInterval, decodeFunc, getMaxNumRangesToDecodeFunc);
+                });
+                return true;
+            }
+
+            // Called by Start(). Callers that drive the decodes themselves through DecodeOnce() call this instead of Start().
+            bool Initialize(const RingBufferCounterData& counterData)
+            {
+                if (m_thread.joinable())
+                {
+                    NV_PERF_LOG_ERR(50, "Cannot initialize while decoding in the background\n");
+                    return false;
+                }
+                if (!m_completedRanges.Initialize(counterData.GetNumTotalRanges()))
+                {
+                    NV_PERF_LOG_ERR(50, "Failed to initialize the completed range queue\n");
+                    return false;
+                }
+                m_stop.store(false, std::memory_order_relaxed);
+                m_failed.store(false, std::memory_order_relaxed);
+                m_numDeferredDecodes.store(0, std::memory_order_relaxed);
+                return true;
+            }
+
+            void Stop()
+            {
+                m_stop.store(true, std::memory_order_relaxed);
+                if (m_thread.joinable())
+                {
+                    m_thread.join();
+                }
+                m_completedRanges.Reset();
+            }
+
+            bool IsRunning() const
+            {
+                return m_thread.joinable();
+            }
+
+            bool HasFailed() const
+            {
+                return m_failed.load(std::memory_order_acquire);
+            }
+
+            // the number of decode intervals in which the decode was skipped because the consumer had not released enough ranges
+            size_t GetNumDeferredDecodes() const
+            {
+                return m_numDeferredDecodes.load(std::memory_order_relaxed);
+            }
+
+            // Consumer only.
+            // TConsumeRangeDataFunc should be in the form of bool(const uint8_t* pCounterDataImage, size_t counterDataImageSize, uint32_t rangeIndex, bool& stop),
+            // return false to indicate something went wrong; set "stop" to true to early break from iterating succeeding ranges, "this" range stays outstanding.
+            // Returns true without calling "consumeRangeDataFunc" if a decode is in progress. The decode thread is blocked while this runs,
+            // keep the work done per range short.
+            template <typename TConsumeRangeDataFunc>
+            bool ConsumeRanges(const RingBufferCounterData& counterData, TConsumeRangeDataFunc&& consumeRangeDataFunc)
+            {
+                if (HasFailed())
+                {
+                    NV_PERF_LOG_ERR(20, "Background decoding has failed\n");
+                    return false;
+                }
+                std::unique_lock<std::mutex> lock(m_counterDataMutex, std::try_to_lock);
+                if (!lock.owns_lock())
+                {
+                    return true; // the image is being decoded into, the queued ranges are handed out by the next call
+                }
+                const std::vector<uint8_t>& counterDataImage = counterData.GetCounterData();
+                while (const uint32_t* pRangeIndex = m_completedRanges.Front())
+                {
+                    bool stop = false;
+                    if (!consumeRangeDataFunc(counterDataImage.data(), counterDataImage.size(), *pRangeIndex, stop))
+                    {
+                        return false;
+                    }
+                    if (stop)
+                    {
+                        break;
+                    }
+                    m_completedRanges.Pop();
+                }
+                return true;
+            }
+
+            // Producer only. Runs one decode interval on the calling thread: decodes, or defers the decode if it could overwrite outstanding
+            // ranges, then publishes the completed ranges to ConsumeRanges(). The decode thread calls this once per interval; callers that
+            // drive the decodes themselves call it after Initialize(), never while the decode thread runs. Returns false once a decode failed.
+            template <typename TDecodeFunc, typename TGetMaxNumRangesToDecodeFunc>
+            bool DecodeOnce(RingBufferCounterData& counterData, TDecodeFunc& decodeFunc, TGetMaxNumRangesToDecodeFunc& getMaxNumRangesToDecodeFunc)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_counterDataMutex);
+                    // Size() may only overestimate here as the consumer can only shrink the queue
+                    const size_t numOutstandingRanges = m_completedRanges.Size() + counterData.GetNumUnpublishedRanges();
+                    const size_t maxNumRangesToDecode = getMaxNumRangesToDecodeFunc();
+                    // with nothing outstanding the whole ring buffer is free, so decode regardless
+                    if (numOutstandingRanges && (numOutstandingRanges + maxNumRangesToDecode > counterData.GetNumTotalRanges()))
+                    {
+                        m_numDeferredDecodes.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    else if (!decodeFunc())
+                    {
+                        m_failed.store(true, std::memory_order_release);
+                        return false;
+                    }
+                }
+                counterData.PublishCompletedRanges([&](uint32_t rangeIndex) {
+                    return m_completedRanges.Push(rangeIndex);
+                });
+                return true;
+            }
+
+        private:
+            template <typename TDecodeFunc, typename TGetMaxNumRangesToDecodeFunc>
+            void DecodeThreadProc(RingBufferCounterData& counterData, std::chrono::microseconds decodeInterval, TDecodeFunc& decodeFunc, TGetMaxNumRangesToDecodeFunc& getMaxNumRangesToDecodeFunc)
+            {
+                while (!m_stop.load(std::memory_order_relaxed))
+                {
+                    const auto decodeBeginTime = std::chrono::steady_clock::now();
+                    if (!DecodeOnce(counterData, decodeFunc, getMaxNumRangesToDecodeFunc))
+                    {
+                        return;
+                    }
+                    std::this_thread::sleep_until(decodeBeginTime + decodeInterval);
+                }
+            }
+        };
+
         // The `CombinedCounterDataMaxNumRanges` parameter defines the maximum number of ranges that can be stored in the combined counter data.
         // This parameter is used to determine how frequently a new combined counter data object should be initialized.
         template <size_t CombinedCounterDataMaxNumRanges = 1024>
@@ -786,7 +1084,7 @@ namespace nv { namespace perf {
                 size_t combinedCounterDataSize;
                 uint32_t combinedCounterDataRangeIndex;
             };
-        private:
+        protected:
             enum {
                 // The `CombinedCounterDataMaxNumRanges` parameter defines the maximum number of ranges that can be stored in the combined counter data.
                 // This parameter is used to determine how frequently a new combined counter data object should be initialized.
@@ -803,6 +1101,7 @@ namespace nv { namespace perf {
             size_t m_numUnreadSamples;
 
             uint64_t m_frameBeginTime;
+            std::vector<CounterDataCombiner::WeightedSample> m_frameSamples; // samples overlapping the frame being combined, sized to "maxSampleLatency" and reused across frames
         public:
             FrameLevelSampleCombiner()
                 : m_combinedCounterDataRangeIndex()
@@ -823,6 +1122,104 @@ namespace nv { namespace perf {
                 return (++index >= max) ? 0 : index;
             }
 
+            bool PushSampleInfo(uint64_t beginTimestamp, uint64_t endTimestamp, const uint8_t* pCounterDataImage, uint32_t rangeIndex)
+            {
+                if (m_numUnreadSamples == m_sampleInfoRingBuffer.size())
+                {
+                    NV_PERF_LOG_ERR(50, "Buffer is full, specified \"maxSampleLatency\" is insufficient\n");
+                    return false;
+                }
+                assert(beginTimestamp < endTimestamp);
+                SampleInfo& sampleInfo = m_sampleInfoRingBuffer[m_putIndex];
+                sampleInfo.beginTimestamp = beginTimestamp;
+                sampleInfo.endTimestamp = endTimestamp;
+                sampleInfo.pCounterData = pCounterDataImage;
+                sampleInfo.rangeIndex = rangeIndex;
+                m_putIndex = CircularIncrement(m_putIndex, m_sampleInfoRingBuffer.size());
+                ++m_numUnreadSamples;
+                return true;
+            }
+
+            // Walks the sample ring buffer and gathers every sample that overlaps [m_frameBeginTime, frameEndTime) into `m_frameSamples`, along
+            // with its overlap weight, and returns the number of samples gathered. Samples that fully belong to this frame or to a prior frame
+            // are recycled; a sample that straddles the frame end is kept for the next frame.
+            size_t CollectFrameSamples(uint64_t frameEndTime)
+            {
+                // work on local copies, stores into `m_frameSamples` would otherwise force the ring buffer indices to be reloaded on every iteration
+                size_t getIndex = m_getIndex;
+                size_t numUnreadSamples = m_numUnreadSamples;
+                const size_t ringBufferSize = m_sampleInfoRingBuffer.size();
+                const SampleInfo* pSampleInfos = m_sampleInfoRingBuffer.data();
+                const uint64_t frameBeginTime = m_frameBeginTime;
+                CounterDataCombiner::WeightedSample* pFrameSamples = m_frameSamples.data();
+                size_t numFrameSamples = 0;
+                while (numUnreadSamples)
+                {
+                    const SampleInfo& sampleInfo = pSampleInfos[getIndex];
+                    if (sampleInfo.beginTimestamp >= frameEndTime)
+                    {
+                        //                  +----------+
+                        //                  |  Sample  |
+                        //                  +----------+
+                        // +------------+
+                        // | This Frame |
+                        // +------------+
+                        // belongs to a future frame => early break
+                        break;
+                    }
+                    else if (sampleInfo.endTimestamp <= frameBeginTime)
+                    {
+                        // +----------+
+                        // |  Sample  |
+                        // +----------+
+                        //                  +------------+
+                        //                  | This Frame |
+                        //                  +------------+
+                        // belongs to a prior frame => ignore it
+                        getIndex = CircularIncrement(getIndex, ringBufferSize);
+                        --numUnreadSamples;
+                        continue;
+                    }
+
+                    const double weight = (sampleInfo.beginTimestamp >= frameBeginTime && sampleInfo.endTimestamp <= frameEndTime)
+                        ? 1.0
+                        : CounterDataCombiner::GetOverlapFactor(sampleInfo.beginTimestamp, sampleInfo.endTimestamp, frameBeginTime, frameEndTime);
+                    CounterDataCombiner::WeightedSample& frameSample = pFrameSamples[numFrameSamples++];
+                    frameSample.pCounterDataSrc = sampleInfo.pCounterData;
+                    frameSample.rangeIndexSrc = sampleInfo.rangeIndex;
+                    frameSample.weight = weight;
+                    if (sampleInfo.endTimestamp > frameEndTime)
+                    {
+                        //                  +----------------------+
+                        //                  |        Sample        |
+                        //                  +----------------------+
+                        //       +------------+
+                        //       | This Frame |
+                        //       +------------+
+                        //                         +------------+
+                        //          OR             | This Frame |
+                        //                         +------------+
+                        // partly falls into this frame, but partly belongs to a future frame => consume it but do not recycle it
+                        break;
+                    }
+                    //            +----------------------+
+                    //            |        Sample        |
+                    //            +----------------------+
+                    //                            +------------+
+                    //                            | This Frame |
+                    //                            +------------+
+                    //        +------------------------------------+
+                    //  OR    |         This Frame                 |
+                    //        +------------------------------------+
+                    // consume and recycle it
+                    getIndex = CircularIncrement(getIndex, ringBufferSize);
+                    --numUnreadSamples;
+                }
+                m_getIndex = getIndex;
+                m_numUnreadSamples = numUnreadSamples;
+                return numFrameSamples;
+            }
+
         public:
             bool Initialize(
                 const std::vector<uint8_t>& counterDataPrefix,
@@ -847,6 +1244,7 @@ namespace nv { namespace perf {
                 }
                 m_counterDataTemplate = m_combiner.GetCounterData();
                 m_sampleInfoRingBuffer.resize(maxSampleLatency);
+                m_frameSamples.resize(maxSampleLatency);
                 return true;
             }
 
@@ -860,6 +1258,7 @@ namespace nv { namespace perf {
                 m_getIndex = 0;
                 m_numUnreadSamples = 0;
                 m_frameBeginTime = 0;
+                m_frameSamples.clear();
             }
 
             bool AddSample(const uint8_t* pCounterDataImage, size_t counterDataImageSize, uint32_t rangeIndex)
@@ -876,16 +1275,7 @@ namespace nv { namespace perf {
                 {
                     return false;
                 }
-
-                assert(timestamp.start < timestamp.end);
-                SampleInfo& sampleInfo = m_sampleInfoRingBuffer[m_putIndex];
-                sampleInfo.beginTimestamp = timestamp.start;
-                sampleInfo.endTimestamp = timestamp.end;
-                sampleInfo.pCounterData = pCounterDataImage;
-                sampleInfo.rangeIndex = rangeIndex;
-                m_putIndex = CircularIncrement(m_putIndex, m_sampleInfoRingBuffer.size());
-                ++m_numUnreadSamples;
-                return true;
+                return PushSampleInfo(timestamp.start, timestamp.end, pCounterDataImage, rangeIndex);
             }
 
             bool IsDataComplete(uint64_t frameEndTime) const
@@ -921,89 +1311,10 @@ namespace nv { namespace perf {
                 const uint32_t combinedCounterDataRangeIndex = m_combinedCounterDataRangeIndex;
                 ++m_combinedCounterDataRangeIndex;
 
-                size_t numSamplesInFrame = 0;
-                while (m_numUnreadSamples)
+                const size_t numSamplesInFrame = CollectFrameSamples(frameEndTime);
+                if (!m_combiner.SumIntoRange(combinedCounterDataRangeIndex, m_frameSamples.data(), numSamplesInFrame))
                 {
-                    const SampleInfo& sampleInfo = m_sampleInfoRingBuffer[m_getIndex];
-                    if (sampleInfo.beginTimestamp >= frameEndTime)
-                    {
-                        //                  +----------+
-                        //                  |  Sample  |
-                        //                  +----------+
-                        // +------------+
-                        // | This Frame |
-                        // +------------+
-                        // belongs to a future frame => early break
-                        break;
-                    }
-                    else if (sampleInfo.endTimestamp <= m_frameBeginTime)
-                    {
-                        // +----------+
-                        // |  Sample  |
-                        // +----------+
-                        //                  +------------+
-                        //                  | This Frame |
-                        //                  +------------+
-                        // belongs to a prior frame => ignore it
-                        m_getIndex = CircularIncrement(m_getIndex, m_sampleInfoRingBuffer.size());
-                        --m_numUnreadSamples;
-                        continue;
-                    }
-                    else if (sampleInfo.endTimestamp > frameEndTime)
-                    {
-                        //                  +----------------------+
-                        //                  |        Sample        |
-                        //                  +----------------------+
-                        //       +------------+
-                        //       | This Frame |
-                        //       +------------+
-                        //                         +------------+
-                        //          OR             | This Frame |
-                        //                         +------------+
-                        // partly falls into this frame, but partly belongs to a future frame => consume it but do not recycle it
-                        ++numSamplesInFrame;
-                        bool success = m_combiner.SumIntoRange(
-                            combinedCounterDataRangeIndex,
-                            sampleInfo.pCounterData,
-                            sampleInfo.rangeIndex,
-                            sampleInfo.beginTimestamp,
-                            sampleInfo.endTimestamp,
-                            m_frameBeginTime,
-                            frameEndTime);
-                        if (!success)
-                        {
-                            return false;
-                        }
-                        break;
-                    }
-                    else
-                    {
-                        //            +----------------------+
-                        //            |        Sample        |
-                        //            +----------------------+
-                        //                            +------------+
-                        //                            | This Frame |
-                        //                            +------------+
-                        //        +------------------------------------+
-                        //  OR    |         This Frame                 |
-                        //        +------------------------------------+
-                        // consume and recycle it
-                        ++numSamplesInFrame;
-                        m_getIndex = CircularIncrement(m_getIndex, m_sampleInfoRingBuffer.size());
-                        --m_numUnreadSamples;
-                        bool success = m_combiner.SumIntoRange(
-                            combinedCounterDataRangeIndex,
-                            sampleInfo.pCounterData,
-                            sampleInfo.rangeIndex,
-                            sampleInfo.beginTimestamp,
-                            sampleInfo.endTimestamp,
-                            m_frameBeginTime,
-                            frameEndTime);
-                        if (!success)
-                        {
-                            return false;
-                        }
-                    }
+                    return false;
                 }
 
                 frameInfo.beginTimestamp = m_frameBeginTime;
@@ -0,0 +1,551 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "NvPerfInit.h"
+#include "NvPerfCounterData.h"
+#include "NvPerfMappedFile.h"
+
+namespace nv { namespace perf { namespace sampler {
+
+    // On-disk layout of a counter data recording:
+    //   <path>       : CounterDataRecordingHeader | counter data prefix | chunk 0 | chunk 1 | ...
+    //   <path>.index : CounterDataRecordingIndexEntry per recorded range
+    // Every chunk is a complete counter data image of "numRangesPerChunk" fixed-size ranges, so a recorded range can be passed to the
+    // MetricsEvaluator straight from the mapping. Recorded range N lives in chunk "N / numRangesPerChunk" at range index "N % numRangesPerChunk".
+    struct CounterDataRecordingHeader
+    {
+        enum : uint32_t { CurrentVersion = 1 };
+
+        char magic[8];
+        uint32_t version;
+        uint32_t numRangesPerChunk;
+        uint64_t counterDataPrefixOffset;
+        uint64_t counterDataPrefixSize;
+        uint64_t chunksOffset;
+        uint64_t chunkSize;
+        uint64_t chunkStride;                // chunkSize rounded up to ChunkAlignment
+        uint64_t numRanges;                  // number of ranges whose chunk has been written to the file
+
+        static const char* Magic()
+        {
+            return "NVPWCDR";
+        }
+    };
+
+    struct CounterDataRecordingIndexEntry
+    {
+        uint64_t startTimestamp;
+        uint64_t endTimestamp;
+        uint32_t triggerCount;
+        uint32_t reserved;
+    };
+
+    inline std::string CounterDataRecordingIndexPath(const std::string& path)
+    {
+        return path + ".index";
+    }
+
+    // Appends decoded periodic sampler ranges to a recording on disk, e.g. from the callback of PeriodicSamplerTimeHistoryVulkan::ConsumeSamples():
+    //     sampler.ConsumeSamples([&](const uint8_t* pCounterDataImage, size_t counterDataImageSize, uint32_t rangeIndex, bool& stop) {
+    //         stop = false;
+    //         return recorder.AppendRange(pCounterDataImage, counterDataImageSize, rangeIndex);
+    //     });
+    // Ranges are copied into an in-memory chunk, which is written to the mapped file once it is full, so at most one chunk is lost if the process dies.
+    // The destructor cannot reach the chunk hooks of a derived class, so it only keeps the complete chunks already written; call Close() to keep the
+    // pending chunk as well. Derived classes must call Close() from their own destructor.
+    // Once a file cannot be grown, e.g. on a full disk, the recording stops: AppendRange() and Flush() fail from then on, and the chunks
+    // written before remain readable.
+    class CounterDataRecorder
+    {
+    public:
+        enum { ChunkAlignment = 64 };
+
+    protected:
+        MappedFile m_file;
+        MappedFile m_indexFile;
+        CounterDataCombiner m_combiner;
+        std::vector<uint8_t> m_chunkTemplate; // a chunk with all ranges created, used for fast initialization(memcpy)
+        uint32_t m_numRangesPerChunk;
+        uint64_t m_chunkStride;
+        uint64_t m_chunksOffset;
+        uint64_t m_numRanges;                 // number of ranges appended, including the ones in the pending chunk
+        uint64_t m_numRangesWritten;          // number of ranges in complete chunks written to the file
+        bool m_writeFailed;                   // sticky until Close(), the pending chunk can no longer be written in place
+
+    public:
+        CounterDataRecorder()
+            : m_numRangesPerChunk()
+            , m_chunkStride()
+            , m_chunksOffset()
+            , m_numRanges()
+            , m_numRangesWritten()
+            , m_writeFailed()
+        {
+        }
+        CounterDataRecorder(const CounterDataRecorder& recorder) = delete;
+        CounterDataRecorder& operator=(const CounterDataRecorder& recorder) = delete;
+        virtual ~CounterDataRecorder()
+        {
+            CloseFiles();
+        }
+
+        // "counterDataSource" is the counter data image the ranges will be appended from, e.g. RingBufferCounterData::GetCounterData()
+        bool Open(const std::string& path, const std::vector<uint8_t>& counterDataPrefix, const std::vector<uint8_t>& counterDataSource, uint32_t numRangesPerChunk = 64)
+        {
+            Close();
+            if (!numRangesPerChunk)
+            {
+                NV_PERF_LOG_ERR(20, "numRangesPerChunk must be greater than 0\n");
+                return false;
+            }
+            if (!InitializeChunk(counterDataPrefix, counterDataSource, numRangesPerChunk))
+            {
+                return false;
+            }
+            m_numRangesPerChunk = numRangesPerChunk;
+            const uint64_t chunkSize = GetChunk().size();
+            m_chunkStride = AlignUp(chunkSize);
+            const uint64_t counterDataPrefixOffset = AlignUp(sizeof(CounterDataRecordingHeader));
+            m_chunksOffset = AlignUp(counterDataPrefixOffset + counterDataPrefix.size());
+
+            if (!m_file.Create(path, (size_t)(m_chunksOffset + m_chunkStride)))
+            {
+                return false;
+            }
+            if (!m_indexFile.Create(CounterDataRecordingIndexPath(path), sizeof(CounterDataRecordingIndexEntry) * numRangesPerChunk))
+            {
+                m_file.Close();
+                return false;
+            }
+
+            CounterDataRecordingHeader header = {};
+            memcpy(header.magic, CounterDataRecordingHeader::Magic(), sizeof(header.magic)); // including the null terminator
+            header.version = CounterDataRecordingHeader::CurrentVersion;
+            header.numRangesPerChunk = numRangesPerChunk;
+            header.counterDataPrefixOffset = counterDataPrefixOffset;
+            header.counterDataPrefixSize = counterDataPrefix.size();
+            header.chunksOffset = m_chunksOffset;
+            header.chunkSize = chunkSize;
+            header.chunkStride = m_chunkStride;
+            header.numRanges = 0;
+            memcpy(m_file.Data(), &header, sizeof(header));
+            memcpy(m_file.Data() + counterDataPrefixOffset, counterDataPrefix.data(), counterDataPrefix.size());
+            return true;
+        }
+
+        bool IsOpen() const
+        {
+            return m_file.IsOpen();
+        }
+
+        uint64_t GetNumRanges() const
+        {
+            return m_numRanges;
+        }
+
+        bool AppendRange(const uint8_t* pCounterDataImage, size_t counterDataImageSize, uint32_t rangeIndex)
+        {
+            if (!IsOpen())
+            {
+                NV_PERF_LOG_ERR(20, "Not opened\n");
+                return false;
+            }
+
+            CounterDataRecordingIndexEntry indexEntry = {};
+            if (!GetRangeInfo(pCounterDataImage, counterDataImageSize, rangeIndex, indexEntry))
+            {
+                return false;
+            }
+            return AppendRange(pCounterDataImage, counterDataImageSize, rangeIndex, indexEntry);
+        }
+
+        // for ranges whose timestamps and trigger count are already known, e.g. ones copied out by a FlightRecorder
+        bool AppendRange(const uint8_t* pCounterDataImage, size_t counterDataImageSize, uint32_t rangeIndex, const CounterDataRecordingIndexEntry& indexEntry)
+        {
+            if (!IsOpen())
+            {
+                NV_PERF_LOG_ERR(20, "Not opened\n");
+                return false;
+            }
+            if (m_writeFailed)
+            {
+                NV_PERF_LOG_ERR(50, "The recording stopped after a failed write\n");
+                return false;
+            }
+
+            const uint32_t slot = (uint32_t)(m_numRanges % m_numRangesPerChunk);
+            if (!CopyRangeIntoChunk(slot, pCounterDataImage, counterDataImageSize, rangeIndex))
+            {
+                return false;
+            }
+
+            const size_t indexSize = (size_t)(m_numRanges + 1) * sizeof(CounterDataRecordingIndexEntry);
+            if (indexSize > m_indexFile.Size())
+            {
+                if (!ResizeFile(m_indexFile, GrowSize(m_indexFile.Size(), indexSize)))
+                {
+                    m_writeFailed = true;
+                    return false;
+                }
+            }
+            memcpy(m_indexFile.Data() + indexSize - sizeof(CounterDataRecordingIndexEntry), &indexEntry, sizeof(indexEntry));
+            ++m_numRanges;
+
+            if (slot == m_numRangesPerChunk - 1)
+            {
+                if (!WritePendingChunk())
+                {
+                    return false;
+                }
+                ResetChunk();
+            }
+            return true;
+        }
+
+        // writes the partially filled chunk, if any, and flushes both files. The pending chunk keeps accumulating afterwards.
+        bool Flush()
+        {
+            if (!IsOpen())
+            {
+                return true;
+            }
+            if (m_writeFailed)
+            {
+                // the chunks already written can still be flushed, but the recording is incomplete
+                m_indexFile.Flush();
+                m_file.Flush();
+                return false;
+            }
+            if (m_numRangesWritten != m_numRanges)
+            {
+                if (!WritePendingChunk())
+                {
+                    return false;
+                }
+            }
+            return m_indexFile.Flush() && m_file.Flush();
+        }
+
+        // flushes and trims the files to the recorded size
+        bool Close()
+        {
+            if (!IsOpen())
+            {
+                return true;
+            }
+            bool success = Flush();
+            success = CloseFiles() && success;
+            return success;
+        }
+
+    protected:
+        static uint64_t AlignUp(uint64_t value)
+        {
+            return (value + ChunkAlignment - 1) / ChunkAlignment * ChunkAlignment;
+        }
+
+        // trims the files to the ranges already written and closes them, without calling into the chunk hooks; ranges in the pending chunk are dropped
+        bool CloseFiles()
+        {
+            if (!IsOpen())
+            {
+                return true;
+            }
+            if (m_numRangesWritten != m_numRanges)
+            {
+                NV_PERF_LOG_WRN(50, "Dropping %llu ranges that were not flushed before closing the recording\n", (unsigned long long)(m_numRanges - m_numRangesWritten));
+            }
+            const uint64_t numChunks = (m_numRangesWritten + m_numRangesPerChunk - 1) / m_numRangesPerChunk;
+            bool success = m_file.Resize((size_t)(m_chunksOffset + numChunks * m_chunkStride));
+            success = m_indexFile.Resize((size_t)m_numRangesWritten * sizeof(CounterDataRecordingIndexEntry)) && success;
+            m_file.Close();
+            m_indexFile.Close();
+            m_combiner.Reset();
+            m_chunkTemplate.clear();
+            m_numRangesPerChunk = 0;
+            m_chunkStride = 0;
+            m_chunksOffset = 0;
+            m_numRanges = 0;
+            m_numRangesWritten = 0;
+            m_writeFailed = false;
+            return success;
+        }
+
+        // grows geometrically to amortize remapping, but never by more than 256MB at once
+        static size_t GrowSize(size_t currentSize, size_t requiredSize)
+        {
+            const size_t MaxGrowth = size_t(256) * 1024 * 1024;
+            const size_t growth = (std::min)((std::max)(currentSize, requiredSize - currentSize), MaxGrowth);
+            return (std::max)(currentSize + growth, requiredSize);
+        }
+
+        bool WritePendingChunk()
+        {
+            const uint64_t chunkIndex = m_numRangesWritten / m_numRangesPerChunk;
+            const uint64_t chunkOffset = m_chunksOffset + chunkIndex * m_chunkStride;
+            const std::vector<uint8_t>& chunk = GetChunk();
+            const size_t requiredSize = (size_t)(chunkOffset + m_chunkStride);
+            if (requiredSize > m_file.Size())
+            {
+                if (!ResizeFile(m_file, GrowSize(m_file.Size(), requiredSize)))
+                {
+                    m_writeFailed = true;
+                    return false;
+                }
+            }
+            memcpy(m_file.Data() + chunkOffset, chunk.data(), chunk.size());
+            m_numRangesWritten = m_numRanges;
+
+            // publish the new range count only after the chunk is in place
+            CounterDataRecordingHeader* pHeader = reinterpret_cast<CounterDataRecordingHeader*>(m_file.Data());
+            pHeader->numRanges = m_numRangesWritten;
+            return true;
+        }
+
+        // grows "file" while recording, e.g. overridden by tests to simulate a full disk
+        virtual bool ResizeFile(MappedFile& file, size_t size)
+        {
+            return file.Resize(size);
+        }
+
+        // sets up GetChunk() with "numRangesPerChunk" empty ranges
+        virtual bool InitializeChunk(const std::vector<uint8_t>& counterDataPrefix, const std::vector<uint8_t>& counterDataSource, uint32_t numRangesPerChunk)
+        {
+            if (!m_combiner.Initialize(counterDataPrefix.data(), counterDataPrefix.size(), numRangesPerChunk, counterDataSource.data()))
+            {
+                return false;
+            }
+            for (uint32_t ii = 0; ii < numRangesPerChunk; ++ii)
+            {
+                size_t rangeIndex = 0;
+                if (!m_combiner.CreateRange(rangeIndex))
+                {
+                    return false;
+                }
+            }
+            m_chunkTemplate = m_combiner.GetCounterData();
+            return true;
+        }
+
+        virtual std::vector<uint8_t>& GetChunk()
+        {
+            return m_combiner.GetCounterData();
+        }
+
+        virtual void ResetChunk()
+        {
+            m_combiner.GetCounterData() = m_chunkTemplate;
+        }
+
+        virtual bool CopyRangeIntoChunk(uint32_t slot, const uint8_t* pCounterDataImage, size_t counterDataImageSize, uint32_t rangeIndex)
+        {
+            return m_combiner.CopyIntoRange(slot, pCounterDataImage, rangeIndex);
+        }
+
+        virtual bool GetRangeInfo(const uint8_t* pCounterDataImage, size_t counterDataImageSize, uint32_t rangeIndex, CounterDataRecordingIndexEntry& indexEntry)
+        {
+            SampleTimestamp timestamp{};
+            if (!CounterDataGetSampleTime(pCounterDataImage, rangeIndex, timestamp))
+            {
+                return false;
+            }
+            uint32_t triggerCount = 0;
+            if (!CounterDataGetTriggerCount(pCounterDataImage, counterDataImageSize, rangeIndex, triggerCount))
+            {
+                return false;
+            }
+            indexEntry.startTimestamp = timestamp.start;
+            indexEntry.endTimestamp = timestamp.end;
+            indexEntry.triggerCount = triggerCount;
+            return true;
+        }
+    };
+
+    // Random access into a recording written by CounterDataRecorder, without loading it. Only ranges whose chunk has been written are visible,
+    // so a recording that is still being written, or one left behind by a crashed process, can be read as well.
+    // A range can be evaluated straight from the mapping:
+    //     reader.GetRange(index, pCounterDataImage, counterDataImageSize, rangeIndex);
+    //     MetricsEvaluatorSetDeviceAttributes(pMetricsEvaluator, pCounterDataImage, counterDataImageSize);
+    //     EvaluateToGpuValues(pMetricsEvaluator, pCounterDataImage, counterDataImageSize, rangeIndex, ...);
+    class CounterDataRecordingReader
+    {
+    private:
+        MappedFile m_file;
+        MappedFile m_indexFile;
+        CounterDataRecordingHeader m_header;
+        uint64_t m_numRanges;
+
+    public:
+        CounterDataRecordingReader()
+            : m_header()
+            , m_numRanges()
+        {
+        }
+        CounterDataRecordingReader(const CounterDataRecordingReader& reader) = delete;
+        CounterDataRecordingReader& operator=(const CounterDataRecordingReader& reader) = delete;
+        ~CounterDataRecordingReader() = default;
+
+        bool Open(const std::string& path)
+        {
+            Close();
+            if (!m_file.OpenReadOnly(path))
+            {
+                return false;
+            }
+            if (m_file.Size() < sizeof(CounterDataRecordingHeader))
+            {
+                NV_PERF_LOG_ERR(20, "%s is not a counter data recording\n", path.c_str());
+                Close();
+                return false;
+            }
+            memcpy(&m_header, m_file.Data(), sizeof(m_header));
+            if (strncmp(m_header.magic, CounterDataRecordingHeader::Magic(), sizeof(m_header.magic)) != 0)
+            {
+                NV_PERF_LOG_ERR(20, "%s is not a counter data recording\n", path.c_str());
+                Close();
+                return false;
+            }
+            if (m_header.version != CounterDataRecordingHeader::CurrentVersion)
+            {
+                NV_PERF_LOG_ERR(20, "Unsupported counter data recording version %u\n", m_header.version);
+                Close();
+                return false;
+            }
+            const uint64_t fileSize = m_file.Size();
+            if (!m_header.numRangesPerChunk || !m_header.chunkSize || m_header.chunkStride < m_header.chunkSize
+                || m_header.counterDataPrefixOffset > fileSize || m_header.counterDataPrefixSize > fileSize - m_header.counterDataPrefixOffset
+                || m_header.chunksOffset < m_header.counterDataPrefixOffset + m_header.counterDataPrefixSize || m_header.chunksOffset > fileSize)
+            {
+                NV_PERF_LOG_ERR(20, "Corrupted counter data recording header\n");
+                Close();
+                return false;
+            }
+            // every published range must be backed by a complete chunk, written chunks are never shrunk away
+            const uint64_t numChunks = (m_header.numRanges + m_header.numRangesPerChunk - 1) / m_header.numRangesPerChunk;
+            if (numChunks > (fileSize - m_header.chunksOffset) / m_header.chunkStride)
+            {
+                NV_PERF_LOG_ERR(20, "%s is truncated, %llu ranges are recorded but the file holds fewer\n", path.c_str(), (unsigned long long)m_header.numRanges);
+                Close();
+                return false;
+            }
+            if (!m_indexFile.OpenReadOnly(CounterDataRecordingIndexPath(path)))
+            {
+                Close();
+                return false;
+            }
+            if (m_indexFile.Size() / sizeof(CounterDataRecordingIndexEntry) < m_header.numRanges)
+            {
+                NV_PERF_LOG_ERR(20, "%s is truncated, %llu ranges are recorded but the index holds fewer\n", CounterDataRecordingIndexPath(path).c_str(), (unsigned long long)m_header.numRanges);
+                Close();
+                return false;
+            }
+            m_numRanges = m_header.numRanges;
+            return true;
+        }
+
+        void Close()
+        {
+            m_file.Close();
+            m_indexFile.Close();
+            m_header = CounterDataRecordingHeader();
+            m_numRanges = 0;
+        }
+
+        bool IsOpen() const
+        {
+            return m_file.IsOpen();
+        }
+
+        uint64_t GetNumRanges() const
+        {
+            return m_numRanges;
+        }
+
+        const uint8_t* GetCounterDataPrefix(size_t& counterDataPrefixSize) const
+        {
+            counterDataPrefixSize = (size_t)m_header.counterDataPrefixSize;
+            return m_file.Data() + m_header.counterDataPrefixOffset;
+        }
+
+        const CounterDataRecordingIndexEntry& GetIndexEntry(uint64_t index) const
+        {
+            return reinterpret_cast<const CounterDataRecordingIndexEntry*>(m_indexFile.Data())[index];
+        }
+
+        // returns the chunk holding recorded range "index", and the range index within it
+        bool GetRange(uint64_t index, const uint8_t*& pCounterDataImage, size_t& counterDataImageSize, uint32_t& rangeIndex) const
+        {
+            if (index >= m_numRanges)
+            {
+                NV_PERF_LOG_ERR(20, "Range %llu is out of bounds, the recording has %llu ranges\n", (unsigned long long)index, (unsigned long long)m_numRanges);
+                return false;
+            }
+            const uint64_t chunkIndex = index / m_header.numRangesPerChunk;
+            pCounterDataImage = m_file.Data() + m_header.chunksOffset + chunkIndex * m_header.chunkStride;
+            counterDataImageSize = (size_t)m_header.chunkSize;
+            rangeIndex = (uint32_t)(index % m_header.numRangesPerChunk);
+            return true;
+        }
+
+        // finds the recorded ranges [firstIndex, lastIndex) overlapping with [beginTimestamp, endTimestamp), assuming ranges are recorded in order
+        void FindRanges(uint64_t beginTimestamp, uint64_t endTimestamp, uint64_t& firstIndex, uint64_t& lastIndex) const
+        {
+            const CounterDataRecordingIndexEntry* pBegin = reinterpret_cast<const CounterDataRecordingIndexEntry*>(m_indexFile.Data());
+            const CounterDataRecordingIndexEntry* pEnd = pBegin + m_numRanges;
+            const CounterDataRecordingIndexEntry* pFirst = std::upper_bound(pBegin, pEnd, beginTimestamp, [](uint64_t timestamp, const CounterDataRecordingIndexEntry& entry) {
+                return timestamp < entry.endTimestamp;
+            });
+            const CounterDataRecordingIndexEntry* pLast = std::lower_bound(pFirst, pEnd, endTimestamp, [](const CounterDataRecordingIndexEntry& entry, uint64_t timestamp) {
+                return entry.startTimestamp < timestamp;
+            });
+            firstIndex = (uint64_t)(pFirst - pBegin);
+            lastIndex = (uint64_t)(pLast - pBegin);
+        }
+
+        // TConsumeRangeDataFunc should be in the form of bool(const uint8_t* pCounterDataImage, size_t counterDataImageSize, uint32_t rangeIndex,
+        // const CounterDataRecordingIndexEntry& indexEntry), return false to stop iterating
+        template <typename TConsumeRangeDataFunc>
+        bool ForEachRange(uint64_t beginTimestamp, uint64_t endTimestamp, TConsumeRangeDataFunc&& consumeRangeDataFunc) const
+        {
+            uint64_t firstIndex = 0;
+            uint64_t lastIndex = 0;
+            FindRanges(beginTimestamp, endTimestamp, firstIndex, lastIndex);
+            for (uint64_t index = firstIndex; index < lastIndex; ++index)
+            {
+                const uint8_t* pCounterDataImage = nullptr;
+                size_t counterDataImageSize = 0;
+                uint32_t rangeIndex = 0;
+                if (!GetRange(index, pCounterDataImage, counterDataImageSize, rangeIndex))
+                {
+                    return false;
+                }
+                if (!consumeRangeDataFunc(pCounterDataImage, counterDataImageSize, rangeIndex, GetIndexEntry(index)))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+}}}
@@ -16,12 +16,182 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <cstring>
 #include <vector>
+#if defined(_WIN32)
+#include <Windows.h>
+#elif defined(__linux__)
+#include <time.h>
+#else
+#include <chrono>
+#endif
+#include "NvPerfHash.h"
 
 namespace nv { namespace perf {
 
+#if defined(_WIN32)
+    // converts a QueryPerformanceCounter() value to the nanoseconds of GetCpuMarkerTimestamp()
+    inline uint64_t CpuMarkerTimestampFromPerformanceCounter(uint64_t ticks)
+    {
+        static const uint64_t frequency = []() {
+            LARGE_INTEGER li;
+            QueryPerformanceFrequency(&li);
+            return (uint64_t)li.QuadPart;
+        }();
+        return (ticks / frequency) * 1000000000ull + (ticks % frequency) * 1000000000ull / frequency;
+    }
+#endif
+
+    // CPU timestamp in nanoseconds, used for CpuMarkerTrace scopes. On Linux this is CLOCK_MONOTONIC_RAW, which NTP does not slew, so
+    // durations are comparable with GPU timestamps over long captures.
+    inline uint64_t GetCpuMarkerTimestamp()
+    {
+#if defined(_WIN32)
+        LARGE_INTEGER counter;
+        QueryPerformanceCounter(&counter);
+        return CpuMarkerTimestampFromPerformanceCounter((uint64_t)counter.QuadPart);
+#elif defined(__linux__)
+        timespec ts;
+        clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+        return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#else
+        return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+
+    // Maps marker names to dense 32-bit IDs, so that a trace can store each distinct name once instead of copying it on every push.
+    // All storage is allocated by Initialize(); interning more names or chars than that fails instead of allocating. The returned
+    // name pointers stay valid until Initialize() or Reset() is called again.
+    class CpuMarkerNameTable
+    {
+    public:
+        enum : uint32_t { InvalidNameId = 0xffffffffu };
+
+    private:
+        std::vector<char> m_chars;
+        std::vector<uint32_t> m_nameOffsets; // indexed by ID, into m_chars
+        std::vector<uint32_t> m_nameHashes;  // indexed by ID
+        std::vector<uint32_t> m_slots;       // open addressing with linear probing, holds IDs; the size is a power of 2
+        size_t m_numNames;
+        size_t m_numChars;
+
+    public:
+        CpuMarkerNameTable()
+            : m_numNames()
+            , m_numChars()
+        {
+        }
+
+        // maxNameChars includes the null terminators
+        void Initialize(size_t maxNames, size_t maxNameChars)
+        {
+            size_t numSlots = 1;
+            while (numSlots < maxNames * 2)
+            {
+                numSlots *= 2;
+            }
+            m_chars = std::vector<char>(maxNameChars);
+            m_nameOffsets = std::vector<uint32_t>(maxNames);
+            m_nameHashes = std::vector<uint32_t>(maxNames);
+            m_slots = std::vector<uint32_t>(numSlots, (uint32_t)InvalidNameId);
+            m_numNames = 0;
+            m_numChars = 0;
+        }
+
+        void Reset()
+        {
+            m_chars = std::vector<char>();
+            m_nameOffsets = std::vector<uint32_t>();
+            m_nameHashes = std::vector<uint32_t>();
+            m_slots = std::vector<uint32_t>();
+            m_numNames = 0;
+            m_numChars = 0;
+        }
+
+        size_t GetNumNames() const
+        {
+            return m_numNames;
+        }
+
+        // Returns InvalidNameId if the name has not been interned.
+        uint32_t Find(const char* pName, size_t length) const
+        {
+            if (m_slots.empty())
+            {
+                return InvalidNameId;
+            }
+            const uint32_t hash = Fnv1a32(pName, length);
+            const size_t slotMask = m_slots.size() - 1;
+            for (size_t slotIndex = hash & slotMask; ; slotIndex = (slotIndex + 1) & slotMask)
+            {
+                const uint32_t nameId = m_slots[slotIndex];
+                if (nameId == InvalidNameId)
+                {
+                    return InvalidNameId;
+                }
+                const char* pCandidate = &m_chars[m_nameOffsets[nameId]];
+                if (m_nameHashes[nameId] == hash && !std::strncmp(pCandidate, pName, length) && pCandidate[length] == '\0')
+                {
+                    return nameId;
+                }
+            }
+        }
+
+        // Returns the ID of the name, registering it on first use; returns InvalidNameId if the table is full.
+        // If "length" is 0, pName must be a null terminated string.
+        uint32_t Intern(const char* pName, size_t length)
+        {
+            if (!length)
+            {
+                length = std::strlen(pName);
+            }
+            const uint32_t existingNameId = Find(pName, length);
+            if (existingNameId != InvalidNameId)
+            {
+                return existingNameId;
+            }
+            if (m_numNames == m_nameOffsets.size() || m_numChars + length + 1 > m_chars.size())
+            {
+                return InvalidNameId;
+            }
+
+            const uint32_t nameId = (uint32_t)m_numNames++;
+            const uint32_t hash = Fnv1a32(pName, length);
+            std::memcpy(&m_chars[m_numChars], pName, length);
+            m_chars[m_numChars + length] = '\0';
+            m_nameOffsets[nameId] = (uint32_t)m_numChars;
+            m_nameHashes[nameId] = hash;
+            m_numChars += length + 1;
+
+            const size_t slotMask = m_slots.size() - 1;
+            size_t slotIndex = hash & slotMask;
+            while (m_slots[slotIndex] != InvalidNameId)
+            {
+                slotIndex = (slotIndex + 1) & slotMask;
+            }
+            m_slots[slotIndex] = nameId;
+            return nameId;
+        }
+
+        uint32_t Intern(const char* pName)
+        {
+            return Intern(pName, std::strlen(pName));
+        }
+
+        // Returns nullptr for IDs that were not returned by Intern().
+        const char* GetName(uint32_t nameId) const
+        {
+            if (nameId >= m_numNames)
+            {
+                return nullptr;
+            }
+            return &m_chars[m_nameOffsets[nameId]];
+        }
+    };
+
     template <class FrameUserData>
     class CpuMarkerTrace
     {
@@ -35,9 +205,19 @@ namespace nv { namespace perf {
             FrameUserData* pUserData;
         };
 
+        enum { MaxScopeDepth = 64 }; // markers nested in this many scopes or more are dropped
+        enum : uint32_t { InvalidMarkerIndex = 0xffffffffu };
+
+        // A frame's markers are stored in the order they were pushed, which for scopes is a pre-order flattening of the scope tree:
+        // each scope is followed by its descendants, and parentIndex points back to the enclosing scope within the same frame.
         struct Marker
         {
-            const char* pName; // null-terminated string
+            const char* pName;       // null-terminated string
+            uint64_t beginTimestamp; // GetCpuMarkerTimestamp() at the push
+            uint64_t endTimestamp;   // GetCpuMarkerTimestamp() at the matching PopScope(); equal to beginTimestamp for PushMarker()
+            uint32_t nameId;         // CpuMarkerNameTable::InvalidNameId unless pushed with PushInternedMarker() or PushInternedScope()
+            uint32_t depth;          // number of enclosing scopes
+            uint32_t parentIndex;    // index of the enclosing scope in this frame, or InvalidMarkerIndex
         };
 
         struct FrameMarkers
@@ -48,6 +228,8 @@ namespace nv { namespace perf {
             const Marker* pBegin;
             const Marker* pEnd;
             const FrameUserData* pUserData;
+            uint64_t beginTimestamp; // GetCpuMarkerTimestamp() at the end of the previous frame
+            uint64_t endTimestamp;   // GetCpuMarkerTimestamp() at this frame's OnFrameEnd()
         };
 
     private:
@@ -57,6 +239,8 @@ namespace nv { namespace perf {
             size_t validMarkerCount;
             size_t droppedMarkerCount;
             size_t totalNameCharCount;
+            uint64_t beginTimestamp;
+            uint64_t endTimestamp;
             FrameUserData userData;
         };
 
@@ -94,11 +278,152 @@ namespace nv { namespace perf {
         // if the frame ring buffer becomes not-full in the middle of a frame.
         bool m_frameInvalid;
 
+        // Set once a marker of the current frame did not fit into its marker or name buffer, and cleared when the next frame begins.
+        // All later markers of the frame are dropped as well, so that the recorded markers stay a prefix of the pushed ones.
+        bool m_frameBuffersFull;
+
+        // Interned names live here instead of in the names ring; see PushInternedMarker().
+        CpuMarkerNameTable m_nameTable;
+
+        // Indices of the open scopes' markers in the current frame, InvalidMarkerIndex for scopes that were dropped or began in an earlier frame.
+        // m_scopeDepth keeps counting past MaxScopeDepth so that pops stay balanced, but scopes that deep are dropped.
+        uint32_t m_scopeStack[MaxScopeDepth];
+        size_t m_scopeDepth;
+
         static size_t CircularIncrement(size_t index, size_t max)
         {
             return (++index >= max) ? 0 : index;
         }
 
+        // Reserves the next marker with a copy of the name; returns nullptr if data was dropped.
+        Marker* RecordMarker(const char* pName, const size_t length)
+        {
+            // Initialization has not run yet.
+            if (!m_pFramesRing)
+            {
+                return nullptr;
+            }
+
+            // If the buffer is completely full, or was full earlier in this frame, drop all markers and do not write to the current write index.
+            if (m_frameInvalid)
+            {
+                return nullptr;
+            }
+            const size_t nameLength = length ? length : std::strlen(pName);
+            Frame& frame = m_pFramesRing[m_writeFrameIndex];
+
+            // Record the total chars, even if this marker is dropped,
+            // so the number reported as dropped chars is correct.
+            frame.totalNameCharCount += nameLength + 1;
+
+            // A marker nested too deep is dropped on its own, markers after its scope are still recorded.
+            if (m_scopeDepth >= MaxScopeDepth)
+            {
+                frame.droppedMarkerCount += 1;
+                return nullptr;
+            }
+
+            // Bounds check write pointers within current frame; if no space, then drop the Marker.
+            // If a marker was previously dropped this frame for lack of space, all subsequent shall be dropped as well.
+            if (m_frameBuffersFull || m_writeMarkerIndex == m_maxMarkersPerFrame || m_writeNameIndex + nameLength + 1 > m_maxNameCharsPerFrame)
+            {
+                m_frameBuffersFull = true;
+                frame.droppedMarkerCount += 1;
+                return nullptr;
+            }
+
+            // record the marker name in the current name buffer
+            char* pNameDest = m_pFrameNames + m_writeNameIndex;
+            std::memcpy(pNameDest, pName, nameLength);
+            pNameDest[nameLength] = '\0';
+            m_writeNameIndex += nameLength + 1;
+
+            // record the marker in the current marker buffer, and set pointer to location in name buffer
+            Marker& marker = m_pFrameMarkers[m_writeMarkerIndex];
+            marker.pName = pNameDest;
+            marker.nameId = CpuMarkerNameTable::InvalidNameId;
+            m_writeMarkerIndex += 1;
+
+            frame.validMarkerCount += 1;
+
+            return &marker;
+        }
+
+        // Reserves the next marker for an interned name; returns nullptr if data was dropped.
+        Marker* RecordInternedMarker(uint32_t nameId)
+        {
+            const char* pName = m_nameTable.GetName(nameId);
+            if (!m_pFramesRing || m_frameInvalid || !pName)
+            {
+                return nullptr;
+            }
+            Frame& frame = m_pFramesRing[m_writeFrameIndex];
+            if (m_scopeDepth >= MaxScopeDepth)
+            {
+                frame.droppedMarkerCount += 1;
+                return nullptr;
+            }
+            if (m_frameBuffersFull || m_writeMarkerIndex == m_maxMarkersPerFrame)
+            {
+                m_frameBuffersFull = true;
+                frame.droppedMarkerCount += 1;
+                return nullptr;
+            }
+
+            Marker& marker = m_pFrameMarkers[m_writeMarkerIndex];
+            marker.pName = pName;
+            marker.nameId = nameId;
+            m_writeMarkerIndex += 1;
+
+            frame.validMarkerCount += 1;
+            return &marker;
+        }
+
+        uint32_t GetCurrentParentIndex() const
+        {
+            return (m_scopeDepth && m_scopeDepth <= MaxScopeDepth) ? m_scopeStack[m_scopeDepth - 1] : (uint32_t)InvalidMarkerIndex;
+        }
+
+        bool StampMarker(Marker* pMarker)
+        {
+            if (!pMarker)
+            {
+                return false;
+            }
+            pMarker->beginTimestamp = GetCpuMarkerTimestamp();
+            pMarker->endTimestamp = pMarker->beginTimestamp;
+            pMarker->depth = (uint32_t)m_scopeDepth;
+            pMarker->parentIndex = GetCurrentParentIndex();
+            return true;
+        }
+
+        // The scope is pushed even if its marker was dropped, so that PopScope() stays balanced.
+        bool BeginScope(Marker* pMarker)
+        {
+            const bool recorded = StampMarker(pMarker);
+            if (m_scopeDepth < MaxScopeDepth)
+            {
+                m_scopeStack[m_scopeDepth] = recorded ? (uint32_t)(pMarker - m_pFrameMarkers) : (uint32_t)InvalidMarkerIndex;
+            }
+            ++m_scopeDepth;
+            return recorded;
+        }
+
+        // Scopes still open at the end of a frame are closed at the frame's end. Markers pushed within them in later frames keep their depth,
+        // but have no parent marker.
+        void CloseOpenScopes(uint64_t timestamp)
+        {
+            const size_t numStoredScopes = (std::min)(m_scopeDepth, (size_t)MaxScopeDepth);
+            for (size_t scopeIndex = 0; scopeIndex < numStoredScopes; ++scopeIndex)
+            {
+                if (m_scopeStack[scopeIndex] != InvalidMarkerIndex)
+                {
+                    m_pFrameMarkers[m_scopeStack[scopeIndex]].endTimestamp = timestamp;
+                    m_scopeStack[scopeIndex] = InvalidMarkerIndex;
+                }
+            }
+        }
+
     public:
         // Use this to see the total number of bytes required for a pre-allocated buffer to use with Initialize().
         static size_t GetTotalMemoryUsage(size_t maxFrames, size_t maxMarkersPerFrame, size_t maxNameCharsPerFrame)
@@ -139,8 +464,11 @@ namespace nv { namespace perf {
             m_readFrameIndex = 0;
             m_unreadFrameCount = 0;
             m_frameInvalid = false;
+            m_frameBuffersFull = false;
+            m_scopeDepth = 0;
 
             m_pFramesRing[m_writeFrameIndex] = {};
+            m_pFramesRing[m_writeFrameIndex].beginTimestamp = GetCpuMarkerTimestamp();
         }
 
         // Initializes all data structures required for this class, using class-owned memory.
@@ -160,6 +488,25 @@ namespace nv { namespace perf {
             m_pNamesRing = nullptr;
             m_unreadFrameCount = 0;
             m_storage = std::move(std::vector<uint8_t>());
+            m_nameTable.Reset();
+        }
+
+        // Allocates the table used by InternMarkerName() and PushInternedMarker(); maxNameChars includes the null terminators.
+        // This may be called before or after Initialize(), but invalidates all previously interned IDs and names.
+        void InitializeNameTable(size_t maxNames, size_t maxNameChars)
+        {
+            m_nameTable.Initialize(maxNames, maxNameChars);
+        }
+
+        const CpuMarkerNameTable& GetNameTable() const
+        {
+            return m_nameTable;
+        }
+
+        // Returns an ID for PushInternedMarker(), or CpuMarkerNameTable::InvalidNameId if the name table is full or not initialized.
+        uint32_t InternMarkerName(const char* pName, size_t length = 0)
+        {
+            return m_nameTable.Intern(pName, length);
         }
 
         // Returns true on successful recording of the Marker; returns false if data was dropped.
@@ -169,51 +516,68 @@ namespace nv { namespace perf {
         // pName must not be nullptr.
         bool PushMarker(const char* pName, const size_t length)
         {
-            // Initialization has not run yet.
-            if (!m_pFramesRing)
+            return StampMarker(RecordMarker(pName, length));
+        }
+
+        bool PushMarker(const char* pName)
+        {
+            return PushMarker(pName, std::strlen(pName));
+        }
+
+        // Records a marker whose name was interned with InternMarkerName(). Only the ID and a pointer into the name table are stored, so this
+        // consumes no space in the names ring and costs the same regardless of the name's length.
+        // Returns false if data was dropped, under the same rules as PushMarker(), or if nameId is not valid.
+        bool PushInternedMarker(uint32_t nameId)
+        {
+            return StampMarker(RecordInternedMarker(nameId));
+        }
+
+        // Interns the name on first use and records it by ID. If the name table is full, the name is copied as with PushMarker().
+        bool PushInternedMarker(const char* pName, size_t length = 0)
+        {
+            if (!length)
             {
-                return false;
+                length = std::strlen(pName);
             }
-
-            // If the buffer is completely full, or was full earlier in this frame, drop all markers and do not write to the current write index.
-            if (m_frameInvalid)
+            const uint32_t nameId = m_nameTable.Intern(pName, length);
+            if (nameId == CpuMarkerNameTable::InvalidNameId)
             {
-                return false;
+                return PushMarker(pName, length);
             }
-            const size_t nameLength = length ? length : std::strlen(pName);
-            Frame& frame = m_pFramesRing[m_writeFrameIndex];
+            return PushInternedMarker(nameId);
+        }
 
-            // Record the total chars, even if this marker is dropped,
-            // so the number reported as dropped chars is correct.
-            frame.totalNameCharCount += nameLength + 1;
+        // Begins a timed scope, which lasts until the matching PopScope(). Markers pushed in between become its children.
+        // Returns false if the scope's marker was dropped, under the same rules as PushMarker(), or because it is nested MaxScopeDepth
+        // levels deep; it must still be popped.
+        bool PushScope(const char* pName, const size_t length = 0)
+        {
+            return BeginScope(RecordMarker(pName, length));
+        }
 
-            // Bounds check write pointers within current frame; if no space, then drop the Marker.
-            // If a marker was previously dropped this frame, all subsequent shall be dropped as well.
-            if (frame.droppedMarkerCount || m_writeMarkerIndex == m_maxMarkersPerFrame || m_writeNameIndex + nameLength + 1 > m_maxNameCharsPerFrame)
+        bool PushInternedScope(uint32_t nameId)
+        {
+            return BeginScope(RecordInternedMarker(nameId));
+        }
+
+        // Ends the innermost open scope. Returns false if no scope is open.
+        bool PopScope()
+        {
+            if (!m_scopeDepth)
             {
-                frame.droppedMarkerCount += 1;
                 return false;
             }
-
-            // record the marker name in the current name buffer
-            char* pNameDest = m_pFrameNames + m_writeNameIndex;
-            std::memcpy(pNameDest, pName, nameLength);
-            pNameDest[nameLength] = '\0';
-            m_writeNameIndex += nameLength + 1;
-
-            // record the marker in the current marker buffer, and set pointer to location in name buffer
-            Marker& marker = m_pFrameMarkers[m_writeMarkerIndex];
-            marker.pName = pNameDest;
-            m_writeMarkerIndex += 1;
-
-            frame.validMarkerCount += 1;
-
+            --m_scopeDepth;
+            if (m_scopeDepth < MaxScopeDepth && m_scopeStack[m_scopeDepth] != InvalidMarkerIndex)
+            {
+                m_pFrameMarkers[m_scopeStack[m_scopeDepth]].endTimestamp = GetCpuMarkerTimestamp();
+            }
             return true;
         }
 
-        bool PushMarker(const char* pName)
+        size_t GetCurrentScopeDepth() const
         {
-            return PushMarker(pName, std::strlen(pName));
+            return m_scopeDepth;
         }
 
         // This function should be called by the user once a frame is finished.
@@ -222,6 +586,8 @@ namespace nv { namespace perf {
         // subsequent calls to PushMarker will fail until OnFrameEnd is called with space available.
         bool OnFrameEnd()
         {
+            const uint64_t timestamp = GetCpuMarkerTimestamp();
+
             // If the current frame was dropped, no new information has been written, so there are no new unread frames.
             if (m_frameInvalid)
             {
@@ -229,6 +595,8 @@ namespace nv { namespace perf {
             }
             else
             {
+                CloseOpenScopes(timestamp);
+                m_pFramesRing[m_writeFrameIndex].endTimestamp = timestamp;
                 m_unreadFrameCount += 1;
             }
 
@@ -243,8 +611,10 @@ namespace nv { namespace perf {
 
             // Clear the new frame.  Note this is O(1).
             m_pFramesRing[m_writeFrameIndex] = {};
+            m_pFramesRing[m_writeFrameIndex].beginTimestamp = timestamp;
             m_writeMarkerIndex = 0;
             m_writeNameIndex = 0;
+            m_frameBuffersFull = false;
 
             m_pFrameNames = m_pNamesRing + m_writeFrameIndex * m_maxNameCharsPerFrame;
             m_pFrameMarkers = m_pMarkersRing + m_writeFrameIndex * m_maxMarkersPerFrame;
@@ -270,6 +640,8 @@ namespace nv { namespace perf {
             frameMarkers.pBegin = m_pMarkersRing + (m_readFrameIndex * m_maxMarkersPerFrame);
             frameMarkers.pEnd = frameMarkers.pBegin + frame.validMarkerCount;
             frameMarkers.pUserData = &frame.userData;
+            frameMarkers.beginTimestamp = frame.beginTimestamp;
+            frameMarkers.endTimestamp = frame.endTimestamp;
             return frameMarkers;
         }
 
@@ -304,4 +676,371 @@ namespace nv { namespace perf {
         }
     };
 
+    // Tags all markers subsequently pushed from the calling thread into any CpuMarkerTraceMultiProducer, e.g. with a job system's worker
+    // index. Threads that never set a tag push markers tagged with 0.
+    inline uint32_t& CpuMarkerThreadTag()
+    {
+        static thread_local uint32_t threadTag = 0;
+        return threadTag;
+    }
+
+    inline void SetCpuMarkerThreadTag(uint32_t threadTag)
+    {
+        CpuMarkerThreadTag() = threadTag;
+    }
+
+    // A variant of CpuMarkerTrace that PushMarker() can be called on from any number of threads concurrently. Marker and name slots in the
+    // current frame's partition are reserved with a single atomic fetch-add, so pushing never blocks or retries. The per-frame QoS is the
+    // same: once a marker didn't fit, all subsequent markers of the frame are dropped and counted.
+    // OnFrameEnd(), UpdateCurrentFrameUserData() and the read functions remain single-threaded, and OnFrameEnd() must not run concurrently
+    // with PushMarker(); in a job system, call it after the frame's jobs have been synchronized.
+    // Markers carry a timestamp but no nesting, since scopes would need a stack per thread; use CpuMarkerTrace per thread for timed scopes.
+    // Per-frame limits must be below 2^31.
+    template <class FrameUserData>
+    class CpuMarkerTraceMultiProducer
+    {
+    public:
+        // parameter struct that will be passed to the callback given to UpdateCurrentFrameUserData
+        struct FrameUserDataFnParams
+        {
+            size_t validMarkerCount;
+            size_t droppedMarkerCount;
+            size_t droppedCharCount;
+            FrameUserData* pUserData;
+        };
+
+        struct Marker
+        {
+            const char* pName;  // null-terminated string
+            uint64_t timestamp; // GetCpuMarkerTimestamp() at the push
+            uint32_t nameId;    // CpuMarkerNameTable::InvalidNameId unless pushed with PushInternedMarker()
+            uint32_t threadTag; // CpuMarkerThreadTag() of the pushing thread
+        };
+
+        struct FrameMarkers
+        {
+            size_t validMarkerCount;
+            size_t droppedMarkerCount;
+            size_t droppedNameCharCount;
+            const Marker* pBegin;
+            const Marker* pEnd;
+            const FrameUserData* pUserData;
+        };
+
+    private:
+        enum { CacheLineSize = 64 };
+
+        // internal data stored for each frame, the counts of the current frame are only filled in by OnFrameEnd()
+        struct Frame
+        {
+            size_t validMarkerCount;
+            size_t droppedMarkerCount;
+            size_t totalNameCharCount;
+            FrameUserData userData;
+        };
+
+        std::vector<uint8_t> m_storage;
+
+        Frame* m_pFramesRing;
+        Marker* m_pMarkersRing;
+        char* m_pNamesRing;
+
+        size_t m_maxFrames;
+        size_t m_maxMarkersPerFrame;
+        size_t m_maxNameCharsPerFrame;
+
+        size_t m_writeFrameIndex;
+        char* m_pFrameNames;
+        Marker* m_pFrameMarkers;
+        size_t m_readFrameIndex;
+        size_t m_unreadFrameCount;
+        bool m_frameInvalid;
+
+        // Reservations of the current frame: the upper 32 bits count markers, the lower 32 bits count name chars including terminators.
+        // Both only grow within a frame, so once a reservation fails every later one fails as well, and the successful ones form a prefix.
+        alignas(CacheLineSize) std::atomic<uint64_t> m_reserved;
+        // Drops of the current frame. Markers rejected without a reservation, because the frame already overflowed, are counted separately
+        // since they don't appear in m_reserved.
+        alignas(CacheLineSize) std::atomic<size_t> m_droppedMarkerCount;
+        std::atomic<size_t> m_unreservedDroppedMarkerCount;
+        std::atomic<size_t> m_unreservedDroppedNameCharCount;
+
+        CpuMarkerNameTable m_nameTable;
+
+        static size_t CircularIncrement(size_t index, size_t max)
+        {
+            return (++index >= max) ? 0 : index;
+        }
+
+        static uint64_t MakeReservation(size_t markerCount, size_t nameCharCount)
+        {
+            return ((uint64_t)markerCount << 32) | (uint64_t)nameCharCount;
+        }
+
+        // the counts of the current frame, exact once no PushMarker() is in flight
+        void GetCurrentFrameCounts(size_t& validMarkerCount, size_t& droppedMarkerCount, size_t& totalNameCharCount) const
+        {
+            const uint64_t reserved = m_reserved.load(std::memory_order_acquire);
+            const size_t reservedMarkerCount = (size_t)(reserved >> 32);
+            const size_t unreservedDroppedMarkerCount = m_unreservedDroppedMarkerCount.load(std::memory_order_relaxed);
+            droppedMarkerCount = m_droppedMarkerCount.load(std::memory_order_relaxed);
+            const size_t reservedDroppedMarkerCount = droppedMarkerCount - (std::min)(droppedMarkerCount, unreservedDroppedMarkerCount);
+            validMarkerCount = reservedMarkerCount - (std::min)(reservedMarkerCount, reservedDroppedMarkerCount);
+            totalNameCharCount = (size_t)(reserved & 0xffffffffu) + m_unreservedDroppedNameCharCount.load(std::memory_order_relaxed);
+        }
+
+        // Reserves a marker slot and nameCharCount chars in the current frame; returns false if the marker was dropped.
+        bool Reserve(size_t nameCharCount, size_t& markerIndex, size_t& nameIndex)
+        {
+            // once the frame has overflowed, drop without touching the reservation counter, so that it can't grow without bounds
+            const uint64_t reserved = m_reserved.load(std::memory_order_relaxed);
+            if ((size_t)(reserved >> 32) >= m_maxMarkersPerFrame || (size_t)(reserved & 0xffffffffu) > m_maxNameCharsPerFrame)
+            {
+                m_unreservedDroppedNameCharCount.fetch_add(nameCharCount, std::memory_order_relaxed);
+                m_unreservedDroppedMarkerCount.fetch_add(1, std::memory_order_relaxed);
+                m_droppedMarkerCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            const uint64_t reservation = m_reserved.fetch_add(MakeReservation(1, nameCharCount), std::memory_order_relaxed);
+            markerIndex = (size_t)(reservation >> 32);
+            nameIndex = (size_t)(reservation & 0xffffffffu);
+            if (markerIndex >= m_maxMarkersPerFrame || nameIndex + nameCharCount > m_maxNameCharsPerFrame)
+            {
+                m_droppedMarkerCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            return true;
+        }
+
+        void ResetCurrentFrameCounts()
+        {
+            m_reserved.store(0, std::memory_order_relaxed);
+            m_droppedMarkerCount.store(0, std::memory_order_relaxed);
+            m_unreservedDroppedMarkerCount.store(0, std::memory_order_relaxed);
+            m_unreservedDroppedNameCharCount.store(0, std::memory_order_relaxed);
+        }
+
+    public:
+        CpuMarkerTraceMultiProducer()
+            : m_pFramesRing(nullptr)
+            , m_pMarkersRing(nullptr)
+            , m_pNamesRing(nullptr)
+            , m_maxFrames()
+            , m_maxMarkersPerFrame()
+            , m_maxNameCharsPerFrame()
+            , m_writeFrameIndex()
+            , m_pFrameNames(nullptr)
+            , m_pFrameMarkers(nullptr)
+            , m_readFrameIndex()
+            , m_unreadFrameCount()
+            , m_frameInvalid(false)
+            , m_reserved(0)
+            , m_droppedMarkerCount(0)
+            , m_unreservedDroppedMarkerCount(0)
+            , m_unreservedDroppedNameCharCount(0)
+        {
+        }
+        CpuMarkerTraceMultiProducer(const CpuMarkerTraceMultiProducer& trace) = delete;
+        CpuMarkerTraceMultiProducer& operator=(const CpuMarkerTraceMultiProducer& trace) = delete;
+
+        static size_t GetTotalMemoryUsage(size_t maxFrames, size_t maxMarkersPerFrame, size_t maxNameCharsPerFrame)
+        {
+            return maxFrames * (sizeof(Frame) + (maxMarkersPerFrame * sizeof(Marker)) + (maxNameCharsPerFrame * sizeof(char)));
+        }
+
+        // Approximate while PushMarker() calls are in flight.
+        size_t GetCurrentFrameDroppedMarkerCount() const
+        {
+            return m_droppedMarkerCount.load(std::memory_order_relaxed);
+        }
+
+        size_t GetUnreadFrameCount() const
+        {
+            return m_unreadFrameCount;
+        }
+
+        // See CpuMarkerTrace::Initialize(). Not thread-safe.
+        void Initialize(size_t maxFrames, size_t maxMarkersPerFrame, size_t maxNameCharsPerFrame, uint8_t* pStorage)
+        {
+            m_pFramesRing = reinterpret_cast<Frame*>(pStorage);
+            m_pMarkersRing = reinterpret_cast<Marker*>(pStorage + maxFrames * sizeof(Frame));
+            m_pNamesRing = reinterpret_cast<char*>(pStorage + maxFrames * (sizeof(Frame) + maxMarkersPerFrame * sizeof(Marker)));
+            m_maxFrames = maxFrames;
+            m_maxMarkersPerFrame = maxMarkersPerFrame;
+            m_maxNameCharsPerFrame = maxNameCharsPerFrame;
+            m_writeFrameIndex = 0;
+            m_pFrameMarkers = m_pMarkersRing;
+            m_pFrameNames = m_pNamesRing;
+            m_readFrameIndex = 0;
+            m_unreadFrameCount = 0;
+            m_frameInvalid = false;
+            ResetCurrentFrameCounts();
+
+            m_pFramesRing[m_writeFrameIndex] = {};
+        }
+
+        void Initialize(size_t maxFrames, size_t maxMarkersPerFrame, size_t maxNameCharsPerFrame)
+        {
+            m_storage = std::vector<uint8_t>(GetTotalMemoryUsage(maxFrames, maxMarkersPerFrame, maxNameCharsPerFrame));
+            return Initialize(maxFrames, maxMarkersPerFrame, maxNameCharsPerFrame, m_storage.data());
+        }
+
+        void Reset()
+        {
+            m_pFramesRing = nullptr;
+            m_pMarkersRing = nullptr;
+            m_pNamesRing = nullptr;
+            m_unreadFrameCount = 0;
+            m_storage = std::vector<uint8_t>();
+            m_nameTable.Reset();
+        }
+
+        // See CpuMarkerTrace::InitializeNameTable(). Not thread-safe.
+        void InitializeNameTable(size_t maxNames, size_t maxNameChars)
+        {
+            m_nameTable.Initialize(maxNames, maxNameChars);
+        }
+
+        const CpuMarkerNameTable& GetNameTable() const
+        {
+            return m_nameTable;
+        }
+
+        // Not thread-safe: intern all names up front, e.g. at startup, before producers push them concurrently.
+        uint32_t InternMarkerName(const char* pName, size_t length = 0)
+        {
+            return m_nameTable.Intern(pName, length);
+        }
+
+        // Thread-safe. Returns true on successful recording of the Marker; returns false if data was dropped.
+        // If "length" is 0, pName must be a null terminated string. pName must not be nullptr.
+        bool PushMarker(const char* pName, const size_t length)
+        {
+            if (!m_pFramesRing || m_frameInvalid)
+            {
+                return false;
+            }
+            const size_t nameLength = length ? length : std::strlen(pName);
+            size_t markerIndex = 0;
+            size_t nameIndex = 0;
+            if (!Reserve(nameLength + 1, markerIndex, nameIndex))
+            {
+                return false;
+            }
+
+            char* pNameDest = m_pFrameNames + nameIndex;
+            std::memcpy(pNameDest, pName, nameLength);
+            pNameDest[nameLength] = '\0';
+
+            Marker& marker = m_pFrameMarkers[markerIndex];
+            marker.pName = pNameDest;
+            marker.nameId = CpuMarkerNameTable::InvalidNameId;
+            marker.timestamp = GetCpuMarkerTimestamp();
+            marker.threadTag = CpuMarkerThreadTag();
+            return true;
+        }
+
+        bool PushMarker(const char* pName)
+        {
+            return PushMarker(pName, std::strlen(pName));
+        }
+
+        // Thread-safe, as long as no name is being interned concurrently. See CpuMarkerTrace::PushInternedMarker().
+        bool PushInternedMarker(uint32_t nameId)
+        {
+            const char* pName = m_nameTable.GetName(nameId);
+            if (!m_pFramesRing || m_frameInvalid || !pName)
+            {
+                return false;
+            }
+            size_t markerIndex = 0;
+            size_t nameIndex = 0;
+            if (!Reserve(0, markerIndex, nameIndex))
+            {
+                return false;
+            }
+
+            Marker& marker = m_pFrameMarkers[markerIndex];
+            marker.pName = pName;
+            marker.nameId = nameId;
+            marker.timestamp = GetCpuMarkerTimestamp();
+            marker.threadTag = CpuMarkerThreadTag();
+            return true;
+        }
+
+        // See CpuMarkerTrace::OnFrameEnd(). Must not be called concurrently with PushMarker().
+        bool OnFrameEnd()
+        {
+            if (m_frameInvalid)
+            {
+                m_frameInvalid = false;
+            }
+            else
+            {
+                Frame& frame = m_pFramesRing[m_writeFrameIndex];
+                GetCurrentFrameCounts(frame.validMarkerCount, frame.droppedMarkerCount, frame.totalNameCharCount);
+                m_unreadFrameCount += 1;
+            }
+
+            if (m_unreadFrameCount == m_maxFrames)
+            {
+                m_frameInvalid = true;
+                ResetCurrentFrameCounts();
+                return false;
+            }
+
+            m_writeFrameIndex = CircularIncrement(m_writeFrameIndex, m_maxFrames);
+            m_pFramesRing[m_writeFrameIndex] = {};
+            ResetCurrentFrameCounts();
+            m_pFrameNames = m_pNamesRing + m_writeFrameIndex * m_maxNameCharsPerFrame;
+            m_pFrameMarkers = m_pMarkersRing + m_writeFrameIndex * m_maxMarkersPerFrame;
+            return true;
+        }
+
+        FrameMarkers GetOldestFrameMarkers() const
+        {
+            if (m_unreadFrameCount == 0)
+            {
+                return FrameMarkers{};
+            }
+
+            const Frame& frame = m_pFramesRing[m_readFrameIndex];
+
+            FrameMarkers frameMarkers;
+            frameMarkers.validMarkerCount = frame.validMarkerCount;
+            frameMarkers.droppedMarkerCount = frame.droppedMarkerCount;
+            frameMarkers.droppedNameCharCount = (frame.totalNameCharCount > m_maxNameCharsPerFrame) ? frame.totalNameCharCount - m_maxNameCharsPerFrame : 0;
+            frameMarkers.pBegin = m_pMarkersRing + (m_readFrameIndex * m_maxMarkersPerFrame);
+            frameMarkers.pEnd = frameMarkers.pBegin + frame.validMarkerCount;
+            frameMarkers.pUserData = &frame.userData;
+            return frameMarkers;
+        }
+
+        void ReleaseOldestFrame()
+        {
+            if (!m_unreadFrameCount)
+            {
+                return;
+            }
+            m_unreadFrameCount--;
+            m_readFrameIndex = CircularIncrement(m_readFrameIndex, m_maxFrames);
+        }
+
+        // The counts passed to frameUserDataFn are approximate while PushMarker() calls are in flight.
+        template <class FrameUserDataFn>
+        void UpdateCurrentFrameUserData(FrameUserDataFn&& frameUserDataFn)
+        {
+            Frame& frame = m_pFramesRing[m_writeFrameIndex];
+
+            size_t totalNameCharCount = 0;
+            FrameUserDataFnParams frameUserDataFnParams;
+            GetCurrentFrameCounts(frameUserDataFnParams.validMarkerCount, frameUserDataFnParams.droppedMarkerCount, totalNameCharCount);
+            frameUserDataFnParams.droppedCharCount = (totalNameCharCount > m_maxNameCharsPerFrame) ? totalNameCharCount - m_maxNameCharsPerFrame : 0;
+            frameUserDataFnParams.pUserData = &(frame.userData);
+
+            frameUserDataFn(frameUserDataFnParams);
+        }
+    };
+
 }} // namespace nv::perf
@@ -0,0 +1,494 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#pragma once
+
+#include <stdio.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+#include "NvPerfInit.h"
+#include "NvPerfCounterData.h"
+#include "NvPerfCounterDataRecorder.h"
+
+namespace nv { namespace perf { namespace sampler {
+
+    // On-disk layout of the frame delimiters of a flight recorder dump, written next to the counter data recording:
+    //   <path>.frames : FlightRecorderFramesHeader | uint64_t frame end time per frame
+    struct FlightRecorderFramesHeader
+    {
+        enum : uint32_t { CurrentVersion = 1 };
+
+        char magic[8];
+        uint32_t version;
+        uint32_t numFrames;
+        uint64_t triggerTime;
+        uint64_t windowBeginTime;
+        uint64_t windowEndTime;
+
+        static const char* Magic()
+        {
+            return "NVPWFRF";
+        }
+    };
+
+    inline std::string FlightRecorderFramesPath(const std::string& path)
+    {
+        return path + ".frames";
+    }
+
+    // Keeps the most recent periodic sampler ranges and frame delimiters in pre-allocated rings, so the moments leading up to an event, e.g. a
+    // frame time spike, can be dumped for offline evaluation. Ranges are copied out of the sampler's counter data by range index, one
+    // CounterDataCombiner copy per range and no allocations, cheap enough to be fed every decoded range:
+    //     sampler.ConsumeSamples([&](const uint8_t* pCounterDataImage, size_t counterDataImageSize, uint32_t rangeIndex, bool& stop) {
+    //         stop = false;
+    //         return flightRecorder.AddRange(pCounterDataImage, counterDataImageSize, rangeIndex);
+    //     });
+    // PeriodicSamplerTimeHistoryVulkan::SetFlightRecorder() does this, as well as feeding the frame delimiters, automatically.
+    // Trigger() or a trigger predicate starts the post-trigger period, once ranges past it have been recorded the recorder freezes and ignores
+    // everything until Rearm(). Dump() writes the ranges and frames within [triggerTime - preTriggerDuration, triggerTime + postTriggerDuration)
+    // to a CounterDataRecorder recording. All timestamps are in the sampler's GPU time domain, in nanoseconds.
+    class FlightRecorder
+    {
+    public:
+        enum class State
+        {
+            Recording,
+            Triggered, // still recording, until the post-trigger period has been covered
+            Frozen,
+        };
+
+        // "frameDuration" is the time since the previous frame end
+        typedef std::function<bool(uint64_t frameEndTime, uint64_t frameDuration)> FrameTriggerFn;
+        // called on every recorded range, e.g. to evaluate a metric and compare it against a threshold
+        typedef std::function<bool(const uint8_t* pCounterDataImage, size_t counterDataImageSize, uint32_t rangeIndex, const CounterDataRecordingIndexEntry& rangeInfo)> RangeTriggerFn;
+
+    protected:
+        CounterDataCombiner m_combiner; // the range ring, a counter data image with one range per slot
+        std::vector<uint8_t> m_counterDataPrefix;
+        std::vector<CounterDataRecordingIndexEntry> m_rangeInfos; // per range slot
+        std::vector<uint64_t> m_frameEndTimes; // the frame ring
+        uint64_t m_numRangesRecorded;
+        uint64_t m_numFramesRecorded;
+        uint64_t m_preTriggerDuration;
+        uint64_t m_postTriggerDuration;
+        FrameTriggerFn m_frameTriggerFn;
+        RangeTriggerFn m_rangeTriggerFn;
+        State m_state;
+        uint64_t m_triggerTime;
+        uint64_t m_windowBeginTime;
+        uint64_t m_windowEndTime;
+
+    public:
+        FlightRecorder()
+            : m_numRangesRecorded()
+            , m_numFramesRecorded()
+            , m_preTriggerDuration(2000000000)
+            , m_postTriggerDuration(500000000)
+            , m_state(State::Recording)
+            , m_triggerTime()
+            , m_windowBeginTime()
+            , m_windowEndTime()
+        {
+        }
+        FlightRecorder(const FlightRecorder& flightRecorder) = delete;
+        FlightRecorder& operator=(const FlightRecorder& flightRecorder) = delete;
+        virtual ~FlightRecorder() = default;
+
+        // "counterDataSource" is the counter data image the ranges will be added from, e.g. RingBufferCounterData::GetCounterData(). To keep the
+        // last N seconds, "numRangeSlots" should be N seconds divided by the sampling interval, "numFrameSlots" N seconds times the frame rate.
+        bool Initialize(const std::vector<uint8_t>& counterDataPrefix, const std::vector<uint8_t>& counterDataSource, uint32_t numRangeSlots, uint32_t numFrameSlots)
+        {
+            Reset();
+            if (!numRangeSlots || !numFrameSlots)
+            {
+                NV_PERF_LOG_ERR(20, "numRangeSlots and numFrameSlots must be greater than 0\n");
+                return false;
+            }
+            if (!InitializeRing(counterDataPrefix, counterDataSource, numRangeSlots))
+            {
+                Reset();
+                return false;
+            }
+            m_counterDataPrefix = counterDataPrefix;
+            m_rangeInfos.assign(numRangeSlots, CounterDataRecordingIndexEntry{});
+            m_frameEndTimes.assign(numFrameSlots, 0);
+            return true;
+        }
+
+        // keeps the trigger window and predicates
+        void Reset()
+        {
+            ResetRing();
+            m_counterDataPrefix.clear();
+            m_rangeInfos.clear();
+            m_frameEndTimes.clear();
+            m_numRangesRecorded = 0;
+            m_numFramesRecorded = 0;
+            m_state = State::Recording;
+            m_triggerTime = 0;
+            m_windowBeginTime = 0;
+            m_windowEndTime = 0;
+        }
+
+        bool IsInitialized() const
+        {
+            return !m_rangeInfos.empty();
+        }
+
+        // takes effect on the next trigger. The range ring should cover both periods: pre-trigger ranges are never overwritten by post-trigger ones,
+        // the post-trigger period is cut short instead.
+        void SetTriggerWindow(uint64_t preTriggerDurationInNanoSeconds, uint64_t postTriggerDurationInNanoSeconds)
+        {
+            m_preTriggerDuration = preTriggerDurationInNanoSeconds;
+            m_postTriggerDuration = postTriggerDurationInNanoSeconds;
+        }
+
+        // pass an empty function to remove the predicate
+        void SetFrameTrigger(FrameTriggerFn frameTriggerFn)
+        {
+            m_frameTriggerFn = std::move(frameTriggerFn);
+        }
+
+        void SetRangeTrigger(RangeTriggerFn rangeTriggerFn)
+        {
+            m_rangeTriggerFn = std::move(rangeTriggerFn);
+        }
+
+        static FrameTriggerFn FrameTimeAbove(uint64_t frameTimeThresholdInNanoSeconds)
+        {
+            return [frameTimeThresholdInNanoSeconds](uint64_t /* frameEndTime */, uint64_t frameDuration) {
+                return frameDuration > frameTimeThresholdInNanoSeconds;
+            };
+        }
+
+        State GetState() const
+        {
+            return m_state;
+        }
+
+        bool IsFrozen() const
+        {
+            return m_state == State::Frozen;
+        }
+
+        uint64_t GetTriggerTime() const
+        {
+            return m_triggerTime;
+        }
+
+        uint32_t GetNumRangeSlots() const
+        {
+            return (uint32_t)m_rangeInfos.size();
+        }
+
+        uint32_t GetNumFrameSlots() const
+        {
+            return (uint32_t)m_frameEndTimes.size();
+        }
+
+        // including the ones overwritten since
+        uint64_t GetNumRangesRecorded() const
+        {
+            return m_numRangesRecorded;
+        }
+
+        uint64_t GetNumFramesRecorded() const
+        {
+            return m_numFramesRecorded;
+        }
+
+        // ranges added while frozen are ignored
+        bool AddRange(const uint8_t* pCounterDataImage, size_t counterDataImageSize, uint32_t rangeIndex)
+        {
+            if (!IsInitialized())
+            {
+                NV_PERF_LOG_ERR(50, "Not initialized\n");
+                return false;
+            }
+            if (m_state == State::Frozen)
+            {
+                return true;
+            }
+
+            const uint32_t slot = (uint32_t)(m_numRangesRecorded % m_rangeInfos.size());
+            if (m_state == State::Triggered && m_numRangesRecorded >= m_rangeInfos.size() && m_rangeInfos[slot].endTimestamp > m_windowBeginTime)
+            {
+                NV_PERF_LOG_WRN(50, "The pre- and post-trigger periods do not fit into %u range slots, the post-trigger period has been cut short\n", GetNumRangeSlots());
+                m_state = State::Frozen;
+                return true;
+            }
+
+            CounterDataRecordingIndexEntry rangeInfo = {};
+            if (!GetRangeInfo(pCounterDataImage, counterDataImageSize, rangeIndex, rangeInfo))
+            {
+                return false;
+            }
+            if (!CopyRangeIntoSlot(slot, pCounterDataImage, counterDataImageSize, rangeIndex))
+            {
+                return false;
+            }
+            m_rangeInfos[slot] = rangeInfo;
+            ++m_numRangesRecorded;
+
+            if (m_state == State::Recording)
+            {
+                if (m_rangeTriggerFn && m_rangeTriggerFn(pCounterDataImage, counterDataImageSize, rangeIndex, rangeInfo))
+                {
+                    Trigger(rangeInfo.endTimestamp);
+                }
+            }
+            else
+            {
+                FreezeIfWindowCovered();
+            }
+            return true;
+        }
+
+        // frames added while frozen are ignored
+        bool AddFrameDelimiter(uint64_t frameEndTime)
+        {
+            if (!IsInitialized())
+            {
+                NV_PERF_LOG_ERR(50, "Not initialized\n");
+                return false;
+            }
+            if (m_state == State::Frozen)
+            {
+                return true;
+            }
+
+            const uint64_t previousFrameEndTime = m_numFramesRecorded ? m_frameEndTimes[(m_numFramesRecorded - 1) % m_frameEndTimes.size()] : 0;
+            m_frameEndTimes[m_numFramesRecorded % m_frameEndTimes.size()] = frameEndTime;
+            ++m_numFramesRecorded;
+
+            if (m_state == State::Recording && previousFrameEndTime && m_frameTriggerFn)
+            {
+                if (m_frameTriggerFn(frameEndTime, frameEndTime - previousFrameEndTime))
+                {
+                    Trigger(frameEndTime);
+                }
+            }
+            return true;
+        }
+
+        // fails if already triggered; only ranges recorded from now on can complete the post-trigger period
+        bool Trigger(uint64_t triggerTime)
+        {
+            if (!IsInitialized())
+            {
+                NV_PERF_LOG_ERR(50, "Not initialized\n");
+                return false;
+            }
+            if (m_state != State::Recording)
+            {
+                NV_PERF_LOG_WRN(50, "Already triggered, call Rearm() first\n");
+                return false;
+            }
+            m_triggerTime = triggerTime;
+            m_windowBeginTime = triggerTime - (std::min)(triggerTime, m_preTriggerDuration);
+            m_windowEndTime = triggerTime + (std::min)(m_postTriggerDuration, ~uint64_t(0) - triggerTime);
+            m_state = State::Triggered;
+            FreezeIfWindowCovered();
+            return true;
+        }
+
+        // triggers at the latest range or frame end time recorded
+        bool Trigger()
+        {
+            if (!m_numRangesRecorded && !m_numFramesRecorded)
+            {
+                NV_PERF_LOG_ERR(50, "Nothing has been recorded yet\n");
+                return false;
+            }
+            return Trigger((std::max)(GetLatestRangeEndTime(), GetLatestFrameEndTime()));
+        }
+
+        // resumes recording after a trigger; the rings are kept, so ranges from before the previous trigger may appear in the next dump
+        void Rearm()
+        {
+            m_state = State::Recording;
+            m_triggerTime = 0;
+            m_windowBeginTime = 0;
+            m_windowEndTime = 0;
+        }
+
+        // writes the trigger window to a recording at "path", readable with CounterDataRecordingReader, and the frame delimiters to
+        // FlightRecorderFramesPath(path). Only valid when frozen. This does file I/O, so it is best not called on the render thread.
+        bool Dump(const std::string& path)
+        {
+            CounterDataRecorder recorder;
+            return Dump(recorder, path);
+        }
+
+        bool Dump(CounterDataRecorder& recorder, const std::string& path)
+        {
+            if (m_state != State::Frozen)
+            {
+                NV_PERF_LOG_ERR(50, "Not frozen, this function is skipped\n");
+                return false;
+            }
+
+            const std::vector<uint8_t>& ring = GetRing();
+            const uint32_t numRangesPerChunk = (std::min)(GetNumRangeSlots(), 64u);
+            if (!recorder.Open(path, m_counterDataPrefix, ring, numRangesPerChunk))
+            {
+                return false;
+            }
+            const uint64_t numRangesInRing = (std::min)(m_numRangesRecorded, (uint64_t)m_rangeInfos.size());
+            for (uint64_t ii = m_numRangesRecorded - numRangesInRing; ii < m_numRangesRecorded; ++ii)
+            {
+                const uint32_t slot = (uint32_t)(ii % m_rangeInfos.size());
+                const CounterDataRecordingIndexEntry& rangeInfo = m_rangeInfos[slot];
+                if (rangeInfo.endTimestamp <= m_windowBeginTime || rangeInfo.startTimestamp >= m_windowEndTime)
+                {
+                    continue;
+                }
+                if (!recorder.AppendRange(ring.data(), ring.size(), slot, rangeInfo))
+                {
+                    recorder.Close();
+                    return false;
+                }
+            }
+            if (!recorder.Close())
+            {
+                return false;
+            }
+            return DumpFrames(FlightRecorderFramesPath(path));
+        }
+
+    protected:
+        uint64_t GetLatestRangeEndTime() const
+        {
+            return m_numRangesRecorded ? m_rangeInfos[(m_numRangesRecorded - 1) % m_rangeInfos.size()].endTimestamp : 0;
+        }
+
+        uint64_t GetLatestFrameEndTime() const
+        {
+            return m_numFramesRecorded ? m_frameEndTimes[(m_numFramesRecorded - 1) % m_frameEndTimes.size()] : 0;
+        }
+
+        void FreezeIfWindowCovered()
+        {
+            if (m_state == State::Triggered && m_numRangesRecorded && GetLatestRangeEndTime() >= m_windowEndTime)
+            {
+                m_state = State::Frozen;
+            }
+        }
+
+        bool DumpFrames(const std::string& path) const
+        {
+            const uint64_t numFramesInRing = (std::min)(m_numFramesRecorded, (uint64_t)m_frameEndTimes.size());
+            const uint64_t firstFrame = m_numFramesRecorded - numFramesInRing;
+            auto isInWindow = [&](uint64_t frameEndTime) {
+                return frameEndTime > m_windowBeginTime && frameEndTime <= m_windowEndTime;
+            };
+
+            FlightRecorderFramesHeader header = {};
+            memcpy(header.magic, FlightRecorderFramesHeader::Magic(), sizeof(header.magic)); // including the null terminator
+            header.version = FlightRecorderFramesHeader::CurrentVersion;
+            header.triggerTime = m_triggerTime;
+            header.windowBeginTime = m_windowBeginTime;
+            header.windowEndTime = m_windowEndTime;
+            for (uint64_t ii = firstFrame; ii < m_numFramesRecorded; ++ii)
+            {
+                if (isInWindow(m_frameEndTimes[ii % m_frameEndTimes.size()]))
+                {
+                    ++header.numFrames;
+                }
+            }
+
+            FILE* pFile = OpenFile(path.c_str(), "wb");
+            if (!pFile)
+            {
+                NV_PERF_LOG_ERR(20, "OpenFile failed for file: %s\n", path.c_str());
+                return false;
+            }
+            bool success = (fwrite(&header, sizeof(header), 1, pFile) == 1);
+            for (uint64_t ii = firstFrame; success && ii < m_numFramesRecorded; ++ii)
+            {
+                const uint64_t frameEndTime = m_frameEndTimes[ii % m_frameEndTimes.size()];
+                if (isInWindow(frameEndTime))
+                {
+                    success = (fwrite(&frameEndTime, sizeof(frameEndTime), 1, pFile) == 1);
+                }
+            }
+            success = !fclose(pFile) && success;
+            if (!success)
+            {
+                NV_PERF_LOG_ERR(20, "Failed to write file: %s\n", path.c_str());
+                return false;
+            }
+            return true;
+        }
+
+        // sets up GetRing() with "numRangeSlots" empty ranges
+        virtual bool InitializeRing(const std::vector<uint8_t>& counterDataPrefix, const std::vector<uint8_t>& counterDataSource, uint32_t numRangeSlots)
+        {
+            if (!m_combiner.Initialize(counterDataPrefix.data(), counterDataPrefix.size(), numRangeSlots, counterDataSource.data()))
+            {
+                return false;
+            }
+            for (uint32_t ii = 0; ii < numRangeSlots; ++ii)
+            {
+                size_t rangeIndex = 0;
+                if (!m_combiner.CreateRange(rangeIndex))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        virtual void ResetRing()
+        {
+            m_combiner.Reset();
+        }
+
+        virtual const std::vector<uint8_t>& GetRing() const
+        {
+            return m_combiner.GetCounterData();
+        }
+
+        virtual bool CopyRangeIntoSlot(uint32_t slot, const uint8_t* pCounterDataImage, size_t counterDataImageSize, uint32_t rangeIndex)
+        {
+            return m_combiner.CopyIntoRange(slot, pCounterDataImage, rangeIndex);
+        }
+
+        virtual bool GetRangeInfo(const uint8_t* pCounterDataImage, size_t counterDataImageSize, uint32_t rangeIndex, CounterDataRecordingIndexEntry& rangeInfo)
+        {
+            SampleTimestamp timestamp{};
+            if (!CounterDataGetSampleTime(pCounterDataImage, rangeIndex, timestamp))
+            {
+                return false;
+            }
+            uint32_t triggerCount = 0;
+            if (!CounterDataGetTriggerCount(pCounterDataImage, counterDataImageSize, rangeIndex, triggerCount))
+            {
+                return false;
+            }
+            rangeInfo.startTimestamp = timestamp.start;
+            rangeInfo.endTimestamp = timestamp.end;
+            rangeInfo.triggerCount = triggerCount;
+            return true;
+        }
+    };
+
+}}}
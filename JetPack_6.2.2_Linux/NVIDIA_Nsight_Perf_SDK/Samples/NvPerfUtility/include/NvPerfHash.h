@@ -0,0 +1,48 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace nv { namespace perf {
+
+    // FNV-1a, which the on-disk caches use to key and checksum their contents; the values are persisted, so this must not change.
+    // Chain calls by passing the previous result as "hash".
+    inline uint64_t Fnv1a64(const void* pData, size_t size, uint64_t hash = 0xcbf29ce484222325ull)
+    {
+        const uint8_t* pBytes = static_cast<const uint8_t*>(pData);
+        for (size_t index = 0; index < size; ++index)
+        {
+            hash = (hash ^ pBytes[index]) * 0x100000001b3ull;
+        }
+        return hash;
+    }
+
+    // The 32-bit variant, for in-memory hash tables whose slots store the hash.
+    inline uint32_t Fnv1a32(const void* pData, size_t size, uint32_t hash = 2166136261u)
+    {
+        const uint8_t* pBytes = static_cast<const uint8_t*>(pData);
+        for (size_t index = 0; index < size; ++index)
+        {
+            hash = (hash ^ pBytes[index]) * 16777619u;
+        }
+        return hash;
+    }
+
+}}
@@ -17,18 +17,25 @@
 #pragma once
 
 #include <cmath>
+#include <cstring>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <iomanip>
 #include <fstream>
 #include <functional>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <ostream>
-#include <regex>
 #include <string>
 #include <sstream>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include <ryml_all.hpp>
@@ -36,15 +43,27 @@
 #include "NvPerfInit.h"
 #include "NvPerfCounterConfiguration.h"
 #include "NvPerfCounterData.h"
+#include "NvPerfCpuMarkerTrace.h"
+#include "NvPerfHash.h"
 #include "NvPerfHudConfigurationsHAL.h"
+#include "NvPerfJsonWriter.h"
+#include "NvPerfMappedFile.h"
+#include "NvPerfMetricNameIndex.h"
 #include "NvPerfMetricsEvaluator.h"
 #include "NvPerfPeriodicSamplerCommon.h"
+#include "NvPerfQuantileSketch.h"
+#include "NvPerfSpscQueue.h"
+#include "NvPerfTimeSeriesFile.h"
 
 namespace nv { namespace perf { namespace hud {
 
     class Widget;
 
     std::unique_ptr<Widget> WidgetFromYaml(const ryml::NodeRef& node, bool* pValid);
+    class HudBlobReader;
+    class HudBlobWriter;
+    std::unique_ptr<Widget> WidgetFromBlob(HudBlobReader& reader, bool* pValid);
+    void WidgetToBlob(const Widget& widget, HudBlobWriter& writer);
 
     // RYML helpers ///////////////////////////////////////////////////////////
 
@@ -98,6 +117,154 @@ namespace nv { namespace perf { namespace hud {
         return value;
     }
 
+    // Binary helpers /////////////////////////////////////////////////////////
+
+    // Serialization for HudPresetCache. Values are stored back-to-back in host byte order, without tags or padding; a cache is only ever read
+    // by the library build that wrote it.
+    class HudBlobWriter
+    {
+    private:
+        std::vector<uint8_t> m_data;
+
+    public:
+        std::vector<uint8_t>& GetData()
+        {
+            return m_data;
+        }
+
+        void WriteBytes(const void* pData, size_t size)
+        {
+            const uint8_t* pBytes = static_cast<const uint8_t*>(pData);
+            m_data.insert(m_data.end(), pBytes, pBytes + size);
+        }
+
+        void WriteUInt32(uint32_t value)
+        {
+            WriteBytes(&value, sizeof(value));
+        }
+
+        void WriteUInt64(uint64_t value)
+        {
+            WriteBytes(&value, sizeof(value));
+        }
+
+        void WriteDouble(double value)
+        {
+            WriteBytes(&value, sizeof(value));
+        }
+
+        void WriteString(const std::string& str)
+        {
+            WriteUInt32((uint32_t)str.size());
+            WriteBytes(str.data(), str.size());
+        }
+    };
+
+    // Reads back what HudBlobWriter wrote. A read past the end returns zeros and leaves the reader failed, so that callers can check once after
+    // reading a whole object.
+    class HudBlobReader
+    {
+    private:
+        const uint8_t* m_pData;
+        size_t m_size;
+        size_t m_offset;
+        bool m_failed;
+
+    public:
+        HudBlobReader()
+            : m_pData(nullptr)
+            , m_size(0)
+            , m_offset(0)
+            , m_failed(false)
+        {
+        }
+        HudBlobReader(const uint8_t* pData, size_t size)
+            : m_pData(pData)
+            , m_size(size)
+            , m_offset(0)
+            , m_failed(false)
+        {
+        }
+
+        bool Failed() const
+        {
+            return m_failed;
+        }
+
+        size_t GetNumRemainingBytes() const
+        {
+            return m_size - m_offset;
+        }
+
+        // returns a pointer into the blob, or nullptr if fewer than "size" bytes are left
+        const uint8_t* Skip(size_t size)
+        {
+            if (m_failed || size > m_size - m_offset)
+            {
+                m_failed = true;
+                return nullptr;
+            }
+            const uint8_t* pData = m_pData + m_offset;
+            m_offset += size;
+            return pData;
+        }
+
+        bool ReadBytes(void* pData, size_t size)
+        {
+            const uint8_t* pSource = Skip(size);
+            if (!pSource)
+            {
+                memset(pData, 0, size);
+                return false;
+            }
+            memcpy(pData, pSource, size);
+            return true;
+        }
+
+        uint32_t ReadUInt32()
+        {
+            uint32_t value = 0;
+            ReadBytes(&value, sizeof(value));
+            return value;
+        }
+
+        uint64_t ReadUInt64()
+        {
+            uint64_t value = 0;
+            ReadBytes(&value, sizeof(value));
+            return value;
+        }
+
+        double ReadDouble()
+        {
+            double value = 0.0;
+            ReadBytes(&value, sizeof(value));
+            return value;
+        }
+
+        std::string ReadString()
+        {
+            const uint32_t length = ReadUInt32();
+            const uint8_t* pData = Skip(length);
+            if (!pData)
+            {
+                return std::string();
+            }
+            return std::string(reinterpret_cast<const char*>(pData), length);
+        }
+
+        // an upper bound for element counts, given the smallest size an element can be serialized to
+        bool IsCountPlausible(uint32_t count, size_t minElementSize)
+        {
+            if (m_failed || count > GetNumRemainingBytes() / minElementSize)
+            {
+                m_failed = true;
+                return false;
+            }
+            return true;
+        }
+    };
+
     // Color //////////////////////////////////////////////////////////////////
 
     class Color
@@ -197,6 +364,16 @@ namespace nv { namespace perf { namespace hud {
             return Color::Rgba(rgbaColor);
         }
 
+        static Color FromBlob(HudBlobReader& reader)
+        {
+            return Color::Rgba(reader.ReadUInt32());
+        }
+
+        void ToBlob(HudBlobWriter& writer) const
+        {
+            writer.WriteUInt32(m_rgba);
+        }
+
         static Color White     () { return Color::Rgba(0xffffffffU); }
         static Color Black     () { return Color::Rgba(0x000000ffU); }
         static Color Red       () { return Color::Rgba(0xff0000ffU); }
@@ -298,6 +475,19 @@ namespace nv { namespace perf { namespace hud {
             }
             return StyledText(text, color);
         }
+
+        static StyledText FromBlob(HudBlobReader& reader)
+        {
+            std::string text = reader.ReadString();
+            const Color color = Color::FromBlob(reader);
+            return StyledText(text, color);
+        }
+
+        void ToBlob(HudBlobWriter& writer) const
+        {
+            writer.WriteString(text);
+            color.ToBlob(writer);
+        }
     };
 
     inline std::ostream& operator<<(std::ostream& os, const StyledText& text)
@@ -419,6 +609,15 @@ namespace nv { namespace perf { namespace hud {
             }
         }
 
+        // Copies the values [index, index + count) in the order of Get(), as at most two contiguous spans.
+        void CopyTo(SizeType index, SizeType count, TValue* pDest) const
+        {
+            const SizeType firstSlot = (Size() == m_maxSize) ? (m_writeIndex + index) % m_maxSize : index;
+            const SizeType firstCount = (std::min)(count, Size() - firstSlot);
+            std::copy(m_data.begin() + firstSlot, m_data.begin() + firstSlot + firstCount, pDest);
+            std::copy(m_data.begin(), m_data.begin() + (count - firstCount), pDest + firstCount);
+        }
+
         void Push(ConstReference value)
         {
             if (Size() < m_maxSize)
@@ -465,197 +664,959 @@ namespace nv { namespace perf { namespace hud {
         }
     };
 
-    // MetricSignal ///////////////////////////////////////////////////////////
+    // MetricHistory //////////////////////////////////////////////////////////
 
-    class MetricSignal
+    // The extremes of a range of rows, and the indices of the rows where they occur, in the order of MetricHistory::Get().
+    struct MinMax
+    {
+        double minValue;
+        double maxValue;
+        size_t minIndex;
+        size_t maxIndex;
+    };
+
+    // Columnar sample history: one ring per column, where all columns share a single write index and advance together one row at a time.
+    // Every column starts on its own cache line and is contiguous, so a column can be shared by all widgets referencing the same metric.
+    // Each column also maintains a min/max pyramid, updated incrementally per row, so that GetMinMax() of any range costs O(log(rows)).
+    class MetricHistory
     {
     public:
-        static std::string HideUnit()
-        {
-            return "-";
-        }
+        using SizeType = size_t;
 
-        StyledText label;             // tooltip and TimePlot legend
-        std::string description;      // for tooltip
-        std::string metric;           // the base name, which can be queried for metadata through LOP, and automatically converted to value and %
-        Color color;                  
-        double maxValue;              // default from LOP (if needed for ScalarText::ShowValue::ValueWithMax), but can be overridden
-        double multiplier;
-        std::string unit;             // default from LOP, but can be overwritten
-                                  
-        size_t metricIndex;           // set by HudDataModel::Initialize()
-        size_t metricIndexMaxValue;   // set by HudDataModel::Initialize()
-        size_t maxNumSamples;         // set by HudDataModel::Initialize()
-        RingBuffer<double> valBuffer; // set by HudDataModel::Initialize()
+    private:
+        enum { CacheLineSize = 64, ValuesPerCacheLine = CacheLineSize / sizeof(double) };
+        enum { MinMaxBranching = 16 }; // rows per block of the finest level, and blocks per block of the next level
 
-        MetricSignal() : label(), description(), metric(), color(), maxValue(std::numeric_limits<double>::quiet_NaN()), multiplier(1.0), unit(), metricIndex(0), metricIndexMaxValue((size_t)~0), maxNumSamples(0), valBuffer() {}
-        MetricSignal(
-            StyledText label_
-            , std::string description_
-            , std::string metric_
-            , const Color& color_
-            , double maxValue_
-            , double multiplier_
-            , std::string unit_)
-            : label(label_)
-            , description(description_)
-            , metric(metric_)
-            , color(color_)
-            , maxValue(maxValue_)
-            , multiplier(multiplier_)
-            , unit(unit_)
-            , metricIndex(0)
-            , metricIndexMaxValue((size_t)~0)
-            , maxNumSamples(0)
-            , valBuffer(0)
+        // rows are identified by their sequence number, i.e. the number of rows committed before them
+        struct MinMaxBlock
         {
-        }
+            double minValue;
+            double maxValue;
+            uint64_t minRow;
+            uint64_t maxRow;
+        };
 
-        static MetricSignal FromYaml(const ryml::NodeRef& node, bool* pValid)
+        // A ring of blocks per column. There are enough blocks to cover all rows in the history, plus the block being filled and one that is
+        // being evicted, so every block that is complete and entirely within the history is intact. Block sizes and counts are powers of 2.
+        struct MinMaxLevel
         {
-            if (pValid)
-            {
-                *pValid = false;
-            }
+            uint64_t rowsPerBlock;
+            uint32_t rowsPerBlockShift;
+            SizeType numBlocks;
+            std::vector<MinMaxBlock> blocks; // numBlocks per column
 
-            if (!node.valid())
+            SizeType BlockIndex(uint64_t row) const
             {
-                NV_PERF_LOG_ERR(20, "Invalid root node\n");
-                return MetricSignal();
+                return (SizeType)(row >> rowsPerBlockShift) & (numBlocks - 1);
             }
+        };
 
-            StyledText label;
-            std::string description;
-            std::string metric;
-            Color color;
-            double maxValue   = std::numeric_limits<double>::quiet_NaN();
-            double multiplier = std::numeric_limits<double>::quiet_NaN();
-            std::string unit;
+        std::vector<double> m_storage; // over-allocated by one cache line so that the first column can be aligned
+        SizeType m_alignOffset;
+        SizeType m_numColumns;
+        SizeType m_columnStride;
+        SizeType m_maxSize;
+        SizeType m_size;
+        SizeType m_writeIndex;
+        uint64_t m_numCommittedRows;
+        std::vector<MinMaxLevel> m_minMaxLevels;
 
-            if (node.is_keyval() || node.is_val()) // keyval from ScalarText can be a minimal entry in a dashed list
+        static void MergeMinMax(MinMaxBlock& result, double minValue, uint64_t minRow, double maxValue, uint64_t maxRow)
+        {
+            // ties go to the earliest row, so that the result doesn't depend on the order of merging
+            if (minValue < result.minValue || (minValue == result.minValue && minRow < result.minRow))
             {
-                node >> metric;
+                result.minValue = minValue;
+                result.minRow = minRow;
             }
-            else if (node.is_seq()) // more complex entry from ScalarText needs to be redirected
+            if (maxValue > result.maxValue || (maxValue == result.maxValue && maxRow < result.maxRow))
             {
-                if (node.num_children() != 1 || !node.child(0).valid() || !node.child(0).is_map())
-                {
-                    NV_PERF_LOG_ERR(20, "Failed parsing MetricSignal from \"%s\"\n", ToString(node).c_str());
-                    return MetricSignal();
-                }
-
-                return MetricSignal::FromYaml(node.child(0), pValid);
+                result.maxValue = maxValue;
+                result.maxRow = maxRow;
             }
-            else
-            {
-                if (!node.is_map())
-                {
-                    NV_PERF_LOG_ERR(20, "Failed parsing MetricSignal from \"%s\"\n", ToString(node).c_str());
-                    return MetricSignal();
-                }
+        }
 
-                auto labelNode       = node.find_child("label");
-                auto descriptionNode = node.find_child("description");
-                auto metricNode      = node.find_child("metric");
-                auto colorNode       = node.find_child("color");
-                auto maxNode         = node.find_child("max");
-                auto multiplierNode  = node.find_child("multiplier");
-                auto unitNode        = node.find_child("unit");
+        // the slot of a row that is in the history
+        SizeType SlotOfRow(uint64_t row) const
+        {
+            return (SizeType)(row % m_maxSize);
+        }
 
-                if (labelNode.valid())
+        void UpdateMinMaxLevels()
+        {
+            const uint64_t row = m_numCommittedRows;
+            for (MinMaxLevel& level : m_minMaxLevels)
+            {
+                const SizeType blockIndex = level.BlockIndex(row);
+                const bool isFirstRowOfBlock = (row & (level.rowsPerBlock - 1)) == 0;
+                for (SizeType column = 0; column < m_numColumns; ++column)
                 {
-                    bool valid;
-                    label = StyledText::FromYaml(labelNode, StyledText(), &valid);
-                    if (!valid)
+                    const double value = ColumnData(column)[m_writeIndex];
+                    MinMaxBlock& block = level.blocks[column * level.numBlocks + blockIndex];
+                    if (isFirstRowOfBlock)
                     {
-                        NV_PERF_LOG_ERR(20, "Failed parsing label from \"%s\"\n", ToString(labelNode).c_str());
-                        return MetricSignal();
+                        block = MinMaxBlock{ value, value, row, row };
                     }
-                }
-
-                if (descriptionNode.valid())
-                {
-                    if (!descriptionNode.is_keyval())
+                    else
                     {
-                        NV_PERF_LOG_ERR(20, "Failed parsing description from \"%s\"\n", ToString(descriptionNode).c_str());
-                        return MetricSignal();
+                        MergeMinMax(block, value, row, value, row);
                     }
-                    descriptionNode >> description;
-                }
-
-                if (!metricNode.valid() || !metricNode.is_keyval())
-                {
-                    NV_PERF_LOG_ERR(20, "Missing or invalid metric\n");
-                    return MetricSignal();
                 }
-                metricNode >> metric;
-                
-                color = Color::FromYaml(colorNode);
+            }
+        }
 
-                if (maxNode.valid())
-                {
-                    if (!maxNode.is_keyval() || !maxNode.val().is_number())
-                    {
-                        NV_PERF_LOG_ERR(20, "Failed parsing max from \"%s\"\n", ToString(maxNode).c_str());
-                        return MetricSignal();
-                    }
-                    maxNode >> maxValue;
-                    if (maxValue <= 0)
-                    {
-                        NV_PERF_LOG_WRN(50, "max %lf needs to be greater than 0. Using default.\n", maxValue);
-                        maxValue = std::numeric_limits<double>::quiet_NaN();
-                    }
-                }
+    public:
+        MetricHistory() : m_storage(), m_alignOffset(0), m_numColumns(0), m_columnStride(0), m_maxSize(0), m_size(0), m_writeIndex(0), m_numCommittedRows(0), m_minMaxLevels() {}
 
-                if (multiplierNode.valid())
+        void Initialize(SizeType numColumns, SizeType maxSize)
+        {
+            m_numColumns = numColumns;
+            m_maxSize = maxSize;
+            m_columnStride = (maxSize + ValuesPerCacheLine - 1) / ValuesPerCacheLine * ValuesPerCacheLine;
+            m_size = 0;
+            m_writeIndex = 0;
+            m_numCommittedRows = 0;
+            m_storage.assign(m_numColumns * m_columnStride + ValuesPerCacheLine, 0.0);
+            const uintptr_t address = reinterpret_cast<uintptr_t>(m_storage.data());
+            m_alignOffset = ((CacheLineSize - address % CacheLineSize) % CacheLineSize) / sizeof(double);
+
+            // stop once the coarsest level spans the history in a few dozen blocks
+            m_minMaxLevels.clear();
+            uint32_t rowsPerBlockShift = 0;
+            for (uint64_t rowsPerBlock = MinMaxBranching; rowsPerBlock * 2 <= maxSize; rowsPerBlock *= MinMaxBranching)
+            {
+                while ((uint64_t(1) << rowsPerBlockShift) < rowsPerBlock)
                 {
-                    if (!multiplierNode.is_keyval() || !multiplierNode.val().is_number())
-                    {
-                        NV_PERF_LOG_ERR(20, "Failed parsing multiplier from \"%s\"\n", ToString(multiplierNode).c_str());
-                        return MetricSignal();
-                    }
-                    multiplierNode >> multiplier;
-                    if (multiplier <= 0)
-                    {
-                        NV_PERF_LOG_WRN(50, "Multiplier %lf needs to be greater than 0. Using default.\n", multiplier);
-                        multiplier = std::numeric_limits<double>::quiet_NaN();
-                    }
+                    ++rowsPerBlockShift;
                 }
-
-                if (unitNode.valid())
+                MinMaxLevel level;
+                level.rowsPerBlock = rowsPerBlock;
+                level.rowsPerBlockShift = rowsPerBlockShift;
+                level.numBlocks = 1;
+                while (level.numBlocks < (SizeType)(maxSize / rowsPerBlock) + 2)
                 {
-                    if (!unitNode.is_keyval())
-                    {
-                        NV_PERF_LOG_ERR(20, "Failed parsing unit from \"%s\"\n", ToString(unitNode).c_str());
-                        return MetricSignal();
-                    }
-                    unitNode >> unit;
-
-                    if (unit.empty()) // if unit is set, but empty it should be hidden
-                    {
-                        unit = MetricSignal::HideUnit();
-                    }
+                    level.numBlocks *= 2;
                 }
+                level.blocks.resize(numColumns * level.numBlocks);
+                m_minMaxLevels.push_back(std::move(level));
             }
-
-            if (!std::regex_match(metric, std::regex("^[A-Za-z][A-Za-z0-9._]+$")))
-            {
-                NV_PERF_LOG_ERR(20, "Invalid metric \"%s\"\n", metric.c_str());
-                return MetricSignal();
-            }
-
-            if (pValid)
-            {
-                *pValid = true;
-            }
-            return MetricSignal(label, description, metric, color, maxValue, multiplier, unit);
         }
 
-        // resets valBuffer
+        SizeType NumColumns() const
+        {
+            return m_numColumns;
+        }
+
+        SizeType MaxSize() const
+        {
+            return m_maxSize;
+        }
+
+        SizeType Size() const
+        {
+            return m_size;
+        }
+
+        // the slot of the row being written, as an offset into ColumnData()
+        SizeType WriteIndex() const
+        {
+            return m_writeIndex;
+        }
+
+        const double* ColumnData(SizeType column) const
+        {
+            return m_storage.data() + m_alignOffset + column * m_columnStride;
+        }
+
+        double* ColumnData(SizeType column)
+        {
+            return m_storage.data() + m_alignOffset + column * m_columnStride;
+        }
+
+        // publishes the row at WriteIndex() once all of its columns have been written
+        void CommitRow()
+        {
+            if (!m_maxSize)
+            {
+                return;
+            }
+            UpdateMinMaxLevels();
+            ++m_numCommittedRows;
+            if (m_size < m_maxSize)
+            {
+                ++m_size;
+            }
+            if (m_writeIndex < m_maxSize - 1)
+            {
+                ++m_writeIndex;
+            }
+            else
+            {
+                m_writeIndex = 0;
+            }
+        }
+
+        // same ordering as RingBuffer::Get(), index 0 is the oldest row
+        double Get(SizeType column, SizeType index) const
+        {
+    #if !defined(NDEBUG)
+            if (column >= m_numColumns || index >= m_maxSize)
+            {
+                NV_PERF_LOG_ERR(20, "Out of bounds access\n");
+                std::abort();
+            }
+    #endif
+            const double* pColumn = ColumnData(column);
+            if (m_size == m_maxSize)
+            {
+                const SizeType slot = m_writeIndex + index;
+                return pColumn[(slot < m_maxSize) ? slot : slot - m_maxSize];
+            }
+            return pColumn[index];
+        }
+
+        // the latest row
+        double Front(SizeType column) const
+        {
+    #if !defined(NDEBUG)
+            if (m_size == 0)
+            {
+                NV_PERF_LOG_ERR(20, "Size() == 0\n");
+                std::abort();
+            }
+    #endif
+            const double* pColumn = ColumnData(column);
+            return pColumn[(m_writeIndex > 0) ? m_writeIndex - 1 : m_maxSize - 1];
+        }
+
+        // the oldest row
+        double Back(SizeType column) const
+        {
+            return Get(column, 0);
+        }
+
+        // Copies the rows [index, index + count) of a column in the order of Get(), as at most two contiguous spans.
+        void CopyColumn(SizeType column, SizeType index, SizeType count, double* pDest) const
+        {
+            const double* pColumn = ColumnData(column);
+            const SizeType firstSlot = (m_size == m_maxSize) ? SlotOfRow(m_writeIndex + (uint64_t)index) : index;
+            const SizeType firstCount = (std::min)(count, m_maxSize - firstSlot);
+            std::memcpy(pDest, pColumn + firstSlot, firstCount * sizeof(double));
+            std::memcpy(pDest + firstCount, pColumn, (count - firstCount) * sizeof(double));
+        }
+
+        // The extremes of rows [beginIndex, endIndex) of a column, which must not be empty. Whole blocks are taken from the coarsest level
+        // that fits, so only the ragged edges are read row by row.
+        MinMax GetMinMax(SizeType column, SizeType beginIndex, SizeType endIndex) const
+        {
+            const uint64_t firstRow = m_numCommittedRows - m_size;
+            uint64_t beginRow = firstRow + beginIndex;
+            uint64_t endRow = firstRow + endIndex;
+            MinMaxBlock result{ std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(), endRow, endRow };
+
+            const double* pColumn = ColumnData(column);
+            auto mergeRows = [&](size_t levelIndex, uint64_t firstMergedRow, uint64_t endMergedRow) {
+                if (levelIndex == 0)
+                {
+                    if (firstMergedRow == endMergedRow)
+                    {
+                        return;
+                    }
+                    // rows are scanned in order, so strict comparisons keep the earliest of equal values
+                    SizeType slot = SlotOfRow(firstMergedRow);
+                    MinMaxBlock rows{ pColumn[slot], pColumn[slot], firstMergedRow, firstMergedRow };
+                    for (uint64_t row = firstMergedRow + 1; row < endMergedRow; ++row)
+                    {
+                        if (++slot == m_maxSize)
+                        {
+                            slot = 0;
+                        }
+                        const double value = pColumn[slot];
+                        if (value < rows.minValue)
+                        {
+                            rows.minValue = value;
+                            rows.minRow = row;
+                        }
+                        if (value > rows.maxValue)
+                        {
+                            rows.maxValue = value;
+                            rows.maxRow = row;
+                        }
+                    }
+                    MergeMinMax(result, rows.minValue, rows.minRow, rows.maxValue, rows.maxRow);
+                }
+                else
+                {
+                    const MinMaxLevel& level = m_minMaxLevels[levelIndex - 1];
+                    const MinMaxBlock* pBlocks = level.blocks.data() + column * level.numBlocks;
+                    for (uint64_t row = firstMergedRow; row < endMergedRow; row += level.rowsPerBlock)
+                    {
+                        const MinMaxBlock& block = pBlocks[level.BlockIndex(row)];
+                        MergeMinMax(result, block.minValue, block.minRow, block.maxValue, block.maxRow);
+                    }
+                }
+            };
+
+            // Each level merges the ragged edges up to the next level's block boundaries; on entry to a level, beginRow and endRow are
+            // multiples of its block size.
+            for (size_t levelIndex = 0; beginRow < endRow; ++levelIndex)
+            {
+                if (levelIndex == m_minMaxLevels.size())
+                {
+                    mergeRows(levelIndex, beginRow, endRow);
+                    break;
+                }
+                const uint64_t parentBlockMask = m_minMaxLevels[levelIndex].rowsPerBlock - 1;
+                const uint64_t alignedBeginRow = (std::min)(endRow, (beginRow + parentBlockMask) & ~parentBlockMask);
+                const uint64_t alignedEndRow = (std::max)(alignedBeginRow, endRow & ~parentBlockMask);
+                mergeRows(levelIndex, beginRow, alignedBeginRow);
+                mergeRows(levelIndex, alignedEndRow, endRow);
+                beginRow = alignedBeginRow;
+                endRow = alignedEndRow;
+            }
+
+            return MinMax{ result.minValue, result.maxValue, (size_t)(result.minRow - firstRow), (size_t)(result.maxRow - firstRow) };
+        }
+    };
+
+    // A read-only view of one MetricHistory column, scaled by a per-signal multiplier. Mirrors the read interface of RingBuffer.
+    class MetricHistoryView
+    {
+    public:
+        using SizeType = MetricHistory::SizeType;
+
+    private:
+        const MetricHistory* m_pHistory;
+        SizeType m_column;
+        double m_multiplier;
+
+    public:
+        MetricHistoryView() : m_pHistory(nullptr), m_column(0), m_multiplier(1.0) {}
+        MetricHistoryView(const MetricHistory* pHistory, SizeType column, double multiplier)
+            : m_pHistory(pHistory)
+            , m_column(column)
+            , m_multiplier(multiplier)
+        {
+        }
+
+        SizeType Size() const
+        {
+            return m_pHistory ? m_pHistory->Size() : 0;
+        }
+
+        SizeType MaxSize() const
+        {
+            return m_pHistory ? m_pHistory->MaxSize() : 0;
+        }
+
+        SizeType Column() const
+        {
+            return m_column;
+        }
+
+        double Get(SizeType index) const
+        {
+            return m_pHistory->Get(m_column, index) * m_multiplier;
+        }
+
+        double Front() const
+        {
+            return m_pHistory->Front(m_column) * m_multiplier;
+        }
+
+        double Back() const
+        {
+            return m_pHistory->Back(m_column) * m_multiplier;
+        }
+
+        void CopyTo(SizeType index, SizeType count, double* pDest) const
+        {
+            m_pHistory->CopyColumn(m_column, index, count, pDest);
+            if (m_multiplier != 1.0)
+            {
+                for (SizeType ii = 0; ii < count; ++ii)
+                {
+                    pDest[ii] *= m_multiplier;
+                }
+            }
+        }
+
+        MinMax GetMinMax(SizeType beginIndex, SizeType endIndex) const
+        {
+            MinMax minMax = m_pHistory->GetMinMax(m_column, beginIndex, endIndex);
+            minMax.minValue *= m_multiplier;
+            minMax.maxValue *= m_multiplier;
+            if (m_multiplier < 0.0)
+            {
+                std::swap(minMax.minValue, minMax.maxValue);
+                std::swap(minMax.minIndex, minMax.maxIndex);
+            }
+            return minMax;
+        }
+
+        void Print(std::ostream& os, bool printValues = false, const std::string indent = std::string()) const
+        {
+            auto precision = os.precision();
+            os.precision(2);
+
+            os << indent << "MetricHistoryView(" << MaxSize() << ", " << m_column;
+            if (printValues)
+            {
+                os << "{";
+                for (SizeType index = 0; index < Size(); ++index)
+                {
+                    os << std::fixed << Get(index);
+                    if (index < Size() - 1)
+                    {
+                        os << ", ";
+                    }
+                }
+                os << "}";
+            }
+
+            os <<  ")" << std::endl;
+            os.precision(precision);
+        }
+    };
+
+    // Signal statistics ////////////////////////////////////////////////////////
+
+    struct MetricStatisticsOptions
+    {
+        double relativeAccuracy = 0.02;                                 // of the quantiles
+        std::vector<double> decayTimeConstants = { 1.0, 10.0, 60.0 };   // in seconds, one exponentially decayed average each
+    };
+
+    // Session-long statistics of the leading columns of a MetricHistory, in constant memory: a QuantileSketch per column, and exponentially
+    // decayed averages, which weigh a value that is t seconds old by exp(-t / timeConstant). Unlike the history, these are not limited to
+    // the plot's time window.
+    class MetricStatistics
+    {
+    public:
+        using SizeType = MetricHistory::SizeType;
+
+    private:
+        std::vector<QuantileSketch> m_sketches;
+        std::vector<double> m_decayTimeConstants;
+        std::vector<double> m_decayedAverages;  // [column * numDecayTimeConstants + decayIndex]
+        std::vector<double> m_decayFactors;     // scratch, per decay time constant
+        double m_lastTimestamp;
+        uint64_t m_numRows;
+
+    public:
+        MetricStatistics() : m_sketches(), m_decayTimeConstants(), m_decayedAverages(), m_decayFactors(), m_lastTimestamp(0.0), m_numRows(0) {}
+
+        void Initialize(SizeType numColumns, const MetricStatisticsOptions& options)
+        {
+            m_sketches.assign(numColumns, QuantileSketch(options.relativeAccuracy));
+            m_decayTimeConstants.clear();
+            for (double timeConstant : options.decayTimeConstants)
+            {
+                if (timeConstant > 0.0)
+                {
+                    m_decayTimeConstants.push_back(timeConstant);
+                }
+            }
+            m_decayedAverages.assign(numColumns * m_decayTimeConstants.size(), std::numeric_limits<double>::quiet_NaN());
+            m_decayFactors.resize(m_decayTimeConstants.size());
+            m_lastTimestamp = 0.0;
+            m_numRows = 0;
+        }
+
+        void Clear()
+        {
+            for (QuantileSketch& sketch : m_sketches)
+            {
+                sketch.Clear();
+            }
+            std::fill(m_decayedAverages.begin(), m_decayedAverages.end(), std::numeric_limits<double>::quiet_NaN());
+            m_lastTimestamp = 0.0;
+            m_numRows = 0;
+        }
+
+        // Adds the row being written to "history", i.e. must be called before history.CommitRow(). "timestamp" is in seconds.
+        void AddRow(double timestamp, const MetricHistory& history)
+        {
+            const SizeType numDecayTimeConstants = m_decayTimeConstants.size();
+            const double elapsedTime = m_numRows ? (std::max)(0.0, timestamp - m_lastTimestamp) : 0.0;
+            for (SizeType decayIndex = 0; decayIndex < numDecayTimeConstants; ++decayIndex)
+            {
+                // the weight of the new value, for irregularly spaced samples; the first value initializes the average
+                m_decayFactors[decayIndex] = m_numRows ? 1.0 - std::exp(-elapsedTime / m_decayTimeConstants[decayIndex]) : 1.0;
+            }
+
+            const SizeType slot = history.WriteIndex();
+            for (SizeType column = 0; column < m_sketches.size(); ++column)
+            {
+                const double value = history.ColumnData(column)[slot];
+                m_sketches[column].Add(value);
+                double* pDecayedAverages = m_decayedAverages.data() + column * numDecayTimeConstants;
+                for (SizeType decayIndex = 0; decayIndex < numDecayTimeConstants; ++decayIndex)
+                {
+                    double& decayedAverage = pDecayedAverages[decayIndex];
+                    decayedAverage = std::isnan(decayedAverage) ? value : decayedAverage + m_decayFactors[decayIndex] * (value - decayedAverage);
+                }
+            }
+            m_lastTimestamp = timestamp;
+            ++m_numRows;
+        }
+
+        SizeType NumColumns() const
+        {
+            return m_sketches.size();
+        }
+
+        uint64_t NumRows() const
+        {
+            return m_numRows;
+        }
+
+        const QuantileSketch& Sketch(SizeType column) const
+        {
+            return m_sketches[column];
+        }
+
+        const std::vector<double>& DecayTimeConstants() const
+        {
+            return m_decayTimeConstants;
+        }
+
+        double DecayedAverage(SizeType column, SizeType decayIndex) const
+        {
+            return m_decayedAverages[column * m_decayTimeConstants.size() + decayIndex];
+        }
+    };
+
+    // Reads one column of MetricStatistics with the signal's multiplier applied, like MetricHistoryView. Empty unless statistics are enabled.
+    class MetricStatisticsView
+    {
+    public:
+        using SizeType = MetricStatistics::SizeType;
+
+    private:
+        const MetricStatistics* m_pStatistics;
+        SizeType m_column;
+        double m_multiplier;
+
+    public:
+        MetricStatisticsView() : m_pStatistics(nullptr), m_column(0), m_multiplier(1.0) {}
+        MetricStatisticsView(const MetricStatistics* pStatistics, SizeType column, double multiplier)
+            : m_pStatistics(pStatistics)
+            , m_column(column)
+            , m_multiplier(multiplier)
+        {
+        }
+
+        bool IsEnabled() const
+        {
+            return !!m_pStatistics;
+        }
+
+        uint64_t Count() const
+        {
+            return m_pStatistics ? m_pStatistics->Sketch(m_column).GetCount() : 0;
+        }
+
+        // NaN while there are no values, as are all of the following.
+        double Quantile(double quantile) const
+        {
+            return m_pStatistics ? m_pStatistics->Sketch(m_column).GetQuantile(quantile) * m_multiplier : std::numeric_limits<double>::quiet_NaN();
+        }
+
+        double Mean() const
+        {
+            return m_pStatistics ? m_pStatistics->Sketch(m_column).GetMean() * m_multiplier : std::numeric_limits<double>::quiet_NaN();
+        }
+
+        double Min() const
+        {
+            return m_pStatistics ? m_pStatistics->Sketch(m_column).GetMin() * m_multiplier : std::numeric_limits<double>::quiet_NaN();
+        }
+
+        double Max() const
+        {
+            return m_pStatistics ? m_pStatistics->Sketch(m_column).GetMax() * m_multiplier : std::numeric_limits<double>::quiet_NaN();
+        }
+
+        SizeType NumDecayedAverages() const
+        {
+            return m_pStatistics ? m_pStatistics->DecayTimeConstants().size() : 0;
+        }
+
+        double DecayTimeConstant(SizeType decayIndex) const
+        {
+            return m_pStatistics->DecayTimeConstants()[decayIndex];
+        }
+
+        double DecayedAverage(SizeType decayIndex) const
+        {
+            return m_pStatistics->DecayedAverage(m_column, decayIndex) * m_multiplier;
+        }
+    };
+
+    // TimePlot decimation /////////////////////////////////////////////////////
+
+    // Returns the index of the oldest timestamp that falls within "timeWidth" of the latest one. Timestamps are pushed in increasing order,
+    // so this is a binary search.
+    inline size_t FindTimePlotWindowBegin(const RingBuffer<double>& timestampBuffer, double timeWidth)
+    {
+        if (timestampBuffer.Size() == 0)
+        {
+            return 0;
+        }
+        const double thresholdTimestamp = timestampBuffer.Front() - timeWidth;
+        size_t beginIndex = 0;
+        size_t endIndex = timestampBuffer.Size();
+        while (beginIndex < endIndex)
+        {
+            const size_t midIndex = beginIndex + (endIndex - beginIndex) / 2;
+            if (timestampBuffer.Get(midIndex) < thresholdTimestamp)
+            {
+                beginIndex = midIndex + 1;
+            }
+            else
+            {
+                endIndex = midIndex;
+            }
+        }
+        return beginIndex;
+    }
+
+    // The rows [beginIndex, endIndex) split into "numBuckets" consecutive, near-equal ranges.
+    inline void GetDecimationBucket(size_t beginIndex, size_t endIndex, size_t numBuckets, size_t bucketIndex, size_t& bucketBegin, size_t& bucketEnd)
+    {
+        const size_t numRows = endIndex - beginIndex;
+        bucketBegin = beginIndex + (size_t)((uint64_t)numRows * bucketIndex / numBuckets);
+        bucketEnd = beginIndex + (size_t)((uint64_t)numRows * (bucketIndex + 1) / numBuckets);
+    }
+
+    // Reduces the rows [beginIndex, endIndex) of a signal to at most "maxPoints" points, ready to be drawn as a line: ranges of rows are
+    // replaced by their minimum and maximum, in the order they occur, which preserves every peak no matter how many rows share a pixel.
+    // If the rows fit as they are, they are copied unchanged and false is returned. Otherwise "pRowIndices", if given, receives the row of
+    // each point, e.g. to sample the other bound of a stacked plot at the same rows. The output vectors are reused, so steady-state calls
+    // don't allocate.
+    inline bool DecimateTimePlotSignal(
+        const RingBuffer<double>& timestampBuffer,
+        const MetricHistoryView& valBuffer,
+        size_t beginIndex,
+        size_t endIndex,
+        size_t maxPoints,
+        std::vector<double>& timestamps,
+        std::vector<double>& values,
+        std::vector<size_t>* pRowIndices = nullptr)
+    {
+        endIndex = (std::min)(endIndex, (std::min)(timestampBuffer.Size(), valBuffer.Size()));
+        timestamps.clear();
+        values.clear();
+        if (pRowIndices)
+        {
+            pRowIndices->clear();
+        }
+        if (beginIndex >= endIndex)
+        {
+            return false;
+        }
+
+        const size_t numRows = endIndex - beginIndex;
+        if (numRows <= maxPoints || maxPoints < 2)
+        {
+            timestamps.resize(numRows);
+            values.resize(numRows);
+            timestampBuffer.CopyTo(beginIndex, numRows, timestamps.data());
+            valBuffer.CopyTo(beginIndex, numRows, values.data());
+            return false;
+        }
+
+        // the same buckets as GetDecimationBucket(), stepped without a division per bucket
+        const size_t numBuckets = maxPoints / 2;
+        const size_t rowsPerBucket = numRows / numBuckets;
+        const size_t extraRows = numRows % numBuckets;
+        size_t bucketEnd = beginIndex;
+        size_t remainder = 0;
+        for (size_t bucketIndex = 0; bucketIndex < numBuckets; ++bucketIndex)
+        {
+            const size_t bucketBegin = bucketEnd;
+            bucketEnd += rowsPerBucket;
+            remainder += extraRows;
+            if (remainder >= numBuckets)
+            {
+                remainder -= numBuckets;
+                ++bucketEnd;
+            }
+            const MinMax minMax = valBuffer.GetMinMax(bucketBegin, bucketEnd);
+            const bool minFirst = minMax.minIndex <= minMax.maxIndex;
+            const size_t firstIndex = minFirst ? minMax.minIndex : minMax.maxIndex;
+            const size_t secondIndex = minFirst ? minMax.maxIndex : minMax.minIndex;
+            timestamps.push_back(timestampBuffer.Get(firstIndex));
+            values.push_back(minFirst ? minMax.minValue : minMax.maxValue);
+            if (pRowIndices)
+            {
+                pRowIndices->push_back(firstIndex);
+            }
+            if (secondIndex != firstIndex)
+            {
+                timestamps.push_back(timestampBuffer.Get(secondIndex));
+                values.push_back(minFirst ? minMax.maxValue : minMax.minValue);
+                if (pRowIndices)
+                {
+                    pRowIndices->push_back(secondIndex);
+                }
+            }
+        }
+        return true;
+    }
+
+    // MetricSignal ///////////////////////////////////////////////////////////
+
+    class MetricSignal
+    {
+    public:
+        static std::string HideUnit()
+        {
+            return "-";
+        }
+
+        StyledText label;             // tooltip and TimePlot legend
+        std::string description;      // for tooltip
+        std::string metric;           // the base name, which can be queried for metadata through LOP, and automatically converted to value and %
+        Color color;                  
+        double maxValue;              // default from LOP (if needed for ScalarText::ShowValue::ValueWithMax), but can be overridden
+        double multiplier;
+        std::string unit;             // default from LOP, but can be overwritten
+                                  
+        size_t metricIndex;           // set by HudDataModel::Initialize()
+        size_t metricIndexMaxValue;   // set by HudDataModel::Initialize()
+        size_t maxNumSamples;         // set by HudDataModel::Initialize()
+        MetricHistoryView valBuffer;  // set by HudDataModel::Initialize(), a view into the history shared by all signals of the same metric
+        MetricStatisticsView statistics; // set by HudDataModel::Initialize() if HudDataModel::EnableSignalStatistics() was called
+
+        MetricSignal() : label(), description(), metric(), color(), maxValue(std::numeric_limits<double>::quiet_NaN()), multiplier(1.0), unit(), metricIndex(0), metricIndexMaxValue((size_t)~0), maxNumSamples(0), valBuffer(), statistics() {}
+        MetricSignal(
+            StyledText label_
+            , std::string description_
+            , std::string metric_
+            , const Color& color_
+            , double maxValue_
+            , double multiplier_
+            , std::string unit_)
+            : label(label_)
+            , description(description_)
+            , metric(metric_)
+            , color(color_)
+            , maxValue(maxValue_)
+            , multiplier(multiplier_)
+            , unit(unit_)
+            , metricIndex(0)
+            , metricIndexMaxValue((size_t)~0)
+            , maxNumSamples(0)
+            , valBuffer()
+            , statistics()
+        {
+        }
+
+        static MetricSignal FromYaml(const ryml::NodeRef& node, bool* pValid)
+        {
+            if (pValid)
+            {
+                *pValid = false;
+            }
+
+            if (!node.valid())
+            {
+                NV_PERF_LOG_ERR(20, "Invalid root node\n");
+                return MetricSignal();
+            }
+
+            StyledText label;
+            std::string description;
+            std::string metric;
+            Color color;
+            double maxValue   = std::numeric_limits<double>::quiet_NaN();
+            double multiplier = std::numeric_limits<double>::quiet_NaN();
+            std::string unit;
+
+            if (node.is_keyval() || node.is_val()) // keyval from ScalarText can be a minimal entry in a dashed list
+            {
+                node >> metric;
+            }
+            else if (node.is_seq()) // more complex entry from ScalarText needs to be redirected
+            {
+                if (node.num_children() != 1 || !node.child(0).valid() || !node.child(0).is_map())
+                {
+                    NV_PERF_LOG_ERR(20, "Failed parsing MetricSignal from \"%s\"\n", ToString(node).c_str());
+                    return MetricSignal();
+                }
+
+                return MetricSignal::FromYaml(node.child(0), pValid);
+            }
+            else
+            {
+                if (!node.is_map())
+                {
+                    NV_PERF_LOG_ERR(20, "Failed parsing MetricSignal from \"%s\"\n", ToString(node).c_str());
+                    return MetricSignal();
+                }
+
+                auto labelNode       = node.find_child("label");
+                auto descriptionNode = node.find_child("description");
+                auto metricNode      = node.find_child("metric");
+                auto colorNode       = node.find_child("color");
+                auto maxNode         = node.find_child("max");
+                auto multiplierNode  = node.find_child("multiplier");
+                auto unitNode        = node.find_child("unit");
+
+                if (labelNode.valid())
+                {
+                    bool valid;
+                    label = StyledText::FromYaml(labelNode, StyledText(), &valid);
+                    if (!valid)
+                    {
+                        NV_PERF_LOG_ERR(20, "Failed parsing label from \"%s\"\n", ToString(labelNode).c_str());
+                        return MetricSignal();
+                    }
+                }
+
+                if (descriptionNode.valid())
+                {
+                    if (!descriptionNode.is_keyval())
+                    {
+                        NV_PERF_LOG_ERR(20, "Failed parsing description from \"%s\"\n", ToString(descriptionNode).c_str());
+                        return MetricSignal();
+                    }
+                    descriptionNode >> description;
+                }
+
+                if (!metricNode.valid() || !metricNode.is_keyval())
+                {
+                    NV_PERF_LOG_ERR(20, "Missing or invalid metric\n");
+                    return MetricSignal();
+                }
+                metricNode >> metric;
+                
+                color = Color::FromYaml(colorNode);
+
+                if (maxNode.valid())
+                {
+                    if (!maxNode.is_keyval() || !maxNode.val().is_number())
+                    {
+                        NV_PERF_LOG_ERR(20, "Failed parsing max from \"%s\"\n", ToString(maxNode).c_str());
+                        return MetricSignal();
+                    }
+                    maxNode >> maxValue;
+                    if (maxValue <= 0)
+                    {
+                        NV_PERF_LOG_WRN(50, "max %lf needs to be greater than 0. Using default.\n", maxValue);
+                        maxValue = std::numeric_limits<double>::quiet_NaN();
+                    }
+                }
+
+                if (multiplierNode.valid())
+                {
+                    if (!multiplierNode.is_keyval() || !multiplierNode.val().is_number())
+                    {
+                        NV_PERF_LOG_ERR(20, "Failed parsing multiplier from \"%s\"\n", ToString(multiplierNode).c_str());
+                        return MetricSignal();
+                    }
+                    multiplierNode >> multiplier;
+                    if (multiplier <= 0)
+                    {
+                        NV_PERF_LOG_WRN(50, "Multiplier %lf needs to be greater than 0. Using default.\n", multiplier);
+                        multiplier = std::numeric_limits<double>::quiet_NaN();
+                    }
+                }
+
+                if (unitNode.valid())
+                {
+                    if (!unitNode.is_keyval())
+                    {
+                        NV_PERF_LOG_ERR(20, "Failed parsing unit from \"%s\"\n", ToString(unitNode).c_str());
+                        return MetricSignal();
+                    }
+                    unitNode >> unit;
+
+                    if (unit.empty()) // if unit is set, but empty it should be hidden
+                    {
+                        unit = MetricSignal::HideUnit();
+                    }
+                }
+            }
+
+            if (!IsValidMetricName(metric))
+            {
+                NV_PERF_LOG_ERR(20, "Invalid metric \"%s\"\n", metric.c_str());
+                return MetricSignal();
+            }
+
+            if (pValid)
+            {
+                *pValid = true;
+            }
+            return MetricSignal(label, description, metric, color, maxValue, multiplier, unit);
+        }
+
+        // Only the fields read from YAML are stored, the rest is set by HudDataModel::Initialize().
+        static MetricSignal FromBlob(HudBlobReader& reader, bool* pValid)
+        {
+            const StyledText label = StyledText::FromBlob(reader);
+            std::string description = reader.ReadString();
+            std::string metric = reader.ReadString();
+            const Color color = Color::FromBlob(reader);
+            const double maxValue = reader.ReadDouble();
+            const double multiplier = reader.ReadDouble();
+            std::string unit = reader.ReadString();
+            if (pValid)
+            {
+                *pValid = !reader.Failed();
+            }
+            return MetricSignal(label, description, metric, color, maxValue, multiplier, unit);
+        }
+
+        void ToBlob(HudBlobWriter& writer) const
+        {
+            label.ToBlob(writer);
+            writer.WriteString(description);
+            writer.WriteString(metric);
+            color.ToBlob(writer);
+            writer.WriteDouble(maxValue);
+            writer.WriteDouble(multiplier);
+            writer.WriteString(unit);
+        }
+
+        // equivalent to matching "^[A-Za-z][A-Za-z0-9._]+$", without constructing a std::regex per signal
+        static bool IsValidMetricName(const std::string& metric)
+        {
+            auto isAlpha = [](char c) {
+                return ('A' <= c && c <= 'Z') || ('a' <= c && c <= 'z');
+            };
+            if (metric.size() < 2 || !isAlpha(metric[0]))
+            {
+                return false;
+            }
+            for (size_t index = 1; index < metric.size(); ++index)
+            {
+                const char c = metric[index];
+                if (!isAlpha(c) && !('0' <= c && c <= '9') && c != '.' && c != '_')
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
         void SetMaxNumSamples(size_t count)
         {
             maxNumSamples = count;
-            valBuffer = RingBuffer<double>(maxNumSamples);
+        }
+
+        // values are stored unscaled, the multiplier is applied when reading through valBuffer
+        void SetHistory(const MetricHistory* pHistory, size_t column)
+        {
+            valBuffer = MetricHistoryView(pHistory, column, std::isnan(multiplier) ? 1.0 : multiplier);
+        }
+
+        void SetStatistics(const MetricStatistics* pStatistics, size_t column)
+        {
+            statistics = MetricStatisticsView(pStatistics, column, std::isnan(multiplier) ? 1.0 : multiplier);
         }
 
         void SetMetricIndex(size_t index)
@@ -668,11 +1629,6 @@ namespace nv { namespace perf { namespace hud {
             metricIndexMaxValue = index;
         }
 
-        void AddSample(double value)
-        {
-            valBuffer.Push(value * (std::isnan(multiplier) ? 1.0 : multiplier));
-        }
-
         void SetMaxValue(double value)
         {
             maxValue = value * (std::isnan(multiplier) ? 1.0 : multiplier);
@@ -849,6 +1805,53 @@ namespace nv { namespace perf { namespace hud {
             return panel;
         }
 
+        static Panel FromBlob(HudBlobReader& reader, bool* pValid)
+        {
+            if (pValid)
+            {
+                *pValid = false;
+            }
+
+            std::string name = reader.ReadString();
+            const StyledText label = StyledText::FromBlob(reader);
+            const bool defaultOpen = !!reader.ReadUInt32();
+            const uint32_t numWidgets = reader.ReadUInt32();
+            if (!reader.IsCountPlausible(numWidgets, sizeof(uint32_t)))
+            {
+                return Panel();
+            }
+
+            std::vector<std::unique_ptr<Widget>> widgets;
+            for (uint32_t widgetIndex = 0; widgetIndex < numWidgets; ++widgetIndex)
+            {
+                bool valid;
+                std::unique_ptr<Widget> widget = WidgetFromBlob(reader, &valid);
+                if (!valid)
+                {
+                    return Panel();
+                }
+                widgets.emplace_back(std::move(widget));
+            }
+
+            if (pValid)
+            {
+                *pValid = !reader.Failed();
+            }
+            return Panel(name, label, defaultOpen, std::move(widgets));
+        }
+
+        void ToBlob(HudBlobWriter& writer) const
+        {
+            writer.WriteString(name);
+            label.ToBlob(writer);
+            writer.WriteUInt32(defaultOpen ? 1u : 0u);
+            writer.WriteUInt32((uint32_t)widgets.size());
+            for (const auto& pWidget : widgets)
+            {
+                WidgetToBlob(*pWidget, writer);
+            }
+        }
+
         virtual std::unique_ptr<Widget> Clone() const override
         {
             auto panel = std::make_unique<Panel>(*this);
@@ -972,6 +1975,38 @@ namespace nv { namespace perf { namespace hud {
             return ScalarText(label, metric, decimalPlaces, showValue);
         }
 
+        static ScalarText FromBlob(HudBlobReader& reader, bool* pValid)
+        {
+            if (pValid)
+            {
+                *pValid = false;
+            }
+
+            const StyledText label = StyledText::FromBlob(reader);
+            bool valid;
+            MetricSignal metric = MetricSignal::FromBlob(reader, &valid);
+            const int decimalPlaces = (int)reader.ReadUInt32();
+            const uint32_t showValue = reader.ReadUInt32();
+            if (!valid || reader.Failed() || showValue >= (uint32_t)ShowValue::Count)
+            {
+                return ScalarText();
+            }
+
+            if (pValid)
+            {
+                *pValid = true;
+            }
+            return ScalarText(label, metric, decimalPlaces, (ShowValue)showValue);
+        }
+
+        void ToBlob(HudBlobWriter& writer) const
+        {
+            label.ToBlob(writer);
+            signal.ToBlob(writer);
+            writer.WriteUInt32((uint32_t)decimalPlaces);
+            writer.WriteUInt32((uint32_t)showValue);
+        }
+
         virtual std::unique_ptr<Widget> Clone() const override
         {
             auto scalarText = std::make_unique<ScalarText>(*this);
@@ -1196,6 +2231,57 @@ namespace nv { namespace perf { namespace hud {
             return TimePlot(label, unit, chartType, valueMin, valueMax, nullptr, metrics);
         }
 
+        static TimePlot FromBlob(HudBlobReader& reader, bool* pValid)
+        {
+            if (pValid)
+            {
+                *pValid = false;
+            }
+
+            const StyledText label = StyledText::FromBlob(reader);
+            std::string unit = reader.ReadString();
+            const uint32_t chartType = reader.ReadUInt32();
+            const double valueMin = reader.ReadDouble();
+            const double valueMax = reader.ReadDouble();
+            const uint32_t numMetrics = reader.ReadUInt32();
+            if (chartType >= (uint32_t)ChartType::Count || !reader.IsCountPlausible(numMetrics, sizeof(uint32_t)))
+            {
+                return TimePlot();
+            }
+
+            std::vector<MetricSignal> metrics;
+            for (uint32_t metricIndex = 0; metricIndex < numMetrics; ++metricIndex)
+            {
+                bool valid;
+                metrics.emplace_back(MetricSignal::FromBlob(reader, &valid));
+                if (!valid)
+                {
+                    return TimePlot();
+                }
+            }
+
+            if (pValid)
+            {
+                *pValid = true;
+            }
+            return TimePlot(label, unit, (ChartType)chartType, valueMin, valueMax, nullptr, metrics);
+        }
+
+        // stackedSignals are not stored, the constructor derives them from "signals"
+        void ToBlob(HudBlobWriter& writer) const
+        {
+            label.ToBlob(writer);
+            writer.WriteString(unit);
+            writer.WriteUInt32((uint32_t)chartType);
+            writer.WriteDouble(valueMin);
+            writer.WriteDouble(valueMax);
+            writer.WriteUInt32((uint32_t)signals.size());
+            for (const MetricSignal& signal : signals)
+            {
+                signal.ToBlob(writer);
+            }
+        }
+
         virtual std::unique_ptr<Widget> Clone() const override
         {
             auto timePlot = std::make_unique<TimePlot>(*this);
@@ -1283,29 +2369,431 @@ namespace nv { namespace perf { namespace hud {
         return nullptr;
     }
 
+    inline std::unique_ptr<Widget> WidgetFromBlob(HudBlobReader& reader, bool* pValid)
+    {
+        if (pValid)
+        {
+            *pValid = false;
+        }
+
+        const Widget::Type type = (Widget::Type)reader.ReadUInt32();
+        if (type == Widget::Type::ScalarText)
+        {
+            return std::make_unique<ScalarText>(ScalarText::FromBlob(reader, pValid));
+        }
+        else if (type == Widget::Type::Separator)
+        {
+            if (pValid)
+            {
+                *pValid = !reader.Failed();
+            }
+            return std::make_unique<Separator>();
+        }
+        else if (type == Widget::Type::TimePlot)
+        {
+            return std::make_unique<TimePlot>(TimePlot::FromBlob(reader, pValid));
+        }
+        return nullptr; // Panels cannot be nested
+    }
+
+    inline void WidgetToBlob(const Widget& widget, HudBlobWriter& writer)
+    {
+        writer.WriteUInt32((uint32_t)widget.type);
+        if (widget.type == Widget::Type::ScalarText)
+        {
+            static_cast<const ScalarText&>(widget).ToBlob(writer);
+        }
+        else if (widget.type == Widget::Type::TimePlot)
+        {
+            static_cast<const TimePlot&>(widget).ToBlob(writer);
+        }
+    }
+
     // ScopedRymlErrorHandler /////////////////////////////////////////////////
 
-    // Makes sure no error calls ::abort() outright and crashes the program
-    class ScopedRymlErrorHandler
-    {
-    private:
-        ryml::Callbacks m_defaultCallbacks;
+    // Makes sure no error calls ::abort() outright and crashes the program
+    class ScopedRymlErrorHandler
+    {
+    private:
+        ryml::Callbacks m_defaultCallbacks;
+
+        static void OnError(const char* message, size_t length, ryml::Location loc, void* userData)
+        {
+            (void)userData;
+            std::string errorString = ryml::formatrs<std::string>("{}:{}:{} ({}B): ERROR: {}", loc.name, loc.line, loc.col, loc.offset, ryml::csubstr(message, length));
+            throw std::runtime_error(errorString.c_str());
+        }
+    public:
+        ScopedRymlErrorHandler()
+        {
+            m_defaultCallbacks = ryml::get_callbacks();
+            ryml::set_callbacks(ryml::Callbacks(this, nullptr, nullptr, ScopedRymlErrorHandler::OnError));
+        }
+        virtual ~ScopedRymlErrorHandler()
+        {
+            ryml::set_callbacks(m_defaultCallbacks);
+        }
+    };
+
+    // HudPresetCache /////////////////////////////////////////////////////////
+
+    struct HudPresetCacheHeader
+    {
+        char magic[8];        // "NVPWHPC"
+        uint32_t version;
+        uint32_t reserved;
+        uint64_t sdkVersion;  // NVPW_SDK_VERSION, resolved metrics are only valid for the library that produced them
+        uint64_t sourceHash;  // see HudPresetCache::HashSource()
+        uint64_t payloadSize; // bytes following this header
+        uint64_t payloadHash; // detects truncated or corrupt files
+
+        static const char* Magic()
+        {
+            return "NVPWHPC";
+        }
+        enum { Version = 1 };
+    };
+
+    // The results of the MetricsEvaluator queries HudDataModel::Initialize() makes per metric name.
+    struct HudResolvedMetric
+    {
+        enum Flags : uint32_t
+        {
+            HasRequest      = 1 << 0,
+            HasTypeAndIndex = 1 << 1,
+            HasDescription  = 1 << 2,
+            HasUnit         = 1 << 3,
+            HasMaxMetric    = 1 << 4,
+        };
+
+        uint32_t flags;
+        NVPW_MetricEvalRequest request;
+        std::string description;
+        std::string unit;      // as displayed, e.g. "%" rather than "percent"
+        std::string maxMetric; // the metric that bounds this one, see HudDataModel::Initialize()
+
+        HudResolvedMetric() : flags(), request(), description(), unit(), maxMetric() {}
+    };
+
+    // A compiled form of a chip's baked HUD presets: the parsed HudConfiguration of every preset that was loaded, and the resolved metadata of
+    // every metric they reference. HudPresets::Initialize(), HudDataModel::Load() and HudDataModel::Initialize() fill it on the first run,
+    // and read from it on later runs instead of parsing YAML and querying the MetricsEvaluator by name. Loading maps the file, and
+    // configurations are deserialized straight from the mapping.
+    // The cache is keyed by chip name, a hash of the baked YAML files, and NVPW_SDK_VERSION. If any of them differs, it is cleared and
+    // rebuilt from YAML.
+    //
+    //     HudPresetCache cache;
+    //     cache.Load(path); // a missing or stale file is not an error
+    //     presets.Initialize(chipName, &cache);
+    //     model.Load(presets.GetPreset(name));
+    //     model.Initialize(...);
+    //     if (cache.IsDirty()) cache.Save(path);
+    class HudPresetCache
+    {
+    public:
+        struct Preset
+        {
+            std::string name;
+            std::string fileName;
+        };
+
+    private:
+        struct Configuration
+        {
+            std::string name;
+            const uint8_t* pData;          // into m_file, or ownedData
+            size_t size;
+            std::vector<uint8_t> ownedData;
+        };
+
+        MappedFile m_file;
+        std::string m_chipName;
+        uint64_t m_sourceHash;
+        std::vector<Preset> m_presets;
+        std::vector<Configuration> m_configurations;
+        std::unordered_map<std::string, HudResolvedMetric> m_metrics;
+        bool m_isDirty;
+
+    public:
+        HudPresetCache()
+            : m_sourceHash()
+            , m_isDirty()
+        {
+        }
+        HudPresetCache(const HudPresetCache& cache) = delete;
+        HudPresetCache& operator=(const HudPresetCache& cache) = delete;
+
+        // chain calls by passing the previous result as "hash"
+        static uint64_t HashSource(const void* pData, size_t size, uint64_t hash = 0xcbf29ce484222325ull)
+        {
+            return Fnv1a64(pData, size, hash);
+        }
+
+        void Clear()
+        {
+            m_file.Close();
+            m_chipName.clear();
+            m_sourceHash = 0;
+            m_presets.clear();
+            m_configurations.clear();
+            m_metrics.clear();
+            m_isDirty = false;
+        }
+
+        bool IsDirty() const
+        {
+            return m_isDirty;
+        }
+
+        bool Load(const std::string& path)
+        {
+            Clear();
+            {
+                FILE* pFile = OpenFile(path.c_str(), "rb");
+                if (!pFile)
+                {
+                    NV_PERF_LOG_INF(50, "No HUD preset cache at %s\n", path.c_str());
+                    return false;
+                }
+                fclose(pFile);
+            }
+            if (!m_file.OpenReadOnly(path))
+            {
+                return false;
+            }
+
+            HudPresetCacheHeader header = {};
+            if (m_file.Size() < sizeof(header))
+            {
+                NV_PERF_LOG_WRN(50, "%s is too small to be a HUD preset cache\n", path.c_str());
+                Clear();
+                return false;
+            }
+            memcpy(&header, m_file.Data(), sizeof(header));
+            const uint8_t* pPayload = m_file.Data() + sizeof(header);
+            if (memcmp(header.magic, HudPresetCacheHeader::Magic(), sizeof(header.magic)) || header.version != HudPresetCacheHeader::Version
+                || header.sdkVersion != NVPW_SDK_VERSION)
+            {
+                NV_PERF_LOG_INF(50, "%s was written by a different version, ignoring it\n", path.c_str());
+                Clear();
+                return false;
+            }
+            if (header.payloadSize != m_file.Size() - sizeof(header) || header.payloadHash != HashSource(pPayload, (size_t)header.payloadSize))
+            {
+                NV_PERF_LOG_WRN(50, "%s is truncated or corrupt, ignoring it\n", path.c_str());
+                Clear();
+                return false;
+            }
+
+            HudBlobReader reader(pPayload, (size_t)header.payloadSize);
+            m_chipName = reader.ReadString();
+            m_sourceHash = header.sourceHash;
+            // the minimum sizes assume empty strings
+            const uint32_t numPresets = reader.ReadUInt32();
+            for (uint32_t presetIndex = 0; presetIndex < numPresets && reader.IsCountPlausible(numPresets - presetIndex, 8); ++presetIndex)
+            {
+                Preset preset;
+                preset.name = reader.ReadString();
+                preset.fileName = reader.ReadString();
+                m_presets.push_back(std::move(preset));
+            }
+            const uint32_t numConfigurations = reader.ReadUInt32();
+            for (uint32_t configurationIndex = 0; configurationIndex < numConfigurations && reader.IsCountPlausible(numConfigurations - configurationIndex, 12); ++configurationIndex)
+            {
+                Configuration configuration;
+                configuration.name = reader.ReadString();
+                configuration.size = (size_t)reader.ReadUInt64();
+                configuration.pData = reader.Skip(configuration.size);
+                m_configurations.push_back(std::move(configuration));
+            }
+            const uint32_t numMetrics = reader.ReadUInt32();
+            for (uint32_t metricIndex = 0; metricIndex < numMetrics && reader.IsCountPlausible(numMetrics - metricIndex, 32); ++metricIndex)
+            {
+                std::string name = reader.ReadString();
+                HudResolvedMetric metric;
+                metric.flags = reader.ReadUInt32();
+                metric.request.metricIndex = (size_t)reader.ReadUInt64();
+                const uint32_t packedRequest = reader.ReadUInt32();
+                metric.request.metricType = (uint8_t)(packedRequest >> 24);
+                metric.request.rollupOp = (uint8_t)(packedRequest >> 16);
+                metric.request.submetric = (uint16_t)packedRequest;
+                metric.description = reader.ReadString();
+                metric.unit = reader.ReadString();
+                metric.maxMetric = reader.ReadString();
+                m_metrics[name] = std::move(metric);
+            }
+            if (reader.Failed() || reader.GetNumRemainingBytes())
+            {
+                NV_PERF_LOG_WRN(50, "%s is corrupt, ignoring it\n", path.c_str());
+                Clear();
+                return false;
+            }
+            return true;
+        }
+
+        bool Save(const std::string& path)
+        {
+            // the mapping may be of the file about to be overwritten
+            for (Configuration& configuration : m_configurations)
+            {
+                if (configuration.ownedData.empty())
+                {
+                    configuration.ownedData.assign(configuration.pData, configuration.pData + configuration.size);
+                    configuration.pData = configuration.ownedData.data();
+                }
+            }
+            m_file.Close();
+
+            HudBlobWriter writer;
+            writer.WriteString(m_chipName);
+            writer.WriteUInt32((uint32_t)m_presets.size());
+            for (const Preset& preset : m_presets)
+            {
+                writer.WriteString(preset.name);
+                writer.WriteString(preset.fileName);
+            }
+            writer.WriteUInt32((uint32_t)m_configurations.size());
+            for (const Configuration& configuration : m_configurations)
+            {
+                writer.WriteString(configuration.name);
+                writer.WriteUInt64(configuration.size);
+                writer.WriteBytes(configuration.pData, configuration.size);
+            }
+            writer.WriteUInt32((uint32_t)m_metrics.size());
+            for (const auto& nameAndMetric : m_metrics)
+            {
+                const HudResolvedMetric& metric = nameAndMetric.second;
+                writer.WriteString(nameAndMetric.first);
+                writer.WriteUInt32(metric.flags);
+                writer.WriteUInt64(metric.request.metricIndex);
+                writer.WriteUInt32(((uint32_t)metric.request.metricType << 24) | ((uint32_t)metric.request.rollupOp << 16) | metric.request.submetric);
+                writer.WriteString(metric.description);
+                writer.WriteString(metric.unit);
+                writer.WriteString(metric.maxMetric);
+            }
+            const std::vector<uint8_t>& payload = writer.GetData();
+
+            HudPresetCacheHeader header = {};
+            memcpy(header.magic, HudPresetCacheHeader::Magic(), sizeof(header.magic));
+            header.version = HudPresetCacheHeader::Version;
+            header.sdkVersion = NVPW_SDK_VERSION;
+            header.sourceHash = m_sourceHash;
+            header.payloadSize = payload.size();
+            header.payloadHash = HashSource(payload.data(), payload.size());
+
+            // written aside and renamed into place, so that neither a failed write nor another process saving concurrently leaves a torn cache
+            char suffix[32];
+            snprintf(suffix, sizeof(suffix), ".%016llx.tmp", (unsigned long long)(std::hash<std::thread::id>()(std::this_thread::get_id())
+                ^ (uint64_t)std::chrono::high_resolution_clock::now().time_since_epoch().count()));
+            const std::string temporaryPath = path + suffix;
+            FILE* pFile = OpenFile(temporaryPath.c_str(), "wb");
+            if (!pFile)
+            {
+                NV_PERF_LOG_ERR(20, "OpenFile failed for file: %s\n", temporaryPath.c_str());
+                return false;
+            }
+            bool success = fwrite(&header, sizeof(header), 1, pFile) == 1;
+            success = success && fwrite(payload.data(), 1, payload.size(), pFile) == payload.size();
+            success = !fclose(pFile) && success;
+            if (success && rename(temporaryPath.c_str(), path.c_str()))
+            {
+                // rename() does not replace an existing file on Windows
+                remove(path.c_str());
+                success = !rename(temporaryPath.c_str(), path.c_str());
+            }
+            if (!success)
+            {
+                remove(temporaryPath.c_str());
+                NV_PERF_LOG_ERR(20, "Failed writing %s\n", path.c_str());
+                return false;
+            }
+            m_isDirty = false;
+            return true;
+        }
+
+        // Returns true if the cache holds data for this chip and these sources. Otherwise clears the cache and takes on the new key, so that
+        // it is rebuilt by the following calls.
+        bool Validate(const std::string& chipName, uint64_t sourceHash)
+        {
+            if (m_chipName == chipName && m_sourceHash == sourceHash && !m_presets.empty())
+            {
+                return true;
+            }
+            Clear();
+            m_chipName = chipName;
+            m_sourceHash = sourceHash;
+            m_isDirty = true;
+            return false;
+        }
+
+        const std::string& GetChipName() const
+        {
+            return m_chipName;
+        }
+
+        const std::vector<Preset>& GetPresets() const
+        {
+            return m_presets;
+        }
+
+        void SetPresets(const std::vector<Preset>& presets)
+        {
+            m_presets = presets;
+            m_isDirty = true;
+        }
+
+        // On success, "reader" reads the HudConfiguration that was stored with AddConfiguration().
+        bool FindConfiguration(const std::string& name, HudBlobReader& reader) const
+        {
+            for (const Configuration& configuration : m_configurations)
+            {
+                if (configuration.name == name)
+                {
+                    reader = HudBlobReader(configuration.pData, configuration.size);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void AddConfiguration(const std::string& name, std::vector<uint8_t>&& data)
+        {
+            for (Configuration& configuration : m_configurations)
+            {
+                if (configuration.name == name)
+                {
+                    configuration.ownedData = std::move(data);
+                    configuration.pData = configuration.ownedData.data();
+                    configuration.size = configuration.ownedData.size();
+                    m_isDirty = true;
+                    return;
+                }
+            }
+            Configuration configuration;
+            configuration.name = name;
+            configuration.ownedData = std::move(data);
+            configuration.pData = configuration.ownedData.data();
+            configuration.size = configuration.ownedData.size();
+            m_configurations.push_back(std::move(configuration));
+            m_isDirty = true;
+        }
 
-        static void OnError(const char* message, size_t length, ryml::Location loc, void* userData)
+        const HudResolvedMetric* FindMetric(const std::string& name) const
         {
-            (void)userData;
-            std::string errorString = ryml::formatrs<std::string>("{}:{}:{} ({}B): ERROR: {}", loc.name, loc.line, loc.col, loc.offset, ryml::csubstr(message, length));
-            throw std::runtime_error(errorString.c_str());
+            const auto itr = m_metrics.find(name);
+            return (itr != m_metrics.end()) ? &itr->second : nullptr;
         }
-    public:
-        ScopedRymlErrorHandler()
+
+        // pointers from FindMetric() stay valid
+        void AddMetric(const std::string& name, const HudResolvedMetric& metric)
         {
-            m_defaultCallbacks = ryml::get_callbacks();
-            ryml::set_callbacks(ryml::Callbacks(this, nullptr, nullptr, ScopedRymlErrorHandler::OnError));
+            m_metrics[name] = metric;
+            m_isDirty = true;
         }
-        virtual ~ScopedRymlErrorHandler()
+
+        size_t GetNumMetrics() const
         {
-            ryml::set_callbacks(m_defaultCallbacks);
+            return m_metrics.size();
         }
     };
 
@@ -1319,10 +2807,11 @@ namespace nv { namespace perf { namespace hud {
 
         const char* pYaml; // 0-terminated
         std::string fileName;
+        HudPresetCache* pCache; // plumbed through to HudDataModel, set for baked presets if HudPresets::Initialize() was given a cache
 
-        HudPreset() : name(), chipName(), pYaml(nullptr), fileName() {}
+        HudPreset() : name(), chipName(), pYaml(nullptr), fileName(), pCache(nullptr) {}
         HudPreset(const std::string& name_, const std::string& chipName_, const char* pYaml_, const std::string& fileName_)
-            : name(name_), chipName(chipName_), pYaml(pYaml_), fileName(fileName_) {}
+            : name(name_), chipName(chipName_), pYaml(pYaml_), fileName(fileName_), pCache(nullptr) {}
 
         static HudPreset FromYaml(const ryml::NodeRef& node, const char* pYaml, const std::string& fileName, bool* pValid, const std::string& chipName)
         {
@@ -1374,7 +2863,9 @@ namespace nv { namespace perf { namespace hud {
     public:
         HudPresets() = default;
 
-        bool Initialize(const std::string& chipName)
+        // With a cache that matches the baked files, the preset list is taken from the cache rather than parsed from YAML. Otherwise the
+        // cache is rebuilt, and filled further by HudDataModel as it loads these presets.
+        bool Initialize(const std::string& chipName, HudPresetCache* pCache = nullptr)
         {
             m_loadedFiles.clear();
             m_presets.clear();
@@ -1389,6 +2880,34 @@ namespace nv { namespace perf { namespace hud {
                 return false;
             }
 
+            if (pCache)
+            {
+                uint64_t sourceHash = HudPresetCache::HashSource(chipName.data(), chipName.size());
+                for (size_t index = 0; index < bakedConfigurationsSize; ++index)
+                {
+                    sourceHash = HudPresetCache::HashSource(bakedConfigurationsFileNames[index], strlen(bakedConfigurationsFileNames[index]) + 1, sourceHash);
+                    sourceHash = HudPresetCache::HashSource(bakedConfigurations[index], strlen(bakedConfigurations[index]) + 1, sourceHash);
+                }
+                if (pCache->Validate(chipName, sourceHash))
+                {
+                    for (const HudPresetCache::Preset& cachedPreset : pCache->GetPresets())
+                    {
+                        const char* pYaml = nullptr;
+                        for (size_t index = 0; index < bakedConfigurationsSize; ++index)
+                        {
+                            if (cachedPreset.fileName == bakedConfigurationsFileNames[index])
+                            {
+                                pYaml = bakedConfigurations[index];
+                                break;
+                            }
+                        }
+                        m_presets.emplace_back(cachedPreset.name, chipName, pYaml, cachedPreset.fileName);
+                        m_presets.back().pCache = pCache;
+                    }
+                    return true;
+                }
+            }
+
             for (size_t index = 0; index < bakedConfigurationsSize; ++index)
             {
                 bool success = LoadFromString(bakedConfigurations[index], bakedConfigurationsFileNames[index]);
@@ -1399,6 +2918,17 @@ namespace nv { namespace perf { namespace hud {
                 }
             }
 
+            if (pCache)
+            {
+                std::vector<HudPresetCache::Preset> cachedPresets;
+                for (HudPreset& preset : m_presets)
+                {
+                    preset.pCache = pCache;
+                    cachedPresets.push_back(HudPresetCache::Preset{ preset.name, preset.fileName });
+                }
+                pCache->SetPresets(cachedPresets);
+            }
+
             return true;
         }
 
@@ -1657,75 +3187,472 @@ namespace nv { namespace perf { namespace hud {
                 return HudConfiguration();
             }
 
-            std::vector<Panel> panels;
-            for (size_t index = 0; index < panelsNode.num_children(); ++index)
+            std::vector<Panel> panels;
+            for (size_t index = 0; index < panelsNode.num_children(); ++index)
+            {
+                const ryml::NodeRef& panelNode = panelsNode[index];
+
+                std::string panelName;
+                bool defaultOpen = true;
+
+                if (panelNode.is_map()) // parses " -name: asdf\n  defaultOpen: True"
+                {
+                    auto panelNameNode = panelNode.find_child("name");
+                    auto panelDefaultOpenNode = panelNode.find_child("defaultOpen");
+
+                    if (!panelNameNode.valid() || !panelNameNode.is_keyval())
+                    {
+                        NV_PERF_LOG_ERR(20, "Missing or invalid panel name\n");
+                        return HudConfiguration();
+                    }
+                    panelNameNode >> panelName;
+                    if (panelDefaultOpenNode.valid())
+                    {
+                        bool valid;
+                        defaultOpen = BoolFromYaml(panelDefaultOpenNode, false, &valid);
+                        if (!valid)
+                        {
+                            NV_PERF_LOG_WRN(50, "Failed parsing defaultOpen from \"%s\". Using default.\n", ToString(panelDefaultOpenNode).c_str());
+                        }
+                    }
+
+                }
+                else // parses the short-hand "- panel_name"
+                {
+                    panelNode >> panelName;
+                }
+
+                bool found = false;
+                for (const auto& panel : createdPanels)
+                {
+                    if (panel.name == panelName)
+                    {
+                        panels.emplace_back(panel); // Copies the Panel object
+                        panels.back().defaultOpen = defaultOpen;
+                        found = true;
+                        break;
+                    }
+                }
+
+                if (!found)
+                {
+                    NV_PERF_LOG_ERR(20, "Cannot find \"%s\" in panels section\n", panelName.c_str());
+                    return HudConfiguration();
+                }
+            }
+
+            if (pValid)
+            {
+                *pValid = true;
+            }
+            return HudConfiguration(name, speed, panels);
+        }
+
+        static HudConfiguration FromBlob(HudBlobReader& reader, bool* pValid)
+        {
+            if (pValid)
+            {
+                *pValid = false;
+            }
+
+            std::string name = reader.ReadString();
+            const uint32_t speed = reader.ReadUInt32();
+            const uint32_t numPanels = reader.ReadUInt32();
+            if (speed >= (uint32_t)SamplingSpeed::Count || !reader.IsCountPlausible(numPanels, sizeof(uint32_t)))
+            {
+                return HudConfiguration();
+            }
+
+            HudConfiguration configuration(name, (SamplingSpeed)speed, std::vector<Panel>());
+            configuration.panels.reserve(numPanels);
+            for (uint32_t panelIndex = 0; panelIndex < numPanels; ++panelIndex)
+            {
+                bool valid;
+                configuration.panels.emplace_back(Panel::FromBlob(reader, &valid));
+                if (!valid)
+                {
+                    return HudConfiguration();
+                }
+            }
+
+            if (pValid)
+            {
+                *pValid = true;
+            }
+            return configuration;
+        }
+
+        void ToBlob(HudBlobWriter& writer) const
+        {
+            writer.WriteString(name);
+            writer.WriteUInt32((uint32_t)samplingSpeed);
+            writer.WriteUInt32((uint32_t)panels.size());
+            for (const Panel& panel : panels)
+            {
+                panel.ToBlob(writer);
+            }
+        }
+
+        void Print(std::ostream& os, const std::string indent = std::string()) const
+        {
+            os << indent << "HudConfiguration(" << name << ", " << (int) samplingSpeed << std::endl;
+            for (const auto& panel : panels)
+            {
+                panel.Print(os, indent + "  ");
+            }
+            os << indent << ")" << std::endl;
+        }
+    };
+
+    // Describes one signal of an ExternalSignalSource. HUD presets reference it by "name" wherever they could reference a metric.
+    struct ExternalSignalDesc
+    {
+        std::string name;        // must be a valid metric name, see MetricSignal::IsValidMetricName(), e.g. "tegra.gpu.frequency"
+        std::string unit;        // used by signals that do not set a unit in YAML
+        std::string description; // used by signals that do not set a description in YAML
+        double maxValue;         // used by signals that do not set a maxValue in YAML, NaN if unbounded
+
+        ExternalSignalDesc() : name(), unit(), description(), maxValue(std::numeric_limits<double>::quiet_NaN()) {}
+        ExternalSignalDesc(std::string name_, std::string unit_, std::string description_, double maxValue_ = std::numeric_limits<double>::quiet_NaN())
+            : name(name_), unit(unit_), description(description_), maxValue(maxValue_)
+        {
+        }
+    };
+
+    struct ExternalSignalSourceOptions
+    {
+        double samplesPerSecond;
+        size_t maxQueuedSamples;      // samples not consumed by then are dropped
+        uint64_t (*pGetTimestamp)();  // nanoseconds, required; there is no default since no host clock shares the GPU's time domain
+        int64_t timestampOffset;      // added to pGetTimestamp(), translates it to the clock of the periodic sampler
+
+        ExternalSignalSourceOptions()
+            : samplesPerSecond(100.0)
+            , maxQueuedSamples(1024)
+            , pGetTimestamp(nullptr)
+            , timestampOffset(0)
+        {
+        }
+
+        // Derives "timestampOffset" from one reading of each clock taken at the same moment, e.g. both timestamps returned by
+        // PeriodicSamplerTimeHistoryVulkan::GetCalibratedTimestamps() when pGetTimestamp is GetCpuMarkerTimestamp().
+        void CorrelateClocks(uint64_t timestamp, uint64_t samplerTimestamp)
+        {
+            timestampOffset = (int64_t)(samplerTimestamp - timestamp);
+        }
+    };
+
+    // A set of non-GPU signals, e.g. clocks, temperatures and power rails, that are polled on a dedicated thread and merged into the HUD
+    // timeline by HudDataModel::AddExternalSignalSource(). Subclasses add their signals before Initialize(), fill one value per signal
+    // in Poll(), and must call Stop() in their destructor. Every sample is timestamped with ExternalSignalSourceOptions::pGetTimestamp,
+    // which has to match the periodic sampler's clock, either directly or through "timestampOffset"; samples are matched to GPU samples
+    // by these timestamps alone, so a CPU clock with no offset puts the external signals at arbitrary points of the timeline.
+    // The polling thread is the only producer and HudDataModel the only consumer of the queued samples; neither takes a lock.
+    class ExternalSignalSource
+    {
+    private:
+        struct QueuedSample
+        {
+            uint64_t timestamp;
+            size_t valueOffset; // into m_values
+        };
+
+        std::vector<ExternalSignalDesc> m_signals;
+        ExternalSignalSourceOptions m_options;
+        SpscQueue<QueuedSample> m_samples;
+        std::vector<double> m_values;         // "numSignals" values per slot of m_samples
+        uint64_t m_numPolledSamples;          // producer only, selects the next slot of m_values
+        std::atomic<uint64_t> m_numDroppedSamples;
+        std::thread m_thread;
+        std::mutex m_wakeMutex;               // only guards the sleep of the polling thread
+        std::condition_variable m_wake;
+        std::atomic<bool> m_stop;
+        bool m_isInitialized;
+
+    protected:
+        // Called on the polling thread once per sample, "pValues" has one element per signal in the order they were added.
+        // Values that cannot be read should be set to NaN.
+        virtual void Poll(double* pValues) = 0;
+
+        // Must be called before Initialize().
+        bool AddSignalDesc(const ExternalSignalDesc& desc)
+        {
+            if (m_isInitialized)
+            {
+                NV_PERF_LOG_ERR(20, "Signals must be added before Initialize()\n");
+                return false;
+            }
+            if (!MetricSignal::IsValidMetricName(desc.name))
+            {
+                NV_PERF_LOG_ERR(20, "Invalid external signal name \"%s\"\n", desc.name.c_str());
+                return false;
+            }
+            if (FindSignal(desc.name) != (size_t)~0)
+            {
+                NV_PERF_LOG_ERR(20, "Duplicate external signal \"%s\"\n", desc.name.c_str());
+                return false;
+            }
+            m_signals.push_back(desc);
+            return true;
+        }
+
+    public:
+        ExternalSignalSource()
+            : m_numPolledSamples()
+            , m_numDroppedSamples(0)
+            , m_stop(false)
+            , m_isInitialized()
+        {
+        }
+        ExternalSignalSource(const ExternalSignalSource& source) = delete;
+        ExternalSignalSource& operator=(const ExternalSignalSource& source) = delete;
+        virtual ~ExternalSignalSource()
+        {
+            Stop();
+        }
+
+        const std::vector<ExternalSignalDesc>& GetSignals() const
+        {
+            return m_signals;
+        }
+
+        // returns "~0" if there is no signal named "name"
+        size_t FindSignal(const std::string& name) const
+        {
+            for (size_t signalIndex = 0; signalIndex < m_signals.size(); ++signalIndex)
+            {
+                if (m_signals[signalIndex].name == name)
+                {
+                    return signalIndex;
+                }
+            }
+            return (size_t)~0;
+        }
+
+        // Allocates the sample queue. Samples can then be taken by PollOnce(), or on the polling thread after Start().
+        bool Initialize(const ExternalSignalSourceOptions& options)
+        {
+            if (IsRunning())
+            {
+                NV_PERF_LOG_ERR(20, "Cannot initialize a running source\n");
+                return false;
+            }
+            if (!options.pGetTimestamp)
+            {
+                NV_PERF_LOG_ERR(20, "ExternalSignalSourceOptions::pGetTimestamp must be set to a clock translatable to the periodic sampler's\n");
+                return false;
+            }
+            if (!(options.samplesPerSecond > 0.0) || !m_samples.Initialize(options.maxQueuedSamples))
+            {
+                NV_PERF_LOG_ERR(20, "Invalid external signal source options\n");
+                return false;
+            }
+            m_options = options;
+            m_values.assign(m_samples.Capacity() * m_signals.size(), 0.0);
+            m_numPolledSamples = 0;
+            m_numDroppedSamples = 0;
+            m_isInitialized = true;
+            return true;
+        }
+
+        bool IsInitialized() const
+        {
+            return m_isInitialized;
+        }
+
+        const ExternalSignalSourceOptions& GetOptions() const
+        {
+            return m_options;
+        }
+
+        size_t GetMaxQueuedSamples() const
+        {
+            return m_samples.Capacity();
+        }
+
+        // Starts polling at ExternalSignalSourceOptions::samplesPerSecond. Polls that fall behind are skipped rather than caught up on.
+        bool Start()
+        {
+            if (!m_isInitialized)
+            {
+                NV_PERF_LOG_ERR(20, "Not initialized\n");
+                return false;
+            }
+            if (IsRunning())
+            {
+                return true;
+            }
+            m_stop = false;
+            m_thread = std::thread(&ExternalSignalSource::PollingThreadProc, this);
+            return true;
+        }
+
+        void Stop()
+        {
+            if (!IsRunning())
+            {
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_wakeMutex);
+                m_stop = true;
+            }
+            m_wake.notify_one();
+            m_thread.join();
+        }
+
+        bool IsRunning() const
+        {
+            return m_thread.joinable();
+        }
+
+        // Producer only: takes one sample on the calling thread, must not be called while the source is running.
+        // Returns false if the sample was dropped because the queue is full.
+        bool PollOnce()
+        {
+            if (!m_isInitialized)
+            {
+                return false;
+            }
+            // a full queue can still be read by the consumer, including the value slot this sample would overwrite
+            if (m_samples.Size() == m_samples.Capacity())
+            {
+                ++m_numDroppedSamples;
+                return false;
+            }
+            const size_t valueOffset = size_t(m_numPolledSamples % m_samples.Capacity()) * m_signals.size();
+            double* pValues = m_values.data() + valueOffset;
+            const uint64_t beginTime = m_options.pGetTimestamp();
+            Poll(pValues);
+            const uint64_t endTime = m_options.pGetTimestamp();
+            const uint64_t timestamp = beginTime + (endTime - beginTime) / 2 + (uint64_t)m_options.timestampOffset;
+            m_samples.Push(QueuedSample{ timestamp, valueOffset });
+            ++m_numPolledSamples;
+            return true;
+        }
+
+        // Consumer only: "TConsumeSampleFunc" is expected to be in the form of void(uint64_t timestamp, const double* pValues), with one
+        // value per signal. "pValues" is only valid during the call. Returns the number of consumed samples.
+        template <class TConsumeSampleFunc>
+        size_t ConsumeSamples(TConsumeSampleFunc&& consumeSampleFunc)
+        {
+            size_t numSamples = 0;
+            for (const QueuedSample* pSample = m_samples.Front(); pSample; pSample = m_samples.Front())
             {
-                const ryml::NodeRef& panelNode = panelsNode[index];
+                consumeSampleFunc(pSample->timestamp, m_values.data() + pSample->valueOffset);
+                m_samples.Pop();
+                ++numSamples;
+            }
+            return numSamples;
+        }
 
-                std::string panelName;
-                bool defaultOpen = true;
+        uint64_t GetNumDroppedSamples() const
+        {
+            return m_numDroppedSamples;
+        }
 
-                if (panelNode.is_map()) // parses " -name: asdf\n  defaultOpen: True"
+    private:
+        void PollingThreadProc()
+        {
+            const auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / m_options.samplesPerSecond));
+            auto nextPollTime = std::chrono::steady_clock::now();
+            std::unique_lock<std::mutex> lock(m_wakeMutex);
+            while (!m_stop)
+            {
+                lock.unlock();
+                PollOnce();
+                lock.lock();
+
+                nextPollTime += interval;
+                const auto now = std::chrono::steady_clock::now();
+                if (nextPollTime < now)
                 {
-                    auto panelNameNode = panelNode.find_child("name");
-                    auto panelDefaultOpenNode = panelNode.find_child("defaultOpen");
+                    nextPollTime = now;
+                }
+                m_wake.wait_until(lock, nextPollTime, [&]() { return m_stop.load(); });
+            }
+        }
+    };
 
-                    if (!panelNameNode.valid() || !panelNameNode.is_keyval())
-                    {
-                        NV_PERF_LOG_ERR(20, "Missing or invalid panel name\n");
-                        return HudConfiguration();
-                    }
-                    panelNameNode >> panelName;
-                    if (panelDefaultOpenNode.valid())
-                    {
-                        bool valid;
-                        defaultOpen = BoolFromYaml(panelDefaultOpenNode, false, &valid);
-                        if (!valid)
-                        {
-                            NV_PERF_LOG_WRN(50, "Failed parsing defaultOpen from \"%s\". Using default.\n", ToString(panelDefaultOpenNode).c_str());
-                        }
-                    }
+    // The most recent samples of an ExternalSignalSource on the consumer side, so that they can be looked up at the time of GPU samples
+    // that are decoded with some latency.
+    class ExternalSignalHistory
+    {
+    private:
+        std::vector<uint64_t> m_timestamps; // ring buffer, ordered by time
+        std::vector<double> m_values;       // ring buffer, "m_numSignals" values per sample
+        size_t m_numSignals;
+        uint64_t m_numSamples;              // ever added
 
-                }
-                else // parses the short-hand "- panel_name"
-                {
-                    panelNode >> panelName;
-                }
+    public:
+        ExternalSignalHistory()
+            : m_numSignals()
+            , m_numSamples()
+        {
+        }
 
-                bool found = false;
-                for (const auto& panel : createdPanels)
-                {
-                    if (panel.name == panelName)
-                    {
-                        panels.emplace_back(panel); // Copies the Panel object
-                        panels.back().defaultOpen = defaultOpen;
-                        found = true;
-                        break;
-                    }
-                }
+        void Initialize(size_t numSignals, size_t maxNumSamples)
+        {
+            m_timestamps.assign(maxNumSamples, 0);
+            m_values.assign(maxNumSamples * numSignals, 0.0);
+            m_numSignals = numSignals;
+            m_numSamples = 0;
+        }
 
-                if (!found)
-                {
-                    NV_PERF_LOG_ERR(20, "Cannot find \"%s\" in panels section\n", panelName.c_str());
-                    return HudConfiguration();
-                }
-            }
+        size_t Size() const
+        {
+            return (size_t)(std::min)(m_numSamples, (uint64_t)m_timestamps.size());
+        }
 
-            if (pValid)
+        // Samples must be added in the order of their timestamps.
+        void AddSample(uint64_t timestamp, const double* pValues)
+        {
+            if (m_timestamps.empty())
             {
-                *pValid = true;
+                return;
             }
-            return HudConfiguration(name, speed, panels);
+            const size_t slot = size_t(m_numSamples % m_timestamps.size());
+            m_timestamps[slot] = timestamp;
+            std::copy(pValues, pValues + m_numSignals, m_values.begin() + slot * m_numSignals);
+            ++m_numSamples;
         }
 
-        void Print(std::ostream& os, const std::string indent = std::string()) const
+        // Moves every sample queued by "source" into the history, returns the number of samples moved.
+        size_t Drain(ExternalSignalSource& source)
         {
-            os << indent << "HudConfiguration(" << name << ", " << (int) samplingSpeed << std::endl;
-            for (const auto& panel : panels)
+            return source.ConsumeSamples([&](uint64_t timestamp, const double* pValues) {
+                AddSample(timestamp, pValues);
+            });
+        }
+
+        // Returns the values of the latest sample taken at or before "timestamp", or nullptr if every retained sample is later.
+        const double* FindValuesAt(uint64_t timestamp) const
+        {
+            const size_t size = Size();
+            const uint64_t firstSample = m_numSamples - size;
+            auto getSlot = [&](size_t index) {
+                return size_t((firstSample + index) % m_timestamps.size());
+            };
+            // the number of samples at or before "timestamp"
+            size_t begin = 0;
+            size_t end = size;
+            while (begin < end)
             {
-                panel.Print(os, indent + "  ");
+                const size_t middle = begin + (end - begin) / 2;
+                if (m_timestamps[getSlot(middle)] <= timestamp)
+                {
+                    begin = middle + 1;
+                }
+                else
+                {
+                    end = middle;
+                }
             }
-            os << indent << ")" << std::endl;
+            if (!begin)
+            {
+                return nullptr;
+            }
+            return m_values.data() + getSlot(begin - 1) * m_numSignals;
         }
     };
 
@@ -1735,76 +3662,190 @@ namespace nv { namespace perf { namespace hud {
         class CounterConfigBuilder
         {
         private:
+            struct OptionalMetric
+            {
+                std::string name;
+                NVPW_MetricEvalRequest request;
+                size_t metricIndex;
+            };
+
             MetricsEvaluator* m_pMetricsEvaluator;
+            const MetricNameIndex* m_pMetricNameIndex;
             std::vector<NVPW_MetricEvalRequest>* m_pMetricEvalRequests;
-            std::map<std::string, size_t> m_metricNameToIndex;
-            MetricsConfigBuilder m_configBuilder;
-        
-        public:
-            CounterConfigBuilder()
-                : m_pMetricsEvaluator()
-                , m_pMetricEvalRequests()
-            {
-            }
+            std::vector<std::string> m_metricNames;                // parallel to *m_pMetricEvalRequests, for error messages
+            std::unordered_map<uint64_t, size_t> m_requestToIndex; // keyed by PackRequest()
+            std::vector<OptionalMetric> m_optionalMetrics;
+            std::string m_chipName;
+            const CounterConfigurationCache* m_pCache;
 
-            bool Initialize(const std::string& chipName, MetricsEvaluator& metricsEvaluator, std::vector<NVPW_MetricEvalRequest>& metricEvalRequests)
+            bool InitializeConfigBuilder(MetricsConfigBuilder& configBuilder) const
             {
-                NVPA_RawMetricsConfig* pRawMetricsConfig = sampler::DeviceCreateRawMetricsConfig(chipName.c_str());
+                NVPA_RawMetricsConfig* pRawMetricsConfig = sampler::DeviceCreateRawMetricsConfig(m_chipName.c_str());
                 if (!pRawMetricsConfig)
                 {
                     return false;
                 }
-                if (!m_configBuilder.Initialize(metricsEvaluator, pRawMetricsConfig, chipName.c_str()))
+                if (!configBuilder.Initialize(*m_pMetricsEvaluator, pRawMetricsConfig, m_chipName.c_str()))
                 {
                     return false;
                 }
-                m_pMetricsEvaluator = &metricsEvaluator;
-                m_pMetricEvalRequests = &metricEvalRequests;
                 return true;
             }
 
-            // returns the relative metric index as in the scheduled metrics array, or "~0" if the input metric is invalid
-            size_t AddMetric(const std::string& metric, const NVPW_MetricEvalRequest* pRequest_ = nullptr)
+            static uint64_t PackRequest(const NVPW_MetricEvalRequest& request)
             {
-                const size_t InvalidIndex = (size_t)~0;
+                return ((uint64_t)request.metricIndex << 32) | ((uint64_t)request.metricType << 24) | ((uint64_t)request.rollupOp << 16) | request.submetric;
+            }
 
-                const auto itr = m_metricNameToIndex.find(metric);
-                if (itr != m_metricNameToIndex.end())
+            const NVPW_MetricEvalRequest* ResolveRequest(const std::string& metric, const NVPW_MetricEvalRequest* pRequest, NVPW_MetricEvalRequest& request) const
+            {
+                if (pRequest)
                 {
-                    return itr->second;
+                    return pRequest;
+                }
+                if (!m_pMetricNameIndex->ToMetricEvalRequest(metric.c_str(), request) && !ToMetricEvalRequest(*m_pMetricsEvaluator, metric.c_str(), request))
+                {
+                    return nullptr;
                 }
+                return &request;
+            }
+
+            size_t AppendMetric(const std::string& metric, const NVPW_MetricEvalRequest& request)
+            {
+                m_pMetricEvalRequests->push_back(request);
+                m_metricNames.push_back(metric);
+                const size_t metricIndex = m_pMetricEvalRequests->size() - 1;
+                m_requestToIndex.insert(std::make_pair(PackRequest(request), metricIndex));
+                return metricIndex;
+            }
+
+        public:
+            CounterConfigBuilder()
+                : m_pMetricsEvaluator()
+                , m_pMetricNameIndex()
+                , m_pMetricEvalRequests()
+                , m_pCache()
+            {
+            }
+
+            static const char* GetCounterConfigurationKind()
+            {
+                return "DevicePeriodicSampler";
+            }
 
+            // Metrics are only checked against the raw metrics config by GenerateCounterConfiguration(), and with an enabled "pCache" only if
+            // the cache misses, so that a hit neither creates an NVPA_RawMetricsConfig nor resolves raw dependencies. Either way a preset
+            // keeps the same metrics.
+            bool Initialize(const std::string& chipName, MetricsEvaluator& metricsEvaluator, const MetricNameIndex& metricNameIndex, std::vector<NVPW_MetricEvalRequest>& metricEvalRequests, const CounterConfigurationCache* pCache = nullptr)
+            {
+                m_chipName = chipName;
+                m_pMetricsEvaluator = &metricsEvaluator;
+                m_pMetricNameIndex = &metricNameIndex;
+                m_pMetricEvalRequests = &metricEvalRequests;
+                m_pCache = (pCache && pCache->IsEnabled()) ? pCache : nullptr;
+                return true;
+            }
+
+            // returns the relative metric index as in the scheduled metrics array, or "~0" if the input metric is unknown; GenerateCounterConfiguration()
+            // fails if the metric turns out not to be collectable
+            size_t AddMetric(const std::string& metric, const NVPW_MetricEvalRequest* pRequest_ = nullptr)
+            {
                 NVPW_MetricEvalRequest request;
-                const NVPW_MetricEvalRequest* pRequest;
-                if (pRequest_)
+                const NVPW_MetricEvalRequest* pRequest = ResolveRequest(metric, pRequest_, request);
+                if (!pRequest)
                 {
-                    pRequest = pRequest_;
+                    return (size_t)~0;
                 }
-                else
+
+                const auto itr = m_requestToIndex.find(PackRequest(*pRequest));
+                if (itr != m_requestToIndex.end())
                 {
-                    if (!ToMetricEvalRequest(*m_pMetricsEvaluator, metric.c_str(), request))
-                    {
-                        return InvalidIndex;
-                    }
-                    pRequest = &request;
+                    return itr->second;
                 }
+                return AppendMetric(metric, *pRequest);
+            }
 
-                if (!m_configBuilder.AddMetrics(pRequest, 1))
+            // Like AddMetric(), but a metric that is not collectable is dropped instead of failing the configuration. Optional metrics are
+            // scheduled after all others, their index is returned by GetOptionalMetricIndex(handle) once GenerateCounterConfiguration() succeeded.
+            // Returns "~0" if the metric is unknown.
+            size_t AddOptionalMetric(const std::string& metric, const NVPW_MetricEvalRequest* pRequest_ = nullptr)
+            {
+                NVPW_MetricEvalRequest request;
+                const NVPW_MetricEvalRequest* pRequest = ResolveRequest(metric, pRequest_, request);
+                if (!pRequest)
                 {
-                    return InvalidIndex;
+                    return (size_t)~0;
                 }
+                m_optionalMetrics.push_back(OptionalMetric{ metric, *pRequest, (size_t)~0 });
+                return m_optionalMetrics.size() - 1;
+            }
 
-                m_pMetricEvalRequests->push_back(*pRequest);
-                const size_t metricIndex = m_pMetricEvalRequests->size() - 1;
-                m_metricNameToIndex.insert(std::make_pair(metric, metricIndex));
-                return metricIndex;
+            // returns the relative metric index as in the scheduled metrics array, or "~0" if the metric was dropped
+            size_t GetOptionalMetricIndex(size_t handle) const
+            {
+                return (handle < m_optionalMetrics.size()) ? m_optionalMetrics[handle].metricIndex : (size_t)~0;
             }
 
             bool GenerateCounterConfiguration(CounterConfiguration& counterConfiguration)
             {
-                if (!CreateConfiguration(m_configBuilder, counterConfiguration))
+                auto scheduleOptionalMetrics = [&](const std::function<bool(const NVPW_MetricEvalRequest&)>& isCollectable) {
+                    for (OptionalMetric& optionalMetric : m_optionalMetrics)
+                    {
+                        const auto itr = m_requestToIndex.find(PackRequest(optionalMetric.request));
+                        if (itr != m_requestToIndex.end())
+                        {
+                            optionalMetric.metricIndex = itr->second;
+                        }
+                        else if (isCollectable(optionalMetric.request))
+                        {
+                            optionalMetric.metricIndex = AppendMetric(optionalMetric.name, optionalMetric.request);
+                        }
+                    }
+                };
+
+                // entries are keyed by the metrics they collect, so a hit means that none of these metrics is dropped
+                bool found = false;
+                if (m_pCache)
                 {
-                    return false;
+                    std::vector<NVPW_MetricEvalRequest> metricEvalRequests = *m_pMetricEvalRequests;
+                    for (const OptionalMetric& optionalMetric : m_optionalMetrics)
+                    {
+                        metricEvalRequests.push_back(optionalMetric.request);
+                    }
+                    const std::string key = CounterConfigurationCache::MakeKey(m_chipName.c_str(), GetCounterConfigurationKind(), metricEvalRequests.data(), metricEvalRequests.size());
+                    found = m_pCache->Find(key, counterConfiguration);
+                    if (found)
+                    {
+                        scheduleOptionalMetrics([](const NVPW_MetricEvalRequest&) { return true; });
+                    }
+                }
+                if (!found)
+                {
+                    MetricsConfigBuilder configBuilder;
+                    if (!InitializeConfigBuilder(configBuilder))
+                    {
+                        return false;
+                    }
+                    for (size_t metricIndex = 0; metricIndex < m_pMetricEvalRequests->size(); ++metricIndex)
+                    {
+                        if (!configBuilder.AddMetrics(&(*m_pMetricEvalRequests)[metricIndex], 1))
+                        {
+                            NV_PERF_LOG_ERR(20, "Cannot collect metric: %s\n", m_metricNames[metricIndex].c_str());
+                            return false;
+                        }
+                    }
+                    scheduleOptionalMetrics([&](const NVPW_MetricEvalRequest& request) {
+                        return configBuilder.AddMetrics(&request, 1);
+                    });
+                    if (!CreateConfiguration(configBuilder, counterConfiguration))
+                    {
+                        return false;
+                    }
+                    if (m_pCache)
+                    {
+                        const std::string key = CounterConfigurationCache::MakeKey(m_chipName.c_str(), GetCounterConfigurationKind(), m_pMetricEvalRequests->data(), m_pMetricEvalRequests->size());
+                        m_pCache->Store(key, counterConfiguration); // a failure only costs the next run the scheduling
+                    }
                 }
                 if (counterConfiguration.numPasses != 1u)
                 {
@@ -1960,28 +4001,121 @@ namespace nv { namespace perf { namespace hud {
                 return true;
             }
         };
+
+        struct MetricColumn
+        {
+            size_t column;
+            size_t metricIndex;
+        };
+
+        // the stacked values of one TimePlot, column "firstColumn + i" holds the sum of signals [i, n)
+        struct StackedColumns
+        {
+            std::vector<size_t> sourceColumns; // one per signal
+            size_t firstColumn;
+        };
+
+        struct ExternalSource
+        {
+            ExternalSignalSource* pSource;
+            ExternalSignalHistory history;
+            size_t firstValue; // of its signals in m_externalValues
+        };
+
     private:
         std::string m_chipName;
         std::vector<HudConfiguration> m_configurations;
         RingBuffer<double> m_timestampBuffer;
+        MetricHistory m_sampleHistory;                     // per-sample values of all TimePlot signals, one column per metric
+        std::vector<MetricColumn> m_sampleMetricColumns;
+        std::vector<StackedColumns> m_stackedColumns;
+        MetricHistory m_frameLevelHistory;                 // the latest frame-level value of all ScalarText signals, one column per metric
+        std::vector<MetricColumn> m_frameLevelMetricColumns;
+        std::vector<MetricSignal*> m_frameLevelMaxValueSignals; // ScalarText signals whose max value is queried per frame
+        std::vector<ExternalSource> m_externalSources;
+        std::vector<double> m_externalValues;              // all external signals at the time of the latest sample or frame
+        std::vector<MetricColumn> m_sampleExternalColumns; // like m_sampleMetricColumns, but "metricIndex" indexes m_externalValues
+        std::vector<MetricColumn> m_frameLevelExternalColumns;
+        bool m_enableSignalStatistics;
+        MetricStatisticsOptions m_signalStatisticsOptions;
+        MetricStatistics m_sampleStatistics;               // of the per-metric columns of m_sampleHistory
+        MetricStatistics m_frameLevelStatistics;           // of m_frameLevelHistory
 
         MetricsEvaluator m_metricsEvaluator;
+        MetricNameIndex m_metricNameIndex;                 // names only, the properties of the few metrics used are queried once per name
         std::vector<NVPW_MetricEvalRequest> m_metricEvalRequests;
         CounterConfiguration m_counterConfiguration;
         SampleProcessor m_sampleProcessor;
         uint64_t m_firstSampleTime;
         RingBuffer<uint64_t> m_pendingFrames;
         size_t m_pendingFramesReadIndex;
+        std::unique_ptr<TimeSeriesWriter> m_pSampleExport;
+        HudPresetCache* m_pPresetCache;                   // from the loaded presets, if any
+        const CounterConfigurationCache* m_pCounterConfigurationCache;
         bool m_isInitialized;
 
     public:
         HudDataModel()
-            : m_firstSampleTime()
+            : m_enableSignalStatistics()
+            , m_firstSampleTime()
             , m_pendingFramesReadIndex()
+            , m_pPresetCache()
+            , m_pCounterConfigurationCache()
             , m_isInitialized()
         {
         }
 
+        // Optional, must be called before Initialize(). "pCache" must outlive Initialize().
+        void SetCounterConfigurationCache(const CounterConfigurationCache* pCache)
+        {
+            m_pCounterConfigurationCache = pCache;
+        }
+
+        // Optional, must be called before Initialize(). Makes every signal keep session-long statistics in MetricSignal::statistics.
+        bool EnableSignalStatistics(const MetricStatisticsOptions& options = MetricStatisticsOptions())
+        {
+            if (IsInitialized())
+            {
+                NV_PERF_LOG_ERR(20, "Already initialized\n");
+                return false;
+            }
+            m_enableSignalStatistics = true;
+            m_signalStatisticsOptions = options;
+            return true;
+        }
+
+        // Optional, must be called before Initialize(). Signals of presets whose metric names one of the source's signals are fed from
+        // "source" instead of the GPU: each sample and frame takes the latest external values polled at or before its end time.
+        // "source" must be initialized, and must outlive this model; it can be started and stopped at any time.
+        bool AddExternalSignalSource(ExternalSignalSource& source)
+        {
+            if (IsInitialized())
+            {
+                NV_PERF_LOG_ERR(20, "Already initialized\n");
+                return false;
+            }
+            if (!source.IsInitialized())
+            {
+                NV_PERF_LOG_ERR(20, "External signal source is not initialized\n");
+                return false;
+            }
+            for (const ExternalSignalDesc& desc : source.GetSignals())
+            {
+                if (FindExternalSignal(desc.name))
+                {
+                    NV_PERF_LOG_ERR(20, "Duplicate external signal \"%s\"\n", desc.name.c_str());
+                    return false;
+                }
+            }
+            ExternalSource externalSource;
+            externalSource.pSource = &source;
+            externalSource.history.Initialize(source.GetSignals().size(), source.GetMaxQueuedSamples());
+            externalSource.firstValue = m_externalValues.size();
+            m_externalValues.resize(m_externalValues.size() + source.GetSignals().size(), 0.0);
+            m_externalSources.emplace_back(std::move(externalSource));
+            return true;
+        }
+
         bool Load(const HudPreset& preset)
         {
             if (IsInitialized())
@@ -2008,6 +4142,28 @@ namespace nv { namespace perf { namespace hud {
                 }
             }
 
+            if (preset.pCache)
+            {
+                m_pPresetCache = preset.pCache;
+                HudBlobReader reader;
+                if (preset.pCache->FindConfiguration(preset.name, reader))
+                {
+                    bool valid;
+                    HudConfiguration configuration = HudConfiguration::FromBlob(reader, &valid);
+                    if (valid && !reader.GetNumRemainingBytes())
+                    {
+                        m_configurations.emplace_back(std::move(configuration));
+                        return true;
+                    }
+                    NV_PERF_LOG_WRN(50, "Cached configuration \"%s\" is corrupt, loading it from YAML\n", preset.name.c_str());
+                }
+            }
+            if (!preset.pYaml)
+            {
+                NV_PERF_LOG_ERR(20, "Preset \"%s\" has no YAML source\n", preset.name.c_str());
+                return false;
+            }
+
             ScopedRymlErrorHandler customRymlErrorHandler;
 
             ryml::Tree tree = ryml::parse_in_arena(ryml::csubstr(preset.fileName.c_str(), preset.fileName.size()), ryml::csubstr(preset.pYaml, strlen(preset.pYaml)));
@@ -2090,6 +4246,12 @@ namespace nv { namespace perf { namespace hud {
                         return false;
                     }
                     found = true;
+                    if (preset.pCache)
+                    {
+                        HudBlobWriter writer;
+                        configuration.ToBlob(writer);
+                        preset.pCache->AddConfiguration(preset.name, std::move(writer.GetData()));
+                    }
                     m_configurations.emplace_back(configuration);
                     break;
                 }
@@ -2151,25 +4313,98 @@ namespace nv { namespace perf { namespace hud {
                 {
                     return false;
                 }
-                m_metricsEvaluator = MetricsEvaluator(pMetricsEvaluator, std::move(metricsEvaluatorScratchBuffer)); // transfer ownership to metricsEvaluator
-            }
-            CounterConfigBuilder counterConfigBuilder;
-            if (!counterConfigBuilder.Initialize(m_chipName.c_str(), m_metricsEvaluator, m_metricEvalRequests))
-            {
-                return false;
-            }
+                m_metricsEvaluator = MetricsEvaluator(pMetricsEvaluator, std::move(metricsEvaluatorScratchBuffer)); // transfer ownership to metricsEvaluator
+                const bool cacheProperties = false;
+                if (!m_metricNameIndex.Build(m_metricsEvaluator, cacheProperties))
+                {
+                    return false;
+                }
+            }
+            CounterConfigBuilder counterConfigBuilder;
+            if (!counterConfigBuilder.Initialize(m_chipName.c_str(), m_metricsEvaluator, m_metricNameIndex, m_metricEvalRequests, m_pCounterConfigurationCache))
+            {
+                return false;
+            }
+
+            // every metric name is queried from the MetricsEvaluator once, and the results are kept in the preset cache if there is one
+            std::unordered_map<std::string, HudResolvedMetric> resolvedMetrics;
+            auto storeResolvedMetric = [&](const std::string& metric, const HudResolvedMetric& resolved) -> const HudResolvedMetric& {
+                if (m_pPresetCache)
+                {
+                    m_pPresetCache->AddMetric(metric, resolved);
+                    return *m_pPresetCache->FindMetric(metric);
+                }
+                HudResolvedMetric& stored = resolvedMetrics[metric];
+                stored = resolved;
+                return stored;
+            };
+            auto resolveMetric = [&](const std::string& metric) -> const HudResolvedMetric& {
+                const HudResolvedMetric* pResolved = nullptr;
+                if (m_pPresetCache)
+                {
+                    pResolved = m_pPresetCache->FindMetric(metric);
+                }
+                else
+                {
+                    const auto itr = resolvedMetrics.find(metric);
+                    pResolved = (itr != resolvedMetrics.end()) ? &itr->second : nullptr;
+                }
+                if (pResolved)
+                {
+                    return *pResolved;
+                }
+
+                HudResolvedMetric resolved;
+                NVPW_MetricType metricType;
+                size_t nativeMetricIndex;
+                if (GetMetricTypeAndIndex(m_metricNameIndex, m_metricsEvaluator, metric.c_str(), metricType, nativeMetricIndex))
+                {
+                    resolved.flags |= HudResolvedMetric::HasTypeAndIndex;
+                    const char* pDescription = m_metricNameIndex.GetMetricDescription(metricType, nativeMetricIndex);
+                    if (pDescription)
+                    {
+                        resolved.flags |= HudResolvedMetric::HasDescription;
+                        resolved.description = pDescription;
+                    }
+                }
+                if (m_metricNameIndex.ToMetricEvalRequest(metric.c_str(), resolved.request) || ToMetricEvalRequest(m_metricsEvaluator, metric.c_str(), resolved.request))
+                {
+                    resolved.flags |= HudResolvedMetric::HasRequest;
+                    std::vector<NVPW_DimUnitFactor> dimUnitFactors;
+                    if (m_metricNameIndex.GetMetricDimUnits(resolved.request, dimUnitFactors))
+                    {
+                        std::string dimUnits = nv::perf::ToString(dimUnitFactors, [&](NVPW_DimUnitName dimUnit, bool plural) {
+                            return ToCString(m_metricsEvaluator, dimUnit, plural);
+                        });
+
+                        std::map<std::string, std::string> renameUnit
+                        {
+                            {"percent", "%"}
+                        };
+                        if (renameUnit.find(dimUnits) != renameUnit.end())
+                        {
+                            dimUnits = renameUnit[dimUnits];
+                        }
+
+                        resolved.flags |= HudResolvedMetric::HasUnit;
+                        resolved.unit = dimUnits;
+                    }
+                }
+                return storeResolvedMetric(metric, resolved);
+            };
+            auto getMetricEvalRequest = [&](const std::string& metric) -> const NVPW_MetricEvalRequest* {
+                const HudResolvedMetric& resolved = resolveMetric(metric);
+                return (resolved.flags & HudResolvedMetric::HasRequest) ? &resolved.request : nullptr;
+            };
 
             auto setSignalDescription = [&](MetricSignal& signal)
             {
-                NVPW_MetricType metricType;
-                size_t nativeMetricIndex;
-                bool success = GetMetricTypeAndIndex(m_metricsEvaluator, signal.metric.c_str(), metricType, nativeMetricIndex);
-                if (success)
+                const HudResolvedMetric& resolved = resolveMetric(signal.metric);
+                if (resolved.flags & HudResolvedMetric::HasTypeAndIndex)
                 {
-                    const char* pDescription = GetMetricDescription(m_metricsEvaluator, metricType, nativeMetricIndex);
-                    if (pDescription)
+                    if (resolved.flags & HudResolvedMetric::HasDescription)
                     {
-                        signal.description = pDescription;
+                        signal.description = resolved.description;
                     }
                     else if (signal.description.empty())
                     {
@@ -2189,31 +4424,15 @@ namespace nv { namespace perf { namespace hud {
                     return;
                 }
 
-                NVPW_MetricEvalRequest request;
-                bool success = ToMetricEvalRequest(m_metricsEvaluator, signal.metric.c_str(), request);
-                if (!success)
+                const HudResolvedMetric& resolved = resolveMetric(signal.metric);
+                if (!(resolved.flags & HudResolvedMetric::HasRequest))
                 {
                     NV_PERF_LOG_WRN(50, "Could not create MetricEvalRequest for %s\n", signal.metric.c_str());
                 }
 
-                std::vector<NVPW_DimUnitFactor> dimUnitFactors;
-                success = GetMetricDimUnits(m_metricsEvaluator, request, dimUnitFactors);
-                if (success)
+                if (resolved.flags & HudResolvedMetric::HasUnit)
                 {
-                    std::string dimUnits = nv::perf::ToString(dimUnitFactors, [&](NVPW_DimUnitName dimUnit, bool plural) {
-                        return ToCString(m_metricsEvaluator, dimUnit, plural);
-                    });
-
-                    std::map<std::string, std::string> renameUnit
-                    {
-                        {"percent", "%"}
-                    };
-                    if (renameUnit.find(dimUnits) != renameUnit.end())
-                    {
-                        dimUnits = renameUnit[dimUnits];
-                    }
-
-                    signal.unit = dimUnits;
+                    signal.unit = resolved.unit;
                 }
                 else
                 {
@@ -2221,7 +4440,9 @@ namespace nv { namespace perf { namespace hud {
                 }
             };
 
-            // sets maxValue statically if possible, otherwise registers metricIndexMaxValue to query the value per sample/frame
+            // sets maxValue statically if possible, otherwise schedules the max metric to query the value per frame; metricIndexMaxValue is set once
+            // the counter configuration is generated, as a max metric that cannot be collected is dropped
+            std::vector<std::pair<MetricSignal*, size_t>> maxValueSignals; // with the handle of the max metric
             auto setSignalMaxValue = [&](MetricSignal& signal) -> bool {
                 if (!std::isnan(signal.maxValue))
                 {
@@ -2230,12 +4451,13 @@ namespace nv { namespace perf { namespace hud {
 
                 const std::string& metric = signal.metric;
 
-                NVPW_MetricEvalRequest request;
-                if (!ToMetricEvalRequest(m_metricsEvaluator, metric.c_str(), request))
+                const HudResolvedMetric& resolved = resolveMetric(metric);
+                if (!(resolved.flags & HudResolvedMetric::HasRequest))
                 {
                     NV_PERF_LOG_ERR(20, "Unknown metric: %s\n", metric.c_str());
                     return false;
                 }
+                const NVPW_MetricEvalRequest request = resolved.request;
 
                 NVPW_MetricEvalRequest maxRequest{ (size_t)~0 };
                 if (NVPW_MetricType(request.metricType) == NVPW_METRIC_TYPE_THROUGHPUT)
@@ -2297,18 +4519,81 @@ namespace nv { namespace perf { namespace hud {
 
                 if (maxRequest.metricIndex != (size_t)~0)
                 {
-                    std::string maxMetric = ToString(m_metricsEvaluator, maxRequest);
-                    const size_t metricIndexMaxValue = counterConfigBuilder.AddMetric(maxMetric, &maxRequest);
-                    if (metricIndexMaxValue == (size_t)~0)
+                    if (!(resolved.flags & HudResolvedMetric::HasMaxMetric))
+                    {
+                        HudResolvedMetric withMaxMetric = resolved;
+                        withMaxMetric.flags |= HudResolvedMetric::HasMaxMetric;
+                        withMaxMetric.maxMetric = ToString(m_metricsEvaluator, maxRequest);
+                        storeResolvedMetric(metric, withMaxMetric);
+                    }
+                    const std::string maxMetric = resolveMetric(metric).maxMetric;
+                    const size_t handle = counterConfigBuilder.AddOptionalMetric(maxMetric, &maxRequest);
+                    if (handle == (size_t)~0)
                     {
                         NV_PERF_LOG_WRN(50, "Failed configuring max metric %s for %s\n", maxMetric.c_str(), metric.c_str());
                     }
-                    signal.SetMetricIndexMaxValue(metricIndexMaxValue);
+                    else
+                    {
+                        maxValueSignals.push_back(std::make_pair(&signal, handle));
+                    }
                 }
 
                 return true;
             };
 
+            // GPU metrics and external signals share the columns of each history, but are indexed separately
+            auto getColumn = [](std::map<size_t, size_t>& indexToColumn, std::vector<MetricColumn>& columns, size_t& numColumns, size_t index) {
+                auto insertResult = indexToColumn.insert(std::make_pair(index, numColumns));
+                if (insertResult.second)
+                {
+                    columns.push_back(MetricColumn{ numColumns, index });
+                    ++numColumns;
+                }
+                return insertResult.first->second;
+            };
+            std::map<size_t, size_t> sampleMetricIndexToColumn;
+            std::map<size_t, size_t> sampleExternalIndexToColumn;
+            size_t numSampleColumns = 0;
+            auto getSampleColumn = [&](size_t metricIndex) {
+                return getColumn(sampleMetricIndexToColumn, m_sampleMetricColumns, numSampleColumns, metricIndex);
+            };
+            auto getSampleExternalColumn = [&](size_t externalIndex) {
+                return getColumn(sampleExternalIndexToColumn, m_sampleExternalColumns, numSampleColumns, externalIndex);
+            };
+            std::map<size_t, size_t> frameLevelMetricIndexToColumn;
+            std::map<size_t, size_t> frameLevelExternalIndexToColumn;
+            size_t numFrameLevelColumns = 0;
+            auto getFrameLevelColumn = [&](size_t metricIndex) {
+                return getColumn(frameLevelMetricIndexToColumn, m_frameLevelMetricColumns, numFrameLevelColumns, metricIndex);
+            };
+            auto getFrameLevelExternalColumn = [&](size_t externalIndex) {
+                return getColumn(frameLevelExternalIndexToColumn, m_frameLevelExternalColumns, numFrameLevelColumns, externalIndex);
+            };
+
+            // returns the index into m_externalValues, or "~0" if "signal" is a GPU metric
+            auto bindExternalSignal = [&](MetricSignal& signal) -> size_t {
+                size_t externalIndex = 0;
+                const ExternalSignalDesc* pDesc = FindExternalSignal(signal.metric, &externalIndex);
+                if (!pDesc)
+                {
+                    return (size_t)~0;
+                }
+                if (signal.description.empty())
+                {
+                    signal.description = pDesc->description;
+                }
+                if (signal.unit.empty())
+                {
+                    signal.unit = pDesc->unit;
+                }
+                if (std::isnan(signal.maxValue))
+                {
+                    signal.SetMaxValue(pDesc->maxValue);
+                }
+                signal.SetMetricIndex((size_t)~0);
+                return externalIndex;
+            };
+
             for (auto& configuration : m_configurations)
             {
                 for (auto& panel : configuration.panels)
@@ -2320,15 +4605,31 @@ namespace nv { namespace perf { namespace hud {
                             ScalarText& scalarText = *static_cast<ScalarText*>(pWidget.get());
                             MetricSignal& signal = scalarText.signal;
                             signal.SetMaxNumSamples(1);
+                            const size_t externalIndex = bindExternalSignal(signal);
+                            if (externalIndex != (size_t)~0)
+                            {
+                                const size_t column = getFrameLevelExternalColumn(externalIndex);
+                                signal.SetHistory(&m_frameLevelHistory, column);
+                                if (m_enableSignalStatistics)
+                                {
+                                    signal.SetStatistics(&m_frameLevelStatistics, column);
+                                }
+                                continue;
+                            }
                             setSignalDescription(signal);
                             setSignalUnit(signal);
-                            const size_t metricIndex = counterConfigBuilder.AddMetric(signal.metric);
+                            const size_t metricIndex = counterConfigBuilder.AddMetric(signal.metric, getMetricEvalRequest(signal.metric));
                             if (metricIndex == (size_t)~0)
                             {
                                 NV_PERF_LOG_ERR(20, "Unknown metric: %s\n", signal.metric.c_str());
                                 return false;
                             }
                             signal.SetMetricIndex(metricIndex);
+                            signal.SetHistory(&m_frameLevelHistory, getFrameLevelColumn(metricIndex));
+                            if (m_enableSignalStatistics)
+                            {
+                                signal.SetStatistics(&m_frameLevelStatistics, getFrameLevelColumn(metricIndex));
+                            }
 
                             if (scalarText.showValue == ScalarText::ShowValue::ValueWithMax)
                             {
@@ -2346,35 +4647,100 @@ namespace nv { namespace perf { namespace hud {
                             timePlot.SetTimestampBuffer(&m_timestampBuffer);
                             timePlot.SetTimeWidth(plotTimeWidthInSeconds);
 
+                            StackedColumns stackedColumns;
                             for (size_t index = 0; index < timePlot.signals.size(); ++index)
                             {
                                 MetricSignal& signal = timePlot.signals[index];
                                 signal.SetMaxNumSamples(maxNumSamples);
-                                setSignalDescription(signal);
-                                setSignalUnit(signal);
-                                const size_t metricIndex = counterConfigBuilder.AddMetric(signal.metric);
-                                if (metricIndex == (size_t)~0)
+                                const size_t externalIndex = bindExternalSignal(signal);
+                                size_t column = 0;
+                                if (externalIndex != (size_t)~0)
                                 {
-                                    NV_PERF_LOG_ERR(20, "Unknown metric: %s\n", signal.metric.c_str());
-                                    return false;
+                                    column = getSampleExternalColumn(externalIndex);
+                                }
+                                else
+                                {
+                                    setSignalDescription(signal);
+                                    setSignalUnit(signal);
+                                    const size_t metricIndex = counterConfigBuilder.AddMetric(signal.metric, getMetricEvalRequest(signal.metric));
+                                    if (metricIndex == (size_t)~0)
+                                    {
+                                        NV_PERF_LOG_ERR(20, "Unknown metric: %s\n", signal.metric.c_str());
+                                        return false;
+                                    }
+                                    signal.SetMetricIndex(metricIndex);
+                                    column = getSampleColumn(metricIndex);
+                                }
+                                signal.SetHistory(&m_sampleHistory, column);
+                                if (m_enableSignalStatistics)
+                                {
+                                    signal.SetStatistics(&m_sampleStatistics, column);
                                 }
-                                signal.SetMetricIndex(metricIndex);
 
                                 if (timePlot.chartType == TimePlot::ChartType::Stacked)
                                 {
                                     MetricSignal& stackedSignal = timePlot.stackedSignals[index];
                                     stackedSignal.SetMaxNumSamples(maxNumSamples);
-                                    setSignalDescription(stackedSignal);
-                                    setSignalUnit(signal);
-                                    const size_t metricIndex = counterConfigBuilder.AddMetric(stackedSignal.metric);
-                                    if (metricIndex == (size_t)~0)
+                                    if (bindExternalSignal(stackedSignal) == (size_t)~0)
                                     {
-                                        NV_PERF_LOG_ERR(20, "Unknown metric: %s\n", stackedSignal.metric.c_str());
-                                        return false;
+                                        setSignalDescription(stackedSignal);
+                                        setSignalUnit(signal);
+                                        const size_t metricIndex = counterConfigBuilder.AddMetric(stackedSignal.metric, getMetricEvalRequest(stackedSignal.metric));
+                                        if (metricIndex == (size_t)~0)
+                                        {
+                                            NV_PERF_LOG_ERR(20, "Unknown metric: %s\n", stackedSignal.metric.c_str());
+                                            return false;
+                                        }
+                                        stackedSignal.SetMetricIndex(metricIndex);
                                     }
-                                    stackedSignal.SetMetricIndex(metricIndex);
+                                    stackedColumns.sourceColumns.push_back(column);
                                 }
                             }
+                            if (!stackedColumns.sourceColumns.empty())
+                            {
+                                m_stackedColumns.emplace_back(std::move(stackedColumns));
+                            }
+                        }
+                    }
+                }
+            }
+
+            if (m_enableSignalStatistics)
+            {
+                m_sampleStatistics.Initialize(numSampleColumns, m_signalStatisticsOptions);
+                m_frameLevelStatistics.Initialize(numFrameLevelColumns, m_signalStatisticsOptions);
+            }
+
+            // stacked columns follow the per-metric columns, a stacked plot does not share its sums with other plots
+            for (StackedColumns& stackedColumns : m_stackedColumns)
+            {
+                stackedColumns.firstColumn = numSampleColumns;
+                numSampleColumns += stackedColumns.sourceColumns.size();
+            }
+            m_sampleHistory.Initialize(numSampleColumns, maxNumSamples);
+            m_frameLevelHistory.Initialize(numFrameLevelColumns, 1);
+            {
+                size_t stackedPlotIndex = 0;
+                for (auto& configuration : m_configurations)
+                {
+                    for (auto& panel : configuration.panels)
+                    {
+                        for (std::unique_ptr<Widget>& pWidget : panel.widgets)
+                        {
+                            if (pWidget->type != Widget::Type::TimePlot)
+                            {
+                                continue;
+                            }
+                            TimePlot& timePlot = *static_cast<TimePlot*>(pWidget.get());
+                            if (timePlot.chartType != TimePlot::ChartType::Stacked || timePlot.stackedSignals.empty())
+                            {
+                                continue;
+                            }
+                            const StackedColumns& stackedColumns = m_stackedColumns[stackedPlotIndex++];
+                            for (size_t index = 0; index < timePlot.stackedSignals.size(); ++index)
+                            {
+                                timePlot.stackedSignals[index].SetHistory(&m_sampleHistory, stackedColumns.firstColumn + index);
+                            }
                         }
                     }
                 }
@@ -2384,6 +4750,18 @@ namespace nv { namespace perf { namespace hud {
             {
                 return false;
             }
+            for (const auto& signalAndHandle : maxValueSignals)
+            {
+                MetricSignal& signal = *signalAndHandle.first;
+                const size_t metricIndexMaxValue = counterConfigBuilder.GetOptionalMetricIndex(signalAndHandle.second);
+                if (metricIndexMaxValue == (size_t)~0)
+                {
+                    NV_PERF_LOG_WRN(50, "Failed configuring max metric %s for %s\n", resolveMetric(signal.metric).maxMetric.c_str(), signal.metric.c_str());
+                    continue;
+                }
+                signal.SetMetricIndexMaxValue(metricIndexMaxValue);
+                m_frameLevelMaxValueSignals.push_back(&signal);
+            }
 
             m_isInitialized = true;
 
@@ -2405,6 +4783,18 @@ namespace nv { namespace perf { namespace hud {
             return m_counterConfiguration;
         }
 
+        // the metrics GetCounterConfiguration() collects, in the order of the per-sample metric values
+        const std::vector<NVPW_MetricEvalRequest>& GetMetricEvalRequests() const
+        {
+            return m_metricEvalRequests;
+        }
+
+        // the CounterConfigurationCache key of GetCounterConfiguration()
+        std::string GetCounterConfigurationCacheKey() const
+        {
+            return CounterConfigurationCache::MakeKey(m_chipName.c_str(), CounterConfigBuilder::GetCounterConfigurationKind(), m_metricEvalRequests.data(), m_metricEvalRequests.size());
+        }
+
         bool PrepareSampleProcessing(const std::vector<uint8_t>& counterData)
         {
             if (!IsInitialized())
@@ -2456,43 +4846,30 @@ namespace nv { namespace perf { namespace hud {
 
         void AddFrameLevelValues(uint64_t frameEndTime, const std::vector<double>& metricValues)
         {
-            for (auto& configuration : m_configurations)
+            WriteMetricColumns(m_frameLevelHistory, m_frameLevelMetricColumns, metricValues);
+            if (!m_frameLevelExternalColumns.empty())
             {
-                for (auto& panel : configuration.panels)
-                {
-                    for (std::unique_ptr<Widget>& pWidget : panel.widgets)
-                    {
-                        if (pWidget->type == Widget::Type::ScalarText)
-                        {
-                            ScalarText& scalarText = *static_cast<ScalarText*>(pWidget.get());
-
-                            double value = 0.0;
-                            if (scalarText.signal.metricIndex < metricValues.size())
-                            {
-                                value = (std::max)(0.0, metricValues[scalarText.signal.metricIndex]);
-                            }
-                            else
-                            {
-                                NV_PERF_LOG_WRN(50, "metricValues has too few entries. metricIndex (%zu) >= metricValues.size (%zu)\n", scalarText.signal.metricIndex, metricValues.size());
-                            }
-                            scalarText.signal.AddSample(value);
+                UpdateExternalValues(frameEndTime);
+                WriteMetricColumns(m_frameLevelHistory, m_frameLevelExternalColumns, m_externalValues);
+            }
+            if (m_enableSignalStatistics)
+            {
+                m_frameLevelStatistics.AddRow(double(frameEndTime) / 1000000000.0, m_frameLevelHistory);
+            }
+            m_frameLevelHistory.CommitRow();
 
-                            if (scalarText.signal.metricIndexMaxValue != (size_t)~0)
-                            {
-                                double maxValue = 0.0;
-                                if (scalarText.signal.metricIndexMaxValue < metricValues.size())
-                                {
-                                    maxValue = (std::max)(0.0, metricValues[scalarText.signal.metricIndexMaxValue]);
-                                }
-                                else
-                                {
-                                    NV_PERF_LOG_WRN(50, "metricValues has too few entries. metricIndexMaxValue (%zu) >= metricValues.size (%zu)\n", scalarText.signal.metricIndexMaxValue, metricValues.size());
-                                }
-                                scalarText.signal.SetMaxValue(maxValue);
-                            }
-                        }
-                    }
+            for (MetricSignal* pSignal : m_frameLevelMaxValueSignals)
+            {
+                double maxValue = 0.0;
+                if (pSignal->metricIndexMaxValue < metricValues.size())
+                {
+                    maxValue = (std::max)(0.0, metricValues[pSignal->metricIndexMaxValue]);
+                }
+                else
+                {
+                    NV_PERF_LOG_WRN(50, "metricValues has too few entries. metricIndexMaxValue (%zu) >= metricValues.size (%zu)\n", pSignal->metricIndexMaxValue, metricValues.size());
                 }
+                pSignal->SetMaxValue(maxValue);
             }
         }
 
@@ -2509,13 +4886,7 @@ namespace nv { namespace perf { namespace hud {
             }
 
             bool success = m_sampleProcessor.GetSampleValues(pCounterDataImage, counterDataImageSize, rangeIndex, [&](const sampler::SampleTimestamp& sampleTime, const std::vector<double>& metricValues) {
-                const uint64_t endTimestamp = sampleTime.end;
-                if (!m_firstSampleTime)
-                {
-                    m_firstSampleTime = endTimestamp;
-                }
-                const double timestamp = (endTimestamp - m_firstSampleTime) / double(1000000000);
-                AddSample(timestamp, metricValues);
+                AddSample(sampleTime, metricValues);
                 return true;
             });
             if (!success)
@@ -2525,45 +4896,239 @@ namespace nv { namespace perf { namespace hud {
             return true;
         }
 
-        // Note: Incoming values are clamped to a minimum of 0
+        // Adds one evaluated sample whose timestamps are in the clock of the periodic sampler. External signals take the values polled
+        // at or before its end time.
+        void AddSample(const sampler::SampleTimestamp& sampleTime, const std::vector<double>& metricValues)
+        {
+            const uint64_t endTimestamp = sampleTime.end;
+            if (!m_firstSampleTime)
+            {
+                m_firstSampleTime = endTimestamp;
+            }
+            const double timestamp = (endTimestamp - m_firstSampleTime) / double(1000000000);
+            if (m_pSampleExport)
+            {
+                m_pSampleExport->AppendRow(endTimestamp, metricValues.data(), metricValues.size());
+            }
+            if (!m_sampleExternalColumns.empty())
+            {
+                UpdateExternalValues(endTimestamp);
+            }
+            AddSample(timestamp, metricValues);
+        }
+
+        // Note: Incoming values are clamped to a minimum of 0. External signals take the values of the latest UpdateExternalValues().
         void AddSample(double timestamp, const std::vector<double>& metricValues)
         {
             m_timestampBuffer.Push(timestamp);
 
-            for (auto& configuration : m_configurations)
+            WriteMetricColumns(m_sampleHistory, m_sampleMetricColumns, metricValues);
+            WriteMetricColumns(m_sampleHistory, m_sampleExternalColumns, m_externalValues);
+            const size_t slot = m_sampleHistory.WriteIndex();
+            for (const StackedColumns& stackedColumns : m_stackedColumns)
             {
-                for (auto& panel : configuration.panels)
+                double accumulatedValue = 0;
+                for (size_t index = stackedColumns.sourceColumns.size(); index-- > 0;)
                 {
-                    for (std::unique_ptr<Widget>& pWidget : panel.widgets)
+                    accumulatedValue += m_sampleHistory.ColumnData(stackedColumns.sourceColumns[index])[slot];
+                    m_sampleHistory.ColumnData(stackedColumns.firstColumn + index)[slot] = accumulatedValue;
+                }
+            }
+            if (m_enableSignalStatistics)
+            {
+                m_sampleStatistics.AddRow(timestamp, m_sampleHistory);
+            }
+            m_sampleHistory.CommitRow();
+        }
+
+        const MetricHistory& GetSampleHistory() const
+        {
+            return m_sampleHistory;
+        }
+
+        // Drains the queues of the external signal sources, and selects their values polled at or before "timestamp", which is in the
+        // clock of the periodic sampler. Called by AddSample() and AddFrameLevelValues(); signals keep their values if nothing was
+        // polled by then.
+        void UpdateExternalValues(uint64_t timestamp)
+        {
+            for (ExternalSource& externalSource : m_externalSources)
+            {
+                externalSource.history.Drain(*externalSource.pSource);
+                const double* pValues = externalSource.history.FindValuesAt(timestamp);
+                if (pValues)
+                {
+                    std::copy(pValues, pValues + externalSource.pSource->GetSignals().size(), m_externalValues.begin() + externalSource.firstValue);
+                }
+            }
+        }
+
+        // returns the external signal named "name", and its index into the external values, or nullptr if no source provides it
+        const ExternalSignalDesc* FindExternalSignal(const std::string& name, size_t* pExternalIndex = nullptr) const
+        {
+            for (const ExternalSource& externalSource : m_externalSources)
+            {
+                const size_t signalIndex = externalSource.pSource->FindSignal(name);
+                if (signalIndex != (size_t)~0)
+                {
+                    if (pExternalIndex)
+                    {
+                        *pExternalIndex = externalSource.firstValue + signalIndex;
+                    }
+                    return &externalSource.pSource->GetSignals()[signalIndex];
+                }
+            }
+            return nullptr;
+        }
+
+        bool IsSignalStatisticsEnabled() const
+        {
+            return m_enableSignalStatistics;
+        }
+
+        // Restarts the signal statistics, e.g. after a change of scene.
+        void ClearSignalStatistics()
+        {
+            m_sampleStatistics.Clear();
+            m_frameLevelStatistics.Clear();
+        }
+
+        // Writes a JSON array with the statistics of every signal, in panel order. Signals of the same metric share their statistics, but
+        // are listed separately, since their labels and multipliers may differ.
+        template <class TSink>
+        void WriteSignalStatistics(JsonWriter<TSink>& writer) const
+        {
+            static const double Quantiles[] = { 0.5, 0.9, 0.95, 0.99 };
+            static const char* const QuantileNames[] = { "p50", "p90", "p95", "p99" };
+            bool firstSignal = true;
+            auto writeSignal = [&](const Panel& panel, const MetricSignal& signal) {
+                const MetricStatisticsView& statistics = signal.statistics;
+                if (!statistics.IsEnabled())
+                {
+                    return;
+                }
+                writer.Raw(firstSignal ? "\n  {" : ",\n  {");
+                firstSignal = false;
+                writer.Raw("\"panel\": ").String(panel.name);
+                writer.Raw(", \"label\": ").String(signal.label.text);
+                writer.Raw(", \"metric\": ").String(signal.metric);
+                writer.Raw(", \"unit\": ").String(signal.unit == MetricSignal::HideUnit() ? std::string() : signal.unit);
+                writer.Raw(", \"count\": ").Integer(int64_t(statistics.Count()));
+                writer.Raw(", \"mean\": ").Double(statistics.Mean());
+                writer.Raw(", \"min\": ").Double(statistics.Min());
+                writer.Raw(", \"max\": ").Double(statistics.Max());
+                for (size_t quantileIndex = 0; quantileIndex < sizeof(Quantiles) / sizeof(Quantiles[0]); ++quantileIndex)
+                {
+                    writer.Raw(", \"").Raw(QuantileNames[quantileIndex]).Raw("\": ").Double(statistics.Quantile(Quantiles[quantileIndex]));
+                }
+                writer.Raw(", \"decayedAverages\": [");
+                for (size_t decayIndex = 0; decayIndex < statistics.NumDecayedAverages(); ++decayIndex)
+                {
+                    writer.Raw(decayIndex ? ", {\"timeConstant\": " : "{\"timeConstant\": ").Double(statistics.DecayTimeConstant(decayIndex));
+                    writer.Raw(", \"value\": ").Double(statistics.DecayedAverage(decayIndex)).Raw('}');
+                }
+                writer.Raw("]}");
+            };
+
+            writer.Raw('[');
+            for (const HudConfiguration& configuration : m_configurations)
+            {
+                for (const Panel& panel : configuration.panels)
+                {
+                    for (const std::unique_ptr<Widget>& pWidget : panel.widgets)
                     {
-                        if (pWidget->type == Widget::Type::TimePlot)
+                        if (pWidget->type == Widget::Type::ScalarText)
                         {
-                            TimePlot& timePlot = *static_cast<TimePlot*>(pWidget.get());
-                    
-                            double accumulatedValue = 0;
-                            for (int index = int(timePlot.signals.size())-1; index >= 0; index -= 1)
+                            writeSignal(panel, static_cast<const ScalarText*>(pWidget.get())->signal);
+                        }
+                        else if (pWidget->type == Widget::Type::TimePlot)
+                        {
+                            for (const MetricSignal& signal : static_cast<const TimePlot*>(pWidget.get())->signals)
                             {
-                                double value = 0.0;
-                                if (timePlot.signals[index].metricIndex < metricValues.size())
-                                {
-                                    value = (std::max)(0.0, metricValues[timePlot.signals[index].metricIndex]);
-                                }
-                                else
-                                {
-                                    NV_PERF_LOG_WRN(50, "metricValues has too few entries. metricIndex (%zu) >= metricValues.size (%zu)\n", timePlot.signals[index].metricIndex, metricValues.size());
-                                }
-                                timePlot.signals[index].AddSample(value);
-                    
-                                if (timePlot.chartType == TimePlot::ChartType::Stacked)
-                                {
-                                    accumulatedValue += value;
-                                    timePlot.stackedSignals[index].AddSample(accumulatedValue);
-                                }
+                                writeSignal(panel, signal);
                             }
                         }
                     }
                 }
             }
+            writer.Raw(firstSignal ? "]\n" : "\n]\n");
+        }
+
+        bool WriteSignalStatisticsFile(const std::string& path) const
+        {
+            if (!m_enableSignalStatistics)
+            {
+                NV_PERF_LOG_ERR(20, "Signal statistics are not enabled\n");
+                return false;
+            }
+            BufferedFileSink sink;
+            if (!sink.Open(path.c_str()))
+            {
+                return false;
+            }
+            JsonWriter<BufferedFileSink> writer(sink);
+            WriteSignalStatistics(writer);
+            if (!sink.Close())
+            {
+                NV_PERF_LOG_ERR(20, "Failed writing %s\n", path.c_str());
+                return false;
+            }
+            return true;
+        }
+
+        // Streams every sample subsequently decoded by AddSample(pCounterDataImage, ...) to a time series file, which can be read back with
+        // TimeSeriesReader: column 0 holds the sample end timestamps in nanoseconds, followed by one column per evaluated metric with its unit.
+        // Values are exported as evaluated, i.e. without the clamping applied to the HUD's history. Writing happens on a background thread.
+        bool StartSampleExport(
+            const std::string& path,
+            TimeSeriesColumnType valueType = TimeSeriesColumnType::Float64,
+            TimeSeriesEncoding valueEncoding = TimeSeriesEncoding::None,
+            size_t maxRowsPerBlock = 1024)
+        {
+            if (!IsInitialized())
+            {
+                NV_PERF_LOG_ERR(20, "Not initialized\n");
+                return false;
+            }
+            StopSampleExport();
+
+            std::vector<TimeSeriesColumnDesc> columns;
+            columns.push_back(TimeSeriesColumnDesc{ "timestamp", "nsecond", TimeSeriesColumnType::UInt64, TimeSeriesEncoding::Delta });
+            for (const NVPW_MetricEvalRequest& request : m_metricEvalRequests)
+            {
+                std::string unit;
+                std::vector<NVPW_DimUnitFactor> dimUnitFactors;
+                if (GetMetricDimUnits(m_metricsEvaluator, request, dimUnitFactors))
+                {
+                    unit = nv::perf::ToString(dimUnitFactors, [&](NVPW_DimUnitName dimUnit, bool plural) {
+                        return ToCString(m_metricsEvaluator, dimUnit, plural);
+                    });
+                }
+                columns.push_back(TimeSeriesColumnDesc{ nv::perf::ToString(m_metricsEvaluator, request), unit, valueType, valueEncoding });
+            }
+
+            std::unique_ptr<TimeSeriesWriter> pSampleExport(new TimeSeriesWriter());
+            if (!pSampleExport->Open(path, columns, maxRowsPerBlock))
+            {
+                return false;
+            }
+            m_pSampleExport = std::move(pSampleExport);
+            return true;
+        }
+
+        // Writes the remaining samples and closes the file.
+        bool StopSampleExport()
+        {
+            if (!m_pSampleExport)
+            {
+                return true;
+            }
+            const bool success = m_pSampleExport->Close();
+            if (m_pSampleExport->GetNumDroppedRows())
+            {
+                NV_PERF_LOG_WRN(50, "Sample export dropped %llu samples\n", (unsigned long long)m_pSampleExport->GetNumDroppedRows());
+            }
+            m_pSampleExport.reset();
+            return success;
         }
 
         void Print(std::ostream& os, const std::string indent = std::string()) const
@@ -2576,6 +5141,26 @@ namespace nv { namespace perf { namespace hud {
             m_timestampBuffer.Print(os, false, indent + "  ");
             os << indent << ")" << std::endl;
         }
+
+    private:
+        // writes the pending row of every column in "metricColumns", values are clamped to a minimum of 0
+        static void WriteMetricColumns(MetricHistory& history, const std::vector<MetricColumn>& metricColumns, const std::vector<double>& metricValues)
+        {
+            const size_t slot = history.WriteIndex();
+            for (const MetricColumn& metricColumn : metricColumns)
+            {
+                double value = 0.0;
+                if (metricColumn.metricIndex < metricValues.size())
+                {
+                    value = (std::max)(0.0, metricValues[metricColumn.metricIndex]);
+                }
+                else
+                {
+                    NV_PERF_LOG_WRN(50, "metricValues has too few entries. metricIndex (%zu) >= metricValues.size (%zu)\n", metricColumn.metricIndex, metricValues.size());
+                }
+                history.ColumnData(metricColumn.column)[slot] = value;
+            }
+        }
     };
 
 } } } // nv::perf::hud
\ No newline at end of file
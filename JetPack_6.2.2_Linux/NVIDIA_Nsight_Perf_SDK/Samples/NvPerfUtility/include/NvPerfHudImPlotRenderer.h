@@ -28,6 +28,12 @@ class HudImPlotRenderer : public HudRenderer
 private:
     const Color m_defaultTextColor = Color::White();
 
+    // scratch space for DecimateTimePlotSignal(), reused across frames
+    mutable std::vector<double> m_plotTimestamps;
+    mutable std::vector<double> m_plotValues;
+    mutable std::vector<double> m_plotLowerValues;
+    mutable std::vector<size_t> m_plotRowIndices;
+
 private:
     static ImVec4 ImVec4FromColor(const Color& color)
     {
@@ -35,6 +41,29 @@ private:
         return ImVec4(vec[0], vec[1], vec[2], vec[3]);
     }
 
+    // The description, followed by the signal's statistics if HudDataModel::EnableSignalStatistics() was called.
+    static void RenderSignalTooltip(const MetricSignal& signal, const MetricStatisticsView& statistics)
+    {
+        if (signal.description.empty() && !statistics.Count())
+        {
+            return;
+        }
+        ImGui::BeginTooltip();
+        if (!signal.description.empty())
+        {
+            ImGui::TextUnformatted(signal.description.c_str());
+        }
+        if (statistics.Count())
+        {
+            ImGui::Text("p50: %.2f  p95: %.2f  p99: %.2f  (%llu values)", statistics.Quantile(0.50), statistics.Quantile(0.95), statistics.Quantile(0.99), (unsigned long long)statistics.Count());
+            for (size_t decayIndex = 0; decayIndex < statistics.NumDecayedAverages(); ++decayIndex)
+            {
+                ImGui::Text("average over ~%gs: %.2f", statistics.DecayTimeConstant(decayIndex), statistics.DecayedAverage(decayIndex));
+            }
+        }
+        ImGui::EndTooltip();
+    }
+
 protected:
     bool RenderPanelBegin(const Panel& panel, bool *showContents) const override
     {
@@ -125,8 +154,6 @@ protected:
                 double max = scalarText.signal.maxValue;
                 auto color = scalarText.signal.color.IsValid() ? scalarText.signal.color.Abgr() : m_defaultTextColor.Abgr();
                 auto unit = scalarText.signal.unit;
-                auto description = scalarText.signal.description;
-                auto tooltip = description;
                 std::string decimalPlacesFormat = "%." + std::to_string(scalarText.decimalPlaces) + "lf";
 
                 auto formatIntegerPart = [](double value) -> std::string
@@ -171,11 +198,9 @@ protected:
                     ImGui::PushStyleColor(ImGuiCol_Text, labelColor);
                     ImGui::TextUnformatted(labelText.c_str());
                     ImGui::PopStyleColor();
-                    if (ImGui::IsItemHovered() && !tooltip.empty())
+                    if (ImGui::IsItemHovered())
                     {
-                        ImGui::BeginTooltip();
-                        ImGui::TextUnformatted(tooltip.c_str());
-                        ImGui::EndTooltip();
+                        RenderSignalTooltip(scalarText.signal, scalarText.signal.statistics);
                     }
                 }
 
@@ -355,15 +380,7 @@ protected:
             if (plot.signals.size() > 0)
             {
                 // Determine the offset for only drawing data points within the desired timeWidth
-                size_t dataOffset;
-                double thresholdTimestamp = plot.pTimestampBuffer->Size() > 0 ? plot.pTimestampBuffer->Front() - plot.timeWidth : 0.0;
-                for (dataOffset = 0; dataOffset < plot.pTimestampBuffer->Size(); ++dataOffset)
-                {
-                    if (plot.pTimestampBuffer->Get(dataOffset) >= thresholdTimestamp)
-                    {
-                        break;
-                    }
-                }
+                const size_t dataOffset = FindTimePlotWindowBegin(*plot.pTimestampBuffer, plot.timeWidth);
 
                 // Setup X-Axis ticks with 10, 1, 0.1, 0.01, etc intervals
                 if (plot.pTimestampBuffer->Size() > 0)
@@ -397,29 +414,8 @@ protected:
                     }
                 }
 
-                // If not for dataOffset, this userdata and getter would not be needed.
-                // But ImPlot's PlotLine and PlotShaded assume that the number of elements in the array is the same as its length modulo.
-                // I.e. you cannot have an offset, and only draw 20 points from an array of 40 points. It needs to draw all 40 in this case.
-                struct UserData
-                {
-                    size_t dataOffset;
-                    const RingBuffer<double>& timestampBuffer;
-                    const RingBuffer<double>& valBuffer;
-                };
-
-                auto getter = [](void* data_, int idx) -> ImPlotPoint {
-                    const auto& data = *static_cast<const UserData*>(data_);
-                    ImPlotPoint point(data.timestampBuffer.Get(idx + data.dataOffset), data.valBuffer.Get(idx + data.dataOffset));
-                    return point;
-                };
-                auto getterWithoutValBuffer = [](void* data_, int idx) -> ImPlotPoint {
-                    const auto& data = *static_cast<UserData*>(data_);
-                    // Assumes the minimum y of stacked plots is 0.
-                    // This might not always hold, but ImPlot does not let you query a dynamic minimum.
-                    // That only works via -INFINITY with PlotLine and PlotShaded without custom getters
-                    ImPlotPoint point(data.timestampBuffer.Get(idx + data.dataOffset), 0.0);
-                    return point;
-                };
+                // Hand ImPlot at most two points per horizontal pixel, as contiguous arrays; any more would land on the same pixels.
+                const size_t maxPoints = (std::max)(size_t(2), size_t(2.0f * ImPlot::GetPlotSize().x));
 
                 if (plot.chartType == TimePlot::ChartType::Overlay)
                 {
@@ -435,16 +431,13 @@ protected:
                             ImPlot::SetNextLineStyle(ImVec4FromColor(signal.color));
                         }
 
-                        UserData userData{ dataOffset, *plot.pTimestampBuffer, signal.valBuffer };
-
-                        ImPlot::PlotLineG(signal.label.text.c_str(), getter, &userData, int(signal.valBuffer.Size() - dataOffset));
+                        DecimateTimePlotSignal(*plot.pTimestampBuffer, signal.valBuffer, dataOffset, signal.valBuffer.Size(), maxPoints, m_plotTimestamps, m_plotValues);
+                        ImPlot::PlotLine(signal.label.text.c_str(), m_plotTimestamps.data(), m_plotValues.data(), int(m_plotValues.size()));
 
                         // Tooltip
-                        if (ImPlot::IsLegendEntryHovered(signal.label.text.c_str()) && !signal.description.empty())
+                        if (ImPlot::IsLegendEntryHovered(signal.label.text.c_str()))
                         {
-                            ImGui::BeginTooltip();
-                            ImGui::TextUnformatted(signal.description.c_str());
-                            ImGui::EndTooltip();
+                            RenderSignalTooltip(signal, signal.statistics);
                         }
                     }
                 }
@@ -453,7 +446,6 @@ protected:
                     for (size_t index = 0; index < plot.stackedSignals.size(); ++index)
                     {
                         const MetricSignal& signal = plot.stackedSignals[index];
-                        UserData userData1{ dataOffset, *plot.pTimestampBuffer, signal.valBuffer };
 
                         if (signal.valBuffer.Size() == 0)
                         {
@@ -466,24 +458,36 @@ protected:
                             ImPlot::SetNextFillStyle(ImVec4FromColor(signal.color));
                         }
 
+                        const bool decimated = DecimateTimePlotSignal(*plot.pTimestampBuffer, signal.valBuffer, dataOffset, signal.valBuffer.Size(), maxPoints, m_plotTimestamps, m_plotValues, &m_plotRowIndices);
                         if (index < plot.stackedSignals.size()-1)
                         {
+                            // the lower bound is sampled at the same rows as the upper one, so that the fill lines up
                             const MetricSignal& nextSignal = plot.stackedSignals[index+1];
-                            UserData userData2{ dataOffset, *plot.pTimestampBuffer, nextSignal.valBuffer };
-
-                            ImPlot::PlotShadedG(signal.label.text.c_str(), getter, &userData1, getter, &userData2, int(signal.valBuffer.Size() - dataOffset));
+                            m_plotLowerValues.resize(m_plotValues.size());
+                            if (decimated)
+                            {
+                                for (size_t pointIndex = 0; pointIndex < m_plotRowIndices.size(); ++pointIndex)
+                                {
+                                    m_plotLowerValues[pointIndex] = nextSignal.valBuffer.Get(m_plotRowIndices[pointIndex]);
+                                }
+                            }
+                            else
+                            {
+                                nextSignal.valBuffer.CopyTo(dataOffset, m_plotLowerValues.size(), m_plotLowerValues.data());
+                            }
+
+                            ImPlot::PlotShaded(signal.label.text.c_str(), m_plotTimestamps.data(), m_plotValues.data(), m_plotLowerValues.data(), int(m_plotValues.size()));
                         }
                         else
                         {
-                            ImPlot::PlotShadedG(signal.label.text.c_str(), getter, &userData1, getterWithoutValBuffer, &userData1, int(signal.valBuffer.Size() - dataOffset));
+                            // Assumes the minimum y of stacked plots is 0.
+                            ImPlot::PlotShaded(signal.label.text.c_str(), m_plotTimestamps.data(), m_plotValues.data(), int(m_plotValues.size()), 0.0);
                         }
 
-                        // Tooltip
-                        if (ImPlot::IsLegendEntryHovered(signal.label.text.c_str()) && !signal.description.empty())
+                        // Tooltip, with the statistics of the unstacked signal
+                        if (ImPlot::IsLegendEntryHovered(signal.label.text.c_str()))
                         {
-                            ImGui::BeginTooltip();
-                            ImGui::TextUnformatted(signal.description.c_str());
-                            ImGui::EndTooltip();
+                            RenderSignalTooltip(signal, plot.signals[index].statistics);
                         }
                     }
                 }
@@ -17,84 +17,286 @@
 #pragma once
 
 #include "NvPerfHudRenderer.h"
+#include "NvPerfJsonWriter.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
 
 namespace nv { namespace perf { namespace hud {
+    // Each Render() formats the whole frame into one buffer that is reused across frames, and hands it to the output in a single write.
     class HudTextRenderer : public HudRenderer{
+    public:
+        enum class OutputFormat
+        {
+            Text,   // the panels laid out as tables, re-printing each TimePlot's whole window every frame
+            Ndjson, // one JSON object per TimePlot sample, only for samples added since the previous Render()
+            Csv     // one "timestamp,panel,plot,signal,value" row per TimePlot signal sample, only for samples added since the previous Render()
+        };
+
+        using WriteFn = std::function<void(const char* pData, size_t size)>;
+
+        enum { MaxFormattedValueLength = 32 }; // including the null terminator, longer values are truncated
+
+        // Same output as printf("%.*f"), but with integer arithmetic for all values that fit in 53 bits once scaled, which is nearly all of them.
+        // "pBuffer" must hold MaxFormattedValueLength chars; returns the length, not including the null terminator.
+        static size_t FormatValue(double value, size_t decimalPlaces, char* pBuffer)
+        {
+            if (std::isnan(value))
+            {
+                memcpy(pBuffer, "nan", 4);
+                return 3;
+            }
+            else if (std::isinf(value))
+            {
+                if (std::signbit(value))
+                {
+                    memcpy(pBuffer, "-inf", 5);
+                    return 4;
+                }
+                memcpy(pBuffer, "inf", 4);
+                return 3;
+            }
+
+            static const double PowersOf10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9 };
+            if (decimalPlaces < sizeof(PowersOf10) / sizeof(PowersOf10[0]))
+            {
+                const double magnitude = std::fabs(value);
+                const double scaled = magnitude * PowersOf10[decimalPlaces];
+                if (scaled < 9007199254740992.0) // 2^53
+                {
+                    // round half to even on the exact product, like printf
+                    uint64_t fixedPoint = (uint64_t)scaled;
+                    const double productError = std::fma(magnitude, PowersOf10[decimalPlaces], -scaled);
+                    const double aboveHalf = (scaled - (double)fixedPoint - 0.5) + productError;
+                    if (aboveHalf > 0.0 || (aboveHalf == 0.0 && (fixedPoint & 1)))
+                    {
+                        ++fixedPoint;
+                    }
+                    char reversed[MaxFormattedValueLength];
+                    size_t length = 0;
+                    for (size_t digit = 0; digit < decimalPlaces; ++digit)
+                    {
+                        reversed[length++] = char('0' + fixedPoint % 10);
+                        fixedPoint /= 10;
+                    }
+                    if (decimalPlaces)
+                    {
+                        reversed[length++] = '.';
+                    }
+                    do
+                    {
+                        reversed[length++] = char('0' + fixedPoint % 10);
+                        fixedPoint /= 10;
+                    } while (fixedPoint);
+                    if (std::signbit(value))
+                    {
+                        reversed[length++] = '-'; // like printf, also for values that round to 0
+                    }
+                    for (size_t ii = 0; ii < length; ++ii)
+                    {
+                        pBuffer[ii] = reversed[length - 1 - ii];
+                    }
+                    pBuffer[length] = '\0';
+                    return length;
+                }
+            }
+            const int length = snprintf(pBuffer, MaxFormattedValueLength, "%.*f", (int)decimalPlaces, value);
+            return length > 0 ? (std::min)((size_t)length, (size_t)MaxFormattedValueLength - 1) : 0;
+        }
+
     private:
         std::function<void(const char* format, va_list vlist)> m_printFn;
         bool m_enableConsoleOutput = false;
+        WriteFn m_writeFn;
+        OutputFormat m_outputFormat = OutputFormat::Text;
         std::string m_columnSeparator = ",";
         size_t m_maxIntegerLength = 8;
         size_t m_decimalPlaces = 2;
+        size_t m_maxTimePlotRows = 0;
         size_t m_frameCount = 0;
+        bool m_showSignalStatistics = false;
+        bool m_csvHeaderWritten = false;
+
+        // scratch state of Render(), which is const in the widget callbacks
+        mutable std::string m_frameBuffer;
+        mutable std::vector<size_t> m_columnLengths;
+        mutable const Panel* m_pCurrentPanel = nullptr;
+        mutable std::map<const TimePlot*, double> m_lastStreamedTimestamps;
 
     private:
-        static std::string AddLeftPadding(const std::string& text, size_t length)
+        void Append(const char* pData, size_t size) const
+        {
+            m_frameBuffer.append(pData, size);
+        }
+
+        void Append(const char* pStr) const
+        {
+            m_frameBuffer.append(pStr);
+        }
+
+        void Append(const std::string& str) const
+        {
+            m_frameBuffer.append(str);
+        }
+
+        void AppendPadded(const char* pText, size_t textLength, size_t length, bool padLeft) const
         {
-            std::string alignedText = text;
-            if (text.size() <= length)
+            if (textLength > length)
             {
-                alignedText.insert(0, length - text.size(), ' ');
+                NV_PERF_LOG_ERR(20, "The default max integer length is not enough, please SetMaxIntegerLength().\n");
+                Append(pText, textLength);
+                return;
             }
-            else
+            if (padLeft)
             {
-                NV_PERF_LOG_ERR(20, "The default max integer length is not enough, please SetMaxIntegerLength().\n");
+                m_frameBuffer.append(length - textLength, ' ');
             }
-            return alignedText;
+            Append(pText, textLength);
+            if (!padLeft)
+            {
+                m_frameBuffer.append(length - textLength, ' ');
+            }
+        }
+
+        void AppendValue(double value) const
+        {
+            char buffer[MaxFormattedValueLength];
+            Append(buffer, FormatValue(value, m_decimalPlaces, buffer));
+        }
+
+        void AppendLeftPadded(double value, size_t length) const
+        {
+            char buffer[MaxFormattedValueLength];
+            AppendPadded(buffer, FormatValue(value, m_decimalPlaces, buffer), length, true);
         }
 
-        static std::string AddRightPadding(const std::string& text, size_t length)
+        void AppendRightPadded(double value, size_t length) const
         {
-            std::string alignedText = text;
-            if (text.size() <= length)
+            char buffer[MaxFormattedValueLength];
+            AppendPadded(buffer, FormatValue(value, m_decimalPlaces, buffer), length, false);
+        }
+
+        void AppendRightPadded(const std::string& text, size_t length) const
+        {
+            AppendPadded(text.data(), text.size(), length, false);
+        }
+
+        void AppendColumnSeparator() const
+        {
+            m_frameBuffer.push_back(' ');
+            Append(m_columnSeparator);
+            m_frameBuffer.push_back(' ');
+        }
+
+        void AppendStatistics(const MetricStatisticsView& statistics) const
+        {
+            Append(" (p50: ");
+            AppendValue(statistics.Quantile(0.50));
+            Append(", p95: ");
+            AppendValue(statistics.Quantile(0.95));
+            Append(", p99: ");
+            AppendValue(statistics.Quantile(0.99));
+            m_frameBuffer.push_back(')');
+        }
+
+        void AppendCsvField(const std::string& field) const
+        {
+            if (field.find_first_of(",\"\r\n") == std::string::npos)
             {
-                alignedText.insert(text.size(), length - text.size(), ' ');
+                Append(field);
+                return;
             }
-            else
+            m_frameBuffer.push_back('"');
+            for (char c : field)
             {
-                NV_PERF_LOG_ERR(20, "The default max integer length is not enough, please SetMaxIntegerLength().\n");
+                if (c == '"')
+                {
+                    m_frameBuffer.push_back('"');
+                }
+                m_frameBuffer.push_back(c);
             }
-            return alignedText;
+            m_frameBuffer.push_back('"');
         }
 
-        static std::string FormatValue(double value, size_t decimalPlaces)
+        void AppendCsvValue(double value) const
         {
             if (std::isnan(value))
             {
-                return "nan";
+                Append("nan", 3);
             }
             else if (std::isinf(value))
             {
-                return "inf";
+                Append(value < 0 ? "-inf" : "inf");
+            }
+            else
+            {
+                char buffer[MaxFormattedDoubleLength + 1];
+                Append(buffer, FormatShortestDouble(value, buffer));
+            }
+        }
+
+        void Write()
+        {
+            if (m_frameBuffer.empty())
+            {
+                return;
+            }
+            if (m_writeFn)
+            {
+                m_writeFn(m_frameBuffer.data(), m_frameBuffer.size());
+            }
+            else
+            {
+                Print("%s", m_frameBuffer.c_str());
             }
-            std::string decimalPlacesFormat = "%." + std::to_string(decimalPlaces) + "f";
-            char buf[32] = "";
-            snprintf(buf, 32, decimalPlacesFormat.c_str(), value);
-            std::string formatValue = std::string(&(buf[0]));
-            return std::string(&(buf[0]));
         }
 
         virtual bool RenderFrameSeparator() override
         {
-            Print("\n===Frame%d===\n", m_frameCount);
+            if (m_outputFormat == OutputFormat::Text)
+            {
+                char buffer[48];
+                const int length = snprintf(buffer, sizeof(buffer), "\n===Frame%llu===\n", (unsigned long long)m_frameCount);
+                Append(buffer, (size_t)length);
+            }
             ++m_frameCount;
             return true;
         }
 
         virtual bool RenderPanelBegin(const Panel& panel, bool* showContents) const override
         {
-            Print("%s\n", panel.name.c_str());
+            m_pCurrentPanel = &panel;
+            if (m_outputFormat == OutputFormat::Text)
+            {
+                Append(panel.name);
+                m_frameBuffer.push_back('\n');
+            }
             return true;
         }
 
         virtual bool RenderPanelEnd(const Panel&) const override
         {
-            Print("%s", "---------------------------------\n");
+            if (m_outputFormat == OutputFormat::Text)
+            {
+                Append("---------------------------------\n");
+            }
+            m_pCurrentPanel = nullptr;
             return true;
         }
 
+        // ScalarTexts have no timestamps to tell new samples apart, so they are not streamed; their metrics can be streamed through a TimePlot.
         virtual bool RenderScalarTextBlock(const std::vector<const ScalarText*>& block) const override
         {
+            if (m_outputFormat != OutputFormat::Text)
+            {
+                return true;
+            }
+
             size_t maxScalarTextLength = 0;
             for (const auto* pScalarText : block)
             {
@@ -112,116 +314,255 @@ namespace nv { namespace perf { namespace hud {
                 }
                 double value = scalarText.signal.valBuffer.Size() > 0 ? scalarText.signal.valBuffer.Front() : 0.0;
                 double max = scalarText.signal.maxValue;
-                auto unit = scalarText.signal.unit;
-                auto description = scalarText.signal.description;
-                auto tooltip = description;
-                const std::string unitText = unit.empty() || unit == MetricSignal::HideUnit() ? "" : " " + unit;
-                
+                const std::string& unit = scalarText.signal.unit;
+                const bool showUnit = !unit.empty() && unit != MetricSignal::HideUnit();
                 const size_t maxValueLength = m_maxIntegerLength + m_decimalPlaces + 1; // 1=.
+
+                AppendRightPadded(scalarText.label.text, maxScalarTextLength);
+                Append(": ", 2);
                 if (showValue != ScalarText::ShowValue::ValueWithMax)
                 {
-                    std::string text = AddRightPadding(scalarText.label.text, maxScalarTextLength) + ": " +
-                        AddLeftPadding(FormatValue(value, m_decimalPlaces), maxValueLength) + unitText;
-                    Print("%s\n", text.c_str());
+                    AppendLeftPadded(value, maxValueLength);
                 }
                 else
                 {
-                    std::string text = AddRightPadding(scalarText.label.text, maxScalarTextLength) + ": " +
-                        AddRightPadding(FormatValue(value, m_decimalPlaces), maxValueLength) + unitText
-                        + "(max:" + AddLeftPadding(FormatValue(max, m_decimalPlaces), maxValueLength) + unitText + ")";
-                    Print("%s\n", text.c_str());
+                    AppendRightPadded(value, maxValueLength);
+                }
+                if (showUnit)
+                {
+                    m_frameBuffer.push_back(' ');
+                    Append(unit);
+                }
+                if (showValue == ScalarText::ShowValue::ValueWithMax)
+                {
+                    Append("(max:");
+                    AppendLeftPadded(max, maxValueLength);
+                    if (showUnit)
+                    {
+                        m_frameBuffer.push_back(' ');
+                        Append(unit);
+                    }
+                    m_frameBuffer.push_back(')');
+                }
+                if (m_showSignalStatistics && scalarText.signal.statistics.IsEnabled())
+                {
+                    AppendStatistics(scalarText.signal.statistics);
                 }
+                m_frameBuffer.push_back('\n');
             }
             return true;
         }
 
+        // Streams the samples of "plot" added since the previous Render(), with the values of its signals before stacking.
+        void StreamTimePlot(const TimePlot& plot) const
+        {
+            const RingBuffer<double>& timestampBuffer = *plot.pTimestampBuffer;
+            if (!timestampBuffer.Size())
+            {
+                return;
+            }
+
+            // timestamps are increasing, find the first one after the last streamed
+            size_t beginIndex = 0;
+            const auto itr = m_lastStreamedTimestamps.find(&plot);
+            if (itr != m_lastStreamedTimestamps.end())
+            {
+                size_t endIndex = timestampBuffer.Size();
+                while (beginIndex < endIndex)
+                {
+                    const size_t midIndex = beginIndex + (endIndex - beginIndex) / 2;
+                    if (timestampBuffer.Get(midIndex) <= itr->second)
+                    {
+                        beginIndex = midIndex + 1;
+                    }
+                    else
+                    {
+                        endIndex = midIndex;
+                    }
+                }
+            }
+            m_lastStreamedTimestamps[&plot] = timestampBuffer.Front();
+
+            static const std::string EmptyName;
+            const std::string& panelName = m_pCurrentPanel ? m_pCurrentPanel->name : EmptyName;
+            for (size_t sampleIndex = beginIndex; sampleIndex < timestampBuffer.Size(); ++sampleIndex)
+            {
+                const double timestamp = timestampBuffer.Get(sampleIndex);
+                if (m_outputFormat == OutputFormat::Ndjson)
+                {
+                    StringSink sink(m_frameBuffer);
+                    JsonWriter<StringSink> writer(sink);
+                    writer.Raw("{\"timestamp\":").Double(timestamp);
+                    writer.Raw(",\"panel\":").String(panelName);
+                    writer.Raw(",\"plot\":").String(plot.label.text);
+                    writer.Raw(",\"values\":{");
+                    bool first = true;
+                    for (const MetricSignal& signal : plot.signals)
+                    {
+                        if (sampleIndex < signal.valBuffer.Size())
+                        {
+                            writer.Raw(first ? "" : ",").String(signal.label.text).Raw(':').Double(signal.valBuffer.Get(sampleIndex));
+                            first = false;
+                        }
+                    }
+                    writer.Raw("}}\n");
+                }
+                else
+                {
+                    for (const MetricSignal& signal : plot.signals)
+                    {
+                        if (sampleIndex < signal.valBuffer.Size())
+                        {
+                            AppendCsvValue(timestamp);
+                            m_frameBuffer.push_back(',');
+                            AppendCsvField(panelName);
+                            m_frameBuffer.push_back(',');
+                            AppendCsvField(plot.label.text);
+                            m_frameBuffer.push_back(',');
+                            AppendCsvField(signal.label.text);
+                            m_frameBuffer.push_back(',');
+                            AppendCsvValue(signal.valBuffer.Get(sampleIndex));
+                            m_frameBuffer.push_back('\n');
+                        }
+                    }
+                }
+            }
+        }
+
         virtual bool RenderTimePlot(const TimePlot& plot) const override
         {
-            std::string unit;
-            if (plot.unit.empty() && plot.unit != MetricSignal::HideUnit())
+            if (m_outputFormat != OutputFormat::Text)
             {
-                if (plot.signals.size() > 0)
+                if (plot.pTimestampBuffer)
                 {
-                    unit = plot.signals[0].unit;
+                    StreamTimePlot(plot);
                 }
+                return true;
             }
-            else
+
+            const std::string* pUnit = &plot.unit;
+            if (plot.unit.empty() && plot.unit != MetricSignal::HideUnit())
             {
-                unit = plot.unit;
+                static const std::string NoUnit;
+                pUnit = plot.signals.size() > 0 ? &plot.signals[0].unit : &NoUnit;
             }
+            const std::string& unit = *pUnit;
 
             if (!plot.label.text.empty())
             {
-                std::string plotTitle = plot.label.text;
+                Append(plot.label.text);
 
                 // Add the unit to the title of the plot
                 if (!unit.empty() && unit != MetricSignal::HideUnit())
                 {
-                    plotTitle += " (" + unit + ")";
+                    Append(" (", 2);
+                    Append(unit);
+                    m_frameBuffer.push_back(')');
                 }
-                Print("%s\n", plotTitle.c_str());
+                m_frameBuffer.push_back('\n');
             }
 
             if (plot.signals.size() > 0)
             {
                 // Determine the offset for only drawing data points within the desired timeWidth
-                size_t dataOffset = 0;
-                double thresholdTimestamp = plot.pTimestampBuffer->Size() > 0 ? plot.pTimestampBuffer->Front() - plot.timeWidth : 0.0;
-                for (dataOffset = 0; dataOffset < plot.pTimestampBuffer->Size(); ++dataOffset)
-                {
-                    if (plot.pTimestampBuffer->Get(dataOffset) >= thresholdTimestamp)
-                    {
-                        break;
-                    }
-                }
+                const size_t dataOffset = FindTimePlotWindowBegin(*plot.pTimestampBuffer, plot.timeWidth);
 
                 const size_t maxValueLength = m_maxIntegerLength + m_decimalPlaces + 1; // 1=.
-                auto PrintSignals = [&](const std::vector<MetricSignal>& signals, const RingBuffer<double>& timestampBuffer, size_t dataOffset) {
-                    std::vector<size_t> columnLengths(1 + signals.size(), maxValueLength);
-                    const std::string timeLabel = "Timestamp";
-                    columnLengths[0] = (std::max)(columnLengths[0], timeLabel.length());
-                    std::string labelTexts = AddRightPadding(timeLabel, columnLengths[0]);
+                // "statisticsSignals" are the unstacked signals, whose statistics follow the rows
+                auto PrintSignals = [&](const std::vector<MetricSignal>& signals, const std::vector<MetricSignal>& statisticsSignals, const RingBuffer<double>& timestampBuffer, size_t dataOffset) {
+                    std::vector<size_t>& columnLengths = m_columnLengths;
+                    columnLengths.assign(1 + signals.size(), maxValueLength);
+                    static const char TimeLabel[] = "Timestamp";
+                    columnLengths[0] = (std::max)(columnLengths[0], sizeof(TimeLabel) - 1);
+                    AppendPadded(TimeLabel, sizeof(TimeLabel) - 1, columnLengths[0], false);
                     for(size_t signalIndex = 0; signalIndex < signals.size(); signalIndex++)
                     {
                         const MetricSignal& signal = signals[signalIndex];
                         columnLengths[signalIndex + 1] = (std::max)(columnLengths[signalIndex + 1], signal.label.text.length());
-                        labelTexts += " " + m_columnSeparator + " " + AddRightPadding(signal.label.text, columnLengths[signalIndex + 1]);
+                        AppendColumnSeparator();
+                        AppendRightPadded(signal.label.text, columnLengths[signalIndex + 1]);
+                    }
+                    m_frameBuffer.push_back(' ');
+                    Append(m_columnSeparator);
+                    m_frameBuffer.push_back('\n');
+                    auto endRow = [&]() {
+                        m_frameBuffer.push_back(' ');
+                        Append(m_columnSeparator);
+                        m_frameBuffer.push_back('\n');
+                    };
+                    auto printStatistics = [&]() {
+                        if (!m_showSignalStatistics)
+                        {
+                            return;
+                        }
+                        static const double Quantiles[] = { 0.50, 0.95, 0.99 };
+                        static const char* const QuantileNames[] = { "p50", "p95", "p99" };
+                        for (size_t quantileIndex = 0; quantileIndex < 3; ++quantileIndex)
+                        {
+                            AppendPadded(QuantileNames[quantileIndex], 3, columnLengths[0], false);
+                            for (size_t signalIndex = 0; signalIndex < statisticsSignals.size(); signalIndex++)
+                            {
+                                AppendColumnSeparator();
+                                AppendLeftPadded(statisticsSignals[signalIndex].statistics.Quantile(Quantiles[quantileIndex]), columnLengths[signalIndex + 1]);
+                            }
+                            endRow();
+                        }
+                    };
+                    const size_t numRows = timestampBuffer.Size() - dataOffset;
+                    if (m_maxTimePlotRows && numRows > m_maxTimePlotRows)
+                    {
+                        // one row per bucket of the same reduction the plots use: its first timestamp, and the peak of each signal
+                        for (size_t bucketIndex = 0; bucketIndex < m_maxTimePlotRows; ++bucketIndex)
+                        {
+                            size_t bucketBegin = 0;
+                            size_t bucketEnd = 0;
+                            GetDecimationBucket(dataOffset, timestampBuffer.Size(), m_maxTimePlotRows, bucketIndex, bucketBegin, bucketEnd);
+                            AppendLeftPadded(timestampBuffer.Get(bucketBegin), columnLengths[0]);
+                            for (size_t signalIndex = 0; signalIndex < signals.size(); signalIndex++)
+                            {
+                                const MetricSignal& signal = signals[signalIndex];
+                                if (bucketEnd <= signal.valBuffer.Size())
+                                {
+                                    AppendColumnSeparator();
+                                    AppendLeftPadded(signal.valBuffer.GetMinMax(bucketBegin, bucketEnd).maxValue, columnLengths[signalIndex + 1]);
+                                }
+                            }
+                            endRow();
+                        }
+                        printStatistics();
+                        return;
                     }
-                    labelTexts += " " + m_columnSeparator;
-                    Print("%s\n", labelTexts.c_str());
-                    std::string valueTexts = "";
                     for (size_t startIndex = dataOffset; startIndex < timestampBuffer.Size(); startIndex++)
                     {
-                        std::string formatTime = FormatValue(timestampBuffer.Get(startIndex), m_decimalPlaces);
-                        valueTexts += AddLeftPadding(formatTime, columnLengths[0]);
+                        AppendLeftPadded(timestampBuffer.Get(startIndex), columnLengths[0]);
                         for (size_t signalIndex = 0; signalIndex < signals.size(); signalIndex++)
                         {
                             const MetricSignal& signal = signals[signalIndex];
                             if (startIndex < signal.valBuffer.Size())
                             {
-                                std::string formatVal = FormatValue(signal.valBuffer.Get(startIndex), m_decimalPlaces);
-                                valueTexts += " " + m_columnSeparator + " " + AddLeftPadding(formatVal, columnLengths[signalIndex + 1]);
+                                AppendColumnSeparator();
+                                AppendLeftPadded(signal.valBuffer.Get(startIndex), columnLengths[signalIndex + 1]);
                             }
                         }
-                        valueTexts += " " + m_columnSeparator;
-                        Print("%s\n", valueTexts.c_str());
-                        valueTexts = "";
+                        endRow();
                     }
+                    printStatistics();
                 };
 
                 if (plot.chartType == TimePlot::ChartType::Overlay)
                 {
-                    PrintSignals(plot.signals, *plot.pTimestampBuffer, dataOffset);
+                    PrintSignals(plot.signals, plot.signals, *plot.pTimestampBuffer, dataOffset);
                 }
                 else if (plot.chartType == TimePlot::ChartType::Stacked)
                 {
-                    PrintSignals(plot.stackedSignals, *plot.pTimestampBuffer, dataOffset);
+                    PrintSignals(plot.stackedSignals, plot.signals, *plot.pTimestampBuffer, dataOffset);
                 }
             }
             return true;
         }
 
     protected:
+        // Receives each frame as a single "%s" unless SetOutput() was called.
         virtual void Print(const char* format, ...) const
         {
             if (m_enableConsoleOutput)
@@ -236,12 +577,49 @@ namespace nv { namespace perf { namespace hud {
     public:
         HudTextRenderer() : HudRenderer(){}
 
+        // Writes each frame to "pFile" in one fwrite(), and flushes it.
+        static WriteFn FileOutput(FILE* pFile)
+        {
+            return [pFile](const char* pData, size_t size) {
+                fwrite(pData, 1, size, pFile);
+                fflush(pFile);
+            };
+        }
+
+        virtual bool Render() override
+        {
+            m_frameBuffer.clear(); // keeps the capacity, so steady-state frames don't allocate
+            if (m_outputFormat == OutputFormat::Csv && !m_csvHeaderWritten)
+            {
+                Append("timestamp,panel,plot,signal,value\n");
+                m_csvHeaderWritten = true;
+            }
+            const bool success = HudRenderer::Render();
+            Write();
+            return success;
+        }
+
         void SetConsoleOutput(std::function<void(const char*, va_list vlist)> printFn)
         {
             m_printFn = printFn;
             m_enableConsoleOutput = true;
         }
 
+        // Receives each rendered frame in one call, e.g. FileOutput(stdout), or a callback that pushes into a ring buffer. Takes precedence
+        // over SetConsoleOutput().
+        void SetOutput(WriteFn writeFn)
+        {
+            m_writeFn = std::move(writeFn);
+        }
+
+        // Switching to a streaming format starts from the samples currently in the TimePlots' windows.
+        void SetOutputFormat(OutputFormat outputFormat)
+        {
+            m_outputFormat = outputFormat;
+            m_lastStreamedTimestamps.clear();
+            m_csvHeaderWritten = false;
+        }
+
         void SetColumnSeparator(const std::string& separator)
         {
             m_columnSeparator = separator;
@@ -256,5 +634,17 @@ namespace nv { namespace perf { namespace hud {
         {
             m_maxIntegerLength = maxIntegerLength;
         }
+
+        // Limits each TimePlot to this many rows, each summarizing a range of samples by their peak; 0 prints every sample.
+        void SetMaxTimePlotRows(size_t maxTimePlotRows)
+        {
+            m_maxTimePlotRows = maxTimePlotRows;
+        }
+
+        // Appends p50/p95/p99 to ScalarTexts, and as rows to TimePlots, for signals with statistics (see HudDataModel::EnableSignalStatistics()).
+        void SetShowSignalStatistics(bool showSignalStatistics)
+        {
+            m_showSignalStatistics = showSignalStatistics;
+        }
 	};
 }}}
\ No newline at end of file
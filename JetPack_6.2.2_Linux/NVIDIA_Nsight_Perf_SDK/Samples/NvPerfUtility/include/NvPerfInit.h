@@ -18,7 +18,15 @@
 
 #include <stdio.h>
 #include <stdarg.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <cassert>
 #include "nvperf_host.h"
 #include "nvperf_target.h"
@@ -199,6 +207,7 @@ namespace nv { namespace perf {
 
         bool logDate                              = true;
         bool logTime                              = true;
+        uint32_t rateLimitPerCallsite             = 0; // max messages per second from a single callsite, 0 is unlimited
 
         LogSettings()
         {
@@ -241,6 +250,14 @@ namespace nv { namespace perf {
                     }
                 }
             }
+            {
+                std::string envValue;
+                if (GetEnvVariable("NV_PERF_LOG_RATE_LIMIT", envValue))
+                {
+                    char* pEnd = nullptr;
+                    rateLimitPerCallsite = static_cast<uint32_t>(strtoul(envValue.c_str(), &pEnd, 0));
+                }
+            }
         }
 
         ~LogSettings()
@@ -307,6 +324,14 @@ namespace nv { namespace perf {
         pSettings->logTime = enable;
     }
 
+    // Limits every NV_PERF_LOG_* callsite to "messagesPerSecond" messages per second; 0 disables the limit. Callsites are told apart by their
+    // format string, and the rest are dropped and counted in UserLogStats::numRateLimited.
+    inline void SetLogRateLimit(uint32_t messagesPerSecond)
+    {
+        LogSettings* pSettings = GetLogSettingsStorage_();
+        pSettings->rateLimitPerCallsite = messagesPerSecond;
+    }
+
     inline bool UserLogEnablePlatform(bool enable)
     {
         LogSettings* pSettings = GetLogSettingsStorage_();
@@ -363,45 +388,29 @@ namespace nv { namespace perf {
         fflush(fd);
     }
 
-    inline void UserLog(LogSeverity severity, uint32_t level, const char* pFunctionName, const char* pFormat, ...)
+    inline const char* GetLogPrefix(LogSeverity severity)
     {
-        const uint32_t volumeLevel = GetLogVolumeLevel(severity);
-        if (volumeLevel < level)
+        switch (severity)
         {
-            return;
+            case (LogSeverity::Inf): return "NVPERF|INF|";
+            case (LogSeverity::Wrn): return "NVPERF|WRN|";
+            case (LogSeverity::Err): return "NVPERF|ERR|";
+            default:                 return "NVPERF|???|";
         }
+    }
 
+    // Writes a formatted message to every enabled sink. "pTimestamp" is only read if the date or time is logged. Flushing is left to the
+    // caller.
+    inline void UserLogWriteSinks(LogSeverity severity, const LogTimeStamp* pTimestamp, const char* pFunctionName, const char* pMessage)
+    {
         LogSettings& settings = *GetLogSettingsStorage_();
-
-        va_list args;
-
-        va_start(args, pFormat);
-        const size_t length = vsnprintf(nullptr, 0, pFormat, args);
-        va_end(args);
-
-        std::string str;
-        str.append(length + 1, ' ');
-        va_start(args, pFormat);
-        vsnprintf(&str[0], length+1, pFormat, args);
-        va_end(args);
-        str.back() = '\0'; // ensure NULL terminated
-
-        const char* const pPrefix = [&]() {
-            switch (severity)
-            {
-                case (LogSeverity::Inf): return "NVPERF|INF|";
-                case (LogSeverity::Wrn): return "NVPERF|WRN|";
-                case (LogSeverity::Err): return "NVPERF|ERR|";
-                default:                 return "NVPERF|???|";
-            }
-        }();
+        const char* const pPrefix = GetLogPrefix(severity);
 
         char datebuf[16];
         char timebuf[16];
         if (settings.logDate || settings.logTime)
         {
-            LogTimeStamp time;
-            GetTimeStamp(&time);
+            LogTimeStamp time = *pTimestamp;
             if (settings.logDate)
             {
                 FormatDate(&time, datebuf, sizeof(datebuf));
@@ -427,7 +436,7 @@ namespace nv { namespace perf {
             }
             UserLogImplPlatform(pFunctionName);
             UserLogImplPlatform(" || ");
-            UserLogImplPlatform(str.c_str());
+            UserLogImplPlatform(pMessage);
         }
         if (settings.writeStderr)
         {
@@ -444,7 +453,7 @@ namespace nv { namespace perf {
             }
             UserLogImplStderr(pFunctionName);
             UserLogImplStderr(" || ");
-            UserLogImplStderr(str.c_str());
+            UserLogImplStderr(pMessage);
         }
         if (settings.writeFileFD)
         {
@@ -461,11 +470,7 @@ namespace nv { namespace perf {
             }
             UserLogImplFile(pFunctionName, settings.writeFileFD);
             UserLogImplFile(" || ", settings.writeFileFD);
-            UserLogImplFile(str.c_str(), settings.writeFileFD);
-            if (severity >= settings.flushFileSeverity)
-            {
-                UserLogImplFileFlush(settings.writeFileFD);
-            }
+            UserLogImplFile(pMessage, settings.writeFileFD);
         }
         if (settings.pFnWriteCustomCB)
         {
@@ -474,12 +479,438 @@ namespace nv { namespace perf {
                 settings.logDate ? datebuf : nullptr,
                 settings.logTime ? timebuf : nullptr,
                 pFunctionName,
-                str.c_str(),
+                pMessage,
                 settings.writeCustomData
             );
         }
     }
 
+    struct UserLogStats
+    {
+        uint64_t numRateLimited; // messages dropped by SetLogRateLimit()
+        uint64_t numDropped;     // messages dropped because the asynchronous log ring was full
+    };
+
+    // Counts messages per callsite over one-second windows. Callsites are keyed by their format string, and hashed into a fixed table without
+    // locking; callsites that share a slot share a budget, which can only make the limit stricter.
+    class LogRateLimiter
+    {
+    public:
+        enum { NumCallsiteSlots = 1024 };
+
+    private:
+        struct Callsite
+        {
+            std::atomic<int64_t> windowBegin; // milliseconds
+            std::atomic<uint32_t> numMessages;
+        };
+        Callsite m_callsites[NumCallsiteSlots];
+        std::atomic<uint64_t> m_numRateLimited;
+
+    public:
+        LogRateLimiter()
+            : m_numRateLimited(0)
+        {
+            for (Callsite& callsite : m_callsites)
+            {
+                callsite.windowBegin.store(0, std::memory_order_relaxed);
+                callsite.numMessages.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        bool Admit(const void* pCallsite, uint32_t messagesPerSecond)
+        {
+            const uint64_t key = (uint64_t)(uintptr_t)pCallsite;
+            Callsite& callsite = m_callsites[(key * 0x9E3779B97F4A7C15ull) >> 54]; // the top 10 bits select one of NumCallsiteSlots
+            const int64_t now = (int64_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+            int64_t windowBegin = callsite.windowBegin.load(std::memory_order_relaxed);
+            if (now - windowBegin >= 1000 && callsite.windowBegin.compare_exchange_strong(windowBegin, now, std::memory_order_relaxed))
+            {
+                callsite.numMessages.store(0, std::memory_order_relaxed);
+            }
+            if (callsite.numMessages.fetch_add(1, std::memory_order_relaxed) >= messagesPerSecond)
+            {
+                m_numRateLimited.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            return true;
+        }
+
+        uint64_t GetNumRateLimited() const
+        {
+            return m_numRateLimited.load(std::memory_order_relaxed);
+        }
+    };
+
+    inline LogRateLimiter* GetLogRateLimiterStorage_()
+    {
+        static LogRateLimiter rateLimiter;
+        return &rateLimiter;
+    }
+
+    enum { MaxAsyncLogMessageLength = 480 }; // longer messages are truncated to "...\n"
+
+    // Moves log output off the calling thread. Callers claim a record in a fixed ring with a single CAS, format the message into it with one
+    // vsnprintf, and return without allocating or locking. A background thread owns the sinks: it formats the date and time, writes to
+    // stderr/file/callback, and flushes the log file once per batch. When the ring is full, messages are dropped and counted rather than
+    // stalling the caller, and the writer reports the count in the log.
+    class AsyncLogger
+    {
+    private:
+        struct Record
+        {
+            std::atomic<size_t> sequence; // equals the ring position while free, position + 1 once written
+            LogSeverity severity;
+            const char* pFunctionName;
+            LogTimeStamp timestamp;
+            char message[MaxAsyncLogMessageLength];
+        };
+
+        std::unique_ptr<Record[]> m_records;
+        size_t m_mask;
+        uint32_t m_flushIntervalMs;
+        alignas(64) std::atomic<size_t> m_enqueuePos;
+        alignas(64) std::atomic<size_t> m_dequeuePos; // only advanced by the writer thread, or by Stop() once it has been joined
+        std::atomic<uint64_t> m_numDropped;
+        uint64_t m_numDroppedReported;
+        std::atomic<uint32_t> m_numActivePushes; // lets Stop() wait out callers that saw m_enabled just before it was cleared
+        std::atomic<bool> m_enabled;
+        std::atomic<bool> m_wakeRequested;
+        std::thread m_thread;
+        std::mutex m_mutex;
+        std::condition_variable m_wake;
+        std::condition_variable m_drained;
+        bool m_stop;
+
+    public:
+        AsyncLogger()
+            : m_mask(0)
+            , m_flushIntervalMs(0)
+            , m_enqueuePos(0)
+            , m_dequeuePos(0)
+            , m_numDropped(0)
+            , m_numDroppedReported(0)
+            , m_numActivePushes(0)
+            , m_enabled(false)
+            , m_wakeRequested(false)
+            , m_stop(false)
+        {
+            GetLogSettingsStorage_(); // constructed first, so that the settings outlive the writer thread
+            std::string envValue;
+            if (GetEnvVariable("NV_PERF_LOG_ASYNC", envValue))
+            {
+                char* pEnd = nullptr;
+                if (strtol(envValue.c_str(), &pEnd, 0))
+                {
+                    Start(1024, 50);
+                }
+            }
+        }
+        AsyncLogger(const AsyncLogger& logger) = delete;
+        AsyncLogger& operator=(const AsyncLogger& logger) = delete;
+        ~AsyncLogger()
+        {
+            Stop();
+        }
+
+        bool IsEnabled() const
+        {
+            return m_enabled.load(std::memory_order_acquire);
+        }
+
+        // "numRecords" is rounded up to a power of 2. Does nothing if already started.
+        bool Start(size_t numRecords, uint32_t flushIntervalMs)
+        {
+            if (m_thread.joinable())
+            {
+                return true;
+            }
+            size_t capacity = 2;
+            while (capacity < numRecords)
+            {
+                capacity *= 2;
+            }
+            if (!m_records || m_mask + 1 != capacity)
+            {
+                // the ring is empty and unreferenced while stopped
+                m_records.reset(new Record[capacity]);
+                for (size_t recordIndex = 0; recordIndex < capacity; ++recordIndex)
+                {
+                    m_records[recordIndex].sequence.store(recordIndex, std::memory_order_relaxed);
+                }
+                m_mask = capacity - 1;
+                m_enqueuePos.store(0, std::memory_order_relaxed);
+                m_dequeuePos.store(0, std::memory_order_relaxed);
+            }
+            m_flushIntervalMs = (std::max)(flushIntervalMs, 1u);
+            m_stop = false;
+            m_thread = std::thread(&AsyncLogger::ThreadProc, this);
+            m_enabled.store(true, std::memory_order_release);
+            return true;
+        }
+
+        // Waits for in-flight Push() calls, then drains the ring on the calling thread once the writer has exited.
+        void Stop()
+        {
+            if (!m_thread.joinable())
+            {
+                return;
+            }
+            m_enabled.store(false);
+            while (m_numActivePushes.load())
+            {
+                std::this_thread::yield();
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_wake.notify_one();
+            m_drained.notify_all();
+            m_thread.join();
+            Drain();
+        }
+
+        // Returns false if asynchronous logging is off, in which case the caller writes the message itself.
+        bool Push(LogSeverity severity, const char* pFunctionName, const char* pFormat, va_list args)
+        {
+            // cheap early out for the common case of asynchronous logging never being enabled; a stale value either way is caught below, or
+            // only means that a message racing Start() is written synchronously
+            if (!m_enabled.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+            // sequentially consistent, pairing with Stop(): either Stop() sees this push in flight, or this push sees the logger disabled
+            m_numActivePushes.fetch_add(1);
+            if (!m_enabled.load())
+            {
+                m_numActivePushes.fetch_sub(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+            Record* pRecord = nullptr;
+            for (;;)
+            {
+                pRecord = &m_records[pos & m_mask];
+                const size_t sequence = pRecord->sequence.load(std::memory_order_acquire);
+                const ptrdiff_t difference = ptrdiff_t(sequence - pos);
+                if (difference == 0)
+                {
+                    if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    m_numDropped.fetch_add(1, std::memory_order_relaxed);
+                    m_numActivePushes.fetch_sub(1, std::memory_order_release);
+                    return true;
+                }
+                else
+                {
+                    pos = m_enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+
+            pRecord->severity = severity;
+            pRecord->pFunctionName = pFunctionName;
+            GetTimeStamp(&pRecord->timestamp);
+            const int length = vsnprintf(pRecord->message, sizeof(pRecord->message), pFormat, args);
+            if (length < 0)
+            {
+                pRecord->message[0] = '\0';
+            }
+            else if (size_t(length) >= sizeof(pRecord->message))
+            {
+                memcpy(pRecord->message + sizeof(pRecord->message) - 5, "...\n", 5);
+            }
+            pRecord->sequence.store(pos + 1, std::memory_order_release);
+
+            // everything else waits for the flush interval; notifying without the mutex can be missed, which only costs one interval
+            const size_t numPending = pos + 1 - m_dequeuePos.load(std::memory_order_relaxed);
+            if (severity >= GetLogSettingsStorage_()->flushFileSeverity || numPending > m_mask / 2)
+            {
+                if (!m_wakeRequested.exchange(true, std::memory_order_relaxed))
+                {
+                    m_wake.notify_one();
+                }
+            }
+            m_numActivePushes.fetch_sub(1, std::memory_order_release);
+            return true;
+        }
+
+        // Blocks until every record pushed before this call has been written, then flushes the log file.
+        void Flush()
+        {
+            if (m_thread.joinable())
+            {
+                const size_t targetPos = m_enqueuePos.load(std::memory_order_acquire);
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wakeRequested.store(true, std::memory_order_relaxed);
+                m_wake.notify_one();
+                m_drained.wait(lock, [&] { return m_stop || ptrdiff_t(m_dequeuePos.load(std::memory_order_acquire) - targetPos) >= 0; });
+            }
+            LogSettings& settings = *GetLogSettingsStorage_();
+            if (settings.writeFileFD)
+            {
+                UserLogImplFileFlush(settings.writeFileFD);
+            }
+        }
+
+        uint64_t GetNumDropped() const
+        {
+            return m_numDropped.load(std::memory_order_relaxed);
+        }
+
+    private:
+        void Drain()
+        {
+            if (!m_records)
+            {
+                return;
+            }
+            LogSettings& settings = *GetLogSettingsStorage_();
+            bool flushFile = false;
+            size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Record& record = m_records[pos & m_mask];
+                if (record.sequence.load(std::memory_order_acquire) != pos + 1)
+                {
+                    break;
+                }
+                UserLogWriteSinks(record.severity, &record.timestamp, record.pFunctionName, record.message);
+                flushFile |= (record.severity >= settings.flushFileSeverity);
+                record.sequence.store(pos + m_mask + 1, std::memory_order_release);
+                ++pos;
+                m_dequeuePos.store(pos, std::memory_order_release);
+            }
+
+            const uint64_t numDropped = m_numDropped.load(std::memory_order_relaxed);
+            if (numDropped != m_numDroppedReported)
+            {
+                char message[128];
+                snprintf(message, sizeof(message), "%llu log messages were dropped, the asynchronous log ring was full\n", (unsigned long long)(numDropped - m_numDroppedReported));
+                m_numDroppedReported = numDropped;
+                LogTimeStamp timestamp;
+                GetTimeStamp(&timestamp);
+                UserLogWriteSinks(LogSeverity::Wrn, &timestamp, "AsyncLogger", message);
+                flushFile |= (LogSeverity::Wrn >= settings.flushFileSeverity);
+            }
+
+            if (flushFile && settings.writeFileFD)
+            {
+                UserLogImplFileFlush(settings.writeFileFD);
+            }
+        }
+
+        void ThreadProc()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            while (!m_stop)
+            {
+                lock.unlock();
+                Drain();
+                lock.lock();
+                m_drained.notify_all();
+                m_wake.wait_for(lock, std::chrono::milliseconds(m_flushIntervalMs), [&] { return m_stop || m_wakeRequested.load(std::memory_order_relaxed); });
+                m_wakeRequested.store(false, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    inline AsyncLogger* GetAsyncLoggerStorage_()
+    {
+        static AsyncLogger logger;
+        return &logger;
+    }
+
+    // With asynchronous logging enabled, NV_PERF_LOG_* only formats into a preallocated ring, and a background thread writes to the sinks.
+    // The custom log callback is then invoked on that thread. Sinks should only be reconfigured while it is disabled.
+    // Can also be enabled with the NV_PERF_LOG_ASYNC environment variable.
+    inline bool UserLogEnableAsync(bool enable, size_t numRecords = 1024, uint32_t flushIntervalMs = 50)
+    {
+        AsyncLogger* pLogger = GetAsyncLoggerStorage_();
+        if (!enable)
+        {
+            pLogger->Stop();
+            return true;
+        }
+        return pLogger->Start(numRecords, flushIntervalMs);
+    }
+
+    // Waits for pending asynchronous messages to be written, and flushes the log file.
+    inline void UserLogFlush()
+    {
+        GetAsyncLoggerStorage_()->Flush();
+    }
+
+    inline UserLogStats GetUserLogStats()
+    {
+        UserLogStats stats = {};
+        stats.numRateLimited = GetLogRateLimiterStorage_()->GetNumRateLimited();
+        stats.numDropped = GetAsyncLoggerStorage_()->GetNumDropped();
+        return stats;
+    }
+
+    inline void UserLog(LogSeverity severity, uint32_t level, const char* pFunctionName, const char* pFormat, ...)
+    {
+        const uint32_t volumeLevel = GetLogVolumeLevel(severity);
+        if (volumeLevel < level)
+        {
+            return;
+        }
+
+        LogSettings& settings = *GetLogSettingsStorage_();
+        if (settings.rateLimitPerCallsite && !GetLogRateLimiterStorage_()->Admit(pFormat, settings.rateLimitPerCallsite))
+        {
+            return;
+        }
+
+        va_list args;
+
+        va_start(args, pFormat);
+        const bool queued = GetAsyncLoggerStorage_()->Push(severity, pFunctionName, pFormat, args);
+        va_end(args);
+        if (queued)
+        {
+            return;
+        }
+
+        // most messages fit on the stack; only longer ones are formatted a second time into a heap buffer
+        char buffer[512];
+        std::string longMessage;
+        const char* pMessage = buffer;
+        va_start(args, pFormat);
+        const int length = vsnprintf(buffer, sizeof(buffer), pFormat, args);
+        va_end(args);
+        if (length < 0)
+        {
+            buffer[0] = '\0';
+        }
+        else if (size_t(length) >= sizeof(buffer))
+        {
+            longMessage.resize(size_t(length) + 1);
+            va_start(args, pFormat);
+            vsnprintf(&longMessage[0], longMessage.size(), pFormat, args);
+            va_end(args);
+            pMessage = longMessage.c_str();
+        }
+
+        LogTimeStamp timestamp = {};
+        if (settings.logDate || settings.logTime)
+        {
+            GetTimeStamp(&timestamp);
+        }
+        UserLogWriteSinks(severity, &timestamp, pFunctionName, pMessage);
+        if (settings.writeFileFD && severity >= settings.flushFileSeverity)
+        {
+            UserLogImplFileFlush(settings.writeFileFD);
+        }
+    }
+
     inline std::string FormatStatus(NVPA_Status nvpaStatus)
     {
         const char* pStatusStr = "";
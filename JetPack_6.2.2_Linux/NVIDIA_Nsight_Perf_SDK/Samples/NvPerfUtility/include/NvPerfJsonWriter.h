@@ -0,0 +1,334 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#if defined(__has_include)
+#if __has_include(<charconv>) && ((defined(_MSVC_LANG) && _MSVC_LANG >= 201703L) || __cplusplus >= 201703L)
+#include <charconv>
+#endif
+#endif
+#include "NvPerfInit.h"
+
+// floating point std::to_chars() came much later than the integer overloads, __cpp_lib_to_chars is only defined once both are present
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define NV_PERF_HAS_FLOATING_POINT_TO_CHARS 1
+#else
+#define NV_PERF_HAS_FLOATING_POINT_TO_CHARS 0
+#endif
+
+namespace nv { namespace perf {
+
+    enum { MaxFormattedDoubleLength = 32 }; // "-1.2345678901234567e-308" plus slack
+
+    // Formats "value" with the fewest significant digits that parse back to the same double, e.g. 0.1 becomes "0.1" rather than "0.100000".
+    // "pBuffer" must hold at least MaxFormattedDoubleLength + 1 chars; returns the length, not including the null terminator.
+    // Non-finite values are left to the caller, since JSON has no representation for them.
+    inline size_t FormatShortestDouble(double value, char* pBuffer)
+    {
+#if NV_PERF_HAS_FLOATING_POINT_TO_CHARS
+        const std::to_chars_result result = std::to_chars(pBuffer, pBuffer + MaxFormattedDoubleLength, value);
+        if (result.ec == std::errc())
+        {
+            *result.ptr = '\0';
+            return size_t(result.ptr - pBuffer);
+        }
+#endif
+        // integral values are by far the most common in counter data, and need no round-trip check
+        if (value == floor(value) && fabs(value) < 9007199254740992.0) // 2^53
+        {
+            char digits[24];
+            size_t numDigits = 0;
+            uint64_t magnitude = (uint64_t)fabs(value);
+            do
+            {
+                digits[numDigits++] = char('0' + magnitude % 10);
+                magnitude /= 10;
+            } while (magnitude);
+
+            size_t length = 0;
+            if (value < 0)
+            {
+                pBuffer[length++] = '-';
+            }
+            while (numDigits)
+            {
+                pBuffer[length++] = digits[--numDigits];
+            }
+            pBuffer[length] = '\0';
+            return length;
+        }
+
+        // 15 digits are enough for most values, 17 for all of them
+        int length = 0;
+        for (int precision = 15; precision <= 17; ++precision)
+        {
+            length = snprintf(pBuffer, MaxFormattedDoubleLength + 1, "%.*g", precision, value);
+            if (precision == 17 || strtod(pBuffer, nullptr) == value)
+            {
+                break;
+            }
+        }
+        return length > 0 ? size_t(length) : 0;
+    }
+
+    // Appends into a caller-owned std::string.
+    class StringSink
+    {
+    private:
+        std::string& m_string;
+
+    public:
+        explicit StringSink(std::string& str)
+            : m_string(str)
+        {
+        }
+
+        void Append(const char* pData, size_t size)
+        {
+            m_string.append(pData, size);
+        }
+
+        void Append(char c)
+        {
+            m_string.push_back(c);
+        }
+    };
+
+    // Accumulates output in a fixed-size buffer and hands it to the file in large writes. The buffer survives Close(), so a single sink can
+    // write any number of files back-to-back without reallocating.
+    class BufferedFileSink
+    {
+    private:
+        std::vector<char> m_buffer;
+        size_t m_size;
+        FILE* m_pFile;
+        bool m_writeFailed;
+
+    public:
+        explicit BufferedFileSink(size_t bufferSize = 256 * 1024)
+            : m_buffer((std::max)(bufferSize, size_t(MaxFormattedDoubleLength + 1)))
+            , m_size(0)
+            , m_pFile(nullptr)
+            , m_writeFailed(false)
+        {
+        }
+        BufferedFileSink(const BufferedFileSink& sink) = delete;
+        BufferedFileSink& operator=(const BufferedFileSink& sink) = delete;
+        BufferedFileSink(BufferedFileSink&& sink)
+            : m_buffer(std::move(sink.m_buffer))
+            , m_size(sink.m_size)
+            , m_pFile(sink.m_pFile)
+            , m_writeFailed(sink.m_writeFailed)
+        {
+            sink.m_size = 0;
+            sink.m_pFile = nullptr;
+        }
+        ~BufferedFileSink()
+        {
+            Close();
+        }
+
+        bool Open(const char* pFileName)
+        {
+            Close();
+            m_pFile = OpenFile(pFileName, "wb");
+            if (!m_pFile)
+            {
+                NV_PERF_LOG_ERR(20, "OpenFile failed for file: %s\n", pFileName);
+                return false;
+            }
+            setvbuf(m_pFile, nullptr, _IONBF, 0); // already buffered here
+            m_writeFailed = false;
+            return true;
+        }
+
+        bool IsOpen() const
+        {
+            return !!m_pFile;
+        }
+
+        // Returns false if any write since Open() failed.
+        bool Close()
+        {
+            if (!m_pFile)
+            {
+                return true;
+            }
+            Flush();
+            const bool success = !m_writeFailed && !fclose(m_pFile);
+            m_pFile = nullptr;
+            return success;
+        }
+
+        void Flush()
+        {
+            if (m_size && m_pFile)
+            {
+                if (fwrite(m_buffer.data(), 1, m_size, m_pFile) != m_size)
+                {
+                    m_writeFailed = true;
+                }
+            }
+            m_size = 0;
+        }
+
+        void Append(const char* pData, size_t size)
+        {
+            if (m_size + size > m_buffer.size())
+            {
+                Flush();
+                if (size > m_buffer.size())
+                {
+                    // e.g. a report template; copying it through the buffer would only add work
+                    if (m_pFile && fwrite(pData, 1, size, m_pFile) != size)
+                    {
+                        m_writeFailed = true;
+                    }
+                    return;
+                }
+            }
+            memcpy(m_buffer.data() + m_size, pData, size);
+            m_size += size;
+        }
+
+        void Append(char c)
+        {
+            if (m_size == m_buffer.size())
+            {
+                Flush();
+            }
+            m_buffer[m_size++] = c;
+        }
+    };
+
+    // Writes JSON tokens straight into a sink, without building intermediate strings. Structure (braces, commas, whitespace) is written with
+    // Raw(), which leaves it to the caller to produce well-formed output.
+    template <class TSink>
+    class JsonWriter
+    {
+    private:
+        TSink& m_sink;
+
+    public:
+        explicit JsonWriter(TSink& sink)
+            : m_sink(sink)
+        {
+        }
+
+        TSink& GetSink()
+        {
+            return m_sink;
+        }
+
+        JsonWriter& Raw(const char* pData, size_t size)
+        {
+            m_sink.Append(pData, size);
+            return *this;
+        }
+
+        JsonWriter& Raw(const char* pStr)
+        {
+            return Raw(pStr, strlen(pStr));
+        }
+
+        JsonWriter& Raw(const std::string& str)
+        {
+            return Raw(str.data(), str.size());
+        }
+
+        JsonWriter& Raw(char c)
+        {
+            m_sink.Append(c);
+            return *this;
+        }
+
+        // Quoted and escaped.
+        JsonWriter& String(const char* pData, size_t size)
+        {
+            m_sink.Append('"');
+            size_t runBegin = 0;
+            for (size_t ii = 0; ii < size; ++ii)
+            {
+                const unsigned char c = (unsigned char)pData[ii];
+                if (c >= 0x20 && c != '"' && c != '\\')
+                {
+                    continue;
+                }
+                m_sink.Append(pData + runBegin, ii - runBegin);
+                runBegin = ii + 1;
+                if (c == '"' || c == '\\')
+                {
+                    const char escaped[2] = { '\\', char(c) };
+                    m_sink.Append(escaped, 2);
+                }
+                else
+                {
+                    const char hexDigits[] = "0123456789abcdef";
+                    const char escaped[6] = { '\\', 'u', '0', '0', hexDigits[c >> 4], hexDigits[c & 0xf] };
+                    m_sink.Append(escaped, 6);
+                }
+            }
+            m_sink.Append(pData + runBegin, size - runBegin);
+            m_sink.Append('"');
+            return *this;
+        }
+
+        JsonWriter& String(const char* pStr)
+        {
+            return String(pStr, strlen(pStr));
+        }
+
+        JsonWriter& String(const std::string& str)
+        {
+            return String(str.data(), str.size());
+        }
+
+        // Non-finite values are written as the strings "NaN", "Infinity" and "-Infinity", which the report's JavaScript converts back.
+        JsonWriter& Double(double value)
+        {
+            if (isnan(value))
+            {
+                return Raw("\"NaN\"", 5);
+            }
+            if (isinf(value))
+            {
+                return value < 0 ? Raw("\"-Infinity\"", 11) : Raw("\"Infinity\"", 10);
+            }
+            char buffer[MaxFormattedDoubleLength + 1];
+            const size_t length = FormatShortestDouble(value, buffer);
+            return Raw(buffer, length);
+        }
+
+        JsonWriter& Integer(int64_t value)
+        {
+            char buffer[24];
+            const int length = snprintf(buffer, sizeof(buffer), "%lld", (long long)value);
+            return Raw(buffer, size_t(length));
+        }
+    };
+
+}}
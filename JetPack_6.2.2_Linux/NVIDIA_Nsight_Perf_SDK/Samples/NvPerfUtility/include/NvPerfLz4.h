@@ -0,0 +1,204 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#pragma once
+
+#include <string.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace nv { namespace perf {
+
+    // A codec for the LZ4 block format (https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md), which embedded data like the report
+    // definitions is stored in. Decompression needs neither tables nor a dependency, and runs at memory speed; the compressor searches hash
+    // chains for the longest match, which trades compression time, spent once at build time, for ratio.
+
+    // Returns false if "pSrc" is not a well-formed block that decompresses to exactly "dstSize" bytes.
+    inline bool Lz4DecompressBlock(const uint8_t* pSrc, size_t srcSize, uint8_t* pDst, size_t dstSize)
+    {
+        const uint8_t* pSrcEnd = pSrc + srcSize;
+        size_t dstPos = 0;
+        auto readLength = [&](size_t& length) {
+            uint8_t byte = 255;
+            while (byte == 255)
+            {
+                if (pSrc == pSrcEnd)
+                {
+                    return false;
+                }
+                byte = *pSrc++;
+                length += byte;
+            }
+            return true;
+        };
+
+        while (pSrc < pSrcEnd)
+        {
+            const uint8_t token = *pSrc++;
+            size_t literalLength = token >> 4;
+            if (literalLength == 15 && !readLength(literalLength))
+            {
+                return false;
+            }
+            if ((size_t)(pSrcEnd - pSrc) < literalLength || dstSize - dstPos < literalLength)
+            {
+                return false;
+            }
+            memcpy(pDst + dstPos, pSrc, literalLength);
+            pSrc += literalLength;
+            dstPos += literalLength;
+            if (pSrc == pSrcEnd)
+            {
+                break; // the last sequence has no match
+            }
+
+            if (pSrcEnd - pSrc < 2)
+            {
+                return false;
+            }
+            const size_t offset = pSrc[0] | (size_t(pSrc[1]) << 8);
+            pSrc += 2;
+            size_t matchLength = token & 15;
+            if (matchLength == 15 && !readLength(matchLength))
+            {
+                return false;
+            }
+            matchLength += 4;
+            if (!offset || offset > dstPos || dstSize - dstPos < matchLength)
+            {
+                return false;
+            }
+            const uint8_t* pMatch = pDst + dstPos - offset;
+            if (offset >= matchLength)
+            {
+                memcpy(pDst + dstPos, pMatch, matchLength);
+                dstPos += matchLength;
+            }
+            else
+            {
+                // the match overlaps the bytes it produces, e.g. a run of one repeated byte
+                for (size_t ii = 0; ii < matchLength; ++ii)
+                {
+                    pDst[dstPos++] = pMatch[ii];
+                }
+            }
+        }
+        return dstPos == dstSize;
+    }
+
+    // "maxAttempts" bounds the number of earlier positions compared per position.
+    inline std::vector<uint8_t> Lz4CompressBlock(const uint8_t* pSrc, size_t srcSize, size_t maxAttempts = 1024)
+    {
+        // limits of the format: a match must start 12 bytes and end 5 bytes before the end of the block, and be at most 64 KB away
+        const size_t MinMatchLength = 4;
+        const size_t MatchFindLimit = 12;
+        const size_t LastLiterals = 5;
+        const size_t MaxOffset = 65535;
+        const uint32_t HashBits = 16;
+        const uint32_t NoPosition = ~uint32_t(0);
+
+        std::vector<uint8_t> compressed;
+        compressed.reserve(srcSize / 2 + 16);
+        auto writeLength = [&](size_t length) {
+            for (; length >= 255; length -= 255)
+            {
+                compressed.push_back(255);
+            }
+            compressed.push_back(static_cast<uint8_t>(length));
+        };
+        auto writeSequence = [&](size_t literalBegin, size_t literalEnd, size_t offset, size_t matchLength) {
+            const size_t literalLength = literalEnd - literalBegin;
+            const size_t matchCode = matchLength ? matchLength - MinMatchLength : 0;
+            compressed.push_back(static_cast<uint8_t>(((literalLength < 15 ? literalLength : 15) << 4) | (matchCode < 15 ? matchCode : 15)));
+            if (literalLength >= 15)
+            {
+                writeLength(literalLength - 15);
+            }
+            compressed.insert(compressed.end(), pSrc + literalBegin, pSrc + literalEnd);
+            if (!matchLength)
+            {
+                return;
+            }
+            compressed.push_back(static_cast<uint8_t>(offset));
+            compressed.push_back(static_cast<uint8_t>(offset >> 8));
+            if (matchCode >= 15)
+            {
+                writeLength(matchCode - 15);
+            }
+        };
+
+        // every position is linked to the previous one with the same hash of its first 4 bytes
+        std::vector<uint32_t> hashHeads(size_t(1) << HashBits, NoPosition);
+        std::vector<uint32_t> previousPositions(srcSize, NoPosition);
+        auto hash = [&](size_t pos) {
+            uint32_t value;
+            memcpy(&value, pSrc + pos, sizeof(value));
+            return (value * 2654435761u) >> (32 - HashBits);
+        };
+        size_t numLinked = 0;
+        auto linkUpTo = [&](size_t end) {
+            for (; numLinked < end; ++numLinked)
+            {
+                uint32_t& head = hashHeads[hash(numLinked)];
+                previousPositions[numLinked] = head;
+                head = static_cast<uint32_t>(numLinked);
+            }
+        };
+
+        size_t anchor = 0;
+        size_t pos = 0;
+        while (srcSize > MatchFindLimit && pos < srcSize - MatchFindLimit)
+        {
+            linkUpTo(pos);
+            const size_t maxMatchLength = srcSize - LastLiterals - pos;
+            size_t bestLength = 0;
+            size_t bestOffset = 0;
+            uint32_t candidate = hashHeads[hash(pos)];
+            for (size_t attempt = 0; attempt < maxAttempts && candidate != NoPosition && pos - candidate <= MaxOffset; ++attempt)
+            {
+                size_t length = 0;
+                while (length < maxMatchLength && pSrc[candidate + length] == pSrc[pos + length])
+                {
+                    ++length;
+                }
+                if (length > bestLength)
+                {
+                    bestLength = length;
+                    bestOffset = pos - candidate;
+                    if (length == maxMatchLength)
+                    {
+                        break;
+                    }
+                }
+                candidate = previousPositions[candidate];
+            }
+
+            if (bestLength < MinMatchLength)
+            {
+                ++pos;
+                continue;
+            }
+            writeSequence(anchor, pos, bestOffset, bestLength);
+            pos += bestLength;
+            anchor = pos;
+        }
+        writeSequence(anchor, srcSize, 0, 0);
+        return compressed;
+    }
+
+} }
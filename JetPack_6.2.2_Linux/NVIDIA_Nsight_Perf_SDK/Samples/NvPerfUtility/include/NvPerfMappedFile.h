@@ -0,0 +1,341 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include "NvPerfInit.h"
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace nv { namespace perf {
+
+    // A file mapped into memory in its entirety. Writable mappings can grow, which remaps the file, so pointers returned by Data() are only
+    // valid until the next Resize().
+    class MappedFile
+    {
+    private:
+#if defined(_WIN32)
+        HANDLE m_hFile;
+        HANDLE m_hMapping;
+#else
+        int m_fd;
+#endif
+        uint8_t* m_pData;
+        size_t m_size;
+        bool m_writable;
+
+    public:
+        MappedFile()
+#if defined(_WIN32)
+            : m_hFile(INVALID_HANDLE_VALUE)
+            , m_hMapping(NULL)
+#else
+            : m_fd(-1)
+#endif
+            , m_pData(nullptr)
+            , m_size(0)
+            , m_writable(false)
+        {
+        }
+        MappedFile(const MappedFile& file) = delete;
+        MappedFile& operator=(const MappedFile& file) = delete;
+        ~MappedFile()
+        {
+            Close();
+        }
+
+        // creates or truncates the file
+        bool Create(const std::string& path, size_t size)
+        {
+            Close();
+            m_writable = true;
+#if defined(_WIN32)
+            m_hFile = ::CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+            if (m_hFile == INVALID_HANDLE_VALUE)
+            {
+                NV_PERF_LOG_ERR(20, "Failed to create file %s\n", path.c_str());
+                return false;
+            }
+#else
+            m_fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+            if (m_fd < 0)
+            {
+                NV_PERF_LOG_ERR(20, "Failed to create file %s\n", path.c_str());
+                return false;
+            }
+#endif
+            return Resize(size);
+        }
+
+        bool OpenReadOnly(const std::string& path)
+        {
+            Close();
+            m_writable = false;
+#if defined(_WIN32)
+            m_hFile = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+            if (m_hFile == INVALID_HANDLE_VALUE)
+            {
+                NV_PERF_LOG_ERR(20, "Failed to open file %s\n", path.c_str());
+                return false;
+            }
+            LARGE_INTEGER fileSize;
+            if (!::GetFileSizeEx(m_hFile, &fileSize))
+            {
+                NV_PERF_LOG_ERR(20, "Failed to query the size of %s\n", path.c_str());
+                Close();
+                return false;
+            }
+            m_size = (size_t)fileSize.QuadPart;
+#else
+            m_fd = ::open(path.c_str(), O_RDONLY);
+            if (m_fd < 0)
+            {
+                NV_PERF_LOG_ERR(20, "Failed to open file %s\n", path.c_str());
+                return false;
+            }
+            struct stat fileStat;
+            if (::fstat(m_fd, &fileStat) != 0)
+            {
+                NV_PERF_LOG_ERR(20, "Failed to query the size of %s\n", path.c_str());
+                Close();
+                return false;
+            }
+            m_size = (size_t)fileStat.st_size;
+#endif
+            if (!m_size)
+            {
+                return true; // nothing to map
+            }
+            if (!Map())
+            {
+                Close();
+                return false;
+            }
+            return true;
+        }
+
+        // changes the file size of a writable mapping, and remaps it. A failed grow keeps the previous mapping and size; a failed shrink,
+        // or a failed remap after it, may leave the file unmapped, in which case Size() is 0.
+        bool Resize(size_t size)
+        {
+            if (!m_writable)
+            {
+                NV_PERF_LOG_ERR(20, "Cannot resize a read-only mapping\n");
+                return false;
+            }
+            if (size < m_size || !m_pData)
+            {
+                return ResizeUnmapped(size);
+            }
+            if (size == m_size)
+            {
+                return true;
+            }
+
+            // grow next to the current mapping, which is only released once the new one is in place
+#if !defined(_WIN32)
+            if (!SetFileSize(size)) // on Windows, CreateFileMapping() grows the file instead
+            {
+                return false;
+            }
+#endif
+            uint8_t* const pPreviousData = m_pData;
+            const size_t previousSize = m_size;
+#if defined(_WIN32)
+            const HANDLE hPreviousMapping = m_hMapping;
+            m_hMapping = NULL;
+#endif
+            m_pData = nullptr;
+            m_size = size;
+            if (!Map())
+            {
+                m_pData = pPreviousData;
+                m_size = previousSize;
+#if defined(_WIN32)
+                m_hMapping = hPreviousMapping;
+#else
+                SetFileSize(previousSize); // best effort, the file only keeps some unused space otherwise
+#endif
+                return false;
+            }
+#if defined(_WIN32)
+            ::UnmapViewOfFile(pPreviousData);
+            ::CloseHandle(hPreviousMapping);
+#else
+            ::munmap(pPreviousData, previousSize);
+#endif
+            return true;
+        }
+
+        // writes dirty pages back to the file
+        bool Flush()
+        {
+            if (!m_pData || !m_writable)
+            {
+                return true;
+            }
+#if defined(_WIN32)
+            if (!::FlushViewOfFile(m_pData, m_size))
+#else
+            if (::msync(m_pData, m_size, MS_SYNC) != 0)
+#endif
+            {
+                NV_PERF_LOG_ERR(20, "Failed to flush the mapped file\n");
+                return false;
+            }
+            return true;
+        }
+
+        void Close()
+        {
+            Unmap();
+#if defined(_WIN32)
+            if (m_hFile != INVALID_HANDLE_VALUE)
+            {
+                ::CloseHandle(m_hFile);
+                m_hFile = INVALID_HANDLE_VALUE;
+            }
+#else
+            if (m_fd >= 0)
+            {
+                ::close(m_fd);
+                m_fd = -1;
+            }
+#endif
+            m_size = 0;
+        }
+
+        bool IsOpen() const
+        {
+#if defined(_WIN32)
+            return m_hFile != INVALID_HANDLE_VALUE;
+#else
+            return m_fd >= 0;
+#endif
+        }
+
+        uint8_t* Data()
+        {
+            return m_pData;
+        }
+
+        const uint8_t* Data() const
+        {
+            return m_pData;
+        }
+
+        size_t Size() const
+        {
+            return m_size;
+        }
+
+    private:
+        // shrinking has to unmap first: the pages beyond the new end must not stay mapped, and Windows cannot truncate a mapped file
+        bool ResizeUnmapped(size_t size)
+        {
+            Unmap();
+            if (!SetFileSize(size))
+            {
+                if (m_size && !Map())
+                {
+                    m_size = 0;
+                }
+                return false;
+            }
+            m_size = size;
+            if (m_size && !Map())
+            {
+                m_size = 0;
+                return false;
+            }
+            return true;
+        }
+
+        bool SetFileSize(size_t size)
+        {
+#if defined(_WIN32)
+            LARGE_INTEGER fileSize;
+            fileSize.QuadPart = (LONGLONG)size;
+            if (!::SetFilePointerEx(m_hFile, fileSize, NULL, FILE_BEGIN) || !::SetEndOfFile(m_hFile))
+#else
+            if (::ftruncate(m_fd, (off_t)size) != 0)
+#endif
+            {
+                NV_PERF_LOG_ERR(20, "Failed to resize file to %zu bytes\n", size);
+                return false;
+            }
+            return true;
+        }
+
+        bool Map()
+        {
+#if defined(_WIN32)
+            const DWORD protect = m_writable ? PAGE_READWRITE : PAGE_READONLY;
+            m_hMapping = ::CreateFileMappingA(m_hFile, NULL, protect, (DWORD)((uint64_t)m_size >> 32), (DWORD)(m_size & 0xffffffff), NULL);
+            if (!m_hMapping)
+            {
+                NV_PERF_LOG_ERR(20, "CreateFileMapping failed\n");
+                return false;
+            }
+            const DWORD access = m_writable ? FILE_MAP_WRITE : FILE_MAP_READ;
+            m_pData = static_cast<uint8_t*>(::MapViewOfFile(m_hMapping, access, 0, 0, m_size));
+            if (!m_pData)
+            {
+                NV_PERF_LOG_ERR(20, "MapViewOfFile failed\n");
+                ::CloseHandle(m_hMapping);
+                m_hMapping = NULL;
+                return false;
+            }
+#else
+            const int protect = m_writable ? (PROT_READ | PROT_WRITE) : PROT_READ;
+            void* pData = ::mmap(nullptr, m_size, protect, MAP_SHARED, m_fd, 0);
+            if (pData == MAP_FAILED)
+            {
+                NV_PERF_LOG_ERR(20, "mmap failed\n");
+                return false;
+            }
+            m_pData = static_cast<uint8_t*>(pData);
+#endif
+            return true;
+        }
+
+        void Unmap()
+        {
+            if (!m_pData)
+            {
+                return;
+            }
+#if defined(_WIN32)
+            ::UnmapViewOfFile(m_pData);
+            ::CloseHandle(m_hMapping);
+            m_hMapping = NULL;
+#else
+            ::munmap(m_pData, m_size);
+#endif
+            m_pData = nullptr;
+        }
+    };
+
+}}
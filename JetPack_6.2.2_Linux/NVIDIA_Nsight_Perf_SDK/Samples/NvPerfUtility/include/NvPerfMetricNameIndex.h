@@ -0,0 +1,484 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <string.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+#include "NvPerfHash.h"
+#include "NvPerfInit.h"
+#include "NvPerfMetricsEvaluator.h"
+#include "NvPerfScopeExitGuard.h"
+
+namespace nv { namespace perf {
+
+    // Resolves metric names without going through NVPW's string parsing. Built once per metrics evaluator from EnumerateCounters(),
+    // EnumerateRatios() and EnumerateThroughputs(): base metric names go into an open-addressing hash table, and a full name such as
+    // "sm__throughput.avg.pct_of_peak_sustained_elapsed" is resolved with a probe for the base name plus a match of its rollup and submetric
+    // suffixes against the ones supported by the metric type. Base names may contain '.' themselves (e.g. "PCI.TriageA.pcie__throughput"),
+    // so the name is probed at each '.' from the right until a base name and its suffixes match. With "cacheProperties", the description,
+    // HW unit and dim units (per supported submetric) of every metric are queried up front as well.
+    // Once built, the index is immutable: any number of threads may call the const member functions concurrently, except that property
+    // lookups fall back to the metrics evaluator if the properties are not cached, which is not safe for concurrent use.
+    class MetricNameIndex
+    {
+    private:
+        enum : uint32_t { InvalidOffset = ~uint32_t(0) };
+        enum : uint8_t { InvalidSlot = 0xff };
+
+        struct Entry
+        {
+            const char* pName; // points to the .RO section of the library, see MetricsEnumerator
+            uint32_t nameLength;
+            uint32_t hash;
+            uint32_t metricIndex;
+            uint8_t metricType;
+            NVPW_HwUnit hwUnit;
+            uint32_t descriptionOffset; // into m_stringPool
+            uint32_t hwUnitNameOffset;  // into m_stringPool
+            uint32_t firstDimUnitsRange;// into m_dimUnitsRanges, one range per supported submetric of the metric type
+        };
+
+        struct DimUnitsRange
+        {
+            uint32_t offset; // into m_dimUnitFactors
+            uint32_t count;  // 0 if the query failed, or the metric is dimensionless
+        };
+
+        struct PerMetricType
+        {
+            size_t firstEntry;
+            size_t numEntries;
+            std::vector<NVPW_Submetric> submetrics; // the supported ones, in the order of DimUnitsRanges
+            uint8_t submetricSlots[NVPW_SUBMETRIC__COUNT];
+        };
+
+        NVPW_MetricsEvaluator* m_pMetricsEvaluator;
+        std::vector<Entry> m_entries;
+        std::vector<uint32_t> m_hashTable; // entry index + 1, 0 for empty buckets; the size is a power of 2
+        PerMetricType m_perMetricType[NVPW_METRIC_TYPE__COUNT];
+        std::vector<char> m_stringPool;
+        std::vector<DimUnitsRange> m_dimUnitsRanges;
+        std::vector<NVPW_DimUnitFactor> m_dimUnitFactors;
+        bool m_hasProperties;
+
+    public:
+        MetricNameIndex()
+            : m_pMetricsEvaluator()
+            , m_perMetricType()
+            , m_hasProperties(false)
+        {
+        }
+        MetricNameIndex(const MetricNameIndex& index) = delete;
+        MetricNameIndex& operator=(const MetricNameIndex& index) = delete;
+        MetricNameIndex(MetricNameIndex&& index) = default;
+        MetricNameIndex& operator=(MetricNameIndex&& index) = default;
+
+        // "pMetricsEvaluator" must outlive the index unless "cacheProperties" is set
+        bool Build(NVPW_MetricsEvaluator* pMetricsEvaluator, bool cacheProperties = true)
+        {
+            Reset();
+            auto resetOnFailure = ScopeExitGuard([&]() {
+                Reset();
+            });
+
+            for (size_t metricType = 0; metricType < NVPW_METRIC_TYPE__COUNT; ++metricType)
+            {
+                PerMetricType& perType = m_perMetricType[metricType];
+                if (!GetSupportedSubmetrics(pMetricsEvaluator, static_cast<NVPW_MetricType>(metricType), perType.submetrics))
+                {
+                    return false;
+                }
+                // the submetric is optional for counters
+                if (metricType == NVPW_METRIC_TYPE_COUNTER && std::find(perType.submetrics.begin(), perType.submetrics.end(), NVPW_SUBMETRIC_NONE) == perType.submetrics.end())
+                {
+                    perType.submetrics.insert(perType.submetrics.begin(), NVPW_SUBMETRIC_NONE);
+                }
+                memset(perType.submetricSlots, InvalidSlot, sizeof(perType.submetricSlots));
+                for (size_t slot = 0; slot < perType.submetrics.size(); ++slot)
+                {
+                    if ((size_t)perType.submetrics[slot] < NVPW_SUBMETRIC__COUNT)
+                    {
+                        perType.submetricSlots[perType.submetrics[slot]] = (uint8_t)slot;
+                    }
+                }
+
+                const MetricsEnumerator enumerator = EnumerateMetrics(pMetricsEvaluator, static_cast<NVPW_MetricType>(metricType));
+                perType.firstEntry = m_entries.size();
+                perType.numEntries = enumerator.size();
+                for (size_t metricIndex = 0; metricIndex < enumerator.size(); ++metricIndex)
+                {
+                    Entry entry = {};
+                    entry.pName = enumerator[metricIndex];
+                    entry.nameLength = (uint32_t)strlen(entry.pName);
+                    entry.hash = Fnv1a32(entry.pName, entry.nameLength);
+                    entry.metricIndex = (uint32_t)metricIndex;
+                    entry.metricType = (uint8_t)metricType;
+                    entry.hwUnit = NVPW_HW_UNIT_INVALID;
+                    entry.descriptionOffset = InvalidOffset;
+                    entry.hwUnitNameOffset = InvalidOffset;
+                    entry.firstDimUnitsRange = InvalidOffset;
+                    m_entries.push_back(entry);
+                }
+            }
+            if (m_entries.empty())
+            {
+                NV_PERF_LOG_ERR(20, "No metrics have been enumerated\n");
+                return false;
+            }
+
+            // keep the load factor at or below 1/2, so probe sequences stay short
+            size_t hashTableSize = 16;
+            while (hashTableSize < m_entries.size() * 2)
+            {
+                hashTableSize *= 2;
+            }
+            m_hashTable.assign(hashTableSize, 0);
+            for (size_t entryIndex = 0; entryIndex < m_entries.size(); ++entryIndex)
+            {
+                size_t bucket = m_entries[entryIndex].hash & (hashTableSize - 1);
+                while (m_hashTable[bucket])
+                {
+                    bucket = (bucket + 1) & (hashTableSize - 1);
+                }
+                m_hashTable[bucket] = (uint32_t)(entryIndex + 1);
+            }
+
+            if (cacheProperties && !CacheProperties(pMetricsEvaluator))
+            {
+                return false;
+            }
+            m_pMetricsEvaluator = pMetricsEvaluator;
+            m_hasProperties = cacheProperties;
+            resetOnFailure.Dismiss();
+            return true;
+        }
+
+        void Reset()
+        {
+            m_pMetricsEvaluator = nullptr;
+            m_entries.clear();
+            m_hashTable.clear();
+            for (PerMetricType& perType : m_perMetricType)
+            {
+                perType = PerMetricType();
+            }
+            m_stringPool.clear();
+            m_dimUnitsRanges.clear();
+            m_dimUnitFactors.clear();
+            m_hasProperties = false;
+        }
+
+        bool IsBuilt() const
+        {
+            return !m_entries.empty();
+        }
+
+        bool HasProperties() const
+        {
+            return m_hasProperties;
+        }
+
+        size_t GetNumMetrics() const
+        {
+            return m_entries.size();
+        }
+
+        // "pMetricName" is a base metric name, e.g. "sm__throughput", any rollup and submetric suffixes are ignored;
+        // same as nv::perf::GetMetricTypeAndIndex() but without logging
+        bool GetMetricTypeAndIndex(const char* pMetricName, NVPW_MetricType& metricType, size_t& metricIndex) const
+        {
+            const size_t metricNameLength = strlen(pMetricName);
+            for (size_t baseNameLength = metricNameLength; baseNameLength; baseNameLength = FindPreviousDot(pMetricName, baseNameLength))
+            {
+                if (const Entry* pEntry = FindEntry(pMetricName, baseNameLength))
+                {
+                    metricType = static_cast<NVPW_MetricType>(pEntry->metricType);
+                    metricIndex = pEntry->metricIndex;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // "pMetricName" is a full metric name, e.g. "sm__throughput.avg.pct_of_peak_sustained_elapsed"; same as nv::perf::ToMetricEvalRequest()
+        // but without logging
+        bool ToMetricEvalRequest(const char* pMetricName, NVPW_MetricEvalRequest& metricEvalRequest) const
+        {
+            return ToMetricEvalRequest(pMetricName, strlen(pMetricName), metricEvalRequest);
+        }
+
+        bool ToMetricEvalRequest(const char* pMetricName, size_t metricNameLength, NVPW_MetricEvalRequest& metricEvalRequest) const
+        {
+            for (size_t baseNameLength = metricNameLength; baseNameLength; baseNameLength = FindPreviousDot(pMetricName, baseNameLength))
+            {
+                const Entry* pEntry = FindEntry(pMetricName, baseNameLength);
+                if (pEntry && ParseSuffixes(*pEntry, pMetricName + baseNameLength, metricNameLength - baseNameLength, metricEvalRequest))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // returns an empty string for an invalid metric
+        const char* GetMetricName(NVPW_MetricType metricType, size_t metricIndex) const
+        {
+            const Entry* pEntry = GetEntry(metricType, metricIndex);
+            return pEntry ? pEntry->pName : "";
+        }
+
+        std::string ToString(const NVPW_MetricEvalRequest& metricEvalRequest) const
+        {
+            std::string metricName(GetMetricName(static_cast<NVPW_MetricType>(metricEvalRequest.metricType), metricEvalRequest.metricIndex));
+            if (metricEvalRequest.metricType == NVPW_METRIC_TYPE_COUNTER || metricEvalRequest.metricType == NVPW_METRIC_TYPE_THROUGHPUT)
+            {
+                metricName += ToCString(static_cast<NVPW_RollupOp>(metricEvalRequest.rollupOp));
+            }
+            metricName += ToCString(static_cast<NVPW_Submetric>(metricEvalRequest.submetric));
+            return metricName;
+        }
+
+        const char* GetMetricDescription(NVPW_MetricType metricType, size_t metricIndex) const
+        {
+            if (!m_hasProperties)
+            {
+                return nv::perf::GetMetricDescription(m_pMetricsEvaluator, metricType, metricIndex);
+            }
+            const Entry* pEntry = GetEntry(metricType, metricIndex);
+            return (pEntry && pEntry->descriptionOffset != InvalidOffset) ? &m_stringPool[pEntry->descriptionOffset] : nullptr;
+        }
+
+        NVPW_HwUnit GetMetricHwUnit(NVPW_MetricType metricType, size_t metricIndex) const
+        {
+            if (!m_hasProperties)
+            {
+                return nv::perf::GetMetricHwUnit(m_pMetricsEvaluator, metricType, metricIndex);
+            }
+            const Entry* pEntry = GetEntry(metricType, metricIndex);
+            return pEntry ? pEntry->hwUnit : NVPW_HW_UNIT_INVALID;
+        }
+
+        const char* GetMetricHwUnitStr(NVPW_MetricType metricType, size_t metricIndex) const
+        {
+            if (!m_hasProperties)
+            {
+                return nv::perf::GetMetricHwUnitStr(m_pMetricsEvaluator, metricType, metricIndex);
+            }
+            const Entry* pEntry = GetEntry(metricType, metricIndex);
+            return (pEntry && pEntry->hwUnitNameOffset != InvalidOffset) ? &m_stringPool[pEntry->hwUnitNameOffset] : nullptr;
+        }
+
+        // dim units do not depend on the rollup; same as nv::perf::GetMetricDimUnits(), including failing for dimensionless metrics
+        bool GetMetricDimUnits(const NVPW_MetricEvalRequest& metricEvalRequest, std::vector<NVPW_DimUnitFactor>& dimUnits) const
+        {
+            if (!m_hasProperties)
+            {
+                return nv::perf::GetMetricDimUnits(m_pMetricsEvaluator, metricEvalRequest, dimUnits);
+            }
+            const Entry* pEntry = GetEntry(static_cast<NVPW_MetricType>(metricEvalRequest.metricType), metricEvalRequest.metricIndex);
+            if (!pEntry || metricEvalRequest.submetric >= NVPW_SUBMETRIC__COUNT)
+            {
+                return false;
+            }
+            const uint8_t slot = m_perMetricType[pEntry->metricType].submetricSlots[metricEvalRequest.submetric];
+            if (slot == InvalidSlot)
+            {
+                return false;
+            }
+            const DimUnitsRange& range = m_dimUnitsRanges[pEntry->firstDimUnitsRange + slot];
+            if (!range.count)
+            {
+                return false;
+            }
+            dimUnits.assign(m_dimUnitFactors.begin() + range.offset, m_dimUnitFactors.begin() + range.offset + range.count);
+            return true;
+        }
+
+    private:
+        // returns the length of the prefix before the last '.' in [pName, pName + length), or 0 if there is none
+        static size_t FindPreviousDot(const char* pName, size_t length)
+        {
+            while (length && pName[--length] != '.')
+            {
+            }
+            return length;
+        }
+
+        // "pSuffix" is everything after the base name, e.g. ".avg.pct_of_peak_sustained_elapsed"
+        bool ParseSuffixes(const Entry& entry, const char* pSuffix, size_t suffixLength, NVPW_MetricEvalRequest& metricEvalRequest) const
+        {
+            uint8_t rollupOp = NVPW_ROLLUP_OP_AVG; // doesn't apply to ratios
+            if (entry.metricType != NVPW_METRIC_TYPE_RATIO)
+            {
+                rollupOp = NVPW_ROLLUP_OP__COUNT;
+                for (uint8_t op = 0; op < NVPW_ROLLUP_OP__COUNT; ++op)
+                {
+                    const char* pRollup = ToCString(static_cast<NVPW_RollupOp>(op));
+                    const size_t rollupLength = strlen(pRollup);
+                    if (suffixLength >= rollupLength && !memcmp(pSuffix, pRollup, rollupLength) && (suffixLength == rollupLength || pSuffix[rollupLength] == '.'))
+                    {
+                        rollupOp = op;
+                        pSuffix += rollupLength;
+                        suffixLength -= rollupLength;
+                        break;
+                    }
+                }
+                if (rollupOp == NVPW_ROLLUP_OP__COUNT)
+                {
+                    return false; // required for counters and throughputs
+                }
+            }
+
+            for (NVPW_Submetric submetric : m_perMetricType[entry.metricType].submetrics)
+            {
+                const char* pSubmetric = ToCString(submetric);
+                if (strlen(pSubmetric) == suffixLength && !memcmp(pSuffix, pSubmetric, suffixLength))
+                {
+                    metricEvalRequest = NVPW_MetricEvalRequest{};
+                    metricEvalRequest.metricIndex = entry.metricIndex;
+                    metricEvalRequest.metricType = entry.metricType;
+                    metricEvalRequest.rollupOp = rollupOp;
+                    metricEvalRequest.submetric = static_cast<uint16_t>(submetric);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        const Entry* FindEntry(const char* pName, size_t nameLength) const
+        {
+            if (m_hashTable.empty())
+            {
+                return nullptr;
+            }
+            const uint32_t hash = Fnv1a32(pName, nameLength);
+            const size_t mask = m_hashTable.size() - 1;
+            for (size_t bucket = hash & mask; m_hashTable[bucket]; bucket = (bucket + 1) & mask)
+            {
+                const Entry& entry = m_entries[m_hashTable[bucket] - 1];
+                if (entry.hash == hash && entry.nameLength == nameLength && !memcmp(entry.pName, pName, nameLength))
+                {
+                    return &entry;
+                }
+            }
+            return nullptr;
+        }
+
+        const Entry* GetEntry(NVPW_MetricType metricType, size_t metricIndex) const
+        {
+            if ((size_t)metricType >= NVPW_METRIC_TYPE__COUNT || metricIndex >= m_perMetricType[metricType].numEntries)
+            {
+                return nullptr;
+            }
+            return &m_entries[m_perMetricType[metricType].firstEntry + metricIndex];
+        }
+
+        uint32_t AddString(const char* pStr)
+        {
+            const uint32_t offset = (uint32_t)m_stringPool.size();
+            m_stringPool.insert(m_stringPool.end(), pStr, pStr + strlen(pStr) + 1);
+            return offset;
+        }
+
+        bool CacheProperties(NVPW_MetricsEvaluator* pMetricsEvaluator)
+        {
+            std::map<uint32_t, uint32_t> hwUnitNameOffsets; // there are only a few dozen distinct HW units
+            std::vector<NVPW_DimUnitFactor> dimUnits;
+            for (Entry& entry : m_entries)
+            {
+                const NVPW_MetricType metricType = static_cast<NVPW_MetricType>(entry.metricType);
+                const char* pDescription = nv::perf::GetMetricDescription(pMetricsEvaluator, metricType, entry.metricIndex);
+                if (pDescription)
+                {
+                    entry.descriptionOffset = AddString(pDescription);
+                }
+                entry.hwUnit = nv::perf::GetMetricHwUnit(pMetricsEvaluator, metricType, entry.metricIndex);
+                if (entry.hwUnit != NVPW_HW_UNIT_INVALID)
+                {
+                    const auto itr = hwUnitNameOffsets.find((uint32_t)entry.hwUnit);
+                    if (itr != hwUnitNameOffsets.end())
+                    {
+                        entry.hwUnitNameOffset = itr->second;
+                    }
+                    else if (const char* pHwUnitName = ToCString(pMetricsEvaluator, entry.hwUnit))
+                    {
+                        entry.hwUnitNameOffset = AddString(pHwUnitName);
+                        hwUnitNameOffsets[(uint32_t)entry.hwUnit] = entry.hwUnitNameOffset;
+                    }
+                }
+
+                entry.firstDimUnitsRange = (uint32_t)m_dimUnitsRanges.size();
+                for (NVPW_Submetric submetric : m_perMetricType[metricType].submetrics)
+                {
+                    NVPW_MetricEvalRequest request{};
+                    request.metricIndex = entry.metricIndex;
+                    request.metricType = entry.metricType;
+                    request.rollupOp = NVPW_ROLLUP_OP_SUM;
+                    request.submetric = static_cast<uint16_t>(submetric);
+                    DimUnitsRange range = { (uint32_t)m_dimUnitFactors.size(), 0 };
+                    if (QueryDimUnits(pMetricsEvaluator, request, dimUnits))
+                    {
+                        m_dimUnitFactors.insert(m_dimUnitFactors.end(), dimUnits.begin(), dimUnits.end());
+                        range.count = (uint32_t)dimUnits.size();
+                    }
+                    m_dimUnitsRanges.push_back(range);
+                }
+            }
+            return true;
+        }
+
+        // unlike nv::perf::GetMetricDimUnits(), does not log a warning for each of the many dimensionless submetrics
+        static bool QueryDimUnits(NVPW_MetricsEvaluator* pMetricsEvaluator, const NVPW_MetricEvalRequest& metricRequest, std::vector<NVPW_DimUnitFactor>& dimUnits)
+        {
+            NVPW_MetricsEvaluator_GetMetricDimUnits_Params getMetricDimUnitsParams = { NVPW_MetricsEvaluator_GetMetricDimUnits_Params_STRUCT_SIZE };
+            getMetricDimUnitsParams.pMetricsEvaluator = pMetricsEvaluator;
+            getMetricDimUnitsParams.pMetricEvalRequest = &metricRequest;
+            getMetricDimUnitsParams.metricEvalRequestStructSize = NVPW_MetricEvalRequest_STRUCT_SIZE;
+            getMetricDimUnitsParams.dimUnitFactorStructSize = NVPW_DimUnitFactor_STRUCT_SIZE;
+            NVPA_Status nvpaStatus = NVPW_MetricsEvaluator_GetMetricDimUnits(&getMetricDimUnitsParams);
+            if (nvpaStatus != NVPA_STATUS_SUCCESS || !getMetricDimUnitsParams.numDimUnits)
+            {
+                return false;
+            }
+            dimUnits.resize(getMetricDimUnitsParams.numDimUnits);
+            getMetricDimUnitsParams.pDimUnits = dimUnits.data();
+            nvpaStatus = NVPW_MetricsEvaluator_GetMetricDimUnits(&getMetricDimUnitsParams);
+            if (nvpaStatus != NVPA_STATUS_SUCCESS)
+            {
+                return false;
+            }
+            return true;
+        }
+    };
+
+    // Resolves "pMetricName" through "metricNameIndex", and through the metrics evaluator for the names the index does not know; unlike the
+    // index alone, not safe for concurrent use on a miss
+    inline bool GetMetricTypeAndIndex(const MetricNameIndex& metricNameIndex, NVPW_MetricsEvaluator* pMetricsEvaluator, const char* pMetricName, NVPW_MetricType& metricType, size_t& metricIndex)
+    {
+        if (metricNameIndex.GetMetricTypeAndIndex(pMetricName, metricType, metricIndex))
+        {
+            return true;
+        }
+        return pMetricsEvaluator && GetMetricTypeAndIndex(pMetricsEvaluator, pMetricName, metricType, metricIndex);
+    }
+
+}}
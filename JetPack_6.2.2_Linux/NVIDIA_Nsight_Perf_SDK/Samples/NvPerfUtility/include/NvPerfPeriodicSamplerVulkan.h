@@ -16,11 +16,18 @@
 
 #pragma once
 
+#include <algorithm>
+#include <chrono>
 #include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
 #include "NvPerfInit.h"
 #include "NvPerfCounterConfiguration.h"
 #include "NvPerfCounterData.h"
+#include "NvPerfCpuMarkerTrace.h"
 #include "NvPerfDeviceProperties.h"
+#include "NvPerfFlightRecorder.h"
 #include "NvPerfMiniTraceVulkan.h"
 #include "NvPerfPeriodicSamplerGpu.h"
 #include "NvPerfVulkan.h"
@@ -38,12 +45,28 @@ namespace nv { namespace perf { namespace sampler {
             InSession,
         };
 
+        // state of the optional background decoding mode, see StartBackgroundDecoding()
+        struct BackgroundDecoder
+        {
+            std::mutex samplerGpuMutex; // serializes calls into m_periodicSamplerGpu between the render thread and the decode thread
+            std::chrono::steady_clock::time_point lastDecodeTime; // decode thread only
+            RingBufferBackgroundDecoder decoder;
+        };
+
         GpuPeriodicSampler m_periodicSamplerGpu;
         RingBufferCounterData m_counterData;
         mini_trace::MiniTracerVulkan m_tracer;
         uint32_t m_maxTriggerLatency;
+        uint32_t m_samplingIntervalInNanoSeconds;
         bool m_isFirstFrame;
         SamplerStatus m_status;
+        std::unique_ptr<BackgroundDecoder> m_pBackgroundDecoder;
+        FlightRecorder* m_pFlightRecorder;
+        // for GetCalibratedTimestamps(), set at Initialize() if the device supports it
+        VkDevice m_device;
+        PFN_vkGetCalibratedTimestampsEXT m_pfnVkGetCalibratedTimestamps;
+        VkTimeDomainEXT m_cpuTimeDomain;
+        double m_timestampPeriod;
 
     public:
         struct FrameDelimiter
@@ -54,20 +77,22 @@ namespace nv { namespace perf { namespace sampler {
     public:
         PeriodicSamplerTimeHistoryVulkan()
             : m_maxTriggerLatency()
+            , m_samplingIntervalInNanoSeconds()
             , m_isFirstFrame(true)
             , m_status(SamplerStatus::Uninitialized)
+            , m_pFlightRecorder()
+            , m_device(VK_NULL_HANDLE)
+            , m_pfnVkGetCalibratedTimestamps()
+            , m_cpuTimeDomain(VK_TIME_DOMAIN_DEVICE_EXT)
+            , m_timestampPeriod()
         {
         }
         PeriodicSamplerTimeHistoryVulkan(const PeriodicSamplerTimeHistoryVulkan& sampler) = delete;
+        // the decode thread of "sampler" has to be stopped before its members can be moved, which the move assignment does first
         PeriodicSamplerTimeHistoryVulkan(PeriodicSamplerTimeHistoryVulkan&& sampler)
-            : m_periodicSamplerGpu(std::move(sampler.m_periodicSamplerGpu))
-            , m_counterData(std::move(sampler.m_counterData))
-            , m_tracer(std::move(sampler.m_tracer))
-            , m_maxTriggerLatency(sampler.m_maxTriggerLatency)
-            , m_isFirstFrame(sampler.m_isFirstFrame)
-            , m_status(sampler.m_status)
+            : PeriodicSamplerTimeHistoryVulkan()
         {
-            sampler.m_status = SamplerStatus::Uninitialized;
+            *this = std::move(sampler);
         }
         ~PeriodicSamplerTimeHistoryVulkan()
         {
@@ -77,13 +102,22 @@ namespace nv { namespace perf { namespace sampler {
         PeriodicSamplerTimeHistoryVulkan& operator=(PeriodicSamplerTimeHistoryVulkan&& sampler)
         {
             Reset();
+            sampler.StopBackgroundDecoding();
             m_periodicSamplerGpu = std::move(sampler.m_periodicSamplerGpu);
             m_counterData = std::move(sampler.m_counterData);
             m_tracer = std::move(sampler.m_tracer);
             m_maxTriggerLatency = sampler.m_maxTriggerLatency;
+            m_samplingIntervalInNanoSeconds = sampler.m_samplingIntervalInNanoSeconds;
             m_isFirstFrame = sampler.m_isFirstFrame;
             m_status = sampler.m_status;
+            m_pFlightRecorder = sampler.m_pFlightRecorder;
+            m_device = sampler.m_device;
+            m_pfnVkGetCalibratedTimestamps = sampler.m_pfnVkGetCalibratedTimestamps;
+            m_cpuTimeDomain = sampler.m_cpuTimeDomain;
+            m_timestampPeriod = sampler.m_timestampPeriod;
             sampler.m_status = SamplerStatus::Uninitialized;
+            sampler.m_pFlightRecorder = nullptr;
+            sampler.m_pfnVkGetCalibratedTimestamps = nullptr;
             return *this;
         }
 
@@ -146,6 +180,12 @@ namespace nv { namespace perf { namespace sampler {
             {
                 return false;
             }
+            InitializeCalibratedTimestamps(instance, physicalDevice, device
+#if defined(VK_NO_PROTOTYPES)
+                                          , pfnVkGetInstanceProcAddr
+                                          , pfnVkGetDeviceProcAddr
+#endif
+                                          );
             m_isFirstFrame = true;
             setStatusToFailed.Dismiss();
             m_status = SamplerStatus::InitializedButNotInSession;
@@ -154,12 +194,19 @@ namespace nv { namespace perf { namespace sampler {
 
         void Reset()
         {
+            StopBackgroundDecoding();
             m_periodicSamplerGpu.Reset();
             m_counterData.Reset();
             m_tracer.Reset();
             m_maxTriggerLatency = 0;
+            m_samplingIntervalInNanoSeconds = 0;
             m_isFirstFrame = true;
             m_status = SamplerStatus::Uninitialized;
+            m_pFlightRecorder = nullptr;
+            m_device = VK_NULL_HANDLE;
+            m_pfnVkGetCalibratedTimestamps = nullptr;
+            m_cpuTimeDomain = VK_TIME_DOMAIN_DEVICE_EXT;
+            m_timestampPeriod = 0.0;
         }
 
         bool IsInitialized() const
@@ -177,6 +224,38 @@ namespace nv { namespace perf { namespace sampler {
             return m_periodicSamplerGpu.GetDeviceIdentifiers();
         }
 
+        // Reads the GPU clock that samples and frame delimiters are timestamped with, together with GetCpuMarkerTimestamp(), e.g. for
+        // hud::ExternalSignalSourceOptions::CorrelateClocks(). Requires the device to be created with VK_EXT_calibrated_timestamps, and the
+        // driver to calibrate the device against GetCpuMarkerTimestamp()'s clock; returns false otherwise.
+        bool GetCalibratedTimestamps(uint64_t& cpuTimestamp, uint64_t& gpuTimestamp) const
+        {
+            if (!IsInitialized() || !m_pfnVkGetCalibratedTimestamps)
+            {
+                NV_PERF_LOG_ERR(50, "Calibrated timestamps are not supported\n");
+                return false;
+            }
+            VkCalibratedTimestampInfoEXT timestampInfos[2] = {};
+            timestampInfos[0].sType = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT;
+            timestampInfos[0].timeDomain = VK_TIME_DOMAIN_DEVICE_EXT;
+            timestampInfos[1].sType = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT;
+            timestampInfos[1].timeDomain = m_cpuTimeDomain;
+            uint64_t timestamps[2] = {};
+            uint64_t maxDeviation = 0;
+            const VkResult result = m_pfnVkGetCalibratedTimestamps(m_device, 2, timestampInfos, timestamps, &maxDeviation);
+            if (result != VK_SUCCESS)
+            {
+                NV_PERF_LOG_ERR(50, "vkGetCalibratedTimestampsEXT failed, VkResult = %d\n", (int)result);
+                return false;
+            }
+            gpuTimestamp = (uint64_t)((double)timestamps[0] * m_timestampPeriod);
+#if defined(_WIN32)
+            cpuTimestamp = CpuMarkerTimestampFromPerformanceCounter(timestamps[1]);
+#else
+            cpuTimestamp = timestamps[1];
+#endif
+            return true;
+        }
+
         RingBufferCounterData& GetRingBufferCounterData()
         {
             return m_counterData;
@@ -209,6 +288,7 @@ namespace nv { namespace perf { namespace sampler {
             });
             const GpuPeriodicSampler::GpuPulseSamplingInterval samplingInterval = m_periodicSamplerGpu.GetGpuPulseSamplingInterval(samplingIntervalInNanoSeconds);
             m_maxTriggerLatency = maxDecodeLatencyInNanoSeconds / samplingIntervalInNanoSeconds;
+            m_samplingIntervalInNanoSeconds = samplingIntervalInNanoSeconds;
             size_t recordBufferSize = 0;
             bool success = GpuPeriodicSamplerCalculateRecordBufferSize(GetGpuDeviceIndex(), std::vector<uint8_t>(), m_maxTriggerLatency, recordBufferSize);
             if (!success)
@@ -233,6 +313,7 @@ namespace nv { namespace perf { namespace sampler {
         
         bool EndSession()
         {
+            StopBackgroundDecoding();
             bool success = m_periodicSamplerGpu.EndSession();
             if (!success)
             {
@@ -240,6 +321,7 @@ namespace nv { namespace perf { namespace sampler {
             }
             m_tracer.EndSession();
             m_maxTriggerLatency = 0;
+            m_samplingIntervalInNanoSeconds = 0;
             if (m_status == SamplerStatus::InSession)
             {
                 m_status = SamplerStatus::InitializedButNotInSession;
@@ -260,6 +342,12 @@ namespace nv { namespace perf { namespace sampler {
                 return false;
             }
 
+            if (m_pBackgroundDecoder)
+            {
+                NV_PERF_LOG_ERR(50, "SetConfig() cannot be called during background decoding, call StopBackgroundDecoding() first\n");
+                return false;
+            }
+
             const size_t passIndex = 0;
             bool success = m_periodicSamplerGpu.SetConfig(pCounterConfiguration->configImage, passIndex);
             if (!success)
@@ -292,6 +380,7 @@ namespace nv { namespace perf { namespace sampler {
                 NV_PERF_LOG_ERR(50, "Not in a session, this function is skipped\n");
                 return false;
             }
+            auto lock = LockSamplerGpu();
             bool success = m_periodicSamplerGpu.StartSampling();
             if (!success)
             {
@@ -307,6 +396,7 @@ namespace nv { namespace perf { namespace sampler {
                 NV_PERF_LOG_ERR(50, "Not in a session, this function is skipped\n");
                 return false;
             }
+            auto lock = LockSamplerGpu();
             bool success = m_periodicSamplerGpu.StopSampling();
             if (!success)
             {
@@ -361,6 +451,10 @@ namespace nv { namespace perf { namespace sampler {
                     break;
                 }
                 delimiters.push_back(FrameDelimiter{ frameData.frameEndTime });
+                if (m_pFlightRecorder)
+                {
+                    m_pFlightRecorder->AddFrameDelimiter(frameData.frameEndTime);
+                }
                 if (!m_tracer.ReleaseOldestFrame())
                 {
                     break;
@@ -376,41 +470,91 @@ namespace nv { namespace perf { namespace sampler {
                 NV_PERF_LOG_ERR(50, "Not in a session, this function is skipped\n");
                 return false;
             }
-            const size_t numSamplingRangesToDecode = 1;
-            size_t numSamplingRangesDecoded = 0;
-            bool recordBufferOverflow = false;
-            size_t numSamplesDropped = 0;
-            size_t numSamplesMerged = 0;
-            bool success = m_periodicSamplerGpu.DecodeCounters(
-                m_counterData.GetCounterData(),
-                numSamplingRangesToDecode,
-                numSamplingRangesDecoded,
-                recordBufferOverflow,
-                numSamplesDropped,
-                numSamplesMerged);
-            if (!success)
+            if (m_pBackgroundDecoder)
             {
+                NV_PERF_LOG_ERR(50, "Counters are being decoded in the background, this function is skipped\n");
                 return false;
             }
-            if (recordBufferOverflow)
+            return DecodeCountersImpl();
+        }
+
+        // Moves DecodeCounters() off the calling thread: a dedicated thread decodes every "decodeIntervalInMicroSeconds" and publishes the
+        // completed ranges through a lock-free single-producer/single-consumer queue, ConsumeSamples() then only pops range indices from it.
+        // Must be called after SetConfig(). In this mode DecodeCounters() must not be called.
+        // The ring buffer holds "maxDecodeLatencyInNanoSeconds / samplingIntervalInNanoSeconds" (as specified in BeginSession()) ranges. When the
+        // consumer falls behind so far that the next decode could overwrite ranges it has not consumed yet, the decode is deferred and the samples
+        // wait in the record buffer; if the consumer stays behind for longer than the max decode latency, the record buffer overflows and
+        // ConsumeSamples() fails. See RingBufferBackgroundDecoder for how the counter data image is shared with the consumer.
+        bool StartBackgroundDecoding(uint32_t decodeIntervalInMicroSeconds)
+        {
+            if (m_status != SamplerStatus::InSession)
             {
-                NV_PERF_LOG_ERR(20, "Record buffer overflow has been detected! Please try to 1) reduce sampling frequency 2) increase record buffer size "
-"3) call DecodeCounters() more frequently\n");
+                NV_PERF_LOG_ERR(50, "Not in a session, this function is skipped\n");
                 return false;
             }
-            if (numSamplesMerged)
+            if (m_pBackgroundDecoder)
             {
-                NV_PERF_LOG_WRN(100, "Merged samples have been detected! This may lead to reduced accuracy. please try to reduce the sampling frequency.\n");
+                NV_PERF_LOG_ERR(50, "Background decoding has already been started\n");
+                return false;
             }
-
-            success = m_counterData.UpdatePut();
-            if (!success)
+            if (m_counterData.GetCounterData().empty())
             {
+                NV_PERF_LOG_ERR(50, "SetConfig() must be called before StartBackgroundDecoding()\n");
+                return false;
+            }
+
+            std::unique_ptr<BackgroundDecoder> pBackgroundDecoder(new BackgroundDecoder());
+            BackgroundDecoder* pDecoderState = pBackgroundDecoder.get();
+            pDecoderState->lastDecodeTime = std::chrono::steady_clock::now();
+            auto decodeFunc = [this, pDecoderState]() {
+                std::lock_guard<std::mutex> lock(pDecoderState->samplerGpuMutex);
+                pDecoderState->lastDecodeTime = std::chrono::steady_clock::now();
+                return DecodeCountersImpl();
+            };
+            auto getMaxNumRangesToDecodeFunc = [this, pDecoderState]() {
+                // one range per sampling interval elapsed since the last decode, plus the interval in progress and one that may complete before
+                // the decode starts; the record buffer cannot hold more than m_maxTriggerLatency samples in any case
+                const auto timeSinceLastDecode = std::chrono::steady_clock::now() - pDecoderState->lastDecodeTime;
+                const uint64_t numSamplingIntervals = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(timeSinceLastDecode).count() / m_samplingIntervalInNanoSeconds + 2;
+                return (size_t)std::min<uint64_t>(numSamplingIntervals, m_maxTriggerLatency);
+            };
+            m_pBackgroundDecoder = std::move(pBackgroundDecoder);
+            if (!m_pBackgroundDecoder->decoder.Start(m_counterData, std::chrono::microseconds(decodeIntervalInMicroSeconds), decodeFunc, getMaxNumRangesToDecodeFunc))
+            {
+                m_pBackgroundDecoder.reset();
                 return false;
             }
             return true;
         }
 
+        void StopBackgroundDecoding()
+        {
+            if (!m_pBackgroundDecoder)
+            {
+                return;
+            }
+            m_pBackgroundDecoder->decoder.Stop();
+            m_pBackgroundDecoder.reset();
+        }
+
+        bool IsBackgroundDecoding() const
+        {
+            return !!m_pBackgroundDecoder;
+        }
+
+        // Every range consumed by ConsumeSamples() and every frame delimiter returned by GetFrameDelimiters() is also added to "pFlightRecorder",
+        // on the calling thread. The flight recorder must be initialized with GetCounterData() as the counter data source, i.e. after SetConfig(),
+        // and outlive its use here; pass nullptr to detach it.
+        void SetFlightRecorder(FlightRecorder* pFlightRecorder)
+        {
+            m_pFlightRecorder = pFlightRecorder;
+        }
+
+        FlightRecorder* GetFlightRecorder() const
+        {
+            return m_pFlightRecorder;
+        }
+
         // TConsumeRangeDataFunc should be in the form of bool(const uint8_t* pCounterDataImage, size_t counterDataImageSize, uint32_t rangeIndex, bool& stop),
         // return false to indicate something went wrong; set "stop" to true to early break from iterating succeeding unread ranges, "this" range will not be recycled
         template <typename TConsumeRangeDataFunc>
@@ -421,6 +565,10 @@ namespace nv { namespace perf { namespace sampler {
                 NV_PERF_LOG_ERR(50, "Not in a session, this function is skipped\n");
                 return false;
             }
+            if (m_pBackgroundDecoder)
+            {
+                return ConsumeBackgroundDecodedSamples(std::forward<TConsumeRangeDataFunc>(consumeRangeDataFunc));
+            }
             uint32_t numRangesConsumed = 0;
             bool success = m_counterData.ConsumeData([&, userFunc = std::forward<TConsumeRangeDataFunc>(consumeRangeDataFunc)](const uint8_t* pCounterDataImage, size_t counterDataImageSize, uint32_t rangeIndex, bool& stop) {
                 bool userFuncSuccess = userFunc(pCounterDataImage, counterDataImageSize, rangeIndex, stop);
@@ -431,6 +579,10 @@ namespace nv { namespace perf { namespace sampler {
                 if (!stop)
                 {
                     ++numRangesConsumed;
+                    if (m_pFlightRecorder && !m_pFlightRecorder->AddRange(pCounterDataImage, counterDataImageSize, rangeIndex))
+                    {
+                        return false;
+                    }
                 }
                 return true; // simply pass "stop" along, m_counterData.ConsumeData will further process it and early break
             });
@@ -446,6 +598,121 @@ namespace nv { namespace perf { namespace sampler {
             }
             return true;
         }
+
+    private:
+        void InitializeCalibratedTimestamps(VkInstance instance, VkPhysicalDevice physicalDevice, VkDevice device
+#if defined(VK_NO_PROTOTYPES)
+                                           , PFN_vkGetInstanceProcAddr pfnVkGetInstanceProcAddr
+                                           , PFN_vkGetDeviceProcAddr pfnVkGetDeviceProcAddr
+#endif
+                                           )
+        {
+#if !defined(VK_NO_PROTOTYPES)
+            const PFN_vkGetInstanceProcAddr pfnVkGetInstanceProcAddr = vkGetInstanceProcAddr;
+            const PFN_vkGetDeviceProcAddr pfnVkGetDeviceProcAddr = vkGetDeviceProcAddr;
+#endif
+            // the clock GetCpuMarkerTimestamp() reads, std::chrono::steady_clock elsewhere has no Vulkan time domain
+#if defined(_WIN32)
+            const VkTimeDomainEXT cpuTimeDomain = VK_TIME_DOMAIN_QUERY_PERFORMANCE_COUNTER_EXT;
+#elif defined(__linux__)
+            const VkTimeDomainEXT cpuTimeDomain = VK_TIME_DOMAIN_CLOCK_MONOTONIC_RAW_EXT;
+#endif
+#if defined(_WIN32) || defined(__linux__)
+            const auto pfnVkGetPhysicalDeviceCalibrateableTimeDomains = (PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT)pfnVkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT");
+            const auto pfnVkGetCalibratedTimestamps = (PFN_vkGetCalibratedTimestampsEXT)pfnVkGetDeviceProcAddr(device, "vkGetCalibratedTimestampsEXT");
+            const auto pfnVkGetPhysicalDeviceProperties = (PFN_vkGetPhysicalDeviceProperties)pfnVkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceProperties");
+            if (!pfnVkGetPhysicalDeviceCalibrateableTimeDomains || !pfnVkGetCalibratedTimestamps || !pfnVkGetPhysicalDeviceProperties)
+            {
+                return; // VK_EXT_calibrated_timestamps is not enabled
+            }
+            uint32_t numTimeDomains = 0;
+            if (pfnVkGetPhysicalDeviceCalibrateableTimeDomains(physicalDevice, &numTimeDomains, nullptr) != VK_SUCCESS)
+            {
+                return;
+            }
+            std::vector<VkTimeDomainEXT> timeDomains(numTimeDomains);
+            if (pfnVkGetPhysicalDeviceCalibrateableTimeDomains(physicalDevice, &numTimeDomains, timeDomains.data()) != VK_SUCCESS)
+            {
+                return;
+            }
+            timeDomains.resize(numTimeDomains);
+            if (std::find(timeDomains.begin(), timeDomains.end(), VK_TIME_DOMAIN_DEVICE_EXT) == timeDomains.end()
+                || std::find(timeDomains.begin(), timeDomains.end(), cpuTimeDomain) == timeDomains.end())
+            {
+                NV_PERF_LOG_INF(50, "The device cannot calibrate its timestamps against GetCpuMarkerTimestamp()\n");
+                return;
+            }
+            VkPhysicalDeviceProperties properties = {};
+            pfnVkGetPhysicalDeviceProperties(physicalDevice, &properties);
+            m_device = device;
+            m_pfnVkGetCalibratedTimestamps = pfnVkGetCalibratedTimestamps;
+            m_cpuTimeDomain = cpuTimeDomain;
+            m_timestampPeriod = (double)properties.limits.timestampPeriod;
+#endif
+        }
+
+        // returns an empty lock when not decoding in the background, in which case everything runs on the calling thread
+        std::unique_lock<std::mutex> LockSamplerGpu()
+        {
+            if (!m_pBackgroundDecoder)
+            {
+                return std::unique_lock<std::mutex>();
+            }
+            return std::unique_lock<std::mutex>(m_pBackgroundDecoder->samplerGpuMutex);
+        }
+
+        bool DecodeCountersImpl()
+        {
+            const size_t numSamplingRangesToDecode = 1;
+            size_t numSamplingRangesDecoded = 0;
+            bool recordBufferOverflow = false;
+            size_t numSamplesDropped = 0;
+            size_t numSamplesMerged = 0;
+            bool success = m_periodicSamplerGpu.DecodeCounters(
+                m_counterData.GetCounterData(),
+                numSamplingRangesToDecode,
+                numSamplingRangesDecoded,
+                recordBufferOverflow,
+                numSamplesDropped,
+                numSamplesMerged);
+            if (!success)
+            {
+                return false;
+            }
+            if (recordBufferOverflow)
+            {
+                NV_PERF_LOG_ERR(20, "Record buffer overflow has been detected! Please try to 1) reduce sampling frequency 2) increase record buffer size "
+"3) call DecodeCounters() more frequently\n");
+                return false;
+            }
+            if (numSamplesMerged)
+            {
+                NV_PERF_LOG_WRN(100, "Merged samples have been detected! This may lead to reduced accuracy. please try to reduce the sampling frequency.\n");
+            }
+
+            success = m_counterData.UpdatePut();
+            if (!success)
+            {
+                return false;
+            }
+            return true;
+        }
+
+        template <typename TConsumeRangeDataFunc>
+        bool ConsumeBackgroundDecodedSamples(TConsumeRangeDataFunc&& consumeRangeDataFunc)
+        {
+            return m_pBackgroundDecoder->decoder.ConsumeRanges(m_counterData, [&](const uint8_t* pCounterDataImage, size_t counterDataImageSize, uint32_t rangeIndex, bool& stop) {
+                if (!consumeRangeDataFunc(pCounterDataImage, counterDataImageSize, rangeIndex, stop))
+                {
+                    return false;
+                }
+                if (!stop && m_pFlightRecorder && !m_pFlightRecorder->AddRange(pCounterDataImage, counterDataImageSize, rangeIndex))
+                {
+                    return false;
+                }
+                return true;
+            });
+        }
     };
 
 }}}
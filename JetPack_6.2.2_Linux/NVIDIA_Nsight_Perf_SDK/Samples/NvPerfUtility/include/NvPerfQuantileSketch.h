@@ -0,0 +1,249 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace nv { namespace perf {
+
+    // A constant-memory, mergeable histogram of doubles with logarithmically sized buckets, from which quantiles can be read with a bounded
+    // relative error. Bucket i holds the values in (gamma^(i-1), gamma^i], where gamma = (1 + relativeAccuracy) / (1 - relativeAccuracy),
+    // so any value reported for a bucket is within relativeAccuracy of every value it holds.
+    // Values below minTrackableValue, including zero and negative values, share a single bucket that reports 0; values above
+    // maxTrackableValue are counted in the highest bucket. Quantiles are always clamped to the exact minimum and maximum.
+    // The default parameters need ~1200 buckets, i.e. ~4.8KB, allocated by the first Add().
+    class QuantileSketch
+    {
+    private:
+        double m_relativeAccuracy;
+        double m_minTrackableValue;
+        double m_maxTrackableValue;
+        double m_gamma;
+        double m_inverseLogGamma;
+        int32_t m_indexOffset;                  // the bucket index of m_minTrackableValue
+        std::vector<uint32_t> m_bucketCounts;   // allocated by the first Add(), so that unused sketches are free
+        uint64_t m_numLowValues;                // below m_minTrackableValue
+        uint64_t m_count;
+        double m_sum;
+        double m_min;
+        double m_max;
+
+    private:
+        int32_t GetIndex(double value) const
+        {
+            return (int32_t)ceil(log(value) * m_inverseLogGamma);
+        }
+
+        size_t GetNumBuckets() const
+        {
+            return size_t(GetIndex(m_maxTrackableValue) - m_indexOffset + 1);
+        }
+
+        double GetBucketValue(size_t bucketIndex) const
+        {
+            // the point of (gamma^(i-1), gamma^i] with the same relative error to both ends
+            return 2.0 * pow(m_gamma, double(int32_t(bucketIndex) + m_indexOffset)) / (m_gamma + 1.0);
+        }
+
+        double Clamp(double value) const
+        {
+            return (std::min)((std::max)(value, m_min), m_max);
+        }
+
+    public:
+        explicit QuantileSketch(double relativeAccuracy = 0.02, double minTrackableValue = 1e-9, double maxTrackableValue = 1e12)
+            : m_relativeAccuracy((std::min)((std::max)(relativeAccuracy, 1e-4), 0.5))
+            , m_minTrackableValue((std::max)(minTrackableValue, std::numeric_limits<double>::min()))
+            , m_maxTrackableValue((std::max)(maxTrackableValue, m_minTrackableValue))
+            , m_gamma((1.0 + m_relativeAccuracy) / (1.0 - m_relativeAccuracy))
+            , m_inverseLogGamma(1.0 / log(m_gamma))
+            , m_indexOffset(GetIndex(m_minTrackableValue))
+            , m_bucketCounts()
+            , m_numLowValues()
+            , m_count()
+            , m_sum()
+            , m_min(std::numeric_limits<double>::quiet_NaN())
+            , m_max(std::numeric_limits<double>::quiet_NaN())
+        {
+        }
+
+        // Keeps the allocated buckets.
+        void Clear()
+        {
+            std::fill(m_bucketCounts.begin(), m_bucketCounts.end(), 0u);
+            m_numLowValues = 0;
+            m_count = 0;
+            m_sum = 0.0;
+            m_min = std::numeric_limits<double>::quiet_NaN();
+            m_max = std::numeric_limits<double>::quiet_NaN();
+        }
+
+        // NaNs are ignored.
+        void Add(double value)
+        {
+            if (isnan(value))
+            {
+                return;
+            }
+            if (!m_count)
+            {
+                m_min = value;
+                m_max = value;
+            }
+            else
+            {
+                m_min = (std::min)(m_min, value);
+                m_max = (std::max)(m_max, value);
+            }
+            ++m_count;
+            m_sum += value;
+
+            if (!(value >= m_minTrackableValue))
+            {
+                ++m_numLowValues;
+                return;
+            }
+            if (m_bucketCounts.empty())
+            {
+                m_bucketCounts.resize(GetNumBuckets());
+            }
+            const size_t bucketIndex = value < m_maxTrackableValue ? size_t(GetIndex(value) - m_indexOffset) : m_bucketCounts.size() - 1;
+            uint32_t& bucketCount = m_bucketCounts[(std::min)(bucketIndex, m_bucketCounts.size() - 1)];
+            if (bucketCount != UINT32_MAX)
+            {
+                ++bucketCount;
+            }
+        }
+
+        // Fails if "other" was constructed with different parameters.
+        bool Merge(const QuantileSketch& other)
+        {
+            if (other.m_relativeAccuracy != m_relativeAccuracy || other.m_minTrackableValue != m_minTrackableValue || other.m_maxTrackableValue != m_maxTrackableValue)
+            {
+                return false;
+            }
+            if (!other.m_count)
+            {
+                return true;
+            }
+            if (!other.m_bucketCounts.empty())
+            {
+                if (m_bucketCounts.empty())
+                {
+                    m_bucketCounts.resize(other.m_bucketCounts.size());
+                }
+                for (size_t bucketIndex = 0; bucketIndex < m_bucketCounts.size(); ++bucketIndex)
+                {
+                    const uint64_t bucketCount = uint64_t(m_bucketCounts[bucketIndex]) + other.m_bucketCounts[bucketIndex];
+                    m_bucketCounts[bucketIndex] = (uint32_t)(std::min)(bucketCount, uint64_t(UINT32_MAX));
+                }
+            }
+            m_min = m_count ? (std::min)(m_min, other.m_min) : other.m_min;
+            m_max = m_count ? (std::max)(m_max, other.m_max) : other.m_max;
+            m_numLowValues += other.m_numLowValues;
+            m_count += other.m_count;
+            m_sum += other.m_sum;
+            return true;
+        }
+
+        // Evaluates several quantiles with a single walk over the buckets. "pQuantiles" must be sorted in ascending order, each in [0, 1].
+        // All results are NaN if the sketch is empty.
+        void GetQuantiles(const double* pQuantiles, size_t numQuantiles, double* pValues) const
+        {
+            if (!m_count)
+            {
+                std::fill(pValues, pValues + numQuantiles, std::numeric_limits<double>::quiet_NaN());
+                return;
+            }
+            size_t quantileIndex = 0;
+            // the rank is 0-based, so that the 0-quantile is the lowest value and the 1-quantile the highest
+            auto getRank = [&](double quantile) {
+                return uint64_t((std::min)((std::max)(quantile, 0.0), 1.0) * double(m_count - 1));
+            };
+            uint64_t cumulativeCount = m_numLowValues;
+            for (; quantileIndex < numQuantiles && getRank(pQuantiles[quantileIndex]) < cumulativeCount; ++quantileIndex)
+            {
+                pValues[quantileIndex] = Clamp(0.0);
+            }
+            for (size_t bucketIndex = 0; bucketIndex < m_bucketCounts.size() && quantileIndex < numQuantiles; ++bucketIndex)
+            {
+                if (!m_bucketCounts[bucketIndex])
+                {
+                    continue;
+                }
+                cumulativeCount += m_bucketCounts[bucketIndex];
+                for (; quantileIndex < numQuantiles && getRank(pQuantiles[quantileIndex]) < cumulativeCount; ++quantileIndex)
+                {
+                    pValues[quantileIndex] = Clamp(GetBucketValue(bucketIndex));
+                }
+            }
+            // only reachable if a bucket count saturated
+            for (; quantileIndex < numQuantiles; ++quantileIndex)
+            {
+                pValues[quantileIndex] = m_max;
+            }
+        }
+
+        double GetQuantile(double quantile) const
+        {
+            double value = 0.0;
+            GetQuantiles(&quantile, 1, &value);
+            return value;
+        }
+
+        uint64_t GetCount() const
+        {
+            return m_count;
+        }
+
+        double GetSum() const
+        {
+            return m_sum;
+        }
+
+        // NaN if empty, as are GetMin() and GetMax().
+        double GetMean() const
+        {
+            return m_count ? m_sum / double(m_count) : std::numeric_limits<double>::quiet_NaN();
+        }
+
+        double GetMin() const
+        {
+            return m_min;
+        }
+
+        double GetMax() const
+        {
+            return m_max;
+        }
+
+        double GetRelativeAccuracy() const
+        {
+            return m_relativeAccuracy;
+        }
+
+        size_t GetMemorySize() const
+        {
+            return sizeof(*this) + m_bucketCounts.capacity() * sizeof(uint32_t);
+        }
+    };
+
+}}
@@ -14,7 +14,8 @@
 * limitations under the License.
 */
 #pragma once
-#include <list>
+#include <string.h>
+#include <algorithm>
 #include <utility>
 #include <vector>
 
@@ -33,6 +34,7 @@ namespace nv { namespace perf { namespace profiler {
         size_t maxNumRanges = 16;
         size_t avgRangeNameLength = 128;
         size_t numTraceBuffers = 5;                 // recommended: SwapChainDepth + 2
+        size_t maxNumQueuedCollections = 0;         // non-zero enables pooled mode, see RangeProfilerStateMachine::SetCounterDataPooling()
     };
 
     struct SetConfigParams
@@ -77,6 +79,102 @@ namespace nv { namespace perf { namespace profiler {
         std::vector<uint8_t> counterDataImage;      // if allPassesDecoded is true, this will be non-empty
     };
 
+    // A FIFO in a contiguous ring of slots, which only allocates when its capacity grows. Popped slots are reset to T(), so they do not
+    // hold on to memory; move out of Front() first to keep it.
+    template <class T>
+    class RingQueue
+    {
+    private:
+        std::vector<T> m_slots;
+        size_t m_head;
+        size_t m_size;
+
+    public:
+        RingQueue()
+            : m_head()
+            , m_size()
+        {
+        }
+
+        size_t Size() const
+        {
+            return m_size;
+        }
+
+        bool Empty() const
+        {
+            return !m_size;
+        }
+
+        size_t Capacity() const
+        {
+            return m_slots.size();
+        }
+
+        // grows the capacity to at least "capacity", keeping the queued elements in order
+        void Reserve(size_t capacity)
+        {
+            if (capacity <= m_slots.size())
+            {
+                return;
+            }
+            std::vector<T> slots(capacity);
+            for (size_t index = 0; index < m_size; ++index)
+            {
+                slots[index] = std::move((*this)[index]);
+            }
+            m_slots.swap(slots);
+            m_head = 0;
+        }
+
+        T& operator[](size_t index)
+        {
+            return m_slots[(m_head + index) % m_slots.size()];
+        }
+
+        const T& operator[](size_t index) const
+        {
+            return m_slots[(m_head + index) % m_slots.size()];
+        }
+
+        T& Front()
+        {
+            return (*this)[0];
+        }
+
+        // grows geometrically if full
+        void PushBack(T&& value)
+        {
+            if (m_size == m_slots.size())
+            {
+                Reserve((std::max)(size_t(4), 2 * m_slots.size()));
+            }
+            (*this)[m_size] = std::move(value);
+            ++m_size;
+        }
+
+        void PushBack(const T& value)
+        {
+            PushBack(T(value));
+        }
+
+        void PopFront()
+        {
+            Front() = T();
+            m_head = (m_head + 1) % m_slots.size();
+            --m_size;
+        }
+
+        void Clear()
+        {
+            while (m_size)
+            {
+                PopFront();
+            }
+            m_head = 0;
+        }
+    };
+
     class RangeProfilerStateMachine
     {
     public: // types
@@ -111,17 +209,69 @@ namespace nv { namespace perf { namespace profiler {
             }
         };
 
+        // The counter data buffers of decoded collections, recycled by later collections in pooled mode. CreateCounterData() only runs when
+        // the counter data prefix changes; in between, new collections are initialized from its result by a copy into a recycled buffer.
+        struct CounterDataPool
+        {
+            std::vector<uint8_t> counterDataPrefix;                     // the prefix the templates were created for
+            std::vector<uint8_t> counterDataImageTemplate;              // used for fast initialization(memcpy)
+            std::vector<uint8_t> counterDataScratchTemplate;
+            std::vector<std::vector<uint8_t>> freeCounterDataImages;
+            std::vector<std::vector<uint8_t>> freeCounterDataScratches;
+        };
+
     protected: // members
         IProfilerApi& m_profilerApi;
         bool m_inPass;
 
-        // Use std::list for stable iterators and a guarantee of no-copy.
-        typedef std::list<SetConfigParams> ConfigQueue;
-        typedef std::list<CounterStateMachine> CountersQueue;
+        typedef RingQueue<SetConfigParams> ConfigQueue;
+        typedef RingQueue<CounterStateMachine> CountersQueue;
         bool m_needSetConfig;
-        ConfigQueue m_configQueue;                      // m_configQueue.front() is the active configuration (by SetConfig), and is popped after all passes are submitted
+        ConfigQueue m_configQueue;                      // m_configQueue.Front() is the active configuration (by SetConfig), and is popped after all passes are submitted
         CountersQueue m_countersQueue;                  // queued CounterData, which may lag the configQueue when frames are rendered asynchronously
-        CountersQueue::iterator m_submitCounterItr;     // points at the CounterData corresponding to m_configQueue.front()
+        size_t m_submitCounterIndex;                    // m_countersQueue[m_submitCounterIndex] is the CounterData corresponding to m_configQueue.Front()
+
+        size_t m_maxNumQueuedCollections;               // non-zero in pooled mode
+        CounterDataPool m_counterDataPool;
+
+    protected:
+        static void RecycleBuffer(std::vector<std::vector<uint8_t>>& freeBuffers, std::vector<uint8_t>&& buffer, size_t maxNumFreeBuffers)
+        {
+            if (buffer.capacity() && freeBuffers.size() < maxNumFreeBuffers)
+            {
+                freeBuffers.push_back(std::move(buffer));
+            }
+            buffer = std::vector<uint8_t>();
+        }
+
+        static void InitializeFromTemplate(std::vector<std::vector<uint8_t>>& freeBuffers, const std::vector<uint8_t>& bufferTemplate, std::vector<uint8_t>& buffer)
+        {
+            if (!freeBuffers.empty())
+            {
+                buffer = std::move(freeBuffers.back());
+                freeBuffers.pop_back();
+            }
+            buffer.assign(bufferTemplate.begin(), bufferTemplate.end()); // only allocates if the recycled buffer is too small
+        }
+
+        bool CreatePooledCounterData(const SetConfigParams& config, std::vector<uint8_t>& counterDataImage, std::vector<uint8_t>& counterDataScratch)
+        {
+            CounterDataPool& pool = m_counterDataPool;
+            const bool samePrefix = (pool.counterDataPrefix.size() == config.counterDataPrefixSize)
+                && (!config.counterDataPrefixSize || !memcmp(pool.counterDataPrefix.data(), config.pCounterDataPrefix, config.counterDataPrefixSize));
+            if (!samePrefix || pool.counterDataImageTemplate.empty())
+            {
+                pool.counterDataPrefix.clear();
+                if (!m_profilerApi.CreateCounterData(config, pool.counterDataImageTemplate, pool.counterDataScratchTemplate))
+                {
+                    return false;
+                }
+                pool.counterDataPrefix.assign(config.pCounterDataPrefix, config.pCounterDataPrefix + config.counterDataPrefixSize);
+            }
+            InitializeFromTemplate(pool.freeCounterDataImages, pool.counterDataImageTemplate, counterDataImage);
+            InitializeFromTemplate(pool.freeCounterDataScratches, pool.counterDataScratchTemplate, counterDataScratch);
+            return true;
+        }
 
     private:
         // non-copyable
@@ -139,17 +289,58 @@ namespace nv { namespace perf { namespace profiler {
             , m_needSetConfig()
             , m_configQueue()
             , m_countersQueue()
-            , m_submitCounterItr()
+            , m_submitCounterIndex()
+            , m_maxNumQueuedCollections()
+            , m_counterDataPool()
         {
         }
 
+        // Keeps the pooling mode, but releases the pooled buffers.
         void Reset()
         {
-            m_submitCounterItr = {};
-            m_countersQueue.clear();
-            m_configQueue.clear();
+            m_submitCounterIndex = 0;
+            m_countersQueue.Clear();
+            m_configQueue.Clear();
             m_needSetConfig = false;
             m_inPass = false;
+            m_counterDataPool = CounterDataPool();
+        }
+
+        // In pooled mode, the counter data buffers of decoded collections are recycled for new collections: a DecodeResult passed to
+        // DecodeCounters() again hands its previous counterDataImage back, as does RecycleCounterDataImage(). At most
+        // "maxNumQueuedCollections" collections can be queued at once, and the queues never allocate. 0 disables pooled mode.
+        // Must be called while no collection is queued.
+        bool SetCounterDataPooling(size_t maxNumQueuedCollections)
+        {
+            if (!m_countersQueue.Empty())
+            {
+                NV_PERF_LOG_ERR(20, "Counter data pooling cannot be changed while collections are queued\n");
+                return false;
+            }
+            m_maxNumQueuedCollections = maxNumQueuedCollections;
+            m_counterDataPool = CounterDataPool();
+            if (m_maxNumQueuedCollections)
+            {
+                m_configQueue.Reserve(m_maxNumQueuedCollections);
+                m_countersQueue.Reserve(m_maxNumQueuedCollections);
+                m_counterDataPool.freeCounterDataImages.reserve(m_maxNumQueuedCollections);
+                m_counterDataPool.freeCounterDataScratches.reserve(m_maxNumQueuedCollections);
+            }
+            return true;
+        }
+
+        bool IsCounterDataPoolingEnabled() const
+        {
+            return !!m_maxNumQueuedCollections;
+        }
+
+        // Hands a counterDataImage from DecodeResult back to the pool; ignored unless in pooled mode.
+        void RecycleCounterDataImage(std::vector<uint8_t>&& counterDataImage)
+        {
+            if (m_maxNumQueuedCollections)
+            {
+                RecycleBuffer(m_counterDataPool.freeCounterDataImages, std::move(counterDataImage), m_maxNumQueuedCollections);
+            }
         }
 
         bool IsInPass() const
@@ -159,27 +350,33 @@ namespace nv { namespace perf { namespace profiler {
 
         bool EnqueueCounterCollection(const SetConfigParams& config)
         {
+            if (m_maxNumQueuedCollections && m_countersQueue.Size() == m_maxNumQueuedCollections)
+            {
+                NV_PERF_LOG_ERR(20, "Cannot queue more than %llu collections, decode the queued ones first\n", (unsigned long long)m_maxNumQueuedCollections);
+                return false;
+            }
+
             CounterStateMachine counterStateMachine = {};
             counterStateMachine.numPassesPerStatisticalSample = config.numPasses * config.numNestingLevels;
             counterStateMachine.numStatisticalSamplesRequired = config.numStatisticalSamples;
-            if (!m_profilerApi.CreateCounterData(config, counterStateMachine.counterDataImage, counterStateMachine.counterDataScratch))
+            if (m_maxNumQueuedCollections)
             {
-                return false;
+                if (!CreatePooledCounterData(config, counterStateMachine.counterDataImage, counterStateMachine.counterDataScratch))
+                {
+                    return false;
+                }
             }
-
-            if (m_configQueue.empty())
+            else if (!m_profilerApi.CreateCounterData(config, counterStateMachine.counterDataImage, counterStateMachine.counterDataScratch))
             {
-                m_needSetConfig = true;
+                return false;
             }
-            m_configQueue.push_back(config);
 
-            const bool countersQueueWasEmpty = m_countersQueue.empty();
-            m_countersQueue.emplace_back(std::move(counterStateMachine));
-            if (countersQueueWasEmpty)
+            if (m_configQueue.Empty())
             {
-                m_submitCounterItr = m_countersQueue.begin();
+                m_needSetConfig = true;
             }
-
+            m_configQueue.PushBack(config);
+            m_countersQueue.PushBack(std::move(counterStateMachine));
             return true;
         }
 
@@ -190,7 +387,7 @@ namespace nv { namespace perf { namespace profiler {
                 // TODO: error - must be called in session, but outside of a pass
                 return false;
             }
-            if (m_configQueue.empty())
+            if (m_configQueue.Empty())
             {
                 // Do not enqueue additional HW data collection.
                 return true;
@@ -198,7 +395,7 @@ namespace nv { namespace perf { namespace profiler {
 
             if (m_needSetConfig)
             {
-                if (!m_profilerApi.SetConfig(m_configQueue.front()))
+                if (!m_profilerApi.SetConfig(m_configQueue.Front()))
                 {
                     return false;
                 }
@@ -222,7 +419,7 @@ namespace nv { namespace perf { namespace profiler {
                 return false;
             }
 
-            if (m_configQueue.empty())
+            if (m_configQueue.Empty())
             {
                 // Do not enqueue additional HW data collection.
                 return true;
@@ -233,13 +430,13 @@ namespace nv { namespace perf { namespace profiler {
                 return false;
             }
 
-            CounterStateMachine& counterStateMachine = *m_submitCounterItr;
+            CounterStateMachine& counterStateMachine = m_countersQueue[m_submitCounterIndex];
             counterStateMachine.numPassesSubmitted += 1;
             if (counterStateMachine.AllPassesSubmitted())
             {
-                ++m_submitCounterItr;
-                m_configQueue.pop_front();
-                if (!m_configQueue.empty())
+                ++m_submitCounterIndex;
+                m_configQueue.PopFront();
+                if (!m_configQueue.Empty())
                 {
                     m_needSetConfig = true;
                 }
@@ -257,7 +454,7 @@ namespace nv { namespace perf { namespace profiler {
                 return false;
             }
 
-            if (m_configQueue.empty())
+            if (m_configQueue.Empty())
             {
                 // Do not enqueue additional HW data collection.
                 return true;
@@ -279,7 +476,7 @@ namespace nv { namespace perf { namespace profiler {
                 return false;
             }
 
-            if (m_configQueue.empty())
+            if (m_configQueue.Empty())
             {
                 // Do not enqueue additional HW data collection.
                 return true;
@@ -295,14 +492,15 @@ namespace nv { namespace perf { namespace profiler {
 
         bool DecodeCounters(DecodeResult& decodeResult)
         {
-            if (m_countersQueue.empty())
+            if (m_countersQueue.Empty())
             {
                 // TODO: error - nothing is queued for collection.  see SetConfig ...
                 return false;
             }
 
-            CounterStateMachine& counterStateMachine = m_countersQueue.front();
+            CounterStateMachine& counterStateMachine = m_countersQueue.Front();
 
+            RecycleCounterDataImage(std::move(decodeResult.counterDataImage));
             decodeResult = {};
             if (!m_profilerApi.DecodeCounters(counterStateMachine.counterDataImage, counterStateMachine.counterDataScratch, decodeResult.onePassDecoded, decodeResult.allPassesDecoded))
             {
@@ -317,7 +515,15 @@ namespace nv { namespace perf { namespace profiler {
                 {
                     decodeResult.allStatisticalSamplesCollected = true;
                     decodeResult.counterDataImage = std::move(counterStateMachine.counterDataImage);
-                    m_countersQueue.pop_front();
+                    if (m_maxNumQueuedCollections)
+                    {
+                        RecycleBuffer(m_counterDataPool.freeCounterDataScratches, std::move(counterStateMachine.counterDataScratch), m_maxNumQueuedCollections);
+                    }
+                    m_countersQueue.PopFront();
+                    if (m_submitCounterIndex)
+                    {
+                        --m_submitCounterIndex;
+                    }
                 }
             }
             return true;
@@ -325,7 +531,7 @@ namespace nv { namespace perf { namespace profiler {
 
         bool AllPassesSubmitted() const
         {
-            const bool allPassesSubmitted = m_configQueue.empty();
+            const bool allPassesSubmitted = m_configQueue.Empty();
             return allPassesSubmitted;
         }
     };
@@ -310,6 +310,7 @@ namespace nv { namespace perf { namespace profiler {
 
             m_profilerApi.sessionOptions = sessionOptions;
             m_profilerApi.pDeviceContext = pDeviceContext;
+            m_stateMachine.SetCounterDataPooling(sessionOptions.maxNumQueuedCollections);
             return true;
         }
 
@@ -340,6 +340,7 @@ namespace nv { namespace perf { namespace profiler {
             m_spgoThread = std::thread(SpgoThreadProc, this, pCommandQueue);
 
             m_profilerApi.Initialize(pCommandQueue, sessionOptions);
+            m_stateMachine.SetCounterDataPooling(sessionOptions.maxNumQueuedCollections);
             return true;
         }
 
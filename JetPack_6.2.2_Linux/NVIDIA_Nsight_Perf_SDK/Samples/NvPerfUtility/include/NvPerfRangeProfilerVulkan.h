@@ -530,6 +530,7 @@ namespace nv { namespace perf { namespace profiler {
                 return false;
             }
 
+            m_stateMachine.SetCounterDataPooling(sessionOptions.maxNumQueuedCollections);
             return true;
         }
 
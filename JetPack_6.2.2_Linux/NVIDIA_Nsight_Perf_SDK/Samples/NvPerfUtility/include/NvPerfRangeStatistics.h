@@ -0,0 +1,303 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#include "NvPerfInit.h"
+#include "NvPerfQuantileSketch.h"
+
+namespace nv { namespace perf {
+
+    // A single-writer sequence lock around a trivially copyable value: Store() never waits, and Load() retries while a Store() is in flight.
+    // The value is kept in atomic words, so that a reader racing with the writer reads a torn copy it then discards, rather than causing
+    // undefined behavior.
+    template <class T>
+    class SeqLocked
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "SeqLocked requires a trivially copyable type");
+    private:
+        enum { NumWords = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t) };
+        std::atomic<uint32_t> m_sequence; // odd while a Store() is in flight
+        std::atomic<uint64_t> m_words[NumWords];
+
+    public:
+        SeqLocked()
+            : m_sequence(0)
+        {
+            for (std::atomic<uint64_t>& word : m_words)
+            {
+                word.store(0, std::memory_order_relaxed);
+            }
+        }
+        SeqLocked(const SeqLocked& seqLocked) = delete;
+        SeqLocked& operator=(const SeqLocked& seqLocked) = delete;
+
+        // Must only be called from one thread at a time.
+        void Store(const T& value)
+        {
+            uint64_t words[NumWords] = {};
+            memcpy(words, &value, sizeof(T));
+            const uint32_t sequence = m_sequence.load(std::memory_order_relaxed);
+            m_sequence.store(sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            for (size_t wordIndex = 0; wordIndex < NumWords; ++wordIndex)
+            {
+                m_words[wordIndex].store(words[wordIndex], std::memory_order_relaxed);
+            }
+            m_sequence.store(sequence + 2, std::memory_order_release);
+        }
+
+        // May be called from any thread.
+        T Load() const
+        {
+            uint64_t words[NumWords];
+            for (;;)
+            {
+                const uint32_t sequenceBefore = m_sequence.load(std::memory_order_acquire);
+                if (sequenceBefore & 1)
+                {
+                    continue;
+                }
+                for (size_t wordIndex = 0; wordIndex < NumWords; ++wordIndex)
+                {
+                    words[wordIndex] = m_words[wordIndex].load(std::memory_order_relaxed);
+                }
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (m_sequence.load(std::memory_order_relaxed) == sequenceBefore)
+                {
+                    break;
+                }
+            }
+            T value;
+            memcpy(&value, words, sizeof(T));
+            return value;
+        }
+    };
+
+}}
+
+namespace nv { namespace perf { namespace profiler {
+
+    // The published summary of one metric of one range. The mean is exact; the quantiles are within the sketch's relative accuracy.
+    struct RangeMetricStatistics
+    {
+        uint64_t count;
+        double mean;
+        double min;
+        double max;
+        double p50;
+        double p95;
+        double p99;
+    };
+
+    // Per-range streaming statistics of a fixed set of metrics, keyed by full range name (e.g. "Frame/Draw").
+    // One thread folds in values with AddRangeValues(); any number of threads may concurrently read the statistics through
+    // GetNumRanges(), GetRangeName(), FindRange() and GetStatistics(), without locks and without ever blocking the writer.
+    // Memory is bounded by the capacity passed to Initialize(): ranges beyond it are dropped, and counted by GetNumDroppedRanges().
+    class RangeStatistics
+    {
+    private:
+        struct RangeEntry
+        {
+            std::string fullName;                       // written before the range is published, immutable afterwards
+            std::vector<QuantileSketch> sketches;       // writer-only, one per metric
+        };
+
+        size_t m_maxNumRanges;
+        size_t m_numMetrics;
+        double m_relativeAccuracy;
+        std::vector<RangeEntry> m_ranges;                                   // sized by Initialize(), never reallocated until Reset()
+        std::unique_ptr<SeqLocked<RangeMetricStatistics>[]> m_statistics;   // [rangeIndex * m_numMetrics + metricIndex]
+        std::unordered_map<std::string, size_t> m_rangeIndices;             // writer-only
+        std::atomic<size_t> m_numRanges;                                    // the published ranges
+        std::atomic<size_t> m_numDroppedRanges;
+
+    public:
+        RangeStatistics()
+            : m_maxNumRanges()
+            , m_numMetrics()
+            , m_relativeAccuracy()
+            , m_ranges()
+            , m_statistics()
+            , m_rangeIndices()
+            , m_numRanges(0)
+            , m_numDroppedRanges(0)
+        {
+        }
+        RangeStatistics(const RangeStatistics& rangeStatistics) = delete;
+        RangeStatistics& operator=(const RangeStatistics& rangeStatistics) = delete;
+
+        // Not thread-safe, must not be called while readers are active.
+        bool Initialize(size_t maxNumRanges, size_t numMetrics, double relativeAccuracy = 0.02)
+        {
+            Reset();
+            if (!maxNumRanges || !numMetrics)
+            {
+                NV_PERF_LOG_ERR(20, "RangeStatistics needs at least one range and one metric\n");
+                return false;
+            }
+            m_maxNumRanges = maxNumRanges;
+            m_numMetrics = numMetrics;
+            m_relativeAccuracy = relativeAccuracy;
+            m_ranges.resize(maxNumRanges);
+            m_statistics.reset(new SeqLocked<RangeMetricStatistics>[maxNumRanges * numMetrics]);
+            m_rangeIndices.reserve(maxNumRanges);
+            return true;
+        }
+
+        // Not thread-safe, must not be called while readers are active.
+        void Reset()
+        {
+            m_maxNumRanges = 0;
+            m_numMetrics = 0;
+            m_ranges.clear();
+            m_statistics.reset();
+            m_rangeIndices.clear();
+            m_numRanges.store(0, std::memory_order_relaxed);
+            m_numDroppedRanges.store(0, std::memory_order_relaxed);
+        }
+
+        bool IsInitialized() const
+        {
+            return !!m_maxNumRanges;
+        }
+
+        // Writer only. "pValues" holds one value per metric, NaNs are skipped. Returns false if the range is new and the capacity is exhausted.
+        bool AddRangeValues(const std::string& fullName, const double* pValues)
+        {
+            size_t rangeIndex = 0;
+            const auto rangeIt = m_rangeIndices.find(fullName);
+            if (rangeIt != m_rangeIndices.end())
+            {
+                rangeIndex = rangeIt->second;
+            }
+            else
+            {
+                rangeIndex = m_rangeIndices.size();
+                if (rangeIndex == m_maxNumRanges)
+                {
+                    if (!m_numDroppedRanges.fetch_add(1, std::memory_order_relaxed))
+                    {
+                        NV_PERF_LOG_WRN(50, "RangeStatistics is full (%zu ranges), dropping range %s and any other new ones\n", m_maxNumRanges, fullName.c_str());
+                    }
+                    return false;
+                }
+                RangeEntry& range = m_ranges[rangeIndex];
+                range.fullName = fullName;
+                range.sketches.assign(m_numMetrics, QuantileSketch(m_relativeAccuracy));
+                m_rangeIndices.emplace(fullName, rangeIndex);
+            }
+
+            static const double Quantiles[] = { 0.50, 0.95, 0.99 };
+            double quantileValues[3];
+            RangeEntry& range = m_ranges[rangeIndex];
+            for (size_t metricIndex = 0; metricIndex < m_numMetrics; ++metricIndex)
+            {
+                QuantileSketch& sketch = range.sketches[metricIndex];
+                sketch.Add(pValues[metricIndex]);
+                sketch.GetQuantiles(Quantiles, 3, quantileValues);
+
+                RangeMetricStatistics statistics = {};
+                statistics.count = sketch.GetCount();
+                statistics.mean = sketch.GetMean();
+                statistics.min = sketch.GetMin();
+                statistics.max = sketch.GetMax();
+                statistics.p50 = quantileValues[0];
+                statistics.p95 = quantileValues[1];
+                statistics.p99 = quantileValues[2];
+                m_statistics[rangeIndex * m_numMetrics + metricIndex].Store(statistics);
+            }
+
+            if (rangeIndex == m_numRanges.load(std::memory_order_relaxed))
+            {
+                m_numRanges.store(rangeIndex + 1, std::memory_order_release); // publishes fullName and the first statistics
+            }
+            return true;
+        }
+
+        // Writer only; e.g. to merge the statistics of several runs, or to export the full distribution.
+        const QuantileSketch* GetSketch(size_t rangeIndex, size_t metricIndex) const
+        {
+            if (rangeIndex >= m_rangeIndices.size() || metricIndex >= m_numMetrics)
+            {
+                return nullptr;
+            }
+            return &m_ranges[rangeIndex].sketches[metricIndex];
+        }
+
+        // Any thread. Ranges are never removed, so indices below this remain valid until Reset().
+        size_t GetNumRanges() const
+        {
+            return m_numRanges.load(std::memory_order_acquire);
+        }
+
+        size_t GetNumMetrics() const
+        {
+            return m_numMetrics;
+        }
+
+        size_t GetMaxNumRanges() const
+        {
+            return m_maxNumRanges;
+        }
+
+        size_t GetNumDroppedRanges() const
+        {
+            return m_numDroppedRanges.load(std::memory_order_relaxed);
+        }
+
+        // Any thread, for rangeIndex < GetNumRanges().
+        const std::string& GetRangeName(size_t rangeIndex) const
+        {
+            return m_ranges[rangeIndex].fullName;
+        }
+
+        // Any thread. Returns ~0 if the range has not been published.
+        size_t FindRange(const char* pFullName) const
+        {
+            const size_t numRanges = GetNumRanges();
+            for (size_t rangeIndex = 0; rangeIndex < numRanges; ++rangeIndex)
+            {
+                if (m_ranges[rangeIndex].fullName == pFullName)
+                {
+                    return rangeIndex;
+                }
+            }
+            return size_t(~0);
+        }
+
+        // Any thread. Returns a consistent snapshot of one metric of one range.
+        bool GetStatistics(size_t rangeIndex, size_t metricIndex, RangeMetricStatistics& statistics) const
+        {
+            if (rangeIndex >= GetNumRanges() || metricIndex >= m_numMetrics)
+            {
+                return false;
+            }
+            statistics = m_statistics[rangeIndex * m_numMetrics + metricIndex].Load();
+            return true;
+        }
+    };
+
+}}}
@@ -17,90 +17,186 @@
 #pragma once
 
 #include <string.h>
+#include <vector>
 #include "NvPerfInit.h"
 #include "NvPerfReportDefinition.h"
+
+// The report definitions are embedded LZ4-compressed and decompressed on first use, see NvPerfCompressedReportDefinition.h; define
+// NV_PERF_COMPRESSED_REPORT_DEFINITIONS to 0 to embed them uncompressed instead.
+#ifndef NV_PERF_COMPRESSED_REPORT_DEFINITIONS
+#define NV_PERF_COMPRESSED_REPORT_DEFINITIONS 1
+#endif
+
+// All chip families are compiled in by default. To compile in only some, define NV_PERF_REPORT_DEFINITIONS_DEFAULT to 0 and the families'
+// NV_PERF_REPORT_DEFINITIONS_<FAMILY> to 1, e.g. -DNV_PERF_REPORT_DEFINITIONS_DEFAULT=0 -DNV_PERF_REPORT_DEFINITIONS_GA10B=1.
+#ifndef NV_PERF_REPORT_DEFINITIONS_DEFAULT
+#define NV_PERF_REPORT_DEFINITIONS_DEFAULT 1
+#endif
+#ifndef NV_PERF_REPORT_DEFINITIONS_TU10X
+#define NV_PERF_REPORT_DEFINITIONS_TU10X NV_PERF_REPORT_DEFINITIONS_DEFAULT
+#endif
+#ifndef NV_PERF_REPORT_DEFINITIONS_TU11X
+#define NV_PERF_REPORT_DEFINITIONS_TU11X NV_PERF_REPORT_DEFINITIONS_DEFAULT
+#endif
+#ifndef NV_PERF_REPORT_DEFINITIONS_GA10X
+#define NV_PERF_REPORT_DEFINITIONS_GA10X NV_PERF_REPORT_DEFINITIONS_DEFAULT
+#endif
+#ifndef NV_PERF_REPORT_DEFINITIONS_GA10B
+#define NV_PERF_REPORT_DEFINITIONS_GA10B NV_PERF_REPORT_DEFINITIONS_DEFAULT
+#endif
+#ifndef NV_PERF_REPORT_DEFINITIONS_AD10X
+#define NV_PERF_REPORT_DEFINITIONS_AD10X NV_PERF_REPORT_DEFINITIONS_DEFAULT
+#endif
+
+#if NV_PERF_COMPRESSED_REPORT_DEFINITIONS
+#if NV_PERF_REPORT_DEFINITIONS_TU10X
+#include "NvPerfCompressedReportDefinitionTU10X.h"
+#endif
+#if NV_PERF_REPORT_DEFINITIONS_TU11X
+#include "NvPerfCompressedReportDefinitionTU11X.h"
+#endif
+#if NV_PERF_REPORT_DEFINITIONS_GA10X
+#include "NvPerfCompressedReportDefinitionGA10X.h"
+#endif
+#if NV_PERF_REPORT_DEFINITIONS_GA10B
+#include "NvPerfCompressedReportDefinitionGA10B.h"
+#endif
+#if NV_PERF_REPORT_DEFINITIONS_AD10X
+#include "NvPerfCompressedReportDefinitionAD10X.h"
+#endif
+#else
+#if NV_PERF_REPORT_DEFINITIONS_TU10X
 #include "NvPerfReportDefinitionTU10X.h"
+#endif
+#if NV_PERF_REPORT_DEFINITIONS_TU11X
 #include "NvPerfReportDefinitionTU11X.h"
+#endif
+#if NV_PERF_REPORT_DEFINITIONS_GA10X
 #include "NvPerfReportDefinitionGA10X.h"
+#endif
+#if NV_PERF_REPORT_DEFINITIONS_GA10B
 #include "NvPerfReportDefinitionGA10B.h"
+#endif
+#if NV_PERF_REPORT_DEFINITIONS_AD10X
 #include "NvPerfReportDefinitionAD10X.h"
+#endif
+#endif
 
 namespace nv { namespace perf {
 
-    namespace PerRangeReport {
+    // The generated headers declare the same families under nv::perf::compressed and nv::perf.
+#if NV_PERF_COMPRESSED_REPORT_DEFINITIONS
+    namespace compressed {} // in case no family is compiled in
+    namespace report_definitions = ::nv::perf::compressed;
+#else
+    namespace report_definitions = ::nv::perf;
+#endif
 
-        inline ReportDefinition GetReportDefinition(const char* pChipName)
+    struct ReportDefinitionFamily
+    {
+        const char* const* ppChipNames; // null-terminated
+        ReportDefinition (*getPerRangeReportDefinition)();
+        ReportDefinition (*getSummaryReportDefinition)();
+    };
+
+    // The chip families that are compiled in, terminated by an entry without chips.
+    inline const ReportDefinitionFamily* GetReportDefinitionFamilies()
+    {
+#if NV_PERF_REPORT_DEFINITIONS_TU10X
+        static const char* const TU10XChips[] = { "TU102", "TU104", "TU106", nullptr };
+#endif
+#if NV_PERF_REPORT_DEFINITIONS_TU11X
+        static const char* const TU11XChips[] = { "TU116", "TU117", nullptr };
+#endif
+#if NV_PERF_REPORT_DEFINITIONS_GA10X
+        static const char* const GA10XChips[] = { "GA102", "GA103", "GA104", "GA106", "GA107", nullptr };
+#endif
+#if NV_PERF_REPORT_DEFINITIONS_GA10B
+        static const char* const GA10BChips[] = { "GA10B", nullptr };
+#endif
+#if NV_PERF_REPORT_DEFINITIONS_AD10X
+        static const char* const AD10XChips[] = { "AD102", "AD103", "AD104", "AD106", "AD107", nullptr };
+#endif
+        static const ReportDefinitionFamily Families[] = {
+#if NV_PERF_REPORT_DEFINITIONS_TU10X
+            { TU10XChips, report_definitions::tu10x::PerRangeReport::GetReportDefinition, report_definitions::tu10x::SummaryReport::GetReportDefinition },
+#endif
+#if NV_PERF_REPORT_DEFINITIONS_TU11X
+            { TU11XChips, report_definitions::tu11x::PerRangeReport::GetReportDefinition, report_definitions::tu11x::SummaryReport::GetReportDefinition },
+#endif
+#if NV_PERF_REPORT_DEFINITIONS_GA10X
+            { GA10XChips, report_definitions::ga10x::PerRangeReport::GetReportDefinition, report_definitions::ga10x::SummaryReport::GetReportDefinition },
+#endif
+#if NV_PERF_REPORT_DEFINITIONS_GA10B
+            { GA10BChips, report_definitions::ga10b::PerRangeReport::GetReportDefinition, report_definitions::ga10b::SummaryReport::GetReportDefinition },
+#endif
+#if NV_PERF_REPORT_DEFINITIONS_AD10X
+            { AD10XChips, report_definitions::ad10x::PerRangeReport::GetReportDefinition, report_definitions::ad10x::SummaryReport::GetReportDefinition },
+#endif
+            { nullptr, nullptr, nullptr },
+        };
+        return Families;
+    }
+
+    inline const ReportDefinitionFamily* FindReportDefinitionFamily(const char* pChipName)
+    {
+        for (const ReportDefinitionFamily* pFamily = GetReportDefinitionFamilies(); pFamily->ppChipNames; ++pFamily)
         {
-            if (!strcmp(pChipName, "TU102") || !strcmp(pChipName, "TU104") || !strcmp(pChipName, "TU106"))
+            for (const char* const* ppChipName = pFamily->ppChipNames; *ppChipName; ++ppChipName)
             {
-                return tu10x::PerRangeReport::GetReportDefinition();
+                if (!strcmp(pChipName, *ppChipName))
+                {
+                    return pFamily;
+                }
             }
-            else if (!strcmp(pChipName, "TU116") || !strcmp(pChipName, "TU117"))
-            {
-                return tu11x::PerRangeReport::GetReportDefinition();
-            }
-            else if (!strcmp(pChipName, "GA102") || !strcmp(pChipName, "GA103") ||!strcmp(pChipName, "GA104") || !strcmp(pChipName, "GA106") || !strcmp(pChipName, "GA107"))
-            {
-                return ga10x::PerRangeReport::GetReportDefinition();
-            }
-            else if (!strcmp(pChipName, "GA10B"))
-            {
-                return ga10b::PerRangeReport::GetReportDefinition();
-            }
-            else if (false
-                     || !strcmp(pChipName, "AD102")
-                     || !strcmp(pChipName, "AD103")
-                     || !strcmp(pChipName, "AD104")
-                     || !strcmp(pChipName, "AD106")
-                     || !strcmp(pChipName, "AD107")
-            )    
+        }
+        NV_PERF_LOG_ERR(20, "Unknown chip \"%s\", or its report definitions are not compiled in\n", pChipName);
+        return nullptr;
+    }
+
+    // The chips that PerRangeReport::GetReportDefinition() and SummaryReport::GetReportDefinition() support.
+    inline const std::vector<const char*>& GetReportSupportedChips()
+    {
+        static const std::vector<const char*> chipNames = []() {
+            std::vector<const char*> names;
+            for (const ReportDefinitionFamily* pFamily = GetReportDefinitionFamilies(); pFamily->ppChipNames; ++pFamily)
             {
-                return ad10x::PerRangeReport::GetReportDefinition();
+                for (const char* const* ppChipName = pFamily->ppChipNames; *ppChipName; ++ppChipName)
+                {
+                    names.push_back(*ppChipName);
+                }
             }
-            else
+            return names;
+        }();
+        return chipNames;
+    }
+
+    namespace PerRangeReport {
+
+        // With compressed report definitions, the first call for a chip family decompresses its definition.
+        inline ReportDefinition GetReportDefinition(const char* pChipName)
+        {
+            const ReportDefinitionFamily* pFamily = FindReportDefinitionFamily(pChipName);
+            if (!pFamily)
             {
-                NV_PERF_LOG_ERR(20, "Unknown chip \"%s\"\n", pChipName);
                 return {};
             }
+            return pFamily->getPerRangeReportDefinition();
         }
 
     } // namespace PerRangeReport
 
     namespace SummaryReport {
 
+        // With compressed report definitions, the first call for a chip family decompresses its definition.
         inline ReportDefinition GetReportDefinition(const char* pChipName)
         {
-            if (!strcmp(pChipName, "TU102") || !strcmp(pChipName, "TU104") || !strcmp(pChipName, "TU106"))
-            {
-                return tu10x::SummaryReport::GetReportDefinition();
-            }
-            else if (!strcmp(pChipName, "TU116") || !strcmp(pChipName, "TU117"))
-            {
-                return tu11x::SummaryReport::GetReportDefinition();
-            }
-            else if (!strcmp(pChipName, "GA102") || !strcmp(pChipName, "GA103") ||!strcmp(pChipName, "GA104") || !strcmp(pChipName, "GA106") || !strcmp(pChipName, "GA107"))
-            {
-                return ga10x::SummaryReport::GetReportDefinition();
-            }
-            else if (!strcmp(pChipName, "GA10B"))
-            {
-                return ga10b::SummaryReport::GetReportDefinition();
-            }
-            else if (false
-                     || !strcmp(pChipName, "AD102")
-                     || !strcmp(pChipName, "AD103")
-                     || !strcmp(pChipName, "AD104")
-                     || !strcmp(pChipName, "AD106")
-                     || !strcmp(pChipName, "AD107")
-            )
-            {
-                return ad10x::SummaryReport::GetReportDefinition();
-            }
-            else
+            const ReportDefinitionFamily* pFamily = FindReportDefinitionFamily(pChipName);
+            if (!pFamily)
             {
-                NV_PERF_LOG_ERR(20, "Unknown chip \"%s\"\n", pChipName);
                 return {};
             }
+            return pFamily->getSummaryReportDefinition();
         }
 
     } // namespace SummaryReport
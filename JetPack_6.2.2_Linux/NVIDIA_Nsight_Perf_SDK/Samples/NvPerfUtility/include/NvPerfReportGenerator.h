@@ -22,8 +22,10 @@
 #include <chrono>
 #include <cctype>
 #include <ctime>
+#include <deque>
 #include <fstream>
 #include <iomanip>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -40,10 +42,14 @@
 #include "NvPerfInit.h"
 #include "NvPerfDeviceProperties.h"
 #include "NvPerfMetricsEvaluator.h"
+#include "NvPerfMetricNameIndex.h"
 #include "NvPerfRangeProfiler.h"
+#include "NvPerfRangeStatistics.h"
 #include "NvPerfReportDefinition.h"
 #include "NvPerfReportDefinitionHAL.h"
 #include "NvPerfCommonHtmlTemplates.h"
+#include "NvPerfJsonWriter.h"
+#include "NvPerfThreadPool.h"
 
 #ifdef WIN32
 #define NV_PERF_PATH_SEPARATOR '\\'
@@ -59,6 +65,12 @@ namespace nv { namespace perf {
         yes
     };
 
+    enum class PerRangeHtmlReport
+    {
+        standaloneFiles,    ///< one complete HTML file per range, which embeds the report template
+        sharedViewer        ///< the report template is written once, as a viewer that loads a small data file per range
+    };
+
     struct BaseMetricRequests
     {
         struct Request
@@ -128,6 +140,16 @@ namespace nv { namespace perf {
         AppendDateTime appendDateTimeToDirName = AppendDateTime::yes; ///< Only matters when a directory will be created
         bool writeCounterConfigImage = false; ///< If enabled, it will write the binary counter config image to the directory specified by "directoryName"
         bool writeCounterDataImage = false; ///< If enabled, it will write the binary counter data image to the directory specified by "directoryName"
+        PerRangeHtmlReport perRangeHtmlReport = PerRangeHtmlReport::standaloneFiles; ///< sharedViewer keeps the size of per-range reports proportional to their values, not to the template size;
+                                                                                     ///< environment variable NV_PERF_SHARED_RANGE_VIEWER=1 forces it
+    };
+
+    struct ContinuousCollectionOptions
+    {
+        std::vector<std::string> metrics = { "gpu__time_duration.sum" }; ///< Must be part of the counter configuration, i.e. of the report or of InitializeReportGenerator()'s additionalMetrics
+        size_t collectionIntervalInFrames = 1;  ///< Frames between the starts of consecutive collections; a collection is never started before the previous one has submitted all of its passes
+        size_t maxNumRanges = 512;              ///< Ranges beyond this are not tracked, see RangeStatistics::GetNumDroppedRanges()
+        double relativeAccuracy = 0.02;         ///< Of the p50/p95/p99 statistics
     };
 
     inline size_t GetTotalNumSubmetrics(const BaseMetricRequests& baseMetricRequests, const SubmetricRequests& submetricRequests)
@@ -202,41 +224,41 @@ namespace nv { namespace perf {
 
     inline std::string FormatJsDouble(double value)
     {
-        if (isnan(value))
-        {
-            return "\"NaN\"";
-        }
-        if (isinf(value))
-        {
-            if (value < 0)
-            {
-                return "\"-Infinity\"";
-            }
-            return "\"Infinity\"";
-        }
-        char buf[128];
-#ifdef WIN32
-        sprintf_s(buf, "%f", value);
-#else
-        snprintf(buf, 128, "%f", value);
-#endif
-        return buf;
+        std::string str;
+        StringSink sink(str);
+        JsonWriter<StringSink>(sink).Double(value);
+        return str;
     }
 
-    inline std::string MakeReport(const ReportDefinition& reportDefinition, const std::string& jsonContents)
+    // Writes the report template with the JSON produced by writeJson(JsonWriter<TSink>&) spliced in at its marker.
+    template <class TSink, class TWriteJson>
+    inline bool WriteReport(TSink& sink, const ReportDefinition& reportDefinition, TWriteJson&& writeJson)
     {
         const char* pJsonReplacementMarker = "/***JSON_DATA_HERE***/";
         const char* pInsertPoint = strstr(reportDefinition.pReportHtml, pJsonReplacementMarker);
         if (!pInsertPoint)
         {
-            return "";
+            return false;
         }
 
-        std::string reportHtml;
-        reportHtml.append(reportDefinition.pReportHtml, pInsertPoint - reportDefinition.pReportHtml);
-        reportHtml.append(jsonContents);
-        reportHtml.append(pInsertPoint + strlen(pJsonReplacementMarker));
+        JsonWriter<TSink> writer(sink);
+        writer.Raw(reportDefinition.pReportHtml, pInsertPoint - reportDefinition.pReportHtml);
+        writeJson(writer);
+        writer.Raw(pInsertPoint + strlen(pJsonReplacementMarker));
+        return true;
+    }
 
+    inline std::string MakeReport(const ReportDefinition& reportDefinition, const std::string& jsonContents)
+    {
+        std::string reportHtml;
+        StringSink sink(reportHtml);
+        const bool success = WriteReport(sink, reportDefinition, [&](JsonWriter<StringSink>& writer) {
+            writer.Raw(jsonContents);
+        });
+        if (!success)
+        {
+            return "";
+        }
         return reportHtml;
     }
 
@@ -262,7 +284,7 @@ namespace nv { namespace perf {
         return sstream.str();
     }
 
-    inline std::string GetRangeFileName(size_t rangeIndex, const char* pLeafName)
+    inline std::string GetRangeFileName(size_t rangeIndex, const char* pLeafName, const char* pExtension = ".html")
     {
         std::string leafName(pLeafName);
         for (char& c : leafName)
@@ -273,14 +295,69 @@ namespace nv { namespace perf {
             }
         }
         std::stringstream sstream;
-        sstream << std::setfill('0') << std::setw(5) << rangeIndex << "_" << leafName << ".html";
+        sstream << std::setfill('0') << std::setw(5) << rangeIndex << "_" << leafName << pExtension;
         return sstream.str();
     }
 
 
+    // The JSON keys of a report's metrics, resolved once so that writing the values of a range neither builds strings nor calls into the
+    // metrics evaluator; the latter also lets ranges be written from multiple threads.
+    struct ReportJsonKeys
+    {
+        struct PerMetricType
+        {
+            std::vector<std::string> baseMetricKeys; ///< e.g. "\"sm__cycles_elapsed\": { "
+            std::vector<std::string> submetricKeys;  ///< e.g. "\"sum.per_second\": "
+            std::vector<std::string> dimUnits;       ///< per base metric, only filled for counters and only if requested
+        };
+        PerMetricType perMetricType[NVPW_METRIC_TYPE__COUNT];
+    };
+
+    inline ReportJsonKeys MakeReportJsonKeys(NVPW_MetricsEvaluator* pMetricsEvaluator, const BaseMetricRequests& baseMetricRequests, const SubmetricRequests& submetricRequests, bool includeDimUnits)
+    {
+        ReportJsonKeys keys;
+        const MetricsEnumerator countersEnumerator = EnumerateCounters(pMetricsEvaluator);
+        const MetricsEnumerator ratiosEnumerator = EnumerateRatios(pMetricsEvaluator);
+        const MetricsEnumerator throughputsEnumerator = EnumerateThroughputs(pMetricsEvaluator);
+        for (size_t metricType = 0; metricType < NVPW_METRIC_TYPE__COUNT; ++metricType)
+        {
+            ReportJsonKeys::PerMetricType& perTypeKeys = keys.perMetricType[metricType];
+            for (const BaseMetricRequests::Request& baseMetric : baseMetricRequests.requests[metricType])
+            {
+                perTypeKeys.baseMetricKeys.push_back(std::string("\"") + ToCString(countersEnumerator, ratiosEnumerator, throughputsEnumerator, static_cast<NVPW_MetricType>(metricType), baseMetric.metricIndex) + "\": { ");
+                if (includeDimUnits && metricType == NVPW_METRIC_TYPE_COUNTER)
+                {
+                    std::vector<NVPW_DimUnitFactor> dimUnits;
+                    std::string dimUnitsStr;
+                    const NVPW_MetricEvalRequest metricRequest{ baseMetric.metricIndex, static_cast<uint8_t>(NVPW_METRIC_TYPE_COUNTER), static_cast<uint8_t>(NVPW_ROLLUP_OP_AVG), static_cast<uint16_t>(NVPW_SUBMETRIC_NONE) };
+                    const bool success = GetMetricDimUnits(pMetricsEvaluator, metricRequest, dimUnits);
+                    if (success)
+                    {
+                        dimUnitsStr = ToString(dimUnits, [&](NVPW_DimUnitName dimUnit, bool plural) {
+                            return ToCString(pMetricsEvaluator, dimUnit, plural);
+                        });
+                    }
+                    perTypeKeys.dimUnits.push_back(std::move(dimUnitsStr));
+                }
+            }
+            for (const SubmetricRequests::Request& submetric : submetricRequests.requests[metricType])
+            {
+                std::string submetricName;
+                if (metricType == NVPW_METRIC_TYPE_COUNTER || metricType == NVPW_METRIC_TYPE_THROUGHPUT)
+                {
+                    submetricName += ToCString(submetric.rollupOp);
+                }
+                submetricName += ToCString(submetric.submetric);
+                perTypeKeys.submetricKeys.push_back("\"" + submetricName.substr(1) + "\": ");
+            }
+        }
+        return keys;
+    }
+
     namespace PerRangeReport {
 
-        inline void InitReportDataMetrics(NVPW_MetricsEvaluator* pMetricsEvaluator, const std::vector<std::string>& additionalMetrics, ReportLayout& reportLayout)
+        // names missing from "metricNameIndex" are looked up in "pMetricsEvaluator"
+        inline void InitReportDataMetrics(const MetricNameIndex& metricNameIndex, NVPW_MetricsEvaluator* pMetricsEvaluator, const std::vector<std::string>& additionalMetrics, ReportLayout& reportLayout)
         {
             bool success = true;
             reportLayout.perRange.baseMetricRequests = {};
@@ -329,7 +406,7 @@ namespace nv { namespace perf {
                     const char* pCounterName = reportLayout.perRange.definition.ppCounterNames[counterIdx];
                     NVPW_MetricType metricType = NVPW_METRIC_TYPE__COUNT;
                     size_t metricIndex = ~size_t(0);
-                    success = GetMetricTypeAndIndex(pMetricsEvaluator, pCounterName, metricType, metricIndex);
+                    success = GetMetricTypeAndIndex(metricNameIndex, pMetricsEvaluator, pCounterName, metricType, metricIndex);
                     if (!success || (metricType != NVPW_METRIC_TYPE_COUNTER) || (metricIndex == ~size_t(0)))
                     {
                         NV_PERF_LOG_WRN(50, "GetMetricTypeAndIndex failed for metric: %s\n", pCounterName);
@@ -345,7 +422,7 @@ namespace nv { namespace perf {
                     const char* pRatioName = reportLayout.perRange.definition.ppRatioNames[ratioIdx];
                     NVPW_MetricType metricType = NVPW_METRIC_TYPE__COUNT;
                     size_t metricIndex = ~size_t(0);
-                    success = GetMetricTypeAndIndex(pMetricsEvaluator, pRatioName, metricType, metricIndex);
+                    success = GetMetricTypeAndIndex(metricNameIndex, pMetricsEvaluator, pRatioName, metricType, metricIndex);
                     if (!success || (metricType != NVPW_METRIC_TYPE_RATIO) || (metricIndex == ~size_t(0)))
                     {
                         NV_PERF_LOG_WRN(50, "GetMetricTypeAndIndex failed for metric: %s\n", pRatioName);
@@ -361,7 +438,7 @@ namespace nv { namespace perf {
                     const char* pThroughputName = reportLayout.perRange.definition.ppThroughputNames[throughputIdx];
                     NVPW_MetricType metricType = NVPW_METRIC_TYPE__COUNT;
                     size_t metricIndex = ~size_t(0);
-                    success = GetMetricTypeAndIndex(pMetricsEvaluator, pThroughputName, metricType, metricIndex);
+                    success = GetMetricTypeAndIndex(metricNameIndex, pMetricsEvaluator, pThroughputName, metricType, metricIndex);
                     if (!success || (metricType != NVPW_METRIC_TYPE_THROUGHPUT) || (metricIndex == ~size_t(0)))
                     {
                         NV_PERF_LOG_WRN(50, "GetMetricTypeAndIndex failed for metric: %s\n", pThroughputName);
@@ -376,7 +453,7 @@ namespace nv { namespace perf {
                     const char* pMetricName = additionalMetrics[additionalMetricIdx].c_str();
                     NVPW_MetricType metricType = NVPW_METRIC_TYPE__COUNT;
                     size_t metricIndex = ~size_t(0);
-                    success = GetMetricTypeAndIndex(pMetricsEvaluator, pMetricName, metricType, metricIndex);
+                    success = GetMetricTypeAndIndex(metricNameIndex, pMetricsEvaluator, pMetricName, metricType, metricIndex);
                     if (!success || (metricType == NVPW_METRIC_TYPE__COUNT) || (metricIndex == ~size_t(0)))
                     {
                         NV_PERF_LOG_WRN(50, "GetMetricTypeAndIndex failed for metric: %s\n", pMetricName);
@@ -402,121 +479,345 @@ namespace nv { namespace perf {
             }
         }
 
+        inline void InitReportDataMetrics(NVPW_MetricsEvaluator* pMetricsEvaluator, const std::vector<std::string>& additionalMetrics, ReportLayout& reportLayout)
+        {
+            MetricNameIndex metricNameIndex;
+            const bool cacheProperties = false;
+            if (!metricNameIndex.Build(pMetricsEvaluator, cacheProperties))
+            {
+                NV_PERF_LOG_WRN(50, "MetricNameIndex::Build failed\n");
+            }
+            InitReportDataMetrics(metricNameIndex, pMetricsEvaluator, additionalMetrics, reportLayout);
+        }
+
         // outputs key-value pairs for the report JSON, not including the enclosing brackets
-        inline std::string MakeJsonContents(NVPW_MetricsEvaluator* pMetricsEvaluator, const ReportLayout& reportLayout, const ReportData& reportData, size_t rangeIndex)
+        template <class TSink>
+        inline void WriteJsonContents(JsonWriter<TSink>& writer, const ReportJsonKeys& keys, const ReportLayout& reportLayout, const ReportData& reportData, size_t rangeIndex)
         {
             const ReportData::RangeData& rangeData = reportData.ranges[rangeIndex];
             size_t metricIndex = 0; // incremented in the same deterministic pattern as construction
 
-            std::stringstream sstream;
-            sstream << "\"rangeName\": \"" << rangeData.fullName << "\",\n";
-            sstream << "\"debug\": false,\n";
-            sstream << "\"populateDummyValues\": false,\n";
-            sstream << "\"secondsSinceEpoch\": " << reportData.secondsSinceEpoch << ",\n";
-            sstream << "\"device\": {\n";
-            sstream << "  \"gpuName\": \"" << reportLayout.gpuName << "\",\n";
-            sstream << "  \"chipName\": \"" << reportLayout.chipName << "\",\n";
-            sstream << "  \"clockLockingStatus\": \"" << ToCString(reportData.clockStatus) << "\"\n";
-            sstream << "},\n";
+            writer.Raw("\"rangeName\": ").String(rangeData.fullName).Raw(",\n");
+            writer.Raw("\"debug\": false,\n");
+            writer.Raw("\"populateDummyValues\": false,\n");
+            writer.Raw("\"secondsSinceEpoch\": ").Integer((int64_t)reportData.secondsSinceEpoch).Raw(",\n");
+            writer.Raw("\"device\": {\n");
+            writer.Raw("  \"gpuName\": ").String(reportLayout.gpuName).Raw(",\n");
+            writer.Raw("  \"chipName\": ").String(reportLayout.chipName).Raw(",\n");
+            writer.Raw("  \"clockLockingStatus\": ").String(ToCString(reportData.clockStatus)).Raw("\n");
+            writer.Raw("},\n");
 
-            const MetricsEnumerator countersEnumerator = EnumerateCounters(pMetricsEvaluator);
-            const MetricsEnumerator ratiosEnumerator = EnumerateRatios(pMetricsEvaluator);
-            const MetricsEnumerator throughputsEnumerator = EnumerateThroughputs(pMetricsEvaluator);
             for (size_t metricType = 0; metricType < NVPW_METRIC_TYPE__COUNT; ++metricType)
             {
                 if (metricType)
                 {
-                    sstream << ", ";
+                    writer.Raw(", ");
                 }
 
                 if (metricType == NVPW_METRIC_TYPE_COUNTER)
                 {
-                    sstream << "\"counters\": {\n";
+                    writer.Raw("\"counters\": {\n");
                 }
                 else if (metricType == NVPW_METRIC_TYPE_RATIO)
                 {
-                    sstream << "\"ratios\": {\n";
+                    writer.Raw("\"ratios\": {\n");
                 }
                 else if (metricType == NVPW_METRIC_TYPE_THROUGHPUT)
                 {
-                    sstream << "\"throughputs\": {\n";
+                    writer.Raw("\"throughputs\": {\n");
                 }
 
-                const auto& perTypeBaseMetrics = reportLayout.perRange.baseMetricRequests.requests[metricType];
-                const auto& perTypeSubmetrics = reportLayout.perRange.submetricRequests.requests[metricType];
-                for (size_t baseMetricIndex = 0; baseMetricIndex < perTypeBaseMetrics.size(); ++baseMetricIndex)
+                const ReportJsonKeys::PerMetricType& perTypeKeys = keys.perMetricType[metricType];
+                for (size_t baseMetricIndex = 0; baseMetricIndex < perTypeKeys.baseMetricKeys.size(); ++baseMetricIndex)
                 {
-                    const BaseMetricRequests::Request& baseMetric = perTypeBaseMetrics[baseMetricIndex];
-
                     if (baseMetricIndex)
                     {
-                        sstream << ", ";
+                        writer.Raw(", ");
                     }
 
-                    sstream << "\"" << ToCString(countersEnumerator, ratiosEnumerator, throughputsEnumerator, static_cast<NVPW_MetricType>(metricType), baseMetric.metricIndex) << "\": { ";
-                    for (size_t submetricIndex = 0; submetricIndex < perTypeSubmetrics.size(); ++submetricIndex)
+                    writer.Raw(perTypeKeys.baseMetricKeys[baseMetricIndex]);
+                    for (size_t submetricIndex = 0; submetricIndex < perTypeKeys.submetricKeys.size(); ++submetricIndex)
                     {
-                        const SubmetricRequests::Request& submetric = perTypeSubmetrics[submetricIndex];
-
                         if (submetricIndex)
                         {
-                            sstream << ", ";
+                            writer.Raw(", ");
                         }
-
-                        std::string submetricName;
-                        if (metricType == NVPW_METRIC_TYPE_COUNTER || metricType == NVPW_METRIC_TYPE_THROUGHPUT)
-                        {
-                            submetricName += ToCString(submetric.rollupOp);
-                        }
-                        submetricName += ToCString(submetric.submetric);
-                        sstream << "\"" << submetricName.substr(1) << "\": " << FormatJsDouble(rangeData.perRangeReportValues[metricIndex++]);
+                        writer.Raw(perTypeKeys.submetricKeys[submetricIndex]).Double(rangeData.perRangeReportValues[metricIndex++]);
                     }
                     // if the metric type is Counter, additionally include its dimensional units
-                    if (metricType == NVPW_METRIC_TYPE_COUNTER)
+                    if (baseMetricIndex < perTypeKeys.dimUnits.size())
                     {
-                        std::vector<NVPW_DimUnitFactor> dimUnits;
-                        std::string dimUnitsStr;
-                        const NVPW_MetricEvalRequest metricRequest{ baseMetric.metricIndex, static_cast<uint8_t>(NVPW_METRIC_TYPE_COUNTER), static_cast<uint8_t>(NVPW_ROLLUP_OP_AVG), static_cast<uint16_t>(NVPW_SUBMETRIC_NONE) };
-                        const bool success = GetMetricDimUnits(pMetricsEvaluator, metricRequest, dimUnits);
-                        if (success)
+                        if (!perTypeKeys.submetricKeys.empty())
                         {
-                            dimUnitsStr = ToString(dimUnits, [&](NVPW_DimUnitName dimUnit, bool plural) {
-                                return ToCString(pMetricsEvaluator, dimUnit, plural);
-                            });
+                            writer.Raw(", ");
                         }
-                        if (!perTypeSubmetrics.empty())
-                        {
-                            sstream << ", ";
-                        }
-                        sstream << "\"dim_units\": \"" << dimUnitsStr << "\"";
+                        writer.Raw("\"dim_units\": ").String(perTypeKeys.dimUnits[baseMetricIndex]);
                     }
-                    sstream << " }\n";
+                    writer.Raw(" }\n");
                 }
-                sstream << "}\n";
+                writer.Raw("}\n");
             }
+        }
+
+        inline ReportJsonKeys MakeJsonKeys(NVPW_MetricsEvaluator* pMetricsEvaluator, const ReportLayout& reportLayout)
+        {
+            return MakeReportJsonKeys(pMetricsEvaluator, reportLayout.perRange.baseMetricRequests, reportLayout.perRange.submetricRequests, true);
+        }
 
-            std::string jsonContents = sstream.str();
+        // outputs key-value pairs for the report JSON, not including the enclosing brackets
+        inline std::string MakeJsonContents(NVPW_MetricsEvaluator* pMetricsEvaluator, const ReportLayout& reportLayout, const ReportData& reportData, size_t rangeIndex)
+        {
+            const ReportJsonKeys keys = MakeJsonKeys(pMetricsEvaluator, reportLayout);
+            std::string jsonContents;
+            StringSink sink(jsonContents);
+            JsonWriter<StringSink> writer(sink);
+            WriteJsonContents(writer, keys, reportLayout, reportData, rangeIndex);
             return jsonContents;
         }
 
-        inline void WriteHtmlReportFiles(NVPW_MetricsEvaluator* pMetricsEvaluator, const ReportLayout& reportLayout, const ReportData& reportData)
+        // Streams one file per range through "writeFile(BufferedFileSink&, size_t rangeIndex)". If "pThreadPool" is given, files are
+        // written from all of its workers, each through its own sink.
+        template <class TWriteFile>
+        inline void WriteRangeFiles(const ReportData& reportData, const char* pExtension, ThreadPool* pThreadPool, TWriteFile&& writeFile)
         {
-            for (size_t rangeIndex = 0, numRanges = reportData.ranges.size(); rangeIndex < numRanges; rangeIndex++)
-            {
+            std::vector<BufferedFileSink> sinks(pThreadPool ? pThreadPool->GetNumWorkers() : 1);
+            auto writeRange = [&](size_t workerIndex, size_t rangeIndex) {
                 const char* pLeafName = reportData.ranges[rangeIndex].leafName.c_str();
-                const std::string filename(reportData.reportDirectoryName + NV_PERF_PATH_SEPARATOR + GetRangeFileName(rangeIndex, pLeafName));
-                if (FILE* pHTMLFile = OpenFile(&filename[0], "wb"))
+                const std::string filename(reportData.reportDirectoryName + NV_PERF_PATH_SEPARATOR + GetRangeFileName(rangeIndex, pLeafName, pExtension));
+                BufferedFileSink& sink = sinks[workerIndex];
+                if (!sink.Open(filename.c_str()))
                 {
-                    const std::string jsonContents = MakeJsonContents(pMetricsEvaluator, reportLayout, reportData, rangeIndex);
-                    const std::string reportHtml = MakeReport(reportLayout.perRange.definition, jsonContents);
-                    fputs(reportHtml.c_str(), pHTMLFile);
-                    fclose(pHTMLFile);
+                    return;
                 }
-                else
+                writeFile(sink, rangeIndex);
+                if (!sink.Close())
+                {
+                    NV_PERF_LOG_ERR(20, "Failed to write file: %s\n", filename.c_str());
+                }
+            };
+
+            if (pThreadPool)
+            {
+                pThreadPool->ParallelFor(reportData.ranges.size(), writeRange);
+            }
+            else
+            {
+                for (size_t rangeIndex = 0, numRanges = reportData.ranges.size(); rangeIndex < numRanges; rangeIndex++)
+                {
+                    writeRange(0, rangeIndex);
+                }
+            }
+        }
+
+        // Streams one HTML file per range. If "pThreadPool" is given, files are written from all of its workers, each through its own sink.
+        inline void WriteHtmlReportFiles(const ReportJsonKeys& keys, const ReportLayout& reportLayout, const ReportData& reportData, ThreadPool* pThreadPool = nullptr)
+        {
+            WriteRangeFiles(reportData, ".html", pThreadPool, [&](BufferedFileSink& sink, size_t rangeIndex) {
+                WriteReport(sink, reportLayout.perRange.definition, [&](JsonWriter<BufferedFileSink>& writer) {
+                    WriteJsonContents(writer, keys, reportLayout, reportData, rangeIndex);
+                });
+            });
+        }
+
+        inline void WriteHtmlReportFiles(NVPW_MetricsEvaluator* pMetricsEvaluator, const ReportLayout& reportLayout, const ReportData& reportData, ThreadPool* pThreadPool = nullptr)
+        {
+            WriteHtmlReportFiles(MakeJsonKeys(pMetricsEvaluator, reportLayout), reportLayout, reportData, pThreadPool);
+        }
+
+        // The viewer of PerRangeHtmlReport::sharedViewer; it displays the range named by its URL fragment, e.g. "range.html#00003_Draw".
+        inline const char* GetSharedViewerFileName()
+        {
+            return "range.html";
+        }
+
+        // The link to a range's report, from the summary report.
+        inline std::string GetRangeLink(size_t rangeIndex, const char* pLeafName, PerRangeHtmlReport perRangeHtmlReport)
+        {
+            if (perRangeHtmlReport == PerRangeHtmlReport::sharedViewer)
+            {
+                return std::string(GetSharedViewerFileName()) + "#" + GetRangeFileName(rangeIndex, pLeafName, "");
+            }
+            return GetRangeFileName(rangeIndex, pLeafName);
+        }
+
+        // Writes what the ranges of a report share, i.e. the device and the names of all values, as a JavaScript object literal.
+        template <class TSink>
+        inline void WriteSharedViewerLayout(JsonWriter<TSink>& writer, const ReportJsonKeys& keys, const ReportLayout& reportLayout, const ReportData& reportData)
+        {
+            // the keys are pre-formatted for the per-range JSON, e.g. "\"sm__cycles_elapsed\": { ", of which only the quoted name is needed here
+            auto writeQuotedNames = [&](const std::vector<std::string>& quotedKeys) {
+                writer.Raw("[ ");
+                for (size_t ii = 0; ii < quotedKeys.size(); ++ii)
+                {
+                    if (ii)
+                    {
+                        writer.Raw(", ");
+                    }
+                    const std::string& key = quotedKeys[ii];
+                    writer.Raw(key.data(), key.find('"', 1) + 1);
+                }
+                writer.Raw(" ]");
+            };
+
+            writer.Raw("{\n");
+            writer.Raw("\"secondsSinceEpoch\": ").Integer((int64_t)reportData.secondsSinceEpoch).Raw(",\n");
+            writer.Raw("\"device\": {\n");
+            writer.Raw("  \"gpuName\": ").String(reportLayout.gpuName).Raw(",\n");
+            writer.Raw("  \"chipName\": ").String(reportLayout.chipName).Raw(",\n");
+            writer.Raw("  \"clockLockingStatus\": ").String(ToCString(reportData.clockStatus)).Raw("\n");
+            writer.Raw("},\n");
+            writer.Raw("\"metricTypes\": [\n");
+            for (size_t metricType = 0; metricType < NVPW_METRIC_TYPE__COUNT; ++metricType)
+            {
+                const ReportJsonKeys::PerMetricType& perTypeKeys = keys.perMetricType[metricType];
+                if (metricType)
+                {
+                    writer.Raw(",\n");
+                }
+                if (metricType == NVPW_METRIC_TYPE_COUNTER)
+                {
+                    writer.Raw("{ \"name\": \"counters\"");
+                }
+                else if (metricType == NVPW_METRIC_TYPE_RATIO)
                 {
-                    NV_PERF_LOG_ERR(20, "OpenFile failed for file: %s\n", &filename[0]);
+                    writer.Raw("{ \"name\": \"ratios\"");
                 }
+                else if (metricType == NVPW_METRIC_TYPE_THROUGHPUT)
+                {
+                    writer.Raw("{ \"name\": \"throughputs\"");
+                }
+                writer.Raw(",\n  \"submetrics\": ");
+                writeQuotedNames(perTypeKeys.submetricKeys);
+                writer.Raw(",\n  \"metrics\": ");
+                writeQuotedNames(perTypeKeys.baseMetricKeys);
+                writer.Raw(",\n  \"dimUnits\": [ ");
+                for (size_t ii = 0; ii < perTypeKeys.dimUnits.size(); ++ii)
+                {
+                    if (ii)
+                    {
+                        writer.Raw(", ");
+                    }
+                    writer.String(perTypeKeys.dimUnits[ii]);
+                }
+                writer.Raw(" ] }");
+            }
+            writer.Raw("\n]\n}");
+        }
+
+        // Writes the values of a range in the order of WriteSharedViewerLayout()'s names, as a script that the shared viewer loads.
+        template <class TSink>
+        inline void WriteSharedViewerRangeData(JsonWriter<TSink>& writer, const ReportData& reportData, size_t rangeIndex)
+        {
+            const ReportData::RangeData& rangeData = reportData.ranges[rangeIndex];
+            writer.Raw("g_nvperfRange = {\n");
+            writer.Raw("\"rangeName\": ").String(rangeData.fullName).Raw(",\n");
+            writer.Raw("\"values\": [");
+            for (size_t ii = 0; ii < rangeData.perRangeReportValues.size(); ++ii)
+            {
+                writer.Raw(ii ? ',' : ' ').Double(rangeData.perRangeReportValues[ii]);
+            }
+            writer.Raw(" ]\n};\n");
+        }
+
+        // Writes the report template as GetSharedViewerFileName(). Ahead of the template's script that receives the report JSON, a script is
+        // inserted that embeds the layout and synchronously loads the range's data file; the JSON is then expanded from both.
+        template <class TSink>
+        inline bool WriteSharedViewer(TSink& sink, const ReportJsonKeys& keys, const ReportLayout& reportLayout, const ReportData& reportData)
+        {
+            const char* pReportHtml = reportLayout.perRange.definition.pReportHtml;
+            const char* pJsonReplacementMarker = "/***JSON_DATA_HERE***/";
+            const char* pInsertPoint = strstr(pReportHtml, pJsonReplacementMarker);
+            if (!pInsertPoint)
+            {
+                return false;
+            }
+            // the last "<script" before the marker opens the script that receives the JSON
+            const char* pScript = nullptr;
+            for (const char* pFound = strstr(pReportHtml, "<script"); pFound && pFound < pInsertPoint; pFound = strstr(pFound + 1, "<script"))
+            {
+                pScript = pFound;
+            }
+            if (!pScript)
+            {
+                return false;
             }
+
+            JsonWriter<TSink> writer(sink);
+            writer.Raw(pReportHtml, pScript - pReportHtml);
+            writer.Raw("<script>\n");
+            writer.Raw("      g_nvperfRangeLayout = ");
+            WriteSharedViewerLayout(writer, keys, reportLayout, reportData);
+            writer.Raw(";\n");
+            writer.Raw(
+                "      (function () {\n"
+                "        var rangeFileName = decodeURIComponent(window.location.hash.substring(1));\n"
+                "        if (/^[A-Za-z0-9_.\\-]+$/.test(rangeFileName)) {\n"
+                "          document.write('<script src=\"' + rangeFileName + '.js\"><\\/script>');\n"
+                "        }\n"
+                "        window.addEventListener('hashchange', function () { window.location.reload(); });\n"
+                "      })();\n"
+                "      function nvperfExpandRange() {\n"
+                "        if (typeof g_nvperfRange === 'undefined') {\n"
+                "          return {};\n"
+                "        }\n"
+                "        var json = { rangeName: g_nvperfRange.rangeName, secondsSinceEpoch: g_nvperfRangeLayout.secondsSinceEpoch, device: g_nvperfRangeLayout.device };\n"
+                "        var values = g_nvperfRange.values;\n"
+                "        var valueIndex = 0;\n"
+                "        g_nvperfRangeLayout.metricTypes.forEach(function (metricType) {\n"
+                "          var metrics = {};\n"
+                "          metricType.metrics.forEach(function (metricName, metricIndex) {\n"
+                "            var submetrics = {};\n"
+                "            metricType.submetrics.forEach(function (submetricName) {\n"
+                "              submetrics[submetricName] = values[valueIndex++];\n"
+                "            });\n"
+                "            if (metricIndex < metricType.dimUnits.length) {\n"
+                "              submetrics.dim_units = metricType.dimUnits[metricIndex];\n"
+                "            }\n"
+                "            metrics[metricName] = submetrics;\n"
+                "          });\n"
+                "          json[metricType.name] = metrics;\n"
+                "        });\n"
+                "        return json;\n"
+                "      }\n"
+                "    </script>\n"
+                "    ");
+            writer.Raw(pScript, pInsertPoint - pScript);
+            writer.Raw("\"debug\": false, \"populateDummyValues\": false, ...nvperfExpandRange()");
+            writer.Raw(pInsertPoint + strlen(pJsonReplacementMarker));
+            return true;
+        }
+
+        // Writes the report template once as a shared viewer, plus a data file per range that only holds its name and values. If "pThreadPool"
+        // is given, the data files are written from all of its workers.
+        inline void WriteSharedViewerHtmlReportFiles(const ReportJsonKeys& keys, const ReportLayout& reportLayout, const ReportData& reportData, ThreadPool* pThreadPool = nullptr)
+        {
+            const std::string filename = reportData.reportDirectoryName + NV_PERF_PATH_SEPARATOR + GetSharedViewerFileName();
+            BufferedFileSink sink;
+            if (!sink.Open(filename.c_str()))
+            {
+                return;
+            }
+            const bool success = WriteSharedViewer(sink, keys, reportLayout, reportData);
+            if (!sink.Close())
+            {
+                NV_PERF_LOG_ERR(20, "Failed to write file: %s\n", filename.c_str());
+                return;
+            }
+            if (!success)
+            {
+                NV_PERF_LOG_ERR(20, "The report template has no place for the report JSON, skipping per-range data files\n");
+                return;
+            }
+
+            WriteRangeFiles(reportData, ".js", pThreadPool, [&](BufferedFileSink& rangeSink, size_t rangeIndex) {
+                JsonWriter<BufferedFileSink> writer(rangeSink);
+                WriteSharedViewerRangeData(writer, reportData, rangeIndex);
+            });
+        }
+
+        inline void WriteSharedViewerHtmlReportFiles(NVPW_MetricsEvaluator* pMetricsEvaluator, const ReportLayout& reportLayout, const ReportData& reportData, ThreadPool* pThreadPool = nullptr)
+        {
+            WriteSharedViewerHtmlReportFiles(MakeJsonKeys(pMetricsEvaluator, reportLayout), reportLayout, reportData, pThreadPool);
         }
 
         inline void WriteCsvReportFile(NVPW_MetricsEvaluator* pMetricsEvaluator, const ReportLayout& reportLayout, const ReportData& reportData)
@@ -561,7 +862,8 @@ namespace nv { namespace perf {
 
     namespace SummaryReport {
 
-        inline void InitReportDataMetrics(NVPW_MetricsEvaluator* pMetricsEvaluator, ReportLayout& reportLayout)
+        // names missing from "metricNameIndex" are looked up in "pMetricsEvaluator"
+        inline void InitReportDataMetrics(const MetricNameIndex& metricNameIndex, NVPW_MetricsEvaluator* pMetricsEvaluator, ReportLayout& reportLayout)
         {
             bool success = true;
             reportLayout.summary.baseMetricRequests = {};
@@ -610,7 +912,7 @@ namespace nv { namespace perf {
                     const char* pCounterName = reportLayout.summary.definition.ppCounterNames[counterIdx];
                     NVPW_MetricType metricType = NVPW_METRIC_TYPE__COUNT;
                     size_t metricIndex = ~size_t(0);
-                    success = GetMetricTypeAndIndex(pMetricsEvaluator, pCounterName, metricType, metricIndex);
+                    success = GetMetricTypeAndIndex(metricNameIndex, pMetricsEvaluator, pCounterName, metricType, metricIndex);
                     if (!success || (metricType != NVPW_METRIC_TYPE_COUNTER) || (metricIndex == ~size_t(0)))
                     {
                         NV_PERF_LOG_WRN(50, "GetMetricTypeAndIndex failed for metric: %s\n", pCounterName);
@@ -626,7 +928,7 @@ namespace nv { namespace perf {
                     const char* pRatioName = reportLayout.summary.definition.ppRatioNames[ratioIdx];
                     NVPW_MetricType metricType = NVPW_METRIC_TYPE__COUNT;
                     size_t metricIndex = ~size_t(0);
-                    success = GetMetricTypeAndIndex(pMetricsEvaluator, pRatioName, metricType, metricIndex);
+                    success = GetMetricTypeAndIndex(metricNameIndex, pMetricsEvaluator, pRatioName, metricType, metricIndex);
                     if (!success || (metricType != NVPW_METRIC_TYPE_RATIO) || (metricIndex == ~size_t(0)))
                     {
                         NV_PERF_LOG_WRN(50, "GetMetricTypeAndIndex failed for metric: %s\n", pRatioName);
@@ -642,7 +944,7 @@ namespace nv { namespace perf {
                     const char* pThroughputName = reportLayout.summary.definition.ppThroughputNames[throughputIdx];
                     NVPW_MetricType metricType = NVPW_METRIC_TYPE__COUNT;
                     size_t metricIndex = ~size_t(0);
-                    success = GetMetricTypeAndIndex(pMetricsEvaluator, pThroughputName, metricType, metricIndex);
+                    success = GetMetricTypeAndIndex(metricNameIndex, pMetricsEvaluator, pThroughputName, metricType, metricIndex);
                     if (!success || (metricType != NVPW_METRIC_TYPE_THROUGHPUT) || (metricIndex == ~size_t(0)))
                     {
                         NV_PERF_LOG_WRN(50, "GetMetricTypeAndIndex failed for metric: %s\n", pThroughputName);
@@ -653,134 +955,142 @@ namespace nv { namespace perf {
             }
         }
 
-        // outputs key-value pairs for the report JSON, not including the enclosing brackets
-        inline std::string MakeJsonContents(NVPW_MetricsEvaluator* pMetricsEvaluator, const ReportLayout& reportLayout, const ReportData& reportData)
+        inline void InitReportDataMetrics(NVPW_MetricsEvaluator* pMetricsEvaluator, ReportLayout& reportLayout)
+        {
+            MetricNameIndex metricNameIndex;
+            const bool cacheProperties = false;
+            if (!metricNameIndex.Build(pMetricsEvaluator, cacheProperties))
+            {
+                NV_PERF_LOG_WRN(50, "MetricNameIndex::Build failed\n");
+            }
+            InitReportDataMetrics(metricNameIndex, pMetricsEvaluator, reportLayout);
+        }
+
+        // outputs key-value pairs for the report JSON, not including the enclosing brackets; "perRangeHtmlReport" selects what ranges link to
+        template <class TSink>
+        inline void WriteJsonContents(JsonWriter<TSink>& writer, const ReportJsonKeys& keys, const ReportLayout& reportLayout, const ReportData& reportData, PerRangeHtmlReport perRangeHtmlReport = PerRangeHtmlReport::standaloneFiles)
         {
-            std::stringstream sstream;
-            sstream << "\"debug\": false,\n";
-            sstream << "\"populateDummyValues\": false,\n";
-            sstream << "\"secondsSinceEpoch\": " << reportData.secondsSinceEpoch << ",\n";
-            sstream << "\"device\": {\n";
-            sstream << "  \"gpuName\": \"" << reportLayout.gpuName << "\",\n";
-            sstream << "  \"chipName\": \"" << reportLayout.chipName << "\"\n";
-            sstream << "},\n";
-            sstream << "\"ranges\": [ ";
+            writer.Raw("\"debug\": false,\n");
+            writer.Raw("\"populateDummyValues\": false,\n");
+            writer.Raw("\"secondsSinceEpoch\": ").Integer((int64_t)reportData.secondsSinceEpoch).Raw(",\n");
+            writer.Raw("\"device\": {\n");
+            writer.Raw("  \"gpuName\": ").String(reportLayout.gpuName).Raw(",\n");
+            writer.Raw("  \"chipName\": ").String(reportLayout.chipName).Raw("\n");
+            writer.Raw("},\n");
+            writer.Raw("\"ranges\": [ ");
             for (size_t ii = 0; ii < reportData.ranges.size(); ++ii)
             {
                 if (ii)
                 {
-                    sstream << ", ";
+                    writer.Raw(", ");
                 }
-                sstream << '"' << reportData.ranges[ii].fullName << '"';
+                writer.String(reportData.ranges[ii].fullName);
             }
-            sstream << "],\n";
+            writer.Raw("],\n");
 
-            sstream << "\"range_file_names\": [ ";
+            writer.Raw("\"range_file_names\": [ ");
             for (size_t ii = 0; ii < reportData.ranges.size(); ++ii)
             {
                 if (ii)
                 {
-                    sstream << ", ";
+                    writer.Raw(", ");
                 }
-                sstream << '"' << GetRangeFileName(ii, reportData.ranges[ii].leafName.c_str()) << '"';
+                writer.String(PerRangeReport::GetRangeLink(ii, reportData.ranges[ii].leafName.c_str(), perRangeHtmlReport));
             }
-            sstream << "],\n";
+            writer.Raw("],\n");
 
-            const MetricsEnumerator countersEnumerator = EnumerateCounters(pMetricsEvaluator);
-            const MetricsEnumerator ratiosEnumerator = EnumerateRatios(pMetricsEvaluator);
-            const MetricsEnumerator throughputsEnumerator = EnumerateThroughputs(pMetricsEvaluator);
             size_t metricIndex = 0;
             size_t metricIndexPrev = metricIndex;
             for (size_t metricType = 0; metricType < NVPW_METRIC_TYPE__COUNT; ++metricType)
             {
                 if (metricType)
                 {
-                    sstream << ", ";
+                    writer.Raw(", ");
                 }
 
                 if (metricType == NVPW_METRIC_TYPE_COUNTER)
                 {
-                    sstream << "\"rangesCounters\": {\n";
+                    writer.Raw("\"rangesCounters\": {\n");
                 }
                 else if (metricType == NVPW_METRIC_TYPE_RATIO)
                 {
-                    sstream << "\"rangesRatios\": {\n";
+                    writer.Raw("\"rangesRatios\": {\n");
                 }
                 else if (metricType == NVPW_METRIC_TYPE_THROUGHPUT)
                 {
-                    sstream << "\"rangesThroughputs\": {\n";
+                    writer.Raw("\"rangesThroughputs\": {\n");
                 }
 
-                const auto& perTypeBaseMetrics = reportLayout.summary.baseMetricRequests.requests[metricType];
-                const auto& perTypeSubmetrics = reportLayout.summary.submetricRequests.requests[metricType];
+                const ReportJsonKeys::PerMetricType& perTypeKeys = keys.perMetricType[metricType];
                 for (size_t rangeIndex = 0; rangeIndex < reportData.ranges.size(); ++rangeIndex)
                 {
                     if (rangeIndex)
                     {
-                        sstream << ", ";
+                        writer.Raw(", ");
                     }
 
-                    sstream << "\"" << reportData.ranges[rangeIndex].fullName << "\": {\n";
+                    writer.String(reportData.ranges[rangeIndex].fullName).Raw(": {\n");
                     metricIndex = metricIndexPrev;
                     const std::vector<double>& metricValues = reportData.ranges[rangeIndex].summaryReportValues;
-                    for (size_t baseMetricIndex = 0; baseMetricIndex < perTypeBaseMetrics.size(); ++baseMetricIndex)
+                    for (size_t baseMetricIndex = 0; baseMetricIndex < perTypeKeys.baseMetricKeys.size(); ++baseMetricIndex)
                     {
-                        const BaseMetricRequests::Request& baseMetric = perTypeBaseMetrics[baseMetricIndex];
-
                         if (baseMetricIndex)
                         {
-                            sstream << ", ";
+                            writer.Raw(", ");
                         }
 
-                        sstream << "\"" << ToCString(countersEnumerator, ratiosEnumerator, throughputsEnumerator, static_cast<NVPW_MetricType>(metricType), baseMetric.metricIndex) << "\": { ";
-                        for (size_t submetricIndex = 0; submetricIndex < perTypeSubmetrics.size(); ++submetricIndex)
+                        writer.Raw(perTypeKeys.baseMetricKeys[baseMetricIndex]);
+                        for (size_t submetricIndex = 0; submetricIndex < perTypeKeys.submetricKeys.size(); ++submetricIndex)
                         {
-                            const SubmetricRequests::Request& submetric = perTypeSubmetrics[submetricIndex];
-
                             if (submetricIndex)
                             {
-                                sstream << ", ";
-                            }
-
-                            std::string submetricName;
-                            if (metricType == NVPW_METRIC_TYPE_COUNTER || metricType == NVPW_METRIC_TYPE_THROUGHPUT)
-                            {
-                                submetricName += ToCString(submetric.rollupOp);
+                                writer.Raw(", ");
                             }
-                            submetricName += ToCString(submetric.submetric);
-                            sstream << "\"" << submetricName.substr(1) << "\": " << FormatJsDouble(metricValues[metricIndex++]);
+                            writer.Raw(perTypeKeys.submetricKeys[submetricIndex]).Double(metricValues[metricIndex++]);
                         }
-                        sstream << " }\n";
+                        writer.Raw(" }\n");
                     }
-                    sstream << "}\n";
+                    writer.Raw("}\n");
                 }
-                sstream << "}\n";
+                writer.Raw("}\n");
                 metricIndexPrev = metricIndex;
             }
             const size_t totalNumSubmetrics = GetTotalNumSubmetrics(reportLayout.summary.baseMetricRequests, reportLayout.summary.submetricRequests);
             assert(metricIndex == totalNumSubmetrics);
             NV_PERF_UNUSED_VARIABLE(totalNumSubmetrics);
+        }
 
-            std::string jsonContents = sstream.str();
-            return jsonContents;
+        inline ReportJsonKeys MakeJsonKeys(NVPW_MetricsEvaluator* pMetricsEvaluator, const ReportLayout& reportLayout)
+        {
+            return MakeReportJsonKeys(pMetricsEvaluator, reportLayout.summary.baseMetricRequests, reportLayout.summary.submetricRequests, false);
         }
 
-        inline void WriteHtmlReportFile(NVPW_MetricsEvaluator* pMetricsEvaluator, const ReportLayout& reportLayout, const ReportData& reportData)
+        // outputs key-value pairs for the report JSON, not including the enclosing brackets
+        inline std::string MakeJsonContents(NVPW_MetricsEvaluator* pMetricsEvaluator, const ReportLayout& reportLayout, const ReportData& reportData)
         {
-            const int filenameLength = snprintf(nullptr, 0, "%s%csummary.html", reportData.reportDirectoryName.c_str(), NV_PERF_PATH_SEPARATOR);
-            std::vector<char> filename(filenameLength + 1);
-            snprintf(&filename[0], filename.size(), "%s%csummary.html", reportData.reportDirectoryName.c_str(), NV_PERF_PATH_SEPARATOR);
+            const ReportJsonKeys keys = MakeJsonKeys(pMetricsEvaluator, reportLayout);
+            std::string jsonContents;
+            StringSink sink(jsonContents);
+            JsonWriter<StringSink> writer(sink);
+            WriteJsonContents(writer, keys, reportLayout, reportData);
+            return jsonContents;
+        }
 
-            if (FILE* pHTMLFile = OpenFile(&filename[0], "wb"))
+        inline void WriteHtmlReportFile(NVPW_MetricsEvaluator* pMetricsEvaluator, const ReportLayout& reportLayout, const ReportData& reportData, PerRangeHtmlReport perRangeHtmlReport = PerRangeHtmlReport::standaloneFiles)
+        {
+            const std::string filename = reportData.reportDirectoryName + NV_PERF_PATH_SEPARATOR + "summary.html";
+            BufferedFileSink sink;
+            if (!sink.Open(filename.c_str()))
             {
-                const std::string jsonContents = MakeJsonContents(pMetricsEvaluator, reportLayout, reportData);
-                const std::string reportHtml = MakeReport(reportLayout.summary.definition, jsonContents);
-                fputs(reportHtml.c_str(), pHTMLFile);
-                fclose(pHTMLFile);
+                return;
             }
-            else
+            const ReportJsonKeys keys = MakeJsonKeys(pMetricsEvaluator, reportLayout);
+            WriteReport(sink, reportLayout.summary.definition, [&](JsonWriter<BufferedFileSink>& writer) {
+                WriteJsonContents(writer, keys, reportLayout, reportData, perRangeHtmlReport);
+            });
+            if (!sink.Close())
             {
-                NV_PERF_LOG_ERR(20, "OpenFile failed for file: %s\n", &filename[0]);
+                NV_PERF_LOG_ERR(20, "Failed to write file: %s\n", filename.c_str());
             }
         }
 
@@ -824,6 +1134,37 @@ namespace nv { namespace perf {
 
     } // namespace Summary
 
+    // Sets up the per-range and summary reports of "pChipName" in "reportLayout", and returns the metric eval requests their counter configuration
+    // has to collect. Shared by the report generators and the offline configuration cache warm-up, so that both end up with the same cache key.
+    // Names missing from "metricNameIndex" are looked up in "pMetricsEvaluator".
+    inline bool InitReportLayout(
+        const MetricNameIndex& metricNameIndex,
+        NVPW_MetricsEvaluator* pMetricsEvaluator,
+        const char* pChipName,
+        const std::vector<std::string>& additionalMetrics,
+        ReportLayout& reportLayout,
+        std::vector<NVPW_MetricEvalRequest>& metricEvalRequests)
+    {
+        reportLayout.perRange.definition = PerRangeReport::GetReportDefinition(pChipName);
+        reportLayout.summary.definition = SummaryReport::GetReportDefinition(pChipName);
+        if (!reportLayout.perRange.definition.pReportHtml || !reportLayout.summary.definition.pReportHtml)
+        {
+            NV_PERF_LOG_ERR(10, "HTML Reports not supported for chip=%s\n", pChipName);
+            return false;
+        }
+        PerRangeReport::InitReportDataMetrics(metricNameIndex, pMetricsEvaluator, additionalMetrics, reportLayout);
+        SummaryReport::InitReportDataMetrics(metricNameIndex, pMetricsEvaluator, reportLayout);
+
+        metricEvalRequests.clear();
+        auto collectMetrics = [&](const NVPW_MetricEvalRequest* pMetricEvalRequests, size_t numMetricEvalRequests) {
+            metricEvalRequests.insert(metricEvalRequests.end(), pMetricEvalRequests, pMetricEvalRequests + numMetricEvalRequests);
+            return true;
+        };
+        ForEachBaseMetric(reportLayout.perRange.baseMetricRequests, reportLayout.perRange.submetricRequests, collectMetrics);
+        ForEachBaseMetric(reportLayout.summary.baseMetricRequests, reportLayout.summary.submetricRequests, collectMetrics);
+        return true;
+    }
+
 } } // namespace nv::perf
 
 namespace nv { namespace perf { namespace profiler {
@@ -865,10 +1206,80 @@ namespace nv { namespace perf { namespace profiler {
         };
 
         enum { MaxNumRangesDefault = 512 };
+        enum { MinNumRangesPerEvaluationThread = 16 }; // below this, spinning up worker evaluators costs more than it saves
+        enum { MaxNumPendingContinuousCollections = 2 }; // decoded continuous collections waiting for evaluation, before new ones are held back
+        enum { MaxNumQueuedReports = 2 }; // collected reports waiting for the background finalizer, before OnFrameEnd() blocks on it
+
+        typedef std::function<NVPW_MetricsEvaluator*(std::vector<uint8_t>& scratchBuffer)> CreateMetricsEvaluatorFn;
+
+    protected: // types
+        // a collected report, which FinalizeReport() evaluates and writes
+        struct FinalizationJob
+        {
+            std::vector<uint8_t> counterDataImage;
+            std::vector<uint8_t> counterConfigImage; // empty unless it is written
+            ReportOutputOptions outputOptions;
+            std::string reportDirectoryName;
+            bool createDirectory;
+            bool writeCounterDataImage;
+            bool openReportDirectory;
+            uint64_t secondsSinceEpoch;
+            NVPW_Device_ClockStatus clockStatus;
+            size_t numEvaluationThreads;
+        };
+
+        // state of the optional background finalization mode, see SetAsyncReportFinalization()
+        struct ReportFinalizer
+        {
+            std::thread thread;
+            std::mutex mutex;
+            std::condition_variable jobAvailable;
+            std::condition_variable jobTaken;
+            std::condition_variable jobsDone;
+            std::deque<FinalizationJob> jobs; // guarded by mutex, at most MaxNumQueuedReports
+            bool busy;                        // guarded by mutex, set while a job taken from "jobs" is finalized
+            bool stop;                        // guarded by mutex, the thread exits once "jobs" is drained
+            // owned by the thread, separate from the render thread's, which may evaluate continuous collections meanwhile
+            MetricsEvaluator metricsEvaluator;
+            std::vector<MetricsEvaluator> workerMetricsEvaluators;
+            ThreadPool threadPool;
+
+            ReportFinalizer()
+                : busy(false)
+                , stop(false)
+            {
+            }
+        };
+
+        // state of the background evaluation of continuous collections, which keeps metric evaluation and RangeStatistics updates out of
+        // OnFrameEnd(); its thread is the only writer of the RangeStatistics
+        struct ContinuousEvaluator
+        {
+            std::thread thread;
+            std::mutex mutex;
+            std::condition_variable imageAvailable;
+            std::condition_variable imagesDone;
+            std::deque<std::vector<uint8_t>> counterDataImages;      // guarded by mutex, decoded and waiting for evaluation
+            std::vector<std::vector<uint8_t>> freeCounterDataImages; // guarded by mutex, evaluated, handed back to the decoder for reuse
+            size_t numPending;                                       // guarded by mutex, queued or being evaluated
+            bool stop;                                               // guarded by mutex, the thread exits once "counterDataImages" is drained
+            MetricsEvaluator metricsEvaluator;                       // owned by the thread
+
+            ContinuousEvaluator()
+                : numPending(0)
+                , stop(false)
+            {
+            }
+        };
 
     protected:
         MetricsEvaluator m_metricsEvaluator;
+        MetricNameIndex m_metricNameIndex;                       // names only, built along with m_metricsEvaluator
+        CreateMetricsEvaluatorFn m_createMetricsEvaluator;
+        std::vector<MetricsEvaluator> m_workerMetricsEvaluators; // one per additional evaluation thread, created on demand
+        ThreadPool m_evaluationThreadPool;                       // also writes the per-range HTML files
         CounterConfiguration m_configuration;
+        CounterConfigurationCache m_counterConfigurationCache;   // disabled unless a directory is set
 
         ReportLayout m_reportLayout;
 
@@ -882,6 +1293,9 @@ namespace nv { namespace perf { namespace profiler {
         bool m_openReportDirectoryAfterCollection;
         bool m_writeCounterConfigImage;
         bool m_writeCounterDataImage;
+        bool m_sharedRangeViewer;
+        size_t m_numEvaluationThreads;
+        bool m_asyncReportFinalization;
 
         // state machine
         bool m_explicitSession;
@@ -889,6 +1303,21 @@ namespace nv { namespace perf { namespace profiler {
         bool m_inCollection;
         bool m_setConfigDone;
 
+        // continuous collection
+        bool m_inContinuousCollection;
+        size_t m_continuousCollectionInterval;
+        size_t m_numFramesSinceContinuousEnqueue;
+        size_t m_numContinuousCollectionsInFlight;
+        std::vector<NVPW_MetricEvalRequest> m_continuousMetricEvalRequests;
+        std::vector<double> m_continuousMetricValues;
+        DecodeResult m_continuousDecodeResult;          // reused, so that a pooling profiler recycles its counter data image
+        RangeStatistics m_rangeStatistics;
+        std::unique_ptr<ContinuousEvaluator> m_pContinuousEvaluator; // created by the first StartContinuousCollection()
+
+        std::unique_ptr<ReportFinalizer> m_pReportFinalizer; // created by the first report finalized in the background
+        mutable std::mutex m_lastWrittenReportDirectoryNameMutex;
+        std::string m_lastWrittenReportDirectoryName; // guarded by m_lastWrittenReportDirectoryNameMutex, written by either mode of finalization
+
     protected:
         template <class TBeginSession>
         bool BeginSessionImpl(TBeginSession&& beginSession)
@@ -912,6 +1341,7 @@ namespace nv { namespace perf { namespace profiler {
         }
 
         void EvalRangeMetricValues(
+            NVPW_MetricsEvaluator* pMetricsEvaluator,
             const ReportData& reportData,
             const BaseMetricRequests& baseMetricRequests,
             const SubmetricRequests& submetricRequests,
@@ -927,7 +1357,7 @@ namespace nv { namespace perf { namespace profiler {
                 submetricRequests,
                 [&](const NVPW_MetricEvalRequest* pMetricEvalRequests, size_t numMetricEvalRequests) {
                     const bool success = EvaluateToGpuValues(
-                        m_metricsEvaluator,
+                        pMetricsEvaluator,
                         reportData.pCounterDataImage,
                         reportData.counterDataImageSize,
                         rangeIndex,
@@ -949,49 +1379,623 @@ namespace nv { namespace perf { namespace profiler {
             assert(metricIndex == totalNumSubmetrics);
         }
 
-    public:
-        ~ReportGeneratorStateMachine()
-        {
-            Reset();
-        }
-
-        ReportGeneratorStateMachine(IReportProfiler& reportProfiler)
-            : m_metricsEvaluator()
-            , m_configuration()
-            , m_reportLayout()
-            , m_deviceIndex(size_t(~0))
-            , m_clockStatus(NVPW_DEVICE_CLOCK_STATUS_UNKNOWN)
-            , m_reportProfiler(reportProfiler)
-            , m_frameLevelRangeName()
-            , m_numNestingLevels(1)
-            , m_openReportDirectoryAfterCollection(false)
-            , m_writeCounterConfigImage(false)
-            , m_writeCounterDataImage(false)
-            , m_explicitSession(false)
-            , m_reportDirectoryName()
-            , m_inCollection(false)
-            , m_setConfigDone(false)
+        template <class TBeginSession>
+        bool OnContinuousFrameStart(TBeginSession&& beginSession)
         {
-            std::string envValue;
-            if (GetEnvVariable("NV_PERF_OPEN_REPORT_DIR_AFTER_COLLECTION", envValue))
+            if (!m_reportProfiler.IsInSession())
             {
-                char* pEnd = nullptr;
-                m_openReportDirectoryAfterCollection = !!strtol(envValue.c_str(), &pEnd, 0);
+                if (!beginSession())
+                {
+                    NV_PERF_LOG_ERR(10, "BeginSession failed\n");
+                    StopContinuousCollection();
+                    return false;
+                }
             }
-            if (GetEnvVariable("NV_PERF_WRITE_COUNTER_CONFIG_IMAGE", envValue))
+
+            // while the evaluation falls behind, new collections are held back rather than queued without bound
+            if (m_reportProfiler.AllPassesSubmitted() && m_numFramesSinceContinuousEnqueue >= m_continuousCollectionInterval
+                && GetNumPendingContinuousCollections() < MaxNumPendingContinuousCollections)
             {
-                char* pEnd = nullptr;
-                m_writeCounterConfigImage = !!strtol(envValue.c_str(), &pEnd, 0);
+                if (!m_reportProfiler.EnqueueCounterCollection(SetConfigParams(m_configuration, m_numNestingLevels)))
+                {
+                    NV_PERF_LOG_ERR(10, "m_reportProfiler.EnqueueCounterCollection failed\n");
+                    StopContinuousCollection();
+                    return false;
+                }
+                ++m_numContinuousCollectionsInFlight;
+                m_numFramesSinceContinuousEnqueue = 0;
             }
-            if (GetEnvVariable("NV_PERF_WRITE_COUNTER_DATA_IMAGE", envValue))
+            ++m_numFramesSinceContinuousEnqueue;
+
+            if (!m_reportProfiler.AllPassesSubmitted())
             {
-                char* pEnd = nullptr;
+                if (!m_reportProfiler.BeginPass())
+                {
+                    NV_PERF_LOG_ERR(10, "BeginPass failed\n");
+                    StopContinuousCollection();
+                    return false;
+                }
+                if (!m_frameLevelRangeName.empty() && !m_reportProfiler.PushRange(m_frameLevelRangeName.c_str()))
+                {
+                    NV_PERF_LOG_ERR(10, "m_reportProfiler.PushRange failed\n");
+                    StopContinuousCollection();
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool OnContinuousFrameEnd()
+        {
+            if (!m_reportProfiler.AllPassesSubmitted() && m_reportProfiler.IsInPass())
+            {
+                if (!m_frameLevelRangeName.empty() && !m_reportProfiler.PopRange())
+                {
+                    NV_PERF_LOG_ERR(10, "m_reportProfiler.PopRange failed\n");
+                    StopContinuousCollection();
+                    return false;
+                }
+                if (!m_reportProfiler.EndPass())
+                {
+                    NV_PERF_LOG_ERR(10, "m_reportProfiler.EndPass failed\n");
+                    StopContinuousCollection();
+                    return false;
+                }
+            }
+
+            if (!m_numContinuousCollectionsInFlight)
+            {
+                return true;
+            }
+            if (!m_reportProfiler.DecodeCounters(m_continuousDecodeResult))
+            {
+                NV_PERF_LOG_ERR(10, "m_reportProfiler.DecodeCounters failed\n");
+                StopContinuousCollection();
+                return false;
+            }
+            if (m_continuousDecodeResult.allStatisticalSamplesCollected)
+            {
+                --m_numContinuousCollectionsInFlight;
+                EnqueueContinuousEvaluation();
+            }
+            return true;
+        }
+
+        size_t GetNumPendingContinuousCollections()
+        {
+            if (!m_pContinuousEvaluator)
+            {
+                return 0;
+            }
+            std::lock_guard<std::mutex> lock(m_pContinuousEvaluator->mutex);
+            return m_pContinuousEvaluator->numPending;
+        }
+
+        // Hands the decoded counter data image to the continuous evaluator, and gives the decoder a previously evaluated one to reuse.
+        void EnqueueContinuousEvaluation()
+        {
+            if (!m_pContinuousEvaluator)
+            {
+                AccumulateRangeStatistics(m_metricsEvaluator, m_continuousDecodeResult.counterDataImage);
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_pContinuousEvaluator->mutex);
+                m_pContinuousEvaluator->counterDataImages.push_back(std::move(m_continuousDecodeResult.counterDataImage));
+                m_continuousDecodeResult.counterDataImage = {};
+                if (!m_pContinuousEvaluator->freeCounterDataImages.empty())
+                {
+                    m_continuousDecodeResult.counterDataImage = std::move(m_pContinuousEvaluator->freeCounterDataImages.back());
+                    m_pContinuousEvaluator->freeCounterDataImages.pop_back();
+                }
+                ++m_pContinuousEvaluator->numPending;
+            }
+            m_pContinuousEvaluator->imageAvailable.notify_one();
+        }
+
+        void ContinuousEvaluatorThreadProc(ContinuousEvaluator* pContinuousEvaluator)
+        {
+            std::unique_lock<std::mutex> lock(pContinuousEvaluator->mutex);
+            for (;;)
+            {
+                pContinuousEvaluator->imageAvailable.wait(lock, [&] { return pContinuousEvaluator->stop || !pContinuousEvaluator->counterDataImages.empty(); });
+                if (pContinuousEvaluator->counterDataImages.empty())
+                {
+                    return; // stopped, and drained
+                }
+                std::vector<uint8_t> counterDataImage = std::move(pContinuousEvaluator->counterDataImages.front());
+                pContinuousEvaluator->counterDataImages.pop_front();
+                lock.unlock();
+
+                AccumulateRangeStatistics(pContinuousEvaluator->metricsEvaluator, counterDataImage);
+
+                lock.lock();
+                if (pContinuousEvaluator->freeCounterDataImages.size() < MaxNumPendingContinuousCollections)
+                {
+                    pContinuousEvaluator->freeCounterDataImages.push_back(std::move(counterDataImage));
+                }
+                if (!--pContinuousEvaluator->numPending)
+                {
+                    pContinuousEvaluator->imagesDone.notify_all();
+                }
+            }
+        }
+
+        // Evaluates the continuous collection's metrics of every range in "counterDataImage" and folds them into m_rangeStatistics. Runs on
+        // the continuous evaluator's thread, so it must not touch any other state the frame thread writes.
+        virtual void AccumulateRangeStatistics(MetricsEvaluator& metricsEvaluator, const std::vector<uint8_t>& counterDataImage)
+        {
+            if (!MetricsEvaluatorSetDeviceAttributes(metricsEvaluator, counterDataImage.data(), counterDataImage.size()))
+            {
+                NV_PERF_LOG_ERR(50, "MetricsEvaluatorSetDeviceAttributes failed, skipping the collection\n");
+                return;
+            }
+            const size_t numRanges = CounterDataGetNumRanges(counterDataImage.data());
+            for (size_t rangeIndex = 0; rangeIndex < numRanges; ++rangeIndex)
+            {
+                const bool evalSuccess = EvaluateToGpuValues(
+                    metricsEvaluator,
+                    counterDataImage.data(),
+                    counterDataImage.size(),
+                    rangeIndex,
+                    m_continuousMetricEvalRequests.size(),
+                    m_continuousMetricEvalRequests.data(),
+                    m_continuousMetricValues.data());
+                if (!evalSuccess)
+                {
+                    NV_PERF_LOG_ERR(50, "Failed to evaluate metrics of range %zu\n", rangeIndex);
+                    continue;
+                }
+                m_rangeStatistics.AddRangeValues(CounterDataGetRangeName(counterDataImage.data(), rangeIndex, '/'), m_continuousMetricValues.data());
+            }
+        }
+
+        // Returns the number of evaluators usable for "reportData", including "pMetricsEvaluator". Worker evaluators are created once and reused
+        // across collections, but their device attributes have to be set for every counter data image.
+        size_t PrepareWorkerMetricsEvaluators(
+            const ReportData& reportData,
+            size_t numEvaluationThreads,
+            std::vector<MetricsEvaluator>& workerMetricsEvaluators,
+            ThreadPool& threadPool)
+        {
+            size_t numEvaluators = numEvaluationThreads ? numEvaluationThreads : (std::max)(1u, std::thread::hardware_concurrency());
+            numEvaluators = (std::min)(numEvaluators, reportData.ranges.size() / MinNumRangesPerEvaluationThread);
+            if (numEvaluators < 2 || !m_createMetricsEvaluator)
+            {
+                return 1;
+            }
+
+            while (workerMetricsEvaluators.size() < numEvaluators - 1)
+            {
+                std::vector<uint8_t> scratchBuffer; // NVPW_MetricsEvaluator keeps state in its scratch buffer, so every evaluator needs its own
+                NVPW_MetricsEvaluator* pMetricsEvaluator = m_createMetricsEvaluator(scratchBuffer);
+                if (!pMetricsEvaluator)
+                {
+                    NV_PERF_LOG_WRN(50, "Failed to create a worker metrics evaluator, evaluating with %zu threads\n", workerMetricsEvaluators.size() + 1);
+                    break;
+                }
+                workerMetricsEvaluators.emplace_back(pMetricsEvaluator, std::move(scratchBuffer));
+            }
+            numEvaluators = (std::min)(numEvaluators, workerMetricsEvaluators.size() + 1);
+            for (size_t workerIndex = 1; workerIndex < numEvaluators; ++workerIndex)
+            {
+                if (!MetricsEvaluatorSetDeviceAttributes(workerMetricsEvaluators[workerIndex - 1], reportData.pCounterDataImage, reportData.counterDataImageSize))
+                {
+                    numEvaluators = workerIndex;
+                    break;
+                }
+            }
+
+            if (threadPool.GetNumWorkers() != numEvaluators)
+            {
+                threadPool.Initialize(numEvaluators);
+            }
+            return numEvaluators;
+        }
+
+        // Per-range HTML files are independent of each other and need no evaluator, so they are written from as many threads as there are
+        // files, up to the evaluation thread count. Returns nullptr if they should be written from the calling thread.
+        static ThreadPool* PrepareReportWriterThreads(size_t numFiles, size_t numEvaluationThreads, ThreadPool& threadPool)
+        {
+            size_t numWriters = numEvaluationThreads ? numEvaluationThreads : (std::max)(1u, std::thread::hardware_concurrency());
+            numWriters = (std::min)(numWriters, numFiles);
+            if (numWriters < 2)
+            {
+                return nullptr;
+            }
+            if (threadPool.GetNumWorkers() != numWriters)
+            {
+                threadPool.Initialize(numWriters);
+            }
+            return &threadPool;
+        }
+
+        // Fills summaryReportValues and perRangeReportValues of every range in "reportData", whose ranges must already be sized.
+        // Ranges are spread across the evaluation threads, each of which evaluates with its own NVPW_MetricsEvaluator.
+        void EvalAllRangeMetricValues(
+            ReportData& reportData,
+            size_t numEvaluationThreads,
+            NVPW_MetricsEvaluator* pMetricsEvaluator,
+            std::vector<MetricsEvaluator>& workerMetricsEvaluators,
+            ThreadPool& threadPool)
+        {
+            const size_t numEvaluators = PrepareWorkerMetricsEvaluators(reportData, numEvaluationThreads, workerMetricsEvaluators, threadPool);
+            auto evalRange = [&](size_t workerIndex, size_t rangeIndex) {
+                NVPW_MetricsEvaluator* pWorkerMetricsEvaluator = workerIndex ? (NVPW_MetricsEvaluator*)workerMetricsEvaluators[workerIndex - 1] : pMetricsEvaluator;
+                EvalRangeMetricValues(
+                    pWorkerMetricsEvaluator,
+                    reportData,
+                    m_reportLayout.summary.baseMetricRequests,
+                    m_reportLayout.summary.submetricRequests,
+                    rangeIndex,
+                    reportData.ranges[rangeIndex].summaryReportValues);
+                EvalRangeMetricValues(
+                    pWorkerMetricsEvaluator,
+                    reportData,
+                    m_reportLayout.perRange.baseMetricRequests,
+                    m_reportLayout.perRange.submetricRequests,
+                    rangeIndex,
+                    reportData.ranges[rangeIndex].perRangeReportValues);
+            };
+            if (numEvaluators < 2)
+            {
+                for (size_t rangeIndex = 0; rangeIndex < reportData.ranges.size(); ++rangeIndex)
+                {
+                    evalRange(0, rangeIndex);
+                }
+                return;
+            }
+            threadPool.ParallelFor(reportData.ranges.size(), evalRange);
+        }
+
+        // Evaluates and writes a collected report. Only reads m_reportLayout and m_createMetricsEvaluator from the state machine, so it can run on
+        // the background finalizer with evaluators of its own. Returns false if nothing was written.
+        virtual bool FinalizeReport(
+            const FinalizationJob& job,
+            MetricsEvaluator& metricsEvaluator,
+            std::vector<MetricsEvaluator>& workerMetricsEvaluators,
+            ThreadPool& threadPool)
+        {
+            const std::string& reportDirectoryName = job.reportDirectoryName;
+            bool setDeviceSuccess = MetricsEvaluatorSetDeviceAttributes(metricsEvaluator, job.counterDataImage.data(), job.counterDataImage.size());
+            if (!setDeviceSuccess)
+            {
+                NV_PERF_LOG_ERR(50, "MetricsEvaluatorSetDeviceAttributes failed, skipping writing report files\n");
+                return false;
+            }
+
+            if (job.createDirectory)
+            {
+                // try to recursively create the directory
+                for (size_t di = 0; di < reportDirectoryName.length(); ++di)
+                {
+                    if (reportDirectoryName[di] == NV_PERF_PATH_SEPARATOR)
+                    {
+                        std::string parentDir(reportDirectoryName, 0, di);
+#ifdef WIN32
+                        BOOL dirCreated = CreateDirectoryA(parentDir.c_str(), NULL);
+#else
+                        bool dirCreated = !mkdir(parentDir.c_str(), 0777);
+#endif
+                        if (!dirCreated) { /* it probably already exists */ }
+                    }
+                }
+            }
+
+            ReportData reportData = {};
+            reportData.secondsSinceEpoch = job.secondsSinceEpoch;
+            reportData.clockStatus = job.clockStatus;
+            reportData.pCounterDataImage = job.counterDataImage.data();
+            reportData.counterDataImageSize = job.counterDataImage.size();
+            reportData.reportDirectoryName = reportDirectoryName;
+
+            const size_t numRanges = nv::perf::CounterDataGetNumRanges(reportData.pCounterDataImage);
+            reportData.ranges.resize(numRanges);
+            for (size_t rangeIndex = 0; rangeIndex < numRanges; rangeIndex++)
+            {
+                const char* pLeafName = nullptr;
+                reportData.ranges[rangeIndex].fullName = CounterDataGetRangeName(reportData.pCounterDataImage, rangeIndex, '/', &pLeafName);
+                reportData.ranges[rangeIndex].leafName = pLeafName;
+            }
+            EvalAllRangeMetricValues(reportData, job.numEvaluationThreads, metricsEvaluator, workerMetricsEvaluators, threadPool);
+
+            const ReportOutputOptions& outputOptions = job.outputOptions;
+            if (outputOptions.enableHtmlReport)
+            {
+                [&]() {
+                    const std::string filename = reportDirectoryName + NV_PERF_PATH_SEPARATOR + "readme.html";
+                    FILE* fp = OpenFile(filename.c_str(), "wt");
+                    if (!fp)
+                    {
+                        NV_PERF_LOG_ERR(50, "Failed to create files in directory %s, skipping writing HTML files\n", reportDirectoryName.c_str());
+                        return;
+                    }
+                    fprintf(fp, "%s", GetReadMeHtml().c_str());
+                    fclose(fp);
+
+                    SummaryReport::WriteHtmlReportFile(metricsEvaluator, m_reportLayout, reportData, outputOptions.perRangeHtmlReport);
+                    ThreadPool* pReportWriterThreads = PrepareReportWriterThreads(reportData.ranges.size(), job.numEvaluationThreads, threadPool);
+                    if (outputOptions.perRangeHtmlReport == PerRangeHtmlReport::sharedViewer)
+                    {
+                        PerRangeReport::WriteSharedViewerHtmlReportFiles(metricsEvaluator, m_reportLayout, reportData, pReportWriterThreads);
+                    }
+                    else
+                    {
+                        PerRangeReport::WriteHtmlReportFiles(metricsEvaluator, m_reportLayout, reportData, pReportWriterThreads);
+                    }
+                }();
+            }
+
+            if (outputOptions.enableCsvReport)
+            {
+                SummaryReport::WriteCsvReportFile(metricsEvaluator, m_reportLayout, reportData);
+                PerRangeReport::WriteCsvReportFile(metricsEvaluator, m_reportLayout, reportData);
+            }
+
+            if (!job.counterConfigImage.empty())
+            {
+                const std::string filename = reportDirectoryName + NV_PERF_PATH_SEPARATOR + "CounterConfigImage.dat";
+                std::ofstream ofs(filename, std::ios::binary);
+                if (ofs.is_open())
+                {
+                    ofs.write(reinterpret_cast<const char*>(job.counterConfigImage.data()), job.counterConfigImage.size());
+                    if (!ofs.good())
+                    {
+                        NV_PERF_LOG_ERR(51, "Error occurred while writing counter config image to %s\n", filename.c_str());
+                    }
+                }
+                else
+                {
+                    NV_PERF_LOG_ERR(50, "Failed to write counter config image to %s\n", filename.c_str());
+                }
+            }
+
+            if (job.writeCounterDataImage)
+            {
+                const std::string filename = reportDirectoryName + NV_PERF_PATH_SEPARATOR + "CounterDataImage.dat";
+                std::ofstream ofs(filename, std::ios::binary);
+                if (ofs.is_open())
+                {
+                    ofs.write(reinterpret_cast<const char*>(job.counterDataImage.data()), job.counterDataImage.size());
+                    if (!ofs.good())
+                    {
+                        NV_PERF_LOG_ERR(51, "Error occurred while writing counter data image to %s\n", filename.c_str());
+                    }
+                }
+                else
+                {
+                    NV_PERF_LOG_ERR(50, "Failed to write counter data image to %s\n", filename.c_str());
+                }
+            }
+
+            for (const ReportWriterFn& reportWriter : outputOptions.reportWriters)
+            {
+                reportWriter(metricsEvaluator, m_reportLayout, reportData);
+            }
+
+            if (job.openReportDirectory)
+            {
+#if defined(_WIN32)
+                intptr_t shellExecResult = (intptr_t)ShellExecuteA(NULL, "explore", reportDirectoryName.c_str(), NULL, NULL, SW_SHOWNORMAL);
+                if (shellExecResult <= 32)
+                {
+                    NV_PERF_LOG_WRN(50, "Failed to open directory %s, ShellExecute() returned %p\n", reportDirectoryName.c_str(), shellExecResult);
+                }
+#elif defined(__linux__)
+                pid_t pid = fork();
+                if (pid == -1)
+                {
+                    NV_PERF_LOG_WRN(50, "fork() failed, errno = %d \n", errno);
+                }
+                else if (pid == 0)
+                {
+                    // Only child process enter this block
+                    FILE* pStdOut = freopen("/dev/null", "w", stdout);
+                    NV_PERF_UNUSED_VARIABLE(pStdOut);
+                    FILE* pStdErr = freopen("/dev/null", "w", stderr);
+                    NV_PERF_UNUSED_VARIABLE(pStdErr);
+                    if (execlp("xdg-open", "xdg-open", reportDirectoryName.c_str(), nullptr) == -1)
+                    {
+                        NV_PERF_LOG_WRN(50, "execlp() failed, errno = %d \n", errno);
+                        exit(0);
+                    }
+                }
+#endif
+            }
+            return true;
+        }
+
+        void SetLastWrittenReportDirectoryName(const std::string& reportDirectoryName)
+        {
+            std::lock_guard<std::mutex> lock(m_lastWrittenReportDirectoryNameMutex);
+            m_lastWrittenReportDirectoryName = reportDirectoryName;
+        }
+
+        // Hands "job" to the background finalizer, starting it if needed, and waiting while MaxNumQueuedReports jobs are already queued.
+        // Returns false if it could not be started, with "job" left intact.
+        bool EnqueueReportFinalization(FinalizationJob& job)
+        {
+            if (!m_pReportFinalizer)
+            {
+                std::unique_ptr<ReportFinalizer> pReportFinalizer(new ReportFinalizer());
+                std::vector<uint8_t> scratchBuffer;
+                NVPW_MetricsEvaluator* pMetricsEvaluator = m_createMetricsEvaluator ? m_createMetricsEvaluator(scratchBuffer) : nullptr;
+                if (!pMetricsEvaluator)
+                {
+                    NV_PERF_LOG_WRN(50, "Failed to create the metrics evaluator of the background finalizer, finalizing on the calling thread\n");
+                    return false;
+                }
+                pReportFinalizer->metricsEvaluator = MetricsEvaluator(pMetricsEvaluator, std::move(scratchBuffer));
+                pReportFinalizer->thread = std::thread(&ReportGeneratorStateMachine::ReportFinalizerThreadProc, this, pReportFinalizer.get());
+                m_pReportFinalizer = std::move(pReportFinalizer);
+            }
+            {
+                std::unique_lock<std::mutex> lock(m_pReportFinalizer->mutex);
+                m_pReportFinalizer->jobTaken.wait(lock, [&] { return m_pReportFinalizer->jobs.size() < MaxNumQueuedReports; });
+                m_pReportFinalizer->jobs.push_back(std::move(job));
+            }
+            m_pReportFinalizer->jobAvailable.notify_one();
+            return true;
+        }
+
+        void ReportFinalizerThreadProc(ReportFinalizer* pReportFinalizer)
+        {
+            std::unique_lock<std::mutex> lock(pReportFinalizer->mutex);
+            for (;;)
+            {
+                pReportFinalizer->jobAvailable.wait(lock, [&] { return pReportFinalizer->stop || !pReportFinalizer->jobs.empty(); });
+                if (pReportFinalizer->jobs.empty())
+                {
+                    return; // stopped, and drained
+                }
+                const FinalizationJob job = std::move(pReportFinalizer->jobs.front());
+                pReportFinalizer->jobs.pop_front();
+                pReportFinalizer->busy = true;
+                lock.unlock();
+                pReportFinalizer->jobTaken.notify_one();
+
+                if (FinalizeReport(job, pReportFinalizer->metricsEvaluator, pReportFinalizer->workerMetricsEvaluators, pReportFinalizer->threadPool))
+                {
+                    SetLastWrittenReportDirectoryName(job.reportDirectoryName);
+                }
+
+                lock.lock();
+                pReportFinalizer->busy = false;
+                if (pReportFinalizer->jobs.empty())
+                {
+                    pReportFinalizer->jobsDone.notify_all();
+                }
+            }
+        }
+
+        // Finishes all reports queued for the background finalizer, and stops it.
+        void StopReportFinalizer()
+        {
+            if (!m_pReportFinalizer)
+            {
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_pReportFinalizer->mutex);
+                m_pReportFinalizer->stop = true;
+            }
+            m_pReportFinalizer->jobAvailable.notify_one();
+            m_pReportFinalizer->thread.join();
+            m_pReportFinalizer.reset();
+        }
+
+        // Evaluates all continuous collections queued for the background evaluator, and stops it.
+        void StopContinuousEvaluator()
+        {
+            if (!m_pContinuousEvaluator)
+            {
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_pContinuousEvaluator->mutex);
+                m_pContinuousEvaluator->stop = true;
+            }
+            m_pContinuousEvaluator->imageAvailable.notify_one();
+            m_pContinuousEvaluator->thread.join();
+            m_pContinuousEvaluator.reset();
+        }
+
+    public:
+        // Classes overriding AccumulateRangeStatistics() or FinalizeReport() must call Reset() from their own destructor, as they run on
+        // background threads.
+        virtual ~ReportGeneratorStateMachine()
+        {
+            Reset();
+        }
+
+        ReportGeneratorStateMachine(IReportProfiler& reportProfiler)
+            : m_metricsEvaluator()
+            , m_metricNameIndex()
+            , m_createMetricsEvaluator()
+            , m_workerMetricsEvaluators()
+            , m_evaluationThreadPool()
+            , m_configuration()
+            , m_counterConfigurationCache()
+            , m_reportLayout()
+            , m_deviceIndex(size_t(~0))
+            , m_clockStatus(NVPW_DEVICE_CLOCK_STATUS_UNKNOWN)
+            , m_reportProfiler(reportProfiler)
+            , m_frameLevelRangeName()
+            , m_numNestingLevels(1)
+            , m_openReportDirectoryAfterCollection(false)
+            , m_writeCounterConfigImage(false)
+            , m_writeCounterDataImage(false)
+            , m_sharedRangeViewer(false)
+            , m_numEvaluationThreads(1)
+            , m_asyncReportFinalization(false)
+            , m_explicitSession(false)
+            , m_reportDirectoryName()
+            , m_inCollection(false)
+            , m_setConfigDone(false)
+            , m_inContinuousCollection(false)
+            , m_continuousCollectionInterval(1)
+            , m_numFramesSinceContinuousEnqueue(0)
+            , m_numContinuousCollectionsInFlight(0)
+            , m_continuousMetricEvalRequests()
+            , m_continuousMetricValues()
+            , m_continuousDecodeResult()
+            , m_rangeStatistics()
+            , m_pContinuousEvaluator()
+            , m_pReportFinalizer()
+            , m_lastWrittenReportDirectoryNameMutex()
+            , m_lastWrittenReportDirectoryName()
+        {
+            std::string envValue;
+            if (GetEnvVariable("NV_PERF_OPEN_REPORT_DIR_AFTER_COLLECTION", envValue))
+            {
+                char* pEnd = nullptr;
+                m_openReportDirectoryAfterCollection = !!strtol(envValue.c_str(), &pEnd, 0);
+            }
+            if (GetEnvVariable("NV_PERF_WRITE_COUNTER_CONFIG_IMAGE", envValue))
+            {
+                char* pEnd = nullptr;
+                m_writeCounterConfigImage = !!strtol(envValue.c_str(), &pEnd, 0);
+            }
+            if (GetEnvVariable("NV_PERF_WRITE_COUNTER_DATA_IMAGE", envValue))
+            {
+                char* pEnd = nullptr;
                 m_writeCounterDataImage = !!strtol(envValue.c_str(), &pEnd, 0);
             }
+            if (GetEnvVariable("NV_PERF_SHARED_RANGE_VIEWER", envValue))
+            {
+                char* pEnd = nullptr;
+                m_sharedRangeViewer = !!strtol(envValue.c_str(), &pEnd, 0);
+            }
+            if (GetEnvVariable("NV_PERF_REPORT_EVALUATION_THREADS", envValue))
+            {
+                char* pEnd = nullptr;
+                m_numEvaluationThreads = (size_t)strtoul(envValue.c_str(), &pEnd, 0);
+            }
+            if (GetEnvVariable("NV_PERF_ASYNC_REPORT_FINALIZATION", envValue))
+            {
+                char* pEnd = nullptr;
+                m_asyncReportFinalization = !!strtol(envValue.c_str(), &pEnd, 0);
+            }
+            if (GetEnvVariable("NV_PERF_COUNTER_CONFIGURATION_CACHE_DIR", envValue))
+            {
+                m_counterConfigurationCache.SetDirectory(envValue);
+            }
         }
 
+        // Also discards the RangeStatistics, so it must not be called while other threads read them. Waits for the reports that are being
+        // finalized in the background.
         void Reset()
         {
+            StopReportFinalizer();
+            StopContinuousEvaluator();
+            SetLastWrittenReportDirectoryName(std::string());
+
+            m_inContinuousCollection = false;
+            m_numContinuousCollectionsInFlight = 0;
+            m_continuousMetricEvalRequests.clear();
+            m_continuousDecodeResult = {};
+            m_rangeStatistics.Reset();
+
             m_setConfigDone = false;
             m_reportDirectoryName.clear();
             m_inCollection = false;
@@ -1006,6 +2010,10 @@ namespace nv { namespace perf { namespace profiler {
             m_clockStatus = NVPW_DEVICE_CLOCK_STATUS_UNKNOWN;
 
             m_configuration = {};
+            m_evaluationThreadPool.Reset();
+            m_workerMetricsEvaluators.clear();
+            m_createMetricsEvaluator = nullptr;
+            m_metricNameIndex.Reset();
             m_metricsEvaluator = {};
         }
 
@@ -1015,8 +2023,11 @@ namespace nv { namespace perf { namespace profiler {
             const DeviceIdentifiers& deviceIdentifiers,
             TCreateMetricsEvaluator&& createMetricsEvaluator,
             TCreateRawMetricsConfig&& createRawMetricsConfig,
+            const char* pConfigurationKind, // the CounterConfigurationCache key of configurations from "createRawMetricsConfig"
             const std::vector<std::string>& additionalMetrics)
         {
+            StopReportFinalizer(); // it reads the report layout, and evaluates with evaluators from the previous "createMetricsEvaluator"
+            StopContinuousEvaluator();
             m_deviceIndex = deviceIndex;
 
             // initialize metrics evaluator
@@ -1027,61 +2038,46 @@ namespace nv { namespace perf { namespace profiler {
                 return false;
             }
             m_metricsEvaluator = MetricsEvaluator(pMetricsEvaluator, std::move(metricsEvaluatorScratchBuffer)); // transfer ownership to m_metricsEvaluator
-
-            // initialize report definition and report data - per-range report
-            m_reportLayout.perRange.definition = nv::perf::PerRangeReport::GetReportDefinition(deviceIdentifiers.pChipName);
-            if (!m_reportLayout.perRange.definition.pReportHtml)
+            m_createMetricsEvaluator = createMetricsEvaluator; // kept to create the evaluators of additional evaluation threads
+            const bool cacheProperties = false; // only names are resolved here
+            if (!m_metricNameIndex.Build(m_metricsEvaluator, cacheProperties))
             {
-                NV_PERF_LOG_ERR(10, "HTML Reports not supported for chip=%s, Device=%s\n", deviceIdentifiers.pChipName, deviceIdentifiers.pDeviceName);
                 return false;
             }
-            nv::perf::PerRangeReport::InitReportDataMetrics(m_metricsEvaluator, additionalMetrics, m_reportLayout);
 
-            // initialize report definition and report data - ranges summary report
-            m_reportLayout.summary.definition = nv::perf::SummaryReport::GetReportDefinition(deviceIdentifiers.pChipName);
-            if (!m_reportLayout.summary.definition.pReportHtml)
+            // initialize report definitions and report data, and add metrics
+            std::vector<NVPW_MetricEvalRequest> metricEvalRequests;
+            if (!nv::perf::InitReportLayout(m_metricNameIndex, m_metricsEvaluator, deviceIdentifiers.pChipName, additionalMetrics, m_reportLayout, metricEvalRequests))
             {
-                NV_PERF_LOG_ERR(10, "HTML Reports not supported for chip=%s, Device=%s\n", deviceIdentifiers.pChipName, deviceIdentifiers.pDeviceName);
+                NV_PERF_LOG_ERR(10, "InitReportLayout failed for Device=%s\n", deviceIdentifiers.pDeviceName);
                 return false;
             }
-            nv::perf::SummaryReport::InitReportDataMetrics(m_metricsEvaluator, m_reportLayout);
-
             m_reportLayout.gpuName = deviceIdentifiers.pDeviceName;
             m_reportLayout.chipName = deviceIdentifiers.pChipName;
 
-            // initialize raw metric config
-            NVPA_RawMetricsConfig* pRawMetricsConfig = createRawMetricsConfig();
-            if (!pRawMetricsConfig)
-            {
-                NV_PERF_LOG_ERR(10, "RawMetricsConfig creation failed\n");
-                return false;
-            }
-
-            // add metrics and create configuration
-            nv::perf::MetricsConfigBuilder configBuilder;
-            if (!configBuilder.Initialize(m_metricsEvaluator, pRawMetricsConfig, deviceIdentifiers.pChipName))
-            {
-                NV_PERF_LOG_ERR(10, "configBuilder.Initialize() failed\n");
-                return false;
-            }
-            auto addMetrics = [&](const NVPW_MetricEvalRequest* pMetricEvalRequests, size_t numMetricEvalRequests) {
-                if (!configBuilder.AddMetrics(pMetricEvalRequests, numMetricEvalRequests))
+            // create configuration, or take it from the cache
+            auto initializeConfigBuilder = [&](nv::perf::MetricsConfigBuilder& configBuilder) {
+                NVPA_RawMetricsConfig* pRawMetricsConfig = createRawMetricsConfig();
+                if (!pRawMetricsConfig)
+                {
+                    NV_PERF_LOG_ERR(10, "RawMetricsConfig creation failed\n");
+                    return false;
+                }
+                if (!configBuilder.Initialize(m_metricsEvaluator, pRawMetricsConfig, deviceIdentifiers.pChipName))
                 {
+                    NV_PERF_LOG_ERR(10, "configBuilder.Initialize() failed\n");
                     return false;
                 }
                 return true;
             };
-            if (!ForEachBaseMetric(m_reportLayout.perRange.baseMetricRequests, m_reportLayout.perRange.submetricRequests, addMetrics))
-            {
-                NV_PERF_LOG_ERR(10, "AddMetrics failed for per-range report\n");
-                return false;
-            }
-            if (!ForEachBaseMetric(m_reportLayout.summary.baseMetricRequests, m_reportLayout.summary.submetricRequests, addMetrics))
-            {
-                NV_PERF_LOG_ERR(10, "AddMetrics failed for summary report\n");
-                return false;
-            }
-            if (!nv::perf::CreateConfiguration(configBuilder, m_configuration))
+            if (!nv::perf::CreateConfiguration(
+                    m_counterConfigurationCache,
+                    deviceIdentifiers.pChipName,
+                    pConfigurationKind,
+                    metricEvalRequests.data(),
+                    metricEvalRequests.size(),
+                    initializeConfigBuilder,
+                    m_configuration))
             {
                 NV_PERF_LOG_ERR(10, "CreateConfiguration failed\n");
                 return false;
@@ -1116,6 +2112,11 @@ namespace nv { namespace perf { namespace profiler {
         template <class TBeginSession>
         bool OnFrameStart(TBeginSession&& beginSessionFn)
         {
+            if (m_inContinuousCollection)
+            {
+                return OnContinuousFrameStart(beginSessionFn);
+            }
+
             if (IsCollectingReport())
             {
                 if (!m_reportProfiler.IsInSession())
@@ -1155,6 +2156,11 @@ namespace nv { namespace perf { namespace profiler {
 
         bool OnFrameEnd(const ReportOutputOptions& outputOptions)
         {
+            if (m_inContinuousCollection)
+            {
+                return OnContinuousFrameEnd();
+            }
+
             if (IsCollectingReport())
             {
                 if (!m_reportProfiler.AllPassesSubmitted() && m_reportProfiler.IsInPass())
@@ -1187,185 +2193,61 @@ namespace nv { namespace perf { namespace profiler {
 
                 if (decodeResult.allStatisticalSamplesCollected)
                 {
-                    [&]() {
-                        bool setDeviceSuccess = MetricsEvaluatorSetDeviceAttributes(m_metricsEvaluator, decodeResult.counterDataImage.data(), decodeResult.counterDataImage.size());
-                        if (!setDeviceSuccess)
-                        {
-                            NV_PERF_LOG_ERR(50, "MetricsEvaluatorSetDeviceAttributes failed, skipping writing report files\n");
-                            return;
-                        }
-
-                        auto now = std::chrono::system_clock::now();
-                        const uint64_t secondsSinceEpoch = static_cast<uint64_t>(std::chrono::system_clock::to_time_t(now));
-
-                        m_reportDirectoryName = outputOptions.directoryName;
-                        const bool createDir =    outputOptions.enableHtmlReport
-                                               || outputOptions.enableCsvReport
-                                               || !m_reportDirectoryName.empty()
-                                               || outputOptions.writeCounterConfigImage
-                                               || outputOptions.writeCounterDataImage;
-                        if (createDir)
-                        {
-                            if (m_reportDirectoryName.empty())
-                            {
-                                m_reportDirectoryName = "NvPerfReports";
-                            }
-                            if (outputOptions.appendDateTimeToDirName == AppendDateTime::yes)
-                            {
-                                const std::string formattedTime = FormatTime(secondsSinceEpoch);
-                                if (!formattedTime.empty())
-                                {
-                                    m_reportDirectoryName += std::string(1, NV_PERF_PATH_SEPARATOR) + formattedTime;
-                                }
-                            }
-                            auto isPathSeparator = [](char c) {
-                                return (c == NV_PERF_PATH_SEPARATOR);
-                            };
-                            if (!isPathSeparator(m_reportDirectoryName.back()))
-                            {
-                                m_reportDirectoryName += NV_PERF_PATH_SEPARATOR;
-                            }
-
-                            // try to recursively create the directory
-                            for (size_t di = 0; di < m_reportDirectoryName.length(); ++di)
-                            {
-                                if (isPathSeparator(m_reportDirectoryName[di]))
-                                {
-                                    std::string parentDir(m_reportDirectoryName, 0, di);
-#ifdef WIN32
-                                    BOOL dirCreated = CreateDirectoryA(parentDir.c_str(), NULL);
-#else
-                                    bool dirCreated = !mkdir(parentDir.c_str(), 0777);
-#endif
-                                    if (!dirCreated) { /* it probably already exists */ }
-                                }
-                            }
-                        }
-
-                        ReportData reportData = {};
-                        reportData.secondsSinceEpoch = secondsSinceEpoch;
-                        reportData.clockStatus = m_clockStatus;
-                        reportData.pCounterDataImage = decodeResult.counterDataImage.data();
-                        reportData.counterDataImageSize = decodeResult.counterDataImage.size();
-                        reportData.reportDirectoryName = m_reportDirectoryName;
-
-                        const size_t numRanges = nv::perf::CounterDataGetNumRanges(reportData.pCounterDataImage);
-                        reportData.ranges.resize(numRanges);
-                        for (size_t rangeIndex = 0; rangeIndex < numRanges; rangeIndex++)
-                        {
-                            const char* pLeafName = nullptr;
-                            reportData.ranges[rangeIndex].fullName = CounterDataGetRangeName(reportData.pCounterDataImage, rangeIndex, '/', &pLeafName);
-                            reportData.ranges[rangeIndex].leafName = pLeafName;
-
-                            EvalRangeMetricValues(
-                                reportData,
-                                m_reportLayout.summary.baseMetricRequests,
-                                m_reportLayout.summary.submetricRequests,
-                                rangeIndex,
-                                reportData.ranges[rangeIndex].summaryReportValues);
-                            EvalRangeMetricValues(
-                                reportData,
-                                m_reportLayout.perRange.baseMetricRequests,
-                                m_reportLayout.perRange.submetricRequests,
-                                rangeIndex,
-                                reportData.ranges[rangeIndex].perRangeReportValues);
-                        }
-
-                        if (outputOptions.enableHtmlReport)
-                        {
-                            [&]() {
-                                const std::string filename = m_reportDirectoryName + NV_PERF_PATH_SEPARATOR + "readme.html";
-                                FILE* fp = OpenFile(filename.c_str(), "wt");
-                                if (!fp)
-                                {
-                                    NV_PERF_LOG_ERR(50, "Failed to create files in directory %s, skipping writing HTML files\n", m_reportDirectoryName.c_str());
-                                    return;
-                                }
-                                fprintf(fp, "%s", GetReadMeHtml().c_str());
-                                fclose(fp);
-
-                                SummaryReport::WriteHtmlReportFile(m_metricsEvaluator, m_reportLayout, reportData);
-                                PerRangeReport::WriteHtmlReportFiles(m_metricsEvaluator, m_reportLayout, reportData);
-                            }();
-                        }
-
-                        if (outputOptions.enableCsvReport)
-                        {
-                            SummaryReport::WriteCsvReportFile(m_metricsEvaluator, m_reportLayout, reportData);
-                            PerRangeReport::WriteCsvReportFile(m_metricsEvaluator, m_reportLayout, reportData);
-                        }
-
-                        if (outputOptions.writeCounterConfigImage || m_writeCounterConfigImage)
+                    FinalizationJob job;
+                    const auto now = std::chrono::system_clock::now();
+                    job.secondsSinceEpoch = static_cast<uint64_t>(std::chrono::system_clock::to_time_t(now));
+                    job.clockStatus = m_clockStatus;
+                    job.outputOptions = outputOptions;
+                    if (m_sharedRangeViewer)
+                    {
+                        job.outputOptions.perRangeHtmlReport = PerRangeHtmlReport::sharedViewer;
+                    }
+                    job.numEvaluationThreads = m_numEvaluationThreads;
+
+                    std::string& reportDirectoryName = job.reportDirectoryName;
+                    reportDirectoryName = outputOptions.directoryName;
+                    job.createDirectory =    outputOptions.enableHtmlReport
+                                          || outputOptions.enableCsvReport
+                                          || !reportDirectoryName.empty()
+                                          || outputOptions.writeCounterConfigImage
+                                          || outputOptions.writeCounterDataImage;
+                    if (job.createDirectory)
+                    {
+                        if (reportDirectoryName.empty())
                         {
-                            const std::string filename = m_reportDirectoryName + NV_PERF_PATH_SEPARATOR + "CounterConfigImage.dat";
-                            std::ofstream ofs(filename, std::ios::binary);
-                            if (ofs.is_open())
-                            {
-                                ofs.write(reinterpret_cast<const char*>(m_configuration.configImage.data()), m_configuration.configImage.size());
-                                if (!ofs.good())
-                                {
-                                    NV_PERF_LOG_ERR(51, "Error occurred while writing counter config image to %s\n", filename.c_str());
-                                }
-                            }
-                            else
-                            {
-                                NV_PERF_LOG_ERR(50, "Failed to write counter config image to %s\n", filename.c_str());
-                            }
+                            reportDirectoryName = "NvPerfReports";
                         }
-
-                        if (outputOptions.writeCounterDataImage || m_writeCounterDataImage)
+                        if (outputOptions.appendDateTimeToDirName == AppendDateTime::yes)
                         {
-                            const std::string filename = m_reportDirectoryName + NV_PERF_PATH_SEPARATOR + "CounterDataImage.dat";
-                            std::ofstream ofs(filename, std::ios::binary);
-                            if (ofs.is_open())
+                            const std::string formattedTime = FormatTime(job.secondsSinceEpoch);
+                            if (!formattedTime.empty())
                             {
-                                ofs.write(reinterpret_cast<const char*>(decodeResult.counterDataImage.data()), decodeResult.counterDataImage.size());
-                                if (!ofs.good())
-                                {
-                                    NV_PERF_LOG_ERR(51, "Error occurred while writing counter data image to %s\n", filename.c_str());
-                                }
-                            }
-                            else
-                            {
-                                NV_PERF_LOG_ERR(50, "Failed to write counter data image to %s\n", filename.c_str());
+                                reportDirectoryName += std::string(1, NV_PERF_PATH_SEPARATOR) + formattedTime;
                             }
                         }
-
-                        for (const ReportWriterFn& reportWriter : outputOptions.reportWriters)
+                        if (reportDirectoryName.back() != NV_PERF_PATH_SEPARATOR)
                         {
-                            reportWriter(m_metricsEvaluator, m_reportLayout, reportData);
+                            reportDirectoryName += NV_PERF_PATH_SEPARATOR;
                         }
+                    }
+                    job.openReportDirectory = job.createDirectory && m_openReportDirectoryAfterCollection;
+                    if (outputOptions.writeCounterConfigImage || m_writeCounterConfigImage)
+                    {
+                        job.counterConfigImage = m_configuration.configImage;
+                    }
+                    job.writeCounterDataImage = outputOptions.writeCounterDataImage || m_writeCounterDataImage;
+                    job.counterDataImage = std::move(decodeResult.counterDataImage);
 
-                        if (createDir && m_openReportDirectoryAfterCollection)
-                        {
-#if defined(_WIN32)
-                            intptr_t shellExecResult = (intptr_t)ShellExecuteA(NULL, "explore", m_reportDirectoryName.c_str(), NULL, NULL, SW_SHOWNORMAL);
-                            if (shellExecResult <= 32)
-                            {
-                                NV_PERF_LOG_WRN(50, "Failed to open directory %s, ShellExecute() returned %p\n", m_reportDirectoryName.c_str(), shellExecResult);
-                            }
-#elif defined(__linux__)
-                            pid_t pid = fork();
-                            if (pid == -1)
-                            {
-                                NV_PERF_LOG_WRN(50, "fork() failed, errno = %d \n", errno);
-                            }
-                            else if (pid == 0)
-                            {
-                                // Only child process enter this block
-                                FILE* pStdOut = freopen("/dev/null", "w", stdout);
-                                NV_PERF_UNUSED_VARIABLE(pStdOut);
-                                FILE* pStdErr = freopen("/dev/null", "w", stderr);
-                                NV_PERF_UNUSED_VARIABLE(pStdErr);
-                                if (execlp("xdg-open", "xdg-open", m_reportDirectoryName.c_str(), nullptr) == -1)
-                                {
-                                    NV_PERF_LOG_WRN(50, "execlp() failed, errno = %d \n", errno);
-                                    exit(0);
-                                }
-                            }
-#endif
-                        }
-                    }();
+                    const std::string collectedReportDirectoryName = job.reportDirectoryName; // "job" is moved from once enqueued
+                    if (m_asyncReportFinalization && EnqueueReportFinalization(job))
+                    {
+                        m_reportDirectoryName = collectedReportDirectoryName;
+                    }
+                    else if (FinalizeReport(job, m_metricsEvaluator, m_workerMetricsEvaluators, m_evaluationThreadPool))
+                    {
+                        m_reportDirectoryName = collectedReportDirectoryName;
+                        SetLastWrittenReportDirectoryName(collectedReportDirectoryName);
+                    }
 
                     m_inCollection = false;
                     if (!m_explicitSession)
@@ -1390,6 +2272,11 @@ namespace nv { namespace perf { namespace profiler {
             {
                 return true;
             }
+            if (m_inContinuousCollection)
+            {
+                NV_PERF_LOG_ERR(10, "A continuous collection is in progress, call StopContinuousCollection() first\n");
+                return false;
+            }
 
             m_clockStatus = GetDeviceClockState(m_deviceIndex);
             m_inCollection = true;
@@ -1409,17 +2296,141 @@ namespace nv { namespace perf { namespace profiler {
             m_explicitSession = false;
         }
 
+        // Starting on the next FrameStart, repeatedly collects the same counter configuration, and folds the metrics of every range into
+        // GetRangeStatistics(), instead of writing reports. Restarting discards the previous statistics, so it must not be called while
+        // other threads read them.
+        bool StartContinuousCollection(const ContinuousCollectionOptions& options)
+        {
+            if (m_inCollection || m_inContinuousCollection)
+            {
+                NV_PERF_LOG_ERR(10, "A collection is already in progress\n");
+                return false;
+            }
+            if (!(NVPW_MetricsEvaluator*)m_metricsEvaluator)
+            {
+                NV_PERF_LOG_ERR(10, "InitializeReportMetrics() must succeed first\n");
+                return false;
+            }
+
+            WaitForRangeStatistics(); // the evaluator reads the metric eval requests, and writes the statistics
+            m_continuousMetricEvalRequests.clear();
+            for (const std::string& metric : options.metrics)
+            {
+                NVPW_MetricEvalRequest metricEvalRequest = {};
+                if (!m_metricNameIndex.ToMetricEvalRequest(metric.c_str(), metricEvalRequest) && !ToMetricEvalRequest(m_metricsEvaluator, metric.c_str(), metricEvalRequest))
+                {
+                    NV_PERF_LOG_ERR(10, "Unknown metric: %s\n", metric.c_str());
+                    return false;
+                }
+                m_continuousMetricEvalRequests.push_back(metricEvalRequest);
+            }
+            m_continuousMetricValues.resize(m_continuousMetricEvalRequests.size());
+            if (!m_rangeStatistics.Initialize(options.maxNumRanges, m_continuousMetricEvalRequests.size(), options.relativeAccuracy))
+            {
+                return false;
+            }
+            if (!m_pContinuousEvaluator)
+            {
+                std::vector<uint8_t> scratchBuffer;
+                NVPW_MetricsEvaluator* pMetricsEvaluator = m_createMetricsEvaluator ? m_createMetricsEvaluator(scratchBuffer) : nullptr;
+                if (pMetricsEvaluator)
+                {
+                    std::unique_ptr<ContinuousEvaluator> pContinuousEvaluator(new ContinuousEvaluator());
+                    pContinuousEvaluator->metricsEvaluator = MetricsEvaluator(pMetricsEvaluator, std::move(scratchBuffer));
+                    pContinuousEvaluator->thread = std::thread(&ReportGeneratorStateMachine::ContinuousEvaluatorThreadProc, this, pContinuousEvaluator.get());
+                    m_pContinuousEvaluator = std::move(pContinuousEvaluator);
+                }
+                else
+                {
+                    NV_PERF_LOG_WRN(50, "Failed to create the metrics evaluator of the continuous evaluator, evaluating in OnFrameEnd()\n");
+                }
+            }
+
+            m_clockStatus = GetDeviceClockState(m_deviceIndex);
+            m_continuousCollectionInterval = (std::max)(options.collectionIntervalInFrames, size_t(1));
+            m_numFramesSinceContinuousEnqueue = m_continuousCollectionInterval; // start on the next frame
+            m_numContinuousCollectionsInFlight = 0;
+            m_inContinuousCollection = true;
+            return true;
+        }
+
+        // Drops the collections in flight on the GPU by ending the session. Decoded collections are still folded into the statistics, which
+        // remain readable.
+        void StopContinuousCollection()
+        {
+            if (!m_inContinuousCollection)
+            {
+                return;
+            }
+            m_inContinuousCollection = false;
+            m_numContinuousCollectionsInFlight = 0;
+            ResetCollection();
+        }
+
+        bool IsInContinuousCollection() const
+        {
+            return m_inContinuousCollection;
+        }
+
+        // The statistics of the current or last continuous collection. Its const methods, except GetSketch(), may be called from any thread;
+        // GetSketch() only after WaitForRangeStatistics() with no continuous collection in progress.
+        const RangeStatistics& GetRangeStatistics() const
+        {
+            return m_rangeStatistics;
+        }
+
+        // Blocks until every decoded continuous collection has been folded into GetRangeStatistics().
+        void WaitForRangeStatistics()
+        {
+            if (!m_pContinuousEvaluator)
+            {
+                return;
+            }
+            std::unique_lock<std::mutex> lock(m_pContinuousEvaluator->mutex);
+            m_pContinuousEvaluator->imagesDone.wait(lock, [&] { return !m_pContinuousEvaluator->numPending; });
+        }
+
         // Returns true if a report is still queued for collection.
         bool IsCollectingReport() const
         {
             return m_inCollection;
         }
 
+        // The directory of the last collected report. With async report finalization, it may still be being written, see IsReportReady().
         const std::string& GetLastReportDirectoryName() const
         {
             return m_reportDirectoryName;
         }
 
+        // Returns false while reports collected so far are still being evaluated or written in the background.
+        bool IsReportReady() const
+        {
+            if (!m_pReportFinalizer)
+            {
+                return true;
+            }
+            std::lock_guard<std::mutex> lock(m_pReportFinalizer->mutex);
+            return m_pReportFinalizer->jobs.empty() && !m_pReportFinalizer->busy;
+        }
+
+        // The directory of the last report that has been completely written, by either mode of finalization.
+        std::string GetLastWrittenReportDirectoryName() const
+        {
+            std::lock_guard<std::mutex> lock(m_lastWrittenReportDirectoryNameMutex);
+            return m_lastWrittenReportDirectoryName;
+        }
+
+        // Blocks until IsReportReady().
+        void WaitForReports()
+        {
+            if (!m_pReportFinalizer)
+            {
+                return;
+            }
+            std::unique_lock<std::mutex> lock(m_pReportFinalizer->mutex);
+            m_pReportFinalizer->jobsDone.wait(lock, [&] { return m_pReportFinalizer->jobs.empty() && !m_pReportFinalizer->busy; });
+        }
+
         /// Enables a frame-level parent range.
         /// When enabled (non-NULL, non-empty pRangeName), every frame will have a parent range.
         /// This is also convenient for programs that have no CommandList-level ranges.
@@ -1459,6 +2470,35 @@ namespace nv { namespace perf { namespace profiler {
         {
             m_openReportDirectoryAfterCollection = openReportDirectoryAfterCollection;
         }
+
+        void SetNumEvaluationThreads(size_t numEvaluationThreads)
+        {
+            m_numEvaluationThreads = numEvaluationThreads;
+        }
+
+        void SetCounterConfigurationCacheDirectory(const std::string& directory)
+        {
+            m_counterConfigurationCache.SetDirectory(directory);
+        }
+
+        // Moves the evaluation and writing of collected reports from OnFrameEnd() to a background thread with its own metrics evaluators, so
+        // that the frame completing a collection doesn't stall on it. The next collection may start while previous reports are still being
+        // written; their counter data is queued until then, and once MaxNumQueuedReports reports are queued, OnFrameEnd() waits for the oldest
+        // one to be taken. ReportOutputOptions::reportWriters are called from the background thread.
+        void SetAsyncReportFinalization(bool asyncReportFinalization)
+        {
+            m_asyncReportFinalization = asyncReportFinalization;
+        }
+
+        bool GetAsyncReportFinalization() const
+        {
+            return m_asyncReportFinalization;
+        }
+
+        size_t GetNumEvaluationThreads() const
+        {
+            return m_numEvaluationThreads;
+        }
     };
 
 } } }
@@ -234,21 +234,22 @@ namespace nv { namespace perf { namespace profiler {
                 return false;
             }
 
-            auto createMetricsEvaluator = [&](std::vector<uint8_t>& scratchBuffer) {
-                const size_t scratchBufferSize = nv::perf::D3D12CalculateMetricsEvaluatorScratchBufferSize(deviceIdentifiers.pChipName);
+            const char* pChipName = deviceIdentifiers.pChipName; // owned by NVPW; captured by value because the state machine keeps createMetricsEvaluator
+            auto createMetricsEvaluator = [pChipName](std::vector<uint8_t>& scratchBuffer) {
+                const size_t scratchBufferSize = nv::perf::D3D12CalculateMetricsEvaluatorScratchBufferSize(pChipName);
                 if (!scratchBufferSize)
                 {
                     return (NVPW_MetricsEvaluator*)nullptr;
                 }
                 scratchBuffer.resize(scratchBufferSize);
-                NVPW_MetricsEvaluator* pMetricsEvaluator = nv::perf::D3D12CreateMetricsEvaluator(scratchBuffer.data(), scratchBuffer.size(), deviceIdentifiers.pChipName);
+                NVPW_MetricsEvaluator* pMetricsEvaluator = nv::perf::D3D12CreateMetricsEvaluator(scratchBuffer.data(), scratchBuffer.size(), pChipName);
                 return pMetricsEvaluator;
             };
             auto createRawMetricsConfig = [&]() {
                 NVPA_RawMetricsConfig* pRawMetricsConfig = nv::perf::profiler::D3D12CreateRawMetricsConfig(deviceIdentifiers.pChipName);
                 return pRawMetricsConfig;
             };
-            if (!m_stateMachine.InitializeReportMetrics(deviceIndex, deviceIdentifiers, createMetricsEvaluator, createRawMetricsConfig, additionalMetrics))
+            if (!m_stateMachine.InitializeReportMetrics(deviceIndex, deviceIdentifiers, createMetricsEvaluator, createRawMetricsConfig, GetCounterConfigurationKind(), additionalMetrics))
             {
                 NV_PERF_LOG_ERR(100, "m_stateMachine.InitializeReportMetrics failed\n");
                 return false;
@@ -340,11 +341,30 @@ namespace nv { namespace perf { namespace profiler {
             return m_stateMachine.IsCollectingReport();
         }
 
+        /// The directory of the last collected report. With async report finalization, it may still be being written, see IsReportReady().
         const std::string& GetLastReportDirectoryName() const
         {
             return m_stateMachine.GetLastReportDirectoryName();
         }
 
+        /// Reports false while collected reports are still being evaluated or written in the background, see SetAsyncReportFinalization().
+        bool IsReportReady() const
+        {
+            return m_stateMachine.IsReportReady();
+        }
+
+        /// The directory of the last report that has been completely written.
+        std::string GetLastWrittenReportDirectoryName() const
+        {
+            return m_stateMachine.GetLastWrittenReportDirectoryName();
+        }
+
+        /// Blocks until IsReportReady().
+        void WaitForReports()
+        {
+            m_stateMachine.WaitForReports();
+        }
+
         /// Enqueues report collection, starting on the next frame.
         bool StartCollectionOnNextFrame()
         {
@@ -356,6 +376,39 @@ namespace nv { namespace perf { namespace profiler {
             return m_stateMachine.StartCollectionOnNextFrame();
         }
 
+        /// Instead of reports, repeatedly collects per-range statistics of options.metrics, starting on the next frame.
+        bool StartContinuousCollection(const ContinuousCollectionOptions& options = ContinuousCollectionOptions())
+        {
+            if (m_initStatus != ReportGeneratorInitStatus::Succeeded)
+            {
+                NV_PERF_LOG_WRN(100, "skipping; the state of InitializeReportGenerator() is %s.\n", ToCString(m_initStatus));
+                return false;
+            }
+            return m_stateMachine.StartContinuousCollection(options);
+        }
+
+        void StopContinuousCollection()
+        {
+            m_stateMachine.StopContinuousCollection();
+        }
+
+        bool IsInContinuousCollection() const
+        {
+            return m_stateMachine.IsInContinuousCollection();
+        }
+
+        /// Updated by a background thread with the collections decoded in OnFrameEnd(), and readable from any thread at any time.
+        const RangeStatistics& GetRangeStatistics() const
+        {
+            return m_stateMachine.GetRangeStatistics();
+        }
+
+        /// Blocks until every collection decoded so far is reflected in GetRangeStatistics().
+        void WaitForRangeStatistics()
+        {
+            m_stateMachine.WaitForRangeStatistics();
+        }
+
         /// Enables a frame-level parent range.
         /// When enabled (non-NULL, non-empty pRangeName), every frame will have a parent range.
         /// This is also convenient for programs that have no CommandList-level ranges.
@@ -403,6 +456,35 @@ namespace nv { namespace perf { namespace profiler {
             m_stateMachine.SetOpenReportDirectoryAfterCollection(openReportDirectoryAfterCollection);
         }
 
+        /// Sets the number of threads evaluating the metrics of collected ranges, 0 picks one per hardware thread, 1 evaluates on the calling thread.
+        /// The default is 1, and can be changed by environment variable NV_PERF_REPORT_EVALUATION_THREADS.
+        void SetNumEvaluationThreads(size_t numEvaluationThreads)
+        {
+            m_stateMachine.SetNumEvaluationThreads(numEvaluationThreads);
+        }
+
+        /// Evaluates and writes collected reports on a background thread instead of in OnFrameEnd(), so that the frame completing a collection
+        /// doesn't stall. The next collection may start while previous reports are still being written, but with
+        /// ReportGeneratorStateMachine::MaxNumQueuedReports reports queued, OnFrameEnd() waits for the oldest one to be taken.
+        /// The default is false, and can be changed by environment variable NV_PERF_ASYNC_REPORT_FINALIZATION.
+        void SetAsyncReportFinalization(bool asyncReportFinalization)
+        {
+            m_stateMachine.SetAsyncReportFinalization(asyncReportFinalization);
+        }
+
+        /// Sets the directory of the CounterConfigurationCache, an empty string disables it. Takes effect at the next InitializeReportGenerator().
+        /// The default is disabled, and can be changed by environment variable NV_PERF_COUNTER_CONFIGURATION_CACHE_DIR.
+        void SetCounterConfigurationCacheDirectory(const std::string& directory)
+        {
+            m_stateMachine.SetCounterConfigurationCacheDirectory(directory);
+        }
+
+        /// The kind of configurations this report generator stores in the CounterConfigurationCache.
+        static const char* GetCounterConfigurationKind()
+        {
+            return "D3D12RangeProfiler";
+        }
+
         /// When enabled, OnFrameStart() will check whether its argument's ID3D12Device
         /// corresponds to the device passed into InitializeReportGenerator().
         void EnableCommandQueueValidation(bool enable = true)
@@ -0,0 +1,159 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace nv { namespace perf {
+
+    // A bounded, lock-free queue for exactly one producer thread and one consumer thread.
+    // All storage is allocated in Initialize(), Push()/Front()/Pop() never allocate.
+    // The capacity is rounded up to a power of 2 so that slot indices can be derived with a mask instead of a modulo.
+    template <class T>
+    class SpscQueue
+    {
+    private:
+        enum { CacheLineSize = 64 };
+
+        std::vector<T> m_slots;
+        size_t m_mask;
+        alignas(CacheLineSize) std::atomic<size_t> m_put; // written by the producer only
+        alignas(CacheLineSize) std::atomic<size_t> m_get; // written by the consumer only
+        alignas(CacheLineSize) size_t m_cachedGet;        // producer-local copy of m_get, refreshed only when the queue appears full
+        alignas(CacheLineSize) size_t m_cachedPut;        // consumer-local copy of m_put, refreshed only when the queue appears empty
+
+    public:
+        SpscQueue()
+            : m_mask()
+            , m_put(0)
+            , m_get(0)
+            , m_cachedGet(0)
+            , m_cachedPut(0)
+        {
+        }
+        SpscQueue(const SpscQueue& queue) = delete;
+        SpscQueue& operator=(const SpscQueue& queue) = delete;
+        ~SpscQueue() = default;
+
+        // Not thread-safe, must not be called while a producer or consumer is active.
+        bool Initialize(size_t minCapacity)
+        {
+            if (!minCapacity)
+            {
+                return false;
+            }
+            size_t capacity = 1;
+            while (capacity < minCapacity)
+            {
+                capacity <<= 1;
+            }
+            m_slots.clear();
+            m_slots.resize(capacity);
+            m_mask = capacity - 1;
+            m_put.store(0, std::memory_order_relaxed);
+            m_get.store(0, std::memory_order_relaxed);
+            m_cachedGet = 0;
+            m_cachedPut = 0;
+            return true;
+        }
+
+        // Not thread-safe, must not be called while a producer or consumer is active.
+        void Reset()
+        {
+            m_slots.clear();
+            m_mask = 0;
+            m_put.store(0, std::memory_order_relaxed);
+            m_get.store(0, std::memory_order_relaxed);
+            m_cachedGet = 0;
+            m_cachedPut = 0;
+        }
+
+        size_t Capacity() const
+        {
+            return m_slots.size();
+        }
+
+        // Producer only. Returns false if the queue is full.
+        bool Push(const T& value)
+        {
+            const size_t put = m_put.load(std::memory_order_relaxed);
+            if (put - m_cachedGet == m_slots.size())
+            {
+                m_cachedGet = m_get.load(std::memory_order_acquire);
+                if (put - m_cachedGet == m_slots.size())
+                {
+                    return false;
+                }
+            }
+            m_slots[put & m_mask] = value;
+            m_put.store(put + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer only. Returns nullptr if the queue is empty; the returned element stays valid until Pop().
+        const T* Front()
+        {
+            const size_t get = m_get.load(std::memory_order_relaxed);
+            if (get == m_cachedPut)
+            {
+                m_cachedPut = m_put.load(std::memory_order_acquire);
+                if (get == m_cachedPut)
+                {
+                    return nullptr;
+                }
+            }
+            return &m_slots[get & m_mask];
+        }
+
+        // Consumer only. Must only be called after Front() returned a non-null element.
+        void Pop()
+        {
+            const size_t get = m_get.load(std::memory_order_relaxed);
+            m_get.store(get + 1, std::memory_order_release);
+        }
+
+        // Consumer only. Returns false if the queue is empty.
+        bool Pop(T& value)
+        {
+            const T* pFront = Front();
+            if (!pFront)
+            {
+                return false;
+            }
+            value = *pFront;
+            Pop();
+            return true;
+        }
+
+        // Approximate when called concurrently with Push()/Pop().
+        size_t Size() const
+        {
+            const size_t get = m_get.load(std::memory_order_acquire);
+            const size_t put = m_put.load(std::memory_order_acquire);
+            return put - get;
+        }
+
+        bool Empty() const
+        {
+            return !Size();
+        }
+    };
+
+}}
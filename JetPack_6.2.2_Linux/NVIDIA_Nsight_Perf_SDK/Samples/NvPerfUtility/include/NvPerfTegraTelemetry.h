@@ -0,0 +1,342 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "NvPerfInit.h"
+#include "NvPerfHudDataModel.h"
+
+#if defined(__linux__)
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace nv { namespace perf { namespace hud {
+
+#if defined(__linux__)
+    // An ExternalSignalSource that polls numeric sysfs files, e.g. the clocks, loads, thermal zones and INA3221 power rails of Tegra SoCs.
+    // Every file is opened once when its signal is added, so that a poll is a single pread() per file rather than an open/read/close.
+    //
+    //     hud::SysfsSignalSource telemetry;
+    //     telemetry.AddTegraSignals();
+    //     hud::ExternalSignalSourceOptions options;
+    //     options.pGetTimestamp = &GetCpuMarkerTimestamp;
+    //     uint64_t cpuTimestamp = 0;
+    //     uint64_t gpuTimestamp = 0;
+    //     if (sampler.GetCalibratedTimestamps(cpuTimestamp, gpuTimestamp)) // an initialized sampler::PeriodicSamplerTimeHistoryVulkan
+    //     {
+    //         options.CorrelateClocks(cpuTimestamp, gpuTimestamp);
+    //     }
+    //     telemetry.Initialize(options);
+    //     hudDataModel.AddExternalSignalSource(telemetry);
+    //     ...
+    //     hudDataModel.Initialize(...);
+    //     telemetry.Start();
+    //
+    // after which presets can plot e.g. "tegra.gpu.frequency" or "tegra.power.VDD_GPU_SOC" like any metric.
+    class SysfsSignalSource : public ExternalSignalSource
+    {
+    private:
+        struct SysfsFile
+        {
+            int fd;
+            int factorFd; // -1, or a second file whose value multiplies the first one, e.g. the current of a voltage
+            double scale;
+        };
+
+        std::vector<SysfsFile> m_files; // one per signal
+
+    public:
+        SysfsSignalSource() = default;
+        ~SysfsSignalSource()
+        {
+            Stop();
+            for (const SysfsFile& file : m_files)
+            {
+                close(file.fd);
+                if (file.factorFd != -1)
+                {
+                    close(file.factorFd);
+                }
+            }
+        }
+
+        // Adds a signal with the value of the file at "path" times "scale".
+        bool AddSignal(const ExternalSignalDesc& desc, const std::string& path, double scale = 1.0)
+        {
+            return AddSignal(desc, path, std::string(), scale);
+        }
+
+        // Adds a signal with the value of the file at "path" times the value of the file at "factorPath" times "scale", e.g. a rail's
+        // power from its voltage and current. An empty "factorPath" is ignored.
+        bool AddSignal(const ExternalSignalDesc& desc, const std::string& path, const std::string& factorPath, double scale)
+        {
+            SysfsFile file{ OpenFile(path), -1, scale };
+            if (file.fd == -1)
+            {
+                return false;
+            }
+            if (!factorPath.empty())
+            {
+                file.factorFd = OpenFile(factorPath);
+                if (file.factorFd == -1)
+                {
+                    close(file.fd);
+                    return false;
+                }
+            }
+            if (!AddSignalDesc(desc))
+            {
+                close(file.fd);
+                if (file.factorFd != -1)
+                {
+                    close(file.factorFd);
+                }
+                return false;
+            }
+            m_files.push_back(file);
+            return true;
+        }
+
+        // Adds the signals of a Tegra SoC that are readable under "sysfsRoot", and returns how many were found:
+        //     tegra.gpu.frequency, tegra.gpu.load, tegra.emc.frequency  in MHz and %
+        //     tegra.cpu<N>.frequency                                      in MHz, per online CPU with cpufreq
+        //     tegra.thermal.<zone type>                                   in degrees Celsius, per thermal zone
+        //     tegra.power.<rail label>                                    in W, per INA3221 channel with a label
+        // The EMC frequency is only available through debugfs, i.e. when running as root.
+        size_t AddTegraSignals(const std::string& sysfsRoot = "/sys")
+        {
+            const size_t numSignals = GetSignals().size();
+            const std::string root = sysfsRoot + "/";
+
+            // the GPU's devfreq device is named after its unit address and chip, e.g. "17000000.ga10b" or "17000000.gpu"
+            for (const std::string& device : ListDirectory(root + "class/devfreq"))
+            {
+                if (device.find("gpu") == std::string::npos && device.find("ga10b") == std::string::npos && device.find("gv11b") == std::string::npos && device.find("gp10b") == std::string::npos)
+                {
+                    continue;
+                }
+                const std::string devfreq = root + "class/devfreq/" + device + "/";
+                AddSignalIfReadable(ExternalSignalDesc("tegra.gpu.frequency", "MHz", "GPU clock frequency", ReadValue(devfreq + "max_freq") * 1e-6), devfreq + "cur_freq", 1e-6);
+                AddSignalIfReadable(ExternalSignalDesc("tegra.gpu.load", "%", "GPU load, as reported by the GPU driver", 100.0), devfreq + "device/load", 0.1);
+                break;
+            }
+            if (FindSignal("tegra.gpu.load") == (size_t)~0)
+            {
+                for (const char* pLoadPath : { "devices/platform/gpu.0/load", "devices/gpu.0/load" })
+                {
+                    if (AddSignalIfReadable(ExternalSignalDesc("tegra.gpu.load", "%", "GPU load, as reported by the GPU driver", 100.0), root + pLoadPath, 0.1))
+                    {
+                        break;
+                    }
+                }
+            }
+
+            const std::string emc = root + "kernel/debug/bpmp/debug/clk/emc/";
+            AddSignalIfReadable(ExternalSignalDesc("tegra.emc.frequency", "MHz", "External memory controller clock frequency", ReadValue(emc + "max_rate") * 1e-6), emc + "rate", 1e-6);
+
+            for (const std::string& cpu : ListDirectory(root + "devices/system/cpu"))
+            {
+                if (cpu.size() < 4 || cpu.compare(0, 3, "cpu") || cpu.find_first_not_of("0123456789", 3) != std::string::npos)
+                {
+                    continue;
+                }
+                const std::string cpufreq = root + "devices/system/cpu/" + cpu + "/cpufreq/";
+                AddSignalIfReadable(ExternalSignalDesc("tegra." + cpu + ".frequency", "MHz", "CPU clock frequency", ReadValue(cpufreq + "cpuinfo_max_freq") * 1e-3), cpufreq + "scaling_cur_freq", 1e-3);
+            }
+
+            for (const std::string& zone : ListDirectory(root + "class/thermal"))
+            {
+                if (zone.compare(0, 12, "thermal_zone"))
+                {
+                    continue;
+                }
+                const std::string thermalZone = root + "class/thermal/" + zone + "/";
+                std::string name = "tegra.thermal." + ToSignalName(ReadString(thermalZone + "type"));
+                if (FindSignal(name) != (size_t)~0)
+                {
+                    name += "_" + zone.substr(12);
+                }
+                AddSignalIfReadable(ExternalSignalDesc(name, "C", "Temperature of thermal zone " + zone.substr(12)), thermalZone + "temp", 1e-3);
+            }
+
+            for (const std::string& hwmon : ListDirectory(root + "class/hwmon"))
+            {
+                const std::string hwmonDir = root + "class/hwmon/" + hwmon + "/";
+                if (ReadString(hwmonDir + "name") != "ina3221")
+                {
+                    continue;
+                }
+                for (int channel = 1; channel <= 8; ++channel)
+                {
+                    const std::string channelPrefix = hwmonDir + "in" + std::to_string(channel);
+                    const std::string label = ReadString(channelPrefix + "_label");
+                    if (label.empty())
+                    {
+                        continue;
+                    }
+                    // millivolts times milliamperes
+                    const std::string currentPath = hwmonDir + "curr" + std::to_string(channel) + "_input";
+                    if (access(currentPath.c_str(), R_OK))
+                    {
+                        continue;
+                    }
+                    AddSignal(ExternalSignalDesc("tegra.power." + ToSignalName(label), "W", "Power of rail " + label), channelPrefix + "_input", currentPath, 1e-6);
+                }
+            }
+
+            return GetSignals().size() - numSignals;
+        }
+
+        // Parses the leading number of a sysfs file.
+        static bool ReadValue(int fd, double& value)
+        {
+            char buffer[64];
+            const ssize_t size = pread(fd, buffer, sizeof(buffer) - 1, 0);
+            if (size <= 0)
+            {
+                return false;
+            }
+            buffer[size] = '\0';
+            char* pEnd = nullptr;
+            value = strtod(buffer, &pEnd);
+            return pEnd != buffer;
+        }
+
+    protected:
+        void Poll(double* pValues) override
+        {
+            for (size_t signalIndex = 0; signalIndex < m_files.size(); ++signalIndex)
+            {
+                const SysfsFile& file = m_files[signalIndex];
+                double value = 0.0;
+                double factor = 1.0;
+                if (ReadValue(file.fd, value) && (file.factorFd == -1 || ReadValue(file.factorFd, factor)))
+                {
+                    pValues[signalIndex] = value * factor * file.scale;
+                }
+                else
+                {
+                    pValues[signalIndex] = std::numeric_limits<double>::quiet_NaN();
+                }
+            }
+        }
+
+    private:
+        static int OpenFile(const std::string& path)
+        {
+            const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd == -1)
+            {
+                NV_PERF_LOG_WRN(100, "Cannot open %s\n", path.c_str());
+            }
+            return fd;
+        }
+
+        // only adds files that currently hold a number, e.g. debugfs files are listed but unreadable without root privileges
+        bool AddSignalIfReadable(const ExternalSignalDesc& desc, const std::string& path, double scale)
+        {
+            const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd == -1)
+            {
+                return false;
+            }
+            double value = 0.0;
+            const bool readable = ReadValue(fd, value);
+            close(fd);
+            return readable && AddSignal(desc, path, scale);
+        }
+
+        // NaN if the file does not hold a number
+        static double ReadValue(const std::string& path)
+        {
+            const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            double value = std::numeric_limits<double>::quiet_NaN();
+            if (fd != -1)
+            {
+                if (!ReadValue(fd, value))
+                {
+                    value = std::numeric_limits<double>::quiet_NaN();
+                }
+                close(fd);
+            }
+            return value;
+        }
+
+        // the first line of the file, empty if it cannot be read
+        static std::string ReadString(const std::string& path)
+        {
+            const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd == -1)
+            {
+                return std::string();
+            }
+            char buffer[256];
+            const ssize_t size = pread(fd, buffer, sizeof(buffer), 0);
+            close(fd);
+            if (size <= 0)
+            {
+                return std::string();
+            }
+            const std::string contents(buffer, (size_t)size);
+            return contents.substr(0, contents.find('\n'));
+        }
+
+        // numbered entries sort numerically, e.g. "cpu2" before "cpu10"
+        static std::vector<std::string> ListDirectory(const std::string& path)
+        {
+            std::vector<std::string> entries;
+            DIR* pDir = opendir(path.c_str());
+            if (!pDir)
+            {
+                return entries;
+            }
+            for (const dirent* pEntry = readdir(pDir); pEntry; pEntry = readdir(pDir))
+            {
+                if (pEntry->d_name[0] != '.')
+                {
+                    entries.push_back(pEntry->d_name);
+                }
+            }
+            closedir(pDir);
+            std::sort(entries.begin(), entries.end(), [](const std::string& lhs, const std::string& rhs) {
+                return lhs.size() != rhs.size() ? lhs.size() < rhs.size() : lhs < rhs;
+            });
+            return entries;
+        }
+
+        // replaces the characters a metric name cannot hold, e.g. "cpu-thermal" becomes "cpu_thermal"
+        static std::string ToSignalName(const std::string& text)
+        {
+            std::string name = text;
+            for (char& c : name)
+            {
+                if (!(('A' <= c && c <= 'Z') || ('a' <= c && c <= 'z') || ('0' <= c && c <= '9') || c == '_'))
+                {
+                    c = '_';
+                }
+            }
+            return name.empty() ? std::string("unknown") : name;
+        }
+    };
+#endif
+
+} } } // nv::perf::hud
@@ -0,0 +1,156 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace nv { namespace perf {
+
+    // A fixed set of worker threads for data-parallel loops. The thread calling ParallelFor() participates as worker 0, so a pool initialized
+    // with N workers owns N - 1 threads, and a pool with a single worker runs everything inline.
+    class ThreadPool
+    {
+    private:
+        std::vector<std::thread> m_threads;
+        std::mutex m_mutex;
+        std::condition_variable m_workAvailable;
+        std::condition_variable m_workDone;
+        std::function<void(size_t)> m_job; // the argument is the worker index
+        uint64_t m_generation;             // bumped for every job, so that a worker runs each job once
+        size_t m_numBusyThreads;
+        bool m_stop;
+
+    public:
+        ThreadPool()
+            : m_generation(0)
+            , m_numBusyThreads(0)
+            , m_stop(false)
+        {
+        }
+        ThreadPool(const ThreadPool& pool) = delete;
+        ThreadPool& operator=(const ThreadPool& pool) = delete;
+        ~ThreadPool()
+        {
+            Reset();
+        }
+
+        // 0 picks one worker per hardware thread
+        bool Initialize(size_t numWorkers)
+        {
+            Reset();
+            if (!numWorkers)
+            {
+                numWorkers = (std::max)(1u, std::thread::hardware_concurrency());
+            }
+            m_stop = false;
+            for (size_t workerIndex = 1; workerIndex < numWorkers; ++workerIndex)
+            {
+                m_threads.emplace_back(&ThreadPool::ThreadProc, this, workerIndex, m_generation);
+            }
+            return true;
+        }
+
+        void Reset()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_workAvailable.notify_all();
+            for (std::thread& thread : m_threads)
+            {
+                thread.join();
+            }
+            m_threads.clear();
+            m_job = nullptr;
+        }
+
+        size_t GetNumWorkers() const
+        {
+            return m_threads.size() + 1;
+        }
+
+        // Calls func(workerIndex, itemIndex) for every item in [0, numItems), and returns once all items are done. Items are handed out one at a
+        // time, so uneven per-item costs balance out; "workerIndex" is in [0, GetNumWorkers()) and can index per-worker state.
+        // Must not be called concurrently, or from within "func".
+        template <typename TFunc>
+        void ParallelFor(size_t numItems, TFunc&& func)
+        {
+            if (m_threads.empty() || numItems < 2)
+            {
+                for (size_t itemIndex = 0; itemIndex < numItems; ++itemIndex)
+                {
+                    func(size_t(0), itemIndex);
+                }
+                return;
+            }
+
+            std::atomic<size_t> nextItemIndex(0);
+            auto job = [&](size_t workerIndex) {
+                for (size_t itemIndex = nextItemIndex++; itemIndex < numItems; itemIndex = nextItemIndex++)
+                {
+                    func(workerIndex, itemIndex);
+                }
+            };
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_job = job;
+                m_numBusyThreads = m_threads.size();
+                ++m_generation;
+            }
+            m_workAvailable.notify_all();
+
+            job(0);
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_workDone.wait(lock, [&] { return m_numBusyThreads == 0; });
+            m_job = nullptr;
+        }
+
+    private:
+        void ThreadProc(size_t workerIndex, uint64_t lastGeneration)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            for (;;)
+            {
+                m_workAvailable.wait(lock, [&] { return m_stop || m_generation != lastGeneration; });
+                if (m_stop)
+                {
+                    return;
+                }
+                lastGeneration = m_generation;
+                std::function<void(size_t)> job = m_job;
+                lock.unlock();
+                job(workerIndex);
+                lock.lock();
+                if (--m_numBusyThreads == 0)
+                {
+                    m_workDone.notify_one();
+                }
+            }
+        }
+    };
+
+}}
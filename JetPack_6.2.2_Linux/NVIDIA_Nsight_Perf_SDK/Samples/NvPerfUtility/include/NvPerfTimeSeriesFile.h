@@ -0,0 +1,716 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <stdio.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "NvPerfInit.h"
+#include "NvPerfMappedFile.h"
+#include "NvPerfSpscQueue.h"
+
+namespace nv { namespace perf {
+
+    // On-disk layout of a time series file, all integers little-endian:
+    //   TimeSeriesFileHeader | TimeSeriesColumnHeader + name + unit, per column | padding to 8 bytes | block 0 | block 1 | ...
+    // Every block is a TimeSeriesBlockHeader followed by "numRows" values of each column in turn, each column padded to 8 bytes. Unencoded
+    // columns can therefore be read in place from a mapping of the file. Blocks are self-contained: encoded columns restart at every block.
+    // Column 0 always holds the timestamps.
+    enum class TimeSeriesColumnType : uint8_t
+    {
+        UInt64,
+        Float64,
+        Float32,
+    };
+
+    enum class TimeSeriesEncoding : uint8_t
+    {
+        None,
+        Delta, ///< difference to the previous value, UInt64 columns only
+        Xor,   ///< bitwise XOR with the previous value, keeps slowly changing floats mostly zero bits
+    };
+
+    struct TimeSeriesFileHeader
+    {
+        char magic[8];            // "NVPWTSF"
+        uint32_t version;
+        uint32_t numColumns;
+        uint32_t schemaSize;      // bytes between this header and the first block
+        uint32_t maxRowsPerBlock;
+        uint64_t reserved;
+
+        static const char* Magic()
+        {
+            return "NVPWTSF";
+        }
+        enum { Version = 1 };
+    };
+
+    struct TimeSeriesColumnHeader
+    {
+        TimeSeriesColumnType type;
+        TimeSeriesEncoding encoding;
+        uint16_t reserved0;
+        uint32_t nameLength;      // in bytes, not null-terminated
+        uint32_t unitLength;      // in bytes, not null-terminated
+        uint32_t reserved1;
+    };
+
+    struct TimeSeriesBlockHeader
+    {
+        uint32_t magic;           // BlockMagic
+        uint32_t numRows;
+        uint64_t firstRow;        // rows that were dropped while all blocks were in flight are not counted
+
+        enum : uint32_t { BlockMagic = 0x4b425354 }; // "TSBK"
+    };
+
+    struct TimeSeriesColumnDesc
+    {
+        std::string name;
+        std::string unit;
+        TimeSeriesColumnType type;
+        TimeSeriesEncoding encoding;
+    };
+
+    inline size_t GetTimeSeriesElementSize(TimeSeriesColumnType type)
+    {
+        return (type == TimeSeriesColumnType::Float32) ? 4 : 8;
+    }
+
+    inline size_t AlignTimeSeriesSize(size_t size)
+    {
+        return (size + 7) & ~size_t(7);
+    }
+
+    inline bool IsLittleEndianHost()
+    {
+        const uint16_t value = 1;
+        uint8_t firstByte = 0;
+        memcpy(&firstByte, &value, 1);
+        return firstByte == 1;
+    }
+
+    // Appends rows of a timestamp plus a fixed set of values to a time series file. AppendRow() only copies into preallocated blocks; full
+    // blocks are encoded and written by a background thread, so the calling thread never waits on the file. If the background thread falls
+    // so far behind that every block is in flight, rows are dropped and counted instead.
+    // Open()/AppendRow()/Flush()/Close() must be called from one thread.
+    class TimeSeriesWriter
+    {
+    private:
+        struct Block
+        {
+            std::vector<uint8_t> data; // TimeSeriesBlockHeader followed by the columns, sized for maxRowsPerBlock
+            size_t numRows;
+            uint64_t firstRow;
+        };
+
+        std::vector<TimeSeriesColumnDesc> m_columns;
+        size_t m_maxRowsPerBlock;
+        std::vector<Block> m_blocks;
+        SpscQueue<size_t> m_fullBlocks; // produced by AppendRow()/Flush(), consumed by the writer thread
+        SpscQueue<size_t> m_freeBlocks; // produced by the writer thread, consumed by AppendRow()
+        size_t m_currentBlock;
+        uint64_t m_numRows;
+        uint64_t m_numDroppedRows;
+        FILE* m_pFile;
+        std::thread m_thread;
+        std::mutex m_wakeMutex;         // only guards the sleep of the writer thread, AppendRow() never takes it
+        std::condition_variable m_wake;
+        std::atomic<bool> m_stop;
+        std::atomic<bool> m_writeFailed;
+
+    public:
+        TimeSeriesWriter()
+            : m_maxRowsPerBlock()
+            , m_currentBlock(~size_t(0))
+            , m_numRows()
+            , m_numDroppedRows()
+            , m_pFile(nullptr)
+            , m_stop(false)
+            , m_writeFailed(false)
+        {
+        }
+        TimeSeriesWriter(const TimeSeriesWriter& writer) = delete;
+        TimeSeriesWriter& operator=(const TimeSeriesWriter& writer) = delete;
+        ~TimeSeriesWriter()
+        {
+            Close();
+        }
+
+        // "columns[0]" describes the timestamps and must be UInt64; the remaining columns receive the values passed to AppendRow(), and must be
+        // floating point. Memory for "numBlocks * maxRowsPerBlock" rows is allocated up front.
+        bool Open(const std::string& path, const std::vector<TimeSeriesColumnDesc>& columns, size_t maxRowsPerBlock = 1024, size_t numBlocks = 4)
+        {
+            Close();
+            if (!IsLittleEndianHost())
+            {
+                NV_PERF_LOG_ERR(20, "Time series files are only supported on little-endian hosts\n");
+                return false;
+            }
+            if (columns.empty() || columns[0].type != TimeSeriesColumnType::UInt64)
+            {
+                NV_PERF_LOG_ERR(20, "The first column must hold UInt64 timestamps\n");
+                return false;
+            }
+            for (size_t columnIndex = 0; columnIndex < columns.size(); ++columnIndex)
+            {
+                const TimeSeriesColumnDesc& column = columns[columnIndex];
+                if (columnIndex && column.type == TimeSeriesColumnType::UInt64)
+                {
+                    NV_PERF_LOG_ERR(20, "Value column \"%s\" must be floating point\n", column.name.c_str());
+                    return false;
+                }
+                if (column.encoding == TimeSeriesEncoding::Delta && column.type != TimeSeriesColumnType::UInt64)
+                {
+                    NV_PERF_LOG_ERR(20, "Delta encoding is only supported for UInt64 columns, column \"%s\"\n", column.name.c_str());
+                    return false;
+                }
+            }
+            if (!maxRowsPerBlock || numBlocks < 2)
+            {
+                NV_PERF_LOG_ERR(20, "Need at least 1 row per block and 2 blocks\n");
+                return false;
+            }
+
+            m_pFile = OpenFile(path.c_str(), "wb");
+            if (!m_pFile)
+            {
+                NV_PERF_LOG_ERR(20, "OpenFile failed for file: %s\n", path.c_str());
+                return false;
+            }
+            m_columns = columns;
+            m_maxRowsPerBlock = maxRowsPerBlock;
+            m_numRows = 0;
+            m_numDroppedRows = 0;
+            m_stop = false;
+            m_writeFailed = false;
+
+            if (!WriteSchema())
+            {
+                NV_PERF_LOG_ERR(20, "Failed to write the header of %s\n", path.c_str());
+                fclose(m_pFile);
+                m_pFile = nullptr;
+                return false;
+            }
+
+            m_blocks.resize(numBlocks);
+            m_fullBlocks.Initialize(numBlocks);
+            m_freeBlocks.Initialize(numBlocks);
+            for (size_t blockIndex = 0; blockIndex < numBlocks; ++blockIndex)
+            {
+                m_blocks[blockIndex].data.resize(GetBlockSize(maxRowsPerBlock));
+                m_freeBlocks.Push(blockIndex);
+            }
+            m_currentBlock = ~size_t(0);
+            m_thread = std::thread(&TimeSeriesWriter::WriterThreadProc, this);
+            return true;
+        }
+
+        bool IsOpen() const
+        {
+            return !!m_pFile;
+        }
+
+        // "numValues" must match the number of value columns, i.e. the number of columns minus 1.
+        // Returns false if the row was dropped.
+        bool AppendRow(uint64_t timestamp, const double* pValues, size_t numValues)
+        {
+            if (!m_pFile || numValues + 1 != m_columns.size())
+            {
+                return false;
+            }
+            if (m_currentBlock == ~size_t(0))
+            {
+                if (!m_freeBlocks.Pop(m_currentBlock))
+                {
+                    if (!m_numDroppedRows++)
+                    {
+                        NV_PERF_LOG_WRN(50, "Time series writer cannot keep up, dropping rows\n");
+                    }
+                    return false;
+                }
+                Block& block = m_blocks[m_currentBlock];
+                block.numRows = 0;
+                block.firstRow = m_numRows;
+            }
+
+            Block& block = m_blocks[m_currentBlock];
+            uint8_t* pColumn = block.data.data() + sizeof(TimeSeriesBlockHeader);
+            memcpy(pColumn + block.numRows * sizeof(uint64_t), &timestamp, sizeof(uint64_t));
+            pColumn += AlignTimeSeriesSize(m_maxRowsPerBlock * sizeof(uint64_t));
+            for (size_t valueIndex = 0; valueIndex < numValues; ++valueIndex)
+            {
+                const TimeSeriesColumnType type = m_columns[valueIndex + 1].type;
+                if (type == TimeSeriesColumnType::Float32)
+                {
+                    const float value = (float)pValues[valueIndex];
+                    memcpy(pColumn + block.numRows * sizeof(float), &value, sizeof(float));
+                }
+                else
+                {
+                    memcpy(pColumn + block.numRows * sizeof(double), &pValues[valueIndex], sizeof(double));
+                }
+                pColumn += AlignTimeSeriesSize(m_maxRowsPerBlock * GetTimeSeriesElementSize(type));
+            }
+            ++block.numRows;
+            ++m_numRows;
+
+            if (block.numRows == m_maxRowsPerBlock)
+            {
+                SubmitCurrentBlock();
+            }
+            return true;
+        }
+
+        // Hands the partially filled block to the writer thread.
+        void Flush()
+        {
+            if (m_currentBlock != ~size_t(0))
+            {
+                SubmitCurrentBlock();
+            }
+        }
+
+        // Writes all pending rows and closes the file. Returns false if any write failed.
+        bool Close()
+        {
+            if (!m_pFile)
+            {
+                return true;
+            }
+            Flush();
+            m_stop = true;
+            m_wake.notify_one();
+            m_thread.join();
+            const bool success = !m_writeFailed && !fclose(m_pFile);
+            m_pFile = nullptr;
+            m_blocks.clear();
+            m_fullBlocks.Reset();
+            m_freeBlocks.Reset();
+            m_currentBlock = ~size_t(0);
+            return success;
+        }
+
+        uint64_t GetNumRows() const
+        {
+            return m_numRows;
+        }
+
+        uint64_t GetNumDroppedRows() const
+        {
+            return m_numDroppedRows;
+        }
+
+    private:
+        size_t GetBlockSize(size_t numRows) const
+        {
+            size_t size = sizeof(TimeSeriesBlockHeader);
+            for (const TimeSeriesColumnDesc& column : m_columns)
+            {
+                size += AlignTimeSeriesSize(numRows * GetTimeSeriesElementSize(column.type));
+            }
+            return size;
+        }
+
+        bool WriteSchema()
+        {
+            std::vector<uint8_t> schema;
+            for (const TimeSeriesColumnDesc& column : m_columns)
+            {
+                TimeSeriesColumnHeader columnHeader = {};
+                columnHeader.type = column.type;
+                columnHeader.encoding = column.encoding;
+                columnHeader.nameLength = (uint32_t)column.name.size();
+                columnHeader.unitLength = (uint32_t)column.unit.size();
+                const uint8_t* pColumnHeader = reinterpret_cast<const uint8_t*>(&columnHeader);
+                schema.insert(schema.end(), pColumnHeader, pColumnHeader + sizeof(columnHeader));
+                schema.insert(schema.end(), column.name.begin(), column.name.end());
+                schema.insert(schema.end(), column.unit.begin(), column.unit.end());
+            }
+            schema.resize(AlignTimeSeriesSize(schema.size()));
+
+            TimeSeriesFileHeader header = {};
+            memcpy(header.magic, TimeSeriesFileHeader::Magic(), sizeof(header.magic));
+            header.version = TimeSeriesFileHeader::Version;
+            header.numColumns = (uint32_t)m_columns.size();
+            header.schemaSize = (uint32_t)schema.size();
+            header.maxRowsPerBlock = (uint32_t)m_maxRowsPerBlock;
+            return fwrite(&header, sizeof(header), 1, m_pFile) == 1
+                && fwrite(schema.data(), 1, schema.size(), m_pFile) == schema.size();
+        }
+
+        void SubmitCurrentBlock()
+        {
+            m_fullBlocks.Push(m_currentBlock); // can't fail, there are as many slots as blocks
+            m_currentBlock = ~size_t(0);
+            m_wake.notify_one();
+        }
+
+        // Encodes "block" in place and compacts its columns from maxRowsPerBlock to numRows entries.
+        void EncodeBlock(Block& block)
+        {
+            TimeSeriesBlockHeader blockHeader = {};
+            blockHeader.magic = TimeSeriesBlockHeader::BlockMagic;
+            blockHeader.numRows = (uint32_t)block.numRows;
+            blockHeader.firstRow = block.firstRow;
+            memcpy(block.data.data(), &blockHeader, sizeof(blockHeader));
+
+            uint8_t* pSrc = block.data.data() + sizeof(TimeSeriesBlockHeader);
+            uint8_t* pDst = block.data.data() + sizeof(TimeSeriesBlockHeader);
+            for (const TimeSeriesColumnDesc& column : m_columns)
+            {
+                const size_t elementSize = GetTimeSeriesElementSize(column.type);
+                if (column.encoding != TimeSeriesEncoding::None)
+                {
+                    // walk backwards so that every element is still unencoded when it serves as the previous value
+                    for (size_t row = block.numRows; row-- > 1;)
+                    {
+                        if (elementSize == sizeof(uint64_t))
+                        {
+                            uint64_t value = 0;
+                            uint64_t previous = 0;
+                            memcpy(&value, pSrc + row * elementSize, elementSize);
+                            memcpy(&previous, pSrc + (row - 1) * elementSize, elementSize);
+                            value = (column.encoding == TimeSeriesEncoding::Delta) ? value - previous : value ^ previous;
+                            memcpy(pSrc + row * elementSize, &value, elementSize);
+                        }
+                        else
+                        {
+                            uint32_t value = 0;
+                            uint32_t previous = 0;
+                            memcpy(&value, pSrc + row * elementSize, elementSize);
+                            memcpy(&previous, pSrc + (row - 1) * elementSize, elementSize);
+                            value ^= previous;
+                            memcpy(pSrc + row * elementSize, &value, elementSize);
+                        }
+                    }
+                }
+                const size_t size = block.numRows * elementSize;
+                memmove(pDst, pSrc, size);
+                memset(pDst + size, 0, AlignTimeSeriesSize(size) - size);
+                pSrc += AlignTimeSeriesSize(m_maxRowsPerBlock * elementSize);
+                pDst += AlignTimeSeriesSize(size);
+            }
+        }
+
+        void WriterThreadProc()
+        {
+            for (;;)
+            {
+                size_t blockIndex = 0;
+                if (m_fullBlocks.Pop(blockIndex))
+                {
+                    Block& block = m_blocks[blockIndex];
+                    EncodeBlock(block);
+                    const size_t size = GetBlockSize(block.numRows);
+                    if (!m_writeFailed && fwrite(block.data.data(), 1, size, m_pFile) != size)
+                    {
+                        NV_PERF_LOG_ERR(20, "Failed to write a time series block\n");
+                        m_writeFailed = true;
+                    }
+                    m_freeBlocks.Push(blockIndex);
+                    continue;
+                }
+                if (m_stop)
+                {
+                    // AppendRow() and Flush() have returned before m_stop was set, so an empty queue stays empty
+                    return;
+                }
+                // AppendRow() notifies without the mutex, so a wake-up can be missed; the timeout bounds the delay
+                std::unique_lock<std::mutex> lock(m_wakeMutex);
+                m_wake.wait_for(lock, std::chrono::milliseconds(10));
+            }
+        }
+    };
+
+    // Reads a time series file through a read-only mapping. Unencoded columns are accessed in place with GetBlockColumnData(), ReadColumn()
+    // decodes and converts any column into a contiguous array.
+    class TimeSeriesReader
+    {
+    private:
+        struct Block
+        {
+            const uint8_t* pData; // the first column
+            size_t numRows;
+            uint64_t firstRow;
+        };
+
+        MappedFile m_file;
+        std::vector<TimeSeriesColumnDesc> m_columns;
+        std::vector<Block> m_blocks;
+        uint64_t m_numRows;
+
+    public:
+        TimeSeriesReader()
+            : m_numRows()
+        {
+        }
+        TimeSeriesReader(const TimeSeriesReader& reader) = delete;
+        TimeSeriesReader& operator=(const TimeSeriesReader& reader) = delete;
+
+        // A truncated last block, e.g. from a process that didn't close the writer, is ignored with a warning.
+        bool Open(const std::string& path)
+        {
+            Close();
+            if (!IsLittleEndianHost())
+            {
+                NV_PERF_LOG_ERR(20, "Time series files are only supported on little-endian hosts\n");
+                return false;
+            }
+            if (!m_file.OpenReadOnly(path))
+            {
+                return false;
+            }
+
+            const uint8_t* pData = m_file.Data();
+            const size_t fileSize = m_file.Size();
+            TimeSeriesFileHeader header = {};
+            if (fileSize < sizeof(header))
+            {
+                NV_PERF_LOG_ERR(20, "%s is too small to be a time series file\n", path.c_str());
+                Close();
+                return false;
+            }
+            memcpy(&header, pData, sizeof(header));
+            if (memcmp(header.magic, TimeSeriesFileHeader::Magic(), sizeof(header.magic)) || header.version != TimeSeriesFileHeader::Version)
+            {
+                NV_PERF_LOG_ERR(20, "%s is not a time series file of a supported version\n", path.c_str());
+                Close();
+                return false;
+            }
+            if (!header.numColumns || sizeof(header) + header.schemaSize > fileSize)
+            {
+                NV_PERF_LOG_ERR(20, "%s has an invalid schema\n", path.c_str());
+                Close();
+                return false;
+            }
+
+            const uint8_t* pSchema = pData + sizeof(header);
+            const uint8_t* pSchemaEnd = pSchema + header.schemaSize;
+            for (uint32_t columnIndex = 0; columnIndex < header.numColumns; ++columnIndex)
+            {
+                TimeSeriesColumnHeader columnHeader = {};
+                if (pSchema + sizeof(columnHeader) > pSchemaEnd)
+                {
+                    NV_PERF_LOG_ERR(20, "%s has an invalid schema\n", path.c_str());
+                    Close();
+                    return false;
+                }
+                memcpy(&columnHeader, pSchema, sizeof(columnHeader));
+                pSchema += sizeof(columnHeader);
+                if ((size_t)columnHeader.nameLength + columnHeader.unitLength > size_t(pSchemaEnd - pSchema) || columnHeader.type > TimeSeriesColumnType::Float32)
+                {
+                    NV_PERF_LOG_ERR(20, "%s has an invalid schema\n", path.c_str());
+                    Close();
+                    return false;
+                }
+                TimeSeriesColumnDesc column;
+                column.type = columnHeader.type;
+                column.encoding = columnHeader.encoding;
+                column.name.assign(reinterpret_cast<const char*>(pSchema), columnHeader.nameLength);
+                pSchema += columnHeader.nameLength;
+                column.unit.assign(reinterpret_cast<const char*>(pSchema), columnHeader.unitLength);
+                pSchema += columnHeader.unitLength;
+                m_columns.push_back(std::move(column));
+            }
+
+            size_t offset = sizeof(header) + header.schemaSize;
+            while (offset < fileSize)
+            {
+                TimeSeriesBlockHeader blockHeader = {};
+                if (fileSize - offset < sizeof(blockHeader))
+                {
+                    NV_PERF_LOG_WRN(50, "%s ends with a truncated block\n", path.c_str());
+                    break;
+                }
+                memcpy(&blockHeader, pData + offset, sizeof(blockHeader));
+                if (blockHeader.magic != TimeSeriesBlockHeader::BlockMagic)
+                {
+                    NV_PERF_LOG_WRN(50, "%s has a corrupt block at offset %zu\n", path.c_str(), offset);
+                    break;
+                }
+                const size_t blockSize = GetBlockSize(blockHeader.numRows);
+                if (fileSize - offset < blockSize)
+                {
+                    NV_PERF_LOG_WRN(50, "%s ends with a truncated block\n", path.c_str());
+                    break;
+                }
+                m_blocks.push_back(Block{ pData + offset + sizeof(blockHeader), blockHeader.numRows, blockHeader.firstRow });
+                m_numRows += blockHeader.numRows;
+                offset += blockSize;
+            }
+            return true;
+        }
+
+        void Close()
+        {
+            m_file.Close();
+            m_columns.clear();
+            m_blocks.clear();
+            m_numRows = 0;
+        }
+
+        size_t GetNumColumns() const
+        {
+            return m_columns.size();
+        }
+
+        const TimeSeriesColumnDesc& GetColumn(size_t columnIndex) const
+        {
+            return m_columns[columnIndex];
+        }
+
+        // Returns ~size_t(0) if there is no column named "name".
+        size_t FindColumn(const std::string& name) const
+        {
+            for (size_t columnIndex = 0; columnIndex < m_columns.size(); ++columnIndex)
+            {
+                if (m_columns[columnIndex].name == name)
+                {
+                    return columnIndex;
+                }
+            }
+            return ~size_t(0);
+        }
+
+        // The number of rows stored, which excludes rows the writer dropped.
+        uint64_t GetNumRows() const
+        {
+            return m_numRows;
+        }
+
+        size_t GetNumBlocks() const
+        {
+            return m_blocks.size();
+        }
+
+        size_t GetBlockNumRows(size_t blockIndex) const
+        {
+            return m_blocks[blockIndex].numRows;
+        }
+
+        uint64_t GetBlockFirstRow(size_t blockIndex) const
+        {
+            return m_blocks[blockIndex].firstRow;
+        }
+
+        // Points into the mapping, valid until Close(). Returns nullptr unless T matches the column type and the column is unencoded.
+        template <class T>
+        const T* GetBlockColumnData(size_t blockIndex, size_t columnIndex) const
+        {
+            const TimeSeriesColumnDesc& column = m_columns[columnIndex];
+            if (column.encoding != TimeSeriesEncoding::None || !IsColumnType<T>(column.type))
+            {
+                return nullptr;
+            }
+            return reinterpret_cast<const T*>(GetBlockColumnBytes(blockIndex, columnIndex));
+        }
+
+        // Decodes a column across all blocks, converting every value to T.
+        template <class T>
+        bool ReadColumn(size_t columnIndex, std::vector<T>& values) const
+        {
+            if (columnIndex >= m_columns.size())
+            {
+                NV_PERF_LOG_ERR(20, "Invalid column index: %zu\n", columnIndex);
+                return false;
+            }
+            const TimeSeriesColumnDesc& column = m_columns[columnIndex];
+            const size_t elementSize = GetTimeSeriesElementSize(column.type);
+            values.clear();
+            values.reserve((size_t)m_numRows);
+            for (size_t blockIndex = 0; blockIndex < m_blocks.size(); ++blockIndex)
+            {
+                const uint8_t* pColumn = GetBlockColumnBytes(blockIndex, columnIndex);
+                uint64_t previous = 0;
+                for (size_t row = 0; row < m_blocks[blockIndex].numRows; ++row)
+                {
+                    uint64_t bits = 0;
+                    memcpy(&bits, pColumn + row * elementSize, elementSize);
+                    if (row && column.encoding == TimeSeriesEncoding::Delta)
+                    {
+                        bits += previous;
+                    }
+                    else if (row && column.encoding == TimeSeriesEncoding::Xor)
+                    {
+                        bits ^= previous;
+                    }
+                    previous = bits;
+
+                    if (column.type == TimeSeriesColumnType::UInt64)
+                    {
+                        values.push_back(static_cast<T>(bits));
+                    }
+                    else if (column.type == TimeSeriesColumnType::Float64)
+                    {
+                        double value = 0.0;
+                        memcpy(&value, &bits, sizeof(value));
+                        values.push_back(static_cast<T>(value));
+                    }
+                    else
+                    {
+                        const uint32_t bits32 = (uint32_t)bits;
+                        float value = 0.0f;
+                        memcpy(&value, &bits32, sizeof(value));
+                        values.push_back(static_cast<T>(value));
+                    }
+                }
+            }
+            return true;
+        }
+
+    private:
+        template <class T>
+        static bool IsColumnType(TimeSeriesColumnType type)
+        {
+            return (type == TimeSeriesColumnType::UInt64 && std::is_same<T, uint64_t>::value)
+                || (type == TimeSeriesColumnType::Float64 && std::is_same<T, double>::value)
+                || (type == TimeSeriesColumnType::Float32 && std::is_same<T, float>::value);
+        }
+
+        size_t GetBlockSize(size_t numRows) const
+        {
+            size_t size = sizeof(TimeSeriesBlockHeader);
+            for (const TimeSeriesColumnDesc& column : m_columns)
+            {
+                size += AlignTimeSeriesSize(numRows * GetTimeSeriesElementSize(column.type));
+            }
+            return size;
+        }
+
+        const uint8_t* GetBlockColumnBytes(size_t blockIndex, size_t columnIndex) const
+        {
+            const Block& block = m_blocks[blockIndex];
+            const uint8_t* pColumn = block.pData;
+            for (size_t ii = 0; ii < columnIndex; ++ii)
+            {
+                pColumn += AlignTimeSeriesSize(block.numRows * GetTimeSeriesElementSize(m_columns[ii].type));
+            }
+            return pColumn;
+        }
+    };
+
+}}
@@ -0,0 +1,197 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+#include <nvperf_host_impl.h>
+#include <NvPerfInit.h>
+#include <NvPerfCounterConfiguration.h>
+#include <NvPerfReportDefinitionHAL.h>
+#include <NvPerfReportGeneratorVulkan.h>
+
+using namespace nv::perf;
+
+// Pre-populates a CounterConfigurationCache with the configurations of the Vulkan report generator, so that the first
+// InitializeReportGenerator() of an application skips scheduling as well. Runs offline, no GPU is needed.
+// Only the Vulkan configuration kind is warmed up: the D3D11, D3D12, OpenGL and EGL report generators create their raw metrics
+// configurations differently, are keyed by their own kind, and keep scheduling on first use.
+
+struct WarmupOptions
+{
+    std::string cacheDirectory;
+    std::vector<const char*> chipNames;
+    std::vector<std::string> additionalMetrics; // must match the "additionalMetrics" the application passes to InitializeReportGenerator()
+};
+
+void PrintUsage()
+{
+    printf("Usage: ConfigCacheWarmup <cacheDirectory> [Options]\n");
+    printf("\n");
+    printf("Creates the counter configurations of the Vulkan report generator (ReportGeneratorVulkan) only.\n");
+    printf("\n");
+    printf("Allowed values for [Options]:\n");
+    printf("  --chip <name>     - chip to create the report configuration for, may be repeated, default all supported chips\n");
+    printf("  --metric <name>   - additional report metric, may be repeated\n");
+    printf("\n");
+    printf("Point the application to the same directory with the environment variable NV_PERF_COUNTER_CONFIGURATION_CACHE_DIR,\n");
+    printf("or with SetCounterConfigurationCacheDirectory().\n");
+    printf("\n");
+}
+
+bool ParseArguments(const int argc, const char* argv[], WarmupOptions& options)
+{
+    for (int argidx = 1; argidx < argc; ++argidx)
+    {
+        if (!strcmp(argv[argidx], "-h") || !strcmp(argv[argidx], "--help"))
+        {
+            PrintUsage();
+            exit(0);
+        }
+        else if (!strcmp(argv[argidx], "--chip") || !strcmp(argv[argidx], "--metric"))
+        {
+            if (argidx + 1 == argc)
+            {
+                NV_PERF_LOG_ERR(10, "Missing value for %s\n", argv[argidx]);
+                PrintUsage();
+                return false;
+            }
+            if (!strcmp(argv[argidx], "--chip"))
+            {
+                options.chipNames.push_back(argv[++argidx]);
+            }
+            else
+            {
+                options.additionalMetrics.push_back(argv[++argidx]);
+            }
+        }
+        else if (options.cacheDirectory.empty())
+        {
+            options.cacheDirectory = argv[argidx];
+        }
+        else
+        {
+            NV_PERF_LOG_ERR(10, "Unexpected argument: %s\n", argv[argidx]);
+            PrintUsage();
+            return false;
+        }
+    }
+
+    if (options.cacheDirectory.empty())
+    {
+        NV_PERF_LOG_ERR(10, "Missing <cacheDirectory>!\n");
+        PrintUsage();
+        return false;
+    }
+    if (options.chipNames.empty())
+    {
+        options.chipNames = GetReportSupportedChips();
+    }
+    return true;
+}
+
+// the metrics are laid out by InitReportLayout(), like in ReportGeneratorStateMachine::InitializeReportMetrics(), so the keys match
+bool WarmupReportConfiguration(const CounterConfigurationCache& cache, const char* pChipName, const std::vector<std::string>& additionalMetrics)
+{
+    const size_t scratchBufferSize = VulkanCalculateMetricsEvaluatorScratchBufferSize(pChipName);
+    if (!scratchBufferSize)
+    {
+        return false;
+    }
+    std::vector<uint8_t> scratchBuffer(scratchBufferSize);
+    NVPW_MetricsEvaluator* pMetricsEvaluator = VulkanCreateMetricsEvaluator(scratchBuffer.data(), scratchBuffer.size(), pChipName);
+    if (!pMetricsEvaluator)
+    {
+        return false;
+    }
+    MetricsEvaluator metricsEvaluator(pMetricsEvaluator, std::move(scratchBuffer));
+
+    MetricNameIndex metricNameIndex;
+    const bool cacheProperties = false;
+    if (!metricNameIndex.Build(metricsEvaluator, cacheProperties))
+    {
+        return false;
+    }
+    ReportLayout reportLayout;
+    std::vector<NVPW_MetricEvalRequest> metricEvalRequests;
+    if (!InitReportLayout(metricNameIndex, metricsEvaluator, pChipName, additionalMetrics, reportLayout, metricEvalRequests))
+    {
+        return false;
+    }
+
+    const std::string key = CounterConfigurationCache::MakeKey(pChipName, profiler::ReportGeneratorVulkan::GetCounterConfigurationKind(), metricEvalRequests.data(), metricEvalRequests.size());
+    CounterConfiguration configuration;
+    if (cache.Find(key, configuration))
+    {
+        printf("%-6s - up to date, %s\n", pChipName, cache.GetEntryPath(key).c_str());
+        return true;
+    }
+
+    const auto startTime = std::chrono::steady_clock::now();
+    auto initializeConfigBuilder = [&](MetricsConfigBuilder& configBuilder) {
+        NVPA_RawMetricsConfig* pRawMetricsConfig = profiler::VulkanCreateRawMetricsConfig(pChipName);
+        if (!pRawMetricsConfig)
+        {
+            return false;
+        }
+        return configBuilder.Initialize(metricsEvaluator, pRawMetricsConfig, pChipName);
+    };
+    if (!CreateConfiguration(cache, pChipName, profiler::ReportGeneratorVulkan::GetCounterConfigurationKind(), metricEvalRequests.data(), metricEvalRequests.size(), initializeConfigBuilder, configuration))
+    {
+        NV_PERF_LOG_ERR(10, "CreateConfiguration failed for chip=%s\n", pChipName);
+        return false;
+    }
+    if (!cache.Find(key, configuration))
+    {
+        NV_PERF_LOG_ERR(10, "Failed storing the configuration of chip=%s\n", pChipName);
+        return false;
+    }
+    const double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+    printf("%-6s - %zu metrics, %zu passes, scheduled in %.1f ms, %s\n", pChipName, metricEvalRequests.size(), configuration.numPasses, elapsedMs, cache.GetEntryPath(key).c_str());
+    return true;
+}
+
+int main(const int argc, const char* argv[])
+{
+    WarmupOptions options;
+    if (!ParseArguments(argc, argv, options))
+    {
+        return 1;
+    }
+
+    if (!InitializeNvPerf())
+    {
+        return 1;
+    }
+
+    const CounterConfigurationCache cache(options.cacheDirectory);
+    int numFailures = 0;
+    for (const char* pChipName : options.chipNames)
+    {
+        if (!WarmupReportConfiguration(cache, pChipName, options.additionalMetrics))
+        {
+            ++numFailures;
+        }
+    }
+    return numFailures ? 1 : 0;
+}
@@ -16,11 +16,13 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <iostream>
 #include <fstream>
 #include <cassert>
+#include <thread>
 
 #include <nvperf_host_impl.h>
 #include <NvPerfInit.h>
@@ -45,10 +47,12 @@ namespace nv { namespace perf { namespace tool {
         enum class Output
         {
             json,
-            html
+            html,
+            watch
         };
         Output output = Output::json;
         std::string htmlPath = DEFAULT_HTML_OUTPUT_PATH;
+        double watchInterval = 0.0; // in seconds
     };
 
     struct GpuDiagState
@@ -64,11 +68,13 @@ namespace nv { namespace perf { namespace tool {
 
     static void PrintUsage()
     {
-        printf("Usage: GpuDiag [--html [path_to_html_file]]\n");
+        printf("Usage: GpuDiag [--html [path_to_html_file]] [--watch interval_in_seconds]\n");
         printf("\n");
         printf("By default it will print JSON to the console.\n");
         printf("Use \"--html path_to_html_file\" to generate a html file.\n");
         printf("The default \"path_to_html_file\" is %s in the current working directory.\n", DEFAULT_HTML_OUTPUT_PATH);
+        printf("Use \"--watch interval_in_seconds\" to re-sample clocks, temperatures and loads until interrupted (Linux only).\n");
+        printf("Each sample is printed as one line of JSON, holding only the fields that changed since the previous line.\n");
     }
 
     static bool ParseArguments(const int argc, const char* argv[], Options& options)
@@ -96,6 +102,22 @@ namespace nv { namespace perf { namespace tool {
                 options.htmlPath = argv[2];
             }
         }
+        else if (!strcmp(argv[1], "--watch"))
+        {
+#if defined(__linux__)
+            options.output = Options::Output::watch;
+            options.watchInterval = (argc >= 3) ? strtod(argv[2], nullptr) : 0.0;
+            if (!(options.watchInterval > 0.0))
+            {
+                NV_PERF_LOG_ERR(10, "--watch requires an interval in seconds\n");
+                PrintUsage();
+                return false;
+            }
+#else
+            NV_PERF_LOG_ERR(10, "--watch is only supported on Linux\n");
+            return false;
+#endif
+        }
         else
         {
             NV_PERF_LOG_ERR(10, "Unknown argument specified: %s\n", argv[1]);
@@ -267,6 +289,47 @@ namespace nv { namespace perf { namespace tool {
         return true;
     }
 
+#if defined(__linux__)
+    // Streams NDJSON: a timestamp in milliseconds since the epoch, and the dynamic fields that changed since the previous line (all of them
+    // on the first line). Neither NvPerf nor any graphics API is initialized, so this is cheap enough to leave running on a device.
+    int Watch(const Options& options)
+    {
+        linux_::State linuxState;
+        if (!linux_::InitializeState(linuxState))
+        {
+            NV_PERF_LOG_ERR(10, "linux_::InitializeState failed!\n");
+            return -1;
+        }
+
+        const auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(options.watchInterval));
+        auto nextSampleTime = std::chrono::steady_clock::now();
+        ordered_json previous;
+        while (true)
+        {
+            ordered_json current;
+            linux_::AppendDynamicState(linuxState, current);
+
+            ordered_json line;
+            line["Timestamp"] = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+            line.update(linux_::DiffState(previous, current));
+            std::cout << line.dump() << std::endl;
+            if (!std::cout)
+            {
+                return 0; // e.g. the reading end of a pipe was closed
+            }
+            previous = std::move(current);
+
+            nextSampleTime += interval;
+            const auto now = std::chrono::steady_clock::now();
+            if (nextSampleTime < now)
+            {
+                nextSampleTime = now;
+            }
+            std::this_thread::sleep_until(nextSampleTime);
+        }
+    }
+#endif
+
 }}} // nv::perf::tool
 
 int main(const int argc, const char* argv[])
@@ -280,6 +343,12 @@ int main(const int argc, const char* argv[])
         NV_PERF_LOG_ERR(10, "Failed ParseArguments\n");
         return -1;
     }
+#if defined(__linux__)
+    if (options.output == Options::Output::watch)
+    {
+        return Watch(options);
+    }
+#endif
 
     nlohmann::ordered_json root;
     {
@@ -18,17 +18,21 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
-#include <sstream>
-#include <iomanip>
+#include <string>
 #include <vector>
 
-#include <sys/utsname.h>
+#include <dirent.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <sys/utsname.h>
+#include <unistd.h>
 
 #include <json/json.hpp>
 
+#include <NvPerfInit.h>
 #include "GpuDiagCommon.h"
 
 namespace nv { namespace perf { namespace tool { namespace linux_ {
@@ -38,141 +42,220 @@ namespace nv { namespace perf { namespace tool { namespace linux_ {
 
     struct State
     {
+        std::string rootPath; // prefixed to every /proc, /sys and /etc path, e.g. a synthetic root filesystem; empty for the running system
     };
 
-    // a simple RAII wrapper
-    class Pipe
+    // Reads the whole file; /proc and /sys files report a size of 0, so this reads until EOF instead of relying on stat().
+    inline bool ReadFile(const State& state, const std::string& path, std::string& contents)
     {
-    private:
-        FILE* m_pPipe;
-        std::string m_cmd; // DFD
-    public:
-        Pipe()
-            : m_pPipe()
-        {
-        }
-        Pipe(FILE* pPipe, const std::string& cmd)
-            : m_pPipe(pPipe)
-            , m_cmd(cmd)
-        {
-        }
-        Pipe(Pipe&& pipe)
-            : m_pPipe(pipe.m_pPipe)
-            , m_cmd(pipe.m_cmd)
-        {
-        }
-        Pipe& operator=(Pipe&& rhs)
+        const std::string fullPath = state.rootPath + path;
+        const int fd = open(fullPath.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd == -1)
         {
-            m_pPipe = rhs.m_pPipe;
-            m_cmd = rhs.m_cmd;
-            rhs.m_pPipe = nullptr;
-            rhs.m_cmd = std::string();
-            return *this;
+            return false;
         }
-        ~Pipe()
+        contents.clear();
+        char buffer[4096];
+        while (true)
         {
-            if (m_pPipe)
+            const ssize_t size = read(fd, buffer, sizeof(buffer));
+            if (size < 0)
             {
-                int ret = pclose(m_pPipe);
-                if (ret)
+                if (errno == EINTR)
                 {
-                    NV_PERF_LOG_ERR(50, "Failed pclose for cmd: %s\nError: %s\n", m_cmd.c_str(), strerror(errno));
+                    continue;
                 }
+                NV_PERF_LOG_ERR(50, "Failed reading %s\nError: %s\n", fullPath.c_str(), strerror(errno));
+                close(fd);
+                return false;
+            }
+            if (!size)
+            {
+                break;
             }
+            contents.append(buffer, (size_t)size);
         }
-    private:
-        Pipe(const Pipe& pipe);
-        Pipe& operator=(const Pipe& rhs);
-    };
+        close(fd);
+        return true;
+    }
 
-    bool ReadFromCmd(const char* pCmd, std::string& output)
+    inline std::string Trim(const std::string& str)
     {
-        FILE* pPipe = popen(pCmd, "r");
-        if (!pPipe)
+        const char* pWhitespace = " \t\r\n";
+        const size_t begin = str.find_first_not_of(pWhitespace);
+        if (begin == std::string::npos)
+        {
+            return std::string();
+        }
+        return str.substr(begin, str.find_last_not_of(pWhitespace) - begin + 1);
+    }
+
+    // the first line of the file without surrounding whitespace, e.g. of /proc/sys/kernel/osrelease
+    inline bool ReadLine(const State& state, const std::string& path, std::string& line)
+    {
+        std::string contents;
+        if (!ReadFile(state, path, contents))
         {
-            NV_PERF_LOG_ERR(50, "Failed popen for cmd: %s\nError: %s\n", pCmd, strerror(errno));
             return false;
         }
-        Pipe pipe(pPipe, pCmd);
+        line = Trim(contents.substr(0, contents.find('\n')));
+        return true;
+    }
 
-        std::stringstream ss;
-        const size_t BUFFER_SIZE = 4096;
-        char buffer[BUFFER_SIZE] = {};
-        while (true)
+    inline bool ReadNumber(const State& state, const std::string& path, double& value)
+    {
+        std::string line;
+        if (!ReadLine(state, path, line))
+        {
+            return false;
+        }
+        char* pEnd = nullptr;
+        value = strtod(line.c_str(), &pEnd);
+        return pEnd != line.c_str();
+    }
+
+    // Finds the first line "key<separator>value" of e.g. /proc/cpuinfo, /proc/meminfo or /etc/os-release, and returns its value without
+    // surrounding whitespace and quotes.
+    inline bool FindValue(const std::string& contents, const char* pKey, char separator, std::string& value)
+    {
+        const size_t keyLength = strlen(pKey);
+        for (size_t lineBegin = 0; lineBegin < contents.size();)
         {
-            char* pStr = std::fgets(buffer, BUFFER_SIZE, pPipe);
-            if (!pStr)
+            size_t lineEnd = contents.find('\n', lineBegin);
+            if (lineEnd == std::string::npos)
             {
-                if (ferror(pPipe))
-                {
-                    NV_PERF_LOG_ERR(50, "Error detected for cmd: %s\nError: %s\n", pCmd, strerror(errno));
-                    return false;
-                }
-                output = ss.str();
-                return true;
+                lineEnd = contents.size();
             }
-            const size_t length = strlen(buffer);
-            if (length)
+            const size_t separatorPos = contents.find(separator, lineBegin);
+            if (separatorPos < lineEnd && Trim(contents.substr(lineBegin, separatorPos - lineBegin)) == std::string(pKey, keyLength))
             {
-                if (buffer[length - 1] == '\n')
+                value = Trim(contents.substr(separatorPos + 1, lineEnd - separatorPos - 1));
+                if (value.size() >= 2 && (value.front() == '"' || value.front() == '\'') && value.back() == value.front())
                 {
-                    buffer[length - 1] = '\0';
+                    value = value.substr(1, value.size() - 2);
                 }
-                ss << buffer;
-                buffer[0] = '\0';
+                return true;
             }
+            lineBegin = lineEnd + 1;
         }
-        return true;
+        return false;
     }
 
-    inline std::string ReadFromCmd(const char* pCmd)
+    // The entries starting with "prefix" followed by a number, e.g. "cpu0", "cpu1", ..., "cpu10", in numerical order.
+    inline std::vector<std::string> ListNumberedEntries(const State& state, const std::string& path, const char* pPrefix)
     {
-        std::string output;
-        bool success = ReadFromCmd(pCmd, output);
-        if (!success)
+        std::vector<std::string> entries;
+        const std::string fullPath = state.rootPath + path;
+        DIR* pDir = opendir(fullPath.c_str());
+        if (!pDir)
         {
-            NV_PERF_LOG_ERR(50, "Failed ReadFromCmd for cmd\n", pCmd);
-            return "Unknown";
+            return entries;
         }
-        return output;
+        const size_t prefixLength = strlen(pPrefix);
+        for (const dirent* pEntry = readdir(pDir); pEntry; pEntry = readdir(pDir))
+        {
+            const std::string name = pEntry->d_name;
+            if (name.size() > prefixLength && !name.compare(0, prefixLength, pPrefix) && name.find_first_not_of("0123456789", prefixLength) == std::string::npos)
+            {
+                entries.push_back(name);
+            }
+        }
+        closedir(pDir);
+        std::sort(entries.begin(), entries.end(), [](const std::string& lhs, const std::string& rhs) {
+            return lhs.size() != rhs.size() ? lhs.size() < rhs.size() : lhs < rhs;
+        });
+        return entries;
     }
 
-    inline std::string GetOSNameFromUName()
+    // On the running system this is uname(); a synthetic root provides the same data through /proc/sys/kernel.
+    inline std::string GetOSNameFromUName(const State& state)
     {
-        utsname name;
-        int ret = uname(&name);
-        if (ret)
+        std::string sysname;
+        std::string machine;
+        std::string release;
+        if (state.rootPath.empty())
+        {
+            utsname name;
+            int ret = uname(&name);
+            if (ret)
+            {
+                NV_PERF_LOG_ERR(10, "Failed uname: %s\n", strerror(errno));
+                return "Unknown";
+            }
+            sysname = name.sysname;
+            machine = name.machine;
+            release = name.release;
+        }
+        else if (!ReadLine(state, "/proc/sys/kernel/ostype", sysname) || !ReadLine(state, "/proc/sys/kernel/osrelease", release) || !ReadLine(state, "/proc/sys/kernel/arch", machine))
         {
-            NV_PERF_LOG_ERR(10, "Failed uname: %s\n", strerror(errno));
             return "Unknown";
         }
-
-        std::stringstream ss;
-        ss << name.sysname << "(" << name.machine << ") " << name.release;
         // TODO: if it's Ubuntu, we can further convert the kernel versions to Ubuntu versions:
         // https://askubuntu.com/questions/517136/list-of-ubuntu-versions-with-corresponding-linux-kernel-version/517140#517140
-        return ss.str();
+        return sysname + "(" + machine + ") " + release;
     }
 
+    // The same sources "lsb_release -ds" reads, without spawning it.
     inline std::string GetOSName(const State& state)
     {
+        std::string contents;
         std::string osVerStr;
-        bool success = ReadFromCmd("lsb_release -ds", osVerStr);
-        if (success)
+        if (ReadFile(state, "/etc/os-release", contents) && FindValue(contents, "PRETTY_NAME", '=', osVerStr))
         {
             return osVerStr;
         }
-        NV_PERF_LOG_ERR(10, "Reading os version from lsb_release failed, trying reading from uname\n");
-        return GetOSNameFromUName();
+        if (ReadFile(state, "/etc/lsb-release", contents) && FindValue(contents, "DISTRIB_DESCRIPTION", '=', osVerStr))
+        {
+            return osVerStr;
+        }
+        NV_PERF_LOG_ERR(10, "Reading os version from /etc/os-release failed, trying reading from uname\n");
+        return GetOSNameFromUName(state);
+    }
+
+    inline std::string GetProcessorName(const State& state)
+    {
+        std::string contents;
+        std::string name;
+        if (ReadFile(state, "/proc/cpuinfo", contents) && (FindValue(contents, "model name", ':', name) || FindValue(contents, "Processor", ':', name)))
+        {
+            return name;
+        }
+        // arm64 kernels do not report a model name, the device tree names the SoC module instead, e.g. "NVIDIA Jetson AGX Orin"
+        if (ReadFile(state, "/proc/device-tree/model", contents))
+        {
+            return Trim(contents.substr(0, contents.find('\0')));
+        }
+        return "Unknown";
+    }
+
+    // Like "nproc --all", counts the configured rather than the online processors.
+    inline std::string GetNumberOfProcessors(const State& state)
+    {
+        size_t numProcessors = ListNumberedEntries(state, "/sys/devices/system/cpu", "cpu").size();
+        std::string contents;
+        if (!numProcessors && ReadFile(state, "/proc/cpuinfo", contents))
+        {
+            for (size_t lineBegin = 0; lineBegin < contents.size();)
+            {
+                numProcessors += !contents.compare(lineBegin, 9, "processor");
+                const size_t lineEnd = contents.find('\n', lineBegin);
+                if (lineEnd == std::string::npos)
+                {
+                    break;
+                }
+                lineBegin = lineEnd + 1;
+            }
+        }
+        return numProcessors ? std::to_string(numProcessors) : "Unknown";
     }
 
-    inline std::string GetPhysicalMemorySize()
+    inline std::string GetPhysicalMemorySize(const State& state)
     {
+        std::string contents;
         std::string sizeStr;
-        bool success  = ReadFromCmd("awk '/MemTotal/ { print $2 }' /proc/meminfo", sizeStr);
-        if (success)
+        if (ReadFile(state, "/proc/meminfo", contents) && FindValue(contents, "MemTotal", ':', sizeStr))
         {
-            return sizeStr + " kB";
+            return sizeStr.substr(0, sizeStr.find(' ')) + " kB";
         }
         return "Unknown";
     }
@@ -185,9 +268,126 @@ namespace nv { namespace perf { namespace tool { namespace linux_ {
     inline void AppendState(const State& state, ordered_json& node)
     {
         node["OS"] = GetOSName(state);
-        node["Processor"] = ReadFromCmd("cat /proc/cpuinfo | grep \"model name\" | cut -d \":\" -f2 | head -1");
-        node["NumberOfProcessors"] = ReadFromCmd("nproc --all"); // both "nproc" & "grep -c ^processor /proc/cpuinfo" may not work with hyperthreading
-        node["PhysicalMemory"] = GetPhysicalMemorySize();
+        node["Processor"] = GetProcessorName(state);
+        node["NumberOfProcessors"] = GetNumberOfProcessors(state);
+        node["PhysicalMemory"] = GetPhysicalMemorySize(state);
+    }
+
+    // The fields that change while the system runs, sampled repeatedly by "GpuDiag --watch". Fields that cannot be read are left out,
+    // e.g. the GPU's devfreq node on discrete GPUs.
+    inline void AppendDynamicState(const State& state, ordered_json& node)
+    {
+        std::string contents;
+        std::string value;
+        if (ReadLine(state, "/proc/loadavg", value))
+        {
+            node["LoadAverage"] = strtod(value.c_str(), nullptr);
+        }
+        if (ReadFile(state, "/proc/meminfo", contents) && FindValue(contents, "MemAvailable", ':', value))
+        {
+            node["AvailableMemoryKiB"] = strtoull(value.c_str(), nullptr, 10);
+        }
+
+        ordered_json cpuFrequencies = ordered_json::object();
+        for (const std::string& cpu : ListNumberedEntries(state, "/sys/devices/system/cpu", "cpu"))
+        {
+            double frequency = 0.0;
+            if (ReadNumber(state, "/sys/devices/system/cpu/" + cpu + "/cpufreq/scaling_cur_freq", frequency))
+            {
+                cpuFrequencies[cpu] = frequency / 1000.0; // kHz
+            }
+        }
+        if (!cpuFrequencies.empty())
+        {
+            node["CPUFrequenciesMHz"] = std::move(cpuFrequencies);
+        }
+
+        // integrated GPUs scale their clock through devfreq, e.g. "17000000.gpu" on Orin or "17000000.ga10b" on older releases
+        DIR* pDir = opendir((state.rootPath + "/sys/class/devfreq").c_str());
+        if (pDir)
+        {
+            std::vector<std::string> gpus;
+            for (const dirent* pEntry = readdir(pDir); pEntry; pEntry = readdir(pDir))
+            {
+                const std::string name = pEntry->d_name;
+                if (name.find("gpu") != std::string::npos || name.find("ga10b") != std::string::npos || name.find("gv11b") != std::string::npos)
+                {
+                    gpus.push_back(name);
+                }
+            }
+            closedir(pDir);
+            std::sort(gpus.begin(), gpus.end());
+            if (!gpus.empty())
+            {
+                const std::string devfreq = "/sys/class/devfreq/" + gpus.front();
+                double frequency = 0.0;
+                if (ReadNumber(state, devfreq + "/cur_freq", frequency))
+                {
+                    node["GPUFrequencyMHz"] = frequency / 1000000.0; // Hz
+                }
+                double load = 0.0;
+                if (ReadNumber(state, devfreq + "/device/load", load))
+                {
+                    node["GPULoadPercent"] = load / 10.0; // per mille
+                }
+            }
+        }
+
+        ordered_json temperatures = ordered_json::object();
+        for (const std::string& zone : ListNumberedEntries(state, "/sys/class/thermal", "thermal_zone"))
+        {
+            std::string type;
+            double temperature = 0.0;
+            if (ReadLine(state, "/sys/class/thermal/" + zone + "/type", type) && ReadNumber(state, "/sys/class/thermal/" + zone + "/temp", temperature))
+            {
+                if (type.empty() || temperatures.contains(type))
+                {
+                    type += (type.empty() ? "" : "_") + zone;
+                }
+                temperatures[type] = temperature / 1000.0; // millidegree Celsius
+            }
+        }
+        if (!temperatures.empty())
+        {
+            node["TemperaturesCelsius"] = std::move(temperatures);
+        }
+    }
+
+    // The fields of "current" that differ from "previous", recursing into objects, with null for fields that disappeared.
+    inline ordered_json DiffState(const ordered_json& previous, const ordered_json& current)
+    {
+        ordered_json delta = ordered_json::object();
+        for (auto itr = current.begin(); itr != current.end(); ++itr)
+        {
+            const auto previousItr = previous.is_object() ? previous.find(itr.key()) : previous.end();
+            if (!previous.is_object() || previousItr == previous.end())
+            {
+                delta[itr.key()] = itr.value();
+            }
+            else if (itr->is_object() && previousItr->is_object())
+            {
+                ordered_json childDelta = DiffState(*previousItr, *itr);
+                if (!childDelta.empty())
+                {
+                    delta[itr.key()] = std::move(childDelta);
+                }
+            }
+            else if (*itr != *previousItr)
+            {
+                delta[itr.key()] = itr.value();
+            }
+        }
+        if (previous.is_object())
+        {
+            for (auto itr = previous.begin(); itr != previous.end(); ++itr)
+            {
+                if (current.find(itr.key()) == current.end())
+                {
+                    delta[itr.key()] = nullptr;
+                }
+            }
+        }
+        return delta;
     }
 
     inline void CleanupState(State& state)
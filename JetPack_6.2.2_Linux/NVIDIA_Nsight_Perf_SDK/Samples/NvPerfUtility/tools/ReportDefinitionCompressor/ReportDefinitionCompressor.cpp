@@ -0,0 +1,203 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <NvPerfLz4.h>
+#include <NvPerfReportDefinitionTU10X.h>
+#include <NvPerfReportDefinitionTU11X.h>
+#include <NvPerfReportDefinitionGA10X.h>
+#include <NvPerfReportDefinitionGA10B.h>
+#include <NvPerfReportDefinitionAD10X.h>
+
+using namespace nv::perf;
+
+// Generates NvPerfCompressedReportDefinition<FAMILY>.h from NvPerfReportDefinition<FAMILY>.h, which NvPerfReportDefinitionHAL.h includes
+// instead unless NV_PERF_COMPRESSED_REPORT_DEFINITIONS is 0. Rerun it, e.g. by building the CompressReportDefinitions target, whenever the
+// uncompressed report definitions change.
+
+struct ReportDefinitionFamily
+{
+    const char* pName;      // e.g. "GA10X", as in the header names
+    const char* pNamespace; // e.g. "ga10x"
+    ReportDefinition (*getPerRangeReportDefinition)();
+    ReportDefinition (*getSummaryReportDefinition)();
+};
+
+const ReportDefinitionFamily Families[] = {
+    { "TU10X", "tu10x", tu10x::PerRangeReport::GetReportDefinition, tu10x::SummaryReport::GetReportDefinition },
+    { "TU11X", "tu11x", tu11x::PerRangeReport::GetReportDefinition, tu11x::SummaryReport::GetReportDefinition },
+    { "GA10X", "ga10x", ga10x::PerRangeReport::GetReportDefinition, ga10x::SummaryReport::GetReportDefinition },
+    { "GA10B", "ga10b", ga10b::PerRangeReport::GetReportDefinition, ga10b::SummaryReport::GetReportDefinition },
+    { "AD10X", "ad10x", ad10x::PerRangeReport::GetReportDefinition, ad10x::SummaryReport::GetReportDefinition },
+};
+
+const char* LicenseHeader =
+    "/*\n"
+    "* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.\n"
+    "*\n"
+    "* Licensed under the Apache License, Version 2.0 (the \"License\");\n"
+    "* you may not use this file except in compliance with the License.\n"
+    "* You may obtain a copy of the License at\n"
+    "*\n"
+    "*     http://www.apache.org/licenses/LICENSE-2.0\n"
+    "*\n"
+    "* Unless required by applicable law or agreed to in writing, software\n"
+    "* distributed under the License is distributed on an \"AS IS\" BASIS,\n"
+    "* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.\n"
+    "* See the License for the specific language governing permissions and\n"
+    "* limitations under the License.\n"
+    "*/\n";
+
+void PrintUsage()
+{
+    printf("Usage: ReportDefinitionCompressor <outputDirectory>\n");
+    printf("\n");
+    printf("Writes NvPerfCompressedReportDefinition<FAMILY>.h for all chip families into <outputDirectory>, normally NvPerfUtility/include.\n");
+    printf("\n");
+}
+
+// The layout CompressedReportDefinition expects: the names, then the HTML, each null-terminated.
+std::vector<uint8_t> SerializeContents(const ReportDefinition& definition)
+{
+    std::vector<uint8_t> contents;
+    auto append = [&](const char* pStr) {
+        contents.insert(contents.end(), pStr, pStr + strlen(pStr) + 1);
+    };
+    for (size_t ii = 0; ii < definition.numCounters; ++ii)
+    {
+        append(definition.ppCounterNames[ii]);
+    }
+    for (size_t ii = 0; ii < definition.numRatios; ++ii)
+    {
+        append(definition.ppRatioNames[ii]);
+    }
+    for (size_t ii = 0; ii < definition.numThroughputs; ++ii)
+    {
+        append(definition.ppThroughputNames[ii]);
+    }
+    append(definition.pReportHtml);
+    return contents;
+}
+
+bool WriteReportDefinition(std::string& header, const char* pReportNamespace, const ReportDefinition& definition, size_t& uncompressedSize, size_t& compressedSize)
+{
+    const std::vector<uint8_t> contents = SerializeContents(definition);
+    const std::vector<uint8_t> compressed = Lz4CompressBlock(contents.data(), contents.size());
+    std::vector<uint8_t> roundTrip(contents.size());
+    if (!Lz4DecompressBlock(compressed.data(), compressed.size(), roundTrip.data(), roundTrip.size()) || roundTrip != contents)
+    {
+        fprintf(stderr, "Round trip failed for %s\n", pReportNamespace);
+        return false;
+    }
+    uncompressedSize = contents.size();
+    compressedSize = compressed.size();
+
+    char buffer[256];
+    header += std::string("    namespace ") + pReportNamespace + " {\n";
+    header += "\n";
+    header += "        inline ReportDefinition GetReportDefinition()\n";
+    header += "        {\n";
+    header += "            static const unsigned char CompressedContents[] = {\n";
+    for (size_t ii = 0; ii < compressed.size(); ++ii)
+    {
+        if (ii % 20 == 0)
+        {
+            header += (ii ? "\n                " : "                ");
+        }
+        snprintf(buffer, sizeof(buffer), "0x%02x,%s", compressed[ii], (ii % 20 == 19 || ii + 1 == compressed.size()) ? "" : " ");
+        header += buffer;
+    }
+    header += "\n";
+    header += "            };\n";
+    header += "\n";
+    snprintf(buffer, sizeof(buffer), "%zu, %zu, %zu, %zu", contents.size(), definition.numCounters, definition.numRatios, definition.numThroughputs);
+    header += std::string("            static const CompressedReportDefinition reportDefinition(CompressedContents, sizeof(CompressedContents), ") + buffer + ");\n";
+    header += "            return reportDefinition.GetReportDefinition();\n";
+    header += "        }\n";
+    header += "\n";
+    header += std::string("    } // namespace ") + pReportNamespace + "\n";
+    return true;
+}
+
+bool WriteFamily(const std::string& outputDirectory, const ReportDefinitionFamily& family)
+{
+    size_t perRangeSize = 0;
+    size_t perRangeCompressedSize = 0;
+    size_t summarySize = 0;
+    size_t summaryCompressedSize = 0;
+
+    std::string header = LicenseHeader;
+    header += "\n";
+    header += std::string("// Generated by tools/ReportDefinitionCompressor from NvPerfReportDefinition") + family.pName + ".h, do not edit.\n";
+    header += "\n";
+    header += "#pragma once\n";
+    header += "\n";
+    header += "#include \"NvPerfCompressedReportDefinition.h\"\n";
+    header += "\n";
+    header += std::string("namespace nv { namespace perf { namespace compressed { namespace ") + family.pNamespace + " {\n";
+    header += "\n";
+    if (!WriteReportDefinition(header, "PerRangeReport", family.getPerRangeReportDefinition(), perRangeSize, perRangeCompressedSize))
+    {
+        return false;
+    }
+    header += "\n";
+    if (!WriteReportDefinition(header, "SummaryReport", family.getSummaryReportDefinition(), summarySize, summaryCompressedSize))
+    {
+        return false;
+    }
+    header += "\n";
+    header += "} } } }\n";
+
+    const std::string filename = outputDirectory + "/NvPerfCompressedReportDefinition" + family.pName + ".h";
+    FILE* fp = fopen(filename.c_str(), "wb");
+    if (!fp)
+    {
+        fprintf(stderr, "Failed to open %s\n", filename.c_str());
+        return false;
+    }
+    const bool success = fwrite(header.data(), 1, header.size(), fp) == header.size();
+    if (fclose(fp) || !success)
+    {
+        fprintf(stderr, "Failed to write %s\n", filename.c_str());
+        return false;
+    }
+    printf("%s - per-range %zu -> %zu bytes, summary %zu -> %zu bytes, %s\n", family.pName, perRangeSize, perRangeCompressedSize, summarySize, summaryCompressedSize, filename.c_str());
+    return true;
+}
+
+int main(const int argc, const char* argv[])
+{
+    if (argc != 2 || !strcmp(argv[1], "-h") || !strcmp(argv[1], "--help"))
+    {
+        PrintUsage();
+        return argc == 2 ? 0 : 1;
+    }
+
+    int numFailures = 0;
+    for (const ReportDefinitionFamily& family : Families)
+    {
+        if (!WriteFamily(argv[1], family))
+        {
+            ++numFailures;
+        }
+    }
+    return numFailures ? 1 : 0;
+}
@@ -16,7 +16,13 @@
 
 #pragma once
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
 #include <NvPerfInit.h>
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
 
 namespace nv { namespace perf { namespace test {
 
@@ -40,4 +46,41 @@ namespace nv { namespace perf { namespace test {
         }
     };
 
+    // A path in the system's temporary directory, unique to this process, that is removed on construction and destruction.
+    class ScopedTemporaryFile
+    {
+    private:
+        std::string m_path;
+    public:
+        explicit ScopedTemporaryFile(const char* pName)
+        {
+#if defined(_WIN32)
+            char directory[MAX_PATH + 1] = {};
+            if (!GetTempPathA(sizeof(directory), directory))
+            {
+                directory[0] = '\0';
+            }
+            const unsigned long processId = GetCurrentProcessId();
+#else
+            const char* pDirectory = getenv("TMPDIR");
+            std::string directory = (pDirectory && *pDirectory) ? pDirectory : "/tmp";
+            directory += "/";
+            const unsigned long processId = (unsigned long)getpid();
+#endif
+            m_path = std::string(directory) + std::to_string(processId) + "_" + pName;
+            remove(m_path.c_str());
+        }
+        ~ScopedTemporaryFile()
+        {
+            remove(m_path.c_str());
+        }
+        ScopedTemporaryFile(const ScopedTemporaryFile&) = delete;
+        ScopedTemporaryFile& operator=(const ScopedTemporaryFile&) = delete;
+
+        const char* Path() const
+        {
+            return m_path.c_str();
+        }
+    };
+
 }}} // nv::perf::test
\ No newline at end of file
@@ -283,6 +283,169 @@ namespace nv { namespace perf { namespace test {
         }
     }
 
+    // Runs real periodic sampler ranges through FrameLevelSampleCombiner's batched path and checks the combined frames against the
+    // per-sample hybrid CounterDataCombiner::SumIntoRange(), with frame boundaries placed in the middle of samples to exercise the weighted path.
+    NVPW_TEST_CASE("FrameLevelSampleCombiner")
+    {
+        const size_t deviceIndex = GetCompatibleGpuDeviceIndex();
+        if (deviceIndex == size_t(~0))
+        {
+            NVPW_TEST_MESSAGE("Current device is unsupported, test is skipped.");
+            return;
+        }
+        const DeviceIdentifiers deviceIdentifiers = GetDeviceIdentifiers(deviceIndex);
+
+        const std::array<const char*, 2> metrics = {
+            "gr__cycles_active.sum",
+            "gr__cycles_elapsed.max"
+        };
+
+        MetricsEvaluator metricsEvaluator;
+        {
+            std::vector<uint8_t> metricsEvaluatorScratchBuffer;
+            NVPW_MetricsEvaluator* pMetricsEvaluator = DeviceCreateMetricsEvaluator(metricsEvaluatorScratchBuffer, deviceIdentifiers.pChipName);
+            NVPW_REQUIRE(pMetricsEvaluator);
+            metricsEvaluator = MetricsEvaluator(pMetricsEvaluator, std::move(metricsEvaluatorScratchBuffer)); // transfer ownership to metricsEvaluator
+        }
+
+        std::vector<NVPW_MetricEvalRequest> metricEvalRequests;
+        for (size_t ii = 0; ii < metrics.size(); ++ii)
+        {
+            NVPW_MetricEvalRequest request;
+            NVPW_REQUIRE(ToMetricEvalRequest(metricsEvaluator, metrics[ii], request));
+            metricEvalRequests.push_back(request);
+        }
+
+        CounterConfiguration configuration;
+        {
+            NVPA_RawMetricsConfig* pRawMetricsConfig = DeviceCreateRawMetricsConfig(deviceIdentifiers.pChipName);
+            NVPW_REQUIRE(pRawMetricsConfig);
+
+            MetricsConfigBuilder configBuilder;
+            NVPW_REQUIRE(configBuilder.Initialize(metricsEvaluator, pRawMetricsConfig, deviceIdentifiers.pChipName));
+            NVPW_REQUIRE(configBuilder.AddMetrics(metricEvalRequests.data(), metricEvalRequests.size()));
+            NVPW_REQUIRE(nv::perf::CreateConfiguration(configBuilder, configuration));
+            NVPW_REQUIRE(configuration.numPasses == 1u);
+        }
+
+        const size_t MaxNumUndecodedSamplingRanges = 1;
+        const size_t NumTriggers = 64;
+        size_t recordBufferSize = 0;
+        NVPW_REQUIRE(GpuPeriodicSamplerCalculateRecordBufferSize(deviceIndex, configuration.configImage, NumTriggers, recordBufferSize));
+
+        std::vector<uint8_t> counterDataImage;
+        NVPW_REQUIRE(GpuPeriodicSamplerCreateCounterData(deviceIndex, configuration.counterDataPrefix.data(), configuration.counterDataPrefix.size(), NumTriggers, NVPW_PERIODIC_SAMPLER_COUNTER_DATA_APPEND_MODE_LINEAR, counterDataImage));
+
+        GpuPeriodicSampler sampler;
+        NVPW_REQUIRE(sampler.Initialize(deviceIndex));
+        NVPW_REQUIRE(sampler.BeginSession(recordBufferSize, MaxNumUndecodedSamplingRanges, { NVPW_GPU_PERIODIC_SAMPLER_TRIGGER_SOURCE_CPU_SYSCALL }, 0));
+        NVPW_REQUIRE(sampler.SetConfig(configuration.configImage, 0));
+        NVPW_REQUIRE(sampler.StartSampling());
+        for (size_t ii = 0; ii < NumTriggers; ++ii)
+        {
+            sampler.CpuTrigger();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        NVPW_REQUIRE(sampler.StopSampling());
+        {
+            size_t numSamplingRangesDecoded = 0;
+            bool overflow = false;
+            size_t numSamplesDropped = 0;
+            size_t numSamplesMerged = 0;
+            NVPW_REQUIRE(sampler.DecodeCounters(counterDataImage, 1, numSamplingRangesDecoded, overflow, numSamplesDropped, numSamplesMerged));
+            NVPW_REQUIRE(!overflow);
+        }
+        const size_t numRanges = CounterDataGetNumRanges(counterDataImage.data());
+        NVPW_REQUIRE(numRanges == NumTriggers);
+        NVPW_REQUIRE(MetricsEvaluatorSetDeviceAttributes(metricsEvaluator, counterDataImage.data(), counterDataImage.size()));
+
+        std::vector<SampleTimestamp> sampleTimes(numRanges);
+        for (size_t rangeIndex = 0; rangeIndex < numRanges; ++rangeIndex)
+        {
+            NVPW_REQUIRE(CounterDataGetSampleTime(counterDataImage.data(), rangeIndex, sampleTimes[rangeIndex]));
+        }
+        // frames end in the middle of every 5th sample, the final frame ends after the last sample
+        std::vector<uint64_t> frameEndTimes;
+        for (size_t rangeIndex = 4; rangeIndex < numRanges; rangeIndex += 5)
+        {
+            frameEndTimes.push_back(sampleTimes[rangeIndex].start + (sampleTimes[rangeIndex].end - sampleTimes[rangeIndex].start) / 2);
+        }
+        frameEndTimes.push_back(sampleTimes.back().end);
+
+        // reference: one hybrid SumIntoRange() call per overlapping sample
+        CounterDataCombiner referenceCombiner;
+        NVPW_REQUIRE(referenceCombiner.Initialize(configuration.counterDataPrefix.data(), configuration.counterDataPrefix.size(), (uint32_t)frameEndTimes.size(), counterDataImage.data()));
+        const auto referenceBegin = std::chrono::steady_clock::now();
+        {
+            uint64_t frameBeginTime = 0;
+            for (size_t frameIdx = 0; frameIdx < frameEndTimes.size(); ++frameIdx)
+            {
+                const uint64_t frameEndTime = frameEndTimes[frameIdx];
+                size_t rangeIndexDst = 0;
+                NVPW_REQUIRE(referenceCombiner.CreateRange(rangeIndexDst));
+                NVPW_REQUIRE(rangeIndexDst == frameIdx);
+                for (size_t rangeIndex = 0; rangeIndex < numRanges; ++rangeIndex)
+                {
+                    const SampleTimestamp& sampleTime = sampleTimes[rangeIndex];
+                    if (sampleTime.end <= frameBeginTime || sampleTime.start >= frameEndTime)
+                    {
+                        continue;
+                    }
+                    NVPW_REQUIRE(referenceCombiner.SumIntoRange(rangeIndexDst, counterDataImage.data(), rangeIndex, sampleTime.start, sampleTime.end, frameBeginTime, frameEndTime));
+                }
+                frameBeginTime = frameEndTime;
+            }
+        }
+        const auto referenceEnd = std::chrono::steady_clock::now();
+
+        FrameLevelSampleCombiner frameCombiner;
+        NVPW_REQUIRE(frameCombiner.Initialize(configuration.counterDataPrefix, counterDataImage, numRanges));
+        for (size_t rangeIndex = 0; rangeIndex < numRanges; ++rangeIndex)
+        {
+            NVPW_REQUIRE(frameCombiner.AddSample(counterDataImage.data(), counterDataImage.size(), (uint32_t)rangeIndex));
+        }
+        std::chrono::steady_clock::duration batchedDuration{};
+        std::vector<double> metricValues(metricEvalRequests.size());
+        std::vector<double> referenceMetricValues(metricEvalRequests.size());
+        size_t totalSamplesInFrames = 0;
+        for (size_t frameIdx = 0; frameIdx < frameEndTimes.size(); ++frameIdx)
+        {
+            FrameLevelSampleCombiner::FrameInfo frameInfo{};
+            const auto batchedBegin = std::chrono::steady_clock::now();
+            NVPW_REQUIRE(frameCombiner.GetCombinedSamples(frameEndTimes[frameIdx], frameInfo));
+            batchedDuration += std::chrono::steady_clock::now() - batchedBegin;
+            totalSamplesInFrames += frameInfo.numSamplesInFrame;
+
+            NVPW_REQUIRE(EvaluateToGpuValues(
+                metricsEvaluator,
+                frameInfo.pCombinedCounterData,
+                frameInfo.combinedCounterDataSize,
+                frameInfo.combinedCounterDataRangeIndex,
+                metricEvalRequests.size(),
+                metricEvalRequests.data(),
+                metricValues.data()));
+            NVPW_REQUIRE(EvaluateToGpuValues(
+                metricsEvaluator,
+                referenceCombiner.GetCounterData().data(),
+                referenceCombiner.GetCounterData().size(),
+                frameIdx,
+                metricEvalRequests.size(),
+                metricEvalRequests.data(),
+                referenceMetricValues.data()));
+            for (size_t metricIdx = 0; metricIdx < metricValues.size(); ++metricIdx)
+            {
+                NVPW_CHECK(metricValues[metricIdx] == doctest::Approx(referenceMetricValues[metricIdx]));
+            }
+        }
+        // every sample but the straddling ones is counted exactly once, straddling samples contribute to two frames
+        NVPW_CHECK(totalSamplesInFrames == numRanges + frameEndTimes.size() - 1);
+
+        const auto toNs = [](std::chrono::steady_clock::duration duration) {
+            return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+        };
+        NVPW_TEST_MESSAGE("samples: ", numRanges, ", per-sample: ", toNs(referenceEnd - referenceBegin) / numRanges, " ns/sample, batched: ", toNs(batchedDuration) / numRanges, " ns/sample");
+    }
+
     NVPW_TEST_SUITE_END();
 
 }}} // namespace nv::perf::test
\ No newline at end of file
@@ -0,0 +1 @@
+#include <NvPerfCompressedReportDefinition.h>
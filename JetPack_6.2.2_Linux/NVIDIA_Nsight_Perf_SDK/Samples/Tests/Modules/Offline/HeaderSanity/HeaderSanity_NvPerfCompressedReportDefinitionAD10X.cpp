@@ -0,0 +1 @@
+#include <NvPerfCompressedReportDefinitionAD10X.h>
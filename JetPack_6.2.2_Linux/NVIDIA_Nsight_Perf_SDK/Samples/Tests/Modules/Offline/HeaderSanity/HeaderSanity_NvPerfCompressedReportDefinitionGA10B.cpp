@@ -0,0 +1 @@
+#include <NvPerfCompressedReportDefinitionGA10B.h>
@@ -0,0 +1 @@
+#include <NvPerfCompressedReportDefinitionGA10X.h>
@@ -0,0 +1 @@
+#include <NvPerfCompressedReportDefinitionTU10X.h>
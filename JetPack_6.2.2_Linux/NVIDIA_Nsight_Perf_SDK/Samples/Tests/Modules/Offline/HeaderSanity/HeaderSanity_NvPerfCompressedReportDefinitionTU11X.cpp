@@ -0,0 +1 @@
+#include <NvPerfCompressedReportDefinitionTU11X.h>
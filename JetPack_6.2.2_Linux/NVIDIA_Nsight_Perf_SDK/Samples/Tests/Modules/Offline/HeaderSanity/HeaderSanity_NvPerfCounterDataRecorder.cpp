@@ -0,0 +1 @@
+#include <NvPerfCounterDataRecorder.h>
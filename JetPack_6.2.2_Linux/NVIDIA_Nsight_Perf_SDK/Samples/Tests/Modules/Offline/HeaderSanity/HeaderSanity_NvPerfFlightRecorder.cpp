@@ -0,0 +1 @@
+#include <NvPerfFlightRecorder.h>
@@ -0,0 +1 @@
+#include <NvPerfHash.h>
@@ -0,0 +1 @@
+#include <NvPerfJsonWriter.h>
@@ -0,0 +1 @@
+#include <NvPerfLz4.h>
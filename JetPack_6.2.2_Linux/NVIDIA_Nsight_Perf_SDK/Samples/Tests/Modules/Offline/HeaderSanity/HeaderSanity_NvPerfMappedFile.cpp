@@ -0,0 +1 @@
+#include <NvPerfMappedFile.h>
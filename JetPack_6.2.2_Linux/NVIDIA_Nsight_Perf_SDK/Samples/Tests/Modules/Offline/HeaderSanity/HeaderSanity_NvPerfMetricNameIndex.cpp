@@ -0,0 +1 @@
+#include <NvPerfMetricNameIndex.h>
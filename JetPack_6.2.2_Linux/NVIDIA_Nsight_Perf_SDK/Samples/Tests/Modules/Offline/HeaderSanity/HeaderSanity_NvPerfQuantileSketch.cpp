@@ -0,0 +1 @@
+#include <NvPerfQuantileSketch.h>
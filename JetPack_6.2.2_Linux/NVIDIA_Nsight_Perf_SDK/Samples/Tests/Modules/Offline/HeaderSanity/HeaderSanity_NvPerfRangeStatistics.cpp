@@ -0,0 +1 @@
+#include <NvPerfRangeStatistics.h>
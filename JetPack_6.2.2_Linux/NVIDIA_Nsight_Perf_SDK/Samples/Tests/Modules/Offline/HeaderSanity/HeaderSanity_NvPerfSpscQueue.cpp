@@ -0,0 +1 @@
+#include <NvPerfSpscQueue.h>
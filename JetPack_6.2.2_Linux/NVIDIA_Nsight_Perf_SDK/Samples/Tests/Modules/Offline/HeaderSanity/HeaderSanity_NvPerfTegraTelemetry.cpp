@@ -0,0 +1 @@
+#include <NvPerfTegraTelemetry.h>
\ No newline at end of file
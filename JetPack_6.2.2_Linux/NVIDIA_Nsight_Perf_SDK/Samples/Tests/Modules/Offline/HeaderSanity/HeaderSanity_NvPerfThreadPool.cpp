@@ -0,0 +1 @@
+#include <NvPerfThreadPool.h>
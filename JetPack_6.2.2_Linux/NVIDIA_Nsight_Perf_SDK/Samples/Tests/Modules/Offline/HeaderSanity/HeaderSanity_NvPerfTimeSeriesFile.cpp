@@ -0,0 +1 @@
+#include <NvPerfTimeSeriesFile.h>
@@ -0,0 +1,168 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include <stdint.h>
+#include <string.h>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include <doctest_proxy.h>
+#include "NvPerfLz4.h"
+#include "NvPerfCompressedReportDefinitionTU10X.h"
+#include "NvPerfCompressedReportDefinitionTU11X.h"
+#include "NvPerfCompressedReportDefinitionGA10X.h"
+#include "NvPerfCompressedReportDefinitionGA10B.h"
+#include "NvPerfCompressedReportDefinitionAD10X.h"
+#include "NvPerfReportDefinitionTU10X.h"
+#include "NvPerfReportDefinitionTU11X.h"
+#include "NvPerfReportDefinitionGA10X.h"
+#include "NvPerfReportDefinitionGA10B.h"
+#include "NvPerfReportDefinitionAD10X.h"
+
+namespace nv { namespace perf { namespace test {
+
+    NVPW_TEST_SUITE_BEGIN("CompressedReportDefinition");
+
+    NVPW_TEST_CASE("Lz4")
+    {
+        auto roundTrip = [](const std::vector<uint8_t>& data) {
+            const std::vector<uint8_t> compressed = Lz4CompressBlock(data.data(), data.size());
+            std::vector<uint8_t> decompressed(data.size());
+            return Lz4DecompressBlock(compressed.data(), compressed.size(), decompressed.data(), decompressed.size()) && decompressed == data;
+        };
+
+        NVPW_SUBCASE("RoundTrip")
+        {
+            std::mt19937 rng(7);
+            // short inputs exercise the end-of-block rules, long ones the 64 KB window and the extended lengths
+            for (size_t size = 0; size < 64; ++size)
+            {
+                std::vector<uint8_t> data(size);
+                for (uint8_t& byte : data)
+                {
+                    byte = static_cast<uint8_t>(rng() % 3);
+                }
+                NVPW_CHECK(roundTrip(data));
+            }
+            for (size_t alphabetSize : { 1, 2, 16, 256 })
+            {
+                std::vector<uint8_t> data(200000);
+                for (uint8_t& byte : data)
+                {
+                    byte = static_cast<uint8_t>(rng() % alphabetSize);
+                }
+                NVPW_CHECK(roundTrip(data));
+            }
+        }
+
+        NVPW_SUBCASE("Ratio")
+        {
+            const std::vector<uint8_t> zeros(100000);
+            NVPW_CHECK_LT(Lz4CompressBlock(zeros.data(), zeros.size()).size(), zeros.size() / 200);
+        }
+
+        NVPW_SUBCASE("Malformed")
+        {
+            const char* pText = "abcabcabcabcabcabcabcabcabcabcabcabc, abcabcabcabcabcabcabcabcabcabcabcabc";
+            const std::vector<uint8_t> data(pText, pText + strlen(pText));
+            const std::vector<uint8_t> compressed = Lz4CompressBlock(data.data(), data.size());
+            std::vector<uint8_t> decompressed(data.size() + 1);
+            NVPW_REQUIRE(Lz4DecompressBlock(compressed.data(), compressed.size(), decompressed.data(), data.size()));
+            NVPW_CHECK(!Lz4DecompressBlock(compressed.data(), compressed.size(), decompressed.data(), data.size() - 1));
+            NVPW_CHECK(!Lz4DecompressBlock(compressed.data(), compressed.size(), decompressed.data(), data.size() + 1));
+            for (size_t size = 0; size < compressed.size(); ++size)
+            {
+                NVPW_CHECK(!Lz4DecompressBlock(compressed.data(), size, decompressed.data(), data.size()));
+            }
+            // a match that reaches back before the start of the output
+            const uint8_t badOffset[] = { 0x10, 'a', 0x02, 0x00, 0x00 };
+            NVPW_CHECK(!Lz4DecompressBlock(badOffset, sizeof(badOffset), decompressed.data(), 5));
+        }
+    }
+
+    NVPW_TEST_CASE("MatchesUncompressed")
+    {
+        auto checkEqual = [](ReportDefinition (*getCompressedReportDefinition)(), const ReportDefinition& uncompressed) {
+            const ReportDefinition compressed = getCompressedReportDefinition();
+            NVPW_REQUIRE(compressed.pReportHtml);
+            NVPW_CHECK_EQ(strcmp(compressed.pReportHtml, uncompressed.pReportHtml), 0);
+            NVPW_REQUIRE_EQ(compressed.numCounters, uncompressed.numCounters);
+            NVPW_REQUIRE_EQ(compressed.numRatios, uncompressed.numRatios);
+            NVPW_REQUIRE_EQ(compressed.numThroughputs, uncompressed.numThroughputs);
+            for (size_t ii = 0; ii < compressed.numCounters; ++ii)
+            {
+                NVPW_CHECK_EQ(compressed.ppCounterNames[ii], uncompressed.ppCounterNames[ii]);
+            }
+            for (size_t ii = 0; ii < compressed.numRatios; ++ii)
+            {
+                NVPW_CHECK_EQ(compressed.ppRatioNames[ii], uncompressed.ppRatioNames[ii]);
+            }
+            for (size_t ii = 0; ii < compressed.numThroughputs; ++ii)
+            {
+                NVPW_CHECK_EQ(compressed.ppThroughputNames[ii], uncompressed.ppThroughputNames[ii]);
+            }
+            // decompressed once, then cached
+            NVPW_CHECK_EQ((const void*)getCompressedReportDefinition().pReportHtml, (const void*)compressed.pReportHtml);
+        };
+
+        NVPW_SUBCASE("TU10X")
+        {
+            checkEqual(compressed::tu10x::PerRangeReport::GetReportDefinition, tu10x::PerRangeReport::GetReportDefinition());
+            checkEqual(compressed::tu10x::SummaryReport::GetReportDefinition, tu10x::SummaryReport::GetReportDefinition());
+        }
+        NVPW_SUBCASE("TU11X")
+        {
+            checkEqual(compressed::tu11x::PerRangeReport::GetReportDefinition, tu11x::PerRangeReport::GetReportDefinition());
+            checkEqual(compressed::tu11x::SummaryReport::GetReportDefinition, tu11x::SummaryReport::GetReportDefinition());
+        }
+        NVPW_SUBCASE("GA10X")
+        {
+            checkEqual(compressed::ga10x::PerRangeReport::GetReportDefinition, ga10x::PerRangeReport::GetReportDefinition());
+            checkEqual(compressed::ga10x::SummaryReport::GetReportDefinition, ga10x::SummaryReport::GetReportDefinition());
+        }
+        NVPW_SUBCASE("GA10B")
+        {
+            checkEqual(compressed::ga10b::PerRangeReport::GetReportDefinition, ga10b::PerRangeReport::GetReportDefinition());
+            checkEqual(compressed::ga10b::SummaryReport::GetReportDefinition, ga10b::SummaryReport::GetReportDefinition());
+        }
+        NVPW_SUBCASE("AD10X")
+        {
+            checkEqual(compressed::ad10x::PerRangeReport::GetReportDefinition, ad10x::PerRangeReport::GetReportDefinition());
+            checkEqual(compressed::ad10x::SummaryReport::GetReportDefinition, ad10x::SummaryReport::GetReportDefinition());
+        }
+    }
+
+    // The cost that compression adds to the first report of a process: decompressing one chip family's definitions.
+    NVPW_TEST_CASE("Decompression Benchmark")
+    {
+        const ReportDefinition definitions[] = { ga10b::PerRangeReport::GetReportDefinition(), ga10b::SummaryReport::GetReportDefinition() };
+        for (const ReportDefinition& definition : definitions)
+        {
+            const size_t size = strlen(definition.pReportHtml) + 1;
+            const std::vector<uint8_t> compressed = Lz4CompressBlock(reinterpret_cast<const uint8_t*>(definition.pReportHtml), size);
+            std::vector<uint8_t> decompressed(size);
+            const auto begin = std::chrono::steady_clock::now();
+            NVPW_REQUIRE(Lz4DecompressBlock(compressed.data(), compressed.size(), decompressed.data(), decompressed.size()));
+            const auto end = std::chrono::steady_clock::now();
+            NVPW_CHECK_EQ(memcmp(decompressed.data(), definition.pReportHtml, size), 0);
+            NVPW_TEST_MESSAGE(std::to_string(size), " -> ", std::to_string(compressed.size()), " bytes, decompressed in ", std::chrono::duration<double, std::micro>(end - begin).count(), " us");
+        }
+    }
+
+    NVPW_TEST_SUITE_END();
+
+}}} // nv::perf::test
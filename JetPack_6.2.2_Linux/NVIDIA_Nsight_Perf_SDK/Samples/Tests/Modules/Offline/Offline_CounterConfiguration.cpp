@@ -0,0 +1,215 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <doctest_proxy.h>
+#include "NvPerfCounterConfiguration.h"
+#include "NvPerfReportGeneratorVulkan.h"
+#include "Offline.h"
+#include "Offline_HudDataModel_SupportedChips.h"
+
+namespace nv { namespace perf { namespace test {
+
+    NVPW_TEST_SUITE_BEGIN("CounterConfiguration");
+
+    static NVPW_MetricEvalRequest MakeMetricEvalRequest(size_t metricIndex, uint8_t metricType, uint16_t submetric)
+    {
+        NVPW_MetricEvalRequest request{};
+        request.metricIndex = metricIndex;
+        request.metricType = metricType;
+        request.rollupOp = NVPW_ROLLUP_OP_AVG;
+        request.submetric = submetric;
+        return request;
+    }
+
+    static CounterConfiguration MakeCounterConfiguration(uint8_t seed)
+    {
+        CounterConfiguration configuration;
+        for (size_t index = 0; index < 1000; ++index)
+        {
+            configuration.configImage.push_back(uint8_t(seed + index));
+        }
+        for (size_t index = 0; index < 300; ++index)
+        {
+            configuration.counterDataPrefix.push_back(uint8_t(seed * index));
+        }
+        configuration.numPasses = seed;
+        return configuration;
+    }
+
+    NVPW_TEST_CASE("CounterConfigurationCache")
+    {
+        const std::vector<NVPW_MetricEvalRequest> requests = {
+            MakeMetricEvalRequest(3, NVPW_METRIC_TYPE_COUNTER, NVPW_SUBMETRIC_NONE),
+            MakeMetricEvalRequest(1, NVPW_METRIC_TYPE_RATIO, NVPW_SUBMETRIC_PCT),
+            MakeMetricEvalRequest(1, NVPW_METRIC_TYPE_COUNTER, NVPW_SUBMETRIC_PER_SECOND),
+        };
+        const std::string key = CounterConfigurationCache::MakeKey("GA10B", "Test", requests.data(), requests.size());
+
+        NVPW_SUBCASE("Key")
+        {
+            const std::vector<NVPW_MetricEvalRequest> reordered = { requests[2], requests[0], requests[1], requests[0] };
+            NVPW_CHECK(CounterConfigurationCache::MakeKey("GA10B", "Test", reordered.data(), reordered.size()) == key);
+            NVPW_CHECK(CounterConfigurationCache::MakeKey("GA10B", "Test", requests.data(), 2) != key);
+            NVPW_CHECK(CounterConfigurationCache::MakeKey("GA10B", "Other", requests.data(), requests.size()) != key);
+            NVPW_CHECK(CounterConfigurationCache::MakeKey("AD102", "Test", requests.data(), requests.size()) != key);
+
+            const CounterConfigurationCache cache("cache/");
+            const std::string path = cache.GetEntryPath(key);
+            NVPW_CHECK(path.find("cache/GA10B_") == 0);
+            NVPW_CHECK(path.size() == strlen("cache/GA10B_0123456789abcdef.nvpwconfig"));
+        }
+
+        NVPW_SUBCASE("Round Trip")
+        {
+            const CounterConfigurationCache cache(".");
+            const CounterConfiguration stored = MakeCounterConfiguration(7);
+            CounterConfiguration loaded;
+            std::remove(cache.GetEntryPath(key).c_str());
+            NVPW_CHECK(!cache.Find(key, loaded));
+            NVPW_REQUIRE(cache.Store(key, stored));
+            NVPW_REQUIRE(cache.Find(key, loaded));
+            NVPW_CHECK(loaded.configImage == stored.configImage);
+            NVPW_CHECK(loaded.counterDataPrefix == stored.counterDataPrefix);
+            NVPW_CHECK(loaded.numPasses == stored.numPasses);
+
+            // overwriting an existing entry
+            const CounterConfiguration restored = MakeCounterConfiguration(9);
+            NVPW_REQUIRE(cache.Store(key, restored));
+            NVPW_REQUIRE(cache.Find(key, loaded));
+            NVPW_CHECK(loaded.configImage == restored.configImage);
+            std::remove(cache.GetEntryPath(key).c_str());
+        }
+
+        NVPW_SUBCASE("Disabled")
+        {
+            const CounterConfigurationCache cache;
+            CounterConfiguration loaded;
+            NVPW_CHECK(!cache.IsEnabled());
+            NVPW_CHECK(!cache.Store(key, MakeCounterConfiguration(7)));
+            NVPW_CHECK(!cache.Find(key, loaded));
+        }
+
+        NVPW_SUBCASE("Corrupt Entry")
+        {
+            const CounterConfigurationCache cache(".");
+            const std::string path = cache.GetEntryPath(key);
+            NVPW_REQUIRE(cache.Store(key, MakeCounterConfiguration(7)));
+            std::vector<uint8_t> contents;
+            if (FILE* pFile = OpenFile(path.c_str(), "rb"))
+            {
+                int c;
+                while ((c = fgetc(pFile)) != EOF)
+                {
+                    contents.push_back((uint8_t)c);
+                }
+                fclose(pFile);
+            }
+            NVPW_REQUIRE(contents.size() > sizeof(CounterConfigurationCacheEntryHeader) + key.size());
+            auto writeContents = [&](const std::vector<uint8_t>& data) {
+                FILE* pFile = OpenFile(path.c_str(), "wb");
+                NVPW_REQUIRE(pFile);
+                fwrite(data.data(), 1, data.size(), pFile);
+                fclose(pFile);
+            };
+
+            CounterConfiguration loaded;
+            std::vector<uint8_t> flipped = contents;
+            flipped.back() ^= 1;
+            writeContents(flipped);
+            NVPW_CHECK(!cache.Find(key, loaded));
+
+            writeContents(std::vector<uint8_t>(contents.begin(), contents.end() - 1));
+            NVPW_CHECK(!cache.Find(key, loaded));
+
+            std::vector<uint8_t> extended = contents;
+            extended.push_back(0);
+            writeContents(extended);
+            NVPW_CHECK(!cache.Find(key, loaded));
+
+            std::vector<uint8_t> otherVersion = contents;
+            otherVersion[offsetof(CounterConfigurationCacheEntryHeader, sdkVersion)] ^= 1;
+            writeContents(otherVersion);
+            NVPW_CHECK(!cache.Find(key, loaded));
+
+            // an entry of another key whose hash collides
+            const std::string otherKey = CounterConfigurationCache::MakeKey("GA10B", "Test", requests.data(), 2);
+            NVPW_REQUIRE(cache.Store(otherKey, MakeCounterConfiguration(7)));
+            std::remove(path.c_str());
+            NVPW_REQUIRE(!std::rename(cache.GetEntryPath(otherKey).c_str(), path.c_str()));
+            NVPW_CHECK(!cache.Find(key, loaded));
+
+            writeContents(contents);
+            NVPW_CHECK(cache.Find(key, loaded));
+            std::remove(path.c_str());
+        }
+    }
+
+    NVPW_TEST_CASE("CreateConfiguration with CounterConfigurationCache")
+    {
+        const CounterConfigurationCache cache(".");
+        for (const char* pChipName : supportedChips)
+        {
+            NVPW_INFO("pChipName: ", pChipName); // this will only get printed if any of the below checks failed
+            MetricsEvaluator metricsEvaluator = CreateMetricsEvaluator(pChipName);
+
+            ReportLayout reportLayout;
+            reportLayout.perRange.definition = PerRangeReport::GetReportDefinition(pChipName);
+            NVPW_REQUIRE(reportLayout.perRange.definition.pReportHtml);
+            PerRangeReport::InitReportDataMetrics(metricsEvaluator, {}, reportLayout);
+            std::vector<NVPW_MetricEvalRequest> metricEvalRequests;
+            ForEachBaseMetric(reportLayout.perRange.baseMetricRequests, reportLayout.perRange.submetricRequests, [&](const NVPW_MetricEvalRequest* pMetricEvalRequests, size_t numMetricEvalRequests) {
+                metricEvalRequests.insert(metricEvalRequests.end(), pMetricEvalRequests, pMetricEvalRequests + numMetricEvalRequests);
+                return true;
+            });
+            NVPW_REQUIRE(!metricEvalRequests.empty());
+
+            size_t numBuilderInitializations = 0;
+            auto initializeConfigBuilder = [&](MetricsConfigBuilder& configBuilder) {
+                ++numBuilderInitializations;
+                NVPA_RawMetricsConfig* pRawMetricsConfig = profiler::VulkanCreateRawMetricsConfig(pChipName);
+                return pRawMetricsConfig && configBuilder.Initialize(metricsEvaluator, pRawMetricsConfig, pChipName);
+            };
+            const std::string key = CounterConfigurationCache::MakeKey(pChipName, profiler::ReportGeneratorVulkan::GetCounterConfigurationKind(), metricEvalRequests.data(), metricEvalRequests.size());
+            std::remove(cache.GetEntryPath(key).c_str());
+
+            CounterConfiguration scheduled;
+            auto startTime = std::chrono::steady_clock::now();
+            NVPW_REQUIRE(CreateConfiguration(cache, pChipName, profiler::ReportGeneratorVulkan::GetCounterConfigurationKind(), metricEvalRequests.data(), metricEvalRequests.size(), initializeConfigBuilder, scheduled));
+            const double scheduledMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+            NVPW_CHECK(numBuilderInitializations == 1);
+
+            CounterConfiguration cached;
+            startTime = std::chrono::steady_clock::now();
+            NVPW_REQUIRE(CreateConfiguration(cache, pChipName, profiler::ReportGeneratorVulkan::GetCounterConfigurationKind(), metricEvalRequests.data(), metricEvalRequests.size(), initializeConfigBuilder, cached));
+            const double cachedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+            NVPW_CHECK(numBuilderInitializations == 1);
+            NVPW_CHECK(cached.configImage == scheduled.configImage);
+            NVPW_CHECK(cached.counterDataPrefix == scheduled.counterDataPrefix);
+            NVPW_CHECK(cached.numPasses == scheduled.numPasses);
+            NVPW_TEST_MESSAGE(pChipName, ": scheduled in ", scheduledMs, " ms, loaded from the cache in ", cachedMs, " ms");
+            std::remove(cache.GetEntryPath(key).c_str());
+        }
+    }
+
+    NVPW_TEST_SUITE_END();
+
+}}} // nv::perf::test
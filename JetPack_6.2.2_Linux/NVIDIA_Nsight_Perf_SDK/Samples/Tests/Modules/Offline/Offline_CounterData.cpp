@@ -17,7 +17,10 @@
 #include "Offline.h"
 #include <functional>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <string>
+#include <thread>
 #include <NvPerfCounterData.h>
 #include <NvPerfPeriodicSamplerGpu.h>
 
@@ -25,11 +28,9 @@ namespace nv { namespace perf { namespace test {
 
     NVPW_TEST_SUITE_BEGIN("CounterData");
 
-    NVPW_TEST_CASE("RingBuffer")
-    {
-        using namespace nv::perf::sampler;
+    namespace {
 
-        struct RingBufferCounterDataTest : public RingBufferCounterData
+        struct RingBufferCounterDataTest : public sampler::RingBufferCounterData
         {
             const uint32_t FirstTrigger = 8;
             std::vector<uint32_t> triggerCountRingBuffer; // one for each range
@@ -78,7 +79,11 @@ namespace nv { namespace perf { namespace test {
                 return true;
             }
         };
-        
+
+    } // namespace
+
+    NVPW_TEST_CASE("RingBuffer")
+    {
         RingBufferCounterDataTest counterData;
         NVPW_REQUIRE(counterData.Initialize(10));
 
@@ -183,6 +188,182 @@ namespace nv { namespace perf { namespace test {
                 NVPW_CHECK(!counterData.UpdatePut()); // put has beaten get for one round
             }
         }
+
+        NVPW_SUBCASE("PublishCompletedRanges")
+        {
+            std::vector<uint32_t> publishedRanges;
+            auto publishAll = [&](uint32_t rangeIndex) {
+                publishedRanges.push_back(rangeIndex);
+                return true;
+            };
+            NVPW_CHECK(counterData.GetNumUnpublishedRanges() == 0);
+            NVPW_CHECK(counterData.PublishCompletedRanges(publishAll) == 0);
+
+            counterData.PopulateTriggers(3, 4); // numCompletedRanges = 3; numPopulatedRanges = 4
+            NVPW_CHECK(counterData.UpdatePut());
+            NVPW_CHECK(counterData.GetNumUnpublishedRanges() == 3);
+
+            // the receiver can only take 2
+            NVPW_CHECK(counterData.PublishCompletedRanges([&](uint32_t rangeIndex) {
+                if (publishedRanges.size() == 2)
+                {
+                    return false;
+                }
+                publishedRanges.push_back(rangeIndex);
+                return true;
+            }) == 2);
+            NVPW_CHECK(publishedRanges == std::vector<uint32_t>({ 0, 1 }));
+            NVPW_CHECK(counterData.GetNumUnpublishedRanges() == 1);
+            NVPW_CHECK(counterData.GetNumUnreadRanges() == 3); // publishing is independent from GET
+
+            NVPW_CHECK(counterData.PublishCompletedRanges(publishAll) == 1);
+            NVPW_CHECK(publishedRanges == std::vector<uint32_t>({ 0, 1, 2 }));
+            NVPW_CHECK(counterData.GetNumUnpublishedRanges() == 0);
+
+            // wrap around
+            publishedRanges.clear();
+            counterData.PopulateTriggers(8, 9); // numCompletedRanges = 1; numPopulatedRanges = 3
+            NVPW_CHECK(counterData.UpdatePut());
+            NVPW_CHECK(counterData.GetNumUnpublishedRanges() == 8);
+            NVPW_CHECK(counterData.PublishCompletedRanges(publishAll) == 8);
+            NVPW_CHECK(publishedRanges == std::vector<uint32_t>({ 3, 4, 5, 6, 7, 8, 9, 0 }));
+            NVPW_CHECK(counterData.GetNumUnpublishedRanges() == 0);
+        }
+    }
+
+    NVPW_TEST_CASE("RingBufferBackgroundDecoder")
+    {
+        const uint32_t NumTotalRanges = 16;
+        RingBufferCounterDataTest counterData;
+        NVPW_REQUIRE(counterData.Initialize(NumTotalRanges));
+        sampler::RingBufferBackgroundDecoder decoder;
+
+        NVPW_SUBCASE("Slow Consumer")
+        {
+            // Models a GPU that produces "SamplesPerDecodeInterval" samples per decode interval into a record buffer holding at most
+            // "NumTotalRanges" samples, further samples are dropped. The decode intervals are stepped on this thread, so the interleaving of
+            // decodes and consumes is the same on every run.
+            const size_t SamplesPerDecodeInterval = 2;
+            size_t numPendingSamples = 0;
+            std::vector<bool> isOutstanding(NumTotalRanges, false);
+            size_t numOverwrittenRanges = 0;
+            auto getMaxNumRangesToDecode = [&]() {
+                numPendingSamples = std::min(numPendingSamples + SamplesPerDecodeInterval, (size_t)NumTotalRanges);
+                return numPendingSamples;
+            };
+            auto decode = [&]() {
+                const uint32_t numSamples = (uint32_t)numPendingSamples;
+                uint32_t rangeIndex = counterData.numPopulatedRanges;
+                for (uint32_t ii = 0; ii < numSamples; ++ii)
+                {
+                    if (rangeIndex == NumTotalRanges)
+                    {
+                        rangeIndex = 0;
+                    }
+                    if (isOutstanding[rangeIndex])
+                    {
+                        ++numOverwrittenRanges;
+                    }
+                    isOutstanding[rangeIndex] = true;
+                    ++rangeIndex;
+                }
+                counterData.PopulateTriggers(numSamples, numSamples);
+                numPendingSamples = 0;
+                return counterData.UpdatePut();
+            };
+            NVPW_REQUIRE(decoder.Initialize(counterData));
+
+            // takes at most one range every "DecodeIntervalsPerConsume" decode intervals, while the GPU model produces 8 samples meanwhile
+            const size_t DecodeIntervalsPerConsume = 4;
+            const size_t NumRangesToConsume = 64;
+            const size_t MaxNumDecodeIntervals = 2 * NumRangesToConsume * DecodeIntervalsPerConsume;
+            size_t numRangesConsumed = 0;
+            uint32_t lastTriggerCount = 0;
+            bool inOrder = true;
+            bool success = true;
+            for (size_t decodeInterval = 0; success && numRangesConsumed < NumRangesToConsume && decodeInterval < MaxNumDecodeIntervals; ++decodeInterval)
+            {
+                success = decoder.DecodeOnce(counterData, decode, getMaxNumRangesToDecode);
+                if (!success || (decodeInterval % DecodeIntervalsPerConsume))
+                {
+                    continue;
+                }
+                bool hasConsumedRange = false;
+                success = decoder.ConsumeRanges(counterData, [&](const uint8_t* pCounterDataImage, size_t counterDataImageSize, uint32_t rangeIndex, bool& stop) {
+                    if (hasConsumedRange)
+                    {
+                        stop = true;
+                        return true;
+                    }
+                    const uint32_t triggerCount = counterData.triggerCountRingBuffer[rangeIndex];
+                    inOrder &= (!numRangesConsumed || (triggerCount == lastTriggerCount + 1));
+                    lastTriggerCount = triggerCount;
+                    isOutstanding[rangeIndex] = false;
+                    hasConsumedRange = true;
+                    ++numRangesConsumed;
+                    return true;
+                });
+            }
+            NVPW_CHECK(success);
+            NVPW_CHECK(!decoder.HasFailed());
+            NVPW_CHECK(numRangesConsumed == NumRangesToConsume);
+            NVPW_CHECK(inOrder);
+            NVPW_CHECK(numOverwrittenRanges == 0);
+            NVPW_CHECK(decoder.GetNumDeferredDecodes() > 0);
+        }
+
+        NVPW_SUBCASE("Consume During Decode")
+        {
+            // the decode blocks until released, so the consumer deterministically runs while it holds the counter data lock
+            NVPW_REQUIRE(decoder.Initialize(counterData));
+            std::atomic<bool> isDecoding(false);
+            std::atomic<bool> releaseDecode(false);
+            auto decode = [&]() {
+                counterData.PopulateTriggers(2, 2);
+                isDecoding.store(true);
+                while (!releaseDecode.load())
+                {
+                    std::this_thread::yield();
+                }
+                return counterData.UpdatePut();
+            };
+            auto getMaxNumRangesToDecode = []() { return size_t(2); };
+            std::thread decodeThread([&]() {
+                decoder.DecodeOnce(counterData, decode, getMaxNumRangesToDecode);
+            });
+            while (!isDecoding.load())
+            {
+                std::this_thread::yield();
+            }
+
+            std::vector<uint32_t> consumedRanges;
+            auto consume = [&](const uint8_t* pCounterDataImage, size_t counterDataImageSize, uint32_t rangeIndex, bool& stop) {
+                stop = false;
+                consumedRanges.push_back(rangeIndex);
+                return true;
+            };
+            NVPW_CHECK(decoder.ConsumeRanges(counterData, consume)); // returns right away rather than waiting for the decode
+            NVPW_CHECK(consumedRanges.empty());
+
+            releaseDecode.store(true);
+            decodeThread.join();
+            NVPW_CHECK(decoder.ConsumeRanges(counterData, consume));
+            NVPW_CHECK(consumedRanges == std::vector<uint32_t>({ 0, 1 }));
+        }
+
+        NVPW_SUBCASE("Decode Failure")
+        {
+            ScopedNvPerfLogDisabler logDisabler;
+            NVPW_REQUIRE(decoder.Start(counterData, std::chrono::microseconds(500), []() { return false; }, []() { return size_t(1); }));
+            for (size_t ii = 0; ii < 1000 && !decoder.HasFailed(); ++ii)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            NVPW_CHECK(decoder.HasFailed());
+            NVPW_CHECK(!decoder.ConsumeRanges(counterData, [](const uint8_t* pCounterDataImage, size_t counterDataImageSize, uint32_t rangeIndex, bool& stop) {
+                return true;
+            }));
+        }
     }
 
     NVPW_TEST_CASE("CounterDataCombiner")
@@ -205,6 +386,296 @@ namespace nv { namespace perf { namespace test {
         }
     }
 
+    namespace {
+
+        struct FrameLevelSampleCombinerTest : public sampler::FrameLevelSampleCombiner
+        {
+            // bypasses the combined counter data, which requires a counter data image generated on a GPU
+            void Initialize(size_t maxSampleLatency)
+            {
+                m_sampleInfoRingBuffer.resize(maxSampleLatency);
+                m_frameSamples.resize(maxSampleLatency);
+            }
+
+            bool AddSample(uint64_t beginTimestamp, uint64_t endTimestamp, uint32_t rangeIndex)
+            {
+                return PushSampleInfo(beginTimestamp, endTimestamp, nullptr, rangeIndex);
+            }
+
+            std::vector<CounterDataCombiner::WeightedSample> CollectFrame(uint64_t frameEndTime)
+            {
+                const size_t numFrameSamples = CollectFrameSamples(frameEndTime);
+                m_frameBeginTime = frameEndTime;
+                return std::vector<CounterDataCombiner::WeightedSample>(m_frameSamples.begin(), m_frameSamples.begin() + numFrameSamples);
+            }
+
+            // same as above, but without copying the samples out, for benchmarking
+            template <typename TConsumeFunc>
+            void CollectFrame(uint64_t frameEndTime, TConsumeFunc&& consumeFunc)
+            {
+                const size_t numFrameSamples = CollectFrameSamples(frameEndTime);
+                m_frameBeginTime = frameEndTime;
+                consumeFunc(m_frameSamples.data(), numFrameSamples);
+            }
+
+            size_t GetNumUnreadSamples() const
+            {
+                return m_numUnreadSamples;
+            }
+
+            // the frame walk prior to the batched path: the combine function is invoked as soon as an overlapping sample is found
+            // TCombineFunc should be in the form of void(const uint8_t* pCounterData, size_t rangeIndex, uint64_t sampleBeginTime, uint64_t sampleEndTime, uint64_t frameBeginTime, uint64_t frameEndTime)
+            template <typename TCombineFunc>
+            void CombinePerSample(uint64_t frameEndTime, TCombineFunc&& combineFunc)
+            {
+                while (m_numUnreadSamples)
+                {
+                    const auto& sampleInfo = m_sampleInfoRingBuffer[m_getIndex];
+                    if (sampleInfo.beginTimestamp >= frameEndTime)
+                    {
+                        break;
+                    }
+                    else if (sampleInfo.endTimestamp <= m_frameBeginTime)
+                    {
+                        m_getIndex = CircularIncrement(m_getIndex, m_sampleInfoRingBuffer.size());
+                        --m_numUnreadSamples;
+                        continue;
+                    }
+                    else if (sampleInfo.endTimestamp > frameEndTime)
+                    {
+                        combineFunc(sampleInfo.pCounterData, sampleInfo.rangeIndex, sampleInfo.beginTimestamp, sampleInfo.endTimestamp, m_frameBeginTime, frameEndTime);
+                        break;
+                    }
+                    else
+                    {
+                        m_getIndex = CircularIncrement(m_getIndex, m_sampleInfoRingBuffer.size());
+                        --m_numUnreadSamples;
+                        combineFunc(sampleInfo.pCounterData, sampleInfo.rangeIndex, sampleInfo.beginTimestamp, sampleInfo.endTimestamp, m_frameBeginTime, frameEndTime);
+                    }
+                }
+                m_frameBeginTime = frameEndTime;
+            }
+        };
+
+    } // namespace
+
+    NVPW_TEST_CASE("FrameLevelSampleCombiner")
+    {
+        FrameLevelSampleCombinerTest combiner;
+        combiner.Initialize(8);
+
+        NVPW_SUBCASE("CollectFrameSamples")
+        {
+            // samples: [0, 10) [10, 20) [20, 30) [30, 40)
+            for (uint32_t sampleIdx = 0; sampleIdx < 4; ++sampleIdx)
+            {
+                NVPW_REQUIRE(combiner.AddSample(sampleIdx * 10, (sampleIdx + 1) * 10, sampleIdx));
+            }
+            {
+                // frame [0, 15): one full sample, half of the next one which is kept for the next frame
+                const auto frameSamples = combiner.CollectFrame(15);
+                NVPW_REQUIRE(frameSamples.size() == 2);
+                NVPW_CHECK(frameSamples[0].rangeIndexSrc == 0);
+                NVPW_CHECK(frameSamples[0].weight == 1.0);
+                NVPW_CHECK(frameSamples[1].rangeIndexSrc == 1);
+                NVPW_CHECK(frameSamples[1].weight == doctest::Approx(0.5));
+                NVPW_CHECK(combiner.GetNumUnreadSamples() == 3);
+            }
+            {
+                // frame [15, 18): falls entirely within sample 1
+                const auto frameSamples = combiner.CollectFrame(18);
+                NVPW_REQUIRE(frameSamples.size() == 1);
+                NVPW_CHECK(frameSamples[0].rangeIndexSrc == 1);
+                NVPW_CHECK(frameSamples[0].weight == doctest::Approx(0.3));
+                NVPW_CHECK(combiner.GetNumUnreadSamples() == 3);
+            }
+            {
+                // frame [18, 40): the remainder of sample 1 and two full samples
+                const auto frameSamples = combiner.CollectFrame(40);
+                NVPW_REQUIRE(frameSamples.size() == 3);
+                NVPW_CHECK(frameSamples[0].rangeIndexSrc == 1);
+                NVPW_CHECK(frameSamples[0].weight == doctest::Approx(0.2));
+                NVPW_CHECK(frameSamples[1].weight == 1.0);
+                NVPW_CHECK(frameSamples[2].weight == 1.0);
+                NVPW_CHECK(combiner.GetNumUnreadSamples() == 0);
+            }
+            {
+                // no samples left
+                const auto frameSamples = combiner.CollectFrame(50);
+                NVPW_CHECK(frameSamples.empty());
+            }
+        }
+
+        NVPW_SUBCASE("Skip Samples From Prior Frames")
+        {
+            NVPW_REQUIRE(combiner.AddSample(0, 10, 0));
+            NVPW_REQUIRE(combiner.AddSample(10, 20, 1));
+            combiner.CollectFrame(5);
+            NVPW_REQUIRE(combiner.AddSample(20, 30, 2));
+            combiner.CollectFrame(20); // consumes the rest of sample 0 and all of sample 1
+            const auto frameSamples = combiner.CollectFrame(30);
+            NVPW_REQUIRE(frameSamples.size() == 1);
+            NVPW_CHECK(frameSamples[0].rangeIndexSrc == 2);
+            NVPW_CHECK(frameSamples[0].weight == 1.0);
+        }
+
+        NVPW_SUBCASE("Buffer Full")
+        {
+            for (uint32_t sampleIdx = 0; sampleIdx < 8; ++sampleIdx)
+            {
+                NVPW_REQUIRE(combiner.AddSample(sampleIdx * 10, (sampleIdx + 1) * 10, sampleIdx));
+            }
+            ScopedNvPerfLogDisabler logDisabler;
+            NVPW_CHECK(!combiner.AddSample(80, 90, 8));
+        }
+    }
+
+    // A model of the host-side overhead only, NOT a measurement of the shipped combine path: the frame walk is the real CollectFrameSamples(),
+    // but both dispatch loops below are test-local replicas of CounterDataCombiner::SumIntoRange() calling a stub instead of NVPW, because real
+    // combiner calls require a counter data image generated on a GPU. The real path is covered by "FrameLevelSampleCombiner" in the Device tests.
+    NVPW_TEST_CASE("FrameLevelSampleCombiner Host Overhead Model")
+    {
+        const uint64_t sampleInterval = 50'000;     // 50us => 20kHz
+        const uint64_t frameInterval = 16'666'667;  // 60fps
+        const size_t numFrames = 600;
+        const size_t maxSampleLatency = 1024;
+
+        struct StubParams
+        {
+            size_t structSize;
+            void* pPriv;
+            void* pCounterDataCombiner;
+            size_t rangeIndexDst;
+            double dstMultiplier;
+            const uint8_t* pCounterDataSrc;
+            size_t rangeIndexSrc;
+            double srcMultiplier;
+        };
+        struct StubApi
+        {
+            size_t numCalls;
+            double accumulated;
+            static void SumIntoRange(StubApi* pApi, const StubParams* pParams)
+            {
+                ++pApi->numCalls;
+                pApi->accumulated += pParams->srcMultiplier * (double)pParams->rangeIndexSrc;
+            }
+        } stubApi = {};
+        // NVPW entry points are dispatched through a function table loaded at runtime, keep the stub opaque to the optimizer likewise
+        void (* volatile pStubSumIntoRange)(StubApi*, const StubParams*) = &StubApi::SumIntoRange;
+        auto stubSumIntoRange = [&](const StubParams& params) {
+            pStubSumIntoRange(&stubApi, &params);
+        };
+
+        struct Frame
+        {
+            uint64_t beginTime;
+            uint64_t endTime;
+            size_t firstSample;
+            size_t numSamples;
+        };
+        struct Sample
+        {
+            uint64_t beginTime;
+            uint64_t endTime;
+            uint32_t rangeIndex;
+        };
+        std::vector<Frame> frames;
+        std::vector<Sample> samples;
+        {
+            uint64_t frameBeginTime = 0;
+            uint64_t sampleTime = 0;
+            for (size_t frameIdx = 0; frameIdx < numFrames; ++frameIdx)
+            {
+                const uint64_t frameEndTime = frameBeginTime + frameInterval;
+                const size_t firstSample = samples.size();
+                while (sampleTime < frameEndTime)
+                {
+                    samples.push_back({ sampleTime, sampleTime + sampleInterval, (uint32_t)(samples.size() % maxSampleLatency) });
+                    sampleTime += sampleInterval;
+                }
+                frames.push_back({ frameBeginTime, frameEndTime, firstSample, samples.size() - firstSample });
+                frameBeginTime = frameEndTime;
+            }
+        }
+
+        auto measureNs = [](const auto& func) {
+            const auto begin = std::chrono::steady_clock::now();
+            func();
+            const auto end = std::chrono::steady_clock::now();
+            return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+        };
+
+        auto addFrameSamples = [&](FrameLevelSampleCombinerTest& combiner, const Frame& frame) {
+            bool success = true;
+            for (size_t sampleIdx = frame.firstSample; sampleIdx < frame.firstSample + frame.numSamples; ++sampleIdx)
+            {
+                const Sample& sample = samples[sampleIdx];
+                success &= combiner.AddSample(sample.beginTime, sample.endTime, sample.rangeIndex);
+            }
+            return success;
+        };
+        bool success = true;
+
+        // per-sample: replica of the hybrid CounterDataCombiner::SumIntoRange() invoked once for each overlapping sample
+        const double perSampleNs = measureNs([&]() {
+            FrameLevelSampleCombinerTest combiner;
+            combiner.Initialize(maxSampleLatency);
+            for (size_t frameIdx = 0; frameIdx < frames.size(); ++frameIdx)
+            {
+                const Frame& frame = frames[frameIdx];
+                success &= addFrameSamples(combiner, frame);
+                combiner.CombinePerSample(frame.endTime, [&](const uint8_t* pCounterData, size_t rangeIndex, uint64_t sampleBeginTime, uint64_t sampleEndTime, uint64_t frameBeginTime, uint64_t frameEndTime) {
+                    StubParams params = { sizeof(StubParams) };
+                    params.rangeIndexDst = frameIdx;
+                    params.pCounterDataSrc = pCounterData;
+                    params.rangeIndexSrc = rangeIndex;
+                    if (sampleBeginTime >= frameBeginTime && sampleEndTime <= frameEndTime)
+                    {
+                        params.srcMultiplier = 1.0;
+                    }
+                    else
+                    {
+                        params.dstMultiplier = 1.0;
+                        params.srcMultiplier = CounterDataCombiner::GetOverlapFactor(sampleBeginTime, sampleEndTime, frameBeginTime, frameEndTime);
+                    }
+                    stubSumIntoRange(params);
+                });
+            }
+        });
+        const StubApi perSampleStubApi = stubApi;
+
+        // batched: real CollectFrameSamples(), then a replica of the batched CounterDataCombiner::SumIntoRange() dispatch loop
+        stubApi = {};
+        const double batchedNs = measureNs([&]() {
+            FrameLevelSampleCombinerTest combiner;
+            combiner.Initialize(maxSampleLatency);
+            for (size_t frameIdx = 0; frameIdx < frames.size(); ++frameIdx)
+            {
+                const Frame& frame = frames[frameIdx];
+                success &= addFrameSamples(combiner, frame);
+                combiner.CollectFrame(frame.endTime, [&](const CounterDataCombiner::WeightedSample* pSamples, size_t numSamples) {
+                    StubParams params = { sizeof(StubParams) };
+                    params.rangeIndexDst = frameIdx;
+                    params.dstMultiplier = 1.0;
+                    for (size_t sampleIdx = 0; sampleIdx < numSamples; ++sampleIdx)
+                    {
+                        const CounterDataCombiner::WeightedSample& sample = pSamples[sampleIdx];
+                        params.pCounterDataSrc = sample.pCounterDataSrc;
+                        params.rangeIndexSrc = sample.rangeIndexSrc;
+                        params.srcMultiplier = sample.weight;
+                        stubSumIntoRange(params);
+                    }
+                });
+            }
+        });
+        NVPW_CHECK(success);
+        NVPW_CHECK(stubApi.numCalls == perSampleStubApi.numCalls);
+        NVPW_CHECK(stubApi.accumulated == doctest::Approx(perSampleStubApi.accumulated));
+
+        NVPW_TEST_MESSAGE("model (stubbed NVPW) samples: ", samples.size(), ", per-sample: ", perSampleNs / samples.size(), " ns/sample, batched: ", batchedNs / samples.size(), " ns/sample");
+    }
+
     NVPW_TEST_SUITE_END();
 
 }}} // nv::perf::test
\ No newline at end of file
@@ -0,0 +1,398 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "Offline.h"
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <NvPerfCounterDataRecorder.h>
+#include "Offline_CounterDataRecorderTest.h"
+
+#if defined(__linux__)
+#include <csignal>
+#include <sys/resource.h>
+#endif
+
+namespace nv { namespace perf { namespace test {
+
+    NVPW_TEST_SUITE_BEGIN("CounterDataRecorder");
+
+    namespace {
+        // ranges are recorded without a source image, so each one is filled with its source range index
+        typedef TestCounterDataRecorder<100> CounterDataRecorderTest;
+
+        bool RangeHasValue(const sampler::CounterDataRecordingReader& reader, uint64_t index, uint8_t value)
+        {
+            const uint8_t* pCounterDataImage = nullptr;
+            size_t counterDataImageSize = 0;
+            uint32_t rangeIndex = 0;
+            if (!reader.GetRange(index, pCounterDataImage, counterDataImageSize, rangeIndex))
+            {
+                return false;
+            }
+            const uint8_t* pRange = pCounterDataImage + rangeIndex * CounterDataRecorderTest::RangeSize;
+            for (size_t ii = 0; ii < CounterDataRecorderTest::RangeSize; ++ii)
+            {
+                if (pRange[ii] != value)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        struct ScopedRecordingFiles
+        {
+            std::string path;
+            ScopedRecordingFiles(const char* pPath) : path(pPath) {}
+            ~ScopedRecordingFiles()
+            {
+                std::remove(path.c_str());
+                std::remove(sampler::CounterDataRecordingIndexPath(path).c_str());
+            }
+        };
+
+        std::vector<uint8_t> ReadFileContents(const std::string& path)
+        {
+            std::vector<uint8_t> contents;
+            if (FILE* pFile = OpenFile(path.c_str(), "rb"))
+            {
+                uint8_t buffer[4096];
+                size_t numRead = 0;
+                while ((numRead = fread(buffer, 1, sizeof(buffer), pFile)) > 0)
+                {
+                    contents.insert(contents.end(), buffer, buffer + numRead);
+                }
+                fclose(pFile);
+            }
+            return contents;
+        }
+
+        // stands in for a full disk: growing either file fails while "failResize" is set
+        class FailingResizeRecorder : public CounterDataRecorderTest
+        {
+        public:
+            bool failResize = false;
+
+        protected:
+            virtual bool ResizeFile(MappedFile& file, size_t size) override
+            {
+                if (failResize)
+                {
+                    return false;
+                }
+                return CounterDataRecorderTest::ResizeFile(file, size);
+            }
+        };
+
+        bool WriteFileContents(const std::string& path, const std::vector<uint8_t>& contents)
+        {
+            FILE* pFile = OpenFile(path.c_str(), "wb");
+            if (!pFile)
+            {
+                return false;
+            }
+            const bool success = fwrite(contents.data(), 1, contents.size(), pFile) == contents.size();
+            fclose(pFile);
+            return success;
+        }
+    } // namespace
+
+    NVPW_TEST_CASE("RecordAndRead")
+    {
+        ScopedRecordingFiles files("Offline_CounterDataRecorder.nvpwcdr");
+        const std::vector<uint8_t> counterDataPrefix = { 1, 2, 3, 4, 5 };
+        const std::vector<uint8_t> counterDataSource;
+        const uint32_t NumRangesPerChunk = 4;
+
+        CounterDataRecorderTest recorder;
+        NVPW_REQUIRE(recorder.Open(files.path, counterDataPrefix, counterDataSource, NumRangesPerChunk));
+
+        NVPW_SUBCASE("Complete Chunks Only")
+        {
+            for (uint32_t rangeIndex = 0; rangeIndex < 10; ++rangeIndex)
+            {
+                NVPW_REQUIRE(recorder.AppendRange(nullptr, 0, rangeIndex));
+            }
+
+            // the recording can be read while being written, only the 2 complete chunks are visible
+            sampler::CounterDataRecordingReader reader;
+            NVPW_REQUIRE(reader.Open(files.path));
+            NVPW_CHECK(reader.GetNumRanges() == 8);
+            NVPW_CHECK(RangeHasValue(reader, 7, 7));
+            const uint8_t* pCounterDataImage = nullptr;
+            size_t counterDataImageSize = 0;
+            uint32_t rangeIndex = 0;
+            {
+                ScopedNvPerfLogDisabler logDisabler;
+                NVPW_CHECK(!reader.GetRange(8, pCounterDataImage, counterDataImageSize, rangeIndex));
+            }
+        }
+
+        NVPW_SUBCASE("Flush and Close")
+        {
+            for (uint32_t rangeIndex = 0; rangeIndex < 6; ++rangeIndex)
+            {
+                NVPW_REQUIRE(recorder.AppendRange(nullptr, 0, rangeIndex));
+            }
+            NVPW_REQUIRE(recorder.Flush());
+            {
+                sampler::CounterDataRecordingReader reader;
+                NVPW_REQUIRE(reader.Open(files.path));
+                NVPW_CHECK(reader.GetNumRanges() == 6);
+            }
+
+            // keep filling the partially flushed chunk
+            for (uint32_t rangeIndex = 6; rangeIndex < 11; ++rangeIndex)
+            {
+                NVPW_REQUIRE(recorder.AppendRange(nullptr, 0, rangeIndex));
+            }
+            NVPW_REQUIRE(recorder.Close());
+
+            sampler::CounterDataRecordingReader reader;
+            NVPW_REQUIRE(reader.Open(files.path));
+            NVPW_REQUIRE(reader.GetNumRanges() == 11);
+
+            size_t counterDataPrefixSize = 0;
+            const uint8_t* pCounterDataPrefix = reader.GetCounterDataPrefix(counterDataPrefixSize);
+            NVPW_CHECK(std::vector<uint8_t>(pCounterDataPrefix, pCounterDataPrefix + counterDataPrefixSize) == counterDataPrefix);
+
+            for (uint64_t index = 0; index < reader.GetNumRanges(); ++index)
+            {
+                NVPW_CHECK(RangeHasValue(reader, index, (uint8_t)index));
+                NVPW_CHECK(reader.GetIndexEntry(index).triggerCount == index);
+            }
+
+            const uint8_t* pCounterDataImage = nullptr;
+            size_t counterDataImageSize = 0;
+            uint32_t rangeIndex = 0;
+            NVPW_REQUIRE(reader.GetRange(9, pCounterDataImage, counterDataImageSize, rangeIndex));
+            NVPW_CHECK(counterDataImageSize == NumRangesPerChunk * CounterDataRecorderTest::RangeSize);
+            NVPW_CHECK(rangeIndex == 1);
+            NVPW_CHECK(reinterpret_cast<uintptr_t>(pCounterDataImage) % sampler::CounterDataRecorder::ChunkAlignment == 0);
+
+            // time windows
+            uint64_t firstIndex = 0;
+            uint64_t lastIndex = 0;
+            reader.FindRanges(25, 45, firstIndex, lastIndex); // partially overlaps with ranges 2 and 4
+            NVPW_CHECK(firstIndex == 2);
+            NVPW_CHECK(lastIndex == 5);
+            reader.FindRanges(30, 40, firstIndex, lastIndex);
+            NVPW_CHECK(firstIndex == 3);
+            NVPW_CHECK(lastIndex == 4);
+            reader.FindRanges(200, 300, firstIndex, lastIndex);
+            NVPW_CHECK(firstIndex == lastIndex);
+
+            std::vector<uint32_t> triggerCounts;
+            NVPW_CHECK(reader.ForEachRange(0, 30, [&](const uint8_t* pImage, size_t imageSize, uint32_t rangeIndex_, const sampler::CounterDataRecordingIndexEntry& indexEntry) {
+                triggerCounts.push_back(indexEntry.triggerCount);
+                return true;
+            }));
+            NVPW_CHECK(triggerCounts == std::vector<uint32_t>({ 0, 1, 2 }));
+        }
+    }
+
+    NVPW_TEST_CASE("Failed Resize")
+    {
+        ScopedNvPerfLogDisabler logDisabler;
+        ScopedRecordingFiles files("Offline_CounterDataRecorder_FailedResize.nvpwcdr");
+        const uint32_t NumRangesPerChunk = 4;
+
+        FailingResizeRecorder recorder;
+        NVPW_REQUIRE(recorder.Open(files.path, { 1, 2, 3 }, {}, NumRangesPerChunk));
+
+        NVPW_SUBCASE("Index File")
+        {
+            for (uint32_t rangeIndex = 0; rangeIndex < 4; ++rangeIndex)
+            {
+                NVPW_REQUIRE(recorder.AppendRange(nullptr, 0, rangeIndex));
+            }
+            recorder.failResize = true;
+            NVPW_CHECK(!recorder.AppendRange(nullptr, 0, 4)); // the index file is full
+        }
+        NVPW_SUBCASE("Data File")
+        {
+            for (uint32_t rangeIndex = 0; rangeIndex < 7; ++rangeIndex)
+            {
+                NVPW_REQUIRE(recorder.AppendRange(nullptr, 0, rangeIndex));
+            }
+            recorder.failResize = true;
+            NVPW_CHECK(!recorder.AppendRange(nullptr, 0, 7)); // completes chunk 1, which does not fit
+        }
+
+        // the recording stays stopped even once the disk has space again, rather than writing through a lost mapping
+        recorder.failResize = false;
+        NVPW_CHECK(!recorder.AppendRange(nullptr, 0, 8));
+        NVPW_CHECK(!recorder.Flush());
+        NVPW_CHECK(!recorder.Close());
+
+        sampler::CounterDataRecordingReader reader;
+        NVPW_REQUIRE(reader.Open(files.path));
+        NVPW_REQUIRE(reader.GetNumRanges() == 4);
+        for (uint64_t index = 0; index < reader.GetNumRanges(); ++index)
+        {
+            NVPW_CHECK(RangeHasValue(reader, index, (uint8_t)index));
+        }
+
+        // a new recording starts over
+        NVPW_REQUIRE(recorder.Open(files.path, { 1, 2, 3 }, {}, NumRangesPerChunk));
+        NVPW_CHECK(recorder.AppendRange(nullptr, 0, 0));
+    }
+
+#if defined(__linux__)
+    NVPW_TEST_CASE("MappedFile Failed Grow")
+    {
+        ScopedNvPerfLogDisabler logDisabler;
+        const std::string path = "Offline_CounterDataRecorder_MappedFile.bin";
+        {
+            MappedFile file;
+            NVPW_REQUIRE(file.Create(path, 4096));
+            memset(file.Data(), 0x5a, file.Size());
+
+            // a file size limit makes ftruncate() fail like a full disk would, with SIGXFSZ ignored it only returns EFBIG
+            struct rlimit previousLimit = {};
+            NVPW_REQUIRE(getrlimit(RLIMIT_FSIZE, &previousLimit) == 0);
+            struct rlimit limit = previousLimit;
+            limit.rlim_cur = 8192;
+            void (*previousHandler)(int) = signal(SIGXFSZ, SIG_IGN);
+            NVPW_REQUIRE(setrlimit(RLIMIT_FSIZE, &limit) == 0);
+            const bool grown = file.Resize(1024 * 1024);
+            setrlimit(RLIMIT_FSIZE, &previousLimit);
+            signal(SIGXFSZ, previousHandler);
+
+            // the previous mapping is kept, so callers that check Size() never write through a null or stale base
+            NVPW_CHECK(!grown);
+            NVPW_REQUIRE(file.Data());
+            NVPW_CHECK(file.Size() == 4096);
+            NVPW_CHECK(file.Data()[4095] == 0x5a);
+
+            NVPW_REQUIRE(file.Resize(8192));
+            NVPW_CHECK(file.Data()[4095] == 0x5a);
+            file.Data()[8191] = 0xa5;
+            NVPW_REQUIRE(file.Resize(1024));
+            NVPW_CHECK(file.Size() == 1024);
+            NVPW_CHECK(file.Data()[1023] == 0x5a);
+        }
+        std::remove(path.c_str());
+    }
+#endif
+
+    NVPW_TEST_CASE("Invalid Recording")
+    {
+        ScopedNvPerfLogDisabler logDisabler;
+        ScopedRecordingFiles files("Offline_CounterDataRecorder_Invalid.nvpwcdr");
+        {
+            FILE* pFile = OpenFile(files.path.c_str(), "wb");
+            NVPW_REQUIRE(pFile);
+            const char garbage[256] = "not a recording";
+            fwrite(garbage, 1, sizeof(garbage), pFile);
+            fclose(pFile);
+        }
+        sampler::CounterDataRecordingReader reader;
+        NVPW_CHECK(!reader.Open(files.path));
+        NVPW_CHECK(!reader.Open("Offline_CounterDataRecorder_DoesNotExist.nvpwcdr"));
+    }
+
+    NVPW_TEST_CASE("Corrupted Recording")
+    {
+        ScopedRecordingFiles files("Offline_CounterDataRecorder_Corrupted.nvpwcdr");
+        const uint32_t NumRangesPerChunk = 4;
+        {
+            CounterDataRecorderTest recorder;
+            NVPW_REQUIRE(recorder.Open(files.path, { 1, 2, 3 }, {}, NumRangesPerChunk));
+            for (uint32_t rangeIndex = 0; rangeIndex < 10; ++rangeIndex)
+            {
+                NVPW_REQUIRE(recorder.AppendRange(nullptr, 0, rangeIndex));
+            }
+            NVPW_REQUIRE(recorder.Close());
+        }
+        const std::vector<uint8_t> recording = ReadFileContents(files.path);
+        const std::vector<uint8_t> index = ReadFileContents(sampler::CounterDataRecordingIndexPath(files.path));
+        NVPW_REQUIRE(recording.size() > sizeof(sampler::CounterDataRecordingHeader));
+        sampler::CounterDataRecordingHeader header = {};
+        memcpy(&header, recording.data(), sizeof(header));
+        NVPW_REQUIRE(header.numRanges == 10);
+
+        auto openWithHeader = [&](const sampler::CounterDataRecordingHeader& corruptedHeader) {
+            std::vector<uint8_t> corrupted = recording;
+            memcpy(corrupted.data(), &corruptedHeader, sizeof(corruptedHeader));
+            if (!WriteFileContents(files.path, corrupted))
+            {
+                return true; // fail the check below
+            }
+            sampler::CounterDataRecordingReader reader;
+            return reader.Open(files.path);
+        };
+
+        ScopedNvPerfLogDisabler logDisabler;
+        NVPW_SUBCASE("Zero Chunk Stride")
+        {
+            sampler::CounterDataRecordingHeader corruptedHeader = header;
+            corruptedHeader.chunkStride = 0;
+            corruptedHeader.chunkSize = 0;
+            NVPW_CHECK(!openWithHeader(corruptedHeader));
+        }
+        NVPW_SUBCASE("Chunk Stride Smaller Than Chunk")
+        {
+            sampler::CounterDataRecordingHeader corruptedHeader = header;
+            corruptedHeader.chunkStride = header.chunkSize - 1;
+            NVPW_CHECK(!openWithHeader(corruptedHeader));
+        }
+        NVPW_SUBCASE("Chunks Beyond End Of File")
+        {
+            sampler::CounterDataRecordingHeader corruptedHeader = header;
+            corruptedHeader.chunksOffset = recording.size() + 1;
+            NVPW_CHECK(!openWithHeader(corruptedHeader));
+        }
+        NVPW_SUBCASE("Counter Data Prefix Overflow")
+        {
+            sampler::CounterDataRecordingHeader corruptedHeader = header;
+            corruptedHeader.counterDataPrefixSize = ~uint64_t(0) - header.counterDataPrefixOffset + 1; // wraps around to 0
+            NVPW_CHECK(!openWithHeader(corruptedHeader));
+        }
+        NVPW_SUBCASE("More Ranges Than Chunks")
+        {
+            sampler::CounterDataRecordingHeader corruptedHeader = header;
+            corruptedHeader.numRanges = 13;
+            NVPW_CHECK(!openWithHeader(corruptedHeader));
+        }
+        NVPW_SUBCASE("Truncated Chunks")
+        {
+            const std::vector<uint8_t> truncated(recording.begin(), recording.end() - 1);
+            NVPW_REQUIRE(WriteFileContents(files.path, truncated));
+            sampler::CounterDataRecordingReader reader;
+            NVPW_CHECK(!reader.Open(files.path));
+        }
+        NVPW_SUBCASE("Truncated Index")
+        {
+            const std::vector<uint8_t> truncated(index.begin(), index.end() - sizeof(sampler::CounterDataRecordingIndexEntry));
+            NVPW_REQUIRE(WriteFileContents(sampler::CounterDataRecordingIndexPath(files.path), truncated));
+            sampler::CounterDataRecordingReader reader;
+            NVPW_CHECK(!reader.Open(files.path));
+        }
+        NVPW_SUBCASE("Intact")
+        {
+            sampler::CounterDataRecordingReader reader;
+            NVPW_REQUIRE(reader.Open(files.path));
+            NVPW_CHECK(reader.GetNumRanges() == 10);
+            NVPW_CHECK(RangeHasValue(reader, 9, 9));
+        }
+    }
+
+    NVPW_TEST_SUITE_END();
+
+}}} // nv::perf::test
@@ -0,0 +1,86 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <cstring>
+#include <vector>
+#include <NvPerfCounterDataRecorder.h>
+
+namespace nv { namespace perf { namespace test {
+
+    // Stands in for the counter data combiner: a chunk is "RangeSize" bytes per range. A recorded range is copied from the source
+    // "counter data image", which is then "RangeSize" bytes per range too, or without a source image, filled with its source range index.
+    // The timestamps of source range N are [N * 10, N * 10 + 10), unless AppendRange() is given an index entry.
+    template <size_t RangeSize_>
+    class TestCounterDataRecorder : public sampler::CounterDataRecorder
+    {
+    public:
+        static const size_t RangeSize = RangeSize_;
+
+    private:
+        std::vector<uint8_t> m_chunk;
+
+    public:
+        virtual ~TestCounterDataRecorder()
+        {
+            Close();
+        }
+
+    protected:
+        virtual bool InitializeChunk(const std::vector<uint8_t>& counterDataPrefix, const std::vector<uint8_t>& counterDataSource, uint32_t numRangesPerChunk) override
+        {
+            m_chunkTemplate.assign(numRangesPerChunk * RangeSize, 0xff);
+            m_chunk = m_chunkTemplate;
+            return true;
+        }
+
+        virtual std::vector<uint8_t>& GetChunk() override
+        {
+            return m_chunk;
+        }
+
+        virtual void ResetChunk() override
+        {
+            m_chunk = m_chunkTemplate;
+        }
+
+        virtual bool CopyRangeIntoChunk(uint32_t slot, const uint8_t* pCounterDataImage, size_t counterDataImageSize, uint32_t rangeIndex) override
+        {
+            if (!pCounterDataImage)
+            {
+                memset(m_chunk.data() + slot * RangeSize, (int)(rangeIndex & 0xff), RangeSize);
+                return true;
+            }
+            if ((rangeIndex + 1) * RangeSize > counterDataImageSize)
+            {
+                return false;
+            }
+            memcpy(m_chunk.data() + slot * RangeSize, pCounterDataImage + rangeIndex * RangeSize, RangeSize);
+            return true;
+        }
+
+        virtual bool GetRangeInfo(const uint8_t* pCounterDataImage, size_t counterDataImageSize, uint32_t rangeIndex, sampler::CounterDataRecordingIndexEntry& indexEntry) override
+        {
+            indexEntry.startTimestamp = rangeIndex * 10;
+            indexEntry.endTimestamp = rangeIndex * 10 + 10;
+            indexEntry.triggerCount = rangeIndex;
+            return true;
+        }
+    };
+
+}}} // namespace nv::perf::test
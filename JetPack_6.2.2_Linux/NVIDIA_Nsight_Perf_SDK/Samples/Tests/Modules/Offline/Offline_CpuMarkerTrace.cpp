@@ -15,6 +15,14 @@
 */
 
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
 #include <doctest_proxy.h>
 
 #include "NvPerfCpuMarkerTrace.h"
@@ -430,6 +438,559 @@ namespace nv { namespace perf { namespace test {
         NVPW_CHECK(*markers.pUserData == modifiedUserData);
     }
 
+    NVPW_TEST_CASE("NameTable")
+    {
+        CpuMarkerNameTable nameTable;
+        NVPW_CHECK(nameTable.Intern("before init") == CpuMarkerNameTable::InvalidNameId);
+
+        nameTable.Initialize(4, 20);
+        const uint32_t zeroId = nameTable.Intern("zero");
+        const uint32_t oneId = nameTable.Intern("one");
+        NVPW_CHECK(zeroId == 0);
+        NVPW_CHECK(oneId == 1);
+        NVPW_CHECK(nameTable.Intern("zero") == zeroId);
+        NVPW_CHECK(nameTable.Intern("zero_and_more", 4) == zeroId);
+        NVPW_CHECK(nameTable.Find("on", 2) == CpuMarkerNameTable::InvalidNameId);
+        NVPW_CHECK(nameTable.Find("one", 3) == oneId);
+        NVPW_CHECK(std::strcmp(nameTable.GetName(zeroId), "zero") == 0);
+        NVPW_CHECK(std::strcmp(nameTable.GetName(oneId), "one") == 0);
+        NVPW_CHECK(nameTable.GetName(2) == nullptr);
+        NVPW_CHECK(nameTable.GetName(CpuMarkerNameTable::InvalidNameId) == nullptr);
+
+        // 20 chars: "zero" + "one" + "two" leave 8, which is not enough for "overflow"
+        NVPW_CHECK(nameTable.Intern("two") == 2);
+        NVPW_CHECK(nameTable.Intern("overflow") == CpuMarkerNameTable::InvalidNameId);
+        NVPW_CHECK(nameTable.Intern("three") == 3);
+        NVPW_CHECK(nameTable.Intern("four") == CpuMarkerNameTable::InvalidNameId); // out of IDs
+        NVPW_CHECK(nameTable.GetNumNames() == 4);
+        NVPW_CHECK(std::strcmp(nameTable.GetName(3), "three") == 0);
+    }
+
+    NVPW_TEST_CASE("Interned Markers")
+    {
+        // no space at all in the names ring, so every marker has to be interned
+        CpuMarkerTrace<DefaultType> cpuMarkerTrace;
+        cpuMarkerTrace.Initialize(defaultFrameCount, defaultMarkerCount, 0);
+        cpuMarkerTrace.InitializeNameTable(defaultMarkerNames.size(), defaultNameCharCount);
+
+        const uint32_t zeroId = cpuMarkerTrace.InternMarkerName(defaultMarkerNames[0]);
+        NVPW_REQUIRE(zeroId != CpuMarkerNameTable::InvalidNameId);
+        NVPW_CHECK(!cpuMarkerTrace.PushMarker(defaultMarkerNames[0])); // the copied name doesn't fit
+        NVPW_CHECK(cpuMarkerTrace.OnFrameEnd());
+        cpuMarkerTrace.ReleaseOldestFrame();
+
+        NVPW_CHECK(cpuMarkerTrace.PushInternedMarker(zeroId));
+        NVPW_CHECK(cpuMarkerTrace.PushInternedMarker(defaultMarkerNames[1]));
+        NVPW_CHECK(cpuMarkerTrace.PushInternedMarker(defaultMarkerNames[0]));
+        NVPW_CHECK(!cpuMarkerTrace.PushInternedMarker(1234u));
+        NVPW_CHECK(cpuMarkerTrace.GetCurrentFrameDroppedMarkerCount() == 0);
+        NVPW_CHECK(cpuMarkerTrace.OnFrameEnd());
+
+        auto markers = cpuMarkerTrace.GetOldestFrameMarkers();
+        NVPW_REQUIRE(markers.validMarkerCount == 3);
+        NVPW_CHECK(markers.droppedMarkerCount == 0);
+        NVPW_CHECK(markers.droppedNameCharCount == 0);
+        NVPW_CHECK(markers.pBegin[0].nameId == zeroId);
+        NVPW_CHECK(markers.pBegin[1].nameId == cpuMarkerTrace.GetNameTable().Find("one", 3));
+        NVPW_CHECK(markers.pBegin[2].nameId == zeroId);
+        NVPW_CHECK(std::strcmp(markers.pBegin[0].pName, "zero") == 0);
+        NVPW_CHECK(std::strcmp(markers.pBegin[1].pName, "one") == 0);
+        NVPW_CHECK(markers.pBegin[0].pName == markers.pBegin[2].pName);
+        cpuMarkerTrace.ReleaseOldestFrame();
+
+        // the interned markers still obey the per-frame marker limit
+        for (size_t markerIdx = 0; markerIdx < defaultMarkerCount; ++markerIdx)
+        {
+            NVPW_CHECK(cpuMarkerTrace.PushInternedMarker(zeroId));
+        }
+        NVPW_CHECK(!cpuMarkerTrace.PushInternedMarker(zeroId));
+        NVPW_CHECK(cpuMarkerTrace.GetCurrentFrameDroppedMarkerCount() == 1);
+        NVPW_CHECK(cpuMarkerTrace.OnFrameEnd());
+        markers = cpuMarkerTrace.GetOldestFrameMarkers();
+        NVPW_CHECK(markers.validMarkerCount == defaultMarkerCount);
+        NVPW_CHECK(markers.droppedMarkerCount == 1);
+        NVPW_CHECK(markers.droppedNameCharCount == 0);
+    }
+
+    NVPW_TEST_CASE("Interned Markers - Full Name Table")
+    {
+        CpuMarkerTrace<DefaultType> cpuMarkerTrace;
+        cpuMarkerTrace.Initialize(defaultFrameCount, defaultMarkerCount, defaultNameCharCount);
+        cpuMarkerTrace.InitializeNameTable(1, defaultNameCharCount);
+
+        NVPW_CHECK(cpuMarkerTrace.PushInternedMarker(defaultMarkerNames[0]));
+        NVPW_CHECK(cpuMarkerTrace.PushInternedMarker(defaultMarkerNames[1])); // falls back to copying the name
+        NVPW_CHECK(cpuMarkerTrace.PushMarker(defaultMarkerNames[2]));
+        NVPW_CHECK(cpuMarkerTrace.OnFrameEnd());
+
+        const auto markers = cpuMarkerTrace.GetOldestFrameMarkers();
+        NVPW_REQUIRE(markers.validMarkerCount == 3);
+        NVPW_CHECK(markers.pBegin[0].nameId == 0);
+        NVPW_CHECK(markers.pBegin[1].nameId == CpuMarkerNameTable::InvalidNameId);
+        NVPW_CHECK(markers.pBegin[2].nameId == CpuMarkerNameTable::InvalidNameId);
+        for (size_t markerIdx = 0; markerIdx < 3; ++markerIdx)
+        {
+            NVPW_CHECK(std::strcmp(markers.pBegin[markerIdx].pName, defaultMarkerNames[markerIdx]) == 0);
+        }
+    }
+
+    NVPW_TEST_CASE("Interned Markers - Push Benchmark")
+    {
+        constexpr size_t NumFrames = 200;
+        constexpr size_t NumNames = 256;
+        constexpr size_t MarkersPerFrame = 1024;
+
+        std::vector<std::string> names;
+        for (size_t nameIdx = 0; nameIdx < NumNames; ++nameIdx)
+        {
+            names.push_back("Renderer::Pass" + std::to_string(nameIdx) + "::RecordCommandBuffers");
+        }
+
+        auto measureNs = [&](const auto& pushFrame, auto& trace) {
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t frameIdx = 0; frameIdx < NumFrames; ++frameIdx)
+            {
+                pushFrame();
+                NVPW_CHECK(trace.GetCurrentFrameDroppedMarkerCount() == 0);
+                trace.OnFrameEnd();
+                trace.ReleaseOldestFrame();
+            }
+            return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        };
+
+        CpuMarkerTrace<DefaultType> copyingTrace;
+        copyingTrace.Initialize(2, MarkersPerFrame, MarkersPerFrame * 48);
+        const double copyingNs = measureNs([&]() {
+            for (size_t markerIdx = 0; markerIdx < MarkersPerFrame; ++markerIdx)
+            {
+                const std::string& name = names[markerIdx % NumNames];
+                copyingTrace.PushMarker(name.c_str(), name.size());
+            }
+        }, copyingTrace);
+
+        CpuMarkerTrace<DefaultType> internedTrace;
+        internedTrace.Initialize(2, MarkersPerFrame, 0);
+        internedTrace.InitializeNameTable(NumNames, NumNames * 48);
+        std::vector<uint32_t> nameIds;
+        for (const std::string& name : names)
+        {
+            nameIds.push_back(internedTrace.InternMarkerName(name.c_str(), name.size()));
+        }
+        const double internedNs = measureNs([&]() {
+            for (size_t markerIdx = 0; markerIdx < MarkersPerFrame; ++markerIdx)
+            {
+                internedTrace.PushInternedMarker(nameIds[markerIdx % NumNames]);
+            }
+        }, internedTrace);
+
+        const size_t numMarkers = NumFrames * MarkersPerFrame;
+        NVPW_TEST_MESSAGE("PushMarker: ", copyingNs / numMarkers, " ns/marker, ", CpuMarkerTrace<DefaultType>::GetTotalMemoryUsage(2, MarkersPerFrame, MarkersPerFrame * 48), " bytes");
+        NVPW_TEST_MESSAGE("PushInternedMarker: ", internedNs / numMarkers, " ns/marker, ", CpuMarkerTrace<DefaultType>::GetTotalMemoryUsage(2, MarkersPerFrame, 0), " bytes");
+    }
+
+    NVPW_TEST_CASE("Scopes")
+    {
+        using Trace = CpuMarkerTrace<DefaultType>;
+        Trace cpuMarkerTrace;
+        cpuMarkerTrace.Initialize(defaultFrameCount, 16, 200);
+        cpuMarkerTrace.InitializeNameTable(4, 64);
+        const uint32_t drawId = cpuMarkerTrace.InternMarkerName("Draw");
+
+        const uint64_t beforeFrame = GetCpuMarkerTimestamp();
+        NVPW_CHECK(cpuMarkerTrace.PushScope("Frame"));           // 0
+        NVPW_CHECK(cpuMarkerTrace.PushScope("Shadows"));         // 1
+        NVPW_CHECK(cpuMarkerTrace.PushInternedMarker(drawId));   // 2
+        NVPW_CHECK(cpuMarkerTrace.PopScope());
+        NVPW_CHECK(cpuMarkerTrace.PushInternedScope(drawId));    // 3
+        NVPW_CHECK(cpuMarkerTrace.PushMarker("Submit"));         // 4
+        NVPW_CHECK(cpuMarkerTrace.GetCurrentScopeDepth() == 2);
+        NVPW_CHECK(cpuMarkerTrace.PopScope());
+        NVPW_CHECK(cpuMarkerTrace.PopScope());
+        NVPW_CHECK(!cpuMarkerTrace.PopScope());
+        NVPW_CHECK(cpuMarkerTrace.PushMarker("Present"));        // 5
+        NVPW_CHECK(cpuMarkerTrace.OnFrameEnd());
+        const uint64_t afterFrame = GetCpuMarkerTimestamp();
+
+        const auto markers = cpuMarkerTrace.GetOldestFrameMarkers();
+        NVPW_REQUIRE(markers.validMarkerCount == 6);
+        const char* expectedNames[] = { "Frame", "Shadows", "Draw", "Draw", "Submit", "Present" };
+        const uint32_t expectedDepths[] = { 0, 1, 2, 1, 2, 0 };
+        const uint32_t expectedParents[] = { Trace::InvalidMarkerIndex, 0, 1, 0, 3, Trace::InvalidMarkerIndex };
+        for (size_t markerIdx = 0; markerIdx < markers.validMarkerCount; ++markerIdx)
+        {
+            const auto& marker = markers.pBegin[markerIdx];
+            NVPW_CHECK(std::strcmp(marker.pName, expectedNames[markerIdx]) == 0);
+            NVPW_CHECK(marker.depth == expectedDepths[markerIdx]);
+            NVPW_CHECK(marker.parentIndex == expectedParents[markerIdx]);
+            NVPW_CHECK(marker.beginTimestamp <= marker.endTimestamp);
+            if (markerIdx)
+            {
+                NVPW_CHECK(markers.pBegin[markerIdx - 1].beginTimestamp <= marker.beginTimestamp);
+            }
+            if (marker.parentIndex != Trace::InvalidMarkerIndex)
+            {
+                // children are contained in their parent
+                const auto& parent = markers.pBegin[marker.parentIndex];
+                NVPW_CHECK(parent.beginTimestamp <= marker.beginTimestamp);
+                NVPW_CHECK(marker.endTimestamp <= parent.endTimestamp);
+            }
+        }
+        NVPW_CHECK(markers.pBegin[2].nameId == drawId);
+        NVPW_CHECK(markers.pBegin[3].nameId == drawId);
+        NVPW_CHECK(markers.pBegin[4].beginTimestamp == markers.pBegin[4].endTimestamp);
+        NVPW_CHECK(markers.beginTimestamp <= beforeFrame);
+        NVPW_CHECK(markers.pBegin[5].endTimestamp <= markers.endTimestamp);
+        NVPW_CHECK(markers.endTimestamp <= afterFrame);
+    }
+
+    NVPW_TEST_CASE("Scopes - Across Frames and Drops")
+    {
+        using Trace = CpuMarkerTrace<DefaultType>;
+        Trace cpuMarkerTrace;
+        cpuMarkerTrace.Initialize(3, 3, defaultNameCharCount);
+
+        // a scope left open is closed at the end of its frame, and still nests markers in the next frame
+        NVPW_CHECK(cpuMarkerTrace.PushScope("Loading"));
+        NVPW_CHECK(cpuMarkerTrace.OnFrameEnd());
+        NVPW_CHECK(cpuMarkerTrace.PushMarker("Chunk"));
+        NVPW_CHECK(cpuMarkerTrace.PopScope());
+        NVPW_CHECK(cpuMarkerTrace.OnFrameEnd());
+
+        auto markers = cpuMarkerTrace.GetOldestFrameMarkers();
+        NVPW_REQUIRE(markers.validMarkerCount == 1);
+        NVPW_CHECK(markers.pBegin[0].endTimestamp == markers.endTimestamp);
+        const uint64_t firstFrameEnd = markers.endTimestamp;
+        cpuMarkerTrace.ReleaseOldestFrame();
+        markers = cpuMarkerTrace.GetOldestFrameMarkers();
+        NVPW_REQUIRE(markers.validMarkerCount == 1);
+        NVPW_CHECK(markers.pBegin[0].depth == 1);
+        NVPW_CHECK(markers.pBegin[0].parentIndex == Trace::InvalidMarkerIndex);
+        NVPW_CHECK(markers.beginTimestamp == firstFrameEnd);
+        cpuMarkerTrace.ReleaseOldestFrame();
+
+        // dropped scopes still have to be popped, and keep the depth of later markers right
+        NVPW_CHECK(cpuMarkerTrace.PushScope("a"));
+        NVPW_CHECK(cpuMarkerTrace.PushScope("b"));
+        NVPW_CHECK(cpuMarkerTrace.PushScope("c"));
+        NVPW_CHECK(!cpuMarkerTrace.PushScope("d"));
+        NVPW_CHECK(cpuMarkerTrace.GetCurrentScopeDepth() == 4);
+        for (size_t scopeIdx = 0; scopeIdx < 4; ++scopeIdx)
+        {
+            NVPW_CHECK(cpuMarkerTrace.PopScope());
+        }
+        NVPW_CHECK(cpuMarkerTrace.GetCurrentScopeDepth() == 0);
+        NVPW_CHECK(cpuMarkerTrace.OnFrameEnd());
+        markers = cpuMarkerTrace.GetOldestFrameMarkers();
+        NVPW_CHECK(markers.validMarkerCount == 3);
+        NVPW_CHECK(markers.droppedMarkerCount == 1);
+        NVPW_CHECK(markers.pBegin[2].parentIndex == 1);
+        cpuMarkerTrace.ReleaseOldestFrame();
+
+        // scopes nested too deeply are dropped, but stay balanced
+        for (size_t scopeIdx = 0; scopeIdx < Trace::MaxScopeDepth + 2; ++scopeIdx)
+        {
+            cpuMarkerTrace.PushScope("deep");
+        }
+        for (size_t scopeIdx = 0; scopeIdx < Trace::MaxScopeDepth + 2; ++scopeIdx)
+        {
+            NVPW_CHECK(cpuMarkerTrace.PopScope());
+        }
+        NVPW_CHECK(!cpuMarkerTrace.PopScope());
+        NVPW_CHECK(cpuMarkerTrace.OnFrameEnd());
+        markers = cpuMarkerTrace.GetOldestFrameMarkers();
+        NVPW_CHECK(markers.validMarkerCount == 3);
+        NVPW_CHECK(markers.validMarkerCount + markers.droppedMarkerCount == Trace::MaxScopeDepth + 2);
+    }
+
+    NVPW_TEST_CASE("Scopes - Depth Overflow")
+    {
+        using Trace = CpuMarkerTrace<DefaultType>;
+        Trace cpuMarkerTrace;
+        cpuMarkerTrace.Initialize(defaultFrameCount, Trace::MaxScopeDepth + 8, 1024);
+        cpuMarkerTrace.InitializeNameTable(4, 64);
+        const uint32_t drawId = cpuMarkerTrace.InternMarkerName("Draw");
+
+        for (size_t scopeIdx = 0; scopeIdx < Trace::MaxScopeDepth; ++scopeIdx)
+        {
+            NVPW_CHECK(cpuMarkerTrace.PushScope("deep"));
+        }
+        NVPW_CHECK(!cpuMarkerTrace.PushScope("tooDeep"));
+        NVPW_CHECK(!cpuMarkerTrace.PushMarker("tooDeep"));
+        NVPW_CHECK(!cpuMarkerTrace.PushInternedMarker(drawId));
+
+        // only the markers that were nested too deep are dropped, ones pushed after popping out of them are recorded
+        while (cpuMarkerTrace.GetCurrentScopeDepth() > 1)
+        {
+            NVPW_CHECK(cpuMarkerTrace.PopScope());
+        }
+        NVPW_CHECK(cpuMarkerTrace.PushMarker("shallow"));
+        NVPW_CHECK(cpuMarkerTrace.PushInternedMarker(drawId));
+        NVPW_CHECK(cpuMarkerTrace.PopScope());
+        NVPW_CHECK(cpuMarkerTrace.OnFrameEnd());
+
+        const auto markers = cpuMarkerTrace.GetOldestFrameMarkers();
+        NVPW_REQUIRE(markers.validMarkerCount == Trace::MaxScopeDepth + 2);
+        NVPW_CHECK(markers.droppedMarkerCount == 3);
+        const auto& shallow = markers.pBegin[Trace::MaxScopeDepth];
+        NVPW_CHECK(std::strcmp(shallow.pName, "shallow") == 0);
+        NVPW_CHECK(shallow.depth == 1);
+        NVPW_CHECK(shallow.parentIndex == 0);
+        NVPW_CHECK(markers.pBegin[Trace::MaxScopeDepth + 1].nameId == drawId);
+    }
+
+    NVPW_TEST_CASE("MultiProducer - Concurrent Pushes")
+    {
+        constexpr size_t NumThreads = 4;
+        constexpr size_t MarkersPerThread = 200;
+        constexpr size_t NumFrames = 3;
+
+        CpuMarkerTraceMultiProducer<DefaultType> cpuMarkerTrace;
+        cpuMarkerTrace.Initialize(NumFrames + 1, NumThreads * MarkersPerThread, NumThreads * MarkersPerThread * 16);
+
+        std::vector<std::vector<std::string>> names(NumThreads);
+        for (size_t threadIdx = 0; threadIdx < NumThreads; ++threadIdx)
+        {
+            for (size_t markerIdx = 0; markerIdx < MarkersPerThread; ++markerIdx)
+            {
+                names[threadIdx].push_back("t" + std::to_string(threadIdx) + "_" + std::to_string(markerIdx));
+            }
+        }
+
+        for (size_t frameIdx = 0; frameIdx < NumFrames; ++frameIdx)
+        {
+            std::vector<std::thread> threads;
+            for (size_t threadIdx = 0; threadIdx < NumThreads; ++threadIdx)
+            {
+                threads.emplace_back([&, threadIdx]() {
+                    SetCpuMarkerThreadTag(uint32_t(threadIdx + 1));
+                    for (const std::string& name : names[threadIdx])
+                    {
+                        cpuMarkerTrace.PushMarker(name.c_str(), name.size());
+                    }
+                });
+            }
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+            NVPW_CHECK(cpuMarkerTrace.GetCurrentFrameDroppedMarkerCount() == 0);
+            NVPW_CHECK(cpuMarkerTrace.OnFrameEnd());
+        }
+        NVPW_CHECK(cpuMarkerTrace.GetUnreadFrameCount() == NumFrames);
+
+        for (size_t frameIdx = 0; frameIdx < NumFrames; ++frameIdx)
+        {
+            const auto markers = cpuMarkerTrace.GetOldestFrameMarkers();
+            NVPW_CHECK(markers.validMarkerCount == NumThreads * MarkersPerThread);
+            NVPW_CHECK(markers.droppedMarkerCount == 0);
+            NVPW_CHECK(markers.droppedNameCharCount == 0);
+            NVPW_REQUIRE((size_t)(markers.pEnd - markers.pBegin) == markers.validMarkerCount);
+
+            std::set<std::string> seenNames;
+            for (const auto* pMarker = markers.pBegin; pMarker != markers.pEnd; ++pMarker)
+            {
+                NVPW_REQUIRE(pMarker->pName != nullptr);
+                NVPW_REQUIRE(pMarker->threadTag >= 1);
+                NVPW_REQUIRE(pMarker->threadTag <= NumThreads);
+                // the name must be intact, and pushed by the thread that the tag claims
+                const std::string expectedPrefix = "t" + std::to_string(pMarker->threadTag - 1) + "_";
+                NVPW_CHECK(std::strncmp(pMarker->pName, expectedPrefix.c_str(), expectedPrefix.size()) == 0);
+                NVPW_CHECK(seenNames.insert(pMarker->pName).second);
+                NVPW_CHECK(pMarker->timestamp != 0);
+            }
+            NVPW_CHECK(seenNames.size() == NumThreads * MarkersPerThread);
+            cpuMarkerTrace.ReleaseOldestFrame();
+        }
+        NVPW_CHECK(cpuMarkerTrace.GetUnreadFrameCount() == 0);
+        SetCpuMarkerThreadTag(0);
+    }
+
+    NVPW_TEST_CASE("MultiProducer - Concurrent Overflow")
+    {
+        constexpr size_t NumThreads = 4;
+        constexpr size_t MarkersPerThread = 500;
+        constexpr size_t MaxMarkers = 300;
+        constexpr size_t MaxNameChars = 4000;
+
+        for (const bool nameLimited : { false, true })
+        {
+            CpuMarkerTraceMultiProducer<DefaultType> cpuMarkerTrace;
+            cpuMarkerTrace.Initialize(2, nameLimited ? NumThreads * MarkersPerThread : MaxMarkers, MaxNameChars);
+
+            const char* pName = "0123456789"; // 11 chars including the terminator
+            std::atomic<size_t> numAccepted(0);
+            std::vector<std::thread> threads;
+            for (size_t threadIdx = 0; threadIdx < NumThreads; ++threadIdx)
+            {
+                threads.emplace_back([&]() {
+                    for (size_t markerIdx = 0; markerIdx < MarkersPerThread; ++markerIdx)
+                    {
+                        if (cpuMarkerTrace.PushMarker(pName))
+                        {
+                            ++numAccepted;
+                        }
+                    }
+                });
+            }
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+            NVPW_CHECK(cpuMarkerTrace.OnFrameEnd());
+
+            const size_t numPushed = NumThreads * MarkersPerThread;
+            const size_t expectedValid = nameLimited ? MaxNameChars / 11 : MaxMarkers;
+            const auto markers = cpuMarkerTrace.GetOldestFrameMarkers();
+            NVPW_CHECK(markers.validMarkerCount == expectedValid);
+            NVPW_CHECK(numAccepted.load() == expectedValid);
+            NVPW_CHECK(markers.validMarkerCount + markers.droppedMarkerCount == numPushed);
+            NVPW_CHECK(markers.droppedNameCharCount == numPushed * 11 - MaxNameChars);
+            for (const auto* pMarker = markers.pBegin; pMarker != markers.pEnd; ++pMarker)
+            {
+                NVPW_CHECK(std::strcmp(pMarker->pName, pName) == 0);
+                NVPW_CHECK(pMarker->threadTag == 0);
+            }
+        }
+    }
+
+    NVPW_TEST_CASE("MultiProducer - Matches Single Producer")
+    {
+        // same sequence as "Multiple Frame Behavior", including dropped markers and an overrun frame ring
+        CpuMarkerTrace<DefaultType> singleProducer;
+        CpuMarkerTraceMultiProducer<DefaultType> multiProducer;
+        singleProducer.Initialize(3, defaultMarkerCount, 20);
+        multiProducer.Initialize(3, defaultMarkerCount, 20);
+
+        bool frameRecorded = true;
+        for (size_t frameIdx = 0; frameIdx < 5; ++frameIdx)
+        {
+            for (size_t markerIdx = 0; markerIdx < frameIdx + 3; ++markerIdx)
+            {
+                const char* pName = defaultMarkerNames[markerIdx % defaultMarkerNames.size()];
+                NVPW_CHECK(singleProducer.PushMarker(pName) == multiProducer.PushMarker(pName));
+            }
+            if (frameRecorded)
+            {
+                NVPW_CHECK(singleProducer.GetCurrentFrameDroppedMarkerCount() == multiProducer.GetCurrentFrameDroppedMarkerCount());
+            }
+            frameRecorded = singleProducer.OnFrameEnd();
+            NVPW_CHECK(frameRecorded == multiProducer.OnFrameEnd());
+            NVPW_CHECK(singleProducer.GetUnreadFrameCount() == multiProducer.GetUnreadFrameCount());
+
+            if (frameIdx % 2)
+            {
+                const auto expected = singleProducer.GetOldestFrameMarkers();
+                const auto actual = multiProducer.GetOldestFrameMarkers();
+                NVPW_CHECK(actual.validMarkerCount == expected.validMarkerCount);
+                NVPW_CHECK(actual.droppedMarkerCount == expected.droppedMarkerCount);
+                NVPW_CHECK(actual.droppedNameCharCount == expected.droppedNameCharCount);
+                for (size_t markerIdx = 0; markerIdx < actual.validMarkerCount; ++markerIdx)
+                {
+                    NVPW_CHECK(std::strcmp(actual.pBegin[markerIdx].pName, expected.pBegin[markerIdx].pName) == 0);
+                }
+                singleProducer.ReleaseOldestFrame();
+                multiProducer.ReleaseOldestFrame();
+            }
+        }
+    }
+
+    NVPW_TEST_CASE("MultiProducer - Interned Markers")
+    {
+        constexpr size_t NumThreads = 4;
+        constexpr size_t MarkersPerThread = 100;
+
+        CpuMarkerTraceMultiProducer<DefaultType> cpuMarkerTrace;
+        cpuMarkerTrace.Initialize(2, NumThreads * MarkersPerThread, 0);
+        cpuMarkerTrace.InitializeNameTable(NumThreads, 64);
+        std::vector<uint32_t> nameIds;
+        for (size_t threadIdx = 0; threadIdx < NumThreads; ++threadIdx)
+        {
+            nameIds.push_back(cpuMarkerTrace.InternMarkerName(defaultMarkerNames[threadIdx]));
+        }
+
+        std::vector<std::thread> threads;
+        for (size_t threadIdx = 0; threadIdx < NumThreads; ++threadIdx)
+        {
+            threads.emplace_back([&, threadIdx]() {
+                SetCpuMarkerThreadTag(uint32_t(threadIdx));
+                for (size_t markerIdx = 0; markerIdx < MarkersPerThread; ++markerIdx)
+                {
+                    cpuMarkerTrace.PushInternedMarker(nameIds[threadIdx]);
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        NVPW_CHECK(!cpuMarkerTrace.PushInternedMarker(nameIds[0])); // full
+        NVPW_CHECK(cpuMarkerTrace.OnFrameEnd());
+
+        const auto markers = cpuMarkerTrace.GetOldestFrameMarkers();
+        NVPW_CHECK(markers.validMarkerCount == NumThreads * MarkersPerThread);
+        NVPW_CHECK(markers.droppedMarkerCount == 1);
+        NVPW_CHECK(markers.droppedNameCharCount == 0);
+        for (const auto* pMarker = markers.pBegin; pMarker != markers.pEnd; ++pMarker)
+        {
+            NVPW_REQUIRE(pMarker->threadTag < NumThreads);
+            NVPW_CHECK(pMarker->nameId == nameIds[pMarker->threadTag]);
+            NVPW_CHECK(std::strcmp(pMarker->pName, defaultMarkerNames[pMarker->threadTag]) == 0);
+        }
+        SetCpuMarkerThreadTag(0);
+    }
+
+    NVPW_TEST_CASE("MultiProducer - Contention Benchmark")
+    {
+        constexpr size_t MarkersPerThread = 20000;
+        const char* pName = "RenderPass::Draw";
+
+        auto measureNs = [&](size_t numThreads, const auto& pushMarker) {
+            std::vector<std::thread> threads;
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t threadIdx = 0; threadIdx < numThreads; ++threadIdx)
+            {
+                threads.emplace_back([&]() {
+                    for (size_t markerIdx = 0; markerIdx < MarkersPerThread; ++markerIdx)
+                    {
+                        pushMarker();
+                    }
+                });
+            }
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+            return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        };
+
+        const size_t maxThreads = std::max<size_t>(2, std::min<size_t>(8, std::thread::hardware_concurrency()));
+        for (size_t numThreads = 1; numThreads <= maxThreads; numThreads *= 2)
+        {
+            const size_t numMarkers = numThreads * MarkersPerThread;
+            const size_t numNameChars = numMarkers * (std::strlen(pName) + 1);
+
+            CpuMarkerTrace<DefaultType> lockedTrace;
+            lockedTrace.Initialize(2, numMarkers, numNameChars);
+            std::mutex mutex;
+            const double lockedNs = measureNs(numThreads, [&]() {
+                std::lock_guard<std::mutex> lock(mutex);
+                lockedTrace.PushMarker(pName);
+            });
+            NVPW_CHECK(lockedTrace.GetCurrentFrameDroppedMarkerCount() == 0);
+
+            CpuMarkerTraceMultiProducer<DefaultType> multiProducerTrace;
+            multiProducerTrace.Initialize(2, numMarkers, numNameChars);
+            const double multiProducerNs = measureNs(numThreads, [&]() {
+                multiProducerTrace.PushMarker(pName);
+            });
+            NVPW_CHECK(multiProducerTrace.GetCurrentFrameDroppedMarkerCount() == 0);
+            NVPW_CHECK(multiProducerTrace.OnFrameEnd());
+            NVPW_CHECK(multiProducerTrace.GetOldestFrameMarkers().validMarkerCount == numMarkers);
+
+            NVPW_TEST_MESSAGE("threads: ", numThreads, ", mutex + CpuMarkerTrace: ", lockedNs / numMarkers, " ns/marker, CpuMarkerTraceMultiProducer: ", multiProducerNs / numMarkers, " ns/marker");
+        }
+    }
+
     NVPW_TEST_SUITE_END();
 
 }}} // namespace nv::perf::test
\ No newline at end of file
@@ -0,0 +1,286 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "Offline.h"
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <NvPerfFlightRecorder.h>
+#include "Offline_CounterDataRecorderTest.h"
+
+namespace nv { namespace perf { namespace test {
+
+    NVPW_TEST_SUITE_BEGIN("FlightRecorder");
+
+    namespace {
+        const size_t RangeSize = 16;
+
+        // The source "counter data image" is ignored, source range N is filled with N and its timestamps are [N * 10, N * 10 + 10).
+        // The ring is "RangeSize" bytes per slot.
+        class FlightRecorderTest : public sampler::FlightRecorder
+        {
+        private:
+            std::vector<uint8_t> m_ring;
+
+        protected:
+            virtual bool InitializeRing(const std::vector<uint8_t>& counterDataPrefix, const std::vector<uint8_t>& counterDataSource, uint32_t numRangeSlots) override
+            {
+                m_ring.assign(numRangeSlots * RangeSize, 0xff);
+                return true;
+            }
+
+            virtual void ResetRing() override
+            {
+                m_ring.clear();
+            }
+
+            virtual const std::vector<uint8_t>& GetRing() const override
+            {
+                return m_ring;
+            }
+
+            virtual bool CopyRangeIntoSlot(uint32_t slot, const uint8_t* pCounterDataImage, size_t counterDataImageSize, uint32_t rangeIndex) override
+            {
+                memset(m_ring.data() + slot * RangeSize, (int)(rangeIndex & 0xff), RangeSize);
+                return true;
+            }
+
+            virtual bool GetRangeInfo(const uint8_t* pCounterDataImage, size_t counterDataImageSize, uint32_t rangeIndex, sampler::CounterDataRecordingIndexEntry& rangeInfo) override
+            {
+                rangeInfo.startTimestamp = rangeIndex * 10;
+                rangeInfo.endTimestamp = rangeIndex * 10 + 10;
+                rangeInfo.triggerCount = rangeIndex;
+                return true;
+            }
+        };
+
+        // copies ranges out of the flight recorder's ring, "RangeSize" bytes per range
+        typedef TestCounterDataRecorder<RangeSize> CounterDataRecorderTest;
+
+        struct ScopedDumpFiles
+        {
+            std::string path;
+            ScopedDumpFiles(const char* pPath) : path(pPath) {}
+            ~ScopedDumpFiles()
+            {
+                std::remove(path.c_str());
+                std::remove(sampler::CounterDataRecordingIndexPath(path).c_str());
+                std::remove(sampler::FlightRecorderFramesPath(path).c_str());
+            }
+        };
+
+        // returns the value each dumped range is filled with
+        std::vector<uint8_t> ReadDumpedRanges(const std::string& path)
+        {
+            std::vector<uint8_t> values;
+            sampler::CounterDataRecordingReader reader;
+            if (!reader.Open(path))
+            {
+                return values;
+            }
+            for (uint64_t index = 0; index < reader.GetNumRanges(); ++index)
+            {
+                const uint8_t* pCounterDataImage = nullptr;
+                size_t counterDataImageSize = 0;
+                uint32_t rangeIndex = 0;
+                if (!reader.GetRange(index, pCounterDataImage, counterDataImageSize, rangeIndex))
+                {
+                    break;
+                }
+                const uint8_t value = pCounterDataImage[rangeIndex * RangeSize];
+                if (reader.GetIndexEntry(index).triggerCount != value)
+                {
+                    break;
+                }
+                values.push_back(value);
+            }
+            return values;
+        }
+
+        bool ReadDumpedFrames(const std::string& path, sampler::FlightRecorderFramesHeader& header, std::vector<uint64_t>& frameEndTimes)
+        {
+            FILE* pFile = OpenFile(sampler::FlightRecorderFramesPath(path).c_str(), "rb");
+            if (!pFile)
+            {
+                return false;
+            }
+            bool success = (fread(&header, sizeof(header), 1, pFile) == 1) && !strcmp(header.magic, sampler::FlightRecorderFramesHeader::Magic());
+            if (success)
+            {
+                frameEndTimes.resize(header.numFrames);
+                success = (fread(frameEndTimes.data(), sizeof(uint64_t), frameEndTimes.size(), pFile) == frameEndTimes.size());
+            }
+            fclose(pFile);
+            return success;
+        }
+    } // namespace
+
+    NVPW_TEST_CASE("FlightRecorder")
+    {
+        ScopedDumpFiles files("Offline_FlightRecorder.nvpwcdr");
+        const std::vector<uint8_t> counterDataPrefix = { 1, 2, 3 };
+        const std::vector<uint8_t> counterDataSource;
+        const uint32_t NumRangeSlots = 8;
+        const uint32_t NumFrameSlots = 4;
+
+        FlightRecorderTest flightRecorder;
+        NVPW_REQUIRE(flightRecorder.Initialize(counterDataPrefix, counterDataSource, NumRangeSlots, NumFrameSlots));
+        NVPW_CHECK(flightRecorder.GetState() == sampler::FlightRecorder::State::Recording);
+
+        NVPW_SUBCASE("Keeps The Latest Ranges")
+        {
+            for (uint32_t rangeIndex = 0; rangeIndex < 20; ++rangeIndex)
+            {
+                NVPW_REQUIRE(flightRecorder.AddRange(nullptr, 0, rangeIndex));
+            }
+            {
+                ScopedNvPerfLogDisabler logDisabler;
+                CounterDataRecorderTest recorder;
+                NVPW_CHECK(!flightRecorder.Dump(recorder, files.path)); // not frozen
+            }
+            flightRecorder.SetTriggerWindow(35, 0);
+            NVPW_REQUIRE(flightRecorder.Trigger());
+            NVPW_CHECK(flightRecorder.GetTriggerTime() == 200);
+            NVPW_CHECK(flightRecorder.IsFrozen()); // nothing to wait for
+
+            CounterDataRecorderTest recorder;
+            NVPW_REQUIRE(flightRecorder.Dump(recorder, files.path));
+            NVPW_CHECK(ReadDumpedRanges(files.path) == std::vector<uint8_t>({ 16, 17, 18, 19 }));
+
+            // the whole ring
+            flightRecorder.Rearm();
+            flightRecorder.SetTriggerWindow(1000, 0);
+            NVPW_REQUIRE(flightRecorder.Trigger());
+            NVPW_REQUIRE(flightRecorder.Dump(recorder, files.path));
+            NVPW_CHECK(ReadDumpedRanges(files.path) == std::vector<uint8_t>({ 12, 13, 14, 15, 16, 17, 18, 19 }));
+        }
+
+        NVPW_SUBCASE("Post-Trigger Period")
+        {
+            for (uint32_t rangeIndex = 0; rangeIndex < 10; ++rangeIndex)
+            {
+                NVPW_REQUIRE(flightRecorder.AddRange(nullptr, 0, rangeIndex));
+            }
+            flightRecorder.SetTriggerWindow(20, 30);
+            NVPW_REQUIRE(flightRecorder.Trigger(100));
+            {
+                ScopedNvPerfLogDisabler logDisabler;
+                NVPW_CHECK(!flightRecorder.Trigger(100));
+            }
+            NVPW_REQUIRE(flightRecorder.AddRange(nullptr, 0, 10));
+            NVPW_REQUIRE(flightRecorder.AddRange(nullptr, 0, 11));
+            NVPW_CHECK(flightRecorder.GetState() == sampler::FlightRecorder::State::Triggered);
+            NVPW_REQUIRE(flightRecorder.AddRange(nullptr, 0, 12));
+            NVPW_CHECK(flightRecorder.IsFrozen());
+            NVPW_REQUIRE(flightRecorder.AddRange(nullptr, 0, 13)); // ignored
+            NVPW_CHECK(flightRecorder.GetNumRangesRecorded() == 13);
+
+            CounterDataRecorderTest recorder;
+            NVPW_REQUIRE(flightRecorder.Dump(recorder, files.path));
+            NVPW_CHECK(ReadDumpedRanges(files.path) == std::vector<uint8_t>({ 8, 9, 10, 11, 12 }));
+
+            flightRecorder.Rearm();
+            NVPW_REQUIRE(flightRecorder.AddRange(nullptr, 0, 13));
+            NVPW_CHECK(flightRecorder.GetNumRangesRecorded() == 14);
+        }
+
+        NVPW_SUBCASE("Frame Time Trigger")
+        {
+            flightRecorder.SetTriggerWindow(25, 10);
+            flightRecorder.SetFrameTrigger(sampler::FlightRecorder::FrameTimeAbove(15));
+            const uint64_t frameEndTimes[] = { 10, 20, 30, 40, 60 };
+            for (uint64_t frameEndTime : frameEndTimes)
+            {
+                NVPW_REQUIRE(flightRecorder.AddFrameDelimiter(frameEndTime));
+            }
+            NVPW_CHECK(flightRecorder.GetState() == sampler::FlightRecorder::State::Triggered);
+            NVPW_CHECK(flightRecorder.GetTriggerTime() == 60);
+            for (uint32_t rangeIndex = 0; rangeIndex < 7; ++rangeIndex)
+            {
+                NVPW_REQUIRE(flightRecorder.AddRange(nullptr, 0, rangeIndex));
+            }
+            NVPW_REQUIRE(flightRecorder.IsFrozen());
+            NVPW_REQUIRE(flightRecorder.AddFrameDelimiter(80)); // ignored
+
+            CounterDataRecorderTest recorder;
+            NVPW_REQUIRE(flightRecorder.Dump(recorder, files.path));
+            NVPW_CHECK(ReadDumpedRanges(files.path) == std::vector<uint8_t>({ 3, 4, 5, 6 }));
+            sampler::FlightRecorderFramesHeader header = {};
+            std::vector<uint64_t> dumpedFrameEndTimes;
+            NVPW_REQUIRE(ReadDumpedFrames(files.path, header, dumpedFrameEndTimes));
+            NVPW_CHECK(header.version == sampler::FlightRecorderFramesHeader::CurrentVersion);
+            NVPW_CHECK(header.triggerTime == 60);
+            NVPW_CHECK(header.windowBeginTime == 35);
+            NVPW_CHECK(header.windowEndTime == 70);
+            NVPW_CHECK(dumpedFrameEndTimes == std::vector<uint64_t>({ 40, 60 }));
+        }
+
+        NVPW_SUBCASE("Range Trigger")
+        {
+            flightRecorder.SetTriggerWindow(20, 20);
+            flightRecorder.SetRangeTrigger([](const uint8_t*, size_t, uint32_t rangeIndex, const sampler::CounterDataRecordingIndexEntry&) {
+                return rangeIndex == 5;
+            });
+            for (uint32_t rangeIndex = 0; rangeIndex < 10; ++rangeIndex)
+            {
+                NVPW_REQUIRE(flightRecorder.AddRange(nullptr, 0, rangeIndex));
+            }
+            NVPW_REQUIRE(flightRecorder.IsFrozen());
+            NVPW_CHECK(flightRecorder.GetTriggerTime() == 60);
+            NVPW_CHECK(flightRecorder.GetNumRangesRecorded() == 8);
+
+            CounterDataRecorderTest recorder;
+            NVPW_REQUIRE(flightRecorder.Dump(recorder, files.path));
+            NVPW_CHECK(ReadDumpedRanges(files.path) == std::vector<uint8_t>({ 4, 5, 6, 7 }));
+        }
+
+        NVPW_SUBCASE("Window Larger Than The Ring")
+        {
+            for (uint32_t rangeIndex = 0; rangeIndex < 6; ++rangeIndex)
+            {
+                NVPW_REQUIRE(flightRecorder.AddRange(nullptr, 0, rangeIndex));
+            }
+            flightRecorder.SetTriggerWindow(1000, 1000);
+            NVPW_REQUIRE(flightRecorder.Trigger(60));
+            NVPW_REQUIRE(flightRecorder.AddRange(nullptr, 0, 6));
+            NVPW_REQUIRE(flightRecorder.AddRange(nullptr, 0, 7));
+            NVPW_CHECK(flightRecorder.GetState() == sampler::FlightRecorder::State::Triggered);
+            {
+                ScopedNvPerfLogDisabler logDisabler;
+                NVPW_REQUIRE(flightRecorder.AddRange(nullptr, 0, 8)); // would overwrite range 0
+            }
+            NVPW_CHECK(flightRecorder.IsFrozen());
+
+            CounterDataRecorderTest recorder;
+            NVPW_REQUIRE(flightRecorder.Dump(recorder, files.path));
+            NVPW_CHECK(ReadDumpedRanges(files.path) == std::vector<uint8_t>({ 0, 1, 2, 3, 4, 5, 6, 7 }));
+        }
+    }
+
+    NVPW_TEST_CASE("Not Initialized")
+    {
+        ScopedNvPerfLogDisabler logDisabler;
+        FlightRecorderTest flightRecorder;
+        NVPW_CHECK(!flightRecorder.AddRange(nullptr, 0, 0));
+        NVPW_CHECK(!flightRecorder.AddFrameDelimiter(0));
+        NVPW_CHECK(!flightRecorder.Trigger());
+        NVPW_CHECK(!flightRecorder.Initialize({}, {}, 0, 1));
+    }
+
+    NVPW_TEST_SUITE_END();
+
+}}} // nv::perf::test
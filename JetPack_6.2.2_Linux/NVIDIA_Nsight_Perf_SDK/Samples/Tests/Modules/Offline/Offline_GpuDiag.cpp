@@ -0,0 +1,226 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "Offline.h"
+
+#if defined(__linux__)
+#include <GpuDiagOS_Linux.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace nv { namespace perf { namespace test {
+
+    NVPW_TEST_SUITE_BEGIN("GpuDiag");
+
+#if defined(__linux__)
+    namespace {
+        // A root filesystem with just the files GpuDiag reads, removed on destruction.
+        class SyntheticRoot
+        {
+        private:
+            std::vector<std::string> m_directories;
+            std::vector<std::string> m_files;
+
+        public:
+            const std::string root;
+
+            SyntheticRoot()
+                : root("Offline_GpuDiag_root")
+            {
+                if (!mkdir(root.c_str(), 0755))
+                {
+                    m_directories.push_back(root);
+                }
+            }
+            ~SyntheticRoot()
+            {
+                for (const std::string& file : m_files)
+                {
+                    std::remove(file.c_str());
+                }
+                for (size_t index = m_directories.size(); index-- > 0;)
+                {
+                    rmdir(m_directories[index].c_str());
+                }
+            }
+
+            // "path" is absolute within the root, e.g. "/proc/meminfo"
+            void WriteFile(const std::string& path, const std::string& contents)
+            {
+                for (size_t slash = path.find('/', 1); slash != std::string::npos; slash = path.find('/', slash + 1))
+                {
+                    const std::string directory = root + path.substr(0, slash);
+                    if (!mkdir(directory.c_str(), 0755))
+                    {
+                        m_directories.push_back(directory);
+                    }
+                }
+                const std::string fullPath = root + path;
+                if (std::find(m_files.begin(), m_files.end(), fullPath) == m_files.end())
+                {
+                    m_files.push_back(fullPath);
+                }
+                std::ofstream file(fullPath, std::ios::binary | std::ios::trunc);
+                file << contents;
+            }
+        };
+
+        void AddOrinRoot(SyntheticRoot& root)
+        {
+            root.WriteFile("/etc/os-release",
+                "PRETTY_NAME=\"Ubuntu 22.04.4 LTS\"\n"
+                "NAME=\"Ubuntu\"\n"
+                "VERSION_ID=\"22.04\"\n");
+            root.WriteFile("/proc/sys/kernel/ostype", "Linux\n");
+            root.WriteFile("/proc/sys/kernel/osrelease", "5.15.148-tegra\n");
+            root.WriteFile("/proc/sys/kernel/arch", "aarch64\n");
+            root.WriteFile("/proc/cpuinfo",
+                "processor\t: 0\n"
+                "BogoMIPS\t: 62.50\n"
+                "CPU implementer\t: 0x41\n"
+                "\n"
+                "processor\t: 1\n"
+                "BogoMIPS\t: 62.50\n"
+                "CPU implementer\t: 0x41\n");
+            root.WriteFile("/proc/device-tree/model", std::string("NVIDIA Jetson AGX Orin Developer Kit", 36) + '\0');
+            root.WriteFile("/proc/meminfo",
+                "MemTotal:       64335836 kB\n"
+                "MemFree:        60245992 kB\n"
+                "MemAvailable:   61573444 kB\n");
+            root.WriteFile("/proc/loadavg", "0.52 0.38 0.31 2/1024 4242\n");
+            for (int cpu : { 0, 1, 2, 10 })
+            {
+                root.WriteFile("/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/cpufreq/scaling_cur_freq", "1984000\n");
+            }
+            root.WriteFile("/sys/devices/system/cpu/cpufreq/boost", "0\n");
+            root.WriteFile("/sys/class/devfreq/17000000.gpu/cur_freq", "918000000\n");
+            root.WriteFile("/sys/class/devfreq/17000000.gpu/device/load", "537\n");
+            root.WriteFile("/sys/class/thermal/thermal_zone0/type", "cpu-thermal\n");
+            root.WriteFile("/sys/class/thermal/thermal_zone0/temp", "48562\n");
+            root.WriteFile("/sys/class/thermal/thermal_zone1/type", "gpu-thermal\n");
+            root.WriteFile("/sys/class/thermal/thermal_zone1/temp", "46937\n");
+        }
+    } // namespace
+
+    NVPW_TEST_CASE("AppendState")
+    {
+        NVPW_SUBCASE("Orin")
+        {
+            SyntheticRoot root;
+            AddOrinRoot(root);
+            tool::linux_::State state;
+            state.rootPath = root.root;
+            NVPW_REQUIRE(tool::linux_::InitializeState(state));
+            nlohmann::ordered_json node;
+            tool::linux_::AppendState(state, node);
+            NVPW_CHECK(node["OS"] == "Ubuntu 22.04.4 LTS");
+            NVPW_CHECK(node["Processor"] == "NVIDIA Jetson AGX Orin Developer Kit");
+            NVPW_CHECK(node["NumberOfProcessors"] == "4");
+            NVPW_CHECK(node["PhysicalMemory"] == "64335836 kB");
+        }
+
+        NVPW_SUBCASE("Fallbacks")
+        {
+            ScopedNvPerfLogDisabler logDisabler;
+            SyntheticRoot root;
+            root.WriteFile("/etc/lsb-release", "DISTRIB_ID=Ubuntu\nDISTRIB_DESCRIPTION=\"Ubuntu 20.04.6 LTS\"\n");
+            root.WriteFile("/proc/cpuinfo",
+                "processor\t: 0\n"
+                "model name\t: Intel(R) Core(TM) i7-9700K CPU @ 3.60GHz\n"
+                "\n"
+                "processor\t: 1\n"
+                "model name\t: Intel(R) Core(TM) i7-9700K CPU @ 3.60GHz");
+            tool::linux_::State state;
+            state.rootPath = root.root;
+            nlohmann::ordered_json node;
+            tool::linux_::AppendState(state, node);
+            NVPW_CHECK(node["OS"] == "Ubuntu 20.04.6 LTS");
+            NVPW_CHECK(node["Processor"] == "Intel(R) Core(TM) i7-9700K CPU @ 3.60GHz");
+            NVPW_CHECK(node["NumberOfProcessors"] == "2");
+            NVPW_CHECK(node["PhysicalMemory"] == "Unknown");
+
+            root.WriteFile("/etc/lsb-release", "DISTRIB_ID=Ubuntu\n");
+            root.WriteFile("/proc/sys/kernel/ostype", "Linux\n");
+            root.WriteFile("/proc/sys/kernel/osrelease", "5.15.0-91-generic\n");
+            root.WriteFile("/proc/sys/kernel/arch", "x86_64\n");
+            NVPW_CHECK(tool::linux_::GetOSName(state) == "Linux(x86_64) 5.15.0-91-generic");
+        }
+
+        NVPW_SUBCASE("Empty Root")
+        {
+            ScopedNvPerfLogDisabler logDisabler;
+            tool::linux_::State state;
+            state.rootPath = "Offline_GpuDiag_missing";
+            nlohmann::ordered_json node;
+            tool::linux_::AppendState(state, node);
+            NVPW_CHECK(node["OS"] == "Unknown");
+            NVPW_CHECK(node["Processor"] == "Unknown");
+            NVPW_CHECK(node["NumberOfProcessors"] == "Unknown");
+            NVPW_CHECK(node["PhysicalMemory"] == "Unknown");
+
+            nlohmann::ordered_json dynamicNode;
+            tool::linux_::AppendDynamicState(state, dynamicNode);
+            NVPW_CHECK(dynamicNode.empty());
+        }
+    }
+
+    NVPW_TEST_CASE("AppendDynamicState")
+    {
+        SyntheticRoot root;
+        AddOrinRoot(root);
+        tool::linux_::State state;
+        state.rootPath = root.root;
+
+        nlohmann::ordered_json first;
+        tool::linux_::AppendDynamicState(state, first);
+        const nlohmann::ordered_json expected = nlohmann::ordered_json::parse(R"({
+            "LoadAverage": 0.52,
+            "AvailableMemoryKiB": 61573444,
+            "CPUFrequenciesMHz": { "cpu0": 1984.0, "cpu1": 1984.0, "cpu2": 1984.0, "cpu10": 1984.0 },
+            "GPUFrequencyMHz": 918.0,
+            "GPULoadPercent": 53.7,
+            "TemperaturesCelsius": { "cpu-thermal": 48.562, "gpu-thermal": 46.937 }
+        })");
+        NVPW_CHECK(first.dump() == expected.dump());
+        NVPW_CHECK(tool::linux_::DiffState(nlohmann::ordered_json(), first) == first);
+        NVPW_CHECK(tool::linux_::DiffState(first, first).empty());
+
+        root.WriteFile("/sys/devices/system/cpu/cpu2/cpufreq/scaling_cur_freq", "729600\n");
+        root.WriteFile("/sys/class/devfreq/17000000.gpu/device/load", "0\n");
+        root.WriteFile("/sys/class/thermal/thermal_zone1/temp", "not a number\n");
+        nlohmann::ordered_json second;
+        tool::linux_::AppendDynamicState(state, second);
+        const nlohmann::ordered_json delta = tool::linux_::DiffState(first, second);
+        const nlohmann::ordered_json expectedDelta = nlohmann::ordered_json::parse(R"({
+            "CPUFrequenciesMHz": { "cpu2": 729.6 },
+            "GPULoadPercent": 0.0,
+            "TemperaturesCelsius": { "gpu-thermal": null }
+        })");
+        NVPW_CHECK(delta.dump() == expectedDelta.dump());
+    }
+#endif
+
+    NVPW_TEST_SUITE_END();
+
+}}} // nv::perf::test
@@ -19,6 +19,9 @@
 #include <json/json.hpp>
 #include <functional>
 #include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <sstream>
 #include <string.h>
 
 namespace nv { namespace perf { namespace test {
@@ -200,6 +203,212 @@ namespace nv { namespace perf { namespace test {
             NVPW_CHECK_NE(nlohmann::json::parse(R"({"c": )" + FormatJsDouble(-INFINITY) + "}", nullptr, false).type(), nlohmann::json::value_t::discarded);
         }
     }
+
+    // Compares the previous way of emitting per-range reports (build the JSON in a stringstream, splice it into a copy of the template, then
+    // fputs) against streaming through BufferedFileSinks from a thread pool. Keys and values are synthetic, so no metrics evaluator is needed.
+    NVPW_TEST_CASE("Report Writing Benchmark")
+    {
+#if defined (__aarch64__)
+        const char* pChipName = "GA10B";
+#else
+        const char* pChipName = "GA102";
+#endif
+        const size_t NumRanges = 32;
+        const char* pLeafName = "Offline_HtmlReport_Benchmark";
+
+        ReportLayout reportLayout = {};
+        reportLayout.gpuName = "Benchmark GPU";
+        reportLayout.chipName = pChipName;
+        reportLayout.perRange.definition = PerRangeReport::GetReportDefinition(pChipName);
+        NVPW_REQUIRE(reportLayout.perRange.definition.pReportHtml);
+
+        const ReportDefinition& definition = reportLayout.perRange.definition;
+        const char* const* ppMetricNames[NVPW_METRIC_TYPE__COUNT] = { definition.ppCounterNames, definition.ppRatioNames, definition.ppThroughputNames };
+        const size_t numMetricNames[NVPW_METRIC_TYPE__COUNT] = { definition.numCounters, definition.numRatios, definition.numThroughputs };
+        const char* const pSubmetricNames[NVPW_METRIC_TYPE__COUNT][4] = {
+            { "sum", "sum.per_second", "avg.pct_of_peak_sustained_elapsed", "max" },
+            { "pct", "ratio", nullptr, nullptr },
+            { "avg.pct_of_peak_sustained_elapsed", nullptr, nullptr, nullptr },
+        };
+        ReportJsonKeys keys;
+        size_t numValuesPerRange = 0;
+        for (size_t metricType = 0; metricType < NVPW_METRIC_TYPE__COUNT; ++metricType)
+        {
+            ReportJsonKeys::PerMetricType& perTypeKeys = keys.perMetricType[metricType];
+            for (size_t ii = 0; ii < 4 && pSubmetricNames[metricType][ii]; ++ii)
+            {
+                perTypeKeys.submetricKeys.push_back(std::string("\"") + pSubmetricNames[metricType][ii] + "\": ");
+            }
+            for (size_t ii = 0; ii < numMetricNames[metricType]; ++ii)
+            {
+                perTypeKeys.baseMetricKeys.push_back(std::string("\"") + ppMetricNames[metricType][ii] + "\": { ");
+                if (metricType == NVPW_METRIC_TYPE_COUNTER)
+                {
+                    perTypeKeys.dimUnits.push_back("cycles");
+                }
+            }
+            numValuesPerRange += perTypeKeys.baseMetricKeys.size() * perTypeKeys.submetricKeys.size();
+        }
+
+        ReportData reportData = {};
+        reportData.reportDirectoryName = ".";
+        reportData.ranges.resize(NumRanges);
+        for (size_t rangeIndex = 0; rangeIndex < NumRanges; ++rangeIndex)
+        {
+            ReportData::RangeData& rangeData = reportData.ranges[rangeIndex];
+            rangeData.fullName = std::string("Frame/") + pLeafName;
+            rangeData.leafName = pLeafName;
+            rangeData.perRangeReportValues.resize(numValuesPerRange);
+            for (size_t ii = 0; ii < numValuesPerRange; ++ii)
+            {
+                rangeData.perRangeReportValues[ii] = (ii % 3) ? (double)(ii * 7919 % 100003) : (double)ii / (rangeIndex + 3);
+            }
+        }
+
+        auto measureNs = [](auto&& func) {
+            const auto begin = std::chrono::steady_clock::now();
+            func();
+            const auto end = std::chrono::steady_clock::now();
+            return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+        };
+        auto getFileName = [&](size_t rangeIndex) {
+            return reportData.reportDirectoryName + NV_PERF_PATH_SEPARATOR + GetRangeFileName(rangeIndex, pLeafName);
+        };
+        auto getDataFileName = [&](size_t rangeIndex) {
+            return reportData.reportDirectoryName + NV_PERF_PATH_SEPARATOR + GetRangeFileName(rangeIndex, pLeafName, ".js");
+        };
+        const std::string viewerFileName = reportData.reportDirectoryName + NV_PERF_PATH_SEPARATOR + PerRangeReport::GetSharedViewerFileName();
+        auto getFileSize = [](const std::string& fileName) {
+            size_t size = 0;
+            if (FILE* pFile = OpenFile(fileName.c_str(), "rb"))
+            {
+                fseek(pFile, 0, SEEK_END);
+                size = (size_t)ftell(pFile);
+                fclose(pFile);
+            }
+            return size;
+        };
+        auto getTotalFileSize = [&]() {
+            size_t totalSize = 0;
+            for (size_t rangeIndex = 0; rangeIndex < NumRanges; ++rangeIndex)
+            {
+                totalSize += getFileSize(getFileName(rangeIndex));
+            }
+            return totalSize;
+        };
+
+        const double legacyNs = measureNs([&]() {
+            for (size_t rangeIndex = 0; rangeIndex < NumRanges; ++rangeIndex)
+            {
+                const ReportData::RangeData& rangeData = reportData.ranges[rangeIndex];
+                std::stringstream sstream;
+                sstream << "\"rangeName\": \"" << rangeData.fullName << "\",\n";
+                size_t metricIndex = 0;
+                for (size_t metricType = 0; metricType < NVPW_METRIC_TYPE__COUNT; ++metricType)
+                {
+                    const ReportJsonKeys::PerMetricType& perTypeKeys = keys.perMetricType[metricType];
+                    sstream << (metricType ? ", " : "") << "\"" << ToCString(static_cast<NVPW_MetricType>(metricType)) << "\": {\n";
+                    for (size_t baseMetricIndex = 0; baseMetricIndex < perTypeKeys.baseMetricKeys.size(); ++baseMetricIndex)
+                    {
+                        sstream << (baseMetricIndex ? ", " : "") << perTypeKeys.baseMetricKeys[baseMetricIndex];
+                        for (size_t submetricIndex = 0; submetricIndex < perTypeKeys.submetricKeys.size(); ++submetricIndex)
+                        {
+                            char buf[128];
+                            snprintf(buf, 128, "%f", rangeData.perRangeReportValues[metricIndex++]);
+                            sstream << (submetricIndex ? ", " : "") << perTypeKeys.submetricKeys[submetricIndex] << std::string(buf);
+                        }
+                        sstream << " }\n";
+                    }
+                    sstream << "}\n";
+                }
+                if (FILE* pFile = OpenFile(getFileName(rangeIndex).c_str(), "wb"))
+                {
+                    const std::string reportHtml = MakeReport(definition, sstream.str());
+                    fputs(reportHtml.c_str(), pFile);
+                    fclose(pFile);
+                }
+            }
+        });
+        const size_t legacyBytes = getTotalFileSize();
+
+        const double streamingNs = measureNs([&]() {
+            PerRangeReport::WriteHtmlReportFiles(keys, reportLayout, reportData);
+        });
+        const size_t streamingBytes = getTotalFileSize();
+
+        ThreadPool threadPool;
+        NVPW_REQUIRE(threadPool.Initialize(0));
+        const double parallelNs = measureNs([&]() {
+            PerRangeReport::WriteHtmlReportFiles(keys, reportLayout, reportData, &threadPool);
+        });
+        NVPW_CHECK_EQ(getTotalFileSize(), streamingBytes);
+
+        const double sharedViewerNs = measureNs([&]() {
+            PerRangeReport::WriteSharedViewerHtmlReportFiles(keys, reportLayout, reportData, &threadPool);
+        });
+        size_t sharedViewerBytes = getFileSize(viewerFileName);
+        for (size_t rangeIndex = 0; rangeIndex < NumRanges; ++rangeIndex)
+        {
+            sharedViewerBytes += getFileSize(getDataFileName(rangeIndex));
+        }
+        NVPW_CHECK_LT(sharedViewerBytes, streamingBytes / 4);
+
+        // spot check that the streamed JSON is well-formed
+        {
+            std::string json;
+            StringSink sink(json);
+            JsonWriter<StringSink> writer(sink);
+            PerRangeReport::WriteJsonContents(writer, keys, reportLayout, reportData, NumRanges - 1);
+            const auto j = nlohmann::json::parse("{" + json + "}", nullptr, false);
+            NVPW_REQUIRE_NE(j.type(), nlohmann::json::value_t::discarded);
+            NVPW_CHECK_EQ(j["counters"].size(), definition.numCounters);
+        }
+
+        // the shared viewer's layout and data files must describe the same values
+        {
+            std::string json;
+            StringSink sink(json);
+            JsonWriter<StringSink> writer(sink);
+            PerRangeReport::WriteSharedViewerLayout(writer, keys, reportLayout, reportData);
+            const auto layout = nlohmann::json::parse(json, nullptr, false);
+            NVPW_REQUIRE_NE(layout.type(), nlohmann::json::value_t::discarded);
+            NVPW_REQUIRE_EQ(layout["metricTypes"].size(), (size_t)NVPW_METRIC_TYPE__COUNT);
+            NVPW_CHECK_EQ(layout["metricTypes"][0]["name"], "counters");
+            NVPW_CHECK_EQ(layout["metricTypes"][0]["metrics"].size(), definition.numCounters);
+            NVPW_CHECK_EQ(layout["metricTypes"][0]["dimUnits"].size(), definition.numCounters);
+            NVPW_CHECK_EQ(layout["metricTypes"][1]["submetrics"][1], "ratio");
+
+            json.clear();
+            PerRangeReport::WriteSharedViewerRangeData(writer, reportData, NumRanges - 1);
+            const char* pPrefix = "g_nvperfRange = ";
+            NVPW_REQUIRE_EQ(json.compare(0, strlen(pPrefix), pPrefix), 0);
+            const size_t end = json.rfind(';');
+            NVPW_REQUIRE_NE(end, std::string::npos);
+            const auto data = nlohmann::json::parse(json.substr(strlen(pPrefix), end - strlen(pPrefix)), nullptr, false);
+            NVPW_REQUIRE_NE(data.type(), nlohmann::json::value_t::discarded);
+            NVPW_CHECK_EQ(data["rangeName"], reportData.ranges[NumRanges - 1].fullName);
+            NVPW_REQUIRE_EQ(data["values"].size(), numValuesPerRange);
+            NVPW_CHECK_EQ(data["values"][1].get<double>(), reportData.ranges[NumRanges - 1].perRangeReportValues[1]);
+
+            NVPW_CHECK_EQ(PerRangeReport::GetRangeLink(3, "Draw", PerRangeHtmlReport::sharedViewer), "range.html#00003_Draw");
+            NVPW_CHECK_EQ(PerRangeReport::GetRangeLink(3, "Draw", PerRangeHtmlReport::standaloneFiles), "00003_Draw.html");
+        }
+
+        for (size_t rangeIndex = 0; rangeIndex < NumRanges; ++rangeIndex)
+        {
+            std::remove(getFileName(rangeIndex).c_str());
+            std::remove(getDataFileName(rangeIndex).c_str());
+        }
+        std::remove(viewerFileName.c_str());
+
+        auto toMBps = [](size_t bytes, double ns) { return (double)bytes / ns * 1e9 / (1024 * 1024); };
+        NVPW_TEST_MESSAGE("ranges: ", NumRanges, ", values per range: ", numValuesPerRange);
+        NVPW_TEST_MESSAGE("stringstream + fputs: ", legacyNs / NumRanges / 1000, " us/range, ", toMBps(legacyBytes, legacyNs), " MB/s");
+        NVPW_TEST_MESSAGE("streaming: ", streamingNs / NumRanges / 1000, " us/range, ", toMBps(streamingBytes, streamingNs), " MB/s");
+        NVPW_TEST_MESSAGE("streaming, ", threadPool.GetNumWorkers(), " threads: ", parallelNs / NumRanges / 1000, " us/range, ", toMBps(streamingBytes, parallelNs), " MB/s");
+        NVPW_TEST_MESSAGE("shared viewer, ", threadPool.GetNumWorkers(), " threads: ", sharedViewerNs / NumRanges / 1000, " us/range, ", sharedViewerBytes, " bytes instead of ", streamingBytes);
+    }
+
     NVPW_TEST_SUITE_END();
 
 }}} // nv::perf::test
\ No newline at end of file
@@ -25,7 +25,11 @@
 #define RYML_SINGLE_HDR_DEFINE_NOW
 #include <ryml_all.hpp>
 
+#include <json/json.hpp>
+
+#include <chrono>
 #include <iostream>
+#include <random>
 #include "Offline_HudDataModel_SupportedChips.h"
 
 namespace nv { namespace perf { namespace test {
@@ -84,6 +88,330 @@ namespace nv { namespace perf { namespace test {
             NVPW_CHECK(buffer.Get(2)       == 35);
             NVPW_CHECK(buffer.Get(3)       ==  6);
         }
+
+        NVPW_SUBCASE("CopyTo")
+        {
+            hud::RingBuffer<int> buffer(4);
+            buffer.Push(5);
+            buffer.Push(15);
+            buffer.Push(25);
+            int values[4] = {};
+            buffer.CopyTo(1, 2, values);
+            NVPW_CHECK(values[0] == 15);
+            NVPW_CHECK(values[1] == 25);
+
+            buffer.Push(35);
+            buffer.Push(6);
+            buffer.Push(16);
+            buffer.CopyTo(0, 4, values); // wraps around
+            NVPW_CHECK(values[0] == 25);
+            NVPW_CHECK(values[1] == 35);
+            NVPW_CHECK(values[2] ==  6);
+            NVPW_CHECK(values[3] == 16);
+        }
+    }
+
+    // /// MetricHistory //////////////////////////////////////////////////////
+
+    NVPW_TEST_CASE("MetricHistory")
+    {
+        NVPW_SUBCASE("Empty")
+        {
+            hud::MetricHistoryView view;
+            NVPW_CHECK(view.Size() == 0);
+            NVPW_CHECK(view.MaxSize() == 0);
+        }
+
+        NVPW_SUBCASE("Aligned Columns")
+        {
+            hud::MetricHistory history;
+            history.Initialize(3, 5);
+            for (size_t column = 0; column < history.NumColumns(); ++column)
+            {
+                NVPW_CHECK(reinterpret_cast<uintptr_t>(history.ColumnData(column)) % 64 == 0);
+            }
+        }
+
+        NVPW_SUBCASE("Shared Rows")
+        {
+            hud::MetricHistory history;
+            history.Initialize(2, 4);
+            hud::MetricHistoryView view0(&history, 0, 1.0);
+            hud::MetricHistoryView view1(&history, 1, 2.0);
+            auto push = [&](double value0, double value1) {
+                history.ColumnData(0)[history.WriteIndex()] = value0;
+                history.ColumnData(1)[history.WriteIndex()] = value1;
+                history.CommitRow();
+            };
+
+            push(5, 50);
+            push(15, 150);
+            NVPW_CHECK(view0.Size()    ==  2);
+            NVPW_CHECK(view0.MaxSize() ==  4);
+            NVPW_CHECK(view0.Back()    ==  5);
+            NVPW_CHECK(view0.Front()   == 15);
+            NVPW_CHECK(view1.Get(0)    == 100);  // with multiplier
+            NVPW_CHECK(view1.Get(1)    == 300);
+
+            push(25, 250);
+            push(35, 350);
+            push( 6,  60);
+            NVPW_CHECK(history.Size()       ==  4);
+            NVPW_CHECK(history.WriteIndex() ==  1);
+            NVPW_CHECK(view0.Back()         == 15);
+            NVPW_CHECK(view0.Front()        ==  6);
+            NVPW_CHECK(view0.Get(0)         == 15);
+            NVPW_CHECK(view0.Get(1)         == 25);
+            NVPW_CHECK(view0.Get(2)         == 35);
+            NVPW_CHECK(view0.Get(3)         ==  6);
+            NVPW_CHECK(view1.Front()        == 120);
+            NVPW_CHECK(view1.Back()         == 300);
+
+            double values[4] = {};
+            view1.CopyTo(1, 3, values);
+            NVPW_CHECK(values[0] == 500);
+            NVPW_CHECK(values[1] == 700);
+            NVPW_CHECK(values[2] == 120);
+        }
+
+        NVPW_SUBCASE("GetMinMax")
+        {
+            // sizes below, at and above the pyramid's block sizes, and rows pushed well past wrapping around
+            for (const size_t maxSize : { 1, 7, 16, 33, 600, 5000 })
+            {
+                hud::MetricHistory history;
+                history.Initialize(2, maxSize);
+                std::mt19937 rng{ uint32_t(maxSize) };
+                std::uniform_int_distribution<int> distribution(0, 50); // small range, to exercise ties
+                const size_t numRows = maxSize * 2 + 37;
+                for (size_t row = 0; row < numRows; ++row)
+                {
+                    history.ColumnData(0)[history.WriteIndex()] = distribution(rng);
+                    history.ColumnData(1)[history.WriteIndex()] = double(row);
+                    history.CommitRow();
+
+                    if (row % 97 != 0 && row + 1 != numRows)
+                    {
+                        continue;
+                    }
+                    for (size_t trial = 0; trial < 20; ++trial)
+                    {
+                        size_t beginIndex = rng() % history.Size();
+                        size_t endIndex = rng() % history.Size() + 1;
+                        if (beginIndex >= endIndex)
+                        {
+                            std::swap(beginIndex, endIndex);
+                            endIndex += 1;
+                        }
+                        size_t minIndex = beginIndex;
+                        size_t maxIndex = beginIndex;
+                        for (size_t index = beginIndex; index < endIndex; ++index)
+                        {
+                            minIndex = (history.Get(0, index) < history.Get(0, minIndex)) ? index : minIndex;
+                            maxIndex = (history.Get(0, index) > history.Get(0, maxIndex)) ? index : maxIndex;
+                        }
+                        const hud::MinMax minMax = history.GetMinMax(0, beginIndex, endIndex);
+                        NVPW_REQUIRE(minMax.minValue == history.Get(0, minIndex));
+                        NVPW_REQUIRE(minMax.maxValue == history.Get(0, maxIndex));
+                        NVPW_REQUIRE(minMax.minIndex == minIndex);
+                        NVPW_REQUIRE(minMax.maxIndex == maxIndex);
+
+                        const hud::MinMax ramp = history.GetMinMax(1, beginIndex, endIndex);
+                        NVPW_REQUIRE(ramp.minIndex == beginIndex);
+                        NVPW_REQUIRE(ramp.maxIndex == endIndex - 1);
+                    }
+                }
+            }
+        }
+
+        NVPW_SUBCASE("GetMinMax with Negative Multiplier")
+        {
+            hud::MetricHistory history;
+            history.Initialize(1, 4);
+            hud::MetricHistoryView view(&history, 0, -1.0);
+            for (const double value : { 3.0, 1.0, 4.0, 2.0 })
+            {
+                history.ColumnData(0)[history.WriteIndex()] = value;
+                history.CommitRow();
+            }
+            const hud::MinMax minMax = view.GetMinMax(0, 4);
+            NVPW_CHECK(minMax.minValue == -4.0);
+            NVPW_CHECK(minMax.minIndex == 2);
+            NVPW_CHECK(minMax.maxValue == -1.0);
+            NVPW_CHECK(minMax.maxIndex == 1);
+        }
+    }
+
+    // /// MetricStatistics ///////////////////////////////////////////////////
+
+    NVPW_TEST_CASE("MetricStatistics")
+    {
+        hud::MetricHistory history;
+        history.Initialize(2, 16); // the history only covers the last 16 rows, the statistics all of them
+        hud::MetricStatisticsOptions options;
+        options.decayTimeConstants = { 1.0, 100.0, 0.0 }; // the invalid one is dropped
+        hud::MetricStatistics statistics;
+        statistics.Initialize(1, options); // only the leading column
+        hud::MetricStatisticsView view(&statistics, 0, 2.0);
+        NVPW_CHECK(view.IsEnabled());
+        NVPW_CHECK(view.Count() == 0);
+        NVPW_CHECK(std::isnan(view.Quantile(0.5)));
+        NVPW_REQUIRE(view.NumDecayedAverages() == 2);
+        NVPW_CHECK(std::isnan(view.DecayedAverage(0)));
+
+        // a signal that steps from 10 to 20 halfway through, sampled every 10 ms
+        auto addRows = [&](size_t numRows, double value, double& timestamp) {
+            for (size_t row = 0; row < numRows; ++row)
+            {
+                history.ColumnData(0)[history.WriteIndex()] = value;
+                history.ColumnData(1)[history.WriteIndex()] = -1.0;
+                statistics.AddRow(timestamp, history);
+                history.CommitRow();
+                timestamp += 0.01;
+            }
+        };
+        double timestamp = 0.0;
+        addRows(1000, 10.0, timestamp);
+        NVPW_CHECK(view.DecayedAverage(0) == doctest::Approx(20.0));
+        addRows(1000, 20.0, timestamp);
+
+        NVPW_CHECK(statistics.NumRows() == 2000);
+        NVPW_CHECK(view.Count() == 2000);
+        NVPW_CHECK(view.Min() == 20.0);
+        NVPW_CHECK(view.Max() == 40.0);
+        NVPW_CHECK(view.Mean() == doctest::Approx(30.0));
+        NVPW_CHECK(view.Quantile(0.25) == doctest::Approx(20.0).epsilon(0.02));
+        NVPW_CHECK(view.Quantile(0.99) == doctest::Approx(40.0).epsilon(0.02));
+
+        // 10 s after the step, the 1 s average has converged and the 100 s one has moved by ~10%
+        NVPW_CHECK(view.DecayTimeConstant(0) == 1.0);
+        NVPW_CHECK(view.DecayedAverage(0) == doctest::Approx(40.0).epsilon(0.001));
+        NVPW_CHECK(view.DecayedAverage(1) == doctest::Approx(20.0 + 20.0 * (1.0 - std::exp(-10.0 / 100.0))).epsilon(0.01));
+
+        statistics.Clear();
+        NVPW_CHECK(view.Count() == 0);
+        NVPW_CHECK(std::isnan(view.DecayedAverage(1)));
+
+        hud::MetricStatisticsView disabledView;
+        NVPW_CHECK(!disabledView.IsEnabled());
+        NVPW_CHECK(disabledView.Count() == 0);
+        NVPW_CHECK(disabledView.NumDecayedAverages() == 0);
+    }
+
+    // /// TimePlot Decimation ////////////////////////////////////////////////
+
+    NVPW_TEST_CASE("TimePlot Decimation")
+    {
+        const size_t maxSize = 100000; // a 10 s window at 100 us sampling
+        hud::RingBuffer<double> timestampBuffer(maxSize);
+        hud::MetricHistory history;
+        history.Initialize(1, maxSize);
+        hud::MetricHistoryView view(&history, 0, 1.0);
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<double> distribution(0.0, 100.0);
+        const size_t numRows = maxSize + maxSize / 3;
+        for (size_t row = 0; row < numRows; ++row)
+        {
+            timestampBuffer.Push(double(row) * 0.0001);
+            history.ColumnData(0)[history.WriteIndex()] = (row == numRows - 1000) ? 1000.0 : distribution(rng); // one spike
+            history.CommitRow();
+        }
+
+        NVPW_SUBCASE("FindTimePlotWindowBegin")
+        {
+            NVPW_CHECK(hud::FindTimePlotWindowBegin(hud::RingBuffer<double>(4), 1.0) == 0);
+            for (const double timeWidth : { 0.0, 0.00005, 0.5, 9.99, 100.0 })
+            {
+                size_t expected = 0;
+                while (timestampBuffer.Get(expected) < timestampBuffer.Front() - timeWidth)
+                {
+                    ++expected;
+                }
+                NVPW_CHECK(hud::FindTimePlotWindowBegin(timestampBuffer, timeWidth) == expected);
+            }
+        }
+
+        NVPW_SUBCASE("Few Rows Are Copied")
+        {
+            std::vector<double> timestamps;
+            std::vector<double> values;
+            NVPW_CHECK(!hud::DecimateTimePlotSignal(timestampBuffer, view, maxSize - 10, maxSize, 100, timestamps, values));
+            NVPW_REQUIRE(values.size() == 10);
+            for (size_t index = 0; index < 10; ++index)
+            {
+                NVPW_CHECK(timestamps[index] == timestampBuffer.Get(maxSize - 10 + index));
+                NVPW_CHECK(values[index] == view.Get(maxSize - 10 + index));
+            }
+        }
+
+        NVPW_SUBCASE("Many Rows Are Reduced")
+        {
+            const size_t beginIndex = 123;
+            const size_t maxPoints = 2 * 1000;
+            std::vector<double> timestamps;
+            std::vector<double> values;
+            std::vector<size_t> rowIndices;
+            NVPW_CHECK(hud::DecimateTimePlotSignal(timestampBuffer, view, beginIndex, maxSize, maxPoints, timestamps, values, &rowIndices));
+            NVPW_CHECK(values.size() <= maxPoints);
+            NVPW_CHECK(values.size() > maxPoints / 2);
+            NVPW_REQUIRE(rowIndices.size() == values.size());
+            double maxValue = 0.0;
+            double minValue = 1000.0;
+            for (size_t pointIndex = 0; pointIndex < values.size(); ++pointIndex)
+            {
+                NVPW_CHECK(rowIndices[pointIndex] >= beginIndex);
+                NVPW_CHECK(values[pointIndex] == view.Get(rowIndices[pointIndex]));
+                NVPW_CHECK(timestamps[pointIndex] == timestampBuffer.Get(rowIndices[pointIndex]));
+                if (pointIndex)
+                {
+                    NVPW_CHECK(rowIndices[pointIndex - 1] < rowIndices[pointIndex]);
+                }
+                maxValue = (std::max)(maxValue, values[pointIndex]);
+                minValue = (std::min)(minValue, values[pointIndex]);
+            }
+            const hud::MinMax expected = view.GetMinMax(beginIndex, maxSize);
+            NVPW_CHECK(maxValue == 1000.0); // the spike survives
+            NVPW_CHECK(minValue == expected.minValue);
+        }
+
+        NVPW_SUBCASE("Benchmark")
+        {
+            const size_t maxPoints = 2 * 1920;
+            const size_t numIterations = 20;
+            const size_t beginIndex = hud::FindTimePlotWindowBegin(timestampBuffer, 10.0);
+
+            // what the renderer used to do: a linear scan for the window, then every point through Get()
+            double checksum = 0.0;
+            const auto perPointStart = std::chrono::steady_clock::now();
+            for (size_t iteration = 0; iteration < numIterations; ++iteration)
+            {
+                size_t dataOffset = 0;
+                const double thresholdTimestamp = timestampBuffer.Front() - 10.0;
+                while (dataOffset < timestampBuffer.Size() && timestampBuffer.Get(dataOffset) < thresholdTimestamp)
+                {
+                    ++dataOffset;
+                }
+                for (size_t index = dataOffset; index < view.Size(); ++index)
+                {
+                    checksum += timestampBuffer.Get(index) + view.Get(index);
+                }
+            }
+            const double perPointNs = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - perPointStart).count();
+
+            std::vector<double> timestamps;
+            std::vector<double> values;
+            const auto decimatedStart = std::chrono::steady_clock::now();
+            for (size_t iteration = 0; iteration < numIterations; ++iteration)
+            {
+                hud::DecimateTimePlotSignal(timestampBuffer, view, hud::FindTimePlotWindowBegin(timestampBuffer, 10.0), view.Size(), maxPoints, timestamps, values);
+                checksum += values[0];
+            }
+            const double decimatedNs = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - decimatedStart).count();
+            NVPW_CHECK(checksum != 0.0);
+
+            NVPW_TEST_MESSAGE("rows: ", view.Size() - beginIndex, ", per-point Get(): ", perPointNs / numIterations / 1000, " us/signal, ",
+                "decimated to ", values.size(), " points: ", decimatedNs / numIterations / 1000, " us/signal");
+        }
     }
 
     // /// Helper /////////////////////////////////////////////////////////////
@@ -347,6 +675,15 @@ namespace nv { namespace perf { namespace test {
             ParseYaml(yaml, parseMetricSignal);
             NVPW_CHECK(valid == false);
         }
+
+        for (const char* pMetric : { "gr__cycles_elapsed.max", "a1", "Ab._9" })
+        {
+            NVPW_CHECK(hud::MetricSignal::IsValidMetricName(pMetric));
+        }
+        for (const char* pMetric : { "", "a", "1a", "_a", ".a", "a-b", "a b", "a\n" })
+        {
+            NVPW_CHECK(!hud::MetricSignal::IsValidMetricName(pMetric));
+        }
     }
 
     NVPW_TEST_CASE("Panel::FromYaml")
@@ -796,6 +1133,202 @@ namespace nv { namespace perf { namespace test {
         }
     }
 
+    NVPW_TEST_CASE("HudPresetCache")
+    {
+        const ScopedTemporaryFile temporaryFile("Offline_HudPresetCache.bin");
+        const char* pPath = temporaryFile.Path();
+
+        auto printConfigurations = [](const hud::HudDataModel& model) {
+            std::ostringstream stream;
+            for (const hud::HudConfiguration& configuration : model.GetConfigurations())
+            {
+                configuration.Print(stream);
+            }
+            return stream.str();
+        };
+
+        // loads every preset into its own model, and returns the printed configurations
+        auto loadPresets = [&](const hud::HudPresets& presets) {
+            std::vector<std::string> configurations;
+            for (const hud::HudPreset& preset : presets.GetPresets())
+            {
+                hud::HudDataModel model;
+                NVPW_REQUIRE(model.Load(preset));
+                configurations.push_back(printConfigurations(model));
+            }
+            return configurations;
+        };
+
+        NVPW_SUBCASE("Round Trip")
+        {
+            std::vector<std::string> coldConfigurations;
+            std::vector<std::string> presetNames;
+            {
+                ScopedNvPerfLogDisabler logDisabler;
+                hud::HudPresetCache cache;
+                NVPW_CHECK(!cache.Load(pPath));
+                hud::HudPresets presets;
+                NVPW_REQUIRE(presets.Initialize(exampleChip, &cache));
+                NVPW_CHECK(cache.IsDirty());
+                for (const hud::HudPreset& preset : presets.GetPresets())
+                {
+                    NVPW_CHECK(preset.pCache == &cache);
+                    presetNames.push_back(preset.name);
+                }
+                coldConfigurations = loadPresets(presets);
+                NVPW_REQUIRE(cache.Save(pPath));
+                NVPW_CHECK(!cache.IsDirty());
+            }
+
+            hud::HudPresetCache cache;
+            NVPW_REQUIRE(cache.Load(pPath));
+            hud::HudPresets presets;
+            NVPW_REQUIRE(presets.Initialize(exampleChip, &cache));
+            NVPW_REQUIRE(presets.GetPresets().size() == presetNames.size());
+            for (size_t presetIndex = 0; presetIndex < presetNames.size(); ++presetIndex)
+            {
+                NVPW_CHECK(presets.GetPresets()[presetIndex].name == presetNames[presetIndex]);
+                NVPW_CHECK(presets.GetPresets()[presetIndex].pYaml);
+            }
+            NVPW_CHECK(loadPresets(presets) == coldConfigurations);
+            NVPW_CHECK(!cache.IsDirty());
+
+            // presets loaded from elsewhere are not keyed by the cache
+            const std::string yaml =
+                "configurations:\n"
+                "  - name: myConfig1\n"
+                "    speed: Low\n"
+                "    panels:\n"
+                "      - myPanel1\n";
+            NVPW_REQUIRE(presets.LoadFromString(yaml.c_str(), "valid.yaml"));
+            NVPW_CHECK(presets.GetPreset("myConfig1").pCache == nullptr);
+            std::remove(pPath);
+        }
+
+        NVPW_SUBCASE("Stale or Corrupt File")
+        {
+            ScopedNvPerfLogDisabler logDisabler;
+            size_t fileSize = 0;
+            {
+                hud::HudPresetCache cache;
+                hud::HudPresets presets;
+                NVPW_REQUIRE(presets.Initialize(exampleChip, &cache));
+                loadPresets(presets);
+                NVPW_REQUIRE(cache.Save(pPath));
+            }
+            {
+                hud::HudPresetCache cache;
+                NVPW_REQUIRE(cache.Load(pPath));
+                NVPW_CHECK(!cache.Validate(exampleChip, 0x1234));
+                NVPW_CHECK(cache.GetPresets().empty());
+                NVPW_CHECK(cache.IsDirty());
+            }
+            {
+                FILE* pFile = fopen(pPath, "r+b");
+                NVPW_REQUIRE(pFile);
+                fseek(pFile, 0, SEEK_END);
+                fileSize = (size_t)ftell(pFile);
+                fseek(pFile, (long)fileSize - 1, SEEK_SET);
+                const int lastByte = fgetc(pFile);
+                fseek(pFile, (long)fileSize - 1, SEEK_SET);
+                fputc(lastByte ^ 0xff, pFile);
+                fclose(pFile);
+
+                hud::HudPresetCache cache;
+                NVPW_CHECK(!cache.Load(pPath));
+                hud::HudPresets presets;
+                NVPW_REQUIRE(presets.Initialize(exampleChip, &cache)); // falls back to YAML
+                NVPW_CHECK(!presets.GetPresets().empty());
+                NVPW_CHECK(cache.IsDirty());
+            }
+            {
+                std::vector<char> truncated(sizeof(hud::HudPresetCacheHeader) + 4, 0);
+                FILE* pFile = fopen(pPath, "wb");
+                NVPW_REQUIRE(pFile);
+                fwrite(truncated.data(), 1, truncated.size(), pFile);
+                fclose(pFile);
+
+                hud::HudPresetCache cache;
+                NVPW_CHECK(!cache.Load(pPath));
+            }
+            std::remove(pPath);
+        }
+
+        NVPW_SUBCASE("Resolved Metrics")
+        {
+            hud::HudResolvedMetric metric;
+            metric.flags = hud::HudResolvedMetric::HasRequest | hud::HudResolvedMetric::HasUnit | hud::HudResolvedMetric::HasMaxMetric;
+            metric.request.metricIndex = 1234;
+            metric.request.metricType = NVPW_METRIC_TYPE_COUNTER;
+            metric.request.rollupOp = NVPW_ROLLUP_OP_SUM;
+            metric.request.submetric = NVPW_SUBMETRIC_PER_SECOND;
+            metric.unit = "cycle";
+            metric.maxMetric = "gr__cycles_elapsed.sum.peak_sustained_elapsed_per_second";
+            {
+                hud::HudPresetCache cache;
+                NVPW_CHECK(!cache.Validate("TestChip", 42));
+                cache.SetPresets({ { "TestPreset", "test.yaml" } });
+                cache.AddMetric("gr__cycles_elapsed.sum.per_second", metric);
+                NVPW_REQUIRE(cache.Save(pPath));
+            }
+
+            hud::HudPresetCache cache;
+            NVPW_REQUIRE(cache.Load(pPath));
+            NVPW_CHECK(cache.Validate("TestChip", 42));
+            NVPW_CHECK(cache.GetNumMetrics() == 1);
+            NVPW_CHECK(!cache.FindMetric("gr__cycles_elapsed.sum"));
+            const hud::HudResolvedMetric* pMetric = cache.FindMetric("gr__cycles_elapsed.sum.per_second");
+            NVPW_REQUIRE(pMetric);
+            NVPW_CHECK(pMetric->flags == metric.flags);
+            NVPW_CHECK(pMetric->request.metricIndex == metric.request.metricIndex);
+            NVPW_CHECK(pMetric->request.metricType == metric.request.metricType);
+            NVPW_CHECK(pMetric->request.rollupOp == metric.request.rollupOp);
+            NVPW_CHECK(pMetric->request.submetric == metric.request.submetric);
+            NVPW_CHECK(pMetric->description.empty());
+            NVPW_CHECK(pMetric->unit == metric.unit);
+            NVPW_CHECK(pMetric->maxMetric == metric.maxMetric);
+            std::remove(pPath);
+        }
+
+        NVPW_SUBCASE("Benchmark")
+        {
+            {
+                hud::HudPresetCache cache;
+                hud::HudPresets presets;
+                NVPW_REQUIRE(presets.Initialize(exampleChip, &cache));
+                loadPresets(presets);
+                NVPW_REQUIRE(cache.Save(pPath));
+            }
+
+            const size_t NumRepeats = 5;
+            double coldMs = std::numeric_limits<double>::max();
+            double warmMs = std::numeric_limits<double>::max();
+            for (size_t repeat = 0; repeat < NumRepeats; ++repeat)
+            {
+                auto begin = std::chrono::steady_clock::now();
+                {
+                    hud::HudPresets presets;
+                    NVPW_REQUIRE(presets.Initialize(exampleChip));
+                    loadPresets(presets);
+                }
+                coldMs = (std::min)(coldMs, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count());
+
+                begin = std::chrono::steady_clock::now();
+                {
+                    hud::HudPresetCache cache;
+                    NVPW_REQUIRE(cache.Load(pPath));
+                    hud::HudPresets presets;
+                    NVPW_REQUIRE(presets.Initialize(exampleChip, &cache));
+                    loadPresets(presets);
+                    NVPW_CHECK(!cache.IsDirty());
+                }
+                warmMs = (std::min)(warmMs, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count());
+            }
+            NVPW_TEST_MESSAGE("HudPresets::Initialize + HudDataModel::Load of all presets, YAML: ", coldMs, " ms, cached: ", warmMs, " ms");
+            std::remove(pPath);
+        }
+    }
+
     NVPW_TEST_CASE("HudDataModel")
     {
         NVPW_SUBCASE("Initialize All Presets")
@@ -819,6 +1352,80 @@ namespace nv { namespace perf { namespace test {
             }
         }
 
+        NVPW_SUBCASE("Initialize with Preset Cache")
+        {
+            const ScopedTemporaryFile temporaryFile("Offline_HudDataModel_PresetCache.bin");
+            const char* pPath = temporaryFile.Path();
+            auto initializeAll = [&](hud::HudPresetCache* pCache, std::vector<std::string>& printedModels) {
+                hud::HudPresets presets;
+                NVPW_REQUIRE(presets.Initialize(exampleChip, pCache));
+                for (const hud::HudPreset& preset : presets.GetPresets())
+                {
+                    hud::HudDataModel model;
+                    NVPW_REQUIRE(model.Load(preset));
+                    NVPW_REQUIRE(model.Initialize(4, 1 / 60.0));
+                    std::ostringstream stream;
+                    model.Print(stream);
+                    printedModels.push_back(stream.str());
+                    NVPW_CHECK(!model.GetCounterConfiguration().configImage.empty());
+                }
+            };
+
+            std::vector<std::string> uncachedModels;
+            auto begin = std::chrono::steady_clock::now();
+            initializeAll(nullptr, uncachedModels);
+            const double uncachedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+            {
+                hud::HudPresetCache cache;
+                std::vector<std::string> coldModels;
+                initializeAll(&cache, coldModels);
+                NVPW_CHECK(coldModels == uncachedModels);
+                NVPW_CHECK(cache.GetNumMetrics() > 0);
+                NVPW_REQUIRE(cache.Save(pPath));
+            }
+
+            hud::HudPresetCache cache;
+            begin = std::chrono::steady_clock::now();
+            NVPW_REQUIRE(cache.Load(pPath));
+            std::vector<std::string> warmModels;
+            initializeAll(&cache, warmModels);
+            const double warmMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+            NVPW_CHECK(warmModels == uncachedModels);
+            NVPW_CHECK(!cache.IsDirty());
+            NVPW_TEST_MESSAGE("HudPresets + HudDataModel Load/Initialize of all presets, uncached: ", uncachedMs, " ms, cached: ", warmMs, " ms");
+            std::remove(pPath);
+        }
+
+        NVPW_SUBCASE("Initialize with Counter Configuration Cache")
+        {
+            // a cache must not change which metrics are kept, neither when it misses nor when it hits
+            const CounterConfigurationCache cache(".");
+            hud::HudPresets presets;
+            NVPW_REQUIRE(presets.Initialize(exampleChip));
+            for (const hud::HudPreset& preset : presets.GetPresets())
+            {
+                NVPW_INFO("preset: ", preset.name);
+                hud::HudDataModel uncachedModel;
+                NVPW_REQUIRE(uncachedModel.Load(preset));
+                NVPW_REQUIRE(uncachedModel.Initialize(4, 1 / 60.0));
+                std::remove(cache.GetEntryPath(uncachedModel.GetCounterConfigurationCacheKey()).c_str());
+
+                for (const char* pPass : { "miss", "hit" })
+                {
+                    NVPW_INFO("cache: ", pPass);
+                    hud::HudDataModel model;
+                    model.SetCounterConfigurationCache(&cache);
+                    NVPW_REQUIRE(model.Load(preset));
+                    NVPW_REQUIRE(model.Initialize(4, 1 / 60.0));
+                    NVPW_CHECK(model.GetMetricEvalRequests().size() == uncachedModel.GetMetricEvalRequests().size());
+                    NVPW_CHECK(model.GetCounterConfigurationCacheKey() == uncachedModel.GetCounterConfigurationCacheKey());
+                    NVPW_CHECK(model.GetCounterConfiguration().configImage == uncachedModel.GetCounterConfiguration().configImage);
+                }
+                std::remove(cache.GetEntryPath(uncachedModel.GetCounterConfigurationCacheKey()).c_str());
+            }
+        }
+
         NVPW_SUBCASE("Load+Initialize+AddSample & Fail Trying to Add another Config")
         {
             ScopedNvPerfLogDisabler logDisabler;
@@ -902,6 +1509,173 @@ namespace nv { namespace perf { namespace test {
             NVPW_REQUIRE(!model.Load(preset3));
         }
 
+        NVPW_SUBCASE("Shared Columns and Stacked Sums")
+        {
+            ScopedNvPerfLogDisabler logDisabler;
+
+            std::string yaml =
+                "panels:\n"
+                "  - name: myPanel1\n"
+                "    widgets:\n"
+                "      - type: TimePlot\n"
+                "        label: myLabel\n"
+                "        chartType: Overlay\n"
+                "        metrics:\n"
+                "        - gr__cycles_active.sum\n"
+                "  - name: myPanel2\n"
+                "    widgets:\n"
+                "      - type: TimePlot\n"
+                "        label: myLabel\n"
+                "        chartType: Overlay\n"
+                "        metrics:\n"
+                "        - gr__cycles_active.sum\n"
+                "      - type: TimePlot\n"
+                "        label: myLabel\n"
+                "        chartType: Stacked\n"
+                "        metrics:\n"
+                "        - gr__cycles_active.sum\n"
+                "        - smsp__warps_launched.sum\n"
+                "        - metric: gpu__time_duration.sum\n"
+                "          multiplier: 2\n"
+                "configurations:\n"
+                "  - name: myConfig\n"
+                "    speed: Low\n"
+                "    panels:\n"
+                "      - myPanel1\n"
+                "      - myPanel2";
+            hud::HudPresets presets;
+            NVPW_REQUIRE(presets.Initialize(exampleChip));
+            NVPW_REQUIRE(presets.LoadFromString(yaml.c_str(), "columns.yaml"));
+
+            hud::HudDataModel model;
+            NVPW_REQUIRE(model.Load(presets.GetPreset("myConfig")));
+            NVPW_REQUIRE(model.Initialize(1.0, 10.0));
+
+            const auto& panels = model.GetConfigurations()[0].panels;
+            NVPW_REQUIRE(panels.size() == 2);
+            NVPW_REQUIRE(panels[1].widgets.size() == 2);
+            const auto& plot1 = *static_cast<hud::TimePlot*>(panels[0].widgets[0].get());
+            const auto& plot2 = *static_cast<hud::TimePlot*>(panels[1].widgets[0].get());
+            const auto& stackedPlot = *static_cast<hud::TimePlot*>(panels[1].widgets[1].get());
+            NVPW_REQUIRE(stackedPlot.signals.size() == 3);
+            NVPW_REQUIRE(stackedPlot.stackedSignals.size() == 3);
+
+            // the same metric in three plots is evaluated once and stored in one column
+            const hud::MetricSignal& sharedSignal = plot1.signals[0];
+            NVPW_CHECK(plot2.signals[0].metricIndex == sharedSignal.metricIndex);
+            NVPW_CHECK(stackedPlot.signals[0].metricIndex == sharedSignal.metricIndex);
+            NVPW_CHECK(plot2.signals[0].valBuffer.Column() == sharedSignal.valBuffer.Column());
+            NVPW_CHECK(stackedPlot.signals[0].valBuffer.Column() == sharedSignal.valBuffer.Column());
+            // 3 per-metric columns followed by the 3 running sums of the stacked plot
+            NVPW_CHECK(model.GetSampleHistory().NumColumns() == 6);
+            NVPW_CHECK(stackedPlot.stackedSignals[0].valBuffer.Column() >= 3);
+
+            std::vector<double> metricValues(3);
+            auto setValue = [&](const hud::MetricSignal& signal, double value) {
+                NVPW_REQUIRE(signal.metricIndex < metricValues.size());
+                metricValues[signal.metricIndex] = value;
+            };
+            setValue(stackedPlot.signals[0], 10.0);
+            setValue(stackedPlot.signals[1], 20.0);
+            setValue(stackedPlot.signals[2], 30.0);
+            model.AddSample(1.0, metricValues);
+            NVPW_CHECK(plot1.signals[0].valBuffer.Front() == 10.0);
+            NVPW_CHECK(plot2.signals[0].valBuffer.Front() == 10.0);
+            NVPW_CHECK(stackedPlot.signals[2].valBuffer.Front() == 30.0 * 2.0);
+            // each stacked signal is the sum of itself and all the signals after it, scaled by its own multiplier
+            NVPW_CHECK(stackedPlot.stackedSignals[2].valBuffer.Front() == 30.0 * 2.0);
+            NVPW_CHECK(stackedPlot.stackedSignals[1].valBuffer.Front() == 20.0 + 30.0);
+            NVPW_CHECK(stackedPlot.stackedSignals[0].valBuffer.Front() == 10.0 + 20.0 + 30.0);
+
+            // negative values are clamped to 0 before they are summed, older rows are left untouched
+            setValue(stackedPlot.signals[0], 1.0);
+            setValue(stackedPlot.signals[1], -5.0);
+            setValue(stackedPlot.signals[2], 3.0);
+            model.AddSample(2.0, metricValues);
+            NVPW_CHECK(sharedSignal.valBuffer.Size() == 2);
+            NVPW_CHECK(sharedSignal.valBuffer.Front() == 1.0);
+            NVPW_CHECK(stackedPlot.signals[1].valBuffer.Front() == 0.0);
+            NVPW_CHECK(stackedPlot.stackedSignals[1].valBuffer.Front() == 3.0);
+            NVPW_CHECK(stackedPlot.stackedSignals[0].valBuffer.Front() == 1.0 + 3.0);
+            NVPW_CHECK(stackedPlot.stackedSignals[0].valBuffer.Back() == 10.0 + 20.0 + 30.0);
+        }
+
+        NVPW_SUBCASE("Signal Statistics")
+        {
+            ScopedNvPerfLogDisabler logDisabler;
+
+            std::string yaml =
+                "panels:\n"
+                "  - name: myPanel\n"
+                "    widgets:\n"
+                "      - type: ScalarText\n"
+                "        label: myLabel\n"
+                "        metric:\n"
+                "          - name: my_scalar_metric\n"
+                "            metric: gpu__time_duration.sum\n"
+                "            multiplier: 2\n"
+                "      - type: TimePlot\n"
+                "        label: myLabel\n"
+                "        chartType: Stacked\n"
+                "        metrics:\n"
+                "        - gr__cycles_active.sum\n"
+                "        - gpu__time_duration.sum\n"
+                "configurations:\n"
+                "  - name: myConfig\n"
+                "    speed: Low\n"
+                "    panels:\n"
+                "      - myPanel";
+            hud::HudPresets presets;
+            NVPW_REQUIRE(presets.Initialize(exampleChip));
+            NVPW_REQUIRE(presets.LoadFromString(yaml.c_str(), "statistics.yaml"));
+
+            hud::HudDataModel model;
+            NVPW_REQUIRE(model.Load(presets.GetPreset("myConfig")));
+            NVPW_REQUIRE(model.EnableSignalStatistics());
+            NVPW_REQUIRE(model.Initialize(0.01, 1.0)); // the plot only holds 100 samples
+            NVPW_CHECK(!model.EnableSignalStatistics()); // too late
+            NVPW_CHECK(model.IsSignalStatisticsEnabled());
+
+            const auto& widgets = model.GetConfigurations()[0].panels[0].widgets;
+            NVPW_REQUIRE(widgets.size() == 2);
+            const auto& scalarSignal = static_cast<hud::ScalarText*>(widgets[0].get())->signal;
+            const auto& timePlot = *static_cast<hud::TimePlot*>(widgets[1].get());
+            NVPW_REQUIRE(timePlot.signals.size() == 2);
+
+            // synthetic values: metric 0 counts up, metric 1 stays constant
+            for (size_t sample = 1; sample <= 10000; ++sample)
+            {
+                const std::vector<double> metricValues = { double(sample), 5.0 };
+                model.AddSample(double(sample) * 0.01, metricValues);
+                model.AddFrameLevelValues(uint64_t(sample) * 10000000, metricValues);
+            }
+            const hud::MetricSignal& countingSignal = (timePlot.signals[0].metricIndex == 0) ? timePlot.signals[0] : timePlot.signals[1];
+            const hud::MetricSignal& constantSignal = (timePlot.signals[0].metricIndex == 0) ? timePlot.signals[1] : timePlot.signals[0];
+            NVPW_CHECK(countingSignal.valBuffer.Size() == 100);
+            NVPW_CHECK(countingSignal.statistics.Count() == 10000);
+            NVPW_CHECK(countingSignal.statistics.Min() == 1.0);
+            NVPW_CHECK(countingSignal.statistics.Quantile(0.5) == doctest::Approx(5000.0).epsilon(0.02));
+            NVPW_CHECK(constantSignal.statistics.Quantile(0.99) == doctest::Approx(5.0).epsilon(0.02));
+            NVPW_CHECK(!timePlot.stackedSignals[0].statistics.IsEnabled());
+            NVPW_CHECK(scalarSignal.statistics.Count() == 10000);
+            NVPW_CHECK(scalarSignal.statistics.Max() == 2.0 * (scalarSignal.metricIndex == 0 ? 10000.0 : 5.0)); // with multiplier
+
+            std::string json;
+            StringSink sink(json);
+            JsonWriter<StringSink> writer(sink);
+            model.WriteSignalStatistics(writer);
+            const nlohmann::json parsed = nlohmann::json::parse(json);
+            NVPW_REQUIRE(parsed.is_array());
+            NVPW_REQUIRE(parsed.size() == 3);
+            NVPW_CHECK(parsed[0]["panel"] == "myPanel");
+            NVPW_CHECK(parsed[0]["metric"] == "gpu__time_duration.sum");
+            NVPW_CHECK(parsed[1]["count"] == 10000);
+            NVPW_CHECK(parsed[1]["decayedAverages"].size() == 3);
+
+            model.ClearSignalStatistics();
+            NVPW_CHECK(countingSignal.statistics.Count() == 0);
+        }
+
         NVPW_SUBCASE("Invalid Panel")
         {
             ScopedNvPerfLogDisabler logDisabler;
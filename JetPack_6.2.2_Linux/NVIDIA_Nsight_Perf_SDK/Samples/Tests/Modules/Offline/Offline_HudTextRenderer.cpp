@@ -0,0 +1,207 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#if defined(_WIN32) && !defined(NOMINMAX)
+#define NOMINMAX
+#endif
+
+#include "Offline.h"
+
+#include <NvPerfHudTextRenderer.h>
+
+#include <json/json.hpp>
+
+#include <memory>
+#include <random>
+#include <sstream>
+
+namespace nv { namespace perf { namespace test {
+
+    NVPW_TEST_SUITE_BEGIN("HudTextRenderer");
+
+    NVPW_TEST_CASE("FormatValue")
+    {
+        auto format = [](double value, size_t decimalPlaces) {
+            char buffer[hud::HudTextRenderer::MaxFormattedValueLength];
+            const size_t length = hud::HudTextRenderer::FormatValue(value, decimalPlaces, buffer);
+            NVPW_CHECK(length == strlen(buffer));
+            return std::string(buffer);
+        };
+        NVPW_CHECK(format(0.0, 2) == "0.00");
+        NVPW_CHECK(format(1.0, 0) == "1");
+        NVPW_CHECK(format(12.345678, 2) == "12.35");
+        NVPW_CHECK(format(0.999, 2) == "1.00");
+        NVPW_CHECK(format(-3.5, 1) == "-3.5");
+        NVPW_CHECK(format(-0.001, 2) == "-0.00");
+        NVPW_CHECK(format(123456789.0, 3) == "123456789.000");
+        NVPW_CHECK(format(0.05, 9) == "0.050000000");
+        NVPW_CHECK(format(std::numeric_limits<double>::quiet_NaN(), 2) == "nan");
+        NVPW_CHECK(format(std::numeric_limits<double>::infinity(), 2) == "inf");
+        NVPW_CHECK(format(-std::numeric_limits<double>::infinity(), 2) == "-inf");
+        NVPW_CHECK(format(1e20, 2) == "100000000000000000000.00"); // beyond the integer path
+        NVPW_CHECK(format(1.5, 12) == "1.500000000000");
+        NVPW_CHECK(format(1e300, 2).size() == hud::HudTextRenderer::MaxFormattedValueLength - 1); // truncated
+
+        // including the values halfway between two outputs, which round to even
+        NVPW_CHECK(format(0.125, 2) == "0.12");
+        NVPW_CHECK(format(0.375, 2) == "0.38");
+        NVPW_CHECK(format(2.5, 0) == "2");
+        NVPW_CHECK(format(1.005, 2) == "1.00"); // slightly below the half in binary
+
+        std::mt19937 rng(11);
+        std::uniform_real_distribution<double> distribution(-1e6, 1e6);
+        for (size_t ii = 0; ii < 10000; ++ii)
+        {
+            const double value = (ii % 2) ? distribution(rng) / double(1 << (ii % 20)) : std::round(distribution(rng)) / 8.0;
+            const size_t decimalPlaces = ii % 5;
+            char expected[64];
+            snprintf(expected, sizeof(expected), "%.*f", (int)decimalPlaces, value);
+            NVPW_CHECK(format(value, decimalPlaces) == expected);
+        }
+    }
+
+    NVPW_TEST_CASE("HudTextRenderer")
+    {
+        hud::RingBuffer<double> timestampBuffer(8);
+        hud::MetricHistory history;
+        history.Initialize(2, 8);
+        auto addSample = [&](double timestamp, double a, double b) {
+            timestampBuffer.Push(timestamp);
+            history.ColumnData(0)[history.WriteIndex()] = a;
+            history.ColumnData(1)[history.WriteIndex()] = b;
+            history.CommitRow();
+        };
+
+        hud::MetricSignal signalA(hud::StyledText("A"), "", "a", hud::Color(), 100.0, 1.0, "%");
+        signalA.valBuffer = hud::MetricHistoryView(&history, 0, 1.0);
+        hud::MetricSignal signalB(hud::StyledText("Signal, \"B\""), "", "b", hud::Color(), 100.0, 1.0, "%");
+        signalB.valBuffer = hud::MetricHistoryView(&history, 1, 1.0);
+
+        hud::Panel panel;
+        panel.name = "Panel";
+        panel.widgets.emplace_back(new hud::ScalarText(hud::StyledText("Scalar"), signalA, 2, hud::ScalarText::ShowValue::JustValue));
+        std::unique_ptr<hud::TimePlot> pTimePlot(new hud::TimePlot(hud::StyledText("Plot"), "", hud::TimePlot::ChartType::Overlay, 0.0, 100.0, &timestampBuffer, { signalA, signalB }));
+        pTimePlot->timeWidth = 100.0;
+        panel.widgets.emplace_back(std::move(pTimePlot));
+
+        hud::HudTextRenderer renderer;
+        std::vector<std::string> frames;
+        renderer.SetOutput([&](const char* pData, size_t size) {
+            frames.emplace_back(pData, size);
+        });
+        NVPW_REQUIRE(renderer.Initialize(panel));
+        addSample(0.5, 1.0, 2.25);
+        addSample(1.0, 12.5, 99.999);
+
+        NVPW_SUBCASE("Text")
+        {
+            renderer.SetMaxIntegerLength(3);
+            renderer.SetColumnSeparator("|");
+            NVPW_REQUIRE(renderer.Render());
+            NVPW_REQUIRE(renderer.Render());
+            NVPW_REQUIRE(frames.size() == 2);
+            const std::string expected =
+                "\n===Frame0===\n"
+                "Panel\n"
+                "Scalar:  12.50 %\n"
+                "Plot (%)\n"
+                "Timestamp | A      | Signal, \"B\" |\n"
+                "     0.50 |   1.00 |        2.25 |\n"
+                "     1.00 |  12.50 |      100.00 |\n"
+                "---------------------------------\n";
+            NVPW_CHECK(frames[0] == expected);
+            NVPW_CHECK(frames[1].find("===Frame1===") != std::string::npos);
+            NVPW_CHECK(frames[1].substr(frames[1].find("Panel")) == expected.substr(expected.find("Panel")));
+        }
+
+        NVPW_SUBCASE("ConsoleOutput")
+        {
+            hud::HudTextRenderer consoleRenderer;
+            NVPW_REQUIRE(consoleRenderer.Initialize(panel));
+            size_t numCalls = 0;
+            std::string output;
+            consoleRenderer.SetConsoleOutput([&](const char* format, va_list list) {
+                char buffer[1024];
+                vsnprintf(buffer, sizeof(buffer), format, list);
+                output += buffer;
+                ++numCalls;
+            });
+            NVPW_REQUIRE(consoleRenderer.Render());
+            NVPW_CHECK(numCalls == 1); // one write per frame
+            NVPW_CHECK(output.find("Timestamp   , A ") != std::string::npos);
+        }
+
+        NVPW_SUBCASE("Ndjson")
+        {
+            renderer.SetOutputFormat(hud::HudTextRenderer::OutputFormat::Ndjson);
+            NVPW_REQUIRE(renderer.Render());
+            NVPW_REQUIRE(renderer.Render()); // nothing new
+            addSample(1.5, 3.0, std::numeric_limits<double>::quiet_NaN());
+            NVPW_REQUIRE(renderer.Render());
+            NVPW_REQUIRE(frames.size() == 2);
+
+            std::vector<nlohmann::json> records;
+            for (const std::string& frame : frames)
+            {
+                std::istringstream lines(frame);
+                std::string line;
+                while (std::getline(lines, line))
+                {
+                    records.push_back(nlohmann::json::parse(line));
+                }
+            }
+            NVPW_REQUIRE(records.size() == 3);
+            NVPW_CHECK(records[0]["timestamp"] == 0.5);
+            NVPW_CHECK(records[0]["panel"] == "Panel");
+            NVPW_CHECK(records[0]["plot"] == "Plot");
+            NVPW_CHECK(records[0]["values"]["A"] == 1.0);
+            NVPW_CHECK(records[1]["values"]["Signal, \"B\""] == 99.999); // full precision
+            NVPW_CHECK(records[2]["timestamp"] == 1.5);
+            NVPW_CHECK(records[2]["values"]["Signal, \"B\""] == "NaN");
+        }
+
+        NVPW_SUBCASE("Csv")
+        {
+            renderer.SetOutputFormat(hud::HudTextRenderer::OutputFormat::Csv);
+            NVPW_REQUIRE(renderer.Render());
+            addSample(1.5, 3.0, 4.0);
+            NVPW_REQUIRE(renderer.Render());
+            NVPW_REQUIRE(frames.size() == 2);
+            NVPW_CHECK(frames[0] ==
+                "timestamp,panel,plot,signal,value\n"
+                "0.5,Panel,Plot,A,1\n"
+                "0.5,Panel,Plot,\"Signal, \"\"B\"\"\",2.25\n"
+                "1,Panel,Plot,A,12.5\n"
+                "1,Panel,Plot,\"Signal, \"\"B\"\"\",99.999\n");
+            NVPW_CHECK(frames[1] ==
+                "1.5,Panel,Plot,A,3\n"
+                "1.5,Panel,Plot,\"Signal, \"\"B\"\"\",4\n");
+
+            // samples that fell out of the window in between are lost, the rest is not repeated
+            for (size_t ii = 0; ii < 10; ++ii)
+            {
+                addSample(2.0 + double(ii), 0.0, 0.0);
+            }
+            NVPW_REQUIRE(renderer.Render());
+            NVPW_REQUIRE(frames.size() == 3);
+            NVPW_CHECK(std::count(frames[2].begin(), frames[2].end(), '\n') == 2 * 8);
+        }
+    }
+
+    NVPW_TEST_SUITE_END();
+
+}}}
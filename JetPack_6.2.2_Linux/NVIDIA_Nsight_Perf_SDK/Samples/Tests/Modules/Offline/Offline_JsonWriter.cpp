@@ -0,0 +1,117 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include <doctest_proxy.h>
+#include "NvPerfJsonWriter.h"
+#include <json/json.hpp>
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <cstdio>
+#include <string>
+
+namespace nv { namespace perf { namespace test {
+
+    NVPW_TEST_SUITE_BEGIN("JsonWriter");
+
+    NVPW_TEST_CASE("FormatShortestDouble")
+    {
+        auto format = [](double value) {
+            char buffer[MaxFormattedDoubleLength + 1];
+            const size_t length = FormatShortestDouble(value, buffer);
+            NVPW_CHECK(length == strlen(buffer));
+            return std::string(buffer);
+        };
+
+        NVPW_CHECK_EQ(format(0.0), "0");
+        NVPW_CHECK_EQ(format(42.0), "42");
+        NVPW_CHECK_EQ(format(-7.0), "-7");
+        NVPW_CHECK_EQ(format(0.1), "0.1");
+        NVPW_CHECK_EQ(format(123.456), "123.456");
+
+        const double values[] = { 1.0 / 3.0, -2.0 / 3.0, 1e-9, 6.02214076e23, 9007199254740993.0, DBL_MAX, -DBL_MIN, 4.9406564584124654e-324 /* smallest denormal */, 0.30000000000000004 };
+        for (double value : values)
+        {
+            const std::string formatted = format(value);
+            NVPW_INFO("value: ", formatted);
+            NVPW_CHECK(strtod(formatted.c_str(), nullptr) == value);
+            NVPW_CHECK(formatted.size() <= 24);
+        }
+    }
+
+    NVPW_TEST_CASE("StringSink")
+    {
+        std::string json;
+        StringSink sink(json);
+        JsonWriter<StringSink> writer(sink);
+        writer.Raw("{ ").String("name").Raw(": ").String("a \"quoted\"\\path\n\x01").Raw(", ");
+        writer.String("values").Raw(": [ ").Double(0.5).Raw(", ").Double(NAN).Raw(", ").Double(-INFINITY).Raw(", ").Integer(-12345678901234).Raw(" ] }");
+        NVPW_INFO("json: ", json);
+        const auto j = nlohmann::json::parse(json, nullptr, false);
+        NVPW_REQUIRE_NE(j.type(), nlohmann::json::value_t::discarded);
+        NVPW_CHECK_EQ(j["name"].get<std::string>(), "a \"quoted\"\\path\n\x01");
+        NVPW_CHECK_EQ(j["values"][0].get<double>(), 0.5);
+        NVPW_CHECK_EQ(j["values"][1].get<std::string>(), "NaN");
+        NVPW_CHECK_EQ(j["values"][2].get<std::string>(), "-Infinity");
+        NVPW_CHECK_EQ(j["values"][3].get<int64_t>(), -12345678901234);
+    }
+
+    NVPW_TEST_CASE("BufferedFileSink")
+    {
+        const char* pFileName = "Offline_JsonWriter_BufferedFileSink.txt";
+        std::string expected;
+        {
+            BufferedFileSink sink(64);
+            NVPW_REQUIRE(sink.Open(pFileName));
+            // small writes that straddle the buffer, single chars, and a write larger than the whole buffer
+            for (size_t ii = 0; ii < 100; ++ii)
+            {
+                const std::string chunk = std::to_string(ii * 7919) + ',';
+                sink.Append(chunk.data(), chunk.size());
+                expected += chunk;
+            }
+            sink.Append('|');
+            expected += '|';
+            const std::string large(1000, 'x');
+            sink.Append(large.data(), large.size());
+            expected += large;
+            NVPW_CHECK(sink.Close());
+            NVPW_CHECK(!sink.IsOpen());
+
+            // the sink is reusable after Close()
+            NVPW_REQUIRE(sink.Open(pFileName));
+            sink.Append(expected.data(), expected.size());
+            NVPW_CHECK(sink.Close());
+        }
+
+        std::string actual;
+        if (FILE* pFile = OpenFile(pFileName, "rb"))
+        {
+            char buffer[256];
+            size_t numRead = 0;
+            while ((numRead = fread(buffer, 1, sizeof(buffer), pFile)) > 0)
+            {
+                actual.append(buffer, numRead);
+            }
+            fclose(pFile);
+        }
+        std::remove(pFileName);
+        NVPW_CHECK(actual == expected);
+    }
+
+    NVPW_TEST_SUITE_END();
+
+}}} // nv::perf::test
@@ -0,0 +1,269 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <doctest_proxy.h>
+#include "NvPerfInit.h"
+#include "NvPerfScopeExitGuard.h"
+
+namespace nv { namespace perf { namespace test {
+
+    NVPW_TEST_SUITE_BEGIN("Log");
+
+    // Routes log output into a vector for the lifetime of the object, and restores the previous sinks afterwards.
+    class ScopedLogCapture
+    {
+    private:
+        struct Sinks
+        {
+            bool writePlatform;
+            bool writeStderr;
+            FILE* writeFileFD;
+            WriteCustomLogCallbackFn pFnWriteCustomCB;
+            void* writeCustomData;
+            uint32_t rateLimitPerCallsite;
+        };
+        Sinks m_savedSinks;
+
+    public:
+        struct Message
+        {
+            std::string prefix;
+            std::string functionName;
+            std::string message;
+        };
+
+        std::mutex mutex;
+        std::vector<Message> messages;
+        std::mutex blockMutex;                   // held by the test to stall the callback, and with it the asynchronous writer
+        std::atomic<size_t> numCallbacksEntered;
+
+        ScopedLogCapture()
+            : numCallbacksEntered(0)
+        {
+            LogSettings& settings = *GetLogSettingsStorage_();
+            m_savedSinks.writePlatform = settings.writePlatform;
+            m_savedSinks.writeStderr = settings.writeStderr;
+            m_savedSinks.writeFileFD = settings.writeFileFD;
+            m_savedSinks.pFnWriteCustomCB = settings.pFnWriteCustomCB;
+            m_savedSinks.writeCustomData = settings.writeCustomData;
+            m_savedSinks.rateLimitPerCallsite = settings.rateLimitPerCallsite;
+            settings.writePlatform = false;
+            settings.writeStderr = false;
+            settings.writeFileFD = nullptr;
+            settings.rateLimitPerCallsite = 0;
+            UserLogEnableCustom(&ScopedLogCapture::Callback, this);
+        }
+        ~ScopedLogCapture()
+        {
+            UserLogEnableAsync(false);
+            LogSettings& settings = *GetLogSettingsStorage_();
+            settings.writePlatform = m_savedSinks.writePlatform;
+            settings.writeStderr = m_savedSinks.writeStderr;
+            settings.writeFileFD = m_savedSinks.writeFileFD;
+            settings.pFnWriteCustomCB = m_savedSinks.pFnWriteCustomCB;
+            settings.writeCustomData = m_savedSinks.writeCustomData;
+            settings.rateLimitPerCallsite = m_savedSinks.rateLimitPerCallsite;
+        }
+
+        std::vector<Message> GetMessages()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return messages;
+        }
+
+    private:
+        static void Callback(const char* pPrefix, const char* /* pDate */, const char* /* pTime */, const char* pFunctionName, const char* pMessage, void* pData)
+        {
+            ScopedLogCapture& capture = *static_cast<ScopedLogCapture*>(pData);
+            ++capture.numCallbacksEntered;
+            std::lock_guard<std::mutex> blockLock(capture.blockMutex);
+            std::lock_guard<std::mutex> lock(capture.mutex);
+            capture.messages.push_back({ pPrefix, pFunctionName, pMessage });
+        }
+    };
+
+    NVPW_TEST_CASE("Synchronous")
+    {
+        ScopedLogCapture capture;
+        NV_PERF_LOG_WRN(10, "value = %d\n", 42);
+        const std::string longText(2000, 'x');
+        NV_PERF_LOG_ERR(10, "%s\n", longText.c_str());
+
+        const std::vector<ScopedLogCapture::Message> messages = capture.GetMessages();
+        NVPW_REQUIRE(messages.size() == 2);
+        NVPW_CHECK(messages[0].prefix == "NVPERF|WRN|");
+        NVPW_CHECK(messages[0].functionName == __FUNCTION__);
+        NVPW_CHECK(messages[0].message == "value = 42\n");
+        NVPW_CHECK(messages[1].prefix == "NVPERF|ERR|");
+        NVPW_CHECK(messages[1].message == longText + "\n");
+    }
+
+    NVPW_TEST_CASE("Asynchronous")
+    {
+        NVPW_SUBCASE("Ordered Delivery")
+        {
+            ScopedLogCapture capture;
+            const UserLogStats statsBefore = GetUserLogStats();
+            NVPW_REQUIRE(UserLogEnableAsync(true, 4096));
+
+            const size_t NumThreads = 4;
+            const size_t MessagesPerThread = 500;
+            std::vector<std::thread> threads;
+            for (size_t threadIndex = 0; threadIndex < NumThreads; ++threadIndex)
+            {
+                threads.emplace_back([threadIndex] {
+                    for (size_t messageIndex = 0; messageIndex < MessagesPerThread; ++messageIndex)
+                    {
+                        NV_PERF_LOG_INF(10, "%zu %zu\n", threadIndex, messageIndex);
+                    }
+                });
+            }
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+            UserLogFlush();
+
+            const std::vector<ScopedLogCapture::Message> messages = capture.GetMessages();
+            NVPW_REQUIRE(messages.size() == NumThreads * MessagesPerThread);
+            std::vector<size_t> nextMessageIndex(NumThreads, 0);
+            bool inOrder = true;
+            for (const ScopedLogCapture::Message& message : messages)
+            {
+                size_t threadIndex = 0;
+                size_t messageIndex = 0;
+                NVPW_REQUIRE(sscanf(message.message.c_str(), "%zu %zu", &threadIndex, &messageIndex) == 2);
+                NVPW_REQUIRE(threadIndex < NumThreads);
+                inOrder = inOrder && (messageIndex == nextMessageIndex[threadIndex]++);
+            }
+            NVPW_CHECK(inOrder);
+            NVPW_CHECK(GetUserLogStats().numDropped == statsBefore.numDropped);
+        }
+
+        NVPW_SUBCASE("Truncation")
+        {
+            ScopedLogCapture capture;
+            NVPW_REQUIRE(UserLogEnableAsync(true));
+            const std::string longText(2000, 'x');
+            NV_PERF_LOG_WRN(10, "%s\n", longText.c_str());
+            UserLogFlush();
+
+            const std::vector<ScopedLogCapture::Message> messages = capture.GetMessages();
+            NVPW_REQUIRE(messages.size() == 1);
+            NVPW_CHECK(messages[0].message.size() == MaxAsyncLogMessageLength - 1);
+            NVPW_CHECK(messages[0].message.compare(messages[0].message.size() - 4, 4, "...\n") == 0);
+        }
+
+        NVPW_SUBCASE("Full Ring")
+        {
+            ScopedLogCapture capture;
+            const UserLogStats statsBefore = GetUserLogStats();
+            NVPW_REQUIRE(UserLogEnableAsync(true, 8));
+
+            std::unique_lock<std::mutex> blockLock(capture.blockMutex);
+            NV_PERF_LOG_INF(10, "first\n");
+            while (!capture.numCallbacksEntered)
+            {
+                std::this_thread::yield();
+            }
+            // the writer is stalled inside the first record, leaving 7 free
+            for (size_t messageIndex = 0; messageIndex < 20; ++messageIndex)
+            {
+                NV_PERF_LOG_INF(10, "message %zu\n", messageIndex);
+            }
+            NVPW_CHECK(GetUserLogStats().numDropped - statsBefore.numDropped == 13);
+            blockLock.unlock();
+            UserLogFlush();
+
+            const std::vector<ScopedLogCapture::Message> messages = capture.GetMessages();
+            NVPW_REQUIRE(messages.size() == 9);
+            NVPW_CHECK(messages[0].message == "first\n");
+            NVPW_CHECK(messages[7].message == "message 6\n");
+            NVPW_CHECK(messages[8].prefix == "NVPERF|WRN|");
+            NVPW_CHECK(messages[8].message.find("13 log messages were dropped") == 0);
+        }
+    }
+
+    NVPW_TEST_CASE("Rate Limit")
+    {
+        ScopedLogCapture capture;
+        const UserLogStats statsBefore = GetUserLogStats();
+        SetLogRateLimit(3);
+        for (size_t messageIndex = 0; messageIndex < 10; ++messageIndex)
+        {
+            NV_PERF_LOG_WRN(10, "callsite A %zu\n", messageIndex);
+            if (messageIndex < 2)
+            {
+                NV_PERF_LOG_WRN(10, "callsite B %zu\n", messageIndex);
+            }
+        }
+        SetLogRateLimit(0);
+
+        // the ten messages are logged well within a second; a slow machine can only see more of callsite A
+        const std::vector<ScopedLogCapture::Message> messages = capture.GetMessages();
+        size_t numCallsiteA = 0;
+        size_t numCallsiteB = 0;
+        for (const ScopedLogCapture::Message& message : messages)
+        {
+            numCallsiteA += (message.message.find("callsite A") == 0);
+            numCallsiteB += (message.message.find("callsite B") == 0);
+        }
+        NVPW_CHECK(numCallsiteA >= 3);
+        NVPW_CHECK(numCallsiteB == 2);
+        NVPW_CHECK(GetUserLogStats().numRateLimited - statsBefore.numRateLimited == 10 - numCallsiteA);
+    }
+
+    NVPW_TEST_CASE("Benchmark")
+    {
+        ScopedLogCapture capture;
+        UserLogDisableCustom();
+        // an anonymous temporary file, removed by the system once closed, even if the test bails out early
+        FILE* pFile = tmpfile();
+        NVPW_REQUIRE(pFile);
+        GetLogSettingsStorage_()->writeFileFD = pFile;
+        auto closeFile = ScopeExitGuard([&]() {
+            UserLogEnableAsync(false);
+            GetLogSettingsStorage_()->writeFileFD = nullptr;
+            fclose(pFile);
+        });
+
+        const size_t NumMessages = 20000;
+        auto logMessages = [&] {
+            const auto begin = std::chrono::steady_clock::now();
+            for (size_t messageIndex = 0; messageIndex < NumMessages; ++messageIndex)
+            {
+                NV_PERF_LOG_WRN(10, "metricValues has too few entries: %zu < %zu\n", messageIndex, NumMessages);
+            }
+            return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count() / NumMessages;
+        };
+        const double synchronousNs = logMessages();
+        NVPW_REQUIRE(UserLogEnableAsync(true, 32768));
+        const double asynchronousNs = logMessages();
+        UserLogFlush();
+        NVPW_TEST_MESSAGE("caller cost, synchronous: ", synchronousNs, " ns/message, asynchronous: ", asynchronousNs, " ns/message");
+    }
+
+    NVPW_TEST_SUITE_END();
+
+}}} // nv::perf::test
@@ -0,0 +1,203 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include "Offline.h"
+#include <string.h>
+#include <NvPerfMetricNameIndex.h>
+
+namespace nv { namespace perf { namespace test {
+
+    NVPW_TEST_SUITE_BEGIN("MetricNameIndex");
+
+    NVPW_TEST_CASE("MetricNameIndex")
+    {
+#if defined (__aarch64__)
+        const char* pChipName = "GA10B";
+#else
+        const char* pChipName = "TU102";
+#endif
+        MetricsEvaluator metricsEvaluator = CreateMetricsEvaluator(pChipName);
+        MetricNameIndex metricNameIndex;
+        NVPW_CHECK(!metricNameIndex.IsBuilt());
+        NVPW_REQUIRE(metricNameIndex.Build(metricsEvaluator, false));
+        NVPW_CHECK(metricNameIndex.IsBuilt());
+        NVPW_CHECK(!metricNameIndex.HasProperties());
+
+        NVPW_SUBCASE("BaseNames")
+        {
+            size_t numMetrics = 0;
+            for (size_t metricType = 0; metricType < NVPW_METRIC_TYPE__COUNT; ++metricType)
+            {
+                const MetricsEnumerator enumerator = EnumerateMetrics(metricsEvaluator, static_cast<NVPW_MetricType>(metricType));
+                for (size_t metricIndex = 0; metricIndex < enumerator.size(); ++metricIndex)
+                {
+                    NVPW_MetricType actualMetricType = NVPW_METRIC_TYPE__COUNT;
+                    size_t actualMetricIndex = ~size_t(0);
+                    NVPW_CHECK(metricNameIndex.GetMetricTypeAndIndex(enumerator[metricIndex], actualMetricType, actualMetricIndex));
+                    NVPW_CHECK(actualMetricType == metricType);
+                    NVPW_CHECK(actualMetricIndex == metricIndex);
+                    NVPW_CHECK(!strcmp(metricNameIndex.GetMetricName(actualMetricType, actualMetricIndex), enumerator[metricIndex]));
+                }
+                numMetrics += enumerator.size();
+            }
+            NVPW_CHECK(metricNameIndex.GetNumMetrics() == numMetrics);
+
+            NVPW_MetricType metricType = NVPW_METRIC_TYPE__COUNT;
+            size_t metricIndex = 0;
+            NVPW_CHECK(metricNameIndex.GetMetricTypeAndIndex("smsp__warps_launched.sum.per_second", metricType, metricIndex));
+            NVPW_CHECK(metricType == NVPW_METRIC_TYPE_COUNTER);
+            NVPW_CHECK(!metricNameIndex.GetMetricTypeAndIndex("", metricType, metricIndex));
+            NVPW_CHECK(!metricNameIndex.GetMetricTypeAndIndex("smsp__warps_launched_", metricType, metricIndex));
+            NVPW_CHECK(!metricNameIndex.GetMetricTypeAndIndex("not_a_metric", metricType, metricIndex));
+            NVPW_CHECK(!strcmp(metricNameIndex.GetMetricName(NVPW_METRIC_TYPE_COUNTER, ~size_t(0)), ""));
+        }
+
+        NVPW_SUBCASE("Metrics Evaluator Fallback")
+        {
+            const MetricNameIndex emptyIndex;
+            NVPW_MetricType metricType = NVPW_METRIC_TYPE__COUNT;
+            size_t metricIndex = ~size_t(0);
+            NVPW_CHECK(!GetMetricTypeAndIndex(emptyIndex, nullptr, "smsp__warps_launched", metricType, metricIndex));
+            NVPW_REQUIRE(GetMetricTypeAndIndex(emptyIndex, metricsEvaluator, "smsp__warps_launched", metricType, metricIndex));
+            NVPW_MetricType indexedMetricType = NVPW_METRIC_TYPE__COUNT;
+            size_t indexedMetricIndex = ~size_t(0);
+            NVPW_REQUIRE(GetMetricTypeAndIndex(metricNameIndex, nullptr, "smsp__warps_launched", indexedMetricType, indexedMetricIndex));
+            NVPW_CHECK(metricType == indexedMetricType);
+            NVPW_CHECK(metricIndex == indexedMetricIndex);
+            NVPW_CHECK(!GetMetricTypeAndIndex(metricNameIndex, metricsEvaluator, "not_a_metric", metricType, metricIndex));
+        }
+
+        NVPW_SUBCASE("FullNames")
+        {
+            const char* metricNames[] = {
+                "smsp__warps_launched.sum",
+                "smsp__warps_launched.avg.per_second",
+                "smsp__warps_launched.max.peak_sustained",
+                "smsp__warps_active.sum.pct_of_peak_sustained_active",
+                "smsp__inst_executed.min.per_cycle_elapsed",
+                "smsp__average_warp_latency.max_rate",
+                "smsp__average_warp_latency.pct",
+                "smsp__average_warp_latency.ratio",
+                "tpc__average_registers_per_thread",
+                "l1tex__throughput.avg.pct_of_peak_sustained_active",
+                "zrop__throughput.max.pct_of_peak_sustained_elapsed",
+            };
+            for (const char* pMetricName : metricNames)
+            {
+                NVPW_TEST_MESSAGE(pMetricName);
+                NVPW_MetricEvalRequest expected{};
+                NVPW_REQUIRE(ToMetricEvalRequest(metricsEvaluator, pMetricName, expected));
+                NVPW_MetricEvalRequest actual{};
+                NVPW_REQUIRE(metricNameIndex.ToMetricEvalRequest(pMetricName, actual));
+                NVPW_CHECK(actual.metricType == expected.metricType);
+                NVPW_CHECK(actual.metricIndex == expected.metricIndex);
+                NVPW_CHECK(actual.submetric == expected.submetric);
+                if (expected.metricType != NVPW_METRIC_TYPE_RATIO)
+                {
+                    NVPW_CHECK(actual.rollupOp == expected.rollupOp);
+                }
+                NVPW_CHECK(metricNameIndex.ToString(actual) == pMetricName);
+                NVPW_CHECK(metricNameIndex.ToString(actual) == ToString(metricsEvaluator, expected));
+
+                // the explicit length allows resolving names out of a larger buffer
+                const std::string paddedName = std::string(pMetricName) + ".sum.peak_sustained";
+                NVPW_REQUIRE(metricNameIndex.ToMetricEvalRequest(paddedName.c_str(), strlen(pMetricName), actual));
+                NVPW_CHECK(actual.metricIndex == expected.metricIndex);
+            }
+
+            const char* invalidMetricNames[] = {
+                "",
+                ".sum",
+                "smsp__warps_launched",             // counters require a rollup
+                "smsp__warps_launched.sum.bogus",
+                "smsp__warps_launched.sum.",
+                "smsp__warps_launched.summ",
+                "smsp__warps_launched.pct",
+                "l1tex__throughput.avg.ratio",      // not a throughput submetric
+                "smsp__average_warp_latency.sum.pct", // ratios don't take a rollup
+                "not_a_metric.sum",
+            };
+            for (const char* pMetricName : invalidMetricNames)
+            {
+                NVPW_TEST_MESSAGE(pMetricName);
+                NVPW_MetricEvalRequest request{};
+                NVPW_CHECK(!metricNameIndex.ToMetricEvalRequest(pMetricName, request));
+            }
+        }
+
+        NVPW_SUBCASE("Properties")
+        {
+            MetricNameIndex cachedIndex;
+            NVPW_REQUIRE(cachedIndex.Build(metricsEvaluator, true));
+            NVPW_CHECK(cachedIndex.HasProperties());
+            NVPW_CHECK(cachedIndex.GetNumMetrics() == metricNameIndex.GetNumMetrics());
+
+            const char* metricNames[] = {
+                "smsp__warps_launched.sum.per_second",
+                "smsp__average_warp_latency.pct",
+                "l1tex__throughput.avg.pct_of_peak_sustained_active",
+            };
+            for (const char* pMetricName : metricNames)
+            {
+                NVPW_TEST_MESSAGE(pMetricName);
+                NVPW_MetricEvalRequest request{};
+                NVPW_REQUIRE(cachedIndex.ToMetricEvalRequest(pMetricName, request));
+                const NVPW_MetricType metricType = static_cast<NVPW_MetricType>(request.metricType);
+
+                const char* pExpectedDescription = GetMetricDescription(metricsEvaluator, metricType, request.metricIndex);
+                const char* pDescription = cachedIndex.GetMetricDescription(metricType, request.metricIndex);
+                NVPW_REQUIRE(pExpectedDescription);
+                NVPW_REQUIRE(pDescription);
+                NVPW_CHECK(!strcmp(pDescription, pExpectedDescription));
+                NVPW_CHECK(pDescription != pExpectedDescription); // owned by the index
+
+                NVPW_CHECK(cachedIndex.GetMetricHwUnit(metricType, request.metricIndex) == GetMetricHwUnit(metricsEvaluator, metricType, request.metricIndex));
+                const char* pExpectedHwUnit = GetMetricHwUnitStr(metricsEvaluator, metricType, request.metricIndex);
+                const char* pHwUnit = cachedIndex.GetMetricHwUnitStr(metricType, request.metricIndex);
+                NVPW_REQUIRE(pExpectedHwUnit);
+                NVPW_REQUIRE(pHwUnit);
+                NVPW_CHECK(!strcmp(pHwUnit, pExpectedHwUnit));
+
+                std::vector<NVPW_DimUnitFactor> expectedDimUnits;
+                std::vector<NVPW_DimUnitFactor> dimUnits;
+                const bool hasDimUnits = GetMetricDimUnits(metricsEvaluator, request, expectedDimUnits);
+                NVPW_CHECK(cachedIndex.GetMetricDimUnits(request, dimUnits) == hasDimUnits);
+                NVPW_CHECK(dimUnits.size() == expectedDimUnits.size());
+                for (size_t ii = 0; ii < (std::min)(dimUnits.size(), expectedDimUnits.size()); ++ii)
+                {
+                    NVPW_CHECK(dimUnits[ii].dimUnit == expectedDimUnits[ii].dimUnit);
+                    NVPW_CHECK(dimUnits[ii].exponent == expectedDimUnits[ii].exponent);
+                }
+            }
+
+            // the names-only index defers to the metrics evaluator
+            NVPW_MetricEvalRequest request{};
+            NVPW_REQUIRE(metricNameIndex.ToMetricEvalRequest("smsp__warps_launched.sum", request));
+            const char* pDescription = metricNameIndex.GetMetricDescription(NVPW_METRIC_TYPE_COUNTER, request.metricIndex);
+            NVPW_REQUIRE(pDescription);
+            NVPW_CHECK(!strcmp(pDescription, cachedIndex.GetMetricDescription(NVPW_METRIC_TYPE_COUNTER, request.metricIndex)));
+
+            cachedIndex.Reset();
+            NVPW_CHECK(!cachedIndex.IsBuilt());
+            NVPW_CHECK(!cachedIndex.HasProperties());
+            NVPW_CHECK(!cachedIndex.ToMetricEvalRequest("smsp__warps_launched.sum", request));
+        }
+    }
+
+    NVPW_TEST_SUITE_END();
+
+}}}
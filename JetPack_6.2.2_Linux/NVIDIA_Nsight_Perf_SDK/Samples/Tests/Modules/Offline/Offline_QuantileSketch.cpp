@@ -0,0 +1,134 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include <math.h>
+#include <stdint.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <doctest_proxy.h>
+#include "NvPerfQuantileSketch.h"
+
+namespace nv { namespace perf { namespace test {
+
+    NVPW_TEST_SUITE_BEGIN("QuantileSketch");
+
+    static double ExactQuantile(std::vector<double> values, double quantile)
+    {
+        std::sort(values.begin(), values.end());
+        return values[size_t(quantile * double(values.size() - 1))];
+    }
+
+    NVPW_TEST_CASE("Basic")
+    {
+        QuantileSketch sketch;
+        NVPW_CHECK(sketch.GetCount() == 0);
+        NVPW_CHECK(isnan(sketch.GetQuantile(0.5)));
+        NVPW_CHECK(isnan(sketch.GetMean()));
+
+        sketch.Add(std::numeric_limits<double>::quiet_NaN()); // ignored
+        NVPW_CHECK(sketch.GetCount() == 0);
+
+        sketch.Add(42.0);
+        NVPW_CHECK(sketch.GetCount() == 1);
+        NVPW_CHECK(sketch.GetQuantile(0.0) == 42.0); // clamped to the exact range
+        NVPW_CHECK(sketch.GetQuantile(1.0) == 42.0);
+        NVPW_CHECK(sketch.GetMean() == 42.0);
+
+        // zero and negative values share the lowest bucket, but keep the exact min
+        sketch.Add(0.0);
+        sketch.Add(-5.0);
+        NVPW_CHECK(sketch.GetMin() == -5.0);
+        NVPW_CHECK(sketch.GetMax() == 42.0);
+        NVPW_CHECK(sketch.GetQuantile(0.0) == 0.0);
+        NVPW_CHECK(sketch.GetQuantile(1.0) == doctest::Approx(42.0).epsilon(sketch.GetRelativeAccuracy()));
+
+        // values above the trackable range
+        sketch.Add(1e20);
+        NVPW_CHECK(sketch.GetMax() == 1e20);
+        NVPW_CHECK(sketch.GetQuantile(1.0) <= 1e20);
+
+        const size_t memorySize = sketch.GetMemorySize();
+        sketch.Clear();
+        NVPW_CHECK(sketch.GetCount() == 0);
+        NVPW_CHECK(isnan(sketch.GetMin()));
+        NVPW_CHECK(sketch.GetMemorySize() == memorySize);
+        for (size_t ii = 0; ii < 100000; ++ii)
+        {
+            sketch.Add(double(ii));
+        }
+        NVPW_CHECK(sketch.GetMemorySize() == memorySize); // constant memory
+    }
+
+    NVPW_TEST_CASE("Accuracy")
+    {
+        std::mt19937 rng(1);
+        std::lognormal_distribution<double> lognormal(0.0, 2.0);
+        std::uniform_real_distribution<double> uniform(100.0, 200.0);
+
+        for (double relativeAccuracy : { 0.01, 0.02, 0.05 })
+        {
+            QuantileSketch sketch(relativeAccuracy);
+            std::vector<double> values;
+            for (size_t ii = 0; ii < 20000; ++ii)
+            {
+                const double value = (ii % 4) ? lognormal(rng) : uniform(rng);
+                values.push_back(value);
+                sketch.Add(value);
+            }
+            const double quantiles[] = { 0.0, 0.1, 0.5, 0.9, 0.95, 0.99, 1.0 };
+            double sketchValues[7] = {};
+            sketch.GetQuantiles(quantiles, 7, sketchValues);
+            for (size_t ii = 0; ii < 7; ++ii)
+            {
+                const double exactValue = ExactQuantile(values, quantiles[ii]);
+                NVPW_CHECK(fabs(sketchValues[ii] - exactValue) <= exactValue * relativeAccuracy * 1.0001);
+                NVPW_CHECK(sketch.GetQuantile(quantiles[ii]) == sketchValues[ii]);
+            }
+        }
+    }
+
+    NVPW_TEST_CASE("Merge")
+    {
+        QuantileSketch sketch1;
+        QuantileSketch sketch2;
+        QuantileSketch combined;
+        for (size_t ii = 1; ii <= 1000; ++ii)
+        {
+            const double value = double(ii);
+            ((ii % 3) ? sketch1 : sketch2).Add(value);
+            combined.Add(value);
+        }
+        QuantileSketch merged;
+        NVPW_CHECK(merged.Merge(sketch1));
+        NVPW_CHECK(merged.Merge(sketch2));
+        NVPW_CHECK(merged.Merge(QuantileSketch())); // empty
+        NVPW_CHECK(merged.GetCount() == combined.GetCount());
+        NVPW_CHECK(merged.GetSum() == combined.GetSum());
+        NVPW_CHECK(merged.GetMin() == 1.0);
+        NVPW_CHECK(merged.GetMax() == 1000.0);
+        for (double quantile : { 0.0, 0.25, 0.5, 0.99, 1.0 })
+        {
+            NVPW_CHECK(merged.GetQuantile(quantile) == combined.GetQuantile(quantile));
+        }
+
+        QuantileSketch otherAccuracy(0.05);
+        NVPW_CHECK(!merged.Merge(otherAccuracy));
+    }
+
+    NVPW_TEST_SUITE_END();
+
+}}} // nv::perf::test
@@ -0,0 +1,257 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include <stdint.h>
+#include <string.h>
+#include <chrono>
+#include <set>
+#include <vector>
+#include <doctest_proxy.h>
+#include "NvPerfRangeProfiler.h"
+
+namespace nv { namespace perf { namespace test {
+
+    NVPW_TEST_SUITE_BEGIN("RangeProfiler");
+
+    using namespace profiler;
+
+    // Stands in for a graphics API: the counter data image starts with the counter data prefix's first byte, and every decoded pass
+    // increments the image's second byte, so that a recycled image that was not reinitialized shows up.
+    struct MockProfilerApi : RangeProfilerStateMachine::IProfilerApi
+    {
+        size_t counterDataImageSize = 1024;
+        size_t numCreateCounterDataCalls = 0;
+        size_t numSetConfigCalls = 0;
+        size_t numPassesEnded = 0;
+        size_t numPassesDecoded = 0;
+        size_t numPassesPerStatisticalSample = 1;
+
+        virtual bool CreateCounterData(const SetConfigParams& config, std::vector<uint8_t>& counterDataImage, std::vector<uint8_t>& counterDataScratch) const override
+        {
+            ++const_cast<MockProfilerApi*>(this)->numCreateCounterDataCalls;
+            counterDataImage.assign(counterDataImageSize, 0);
+            counterDataImage[0] = config.pCounterDataPrefix[0];
+            counterDataScratch.assign(counterDataImageSize / 4, 0);
+            return true;
+        }
+        virtual bool SetConfig(const SetConfigParams& config) const override
+        {
+            ++const_cast<MockProfilerApi*>(this)->numSetConfigCalls;
+            return true;
+        }
+        virtual bool BeginPass() const override
+        {
+            return true;
+        }
+        virtual bool EndPass() const override
+        {
+            ++const_cast<MockProfilerApi*>(this)->numPassesEnded;
+            return true;
+        }
+        virtual bool PushRange(const char* pRangeName) override
+        {
+            return true;
+        }
+        virtual bool PopRange() override
+        {
+            return true;
+        }
+        virtual bool DecodeCounters(std::vector<uint8_t>& counterDataImage, std::vector<uint8_t>& counterDataScratch, bool& onePassDecoded, bool& allPassesDecoded) const override
+        {
+            MockProfilerApi& self = *const_cast<MockProfilerApi*>(this);
+            onePassDecoded = self.numPassesDecoded < self.numPassesEnded;
+            allPassesDecoded = false;
+            if (onePassDecoded)
+            {
+                ++self.numPassesDecoded;
+                ++counterDataImage[1];
+                allPassesDecoded = !(self.numPassesDecoded % self.numPassesPerStatisticalSample);
+            }
+            return true;
+        }
+    };
+
+    static SetConfigParams MakeSetConfigParams(const std::vector<uint8_t>& counterDataPrefix, size_t numPasses)
+    {
+        SetConfigParams config;
+        config.pCounterDataPrefix = counterDataPrefix.data();
+        config.counterDataPrefixSize = counterDataPrefix.size();
+        config.numPasses = numPasses;
+        config.numNestingLevels = 1;
+        config.numStatisticalSamples = 1;
+        return config;
+    }
+
+    // one collection per frame, decoded "latency" frames later
+    template <typename TOnDecoded>
+    static void RunFrames(RangeProfilerStateMachine& stateMachine, const SetConfigParams& config, size_t numFrames, size_t latency, TOnDecoded&& onDecoded)
+    {
+        DecodeResult decodeResult = {};
+        size_t numEnqueued = 0;
+        size_t numDecoded = 0;
+        for (size_t frame = 0; frame < numFrames + latency; ++frame)
+        {
+            if (numEnqueued < numFrames)
+            {
+                NVPW_REQUIRE(stateMachine.EnqueueCounterCollection(config));
+                ++numEnqueued;
+            }
+            if (!stateMachine.AllPassesSubmitted())
+            {
+                NVPW_REQUIRE(stateMachine.BeginPass());
+                NVPW_REQUIRE(stateMachine.PushRange("Frame"));
+                NVPW_REQUIRE(stateMachine.PopRange());
+                NVPW_REQUIRE(stateMachine.EndPass());
+            }
+            if (frame >= latency)
+            {
+                NVPW_REQUIRE(stateMachine.DecodeCounters(decodeResult));
+                NVPW_REQUIRE(decodeResult.allStatisticalSamplesCollected);
+                onDecoded(decodeResult);
+                ++numDecoded;
+            }
+        }
+        NVPW_CHECK(numDecoded == numFrames);
+        NVPW_CHECK(stateMachine.AllPassesSubmitted());
+    }
+
+    NVPW_TEST_CASE("RangeProfilerStateMachine")
+    {
+        MockProfilerApi profilerApi;
+        RangeProfilerStateMachine stateMachine(profilerApi);
+        const std::vector<uint8_t> counterDataPrefix(64, 0x5a);
+        const SetConfigParams config = MakeSetConfigParams(counterDataPrefix, 1);
+
+        NVPW_SUBCASE("Unpooled")
+        {
+            NVPW_CHECK(!stateMachine.IsCounterDataPoolingEnabled());
+            RunFrames(stateMachine, config, 20, 3, [&](const DecodeResult& decodeResult) {
+                NVPW_CHECK(decodeResult.counterDataImage[0] == 0x5a);
+                NVPW_CHECK(decodeResult.counterDataImage[1] == 1);
+            });
+            NVPW_CHECK(profilerApi.numCreateCounterDataCalls == 20);
+            NVPW_CHECK(profilerApi.numSetConfigCalls == 20);
+        }
+
+        NVPW_SUBCASE("Pooled")
+        {
+            NVPW_REQUIRE(stateMachine.SetCounterDataPooling(4));
+            NVPW_CHECK(stateMachine.IsCounterDataPoolingEnabled());
+            std::set<const uint8_t*> counterDataImages;
+            RunFrames(stateMachine, config, 50, 3, [&](const DecodeResult& decodeResult) {
+                NVPW_CHECK(decodeResult.counterDataImage[0] == 0x5a);
+                NVPW_CHECK(decodeResult.counterDataImage[1] == 1); // reinitialized from the template
+                counterDataImages.insert(decodeResult.counterDataImage.data());
+            });
+            NVPW_CHECK(profilerApi.numCreateCounterDataCalls == 1);
+            NVPW_CHECK(counterDataImages.size() <= 5); // the queued ones, plus the one held by DecodeResult
+        }
+
+        NVPW_SUBCASE("Pooled Capacity")
+        {
+            NVPW_REQUIRE(stateMachine.SetCounterDataPooling(2));
+            NVPW_CHECK(stateMachine.EnqueueCounterCollection(config));
+            NVPW_CHECK(stateMachine.EnqueueCounterCollection(config));
+            NVPW_CHECK(!stateMachine.EnqueueCounterCollection(config));
+            NVPW_CHECK(!stateMachine.SetCounterDataPooling(0)); // collections are queued
+
+            for (size_t pass = 0; pass < 2; ++pass)
+            {
+                NVPW_REQUIRE(stateMachine.BeginPass());
+                NVPW_REQUIRE(stateMachine.EndPass());
+            }
+            NVPW_CHECK(!stateMachine.EnqueueCounterCollection(config)); // submitted, but not decoded yet
+            DecodeResult decodeResult = {};
+            NVPW_REQUIRE(stateMachine.DecodeCounters(decodeResult));
+            NVPW_CHECK(decodeResult.allStatisticalSamplesCollected);
+            NVPW_CHECK(stateMachine.EnqueueCounterCollection(config));
+        }
+
+        NVPW_SUBCASE("Pooled Multi-Pass and Config Change")
+        {
+            NVPW_REQUIRE(stateMachine.SetCounterDataPooling(3));
+            profilerApi.numPassesPerStatisticalSample = 2;
+            const SetConfigParams twoPassConfig = MakeSetConfigParams(counterDataPrefix, 2);
+            DecodeResult decodeResult = {};
+            NVPW_REQUIRE(stateMachine.EnqueueCounterCollection(twoPassConfig));
+            NVPW_REQUIRE(stateMachine.EnqueueCounterCollection(twoPassConfig));
+            for (size_t pass = 0; pass < 4; ++pass)
+            {
+                NVPW_REQUIRE(stateMachine.BeginPass());
+                NVPW_REQUIRE(stateMachine.EndPass());
+                NVPW_REQUIRE(stateMachine.DecodeCounters(decodeResult));
+                NVPW_CHECK(decodeResult.allStatisticalSamplesCollected == (pass % 2 == 1));
+                if (decodeResult.allStatisticalSamplesCollected)
+                {
+                    NVPW_CHECK(decodeResult.counterDataImage[1] == 2);
+                }
+            }
+            NVPW_CHECK(profilerApi.numSetConfigCalls == 2);
+            NVPW_CHECK(profilerApi.numCreateCounterDataCalls == 1);
+
+            // a different counter data prefix needs a new template
+            const std::vector<uint8_t> otherCounterDataPrefix(64, 0x33);
+            profilerApi.numPassesPerStatisticalSample = 1;
+            NVPW_REQUIRE(stateMachine.EnqueueCounterCollection(MakeSetConfigParams(otherCounterDataPrefix, 1)));
+            NVPW_CHECK(profilerApi.numCreateCounterDataCalls == 2);
+            NVPW_REQUIRE(stateMachine.BeginPass());
+            NVPW_REQUIRE(stateMachine.EndPass());
+            NVPW_REQUIRE(stateMachine.DecodeCounters(decodeResult));
+            NVPW_REQUIRE(decodeResult.allStatisticalSamplesCollected);
+            NVPW_CHECK(decodeResult.counterDataImage[0] == 0x33);
+            NVPW_CHECK(decodeResult.counterDataImage[1] == 1);
+        }
+
+        NVPW_SUBCASE("Unpooled Queue Growth")
+        {
+            for (size_t index = 0; index < 100; ++index)
+            {
+                NVPW_REQUIRE(stateMachine.EnqueueCounterCollection(config));
+            }
+            DecodeResult decodeResult = {};
+            for (size_t index = 0; index < 100; ++index)
+            {
+                NVPW_REQUIRE(stateMachine.BeginPass());
+                NVPW_REQUIRE(stateMachine.EndPass());
+            }
+            NVPW_CHECK(stateMachine.AllPassesSubmitted());
+            for (size_t index = 0; index < 100; ++index)
+            {
+                NVPW_REQUIRE(stateMachine.DecodeCounters(decodeResult));
+                NVPW_CHECK(decodeResult.allStatisticalSamplesCollected);
+            }
+            NVPW_CHECK(!stateMachine.DecodeCounters(decodeResult)); // nothing queued
+        }
+
+        NVPW_SUBCASE("Benchmark")
+        {
+            const size_t NumFrames = 200;
+            profilerApi.counterDataImageSize = 4 * 1024 * 1024;
+            auto startTime = std::chrono::steady_clock::now();
+            RunFrames(stateMachine, config, NumFrames, 3, [](const DecodeResult&) {});
+            const double unpooledUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - startTime).count() / NumFrames;
+
+            NVPW_REQUIRE(stateMachine.SetCounterDataPooling(8));
+            startTime = std::chrono::steady_clock::now();
+            RunFrames(stateMachine, config, NumFrames, 3, [](const DecodeResult&) {});
+            const double pooledUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - startTime).count() / NumFrames;
+            NVPW_TEST_MESSAGE("per-frame collection with 4MB counter data, unpooled: ", unpooledUs, " us, pooled: ", pooledUs, " us");
+        }
+    }
+
+    NVPW_TEST_SUITE_END();
+
+}}} // nv::perf::test
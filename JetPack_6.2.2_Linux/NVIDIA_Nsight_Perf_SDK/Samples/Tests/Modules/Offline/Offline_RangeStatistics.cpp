@@ -0,0 +1,149 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include <math.h>
+#include <stdint.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <doctest_proxy.h>
+#include "NvPerfRangeStatistics.h"
+
+namespace nv { namespace perf { namespace test {
+
+    NVPW_TEST_SUITE_BEGIN("RangeStatistics");
+
+    using namespace profiler;
+
+    NVPW_TEST_CASE("Basic")
+    {
+        RangeStatistics rangeStatistics;
+        NVPW_CHECK(!rangeStatistics.IsInitialized());
+        NVPW_CHECK(!rangeStatistics.Initialize(0, 1));
+        NVPW_REQUIRE(rangeStatistics.Initialize(2, 2));
+        NVPW_CHECK(rangeStatistics.GetNumRanges() == 0);
+
+        RangeMetricStatistics statistics = {};
+        NVPW_CHECK(!rangeStatistics.GetStatistics(0, 0, statistics));
+
+        for (size_t frame = 1; frame <= 100; ++frame)
+        {
+            const double frameValues[] = { double(frame), 2.0 * double(frame) };
+            NVPW_CHECK(rangeStatistics.AddRangeValues("Frame", frameValues));
+            const double drawValues[] = { 1.0, std::numeric_limits<double>::quiet_NaN() };
+            NVPW_CHECK(rangeStatistics.AddRangeValues("Frame/Draw", drawValues));
+        }
+        const double values[] = { 0.0, 0.0 };
+        NVPW_CHECK(!rangeStatistics.AddRangeValues("Frame/Dispatch", values)); // full
+        NVPW_CHECK(rangeStatistics.GetNumDroppedRanges() == 1);
+
+        NVPW_REQUIRE(rangeStatistics.GetNumRanges() == 2);
+        NVPW_CHECK(rangeStatistics.GetRangeName(0) == "Frame");
+        NVPW_CHECK(rangeStatistics.FindRange("Frame/Draw") == 1);
+        NVPW_CHECK(rangeStatistics.FindRange("Frame/Dispatch") == size_t(~0));
+
+        NVPW_REQUIRE(rangeStatistics.GetStatistics(0, 0, statistics));
+        NVPW_CHECK(statistics.count == 100);
+        NVPW_CHECK(statistics.mean == 50.5);
+        NVPW_CHECK(statistics.min == 1.0);
+        NVPW_CHECK(statistics.max == 100.0);
+        NVPW_CHECK(statistics.p50 == doctest::Approx(50.0).epsilon(0.02));
+        NVPW_CHECK(statistics.p95 == doctest::Approx(95.0).epsilon(0.02));
+        NVPW_CHECK(statistics.p99 == doctest::Approx(99.0).epsilon(0.02));
+
+        NVPW_REQUIRE(rangeStatistics.GetStatistics(0, 1, statistics));
+        NVPW_CHECK(statistics.max == 200.0);
+
+        NVPW_REQUIRE(rangeStatistics.GetStatistics(1, 1, statistics));
+        NVPW_CHECK(statistics.count == 0); // NaNs are skipped
+        NVPW_CHECK(isnan(statistics.p50));
+
+        const QuantileSketch* pSketch = rangeStatistics.GetSketch(1, 0);
+        NVPW_REQUIRE(pSketch);
+        NVPW_CHECK(pSketch->GetCount() == 100);
+        NVPW_CHECK(!rangeStatistics.GetSketch(2, 0));
+
+        rangeStatistics.Reset();
+        NVPW_CHECK(rangeStatistics.GetNumRanges() == 0);
+        NVPW_CHECK(rangeStatistics.GetNumDroppedRanges() == 0);
+    }
+
+    NVPW_TEST_CASE("Concurrent Readers")
+    {
+        const size_t NumRanges = 8;
+        const size_t NumSamplesPerRange = 20000;
+        RangeStatistics rangeStatistics;
+        NVPW_REQUIRE(rangeStatistics.Initialize(NumRanges, 2));
+
+        // every sample has metric 1 == 2 * metric 0, so a torn snapshot would show up as a mismatch of the two statistics
+        std::atomic<bool> writerDone(false);
+        std::atomic<size_t> numInconsistentSnapshots(0);
+        std::atomic<size_t> numSnapshots(0);
+        auto reader = [&]() {
+            uint64_t lastCounts[NumRanges] = {};
+            while (!writerDone.load(std::memory_order_acquire))
+            {
+                const size_t numRanges = rangeStatistics.GetNumRanges();
+                for (size_t rangeIndex = 0; rangeIndex < numRanges; ++rangeIndex)
+                {
+                    if (rangeStatistics.GetRangeName(rangeIndex) != "Range" + std::to_string(rangeIndex))
+                    {
+                        ++numInconsistentSnapshots;
+                    }
+                    RangeMetricStatistics statistics = {};
+                    if (!rangeStatistics.GetStatistics(rangeIndex, 0, statistics))
+                    {
+                        ++numInconsistentSnapshots;
+                        continue;
+                    }
+                    const bool consistent = statistics.count >= lastCounts[rangeIndex]
+                        && statistics.max == double(statistics.count)
+                        && statistics.mean == double(statistics.count + 1) / 2.0;
+                    if (!consistent)
+                    {
+                        ++numInconsistentSnapshots;
+                    }
+                    lastCounts[rangeIndex] = statistics.count;
+                    ++numSnapshots;
+                }
+            }
+        };
+        std::thread reader1(reader);
+        std::thread reader2(reader);
+
+        for (size_t sampleIndex = 1; sampleIndex <= NumSamplesPerRange; ++sampleIndex)
+        {
+            for (size_t rangeIndex = 0; rangeIndex < NumRanges; ++rangeIndex)
+            {
+                const double values[] = { double(sampleIndex), 2.0 * double(sampleIndex) };
+                rangeStatistics.AddRangeValues("Range" + std::to_string(rangeIndex), values);
+            }
+        }
+        writerDone.store(true, std::memory_order_release);
+        reader1.join();
+        reader2.join();
+
+        NVPW_CHECK(numInconsistentSnapshots.load() == 0);
+        NVPW_CHECK(numSnapshots.load() > 0);
+        RangeMetricStatistics statistics = {};
+        NVPW_REQUIRE(rangeStatistics.GetStatistics(NumRanges - 1, 1, statistics));
+        NVPW_CHECK(statistics.count == NumSamplesPerRange);
+        NVPW_CHECK(statistics.max == 2.0 * double(NumSamplesPerRange));
+    }
+
+    NVPW_TEST_SUITE_END();
+
+}}} // nv::perf::test
@@ -0,0 +1,459 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <doctest_proxy.h>
+#include "NvPerfReportGeneratorVulkan.h"
+#include "Offline.h"
+
+namespace nv { namespace perf { namespace test {
+
+    NVPW_TEST_SUITE_BEGIN("ReportGenerator");
+
+    using namespace profiler;
+
+#if defined (__aarch64__)
+    static const char* const pReportGeneratorChipName = "GA10B";
+#else
+    static const char* const pReportGeneratorChipName = "TU102";
+#endif
+
+    // Collects one pass per enqueued collection, and decodes it at the end of the same frame. Each counter data image is a single byte,
+    // the 1-based index of its collection.
+    class MockReportProfiler : public ReportGeneratorStateMachine::IReportProfiler
+    {
+    public:
+        bool inSession = false;
+        bool inPass = false;
+        size_t numCollectionsEnqueued = 0;
+        std::deque<uint8_t> collectionsToSubmit;
+        std::deque<uint8_t> collectionsToDecode;
+
+        bool IsInSession() const override { return inSession; }
+        bool IsInPass() const override { return inPass; }
+        bool AllPassesSubmitted() const override { return collectionsToSubmit.empty(); }
+        bool PushRange(const char*) override { return true; }
+        bool PopRange() override { return true; }
+
+        bool EndSession() override
+        {
+            inSession = false;
+            collectionsToSubmit.clear();
+            collectionsToDecode.clear();
+            return true;
+        }
+
+        bool EnqueueCounterCollection(const SetConfigParams&) override
+        {
+            collectionsToSubmit.push_back(static_cast<uint8_t>(++numCollectionsEnqueued));
+            return true;
+        }
+
+        bool BeginPass() override
+        {
+            inPass = true;
+            return true;
+        }
+
+        bool EndPass() override
+        {
+            inPass = false;
+            collectionsToDecode.push_back(collectionsToSubmit.front());
+            collectionsToSubmit.pop_front();
+            return true;
+        }
+
+        bool DecodeCounters(DecodeResult& decodeResult) override
+        {
+            const bool decoded = !collectionsToDecode.empty();
+            decodeResult.onePassDecoded = decoded;
+            decodeResult.allPassesDecoded = decoded;
+            decodeResult.allStatisticalSamplesCollected = decoded;
+            if (decoded)
+            {
+                decodeResult.counterDataImage.assign(1, collectionsToDecode.front());
+                collectionsToDecode.pop_front();
+            }
+            return true;
+        }
+    };
+
+    // Folds the byte of each mock counter data image into a single range's statistics, and records finalized reports instead of writing
+    // them. Either can be held back.
+    class TestReportGeneratorStateMachine : public ReportGeneratorStateMachine
+    {
+    public:
+        std::mutex mutex;
+        std::condition_variable evaluationAllowed;
+        std::condition_variable finalizationAllowed;
+        bool blockEvaluation = false;                  // guarded by mutex
+        bool blockFinalization = false;                // guarded by mutex
+        std::vector<std::thread::id> evaluatorThreads; // guarded by mutex
+        std::vector<std::string> finalizedReports;     // guarded by mutex
+        std::vector<std::thread::id> finalizerThreads; // guarded by mutex
+
+        TestReportGeneratorStateMachine(IReportProfiler& reportProfiler)
+            : ReportGeneratorStateMachine(reportProfiler)
+        {
+        }
+
+        ~TestReportGeneratorStateMachine()
+        {
+            Reset();
+        }
+
+        void SetBlockEvaluation(bool block)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                blockEvaluation = block;
+            }
+            evaluationAllowed.notify_all();
+        }
+
+        void SetBlockFinalization(bool block)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                blockFinalization = block;
+            }
+            finalizationAllowed.notify_all();
+        }
+
+        size_t GetNumFinalizedReports()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return finalizedReports.size();
+        }
+
+    protected:
+        void AccumulateRangeStatistics(MetricsEvaluator&, const std::vector<uint8_t>& counterDataImage) override
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                evaluatorThreads.push_back(std::this_thread::get_id());
+                evaluationAllowed.wait(lock, [&] { return !blockEvaluation; });
+            }
+            std::vector<double> values(m_rangeStatistics.GetNumMetrics(), double(counterDataImage[0]));
+            m_rangeStatistics.AddRangeValues("Frame", values.data());
+        }
+
+        bool FinalizeReport(const FinalizationJob& job, MetricsEvaluator&, std::vector<MetricsEvaluator>&, ThreadPool&) override
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            finalizationAllowed.wait(lock, [&] { return !blockFinalization; });
+            finalizedReports.push_back(job.reportDirectoryName);
+            finalizerThreads.push_back(std::this_thread::get_id());
+            return true;
+        }
+    };
+
+    static NVPW_MetricsEvaluator* CreateTestMetricsEvaluator(std::vector<uint8_t>& scratchBuffer)
+    {
+        scratchBuffer.resize(VulkanCalculateMetricsEvaluatorScratchBufferSize(pReportGeneratorChipName));
+        if (scratchBuffer.empty())
+        {
+            return nullptr;
+        }
+        return VulkanCreateMetricsEvaluator(scratchBuffer.data(), scratchBuffer.size(), pReportGeneratorChipName);
+    }
+
+    static void InitializeTestReportMetrics(ReportGeneratorStateMachine& stateMachine, const ReportGeneratorStateMachine::CreateMetricsEvaluatorFn& createMetricsEvaluator)
+    {
+        const DeviceIdentifiers deviceIdentifiers = { "Offline", pReportGeneratorChipName };
+        auto createRawMetricsConfig = [] { return profiler::VulkanCreateRawMetricsConfig(pReportGeneratorChipName); };
+        NVPW_REQUIRE(stateMachine.InitializeReportMetrics(0, deviceIdentifiers, createMetricsEvaluator, createRawMetricsConfig, profiler::ReportGeneratorVulkan::GetCounterConfigurationKind(), {}));
+    }
+
+    static void RunFrames(ReportGeneratorStateMachine& stateMachine, MockReportProfiler& reportProfiler, size_t numFrames)
+    {
+        auto beginSession = [&] {
+            reportProfiler.inSession = true;
+            return true;
+        };
+        for (size_t frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+        {
+            NVPW_REQUIRE(stateMachine.OnFrameStart(beginSession));
+            NVPW_REQUIRE(stateMachine.OnFrameEnd(ReportOutputOptions()));
+        }
+    }
+
+    // waits for the evaluation after each frame, so that it never falls behind and holds back collections
+    static void RunFramesInLockstep(ReportGeneratorStateMachine& stateMachine, MockReportProfiler& reportProfiler, size_t numFrames)
+    {
+        for (size_t frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+        {
+            RunFrames(stateMachine, reportProfiler, 1);
+            stateMachine.WaitForRangeStatistics();
+        }
+    }
+
+    // returns the directory name of the collected report
+    static std::string CollectReport(ReportGeneratorStateMachine& stateMachine, MockReportProfiler& reportProfiler, const char* pReportName)
+    {
+        auto beginSession = [&] {
+            reportProfiler.inSession = true;
+            return true;
+        };
+        ReportOutputOptions outputOptions;
+        outputOptions.directoryName = pReportName;
+        outputOptions.appendDateTimeToDirName = AppendDateTime::no;
+        NVPW_REQUIRE(stateMachine.StartCollectionOnNextFrame());
+        NVPW_REQUIRE(stateMachine.OnFrameStart(beginSession));
+        NVPW_REQUIRE(stateMachine.OnFrameEnd(outputOptions));
+        NVPW_REQUIRE(!stateMachine.IsCollectingReport());
+        return std::string(pReportName) + NV_PERF_PATH_SEPARATOR;
+    }
+
+    NVPW_TEST_CASE("ContinuousCollection")
+    {
+        MockReportProfiler reportProfiler;
+        TestReportGeneratorStateMachine stateMachine(reportProfiler);
+        ContinuousCollectionOptions options;
+
+        NVPW_SUBCASE("Requires InitializeReportMetrics")
+        {
+            NVPW_CHECK(!stateMachine.StartContinuousCollection(options));
+            NVPW_CHECK(!stateMachine.IsInContinuousCollection());
+        }
+
+        NVPW_SUBCASE("Evaluates Off The Frame Thread")
+        {
+            InitializeTestReportMetrics(stateMachine, CreateTestMetricsEvaluator);
+            NVPW_REQUIRE(stateMachine.StartContinuousCollection(options));
+            NVPW_CHECK(stateMachine.IsInContinuousCollection());
+            RunFrames(stateMachine, reportProfiler, 2);
+            NVPW_CHECK(reportProfiler.inSession);
+            NVPW_CHECK(reportProfiler.numCollectionsEnqueued == 2);
+            stateMachine.WaitForRangeStatistics();
+
+            const RangeStatistics& rangeStatistics = stateMachine.GetRangeStatistics();
+            NVPW_REQUIRE(rangeStatistics.GetNumRanges() == 1);
+            RangeMetricStatistics statistics = {};
+            NVPW_REQUIRE(rangeStatistics.GetStatistics(rangeStatistics.FindRange("Frame"), 0, statistics));
+            NVPW_CHECK(statistics.count == 2);
+            NVPW_CHECK(statistics.min == 1.0);
+            NVPW_CHECK(statistics.max == 2.0);
+            std::lock_guard<std::mutex> lock(stateMachine.mutex);
+            NVPW_REQUIRE(stateMachine.evaluatorThreads.size() == 2);
+            NVPW_CHECK(stateMachine.evaluatorThreads[0] != std::this_thread::get_id());
+            NVPW_CHECK(stateMachine.evaluatorThreads[1] == stateMachine.evaluatorThreads[0]);
+        }
+
+        NVPW_SUBCASE("Collection Interval")
+        {
+            InitializeTestReportMetrics(stateMachine, CreateTestMetricsEvaluator);
+            options.collectionIntervalInFrames = 3;
+            NVPW_REQUIRE(stateMachine.StartContinuousCollection(options));
+            RunFramesInLockstep(stateMachine, reportProfiler, 9);
+            NVPW_CHECK(reportProfiler.numCollectionsEnqueued == 3); // on frames 1, 4 and 7
+            stateMachine.WaitForRangeStatistics();
+            RangeMetricStatistics statistics = {};
+            NVPW_REQUIRE(stateMachine.GetRangeStatistics().GetStatistics(0, 0, statistics));
+            NVPW_CHECK(statistics.count == 3);
+        }
+
+        NVPW_SUBCASE("Holds Back Collections While The Evaluation Falls Behind")
+        {
+            InitializeTestReportMetrics(stateMachine, CreateTestMetricsEvaluator);
+            NVPW_REQUIRE(stateMachine.StartContinuousCollection(options));
+            stateMachine.SetBlockEvaluation(true);
+            RunFrames(stateMachine, reportProfiler, 10);
+            NVPW_CHECK(reportProfiler.numCollectionsEnqueued == ReportGeneratorStateMachine::MaxNumPendingContinuousCollections);
+
+            stateMachine.SetBlockEvaluation(false);
+            stateMachine.WaitForRangeStatistics();
+            RunFramesInLockstep(stateMachine, reportProfiler, 3);
+            NVPW_CHECK(reportProfiler.numCollectionsEnqueued == ReportGeneratorStateMachine::MaxNumPendingContinuousCollections + 3);
+            stateMachine.WaitForRangeStatistics();
+            RangeMetricStatistics statistics = {};
+            NVPW_REQUIRE(stateMachine.GetRangeStatistics().GetStatistics(0, 0, statistics));
+            NVPW_CHECK(statistics.count == ReportGeneratorStateMachine::MaxNumPendingContinuousCollections + 3);
+        }
+
+        NVPW_SUBCASE("Stop And Restart")
+        {
+            InitializeTestReportMetrics(stateMachine, CreateTestMetricsEvaluator);
+            NVPW_REQUIRE(stateMachine.StartContinuousCollection(options));
+            stateMachine.SetBlockEvaluation(true);
+            RunFrames(stateMachine, reportProfiler, 1);
+            stateMachine.StopContinuousCollection();
+            NVPW_CHECK(!stateMachine.IsInContinuousCollection());
+            NVPW_CHECK(!reportProfiler.inSession);
+
+            stateMachine.SetBlockEvaluation(false);
+            stateMachine.WaitForRangeStatistics();
+            RangeMetricStatistics statistics = {};
+            NVPW_REQUIRE(stateMachine.GetRangeStatistics().GetStatistics(0, 0, statistics));
+            NVPW_CHECK(statistics.count == 1); // decoded before the stop, still folded in
+
+            ContinuousCollectionOptions unknownMetricOptions;
+            unknownMetricOptions.metrics = { "not_a_metric" };
+            NVPW_CHECK(!stateMachine.StartContinuousCollection(unknownMetricOptions));
+
+            NVPW_REQUIRE(stateMachine.StartContinuousCollection(options)); // discards the previous statistics
+            NVPW_CHECK(stateMachine.GetRangeStatistics().GetNumRanges() == 0);
+            RunFrames(stateMachine, reportProfiler, 1);
+            stateMachine.WaitForRangeStatistics();
+            NVPW_CHECK(stateMachine.GetRangeStatistics().GetNumRanges() == 1);
+        }
+
+        NVPW_SUBCASE("Evaluates In OnFrameEnd Without A Second Evaluator")
+        {
+            size_t numEvaluatorsCreated = 0;
+            InitializeTestReportMetrics(stateMachine, [&](std::vector<uint8_t>& scratchBuffer) -> NVPW_MetricsEvaluator* {
+                return numEvaluatorsCreated++ ? nullptr : CreateTestMetricsEvaluator(scratchBuffer);
+            });
+            NVPW_REQUIRE(stateMachine.StartContinuousCollection(options));
+            RunFrames(stateMachine, reportProfiler, 2);
+            NVPW_CHECK(numEvaluatorsCreated == 2);
+            NVPW_CHECK(stateMachine.GetRangeStatistics().GetNumRanges() == 1); // no wait needed
+            std::lock_guard<std::mutex> lock(stateMachine.mutex);
+            NVPW_REQUIRE(stateMachine.evaluatorThreads.size() == 2);
+            NVPW_CHECK(stateMachine.evaluatorThreads[0] == std::this_thread::get_id());
+        }
+
+        NVPW_SUBCASE("Reset Drains The Evaluator")
+        {
+            InitializeTestReportMetrics(stateMachine, CreateTestMetricsEvaluator);
+            NVPW_REQUIRE(stateMachine.StartContinuousCollection(options));
+            RunFrames(stateMachine, reportProfiler, 2);
+            stateMachine.Reset();
+            NVPW_CHECK(!stateMachine.IsInContinuousCollection());
+            std::lock_guard<std::mutex> lock(stateMachine.mutex);
+            NVPW_CHECK(stateMachine.evaluatorThreads.size() == 2);
+        }
+    }
+
+    NVPW_TEST_CASE("AsyncReportFinalization")
+    {
+        MockReportProfiler reportProfiler;
+        TestReportGeneratorStateMachine stateMachine(reportProfiler);
+        stateMachine.SetAsyncReportFinalization(true);
+
+        NVPW_SUBCASE("Finalizes In Order Off The Frame Thread")
+        {
+            InitializeTestReportMetrics(stateMachine, CreateTestMetricsEvaluator);
+            NVPW_CHECK(stateMachine.IsReportReady());
+            stateMachine.SetBlockFinalization(true);
+            std::vector<std::string> collectedReports;
+            for (const char* pReportName : { "Report1", "Report2", "Report3" })
+            {
+                collectedReports.push_back(CollectReport(stateMachine, reportProfiler, pReportName));
+                NVPW_CHECK(stateMachine.GetLastReportDirectoryName() == collectedReports.back());
+            }
+            NVPW_CHECK(!stateMachine.IsReportReady());
+            NVPW_CHECK(stateMachine.GetLastWrittenReportDirectoryName().empty());
+            NVPW_CHECK(stateMachine.GetNumFinalizedReports() == 0);
+
+            stateMachine.SetBlockFinalization(false);
+            stateMachine.WaitForReports();
+            NVPW_CHECK(stateMachine.IsReportReady());
+            NVPW_CHECK(stateMachine.GetLastWrittenReportDirectoryName() == collectedReports.back());
+            std::lock_guard<std::mutex> lock(stateMachine.mutex);
+            NVPW_CHECK(stateMachine.finalizedReports == collectedReports);
+            for (const std::thread::id& finalizerThread : stateMachine.finalizerThreads)
+            {
+                NVPW_CHECK(finalizerThread != std::this_thread::get_id());
+            }
+        }
+
+        NVPW_SUBCASE("Waits While The Queue Is Full")
+        {
+            InitializeTestReportMetrics(stateMachine, CreateTestMetricsEvaluator);
+            stateMachine.SetBlockFinalization(true);
+            std::vector<std::string> collectedReports;
+            collectedReports.push_back(CollectReport(stateMachine, reportProfiler, "Report1")); // taken by the finalizer
+            for (size_t reportIndex = 0; reportIndex < ReportGeneratorStateMachine::MaxNumQueuedReports; ++reportIndex)
+            {
+                collectedReports.push_back(CollectReport(stateMachine, reportProfiler, ("Queued" + std::to_string(reportIndex)).c_str()));
+            }
+
+            std::atomic<bool> overflowCollected(false);
+            std::thread frameThread([&] {
+                collectedReports.push_back(CollectReport(stateMachine, reportProfiler, "Overflow"));
+                overflowCollected = true;
+            });
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            NVPW_CHECK(!overflowCollected);
+
+            stateMachine.SetBlockFinalization(false);
+            frameThread.join();
+            NVPW_CHECK(overflowCollected);
+            stateMachine.WaitForReports();
+            std::lock_guard<std::mutex> lock(stateMachine.mutex);
+            NVPW_CHECK(stateMachine.finalizedReports == collectedReports);
+        }
+
+        NVPW_SUBCASE("Finalizes On The Calling Thread Without A Second Evaluator")
+        {
+            size_t numEvaluatorsCreated = 0;
+            InitializeTestReportMetrics(stateMachine, [&](std::vector<uint8_t>& scratchBuffer) -> NVPW_MetricsEvaluator* {
+                return numEvaluatorsCreated++ ? nullptr : CreateTestMetricsEvaluator(scratchBuffer);
+            });
+            const std::string report1 = CollectReport(stateMachine, reportProfiler, "Report1");
+            NVPW_CHECK(stateMachine.GetNumFinalizedReports() == 1); // no wait needed
+            NVPW_CHECK(stateMachine.GetLastWrittenReportDirectoryName() == report1);
+            const std::string report2 = CollectReport(stateMachine, reportProfiler, "Report2");
+            NVPW_CHECK(stateMachine.IsReportReady());
+            NVPW_CHECK(stateMachine.GetLastWrittenReportDirectoryName() == report2);
+            std::lock_guard<std::mutex> lock(stateMachine.mutex);
+            NVPW_REQUIRE(stateMachine.finalizerThreads.size() == 2);
+            NVPW_CHECK(stateMachine.finalizerThreads[0] == std::this_thread::get_id());
+            NVPW_CHECK(stateMachine.finalizerThreads[1] == std::this_thread::get_id());
+        }
+
+        NVPW_SUBCASE("Tracks The Last Written Report Across Modes")
+        {
+            InitializeTestReportMetrics(stateMachine, CreateTestMetricsEvaluator);
+            CollectReport(stateMachine, reportProfiler, "Report1");
+            stateMachine.WaitForReports();
+            stateMachine.SetAsyncReportFinalization(false);
+            const std::string report2 = CollectReport(stateMachine, reportProfiler, "Report2");
+            NVPW_CHECK(stateMachine.GetLastWrittenReportDirectoryName() == report2);
+        }
+
+        NVPW_SUBCASE("Reset Finishes Queued Reports")
+        {
+            InitializeTestReportMetrics(stateMachine, CreateTestMetricsEvaluator);
+            stateMachine.SetBlockFinalization(true);
+            for (const char* pReportName : { "Report1", "Report2", "Report3" })
+            {
+                CollectReport(stateMachine, reportProfiler, pReportName);
+            }
+            std::thread releaser([&] {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                stateMachine.SetBlockFinalization(false);
+            });
+            stateMachine.Reset(); // as the destructor does
+            releaser.join();
+            NVPW_CHECK(stateMachine.IsReportReady());
+            NVPW_CHECK(stateMachine.GetNumFinalizedReports() == 3);
+            NVPW_CHECK(stateMachine.GetLastWrittenReportDirectoryName().empty());
+        }
+    }
+
+    NVPW_TEST_SUITE_END();
+
+}}} // nv::perf::test
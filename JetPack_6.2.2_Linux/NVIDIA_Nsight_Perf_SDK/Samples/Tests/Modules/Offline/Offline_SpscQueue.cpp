@@ -0,0 +1,98 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include <stdint.h>
+#include <thread>
+#include <doctest_proxy.h>
+#include "NvPerfSpscQueue.h"
+
+namespace nv { namespace perf { namespace test {
+
+    NVPW_TEST_SUITE_BEGIN("SpscQueue");
+
+    NVPW_TEST_CASE("Basic")
+    {
+        SpscQueue<uint32_t> queue;
+        NVPW_CHECK(!queue.Initialize(0));
+        NVPW_REQUIRE(queue.Initialize(3));
+        NVPW_CHECK(queue.Capacity() == 4);
+        NVPW_CHECK(queue.Empty());
+        NVPW_CHECK(!queue.Front());
+
+        for (uint32_t ii = 0; ii < 4; ++ii)
+        {
+            NVPW_CHECK(queue.Push(ii));
+        }
+        NVPW_CHECK(!queue.Push(4)); // full
+        NVPW_CHECK(queue.Size() == 4);
+
+        const uint32_t* pFront = queue.Front();
+        NVPW_REQUIRE(pFront);
+        NVPW_CHECK(*pFront == 0);
+        NVPW_CHECK(queue.Front() == pFront); // Front() does not consume
+        queue.Pop();
+
+        NVPW_CHECK(queue.Push(4)); // wraps around
+        uint32_t value = 0;
+        for (uint32_t ii = 1; ii <= 4; ++ii)
+        {
+            NVPW_CHECK(queue.Pop(value));
+            NVPW_CHECK(value == ii);
+        }
+        NVPW_CHECK(!queue.Pop(value));
+        NVPW_CHECK(queue.Empty());
+
+        queue.Reset();
+        NVPW_CHECK(queue.Capacity() == 0);
+    }
+
+    NVPW_TEST_CASE("ProducerConsumer")
+    {
+        const uint64_t NumElements = 1000000;
+        SpscQueue<uint64_t> queue;
+        NVPW_REQUIRE(queue.Initialize(64));
+
+        std::thread producer([&]() {
+            for (uint64_t ii = 0; ii < NumElements; ++ii)
+            {
+                while (!queue.Push(ii))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        bool inOrder = true;
+        uint64_t expected = 0;
+        while (expected < NumElements)
+        {
+            uint64_t value = 0;
+            if (!queue.Pop(value))
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            inOrder &= (value == expected);
+            ++expected;
+        }
+        producer.join();
+        NVPW_CHECK(inOrder);
+        NVPW_CHECK(queue.Empty());
+    }
+
+    NVPW_TEST_SUITE_END();
+
+}}} // nv::perf::test
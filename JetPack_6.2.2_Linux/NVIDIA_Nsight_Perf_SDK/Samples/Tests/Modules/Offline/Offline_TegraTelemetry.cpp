@@ -0,0 +1,579 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#if defined(_WIN32) && !defined(NOMINMAX)
+#define NOMINMAX
+#endif
+
+#include "Offline.h"
+
+#include <NvPerfTegraTelemetry.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace nv { namespace perf { namespace test {
+
+    namespace {
+        // every value is set through Poll(), so tests control exactly what a sample holds
+        class TestSignalSource : public hud::ExternalSignalSource
+        {
+        public:
+            double value;
+
+            TestSignalSource()
+                : value()
+            {
+            }
+            ~TestSignalSource()
+            {
+                Stop();
+            }
+
+            bool AddSignal(const std::string& name)
+            {
+                return AddSignalDesc(hud::ExternalSignalDesc(name, "unit", "description", 100.0));
+            }
+
+        protected:
+            void Poll(double* pValues) override
+            {
+                for (size_t signalIndex = 0; signalIndex < GetSignals().size(); ++signalIndex)
+                {
+                    pValues[signalIndex] = value + signalIndex;
+                }
+            }
+        };
+
+        uint64_t g_testTimestamp = 0;
+        uint64_t GetTestTimestamp()
+        {
+            return g_testTimestamp;
+        }
+
+        hud::ExternalSignalSourceOptions MakeTestOptions()
+        {
+            hud::ExternalSignalSourceOptions options;
+            options.pGetTimestamp = &GetTestTimestamp;
+            return options;
+        }
+
+#if defined (__aarch64__)
+        static const char* exampleChip = "GA10B";
+#else
+        static const char* exampleChip = "GA102";
+#endif
+    } // namespace
+
+    NVPW_TEST_SUITE_BEGIN("TegraTelemetry");
+
+    NVPW_TEST_CASE("ExternalSignalSource")
+    {
+        NVPW_SUBCASE("Signal Names")
+        {
+            ScopedNvPerfLogDisabler logDisabler;
+            TestSignalSource source;
+            NVPW_CHECK(source.AddSignal("tegra.gpu.frequency"));
+            NVPW_CHECK(!source.AddSignal("tegra.gpu.frequency"));
+            NVPW_CHECK(!source.AddSignal("0tegra"));
+            NVPW_CHECK(!source.AddSignal("tegra-gpu"));
+            NVPW_CHECK(!source.Initialize(hud::ExternalSignalSourceOptions())); // no clock
+            NVPW_CHECK(!source.IsInitialized());
+            NVPW_REQUIRE(source.Initialize(MakeTestOptions()));
+            NVPW_CHECK(!source.AddSignal("tegra.gpu.load"));
+            NVPW_CHECK(source.GetSignals().size() == 1);
+            NVPW_CHECK(source.FindSignal("tegra.gpu.frequency") == 0);
+            NVPW_CHECK(source.FindSignal("tegra.gpu.load") == (size_t)~0);
+        }
+
+        NVPW_SUBCASE("Queue")
+        {
+            TestSignalSource source;
+            NVPW_REQUIRE(source.AddSignal("a.x"));
+            NVPW_REQUIRE(source.AddSignal("a.y"));
+            hud::ExternalSignalSourceOptions options;
+            options.maxQueuedSamples = 4;
+            options.pGetTimestamp = &GetTestTimestamp;
+            options.timestampOffset = -5;
+            NVPW_REQUIRE(source.Initialize(options));
+            for (size_t sampleIndex = 1; sampleIndex <= 4; ++sampleIndex)
+            {
+                g_testTimestamp = 10 * sampleIndex;
+                source.value = (double)sampleIndex;
+                NVPW_CHECK(source.PollOnce());
+            }
+            NVPW_CHECK(!source.PollOnce()); // full
+            NVPW_CHECK(source.GetNumDroppedSamples() == 1);
+
+            std::vector<uint64_t> timestamps;
+            std::vector<double> values;
+            NVPW_CHECK(source.ConsumeSamples([&](uint64_t timestamp, const double* pValues) {
+                timestamps.push_back(timestamp);
+                values.insert(values.end(), pValues, pValues + 2);
+            }) == 4);
+            NVPW_CHECK(timestamps == std::vector<uint64_t>{ 5, 15, 25, 35 });
+            NVPW_CHECK(values == std::vector<double>{ 1, 2, 2, 3, 3, 4, 4, 5 });
+            NVPW_CHECK(source.ConsumeSamples([](uint64_t, const double*) {}) == 0);
+
+            // the value slots are reused once consumed
+            g_testTimestamp = 100;
+            source.value = 10.0;
+            NVPW_CHECK(source.PollOnce());
+            values.clear();
+            source.ConsumeSamples([&](uint64_t, const double* pValues) {
+                values.insert(values.end(), pValues, pValues + 2);
+            });
+            NVPW_CHECK(values == std::vector<double>{ 10, 11 });
+        }
+
+        NVPW_SUBCASE("Polling Thread")
+        {
+            ScopedNvPerfLogDisabler logDisabler;
+            TestSignalSource source;
+            NVPW_REQUIRE(source.AddSignal("a.x"));
+            hud::ExternalSignalSourceOptions options;
+            options.samplesPerSecond = 1000.0;
+            options.pGetTimestamp = &GetCpuMarkerTimestamp;
+            NVPW_CHECK(!source.Start());
+            NVPW_REQUIRE(source.Initialize(options));
+            const uint64_t startTime = GetCpuMarkerTimestamp();
+            NVPW_REQUIRE(source.Start());
+            NVPW_CHECK(source.IsRunning());
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+            uint64_t previousTimestamp = startTime;
+            size_t numSamples = 0;
+            bool ordered = true;
+            for (size_t drain = 0; drain < 10; ++drain)
+            {
+                numSamples += source.ConsumeSamples([&](uint64_t timestamp, const double*) {
+                    ordered = ordered && timestamp >= previousTimestamp;
+                    previousTimestamp = timestamp;
+                });
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+            source.Stop();
+            NVPW_CHECK(!source.IsRunning());
+            NVPW_CHECK(ordered);
+            NVPW_CHECK(numSamples >= 10);
+            NVPW_CHECK(numSamples <= 200);
+            NVPW_CHECK(previousTimestamp <= GetCpuMarkerTimestamp());
+        }
+    }
+
+    NVPW_TEST_CASE("ExternalSignalHistory")
+    {
+        hud::ExternalSignalHistory history;
+        history.Initialize(2, 4);
+        NVPW_CHECK(!history.FindValuesAt(100));
+
+        auto addSample = [&](uint64_t timestamp, double value) {
+            const double values[] = { value, -value };
+            history.AddSample(timestamp, values);
+        };
+        addSample(10, 1.0);
+        addSample(20, 2.0);
+        addSample(30, 3.0);
+        NVPW_CHECK(!history.FindValuesAt(9));
+        NVPW_REQUIRE(history.FindValuesAt(10));
+        NVPW_CHECK(history.FindValuesAt(10)[0] == 1.0);
+        NVPW_CHECK(history.FindValuesAt(10)[1] == -1.0);
+        NVPW_CHECK(history.FindValuesAt(29)[0] == 2.0);
+        NVPW_CHECK(history.FindValuesAt(1000)[0] == 3.0); // the latest is held
+
+        // the oldest samples are replaced once the history wraps
+        addSample(40, 4.0);
+        addSample(50, 5.0);
+        addSample(60, 6.0);
+        NVPW_CHECK(history.Size() == 4);
+        NVPW_CHECK(!history.FindValuesAt(25));
+        NVPW_CHECK(history.FindValuesAt(30)[0] == 3.0);
+        NVPW_CHECK(history.FindValuesAt(45)[0] == 4.0);
+        NVPW_CHECK(history.FindValuesAt(60)[0] == 6.0);
+        NVPW_CHECK(history.FindValuesAt(60)[1] == -6.0);
+
+        TestSignalSource source;
+        NVPW_REQUIRE(source.AddSignal("a.x"));
+        NVPW_REQUIRE(source.AddSignal("a.y"));
+        hud::ExternalSignalSourceOptions options;
+        options.pGetTimestamp = &GetTestTimestamp;
+        NVPW_REQUIRE(source.Initialize(options));
+        g_testTimestamp = 70;
+        source.value = 7.0;
+        NVPW_REQUIRE(source.PollOnce());
+        NVPW_CHECK(history.Drain(source) == 1);
+        NVPW_CHECK(history.FindValuesAt(70)[0] == 7.0);
+        NVPW_CHECK(history.FindValuesAt(70)[1] == 8.0);
+    }
+
+    NVPW_TEST_CASE("HudDataModel::AddExternalSignalSource")
+    {
+        ScopedNvPerfLogDisabler logDisabler;
+        TestSignalSource source;
+        NVPW_REQUIRE(source.AddSignal("tegra.gpu.frequency"));
+
+        hud::HudDataModel model;
+        NVPW_CHECK(!model.AddExternalSignalSource(source)); // not initialized
+        NVPW_REQUIRE(source.Initialize(MakeTestOptions()));
+        NVPW_CHECK(model.AddExternalSignalSource(source));
+        size_t externalIndex = (size_t)~0;
+        NVPW_REQUIRE(model.FindExternalSignal("tegra.gpu.frequency", &externalIndex));
+        NVPW_CHECK(externalIndex == 0);
+        NVPW_CHECK(!model.FindExternalSignal("gpu__time_duration.sum"));
+
+        TestSignalSource duplicate;
+        NVPW_REQUIRE(duplicate.AddSignal("tegra.gpu.frequency"));
+        NVPW_REQUIRE(duplicate.Initialize(MakeTestOptions()));
+        NVPW_CHECK(!model.AddExternalSignalSource(duplicate));
+    }
+
+    NVPW_TEST_CASE("HudDataModel::AddSample with an External Signal Source")
+    {
+        ScopedNvPerfLogDisabler logDisabler;
+        const std::string yaml =
+            "panels:\n"
+            "  - name: myPanel\n"
+            "    widgets:\n"
+            "      - type: TimePlot\n"
+            "        label: myLabel\n"
+            "        chartType: Overlay\n"
+            "        metrics:\n"
+            "        - gpu__time_duration.sum\n"
+            "        - tegra.gpu.frequency\n"
+            "configurations:\n"
+            "  - name: myConfig\n"
+            "    speed: Low\n"
+            "    panels:\n"
+            "      - myPanel";
+        hud::HudPresets presets;
+        NVPW_REQUIRE(presets.Initialize(exampleChip));
+        NVPW_REQUIRE(presets.LoadFromString(yaml.c_str(), "external.yaml"));
+
+        // the clock of the source starts at 0, the one of the periodic sampler 1s ahead of it
+        TestSignalSource source;
+        NVPW_REQUIRE(source.AddSignal("tegra.gpu.frequency"));
+        hud::ExternalSignalSourceOptions options = MakeTestOptions();
+        options.CorrelateClocks(0, 1000000000);
+        NVPW_CHECK(options.timestampOffset == 1000000000);
+        NVPW_REQUIRE(source.Initialize(options));
+
+        hud::HudDataModel model;
+        NVPW_REQUIRE(model.Load(presets.GetPreset("myConfig")));
+        NVPW_REQUIRE(model.AddExternalSignalSource(source));
+        NVPW_REQUIRE(model.Initialize(1.0, 10.0));
+
+        const auto& plot = *static_cast<hud::TimePlot*>(model.GetConfigurations()[0].panels[0].widgets[0].get());
+        NVPW_REQUIRE(plot.signals.size() == 2);
+        const hud::MetricSignal& gpuSignal = plot.signals[0];
+        const hud::MetricSignal& externalSignal = plot.signals[1];
+        NVPW_CHECK(externalSignal.unit == "unit");
+        NVPW_REQUIRE(gpuSignal.metricIndex == 0);
+
+        auto pollAt = [&](uint64_t timestamp, double value) {
+            g_testTimestamp = timestamp;
+            source.value = value;
+            NVPW_REQUIRE(source.PollOnce());
+        };
+        auto addSampleAt = [&](uint64_t endTimestamp, double gpuValue) {
+            sampler::SampleTimestamp sampleTime;
+            sampleTime.start = endTimestamp - 1000;
+            sampleTime.end = endTimestamp;
+            model.AddSample(sampleTime, std::vector<double>{ gpuValue });
+        };
+
+        // nothing polled before the first sample yet, the external signal keeps its initial value
+        pollAt(2000, 10.0);
+        addSampleAt(1000001000, 1.0);
+        NVPW_CHECK(gpuSignal.valBuffer.Front() == 1.0);
+        NVPW_CHECK(externalSignal.valBuffer.Front() == 0.0);
+
+        // each sample takes the latest values polled at or before its end time, once translated to the sampler's clock
+        pollAt(4000, 20.0);
+        pollAt(6000, 30.0);
+        addSampleAt(1000002500, 2.0);
+        NVPW_CHECK(externalSignal.valBuffer.Front() == 10.0);
+        addSampleAt(1000004000, 3.0);
+        NVPW_CHECK(externalSignal.valBuffer.Front() == 20.0);
+        addSampleAt(1000009000, 4.0);
+        NVPW_CHECK(gpuSignal.valBuffer.Front() == 4.0);
+        NVPW_CHECK(externalSignal.valBuffer.Front() == 30.0);
+        NVPW_CHECK(externalSignal.valBuffer.Size() == 4);
+    }
+
+#if defined(__linux__)
+    namespace {
+        // A directory tree laid out like the sysfs of a Jetson AGX Orin, removed on destruction.
+        class FakeSysfs
+        {
+        private:
+            std::vector<std::string> m_directories;
+            std::vector<std::string> m_files;
+
+        public:
+            const std::string root;
+
+            FakeSysfs()
+                : root("Offline_TegraTelemetry_sysfs")
+            {
+                AddDirectory("");
+            }
+            ~FakeSysfs()
+            {
+                for (const std::string& file : m_files)
+                {
+                    std::remove(file.c_str());
+                }
+                for (size_t index = m_directories.size(); index-- > 0;)
+                {
+                    rmdir(m_directories[index].c_str());
+                }
+            }
+
+            void AddDirectory(const std::string& path)
+            {
+                std::string directory = root;
+                size_t begin = 0;
+                while (begin < path.size())
+                {
+                    const size_t end = path.find('/', begin);
+                    directory += "/" + path.substr(begin, end - begin);
+                    if (!mkdir(directory.c_str(), 0755))
+                    {
+                        m_directories.push_back(directory);
+                    }
+                    begin = (end == std::string::npos) ? path.size() : end + 1;
+                }
+                if (path.empty() && !mkdir(root.c_str(), 0755))
+                {
+                    m_directories.push_back(root);
+                }
+            }
+
+            // rewrites the file in place, like sysfs the file keeps its inode, so file descriptors opened earlier read the new contents
+            void WriteFile(const std::string& path, const std::string& contents)
+            {
+                const size_t slash = path.rfind('/');
+                if (slash != std::string::npos)
+                {
+                    AddDirectory(path.substr(0, slash));
+                }
+                const std::string fullPath = root + "/" + path;
+                if (std::find(m_files.begin(), m_files.end(), fullPath) == m_files.end())
+                {
+                    m_files.push_back(fullPath);
+                }
+                std::ofstream file(fullPath, std::ios::binary | std::ios::trunc);
+                file << contents;
+            }
+        };
+
+        void AddOrinSysfs(FakeSysfs& sysfs)
+        {
+            sysfs.WriteFile("class/devfreq/17000000.gpu/cur_freq", "918000000\n");
+            sysfs.WriteFile("class/devfreq/17000000.gpu/max_freq", "1300500000\n");
+            sysfs.WriteFile("class/devfreq/17000000.gpu/device/load", "537\n");
+            sysfs.WriteFile("class/devfreq/15340000.vic/cur_freq", "115200000\n");
+            sysfs.WriteFile("kernel/debug/bpmp/debug/clk/emc/rate", "3199000000\n");
+            sysfs.WriteFile("kernel/debug/bpmp/debug/clk/emc/max_rate", "3199000000\n");
+            for (int cpu : { 0, 1, 10 })
+            {
+                const std::string cpufreq = "devices/system/cpu/cpu" + std::to_string(cpu) + "/cpufreq/";
+                sysfs.WriteFile(cpufreq + "scaling_cur_freq", "1984000\n");
+                sysfs.WriteFile(cpufreq + "cpuinfo_max_freq", "2201600\n");
+            }
+            sysfs.WriteFile("devices/system/cpu/cpufreq/boost", "0\n");
+            sysfs.WriteFile("class/thermal/thermal_zone0/type", "cpu-thermal\n");
+            sysfs.WriteFile("class/thermal/thermal_zone0/temp", "48562\n");
+            sysfs.WriteFile("class/thermal/thermal_zone1/type", "gpu-thermal\n");
+            sysfs.WriteFile("class/thermal/thermal_zone1/temp", "46937\n");
+            sysfs.WriteFile("class/thermal/cooling_device0/type", "pwm-fan\n");
+            sysfs.WriteFile("class/hwmon/hwmon0/name", "pwmfan\n");
+            sysfs.WriteFile("class/hwmon/hwmon1/name", "ina3221\n");
+            sysfs.WriteFile("class/hwmon/hwmon1/in1_label", "VDD_GPU_SOC\n");
+            sysfs.WriteFile("class/hwmon/hwmon1/in1_input", "5072\n");
+            sysfs.WriteFile("class/hwmon/hwmon1/curr1_input", "1576\n");
+            sysfs.WriteFile("class/hwmon/hwmon1/in2_label", "VDD_CPU_CV\n");
+            sysfs.WriteFile("class/hwmon/hwmon1/in2_input", "5072\n");
+            sysfs.WriteFile("class/hwmon/hwmon1/curr2_input", "394\n");
+            sysfs.WriteFile("class/hwmon/hwmon1/in7_label", "sum of shunt voltages\n");
+            sysfs.WriteFile("class/hwmon/hwmon1/in7_input", "1832\n");
+        }
+
+        std::vector<double> PollValues(hud::ExternalSignalSource& source)
+        {
+            std::vector<double> values;
+            NVPW_REQUIRE(source.PollOnce());
+            source.ConsumeSamples([&](uint64_t, const double* pValues) {
+                values.assign(pValues, pValues + source.GetSignals().size());
+            });
+            return values;
+        }
+    } // namespace
+
+    NVPW_TEST_CASE("SysfsSignalSource")
+    {
+        NVPW_SUBCASE("AddTegraSignals")
+        {
+            FakeSysfs sysfs;
+            AddOrinSysfs(sysfs);
+            hud::SysfsSignalSource source;
+            NVPW_REQUIRE(source.AddTegraSignals(sysfs.root) == 10);
+            std::vector<std::string> names;
+            for (const hud::ExternalSignalDesc& desc : source.GetSignals())
+            {
+                names.push_back(desc.name);
+            }
+            const std::vector<std::string> expectedNames = {
+                "tegra.gpu.frequency",
+                "tegra.gpu.load",
+                "tegra.emc.frequency",
+                "tegra.cpu0.frequency",
+                "tegra.cpu1.frequency",
+                "tegra.cpu10.frequency",
+                "tegra.thermal.cpu_thermal",
+                "tegra.thermal.gpu_thermal",
+                "tegra.power.VDD_GPU_SOC",
+                "tegra.power.VDD_CPU_CV",
+            };
+            NVPW_CHECK(names == expectedNames);
+
+            const hud::ExternalSignalDesc& gpuFrequency = source.GetSignals()[0];
+            NVPW_CHECK(gpuFrequency.unit == "MHz");
+            NVPW_CHECK(gpuFrequency.maxValue == doctest::Approx(1300.5));
+            NVPW_CHECK(source.GetSignals()[3].maxValue == doctest::Approx(2201.6));
+            NVPW_CHECK(std::isnan(source.GetSignals()[6].maxValue));
+
+            NVPW_REQUIRE(source.Initialize(MakeTestOptions()));
+            const std::vector<double> values = PollValues(source);
+            const std::vector<double> expectedValues = { 918.0, 53.7, 3199.0, 1984.0, 1984.0, 1984.0, 48.562, 46.937, 5.072 * 1.576, 5.072 * 0.394 };
+            NVPW_REQUIRE(values.size() == expectedValues.size());
+            for (size_t signalIndex = 0; signalIndex < values.size(); ++signalIndex)
+            {
+                NVPW_CHECK(values[signalIndex] == doctest::Approx(expectedValues[signalIndex]));
+            }
+        }
+
+        NVPW_SUBCASE("Values Are Reread")
+        {
+            FakeSysfs sysfs;
+            AddOrinSysfs(sysfs);
+            hud::SysfsSignalSource source;
+            NVPW_REQUIRE(source.AddTegraSignals(sysfs.root));
+            NVPW_REQUIRE(source.Initialize(MakeTestOptions()));
+            NVPW_CHECK(PollValues(source)[0] == doctest::Approx(918.0));
+
+            sysfs.WriteFile("class/devfreq/17000000.gpu/cur_freq", "1300500000\n");
+            sysfs.WriteFile("class/hwmon/hwmon1/curr1_input", "2000\n");
+            const std::vector<double> values = PollValues(source);
+            NVPW_CHECK(values[0] == doctest::Approx(1300.5));
+            NVPW_CHECK(values[8] == doctest::Approx(5.072 * 2.0));
+
+            // a file that cannot be parsed yields NaN, which the HUD clamps like any negative value
+            sysfs.WriteFile("class/thermal/thermal_zone0/temp", "\n");
+            NVPW_CHECK(std::isnan(PollValues(source)[6]));
+        }
+
+        NVPW_SUBCASE("Missing Files")
+        {
+            ScopedNvPerfLogDisabler logDisabler;
+            FakeSysfs sysfs;
+            sysfs.WriteFile("class/thermal/thermal_zone0/type", "cpu-thermal\n");
+            sysfs.WriteFile("class/thermal/thermal_zone0/temp", "48562\n");
+            sysfs.WriteFile("class/thermal/thermal_zone1/type", "cpu-thermal\n");
+            sysfs.WriteFile("class/thermal/thermal_zone1/temp", "not a number\n"); // skipped
+            sysfs.WriteFile("class/thermal/thermal_zone2/type", "cpu-thermal\n");
+            sysfs.WriteFile("class/thermal/thermal_zone2/temp", "50000\n");
+            sysfs.WriteFile("kernel/debug/bpmp/debug/clk/emc/max_rate", "3199000000\n"); // without a rate
+
+            hud::SysfsSignalSource source;
+            NVPW_REQUIRE(source.AddTegraSignals(sysfs.root) == 2);
+            NVPW_CHECK(source.GetSignals()[0].name == "tegra.thermal.cpu_thermal");
+            NVPW_CHECK(source.GetSignals()[1].name == "tegra.thermal.cpu_thermal_2");
+            NVPW_CHECK(source.AddTegraSignals("Offline_TegraTelemetry_missing") == 0);
+            NVPW_CHECK(!source.AddSignal(hud::ExternalSignalDesc("tegra.missing", "", ""), sysfs.root + "/missing"));
+            NVPW_CHECK(source.GetSignals().size() == 2);
+        }
+
+        NVPW_SUBCASE("Poll Benchmark")
+        {
+            FakeSysfs sysfs;
+            AddOrinSysfs(sysfs);
+            hud::SysfsSignalSource source;
+            NVPW_REQUIRE(source.AddTegraSignals(sysfs.root));
+            NVPW_REQUIRE(source.Initialize(MakeTestOptions()));
+            const std::vector<std::string> paths = {
+                "class/devfreq/17000000.gpu/cur_freq",
+                "class/devfreq/17000000.gpu/device/load",
+                "kernel/debug/bpmp/debug/clk/emc/rate",
+                "devices/system/cpu/cpu0/cpufreq/scaling_cur_freq",
+                "devices/system/cpu/cpu1/cpufreq/scaling_cur_freq",
+                "devices/system/cpu/cpu10/cpufreq/scaling_cur_freq",
+                "class/thermal/thermal_zone0/temp",
+                "class/thermal/thermal_zone1/temp",
+                "class/hwmon/hwmon1/in1_input",
+                "class/hwmon/hwmon1/curr1_input",
+                "class/hwmon/hwmon1/in2_input",
+                "class/hwmon/hwmon1/curr2_input",
+            };
+
+            const size_t NumPolls = 2000;
+            auto begin = std::chrono::steady_clock::now();
+            for (size_t poll = 0; poll < NumPolls; ++poll)
+            {
+                source.PollOnce();
+                source.ConsumeSamples([](uint64_t, const double*) {});
+            }
+            const double preadUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count() / NumPolls;
+
+            double sum = 0.0;
+            begin = std::chrono::steady_clock::now();
+            for (size_t poll = 0; poll < NumPolls; ++poll)
+            {
+                for (const std::string& path : paths)
+                {
+                    FILE* pFile = fopen((sysfs.root + "/" + path).c_str(), "r");
+                    double value = 0.0;
+                    if (pFile)
+                    {
+                        if (fscanf(pFile, "%lf", &value) == 1)
+                        {
+                            sum += value;
+                        }
+                        fclose(pFile);
+                    }
+                }
+            }
+            const double fopenUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count() / NumPolls;
+            NVPW_CHECK(sum > 0.0);
+            NVPW_TEST_MESSAGE("Polling ", paths.size(), " files, pread: ", preadUs, " us, fopen+fscanf: ", fopenUs, " us");
+        }
+    }
+#endif
+
+    NVPW_TEST_SUITE_END();
+
+}}} // nv::perf::test
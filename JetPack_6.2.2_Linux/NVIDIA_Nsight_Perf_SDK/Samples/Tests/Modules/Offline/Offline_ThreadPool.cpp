@@ -0,0 +1,146 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <doctest_proxy.h>
+#include "NvPerfThreadPool.h"
+
+namespace nv { namespace perf { namespace test {
+
+    NVPW_TEST_SUITE_BEGIN("ThreadPool");
+
+    NVPW_TEST_CASE("ParallelFor")
+    {
+        NVPW_SUBCASE("Inline")
+        {
+            ThreadPool pool;
+            NVPW_REQUIRE(pool.Initialize(1));
+            NVPW_CHECK(pool.GetNumWorkers() == 1);
+            std::vector<size_t> visited;
+            pool.ParallelFor(5, [&](size_t workerIndex, size_t itemIndex) {
+                NVPW_CHECK(workerIndex == 0);
+                visited.push_back(itemIndex);
+            });
+            NVPW_CHECK(visited == std::vector<size_t>({ 0, 1, 2, 3, 4 }));
+        }
+
+        NVPW_SUBCASE("Every Item Once")
+        {
+            ThreadPool pool;
+            NVPW_REQUIRE(pool.Initialize(4));
+            NVPW_CHECK(pool.GetNumWorkers() == 4);
+            for (size_t numItems : { 0, 1, 3, 1000 })
+            {
+                std::vector<std::atomic<uint32_t>> visitCounts(numItems);
+                std::atomic<bool> workerIndexValid(true);
+                pool.ParallelFor(numItems, [&](size_t workerIndex, size_t itemIndex) {
+                    if (workerIndex >= pool.GetNumWorkers())
+                    {
+                        workerIndexValid = false;
+                    }
+                    ++visitCounts[itemIndex];
+                });
+                NVPW_CHECK(workerIndexValid);
+                bool allVisitedOnce = true;
+                for (const auto& visitCount : visitCounts)
+                {
+                    allVisitedOnce &= (visitCount == 1);
+                }
+                NVPW_CHECK(allVisitedOnce);
+            }
+        }
+
+        NVPW_SUBCASE("Reinitialize")
+        {
+            ThreadPool pool;
+            NVPW_REQUIRE(pool.Initialize(3));
+            std::atomic<size_t> sum(0);
+            pool.ParallelFor(100, [&](size_t, size_t itemIndex) { sum += itemIndex; });
+            NVPW_REQUIRE(pool.Initialize(2));
+            pool.ParallelFor(100, [&](size_t, size_t itemIndex) { sum += itemIndex; });
+            NVPW_CHECK(sum == 2 * 4950);
+        }
+    }
+
+    // Measures ParallelFor() scaling on a synthetic per-item workload with per-worker scratch state. It says nothing about the cost of real
+    // metric evaluation, see the "Evaluation Threads Benchmark" subcase of the Vulkan ReportGenerator test for that.
+    NVPW_TEST_CASE("ParallelFor Benchmark")
+    {
+        const size_t NumRanges = 4096;
+        const size_t NumCountersPerRange = 256;
+        const size_t NumMetrics = 600;
+
+        std::vector<uint64_t> counterData(NumRanges * NumCountersPerRange);
+        for (size_t ii = 0; ii < counterData.size(); ++ii)
+        {
+            counterData[ii] = (ii * 2654435761u) % 100000 + 1;
+        }
+
+        struct Evaluator
+        {
+            std::vector<double> scratch;
+            Evaluator() : scratch(NumCountersPerRange) {}
+            void Evaluate(const uint64_t* pCounters, double* pMetricValues)
+            {
+                for (size_t counterIndex = 0; counterIndex < NumCountersPerRange; ++counterIndex)
+                {
+                    scratch[counterIndex] = (double)pCounters[counterIndex];
+                }
+                for (size_t metricIndex = 0; metricIndex < NumMetrics; ++metricIndex)
+                {
+                    const double numerator = scratch[metricIndex % NumCountersPerRange] + scratch[(metricIndex * 7) % NumCountersPerRange];
+                    const double denominator = scratch[(metricIndex * 13 + 1) % NumCountersPerRange];
+                    pMetricValues[metricIndex] = numerator / denominator * 100.0;
+                }
+            }
+        };
+
+        auto measureNs = [](auto&& func) {
+            const auto begin = std::chrono::steady_clock::now();
+            func();
+            const auto end = std::chrono::steady_clock::now();
+            return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+        };
+
+        std::vector<std::vector<double>> serialValues(NumRanges, std::vector<double>(NumMetrics));
+        const double serialNs = measureNs([&]() {
+            Evaluator evaluator;
+            for (size_t rangeIndex = 0; rangeIndex < NumRanges; ++rangeIndex)
+            {
+                evaluator.Evaluate(&counterData[rangeIndex * NumCountersPerRange], serialValues[rangeIndex].data());
+            }
+        });
+
+        ThreadPool pool;
+        NVPW_REQUIRE(pool.Initialize(0));
+        std::vector<Evaluator> evaluators(pool.GetNumWorkers());
+        std::vector<std::vector<double>> parallelValues(NumRanges, std::vector<double>(NumMetrics));
+        const double parallelNs = measureNs([&]() {
+            pool.ParallelFor(NumRanges, [&](size_t workerIndex, size_t rangeIndex) {
+                evaluators[workerIndex].Evaluate(&counterData[rangeIndex * NumCountersPerRange], parallelValues[rangeIndex].data());
+            });
+        });
+        NVPW_CHECK(parallelValues == serialValues);
+
+        NVPW_TEST_MESSAGE("items: ", NumRanges, ", workers: ", pool.GetNumWorkers(), ", serial: ", serialNs / NumRanges, " ns/item, parallel: ", parallelNs / NumRanges, " ns/item");
+    }
+
+    NVPW_TEST_SUITE_END();
+
+}}} // nv::perf::test
@@ -0,0 +1,184 @@
+/*
+* Copyright 2014-2023 NVIDIA Corporation.  All rights reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "Offline.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <NvPerfTimeSeriesFile.h>
+
+namespace nv { namespace perf { namespace test {
+
+    NVPW_TEST_SUITE_BEGIN("TimeSeriesFile");
+
+    NVPW_TEST_CASE("RoundTrip")
+    {
+        const char* pPath = "Offline_TimeSeriesFile_RoundTrip.bin";
+        const size_t NumRows = 2500; // two full blocks of 1000 plus a partial one
+        const uint64_t FirstTimestamp = 123456789012345678ull;
+
+        std::vector<TimeSeriesColumnDesc> columns = {
+            { "timestamp", "nsecond", TimeSeriesColumnType::UInt64, TimeSeriesEncoding::Delta },
+            { "gpu__time_duration.sum", "nsecond", TimeSeriesColumnType::Float64, TimeSeriesEncoding::None },
+            { "sm__throughput.avg.pct_of_peak_sustained_elapsed", "%", TimeSeriesColumnType::Float64, TimeSeriesEncoding::Xor },
+            { "dram__bytes.sum", "byte", TimeSeriesColumnType::Float32, TimeSeriesEncoding::None },
+            { "lts__t_sectors.sum", "sector", TimeSeriesColumnType::Float32, TimeSeriesEncoding::Xor },
+        };
+        auto getTimestamp = [&](size_t row) { return FirstTimestamp + row * 1000000 + (row % 7); };
+        auto getValue = [](size_t row, size_t valueIndex) { return (row % 50) * 1.25 + valueIndex * 1000.0 + 1.0 / (row + 1); };
+
+        {
+            TimeSeriesWriter writer;
+            NVPW_REQUIRE(writer.Open(pPath, columns, 1000, 4));
+            std::vector<double> values(columns.size() - 1);
+            size_t numAppended = 0;
+            for (size_t row = 0; row < NumRows; ++row)
+            {
+                for (size_t valueIndex = 0; valueIndex < values.size(); ++valueIndex)
+                {
+                    values[valueIndex] = getValue(row, valueIndex);
+                }
+                numAppended += writer.AppendRow(getTimestamp(row), values.data(), values.size()) ? 1 : 0;
+            }
+            NVPW_CHECK(!writer.AppendRow(0, values.data(), values.size() - 1)); // wrong number of values
+            NVPW_CHECK(writer.GetNumRows() + writer.GetNumDroppedRows() == NumRows);
+            NVPW_CHECK(writer.GetNumRows() == numAppended);
+            NVPW_REQUIRE(writer.Close());
+            NVPW_REQUIRE(writer.GetNumDroppedRows() == 0); // 4 blocks of 1000 rows can't all be in flight with 2500 rows
+        }
+
+        {
+            TimeSeriesReader reader;
+            NVPW_REQUIRE(reader.Open(pPath));
+            NVPW_REQUIRE(reader.GetNumColumns() == columns.size());
+            for (size_t columnIndex = 0; columnIndex < columns.size(); ++columnIndex)
+            {
+                NVPW_CHECK(reader.GetColumn(columnIndex).name == columns[columnIndex].name);
+                NVPW_CHECK(reader.GetColumn(columnIndex).unit == columns[columnIndex].unit);
+                NVPW_CHECK(reader.GetColumn(columnIndex).type == columns[columnIndex].type);
+                NVPW_CHECK(reader.GetColumn(columnIndex).encoding == columns[columnIndex].encoding);
+            }
+            NVPW_CHECK(reader.FindColumn("dram__bytes.sum") == 3);
+            NVPW_CHECK(reader.FindColumn("unknown") == ~size_t(0));
+            NVPW_CHECK(reader.GetNumRows() == NumRows);
+            NVPW_REQUIRE(reader.GetNumBlocks() == 3);
+            NVPW_CHECK(reader.GetBlockNumRows(2) == 500);
+            NVPW_CHECK(reader.GetBlockFirstRow(2) == 2000);
+
+            std::vector<uint64_t> timestamps;
+            NVPW_REQUIRE(reader.ReadColumn(0, timestamps));
+            NVPW_REQUIRE(timestamps.size() == NumRows);
+            bool timestampsMatch = true;
+            for (size_t row = 0; row < NumRows; ++row)
+            {
+                timestampsMatch &= (timestamps[row] == getTimestamp(row));
+            }
+            NVPW_CHECK(timestampsMatch);
+
+            for (size_t columnIndex = 1; columnIndex < columns.size(); ++columnIndex)
+            {
+                NVPW_INFO("column: ", columns[columnIndex].name);
+                std::vector<double> values;
+                NVPW_REQUIRE(reader.ReadColumn(columnIndex, values));
+                NVPW_REQUIRE(values.size() == NumRows);
+                const bool isFloat32 = columns[columnIndex].type == TimeSeriesColumnType::Float32;
+                bool valuesMatch = true;
+                for (size_t row = 0; row < NumRows; ++row)
+                {
+                    const double expected = getValue(row, columnIndex - 1);
+                    valuesMatch &= (values[row] == (isFloat32 ? (double)(float)expected : expected));
+                }
+                NVPW_CHECK(valuesMatch);
+            }
+
+            // unencoded columns are readable in place
+            const double* pDurations = reader.GetBlockColumnData<double>(1, 1);
+            NVPW_REQUIRE(pDurations);
+            NVPW_CHECK(pDurations[0] == getValue(1000, 0));
+            const float* pBytes = reader.GetBlockColumnData<float>(2, 3);
+            NVPW_REQUIRE(pBytes);
+            NVPW_CHECK(pBytes[499] == (float)getValue(2499, 2));
+            NVPW_CHECK(!reader.GetBlockColumnData<uint64_t>(0, 0)); // delta-encoded
+            NVPW_CHECK(!reader.GetBlockColumnData<float>(0, 1));    // wrong type
+        }
+        std::remove(pPath);
+    }
+
+    NVPW_TEST_CASE("TruncatedFile")
+    {
+        const char* pPath = "Offline_TimeSeriesFile_Truncated.bin";
+        const std::vector<TimeSeriesColumnDesc> columns = {
+            { "timestamp", "nsecond", TimeSeriesColumnType::UInt64, TimeSeriesEncoding::None },
+            { "value", "", TimeSeriesColumnType::Float64, TimeSeriesEncoding::None },
+        };
+        {
+            TimeSeriesWriter writer;
+            NVPW_REQUIRE(writer.Open(pPath, columns, 10, 2));
+            for (size_t row = 0; row < 15; ++row)
+            {
+                const double value = (double)row;
+                writer.AppendRow(row, &value, 1);
+            }
+            NVPW_REQUIRE(writer.Close());
+        }
+
+        // chop off the end of the second block
+        std::vector<uint8_t> contents;
+        if (FILE* pFile = OpenFile(pPath, "rb"))
+        {
+            uint8_t buffer[256];
+            size_t numRead = 0;
+            while ((numRead = fread(buffer, 1, sizeof(buffer), pFile)) > 0)
+            {
+                contents.insert(contents.end(), buffer, buffer + numRead);
+            }
+            fclose(pFile);
+        }
+        NVPW_REQUIRE(contents.size() > 8);
+        if (FILE* pFile = OpenFile(pPath, "wb"))
+        {
+            fwrite(contents.data(), 1, contents.size() - 8, pFile);
+            fclose(pFile);
+        }
+
+        {
+            ScopedNvPerfLogDisabler logDisabler;
+            TimeSeriesReader reader;
+            NVPW_REQUIRE(reader.Open(pPath));
+            NVPW_CHECK(reader.GetNumBlocks() == 1);
+            NVPW_CHECK(reader.GetNumRows() == 10);
+        }
+        std::remove(pPath);
+    }
+
+    NVPW_TEST_CASE("InvalidSchema")
+    {
+        ScopedNvPerfLogDisabler logDisabler;
+        TimeSeriesWriter writer;
+        NVPW_CHECK(!writer.Open("unused.bin", {}));
+        NVPW_CHECK(!writer.Open("unused.bin", { { "value", "", TimeSeriesColumnType::Float64, TimeSeriesEncoding::None } }));
+        NVPW_CHECK(!writer.Open("unused.bin", {
+            { "timestamp", "", TimeSeriesColumnType::UInt64, TimeSeriesEncoding::None },
+            { "value", "", TimeSeriesColumnType::Float64, TimeSeriesEncoding::Delta } }));
+        NVPW_CHECK(!writer.IsOpen());
+
+        TimeSeriesReader reader;
+        NVPW_CHECK(!reader.Open("Offline_TimeSeriesFile_DoesNotExist.bin"));
+    }
+
+    NVPW_TEST_SUITE_END();
+
+}}} // nv::perf::test
@@ -14,6 +14,7 @@
 * limitations under the License.
 */
 #include "VulkanUtilities.h"
+#include <chrono>
 #include <NvPerfReportGeneratorVulkan.h>
 #include <NvPerfScopeExitGuard.h>
 
@@ -215,6 +216,62 @@ namespace nv { namespace perf { namespace test {
                 verify(std::vector<const char*>(), CsvFileNames);
             }
         }
+
+        // times the evaluation of a many-range report in the frame that completes the collection, serial versus parallel
+        NVPW_SUBCASE("Evaluation Threads Benchmark")
+        {
+            const size_t NumDraws = 255;
+            auto runFrames = [&](size_t numEvaluationThreads, size_t& numRangesWritten) {
+                nvperf.SetNumEvaluationThreads(numEvaluationThreads);
+                nvperf.outputOptions = ReportOutputOptions();
+                nvperf.outputOptions.enableHtmlReport = false;
+                nvperf.outputOptions.enableCsvReport = false;
+                nvperf.outputOptions.reportWriters.push_back([&](const MetricsEvaluator&, const ReportLayout&, const ReportData& reportData) {
+                    numRangesWritten = reportData.ranges.size();
+                });
+                nvperf.StartCollectionOnNextFrame();
+
+                double lastFrameEndNs = 0.0;
+                do
+                {
+                    VkCommandBufferBeginInfo beginInfo{};
+                    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+                    NVPW_REQUIRE(vkBeginCommandBuffer(commandBuffer.commandBuffer, &beginInfo) == VK_SUCCESS);
+                    for (size_t drawIndex = 0; drawIndex < NumDraws; ++drawIndex)
+                    {
+                        NVPW_REQUIRE(nvperf.rangeCommands.PushRange(commandBuffer.commandBuffer, "Draw"));
+                        NVPW_REQUIRE(nvperf.rangeCommands.PopRange(commandBuffer.commandBuffer));
+                    }
+                    NVPW_REQUIRE(vkEndCommandBuffer(commandBuffer.commandBuffer) == VK_SUCCESS);
+
+#if defined(VK_NO_PROTOTYPES)
+                    NVPW_REQUIRE(nvperf.OnFrameStart(logicalDevice.gfxQueue, logicalDevice.gfxQueueFamilyIndex, vkGetInstanceProcAddr, vkGetDeviceProcAddr));
+#else
+                    NVPW_REQUIRE(nvperf.OnFrameStart(logicalDevice.gfxQueue, logicalDevice.gfxQueueFamilyIndex));
+#endif
+                    VkSubmitInfo submitInfo{};
+                    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+                    submitInfo.commandBufferCount = 1;
+                    submitInfo.pCommandBuffers = &commandBuffer.commandBuffer;
+                    NVPW_REQUIRE(vkQueueSubmit(logicalDevice.gfxQueue, 1, &submitInfo, VK_NULL_HANDLE) == VK_SUCCESS);
+                    NVPW_REQUIRE(vkQueueWaitIdle(logicalDevice.gfxQueue) == VK_SUCCESS);
+
+                    const auto begin = std::chrono::steady_clock::now();
+                    NVPW_REQUIRE(nvperf.OnFrameEnd());
+                    const auto end = std::chrono::steady_clock::now();
+                    lastFrameEndNs = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+                } while (nvperf.IsCollectingReport());
+                return lastFrameEndNs;
+            };
+
+            size_t numRangesSerial = 0;
+            const double serialNs = runFrames(1, numRangesSerial);
+            size_t numRangesParallel = 0;
+            const double parallelNs = runFrames(0, numRangesParallel);
+            NVPW_CHECK(numRangesSerial == NumDraws + 1);
+            NVPW_CHECK(numRangesParallel == NumDraws + 1);
+            NVPW_TEST_MESSAGE("ranges: ", NumDraws + 1, ", report evaluation with 1 thread: ", serialNs / 1e6, " ms, with hardware concurrency threads: ", parallelNs / 1e6, " ms");
+        }
     }
 
     NVPW_TEST_SUITE_END();
@@ -22,6 +22,14 @@ SET(NvPerfUtility_IMPORTS_DIR "${CMAKE_CURRENT_LIST_DIR}/../NvPerfUtility/import
 
 add_library(NvPerfUtility INTERFACE)
 set_target_properties(NvPerfUtility PROPERTIES INTERFACE_INCLUDE_DIRECTORIES "${NvPerfUtility_INCLUDE_DIRS}")
+# Compiles in the report definitions of only the listed chip families, e.g. -DNvPerfUtility_REPORT_DEFINITION_FAMILIES=GA10B, see NvPerfReportDefinitionHAL.h
+if(NvPerfUtility_REPORT_DEFINITION_FAMILIES)
+    set(NvPerfUtility_REPORT_DEFINITION_DEFINES NV_PERF_REPORT_DEFINITIONS_DEFAULT=0)
+    foreach(Family IN LISTS NvPerfUtility_REPORT_DEFINITION_FAMILIES)
+        list(APPEND NvPerfUtility_REPORT_DEFINITION_DEFINES NV_PERF_REPORT_DEFINITIONS_${Family}=1)
+    endforeach()
+    set_target_properties(NvPerfUtility PROPERTIES INTERFACE_COMPILE_DEFINITIONS "${NvPerfUtility_REPORT_DEFINITION_DEFINES}")
+endif()
 SET(NvPerfUtility_LIBRARIES NvPerfUtility)
 
 